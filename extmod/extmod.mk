@@ -39,10 +39,10 @@ SRC_MOD += $(addprefix $(LITTLEFS_DIR)/,\
 	lfs2.c \
 	lfs2_util.c \
 	)
-else
-CFLAGS_MOD += -DMICROPY_VFS_LFS2=0
 
 $(BUILD)/$(LITTLEFS_DIR)/lfs2.o: CFLAGS += -Wno-missing-field-initializers
+else
+CFLAGS_MOD += -DMICROPY_VFS_LFS2=0
 endif
 
 ################################################################################
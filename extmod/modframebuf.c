@@ -14,6 +14,11 @@
 
 #include "font_petme128_8x8.h"
 
+#if MICROPY_PY_FRAMEBUF_BITMAP
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-module/displayio/Bitmap.h"
+#endif
+
 typedef struct _mp_obj_framebuf_t {
     mp_obj_base_t base;
     mp_obj_t buf_obj; // need to store this to prevent GC from reclaiming buf
@@ -59,17 +64,38 @@ STATIC uint32_t mono_horiz_getpixel(const mp_obj_framebuf_t *fb, unsigned int x,
     return (((uint8_t *)fb->buf)[index] >> (offset)) & 0x01;
 }
 
+// Mask for pixels a to b - 1 of a byte, where pixel 0 is the MSB for MHLSB and the LSB for MHMSB.
+static inline uint8_t mono_horiz_mask(unsigned int reverse, unsigned int a, unsigned int b) {
+    if (reverse) {
+        return (0xff << a) & (0xff >> (8 - b));
+    }
+    return (0xff >> a) & (0xff << (8 - b));
+}
+
 STATIC void mono_horiz_fill_rect(const mp_obj_framebuf_t *fb, unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint32_t col) {
     unsigned int reverse = fb->format == FRAMEBUF_MHMSB;
     unsigned int advance = fb->stride >> 3;
-    while (w--) {
-        uint8_t *b = &((uint8_t *)fb->buf)[(x >> 3) + y * advance];
-        unsigned int offset = reverse ?  x & 7 : 7 - (x & 7);
-        for (unsigned int hh = h; hh; --hh) {
-            *b = (*b & ~(0x01 << offset)) | ((col != 0) << offset);
-            b += advance;
+    uint8_t fill = col ? 0xff : 0x00;
+    uint8_t *b = &((uint8_t *)fb->buf)[(x >> 3) + y * advance];
+    unsigned int first = x & 7;
+    unsigned int end = first + w;
+    if (end <= 8) {
+        // The whole span is within one byte.
+        uint8_t mask = mono_horiz_mask(reverse, first, end);
+        for (; h; --h, b += advance) {
+            *b = (*b & ~mask) | (fill & mask);
+        }
+        return;
+    }
+    size_t middle = (end >> 3) - 1;
+    uint8_t first_mask = mono_horiz_mask(reverse, first, 8);
+    uint8_t last_mask = (end & 7) ? mono_horiz_mask(reverse, 0, end & 7) : 0;
+    for (; h; --h, b += advance) {
+        b[0] = (b[0] & ~first_mask) | (fill & first_mask);
+        memset(b + 1, fill, middle);
+        if (last_mask) {
+            b[middle + 1] = (b[middle + 1] & ~last_mask) | (fill & last_mask);
         }
-        ++x;
     }
 }
 
@@ -86,14 +112,22 @@ STATIC uint32_t mvlsb_getpixel(const mp_obj_framebuf_t *fb, unsigned int x, unsi
 }
 
 STATIC void mvlsb_fill_rect(const mp_obj_framebuf_t *fb, unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint32_t col) {
-    while (h--) {
+    uint8_t fill = col ? 0xff : 0x00;
+    unsigned int yend = y + h;
+    while (y < yend) {
+        // Each byte holds a column of 8 rows, so fill the rows of one band at a time.
         uint8_t *b = &((uint8_t *)fb->buf)[(y >> 3) * fb->stride + x];
-        uint8_t offset = y & 0x07;
-        for (unsigned int ww = w; ww; --ww) {
-            *b = (*b & ~(0x01 << offset)) | ((col != 0) << offset);
-            ++b;
+        unsigned int band_end = MIN((y & ~7) + 8, yend);
+        uint8_t mask = (0xff << (y & 7)) & (0xff >> (8 - (band_end - (y & ~7))));
+        if (mask == 0xff) {
+            memset(b, fill, w);
+        } else {
+            for (unsigned int ww = w; ww; --ww) {
+                *b = (*b & ~mask) | (fill & mask);
+                ++b;
+            }
         }
-        ++y;
+        y = band_end;
     }
 }
 
@@ -108,12 +142,13 @@ STATIC uint32_t rgb565_getpixel(const mp_obj_framebuf_t *fb, unsigned int x, uns
 }
 
 STATIC void rgb565_fill_rect(const mp_obj_framebuf_t *fb, unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint32_t col) {
-    uint16_t *b = &((uint16_t *)fb->buf)[x + y * fb->stride];
-    while (h--) {
-        for (unsigned int ww = w; ww; --ww) {
-            *b++ = col;
-        }
-        b += fb->stride - w;
+    uint16_t *row = &((uint16_t *)fb->buf)[x + y * fb->stride];
+    for (unsigned int ww = 0; ww < w; ++ww) {
+        row[ww] = col;
+    }
+    // The remaining rows are copies of the first.
+    for (unsigned int hh = 1; hh < h; ++hh) {
+        memcpy(row + hh * fb->stride, row, w * sizeof(uint16_t));
     }
 }
 
@@ -134,9 +169,27 @@ STATIC uint32_t gs2_hmsb_getpixel(const mp_obj_framebuf_t *fb, unsigned int x, u
 }
 
 STATIC void gs2_hmsb_fill_rect(const mp_obj_framebuf_t *fb, unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint32_t col) {
-    for (unsigned int xx = x; xx < x + w; xx++) {
-        for (unsigned int yy = y; yy < y + h; yy++) {
-            gs2_hmsb_setpixel(fb, xx, yy, col);
+    // Pixel 0 of each byte is in the two LSBs.
+    uint8_t fill = (col & 0x3) * 0x55;
+    unsigned int advance = fb->stride >> 2;
+    uint8_t *b = &((uint8_t *)fb->buf)[(x + y * fb->stride) >> 2];
+    unsigned int first = x & 3;
+    unsigned int end = first + w;
+    if (end <= 4) {
+        uint8_t mask = (0xff << (first * 2)) & (0xff >> (8 - end * 2));
+        for (; h; --h, b += advance) {
+            *b = (*b & ~mask) | (fill & mask);
+        }
+        return;
+    }
+    size_t middle = (end >> 2) - 1;
+    uint8_t first_mask = 0xff << (first * 2);
+    uint8_t last_mask = 0xff >> (8 - (end & 3) * 2);
+    for (; h; --h, b += advance) {
+        b[0] = (b[0] & ~first_mask) | (fill & first_mask);
+        memset(b + 1, fill, middle);
+        if (end & 3) {
+            b[middle + 1] = (b[middle + 1] & ~last_mask) | (fill & last_mask);
         }
     }
 }
@@ -244,7 +297,95 @@ STATIC void fill_rect(const mp_obj_framebuf_t *fb, int x, int y, int w, int h, u
     formats[fb->format].fill_rect(fb, x, y, xend - x, yend - y, col);
 }
 
+// Bits per pixel for each format. MVLSB packs its pixels vertically.
+STATIC const uint8_t format_bpp[] = {
+    [FRAMEBUF_MVLSB] = 1,
+    [FRAMEBUF_RGB565] = 16,
+    [FRAMEBUF_GS2_HMSB] = 2,
+    [FRAMEBUF_GS4_HMSB] = 4,
+    [FRAMEBUF_GS8] = 8,
+    [FRAMEBUF_MHLSB] = 1,
+    [FRAMEBUF_MHMSB] = 1,
+};
+
+STATIC void blit_pixels(const mp_obj_framebuf_t *self, const mp_obj_framebuf_t *source, int x0, int y0, int x1, int y1, int w, int h) {
+    for (int yy = 0; yy < h; ++yy) {
+        for (int xx = 0; xx < w; ++xx) {
+            setpixel(self, x0 + xx, y0 + yy, getpixel(source, x1 + xx, y1 + yy));
+        }
+    }
+}
+
+// Copy a clipped w by h area of a source with the same format, a whole byte at a time where the
+// pixel layout of both buffers lines up.
+STATIC void blit_copy(const mp_obj_framebuf_t *self, const mp_obj_framebuf_t *source, int x0, int y0, int x1, int y1, int w, int h) {
+    uint8_t *dest_buf = self->buf;
+    const uint8_t *source_buf = source->buf;
+    int copied_w = 0;
+    int copied_h = 0;
+    if (self->format == FRAMEBUF_MVLSB) {
+        if ((y0 & 7) == 0 && (y1 & 7) == 0) {
+            copied_w = w;
+            copied_h = h & ~7;
+            for (int yy = 0; yy < copied_h; yy += 8) {
+                memmove(&dest_buf[((y0 + yy) >> 3) * self->stride + x0],
+                    &source_buf[((y1 + yy) >> 3) * source->stride + x1], w);
+            }
+        }
+    } else {
+        unsigned int bpp = format_bpp[self->format];
+        if (((x0 * bpp) & 7) == 0 && ((x1 * bpp) & 7) == 0) {
+            size_t len = (w * bpp) >> 3;
+            copied_w = len * 8 / bpp;
+            copied_h = h;
+            for (int yy = 0; yy < h; ++yy) {
+                memmove(&dest_buf[((size_t)x0 + (size_t)(y0 + yy) * self->stride) * bpp >> 3],
+                    &source_buf[((size_t)x1 + (size_t)(y1 + yy) * source->stride) * bpp >> 3], len);
+            }
+        }
+    }
+    // Whatever could not be copied as bytes is copied pixel by pixel.
+    blit_pixels(self, source, x0 + copied_w, y0, x1 + copied_w, y1, w - copied_w, copied_h);
+    blit_pixels(self, source, x0, y0 + copied_h, x1, y1 + copied_h, w, h - copied_h);
+}
+
+#if MICROPY_PY_FRAMEBUF_BITMAP
+// Make a FrameBuffer that draws directly into the pixels of a displayio.Bitmap. Only the formats
+// with a byte layout matching the Bitmap's are possible: Bitmaps with fewer than 8 bits per value
+// pack the first pixel of each 32-bit word into its MSBs.
+STATIC mp_obj_t framebuf_make_new_from_bitmap(const mp_obj_type_t *type, mp_obj_t bitmap_in) {
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(bitmap_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(bitmap_in, &bufinfo, MP_BUFFER_WRITE);
+
+    mp_obj_framebuf_t *o = m_new_obj(mp_obj_framebuf_t);
+    o->base.type = type;
+    o->buf_obj = bitmap_in;
+    o->buf = bufinfo.buf;
+    o->width = bitmap->width;
+    o->height = bitmap->height;
+    o->stride = bitmap->stride * 32 / bitmap->bits_per_value;
+    switch (bitmap->bits_per_value) {
+        case 8:
+            o->format = FRAMEBUF_GS8;
+            break;
+        case 16:
+            o->format = FRAMEBUF_RGB565;
+            break;
+        default:
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid format"));
+    }
+    return MP_OBJ_FROM_PTR(o);
+}
+#endif
+
 STATIC mp_obj_t framebuf_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    #if MICROPY_PY_FRAMEBUF_BITMAP
+    if (n_args == 1 && n_kw == 0 && mp_obj_is_type(args[0], &displayio_bitmap_type)) {
+        return framebuf_make_new_from_bitmap(type, args[0]);
+    }
+    #endif
     mp_arg_check_num(n_args, n_kw, 4, 5, false);
 
     mp_obj_framebuf_t *o = m_new_obj(mp_obj_framebuf_t);
@@ -410,6 +551,12 @@ STATIC mp_obj_t framebuf_line(size_t n_args, const mp_obj_t *args) {
     mp_int_t y2 = mp_obj_get_int(args[4]);
     mp_int_t col = mp_obj_get_int(args[5]);
 
+    if (x1 == x2 || y1 == y2) {
+        // Horizontal and vertical lines, including both end points, are spans that fill_rect clips.
+        fill_rect(self, MIN(x1, x2), MIN(y1, y2), MAX(x1, x2) - MIN(x1, x2) + 1, MAX(y1, y2) - MIN(y1, y2) + 1, col);
+        return mp_const_none;
+    }
+
     mp_int_t dx = x2 - x1;
     mp_int_t sx;
     if (dx > 0) {
@@ -504,6 +651,11 @@ STATIC mp_obj_t framebuf_blit(size_t n_args, const mp_obj_t *args) {
     int x0end = MIN(self->width, x + source->width);
     int y0end = MIN(self->height, y + source->height);
 
+    if (key == -1 && palette == NULL && source->format == self->format && source->buf != self->buf) {
+        blit_copy(self, source, x0, y0, x1, y1, x0end - x0, y0end - y0);
+        return mp_const_none;
+    }
+
     for (; y0 < y0end; ++y0) {
         int cx1 = x1;
         for (int cx0 = x0; cx0 < x0end; ++cx0) {
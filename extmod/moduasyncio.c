@@ -26,6 +26,7 @@
 
 #include "py/runtime.h"
 #include "py/smallint.h"
+#include "py/objgenerator.h"
 #include "py/pairheap.h"
 #include "py/mphal.h"
 
@@ -328,6 +329,232 @@ STATIC const mp_obj_type_t task_type = {
         ),
 };
 
+/******************************************************************************/
+// SingletonGenerator class
+
+// Yields once to put the current task back on the queue at the time in state, then stops.
+// await sleep_ms() and sleep() reuse one of these so that they don't allocate.
+typedef struct _mp_obj_singleton_generator_t {
+    mp_obj_base_t base;
+    mp_obj_t state;
+} mp_obj_singleton_generator_t;
+
+STATIC const mp_obj_type_t singleton_generator_type;
+
+STATIC mp_obj_t singleton_generator_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    (void)args;
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    mp_obj_singleton_generator_t *self = m_new_obj(mp_obj_singleton_generator_t);
+    self->base.type = type;
+    self->state = mp_const_none;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t singleton_generator_await(mp_obj_t self_in) {
+    return self_in;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(singleton_generator_await_obj, singleton_generator_await);
+
+STATIC void singleton_generator_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
+    mp_obj_singleton_generator_t *self = MP_OBJ_TO_PTR(self_in);
+    if (dest[0] == MP_OBJ_NULL) {
+        // Load
+        if (attr == MP_QSTR_state) {
+            dest[0] = self->state;
+        } else if (attr == MP_QSTR___await__) {
+            dest[0] = MP_OBJ_FROM_PTR(&singleton_generator_await_obj);
+            dest[1] = self_in;
+        }
+    } else if (dest[1] != MP_OBJ_NULL) {
+        // Store
+        if (attr == MP_QSTR_state) {
+            self->state = dest[1];
+            dest[0] = MP_OBJ_NULL;
+        }
+    }
+}
+
+STATIC mp_obj_t singleton_generator_iternext(mp_obj_t self_in) {
+    mp_obj_singleton_generator_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->state == mp_const_none) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    // _task_queue.push_sorted(cur_task, self.state)
+    mp_obj_t args[3] = {
+        mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR__task_queue)),
+        mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_cur_task)),
+        self->state,
+    };
+    task_queue_push_sorted(3, args);
+    self->state = mp_const_none;
+    return mp_const_none;
+}
+
+STATIC const mp_obj_type_t singleton_generator_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_SingletonGenerator,
+    .make_new = singleton_generator_make_new,
+    .attr = singleton_generator_attr,
+    MP_TYPE_EXTENDED_FIELDS(
+        .getiter = mp_identity_getiter,
+        .iternext = singleton_generator_iternext,
+        ),
+};
+
+/******************************************************************************/
+// Main run loop
+//
+// run_until_complete and SingletonGenerator are only picked up by extmod/uasyncio/core.py,
+// which is frozen into the unix dev variant. Boards run the Adafruit asyncio library, which
+// doesn't use them, so on boards they are unused. tests/extmod/uasyncio_c_loop.py tests them.
+
+STATIC mp_obj_t uasyncio_context_get(qstr name) {
+    return mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(name));
+}
+
+STATIC void uasyncio_push_head(mp_obj_t task_queue, mp_obj_t task) {
+    mp_obj_t args[2] = { task_queue, task };
+    task_queue_push_sorted(2, args);
+}
+
+// Waits until the head of _task_queue is ready to run. Returns false when no task can be
+// woken, so the loop is finished.
+STATIC bool uasyncio_wait_for_task(void) {
+    mp_int_t dt = 1;
+    while (dt > 0) {
+        dt = -1;
+        mp_obj_task_queue_t *task_queue = MP_OBJ_TO_PTR(uasyncio_context_get(MP_QSTR__task_queue));
+        mp_obj_t io_queue = uasyncio_context_get(MP_QSTR__io_queue);
+        if (task_queue->heap != NULL) {
+            // A task waiting on _task_queue; "ph_key" is time to schedule task at.
+            dt = ticks_diff(task_queue->heap->ph_key, ticks());
+            dt = MAX(0, dt);
+        } else if (!mp_obj_is_true(mp_load_attr(io_queue, MP_QSTR_map))) {
+            return false;
+        }
+        // _io_queue.wait_io_event(dt)
+        mp_obj_t dest[3];
+        mp_load_method(io_queue, MP_QSTR_wait_io_event, dest);
+        dest[2] = MP_OBJ_NEW_SMALL_INT(dt);
+        mp_call_method_n_kw(1, 0, dest);
+    }
+    return true;
+}
+
+// The same loop as run_until_complete in uasyncio/core.py, which uses this when it is
+// available. Keeps scheduling tasks until main_task finishes or there are none left.
+STATIC mp_obj_t uasyncio_run_until_complete(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t main_task = n_args > 0 ? args[0] : mp_const_none;
+    if (uasyncio_context == MP_OBJ_NULL) {
+        // No task has been made yet, so there is nothing to run.
+        return mp_const_none;
+    }
+    mp_obj_t cancelled_error = uasyncio_context_get(MP_QSTR_CancelledError);
+    while (true) {
+        mp_handle_pending(true);
+        if (!uasyncio_wait_for_task()) {
+            return mp_const_none;
+        }
+
+        // Get next task to run and continue it.
+        mp_obj_t task_queue = uasyncio_context_get(MP_QSTR__task_queue);
+        mp_obj_t t_in = task_queue_pop_head(task_queue);
+        mp_obj_task_t *t = MP_OBJ_TO_PTR(t_in);
+        mp_obj_dict_store(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_cur_task), t_in);
+
+        // Continue running the coroutine, it's responsible for rescheduling itself.
+        mp_obj_t exc = t->data;
+        mp_obj_t ret;
+        mp_vm_return_kind_t kind;
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            if (!mp_obj_is_true(exc)) {
+                kind = mp_resume(t->coro, mp_const_none, MP_OBJ_NULL, &ret);
+            } else {
+                // The task had an exception and was not await'ed on. Throwing into it now
+                // raises StopIteration, which calls the exception handler below.
+                t->data = mp_const_none;
+                if (mp_obj_is_type(t->coro, &mp_type_gen_instance)) {
+                    // As coro.throw(exc) does, which also works on a just-started generator.
+                    kind = mp_obj_gen_resume(t->coro, mp_const_none, exc, &ret);
+                } else {
+                    kind = mp_resume(t->coro, MP_OBJ_NULL, exc, &ret);
+                }
+            }
+            nlr_pop();
+        } else {
+            kind = MP_VM_RETURN_EXCEPTION;
+            ret = MP_OBJ_FROM_PTR(nlr.ret_val);
+        }
+        if (kind == MP_VM_RETURN_YIELD) {
+            continue;
+        }
+
+        // This task is done. er is what Python would catch: StopIteration or the exception.
+        mp_obj_t er;
+        bool stopped;
+        if (kind == MP_VM_RETURN_NORMAL) {
+            if (t_in == main_task) {
+                return ret;
+            }
+            er = mp_obj_new_exception_arg1(&mp_type_StopIteration, ret);
+            stopped = true;
+        } else {
+            if (!mp_obj_exception_match(ret, cancelled_error) &&
+                !mp_obj_exception_match(ret, MP_OBJ_FROM_PTR(&mp_type_Exception))) {
+                nlr_raise(ret);
+            }
+            stopped = mp_obj_exception_match(ret, cancelled_error) ||
+                mp_obj_exception_match(ret, MP_OBJ_FROM_PTR(&mp_type_StopIteration));
+            if (t_in == main_task) {
+                if (mp_obj_exception_match(ret, MP_OBJ_FROM_PTR(&mp_type_StopIteration))) {
+                    return mp_obj_exception_get_value(ret);
+                }
+                nlr_raise(ret);
+            }
+            er = ret;
+        }
+
+        if (t->state == mp_const_none) {
+            // Task is already finished and nothing await'ed on the task,
+            // so call the exception handler.
+            mp_obj_t exc_context = uasyncio_context_get(MP_QSTR__exc_context);
+            mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_exception), exc);
+            mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_future), t_in);
+            mp_obj_t dest[3];
+            mp_load_method(uasyncio_context_get(MP_QSTR_Loop), MP_QSTR_call_exception_handler, dest);
+            dest[2] = exc_context;
+            mp_call_method_n_kw(1, 0, dest);
+        } else if (t->state != mp_const_false) {
+            // Task was running but is now finished.
+            bool waiting = false;
+            if (t->state == TASK_STATE_RUNNING_NOT_WAITED_ON) {
+                // "None" indicates that the task is complete and not await'ed on (yet).
+                t->state = TASK_STATE_DONE_NOT_WAITED_ON;
+            } else {
+                // Schedule any other tasks waiting on the completion of this task.
+                mp_obj_task_queue_t *waiting_queue = MP_OBJ_TO_PTR(t->state);
+                while (waiting_queue->heap != NULL) {
+                    uasyncio_push_head(task_queue, task_queue_pop_head(t->state));
+                    waiting = true;
+                }
+                // "False" indicates that the task is complete and has been await'ed on.
+                t->state = TASK_STATE_DONE_WAS_WAITED_ON;
+            }
+            if (!waiting && !stopped) {
+                // An exception ended this detached task, so queue it for later
+                // execution to handle the uncaught exception if no other task retrieves
+                // the exception in the meantime (this is handled by Task.throw).
+                uasyncio_push_head(task_queue, t_in);
+            }
+            // Save return value of coro to pass up to caller.
+            t->data = er;
+        }
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(uasyncio_run_until_complete_obj, 0, 1, uasyncio_run_until_complete);
+
 /******************************************************************************/
 // C-level uasyncio module
 
@@ -339,6 +566,8 @@ STATIC const mp_rom_map_elem_t mp_module_uasyncio_globals_table[] = {
     #endif
     { MP_ROM_QSTR(MP_QSTR_TaskQueue), MP_ROM_PTR(&task_queue_type) },
     { MP_ROM_QSTR(MP_QSTR_Task), MP_ROM_PTR(&task_type) },
+    { MP_ROM_QSTR(MP_QSTR_SingletonGenerator), MP_ROM_PTR(&singleton_generator_type) },
+    { MP_ROM_QSTR(MP_QSTR_run_until_complete), MP_ROM_PTR(&uasyncio_run_until_complete_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(mp_module_uasyncio_globals, mp_module_uasyncio_globals_table);
 
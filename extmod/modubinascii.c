@@ -43,18 +43,11 @@ STATIC mp_obj_t mod_binascii_hexlify(size_t n_args, const mp_obj_t *args) {
         sep = mp_obj_str_get_str(args[1]);
     }
     vstr_init_len(&vstr, out_len);
+    static const char hex_digits[] = "0123456789abcdef";
     byte *in = bufinfo.buf, *out = (byte *)vstr.buf;
     for (mp_uint_t i = bufinfo.len; i--;) {
-        byte d = (*in >> 4);
-        if (d > 9) {
-            d += 'a' - '9' - 1;
-        }
-        *out++ = d + '0';
-        d = (*in++ & 0xf);
-        if (d > 9) {
-            d += 'a' - '9' - 1;
-        }
-        *out++ = d + '0';
+        *out++ = hex_digits[*in >> 4];
+        *out++ = hex_digits[*in++ & 0xf];
         if (sep != NULL && i != 0) {
             *out++ = *sep;
         }
@@ -73,58 +66,73 @@ STATIC mp_obj_t mod_binascii_unhexlify(mp_obj_t data) {
     vstr_t vstr;
     vstr_init_len(&vstr, bufinfo.len / 2);
     byte *in = bufinfo.buf, *out = (byte *)vstr.buf;
-    byte hex_byte = 0;
-    for (mp_uint_t i = bufinfo.len; i--;) {
-        byte hex_ch = *in++;
-        if (unichar_isxdigit(hex_ch)) {
-            hex_byte += unichar_xdigit_value(hex_ch);
-        } else {
+    for (mp_uint_t i = bufinfo.len / 2; i--; in += 2) {
+        if (!unichar_isxdigit(in[0]) || !unichar_isxdigit(in[1])) {
             mp_raise_ValueError(MP_ERROR_TEXT("non-hex digit found"));
         }
-        if (i & 1) {
-            hex_byte <<= 4;
-        } else {
-            *out++ = hex_byte;
-            hex_byte = 0;
-        }
+        // For a hex digit, bit 6 is set only for letters, whose low nibble is then 9 less than their value.
+        *out++ = ((in[0] & 0xf) + 9 * (in[0] >> 6)) << 4 | ((in[1] & 0xf) + 9 * (in[1] >> 6));
     }
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_unhexlify_obj, mod_binascii_unhexlify);
 
-// If ch is a character in the base64 alphabet, and is not a pad character, then
-// the corresponding integer between 0 and 63, inclusively, is returned.
-// Otherwise, -1 is returned.
-static int mod_binascii_sextet(byte ch) {
-    if (ch >= 'A' && ch <= 'Z') {
-        return ch - 'A';
-    } else if (ch >= 'a' && ch <= 'z') {
-        return ch - 'a' + 26;
-    } else if (ch >= '0' && ch <= '9') {
-        return ch - '0' + 52;
-    } else if (ch == '+') {
-        return 62;
-    } else if (ch == '/') {
-        return 63;
-    } else {
-        return -1;
-    }
-}
-
-STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
-    mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
-    byte *in = bufinfo.buf;
+#define X (0xff)
+// The value of each character in the base64 alphabet, or X for characters outside it,
+// including the pad character.
+static const byte base64_sextet[256] = {
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, 62, X, X, X, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, X, X, X, X, X, X,
+    X, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, X, X, X, X, X,
+    X, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+    X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+};
+#undef X
 
-    vstr_t vstr;
-    vstr_init(&vstr, (bufinfo.len / 4) * 3 + 1); // Potentially over-allocate
-    byte *out = (byte *)vstr.buf;
+static const char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+// Decode base64 from in into out, which has room for out_len bytes, and return the number of
+// bytes decoded. Groups of four alphabet characters are decoded as a 24-bit word; anything else,
+// such as padding, line breaks or ignored characters, goes through the bit-at-a-time state.
+static size_t base64_decode(const byte *in, size_t in_len, byte *out, size_t out_len) {
+    size_t len = 0;
     uint shift = 0;
     int nbits = 0; // Number of meaningful bits in shift
     bool hadpad = false; // Had a pad character since last valid character
-    for (size_t i = 0; i < bufinfo.len; i++) {
-        if (in[i] == '=') {
+    size_t i = 0;
+    while (i < in_len) {
+        if (nbits == 0 && i + 4 <= in_len) {
+            uint32_t a = base64_sextet[in[i]];
+            uint32_t b = base64_sextet[in[i + 1]];
+            uint32_t c = base64_sextet[in[i + 2]];
+            uint32_t d = base64_sextet[in[i + 3]];
+            if (((a | b | c | d) & 0x80) == 0) {
+                if (len + 3 > out_len) {
+                    mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+                }
+                uint32_t word = a << 18 | b << 12 | c << 6 | d;
+                out[len++] = word >> 16;
+                out[len++] = word >> 8;
+                out[len++] = word;
+                hadpad = false;
+                i += 4;
+                continue;
+            }
+        }
+
+        byte ch = in[i++];
+        if (ch == '=') {
             if ((nbits == 2) || ((nbits == 4) && hadpad)) {
                 nbits = 0;
                 break;
@@ -132,8 +140,8 @@ STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
             hadpad = true;
         }
 
-        int sextet = mod_binascii_sextet(in[i]);
-        if (sextet == -1) {
+        byte sextet = base64_sextet[ch];
+        if (sextet & 0x80) {
             continue;
         }
         hadpad = false;
@@ -142,70 +150,94 @@ STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
 
         if (nbits >= 8) {
             nbits -= 8;
-            out[vstr.len++] = (shift >> nbits) & 0xFF;
+            if (len == out_len) {
+                mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+            }
+            out[len++] = (shift >> nbits) & 0xFF;
         }
     }
 
     if (nbits) {
         mp_raise_ValueError(MP_ERROR_TEXT("incorrect padding"));
     }
+    return len;
+}
+
+static size_t base64_encoded_len(size_t len) {
+    return (len + 2) / 3 * 4;
+}
+
+// Encode len bytes from in as base64 into out, which must have room for base64_encoded_len(len)
+// bytes, three input bytes at a time.
+static void base64_encode(const byte *in, size_t len, byte *out) {
+    for (; len >= 3; len -= 3, in += 3, out += 4) {
+        uint32_t word = in[0] << 16 | in[1] << 8 | in[2];
+        out[0] = base64_alphabet[word >> 18];
+        out[1] = base64_alphabet[(word >> 12) & 0x3f];
+        out[2] = base64_alphabet[(word >> 6) & 0x3f];
+        out[3] = base64_alphabet[word & 0x3f];
+    }
+    if (len != 0) {
+        uint32_t word = in[0] << 16 | (len == 2 ? in[1] << 8 : 0);
+        out[0] = base64_alphabet[word >> 18];
+        out[1] = base64_alphabet[(word >> 12) & 0x3f];
+        out[2] = len == 2 ? base64_alphabet[(word >> 6) & 0x3f] : '=';
+        out[3] = '=';
+    }
+}
+
+STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+
+    vstr_t vstr;
+    // Every character decodes to at most 6 bits.
+    vstr_init(&vstr, bufinfo.len / 4 * 3 + 3);
+    vstr.len = base64_decode(bufinfo.buf, bufinfo.len, (byte *)vstr.buf, vstr.alloc);
 
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_a2b_base64_obj, mod_binascii_a2b_base64);
 
+STATIC mp_obj_t mod_binascii_a2b_base64_into(mp_obj_t data, mp_obj_t buf) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t outinfo;
+    mp_get_buffer_raise(buf, &outinfo, MP_BUFFER_WRITE);
+
+    return MP_OBJ_NEW_SMALL_INT(base64_decode(bufinfo.buf, bufinfo.len, outinfo.buf, outinfo.len));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_binascii_a2b_base64_into_obj, mod_binascii_a2b_base64_into);
+
 STATIC mp_obj_t mod_binascii_b2a_base64(mp_obj_t data) {
     check_not_unicode(data);
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
 
     vstr_t vstr;
-    vstr_init_len(&vstr, ((bufinfo.len != 0) ? (((bufinfo.len - 1) / 3) + 1) * 4 : 0) + 1);
+    size_t encoded_len = base64_encoded_len(bufinfo.len);
+    vstr_init_len(&vstr, encoded_len + 1);
+    base64_encode(bufinfo.buf, bufinfo.len, (byte *)vstr.buf);
+    vstr.buf[encoded_len] = '\n';
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_b2a_base64_obj, mod_binascii_b2a_base64);
 
-    // First pass, we convert input buffer to numeric base 64 values
-    byte *in = bufinfo.buf, *out = (byte *)vstr.buf;
-    mp_uint_t i;
-    for (i = bufinfo.len; i >= 3; i -= 3) {
-        *out++ = (in[0] & 0xFC) >> 2;
-        *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-        *out++ = (in[1] & 0x0F) << 2 | (in[2] & 0xC0) >> 6;
-        *out++ = in[2] & 0x3F;
-        in += 3;
-    }
-    if (i != 0) {
-        *out++ = (in[0] & 0xFC) >> 2;
-        if (i == 2) {
-            *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-            *out++ = (in[1] & 0x0F) << 2;
-        } else {
-            *out++ = (in[0] & 0x03) << 4;
-            *out++ = 64;
-        }
-        *out = 64;
-    }
+STATIC mp_obj_t mod_binascii_b2a_base64_into(mp_obj_t data, mp_obj_t buf) {
+    check_not_unicode(data);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t outinfo;
+    mp_get_buffer_raise(buf, &outinfo, MP_BUFFER_WRITE);
 
-    // Second pass, we convert number base 64 values to actual base64 ascii encoding
-    out = (byte *)vstr.buf;
-    for (mp_uint_t j = vstr.len - 1; j--;) {
-        if (*out < 26) {
-            *out += 'A';
-        } else if (*out < 52) {
-            *out += 'a' - 26;
-        } else if (*out < 62) {
-            *out += '0' - 52;
-        } else if (*out == 62) {
-            *out = '+';
-        } else if (*out == 63) {
-            *out = '/';
-        } else {
-            *out = '=';
-        }
-        out++;
+    size_t encoded_len = base64_encoded_len(bufinfo.len);
+    if (encoded_len > outinfo.len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
     }
-    *out = '\n';
-    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+    base64_encode(bufinfo.buf, bufinfo.len, outinfo.buf);
+    return MP_OBJ_NEW_SMALL_INT(encoded_len);
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_b2a_base64_obj, mod_binascii_b2a_base64);
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_binascii_b2a_base64_into_obj, mod_binascii_b2a_base64_into);
 
 /*
  * CRC32 checksum
@@ -285,7 +317,9 @@ STATIC const mp_rom_map_elem_t mp_module_binascii_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_hexlify), MP_ROM_PTR(&mod_binascii_hexlify_obj) },
     { MP_ROM_QSTR(MP_QSTR_unhexlify), MP_ROM_PTR(&mod_binascii_unhexlify_obj) },
     { MP_ROM_QSTR(MP_QSTR_a2b_base64), MP_ROM_PTR(&mod_binascii_a2b_base64_obj) },
+    { MP_ROM_QSTR(MP_QSTR_a2b_base64_into), MP_ROM_PTR(&mod_binascii_a2b_base64_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_b2a_base64), MP_ROM_PTR(&mod_binascii_b2a_base64_obj) },
+    { MP_ROM_QSTR(MP_QSTR_b2a_base64_into), MP_ROM_PTR(&mod_binascii_b2a_base64_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_crc32), MP_ROM_PTR(&mod_binascii_crc32_obj) },
 };
 
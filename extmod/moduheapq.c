@@ -19,12 +19,26 @@ STATIC mp_obj_list_t *uheapq_get_heap(mp_obj_t heap_in) {
     return MP_OBJ_TO_PTR(heap_in);
 }
 
+// a < b, without going through mp_binary_op for the common small int and
+// float keys
+STATIC bool uheapq_lt(mp_obj_t a, mp_obj_t b) {
+    if (mp_obj_is_small_int(a) && mp_obj_is_small_int(b)) {
+        return MP_OBJ_SMALL_INT_VALUE(a) < MP_OBJ_SMALL_INT_VALUE(b);
+    }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (mp_obj_is_float(a) && mp_obj_is_float(b)) {
+        return mp_obj_float_get(a) < mp_obj_float_get(b);
+    }
+    #endif
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, a, b));
+}
+
 STATIC void uheapq_heap_siftdown(mp_obj_list_t *heap, mp_uint_t start_pos, mp_uint_t pos) {
     mp_obj_t item = heap->items[pos];
     while (pos > start_pos) {
         mp_uint_t parent_pos = (pos - 1) >> 1;
         mp_obj_t parent = heap->items[parent_pos];
-        if (mp_binary_op(MP_BINARY_OP_LESS, item, parent) == mp_const_true) {
+        if (uheapq_lt(item, parent)) {
             heap->items[pos] = parent;
             pos = parent_pos;
         } else {
@@ -40,7 +54,7 @@ STATIC void uheapq_heap_siftup(mp_obj_list_t *heap, mp_uint_t pos) {
     mp_obj_t item = heap->items[pos];
     for (mp_uint_t child_pos = 2 * pos + 1; child_pos < end_pos; child_pos = 2 * pos + 1) {
         // choose right child if it's <= left child
-        if (child_pos + 1 < end_pos && mp_binary_op(MP_BINARY_OP_LESS, heap->items[child_pos], heap->items[child_pos + 1]) == mp_const_false) {
+        if (child_pos + 1 < end_pos && !uheapq_lt(heap->items[child_pos], heap->items[child_pos + 1])) {
             child_pos += 1;
         }
         // bubble up the smaller child
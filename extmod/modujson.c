@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdio.h>
+#include <string.h>
 
 #include "py/binary.h"
 #include "py/objarray.h"
@@ -17,6 +18,36 @@
 
 #if MICROPY_PY_UJSON
 
+// dump() collects output in chunks of this size rather than writing each
+// token to the stream separately, which is slow for sockets and files.
+#define CIRCUITPY_JSON_WRITE_CHUNK_SIZE 128
+
+typedef struct _ujson_dump_buffer_t {
+    mp_obj_t stream_obj;
+    size_t len;
+    byte buf[CIRCUITPY_JSON_WRITE_CHUNK_SIZE];
+} ujson_dump_buffer_t;
+
+STATIC void ujson_dump_flush(ujson_dump_buffer_t *b) {
+    if (b->len) {
+        mp_stream_write(b->stream_obj, b->buf, b->len, MP_STREAM_RW_WRITE);
+        b->len = 0;
+    }
+}
+
+STATIC void ujson_dump_strn(void *data, const char *str, size_t len) {
+    ujson_dump_buffer_t *b = data;
+    if (b->len + len > sizeof(b->buf)) {
+        ujson_dump_flush(b);
+        if (len > sizeof(b->buf)) {
+            mp_stream_write(b->stream_obj, str, len, MP_STREAM_RW_WRITE);
+            return;
+        }
+    }
+    memcpy(b->buf + b->len, str, len);
+    b->len += len;
+}
+
 #if MICROPY_PY_UJSON_SEPARATORS
 
 enum {
@@ -53,10 +84,12 @@ STATIC mp_obj_t mod_ujson_dump_helper(size_t n_args, const mp_obj_t *pos_args, m
         return mp_obj_new_str_from_vstr(&mp_type_str, &vstr);
     } else {
         // dump(obj, stream)
-        print_ext.base.data = MP_OBJ_TO_PTR(pos_args[1]);
-        print_ext.base.print_strn = mp_stream_write_adaptor;
+        ujson_dump_buffer_t b = { .stream_obj = pos_args[1], .len = 0 };
+        print_ext.base.data = &b;
+        print_ext.base.print_strn = ujson_dump_strn;
         mp_get_stream_raise(pos_args[1], MP_STREAM_OP_WRITE);
         mp_obj_print_helper(&print_ext.base, pos_args[0], PRINT_JSON);
+        ujson_dump_flush(&b);
         return mp_const_none;
     }
 }
@@ -75,8 +108,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_ujson_dumps_obj, 1, mod_ujson_dumps);
 
 STATIC mp_obj_t mod_ujson_dump(mp_obj_t obj, mp_obj_t stream) {
     mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
-    mp_print_t print = {MP_OBJ_TO_PTR(stream), mp_stream_write_adaptor};
+    ujson_dump_buffer_t b = { .stream_obj = stream, .len = 0 };
+    mp_print_t print = {&b, ujson_dump_strn};
     mp_obj_print_helper(&print, obj, PRINT_JSON);
+    ujson_dump_flush(&b);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_ujson_dump_obj, mod_ujson_dump);
@@ -161,49 +196,70 @@ STATIC mp_uint_t ujson_python_readinto(mp_obj_t obj, void *buf, mp_uint_t size,
     return 1;
 }
 
-STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
+STATIC void ujson_stream_init(ujson_stream_t *s, mp_obj_t stream_obj, uint8_t *character_buffer) {
     const mp_stream_p_t *stream_p = mp_proto_get(MP_QSTR_protocol_stream, stream_obj);
-    ujson_stream_t s;
-    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
     if (stream_p == NULL) {
-        s.start = 0;
-        s.end = 0;
-        mp_load_method(stream_obj, MP_QSTR_readinto, s.python_readinto);
-        s.bytearray_obj.base.type = &mp_type_bytearray;
-        s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
-        s.bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
-        s.bytearray_obj.free = 0;
-        s.bytearray_obj.items = character_buffer;
-        s.python_readinto[2] = MP_OBJ_FROM_PTR(&s.bytearray_obj);
-        s.stream_obj = &s;
-        s.read = ujson_python_readinto;
+        s->start = 0;
+        s->end = 0;
+        mp_load_method(stream_obj, MP_QSTR_readinto, s->python_readinto);
+        s->bytearray_obj.base.type = &mp_type_bytearray;
+        s->bytearray_obj.typecode = BYTEARRAY_TYPECODE;
+        s->bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
+        s->bytearray_obj.free = 0;
+        s->bytearray_obj.items = character_buffer;
+        s->python_readinto[2] = MP_OBJ_FROM_PTR(&s->bytearray_obj);
+        s->stream_obj = s;
+        s->read = ujson_python_readinto;
     } else {
         stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-        s.stream_obj = stream_obj;
-        s.read = stream_p->read;
-        s.errcode = 0;
-        s.cur = 0;
+        s->stream_obj = stream_obj;
+        s->read = stream_p->read;
     }
+    s->errcode = 0;
+    s->cur = 0;
+}
 
-    JSON_DEBUG("got JSON stream\n");
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
-    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
-    stack.len = 0;
-    stack.items = NULL;
-    mp_obj_t stack_top = MP_OBJ_NULL;
-    const mp_obj_type_t *stack_top_type = NULL;
-    mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
+typedef enum {
+    JSON_TOKEN_EOF,
+    JSON_TOKEN_ERROR,
+    JSON_TOKEN_VALUE, // a primitive, stored in *value
+    JSON_TOKEN_START_LIST,
+    JSON_TOKEN_START_DICT,
+    JSON_TOKEN_END, // either of } or ]
+} ujson_token_t;
+
+// Objects usually repeat the same keys record after record. Keys that are
+// not already qstrs are looked up in a small direct-mapped cache of recently
+// decoded keys before allocating a new str. Keys are not interned as new
+// qstrs, since qstrs are never freed and the input may have any keys at all.
+#define JSON_KEY_CACHE_SIZE (16)
+#define JSON_KEY_CACHE_MAX_LEN (32)
+
+STATIC mp_obj_t ujson_new_key(mp_obj_t *key_cache, const char *str, size_t len) {
+    if (len > JSON_KEY_CACHE_MAX_LEN) {
+        return mp_obj_new_str(str, len);
+    }
+    mp_obj_t *entry = &key_cache[qstr_compute_hash((const byte *)str, len) & (JSON_KEY_CACHE_SIZE - 1)];
+    if (*entry != MP_OBJ_NULL) {
+        size_t cached_len;
+        const char *cached = mp_obj_str_get_data(*entry, &cached_len);
+        if (cached_len == len && memcmp(cached, str, len) == 0) {
+            return *entry;
+        }
+    }
+    *entry = mp_obj_new_str(str, len);
+    return *entry;
+}
+
+// Read the next token from the stream, using vstr as scratch space. If the
+// token is a string that is an object key, key_cache is non-NULL.
+STATIC ujson_token_t ujson_next_token(ujson_stream_t *s, vstr_t *vstr, mp_obj_t *value, mp_obj_t *key_cache) {
     for (;;) {
-    cont:
-        if (S_END(s)) {
-            break;
+        if (S_END(*s)) {
+            return JSON_TOKEN_EOF;
         }
-        mp_obj_t next = MP_OBJ_NULL;
-        bool enter = false;
-        byte cur = S_CUR(s);
-        S_NEXT(s);
+        byte cur = S_CUR(*s);
+        S_NEXT(*s);
         switch (cur) {
             case ',':
             case ':':
@@ -211,37 +267,37 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
             case '\t':
             case '\n':
             case '\r':
-                goto cont;
+                continue;
             case 'n':
-                if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
-                    S_NEXT(s);
-                    next = mp_const_none;
+                if (S_CUR(*s) == 'u' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 'l') {
+                    S_NEXT(*s);
+                    *value = mp_const_none;
                 } else {
-                    goto fail;
+                    return JSON_TOKEN_ERROR;
                 }
-                break;
+                return JSON_TOKEN_VALUE;
             case 'f':
-                if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
-                    next = mp_const_false;
+                if (S_CUR(*s) == 'a' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 's' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
+                    *value = mp_const_false;
                 } else {
-                    goto fail;
+                    return JSON_TOKEN_ERROR;
                 }
-                break;
+                return JSON_TOKEN_VALUE;
             case 't':
-                if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
-                    next = mp_const_true;
+                if (S_CUR(*s) == 'r' && S_NEXT(*s) == 'u' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
+                    *value = mp_const_true;
                 } else {
-                    goto fail;
+                    return JSON_TOKEN_ERROR;
                 }
-                break;
+                return JSON_TOKEN_VALUE;
             case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
+                vstr_reset(vstr);
+                for (; !S_END(*s) && S_CUR(*s) != '"';) {
+                    byte c = S_CUR(*s);
                     if (c == '\\') {
-                        c = S_NEXT(s);
+                        c = S_NEXT(*s);
                         switch (c) {
                             case 'b':
                                 c = 0x08;
@@ -261,27 +317,31 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
                             case 'u': {
                                 mp_uint_t num = 0;
                                 for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
+                                    c = (S_NEXT(*s) | 0x20) - '0';
                                     if (c > 9) {
                                         c -= ('a' - ('9' + 1));
                                     }
                                     num = (num << 4) | c;
                                 }
-                                vstr_add_char(&vstr, num);
+                                vstr_add_char(vstr, num);
                                 goto str_cont;
                             }
                         }
                     }
-                    vstr_add_byte(&vstr, c);
+                    vstr_add_byte(vstr, c);
                 str_cont:
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
-                if (S_END(s)) {
-                    goto fail;
+                if (S_END(*s)) {
+                    return JSON_TOKEN_ERROR;
                 }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
-                break;
+                S_NEXT(*s);
+                if (key_cache) {
+                    *value = ujson_new_key(key_cache, vstr->buf, vstr->len);
+                } else {
+                    *value = mp_obj_new_str(vstr->buf, vstr->len);
+                }
+                return JSON_TOKEN_VALUE;
             case '-':
             case '0':
             case '1':
@@ -294,10 +354,10 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
             case '8':
             case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
-                    cur = S_CUR(s);
+                    vstr_add_byte(vstr, cur);
+                    cur = S_CUR(*s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
                     } else if (cur == '+' || cur == '-' || unichar_isdigit(cur)) {
@@ -305,25 +365,62 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
                     } else {
                         break;
                     }
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
                 if (flt) {
-                    next = mp_parse_num_decimal(vstr.buf, vstr.len, false, false, NULL);
+                    *value = mp_parse_num_decimal(vstr->buf, vstr->len, false, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    *value = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
-                break;
+                return JSON_TOKEN_VALUE;
             }
             case '[':
+                return JSON_TOKEN_START_LIST;
+            case '{':
+                return JSON_TOKEN_START_DICT;
+            case '}':
+            case ']':
+                return JSON_TOKEN_END;
+            default:
+                return JSON_TOKEN_ERROR;
+        }
+    }
+}
+
+STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
+    ujson_stream_t s;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+    ujson_stream_init(&s, stream_obj, character_buffer);
+
+    JSON_DEBUG("got JSON stream\n");
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
+    stack.len = 0;
+    stack.items = NULL;
+    mp_obj_t stack_top = MP_OBJ_NULL;
+    const mp_obj_type_t *stack_top_type = NULL;
+    mp_obj_t stack_key = MP_OBJ_NULL;
+    mp_obj_t key_cache[JSON_KEY_CACHE_SIZE] = { MP_OBJ_NULL };
+    S_NEXT(s);
+    for (;;) {
+        mp_obj_t next = MP_OBJ_NULL;
+        bool enter = false;
+        bool is_key = stack_top_type == &mp_type_dict && stack_key == MP_OBJ_NULL;
+        switch (ujson_next_token(&s, &vstr, &next, is_key ? key_cache : NULL)) {
+            case JSON_TOKEN_EOF:
+                goto success;
+            case JSON_TOKEN_VALUE:
+                break;
+            case JSON_TOKEN_START_LIST:
                 next = mp_obj_new_list(0, NULL);
                 enter = true;
                 break;
-            case '{':
+            case JSON_TOKEN_START_DICT:
                 next = mp_obj_new_dict(0);
                 enter = true;
                 break;
-            case '}':
-            case ']': {
+            case JSON_TOKEN_END: {
                 if (stack_top == MP_OBJ_NULL) {
                     // no object at all
                     goto fail;
@@ -335,7 +432,7 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
                 stack.len -= 1;
                 stack_top = stack.items[stack.len];
                 stack_top_type = mp_obj_get_type(stack_top);
-                goto cont;
+                continue;
             }
             default:
                 goto fail;
@@ -413,6 +510,107 @@ STATIC mp_obj_t mod_ujson_loads(mp_obj_t obj) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_loads_obj, mod_ujson_loads);
 
+// iterparse() walks a document one token at a time, keeping only a byte per
+// open container, so memory use depends on the nesting depth and the longest
+// string rather than on the size of the document.
+
+typedef struct _ujson_iterparse_obj_t {
+    mp_obj_base_t base;
+    ujson_stream_t s;
+    vstr_t vstr;
+    vstr_t stack; // '[' or '{' for each open container
+    bool key_next; // in an object, whether the next primitive is a key
+    bool done;
+    mp_obj_t key_cache[JSON_KEY_CACHE_SIZE];
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+} ujson_iterparse_obj_t;
+
+STATIC mp_obj_t ujson_iterparse_iternext(mp_obj_t self_in) {
+    ujson_iterparse_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->done) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    bool in_dict = self->stack.len && self->stack.buf[self->stack.len - 1] == '{';
+    mp_obj_t value = mp_const_none;
+    qstr event;
+    switch (ujson_next_token(&self->s, &self->vstr, &value, in_dict && self->key_next ? self->key_cache : NULL)) {
+        case JSON_TOKEN_VALUE:
+            if (in_dict && self->key_next) {
+                if (!mp_obj_is_str(value)) {
+                    goto fail;
+                }
+                event = MP_QSTR_map_key;
+                self->key_next = false;
+            } else {
+                event = MP_QSTR_value;
+                self->key_next = true;
+            }
+            break;
+        case JSON_TOKEN_START_LIST:
+            if (in_dict && self->key_next) {
+                goto fail;
+            }
+            vstr_add_byte(&self->stack, '[');
+            event = MP_QSTR_start_array;
+            break;
+        case JSON_TOKEN_START_DICT:
+            if (in_dict && self->key_next) {
+                goto fail;
+            }
+            vstr_add_byte(&self->stack, '{');
+            event = MP_QSTR_start_map;
+            self->key_next = true;
+            break;
+        case JSON_TOKEN_END: {
+            if (!self->stack.len || (in_dict && !self->key_next)) {
+                goto fail;
+            }
+            self->stack.len--;
+            event = in_dict ? MP_QSTR_end_map : MP_QSTR_end_array;
+            self->key_next = true;
+            break;
+        }
+        default:
+            // includes the end of the stream before the document is complete
+            goto fail;
+    }
+    if (self->stack.len == 0) {
+        // finished the top-level value; any data after it is left unread
+        self->done = true;
+        vstr_clear(&self->vstr);
+        vstr_clear(&self->stack);
+    }
+    mp_obj_t items[2] = { MP_OBJ_NEW_QSTR(event), value };
+    return mp_obj_new_tuple(2, items);
+
+fail:
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+
+STATIC const mp_obj_type_t ujson_iterparse_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_iterator,
+    MP_TYPE_EXTENDED_FIELDS(
+        .getiter = mp_identity_getiter,
+        .iternext = ujson_iterparse_iternext,
+        ),
+};
+
+STATIC mp_obj_t mod_ujson_iterparse(mp_obj_t stream_obj) {
+    ujson_iterparse_obj_t *self = m_new_obj(ujson_iterparse_obj_t);
+    self->base.type = &ujson_iterparse_type;
+    ujson_stream_init(&self->s, stream_obj, self->character_buffer);
+    vstr_init(&self->vstr, 8);
+    vstr_init(&self->stack, 8);
+    memset(self->key_cache, 0, sizeof(self->key_cache));
+    self->key_next = false;
+    self->done = false;
+    S_NEXT(self->s);
+    return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_iterparse_obj, mod_ujson_iterparse);
+
 STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
     #if CIRCUITPY
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
@@ -421,6 +619,7 @@ STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
     #endif
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_ujson_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_ujson_dumps_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iterparse), MP_ROM_PTR(&mod_ujson_iterparse_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_ujson_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_ujson_loads_obj) },
 };
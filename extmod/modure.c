@@ -22,8 +22,15 @@
 #define FLAG_DEBUG 0x1000
 #endif
 
+#if MICROPY_ENABLE_DYNRUNTIME
+#define URE_CACHE_SIZE (0)
+#else
+#define URE_CACHE_SIZE (MICROPY_PY_URE_CACHE_SIZE)
+#endif
+
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
+    mp_obj_t pattern;
     ByteProg re;
 } mp_obj_re_t;
 
@@ -158,14 +165,53 @@ STATIC void re_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t
     mp_printf(print, "<re %p>", self);
 }
 
-STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
-    (void)n_args;
-    mp_obj_re_t *self;
+#if URE_CACHE_SIZE
+// Check whether re_in was compiled from pattern. Unlike mp_obj_equal() this
+// doesn't warn when comparing str with bytes.
+STATIC bool ure_pattern_equal(mp_obj_t re_in, mp_obj_t pattern) {
+    mp_obj_t cached = ((mp_obj_re_t *)MP_OBJ_TO_PTR(re_in))->pattern;
+    if (cached == pattern) {
+        return true;
+    }
+    if (mp_obj_get_type(cached) != mp_obj_get_type(pattern)) {
+        return false;
+    }
+    size_t cached_len, len;
+    const char *cached_str = mp_obj_str_get_data(cached, &cached_len);
+    const char *str = mp_obj_str_get_data(pattern, &len);
+    return cached_len == len && memcmp(cached_str, str, len) == 0;
+}
+#endif
+
+// Return the compiled pattern for args[0], which is either a compiled regex
+// or a pattern string given to a module-level function.
+STATIC mp_obj_re_t *ure_get_compiled(const mp_obj_t *args) {
     if (mp_obj_is_type(args[0], &re_type)) {
-        self = MP_OBJ_TO_PTR(args[0]);
-    } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
+        return MP_OBJ_TO_PTR(args[0]);
+    }
+    #if URE_CACHE_SIZE
+    mp_obj_t *cache = MP_STATE_VM(re_cache);
+    size_t i = 0;
+    while (i < URE_CACHE_SIZE - 1 && cache[i] != MP_OBJ_NULL && !ure_pattern_equal(cache[i], args[0])) {
+        i++;
     }
+    mp_obj_t re = cache[i];
+    if (re == MP_OBJ_NULL || !ure_pattern_equal(re, args[0])) {
+        re = mod_re_compile(1, args);
+    }
+    // Move the entry to the front, dropping the least recently used one if
+    // the cache is full.
+    memmove(&cache[1], &cache[0], i * sizeof(mp_obj_t));
+    cache[0] = re;
+    return MP_OBJ_TO_PTR(re);
+    #else
+    return MP_OBJ_TO_PTR(mod_re_compile(1, args));
+    #endif
+}
+
+STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
+    (void)n_args;
+    mp_obj_re_t *self = ure_get_compiled(args);
     Subject subj;
     size_t len;
     subj.begin = mp_obj_str_get_data(args[1], &len);
@@ -184,7 +230,7 @@ STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
         if (pos < 0) {
             pos = 0;
         }
-        const byte *pos_ptr = str_index_to_ptr(self_type, begin, len, MP_OBJ_NEW_SMALL_INT(pos), true);
+        const byte *pos_ptr = str_index_to_ptr(self_type, args[1], begin, len, MP_OBJ_NEW_SMALL_INT(pos), true);
 
         const byte *endpos_ptr = (const byte *)subj.end;
         if (n_args > 3) {
@@ -193,7 +239,7 @@ STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
                 return mp_const_none;
             }
             // Will cap to length
-            endpos_ptr = str_index_to_ptr(self_type, begin, len, args[3], true);
+            endpos_ptr = str_index_to_ptr(self_type, args[1], begin, len, args[3], true);
         }
 
         subj.begin = (const char *)pos_ptr;
@@ -274,12 +320,7 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(re_split_obj, 2, 3, re_split);
 #if MICROPY_PY_URE_SUB
 
 STATIC mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
-    mp_obj_re_t *self;
-    if (mp_obj_is_type(args[0], &re_type)) {
-        self = MP_OBJ_TO_PTR(args[0]);
-    } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
-    }
+    mp_obj_re_t *self = ure_get_compiled(args);
     mp_obj_t replace = args[1];
     mp_obj_t where = args[2];
     mp_int_t count = 0;
@@ -423,6 +464,7 @@ STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
     }
     mp_obj_re_t *o = m_new_obj_var(mp_obj_re_t, char, size);
     o->base.type = &re_type;
+    o->pattern = args[0];
     #if MICROPY_PY_URE_DEBUG
     int flags = 0;
     if (n_args > 1) {
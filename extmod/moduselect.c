@@ -18,6 +18,14 @@
 #include "py/mphal.h"
 #include "shared/runtime/interrupt_char.h"
 
+#if defined(CIRCUITPY_SELECT_IDLE_MAX_MS) && CIRCUITPY_SELECT_IDLE_MAX_MS > 0
+#include "supervisor/port.h"
+#include "supervisor/shared/tick.h"
+#define SELECT_IDLE (1)
+#else
+#define SELECT_IDLE (0)
+#endif
+
 // Flags for poll()
 #define FLAG_ONESHOT (1)
 
@@ -51,6 +59,20 @@ STATIC void poll_map_add(mp_map_t *poll_map, const mp_obj_t *obj, mp_uint_t obj_
     }
 }
 
+#if SELECT_IDLE
+// Arrange to wake after at most CIRCUITPY_SELECT_IDLE_MAX_MS, or when the timeout is up. This is
+// done before the objects are polled so that a wake up, such as a socket becoming readable, in
+// between is not lost by the supervisor_idle_until_interrupt() that follows.
+STATIC void poll_set_wakeup(mp_uint_t start_tick, mp_uint_t timeout) {
+    mp_uint_t idle_ms = CIRCUITPY_SELECT_IDLE_MAX_MS;
+    if (timeout != (mp_uint_t)-1) {
+        mp_uint_t elapsed = mp_hal_ticks_ms() - start_tick;
+        idle_ms = MIN(idle_ms, elapsed < timeout ? timeout - elapsed : 0);
+    }
+    port_interrupt_after_ticks(MAX((idle_ms * 1024) / 1000, 1));
+}
+#endif
+
 // poll each object in the map
 STATIC mp_uint_t poll_map_poll(mp_map_t *poll_map, size_t *rwx_num) {
     mp_uint_t n_ready = 0;
@@ -123,6 +145,9 @@ STATIC mp_obj_t select_select(size_t n_args, const mp_obj_t *args) {
     mp_uint_t start_tick = mp_hal_ticks_ms();
     rwx_len[0] = rwx_len[1] = rwx_len[2] = 0;
     for (;;) {
+        #if SELECT_IDLE
+        poll_set_wakeup(start_tick, timeout);
+        #endif
         // poll the objects
         mp_uint_t n_ready = poll_map_poll(&poll_map, rwx_len);
 
@@ -152,6 +177,9 @@ STATIC mp_obj_t select_select(size_t n_args, const mp_obj_t *args) {
             return mp_obj_new_tuple(3, list_array);
         }
         RUN_BACKGROUND_TASKS;
+        #if SELECT_IDLE
+        supervisor_idle_until_interrupt();
+        #endif
     }
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_select_select_obj, 3, 4, select_select);
@@ -225,6 +253,9 @@ STATIC mp_uint_t poll_poll_internal(uint n_args, const mp_obj_t *args) {
     mp_uint_t start_tick = mp_hal_ticks_ms();
     mp_uint_t n_ready;
     for (;;) {
+        #if SELECT_IDLE
+        poll_set_wakeup(start_tick, timeout);
+        #endif
         // poll the objects
         n_ready = poll_map_poll(&self->poll_map, NULL);
         if (n_ready > 0 || (timeout != (mp_uint_t)-1 && mp_hal_ticks_ms() - start_tick >= timeout)) {
@@ -234,6 +265,10 @@ STATIC mp_uint_t poll_poll_internal(uint n_args, const mp_obj_t *args) {
         if (mp_hal_is_interrupted()) {
             return 0;
         }
+        #if SELECT_IDLE
+        // Sleep until something, such as a stream becoming ready, wakes the main task.
+        supervisor_idle_until_interrupt();
+        #endif
     }
 
     return n_ready;
@@ -49,6 +49,12 @@ class SingletonGenerator:
             raise self.exc
 
 
+try:
+    from _uasyncio import SingletonGenerator
+except:
+    pass
+
+
 # Pause task execution for the given time (integer in milliseconds, uPy extension)
 # Use a SingletonGenerator to do it without allocating on the heap
 def sleep_ms(t, sgen=SingletonGenerator()):
@@ -217,6 +223,14 @@ def run_until_complete(main_task=None):
                 Loop.call_exception_handler(_exc_context)
 
 
+# Prefer the built-in C loop, which is faster for apps with many tasks. Only this
+# copy of uasyncio (the unix dev variant) uses it; boards run the Adafruit asyncio library.
+try:
+    from _uasyncio import run_until_complete
+except:
+    pass
+
+
 # Create a new task from a coroutine and run it until it finishes
 def run(coro):
     return run_until_complete(create_task(coro))
@@ -23,9 +23,61 @@ extern const mp_obj_type_t mp_type_vfs_fat_textio;
 
 MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
 
+// A file opened read-only that spans at least this many clusters gets a
+// cluster link map the first time a seek leaves its first cluster, so that
+// later seeks don't walk the FAT chain.
+#ifndef MICROPY_FATFS_LINKMAP_MIN_CLUSTERS
+#define MICROPY_FATFS_LINKMAP_MIN_CLUSTERS (4)
+#endif
+
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
+    // True until the link map has been built or given up on.
+    bool linkmap_pending;
 } pyb_file_obj_t;
 
+// Build the link map now. Returns false if the file has none, such as when
+// it isn't read-only or the heap is full.
+bool fat_file_build_linkmap(pyb_file_obj_t *self);
+// f_lseek() that builds a pending link map first. Native code seeking in a
+// file should use this.
+FRESULT fat_file_lseek(pyb_file_obj_t *self, FSIZE_t ofs);
+
+// Count and time block device operations, for storage.stats().
+#ifndef MICROPY_FATFS_IO_STATS
+#define MICROPY_FATFS_IO_STATS (0)
+#endif
+
+#if MICROPY_FATFS_IO_STATS
+typedef enum {
+    // disk_read/disk_write/CTRL_SYNC on any FAT volume, from Python or USB.
+    MP_IO_STATS_FS_READ,
+    MP_IO_STATS_FS_WRITE,
+    MP_IO_STATS_FS_SYNC,
+    // The CIRCUITPY flash underneath, including writing back its cache.
+    MP_IO_STATS_FLASH_READ,
+    MP_IO_STATS_FLASH_WRITE,
+    MP_IO_STATS_FLASH_FLUSH,
+    MP_IO_STATS_NUM_OPS,
+} mp_io_stats_op_t;
+
+// Bucket 0 counts operations under 1us, bucket i those taking 2**(i-1) to
+// 2**i - 1 us, and the last everything slower.
+#define MP_IO_STATS_BUCKETS (20)
+
+typedef struct {
+    uint32_t count;
+    uint32_t blocks;
+    uint64_t total_us;
+    uint32_t max_us;
+    uint32_t histogram[MP_IO_STATS_BUCKETS];
+} mp_io_stats_t;
+
+extern mp_io_stats_t mp_io_stats[MP_IO_STATS_NUM_OPS];
+
+// start_us is mp_hal_ticks_us() from when the operation began.
+void mp_io_stats_record(mp_io_stats_op_t op, uint32_t blocks, mp_uint_t start_us);
+#endif
+
 #endif  // MICROPY_INCLUDED_EXTMOD_VFS_FAT_H
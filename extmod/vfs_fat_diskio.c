@@ -19,6 +19,21 @@
 #include "lib/oofatfs/diskio.h"
 #include "extmod/vfs_fat.h"
 
+#if MICROPY_FATFS_IO_STATS
+mp_io_stats_t mp_io_stats[MP_IO_STATS_NUM_OPS];
+
+void mp_io_stats_record(mp_io_stats_op_t op, uint32_t blocks, mp_uint_t start_us) {
+    uint32_t elapsed = mp_hal_ticks_us() - start_us;
+    mp_io_stats_t *stats = &mp_io_stats[op];
+    stats->count++;
+    stats->blocks += blocks;
+    stats->total_us += elapsed;
+    stats->max_us = MAX(stats->max_us, elapsed);
+    uint32_t bucket = elapsed ? 32 - __builtin_clz(elapsed) : 0;
+    stats->histogram[MIN(bucket, MP_IO_STATS_BUCKETS - 1)]++;
+}
+#endif
+
 typedef void *bdev_t;
 STATIC fs_user_mount_t *disk_get_device(void *bdev) {
     return (fs_user_mount_t *)bdev;
@@ -39,8 +54,16 @@ DRESULT disk_read(
         return RES_PARERR;
     }
 
+    #if MICROPY_FATFS_IO_STATS
+    mp_uint_t start_us = mp_hal_ticks_us();
+    #endif
+
     int ret = mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff);
 
+    #if MICROPY_FATFS_IO_STATS
+    mp_io_stats_record(MP_IO_STATS_FS_READ, count, start_us);
+    #endif
+
     return ret == 0 ? RES_OK : RES_ERROR;
 }
 
@@ -59,8 +82,16 @@ DRESULT disk_write(
         return RES_PARERR;
     }
 
+    #if MICROPY_FATFS_IO_STATS
+    mp_uint_t start_us = mp_hal_ticks_us();
+    #endif
+
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
+    #if MICROPY_FATFS_IO_STATS
+    mp_io_stats_record(MP_IO_STATS_FS_WRITE, count, start_us);
+    #endif
+
     if (ret == -MP_EROFS) {
         // read-only block device
         return RES_WRPRT;
@@ -94,7 +125,15 @@ DRESULT disk_ioctl(
     uint8_t bp_op = op_map[cmd & 7];
     mp_obj_t ret = mp_const_none;
     if (bp_op != 0) {
+        #if MICROPY_FATFS_IO_STATS
+        mp_uint_t start_us = mp_hal_ticks_us();
+        #endif
         ret = mp_vfs_blockdev_ioctl(&vfs->blockdev, bp_op, 0);
+        #if MICROPY_FATFS_IO_STATS
+        if (cmd == CTRL_SYNC) {
+            mp_io_stats_record(MP_IO_STATS_FS_SYNC, 0, start_us);
+        }
+        #endif
     }
 
     // Second part: convert the result for return
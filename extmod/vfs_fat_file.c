@@ -15,6 +15,9 @@
 #include "lib/oofatfs/ff.h"
 #include "extmod/vfs_fat.h"
 #include "supervisor/filesystem.h"
+#if CIRCUITPY_OS_GETENV
+#include "shared-module/os/__init__.h"
+#endif
 
 // this table converts from FRESULT to POSIX errno
 const byte fresult_to_errno_table[20] = {
@@ -79,6 +82,69 @@ STATIC mp_obj_t file_obj___exit__(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(file_obj___exit___obj, 4, 4, file_obj___exit__);
 
+STATIC FSIZE_t file_cluster_bytes(pyb_file_obj_t *self) {
+    FATFS *fs = self->fp.obj.fs;
+    #if FF_MAX_SS == FF_MIN_SS
+    return (FSIZE_t)fs->csize * FF_MAX_SS;
+    #else
+    return (FSIZE_t)fs->csize * fs->ssize;
+    #endif
+}
+
+// Room on the stack for the link map of a file in up to four fragments. Each
+// fragment takes two entries, plus one for the table size and one for the
+// terminator.
+#define LINKMAP_PROBE_LEN (2 + 2 * 4)
+
+bool fat_file_build_linkmap(pyb_file_obj_t *self) {
+    self->linkmap_pending = false;
+    if (self->fp.cltbl != NULL) {
+        return true;
+    }
+    if (self->fp.obj.fs == NULL || (self->fp.flag & FA_WRITE) != 0) {
+        return false;
+    }
+    // Measure the chain into a small stack table. That is the whole map for
+    // most files, so the chain is usually walked only once.
+    DWORD probe[LINKMAP_PROBE_LEN];
+    probe[0] = LINKMAP_PROBE_LEN;
+    self->fp.cltbl = probe;
+    FRESULT res = f_lseek(&self->fp, CREATE_LINKMAP);
+    self->fp.cltbl = NULL;
+    if (res != FR_OK && res != FR_NOT_ENOUGH_CORE) {
+        return false;
+    }
+    DWORD len = probe[0];
+    DWORD *table = m_malloc_maybe(len * sizeof(DWORD), false);
+    if (table == NULL) {
+        return false;
+    }
+    if (res == FR_OK) {
+        memcpy(table, probe, len * sizeof(DWORD));
+    } else {
+        table[0] = len;
+        self->fp.cltbl = table;
+        res = f_lseek(&self->fp, CREATE_LINKMAP);
+        self->fp.cltbl = NULL;
+        if (res != FR_OK) {
+            m_del(DWORD, table, len);
+            return false;
+        }
+    }
+    // FatFs leaves the number of entries used in the first one; put the
+    // table size back.
+    table[0] = len;
+    self->fp.cltbl = table;
+    return true;
+}
+
+FRESULT fat_file_lseek(pyb_file_obj_t *self, FSIZE_t ofs) {
+    if (self->linkmap_pending && ofs >= file_cluster_bytes(self)) {
+        fat_file_build_linkmap(self);
+    }
+    return f_lseek(&self->fp, ofs);
+}
+
 STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(o_in);
 
@@ -87,15 +153,15 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
 
         switch (s->whence) {
             case 0: // SEEK_SET
-                f_lseek(&self->fp, s->offset);
+                fat_file_lseek(self, s->offset);
                 break;
 
             case 1: // SEEK_CUR
-                f_lseek(&self->fp, f_tell(&self->fp) + s->offset);
+                fat_file_lseek(self, f_tell(&self->fp) + s->offset);
                 break;
 
             case 2: // SEEK_END
-                f_lseek(&self->fp, f_size(&self->fp) + s->offset);
+                fat_file_lseek(self, f_size(&self->fp) + s->offset);
                 break;
         }
 
@@ -113,6 +179,11 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     } else if (request == MP_STREAM_CLOSE) {
         // if fs==NULL then the file is closed and in that case this method is a no-op
         if (self->fp.obj.fs != NULL) {
+            #if CIRCUITPY_OS_GETENV
+            if ((self->fp.flag & FA_WRITE) != 0) {
+                os_getenv_cache_invalidate();
+            }
+            #endif
             FRESULT res = f_close(&self->fp);
             if (res != FR_OK) {
                 *errcode = fresult_to_errno_table[res];
@@ -200,25 +271,14 @@ STATIC mp_obj_t file_open(fs_user_mount_t *vfs, const mp_obj_type_t *type, mp_ar
         m_del_obj(pyb_file_obj_t, o);
         mp_raise_OSError_errno_str(fresult_to_errno_table[res], args[0].u_obj);
     }
-    // If we're reading, turn on fast seek.
-    if (mode == FA_READ) {
-        // One call to determine how much space we need.
-        DWORD temp_table[2];
-        temp_table[0] = 2;
-        o->fp.cltbl = temp_table;
-        f_lseek(&o->fp, CREATE_LINKMAP);
-        DWORD size = (temp_table[0] + 1) * 2;
-
-        // Now allocate the size and construct the map.
-        o->fp.cltbl = m_malloc_maybe(size * sizeof(DWORD), false);
-        if (o->fp.cltbl != NULL) {
-            o->fp.cltbl[0] = size;
-            res = f_lseek(&o->fp, CREATE_LINKMAP);
-            if (res != FR_OK) {
-                o->fp.cltbl = NULL;
-            }
-        }
+    #if CIRCUITPY_OS_GETENV
+    if ((mode & FA_WRITE) != 0) {
+        os_getenv_cache_invalidate();
     }
+    #endif
+    // Large read-only files get a link map once they seek; see fat_file_lseek().
+    o->linkmap_pending = mode == FA_READ &&
+        f_size(&o->fp) >= (FSIZE_t)MICROPY_FATFS_LINKMAP_MIN_CLUSTERS * file_cluster_bytes(o);
 
     // for 'a' mode, we must begin at the end of the file
     if ((mode & FA_OPEN_ALWAYS) != 0) {
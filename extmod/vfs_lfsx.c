@@ -61,7 +61,7 @@ STATIC int MP_VFS_LFSx(dev_sync)(const struct LFSx_API (config) * c) {
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_SYNC, 0, false);
 }
 
-STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead) {
+STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead, size_t cache_size) {
     self->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
     mp_vfs_blockdev_init(&self->blockdev, bdev);
 
@@ -86,13 +86,22 @@ STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size
     config->block_count = bc;
 
     #if LFS_BUILD_VERSION == 1
+    (void)cache_size;
     config->lookahead = lookahead;
     config->read_buffer = m_new(uint8_t, config->read_size);
     config->prog_buffer = m_new(uint8_t, config->prog_size);
     config->lookahead_buffer = m_new(uint8_t, config->lookahead / 8);
     #else
     config->block_cycles = 100;
-    config->cache_size = 4 * MAX(read_size, prog_size);
+    if (cache_size == 0) {
+        cache_size = 4 * MAX(read_size, prog_size);
+    } else if (read_size == 0 || prog_size == 0 || cache_size % read_size != 0 ||
+               cache_size % prog_size != 0 || bs % cache_size != 0) {
+        // LittleFS requires the cache to be a multiple of both and to divide
+        // the block size, but doesn't check it in this build.
+        mp_arg_error_invalid(MP_QSTR_cachesize);
+    }
+    config->cache_size = cache_size;
     config->lookahead_size = lookahead;
     config->read_buffer = m_new(uint8_t, config->cache_size);
     config->prog_buffer = m_new(uint8_t, config->cache_size);
@@ -125,7 +134,8 @@ STATIC mp_obj_t MP_VFS_LFSx(make_new)(const mp_obj_type_t * type, size_t n_args,
     self->enable_mtime = args[LFS_MAKE_ARG_mtime].u_bool;
     #endif
     MP_VFS_LFSx(init_config)(self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_cachesize].u_int);
     int ret = LFSx_API(mount)(&self->lfs, &self->config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -139,7 +149,8 @@ STATIC mp_obj_t MP_VFS_LFSx(mkfs)(size_t n_args, const mp_obj_t *pos_args, mp_ma
 
     MP_OBJ_VFS_LFSx self;
     MP_VFS_LFSx(init_config)(&self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_cachesize].u_int);
     int ret = LFSx_API(format)(&self.lfs, &self.config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -49,6 +49,10 @@ STATIC void mp_reader_vfs_close(void *data) {
 }
 
 void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
+    mp_reader_new_file_at(reader, filename, 0);
+}
+
+void mp_reader_new_file_at(mp_reader_t *reader, const char *filename, size_t offset) {
     mp_reader_vfs_t *rf = m_new_obj(mp_reader_vfs_t);
     mp_obj_t args[2] = {
         mp_obj_new_str(filename, strlen(filename)),
@@ -56,6 +60,16 @@ void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
     };
     rf->file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
     int errcode;
+    if (offset != 0) {
+        struct mp_stream_seek_t seek_s;
+        seek_s.offset = offset;
+        seek_s.whence = MP_SEEK_SET;
+        const mp_stream_p_t *stream_p = mp_get_stream(rf->file);
+        if (stream_p->ioctl(rf->file, MP_STREAM_SEEK, (uintptr_t)&seek_s, &errcode) == MP_STREAM_ERROR) {
+            mp_stream_close(rf->file);
+            mp_raise_OSError(errcode);
+        }
+    }
     rf->len = mp_stream_rw(rf->file, rf->buf, sizeof(rf->buf), &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
     if (errcode != 0) {
         mp_raise_OSError(errcode);
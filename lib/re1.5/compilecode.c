@@ -230,7 +230,8 @@ int re1_5_compilecode(ByteProg *prog, const char *re)
 
     // Add code to implement non-anchored operation ("search"),
     // for anchored operation ("match"), this code will be just skipped.
-    // TODO: Implement search in much more efficient manner
+    // re1_5_recursiveloopprog() doesn't run this code, it tries each start
+    // position itself.
     prog->insts[prog->bytelen++] = RSplit;
     prog->insts[prog->bytelen++] = 3;
     prog->insts[prog->bytelen++] = Any;
@@ -83,5 +83,29 @@ recursiveloop(char *pc, const char *sp, Subject *input, const char **subp, int n
 int
 re1_5_recursiveloopprog(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored)
 {
-	return recursiveloop(HANDLE_ANCHORED(prog->insts, is_anchored), input->begin, input, subp, nsubp);
+	char *body = prog->insts + NON_ANCHORED_PREFIX;
+	const char *sp = input->begin;
+
+	if (is_anchored)
+		return recursiveloop(body, sp, input, subp, nsubp);
+
+	// Instead of running the ".*?" search prefix, try the pattern at each
+	// start position here, so that positions which can't match are skipped.
+	char *pc = body;
+	while (*pc == Save)
+		pc += 2;
+	if (*pc == Bol)
+		return recursiveloop(body, sp, input, subp, nsubp);
+	for (;;) {
+		if (*pc == Char) {
+			sp = memchr(sp, (unsigned char)pc[1], input->end - sp);
+			if (sp == NULL)
+				return 0;
+		}
+		if (recursiveloop(body, sp, input, subp, nsubp))
+			return 1;
+		if (sp >= input->end)
+			return 0;
+		sp++;
+	}
 }
@@ -97,6 +97,10 @@
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_PROFILE
+#include "supervisor/profile.h"
+#endif
+
 #if CIRCUITPY_MEMORYMONITOR
 #include "shared-module/memorymonitor/__init__.h"
 #endif
@@ -122,8 +126,46 @@
 uint8_t value_out = 0;
 #endif
 
-#if MICROPY_ENABLE_PYSTACK && CIRCUITPY_OS_GETENV
+#if CIRCUITPY_OS_GETENV
 #include "shared-module/os/__init__.h"
+
+// How long each startup phase took, in milliseconds. Printed before the first
+// code.py run when CIRCUITPY_BOOT_TIMING = 1 is in settings.toml.
+typedef enum {
+    BOOT_PHASE_SAFE_MODE_WAIT,
+    BOOT_PHASE_FILESYSTEM,
+    BOOT_PHASE_BOOT_PY,
+    BOOT_PHASE_WORKFLOW,
+    BOOT_PHASE_COUNT,
+} boot_phase_t;
+
+static uint64_t boot_phase_start_ms;
+static uint32_t boot_phase_ms[BOOT_PHASE_COUNT];
+static bool boot_timing_printed;
+
+static void end_boot_phase(boot_phase_t phase) {
+    uint64_t now = supervisor_ticks_ms64();
+    boot_phase_ms[phase] = now - boot_phase_start_ms;
+    boot_phase_start_ms = now;
+}
+
+static void print_boot_timing(void) {
+    if (boot_timing_printed) {
+        return;
+    }
+    boot_timing_printed = true;
+    mp_int_t boot_timing = 0;
+    (void)common_hal_os_getenv_int("CIRCUITPY_BOOT_TIMING", &boot_timing);
+    if (!boot_timing) {
+        return;
+    }
+    mp_printf(&mp_plat_print, "Boot time (ms): safe mode wait %u, filesystem %u, boot.py %u, workflows %u\n",
+        (unsigned int)boot_phase_ms[BOOT_PHASE_SAFE_MODE_WAIT], (unsigned int)boot_phase_ms[BOOT_PHASE_FILESYSTEM],
+        (unsigned int)boot_phase_ms[BOOT_PHASE_BOOT_PY], (unsigned int)boot_phase_ms[BOOT_PHASE_WORKFLOW]);
+}
+#define END_BOOT_PHASE(phase) end_boot_phase(phase)
+#else
+#define END_BOOT_PHASE(phase)
 #endif
 
 static void reset_devices(void) {
@@ -133,19 +175,32 @@ static void reset_devices(void) {
 }
 
 #if MICROPY_ENABLE_PYSTACK
+// Set instead of a supervisor allocation when the port has faster RAM for the Python stack.
+STATIC uint32_t *fast_pystack;
+STATIC size_t fast_pystack_length;
+
+STATIC supervisor_allocation *allocate_pystack_of_length(size_t length) {
+    fast_pystack = length > 0 ? port_fast_pystack(length) : NULL;
+    if (fast_pystack != NULL) {
+        fast_pystack_length = length;
+        return NULL;
+    }
+    return allocate_memory(length, false, false);
+}
+
 STATIC supervisor_allocation *allocate_pystack(safe_mode_t safe_mode) {
     #if CIRCUITPY_OS_GETENV && CIRCUITPY_SETTABLE_PYSTACK
     if (safe_mode == SAFE_MODE_NONE) {
         mp_int_t pystack_size = CIRCUITPY_PYSTACK_SIZE;
         (void)common_hal_os_getenv_int("CIRCUITPY_PYSTACK_SIZE", &pystack_size);
-        supervisor_allocation *pystack = allocate_memory(pystack_size >= 384 ? pystack_size : 0, false, false);
-        if (pystack) {
+        supervisor_allocation *pystack = allocate_pystack_of_length(pystack_size >= 384 ? pystack_size : 0);
+        if (pystack || fast_pystack) {
             return pystack;
         }
         serial_write_compressed(translate("Invalid CIRCUITPY_PYSTACK_SIZE\n"));
     }
     #endif
-    return allocate_memory(CIRCUITPY_PYSTACK_SIZE, false, false);
+    return allocate_pystack_of_length(CIRCUITPY_PYSTACK_SIZE);
 }
 #endif
 
@@ -181,7 +236,11 @@ STATIC void start_mp(supervisor_allocation *heap, supervisor_allocation *pystack
     readline_init0();
 
     #if MICROPY_ENABLE_PYSTACK
-    mp_pystack_init(pystack->ptr, pystack->ptr + get_allocation_length(pystack) / sizeof(size_t));
+    if (pystack == NULL) {
+        mp_pystack_init(fast_pystack, (uint8_t *)fast_pystack + fast_pystack_length);
+    } else {
+        mp_pystack_init(pystack->ptr, pystack->ptr + get_allocation_length(pystack) / sizeof(size_t));
+    }
     #endif
 
     #if MICROPY_ENABLE_GC
@@ -344,6 +403,10 @@ STATIC void cleanup_after_vm(supervisor_allocation *heap, supervisor_allocation
     keypad_reset();
     #endif
 
+    #if CIRCUITPY_PROFILE
+    supervisor_profile_reset();
+    #endif
+
     // Close user-initiated sockets.
     #if CIRCUITPY_SOCKETPOOL
     socketpool_user_reset();
@@ -373,6 +436,10 @@ STATIC void cleanup_after_vm(supervisor_allocation *heap, supervisor_allocation
 
     // Let the workflows know we've reset in case they want to restart.
     supervisor_workflow_reset();
+    // Workflows left off by a fast wake start now unless we're going back to sleep.
+    if (!(_exec_result.return_code & PYEXEC_DEEP_SLEEP)) {
+        supervisor_workflow_start_deferred();
+    }
 }
 
 STATIC void print_code_py_status_message(safe_mode_t safe_mode) {
@@ -385,6 +452,9 @@ STATIC void print_code_py_status_message(safe_mode_t safe_mode) {
     if (safe_mode != SAFE_MODE_NONE) {
         serial_write_compressed(translate("Running in safe mode! Not running saved code.\n"));
     }
+    #if CIRCUITPY_OS_GETENV
+    print_boot_timing();
+    #endif
 }
 
 STATIC bool run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
@@ -720,12 +790,12 @@ STATIC bool run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
             // we'll undersleep just a little. It shouldn't matter.
             if (time_to_next_change > 0) {
                 port_interrupt_after_ticks(time_to_next_change);
-                port_idle_until_interrupt();
+                supervisor_sleep_until_interrupt();
             }
             #else
             // No status LED can we sleep until we are interrupted by some
             // interaction.
-            port_idle_until_interrupt();
+            supervisor_sleep_until_interrupt();
             #endif
         }
     }
@@ -995,15 +1065,21 @@ int __attribute__((used)) main(void) {
     common_hal_nvm_bytearray_get_bytes(&common_hal_mcu_nvm_obj,0,1,&value_out);
     ++value_out;
     common_hal_nvm_bytearray_set_bytes(&common_hal_mcu_nvm_obj,0,&value_out,1);
+    common_hal_nvm_bytearray_flush(&common_hal_mcu_nvm_obj);
     #endif
 
     // Start the debug serial
     serial_early_init();
 
+    #if CIRCUITPY_OS_GETENV
+    boot_phase_start_ms = supervisor_ticks_ms64();
+    #endif
+
     // Wait briefly to give a reset window where we'll enter safe mode after the reset.
     if (get_safe_mode() == SAFE_MODE_NONE) {
         set_safe_mode(wait_for_safe_mode_reset());
     }
+    END_BOOT_PHASE(BOOT_PHASE_SAFE_MODE_WAIT);
 
     stack_init();
 
@@ -1031,6 +1107,7 @@ int __attribute__((used)) main(void) {
     if (!filesystem_init(get_safe_mode() == SAFE_MODE_NONE, false)) {
         set_safe_mode(SAFE_MODE_NO_CIRCUITPY);
     }
+    END_BOOT_PHASE(BOOT_PHASE_FILESYSTEM);
 
     #if CIRCUITPY_ALARM
     // Record which alarm woke us up, if any.
@@ -1071,8 +1148,10 @@ int __attribute__((used)) main(void) {
     #endif
 
     run_boot_py(get_safe_mode());
+    END_BOOT_PHASE(BOOT_PHASE_BOOT_PY);
 
     supervisor_workflow_start();
+    END_BOOT_PHASE(BOOT_PHASE_WORKFLOW);
 
     #if CIRCUITPY_STATUS_BAR
     supervisor_status_bar_request_update(true);
@@ -1127,6 +1206,8 @@ void gc_collect(void) {
 
     background_callback_gc_collect();
 
+    board_gc_collect();
+
     #if CIRCUITPY_ALARM
     common_hal_alarm_gc_collect();
     #endif
@@ -53,3 +53,7 @@ void common_hal_alarm_sleep_memory_get_bytes(alarm_sleep_memory_obj_t *self, uin
     memcpy(values, (uint8_t *)(BKUPRAM_ADDR + start_index), len);
     return;
 }
+
+uint8_t *common_hal_alarm_sleep_memory_get_buffer(alarm_sleep_memory_obj_t *self) {
+    return (uint8_t *)BKUPRAM_ADDR;
+}
@@ -184,6 +184,11 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
         claim_pin(miso);
     }
 
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+    self->background_write_pending = false;
+    self->background_write_buffer = MP_OBJ_NULL;
+    #endif
+
     spi_m_sync_enable(&self->spi_desc);
 }
 
@@ -291,6 +296,38 @@ bool common_hal_busio_spi_write(busio_spi_obj_t *self,
     return status >= 0; // Status is number of chars read or an error code < 0.
 }
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+bool common_hal_busio_spi_start_write(busio_spi_obj_t *self,
+    const uint8_t *data, size_t len) {
+    // Short writes aren't worth the DMA setup and long ones need multiple DMA transfers.
+    if (len < 16 || len > 65535) {
+        return false;
+    }
+    Sercom *sercom = self->spi_desc.dev.prvt;
+    self->background_write = shared_dma_transfer_start(sercom, data, &sercom->SPI.DATA.reg, NULL, NULL, len, 0);
+    if (self->background_write.failure) {
+        return false;
+    }
+    self->background_write_pending = true;
+    return true;
+}
+
+void common_hal_busio_spi_finish_write(busio_spi_obj_t *self) {
+    if (!self->background_write_pending) {
+        return;
+    }
+    while (!shared_dma_transfer_finished(self->background_write)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    shared_dma_transfer_close(self->background_write);
+    self->background_write_pending = false;
+}
+
+bool common_hal_busio_spi_write_done(busio_spi_obj_t *self) {
+    return !self->background_write_pending || shared_dma_transfer_finished(self->background_write);
+}
+#endif
+
 bool common_hal_busio_spi_read(busio_spi_obj_t *self,
     uint8_t *data, size_t len, uint8_t write_value) {
     if (len == 0) {
@@ -31,6 +31,8 @@
 
 #include "hal/include/hal_spi_m_sync.h"
 
+#include "samd/dma.h"
+
 #include "py/obj.h"
 
 typedef struct {
@@ -40,6 +42,14 @@ typedef struct {
     uint8_t clock_pin;
     uint8_t MOSI_pin;
     uint8_t MISO_pin;
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+    bool background_write_pending;
+    dma_descr_t background_write;
+    // Set by SPI.write_async() so the data isn't collected before it is sent.
+    mp_obj_t background_write_buffer;
+    // Counts SPI.write_async() writes so each SPIWrite knows whether it is the one in progress.
+    uint32_t background_write_sequence;
+    #endif
 } busio_spi_obj_t;
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_BUSIO_SPI_H
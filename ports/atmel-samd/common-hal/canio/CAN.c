@@ -219,6 +219,8 @@ void common_hal_canio_can_construct(canio_can_obj_t *self, const mcu_pin_obj_t *
             .bit.EWE = 1,
             .bit.EPE = 1,
             .bit.BOE = 1,
+            .bit.RF0LE = 1,
+            .bit.RF1LE = 1,
         };
         hri_can_write_IE_reg(self->hw, ie.reg);
     }
@@ -393,11 +395,20 @@ void common_hal_canio_reset(void) {
 
 STATIC void can_handler(int i) {
     canio_can_obj_t *self = can_objs[i];
-    (void)self;
 
     Can *hw = can_insts[i];
     uint32_t ir = hri_can_read_IR_reg(hw);
 
+    // Each lost message sets the flag again once it has been acknowledged.
+    if (self) {
+        if (ir & CAN_IR_RF0L) {
+            self->rx_lost_count[0]++;
+        }
+        if (ir & CAN_IR_RF1L) {
+            self->rx_lost_count[1]++;
+        }
+    }
+
     /* Acknowledge interrupt */
     hri_can_write_IR_reg(hw, ir);
 }
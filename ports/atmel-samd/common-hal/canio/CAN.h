@@ -41,6 +41,8 @@ typedef struct canio_can_obj {
     mp_obj_base_t base;
     Can *hw;
     canio_can_state_t *state;
+    // Counted in the interrupt handler when a message arrives at a full RX FIFO.
+    volatile uint32_t rx_lost_count[2];
     int baudrate;
     uint8_t rx_pin_number : 8;
     uint8_t tx_pin_number : 8;
@@ -298,6 +298,7 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
         self->fifo = can->state->rx0_fifo;
         self->hw = (canio_rxfifo_reg_t *)&can->hw->RXF0C;
         can->hw->IR.reg = CAN_IR_RF0N | CAN_IR_RF0W | CAN_IR_RF0F | CAN_IR_RF0L;
+        can->rx_lost_count[0] = 0;
         can->fifo0_in_use = true;
     } else if (!can->fifo1_in_use) {
         self->fifo_idx = 1;
@@ -305,6 +306,7 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
         self->hw = (canio_rxfifo_reg_t *)&can->hw->RXF1C;
         can->fifo1_in_use = true;
         can->hw->IR.reg = CAN_IR_RF1N | CAN_IR_RF1W | CAN_IR_RF1F | CAN_IR_RF1L;
+        can->rx_lost_count[1] = 0;
     } else {
         mp_raise_ValueError(translate("All RX FIFOs in use"));
     }
@@ -351,24 +353,26 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return self->hw->RXFS.bit.F0FL;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait) {
     if (!common_hal_canio_listener_in_waiting(self)) {
+        if (!wait) {
+            return false;
+        }
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
     int index = self->hw->RXFS.bit.F0GI;
     canio_can_rx_fifo_t *hw_message = &self->fifo[index];
     bool rtr = hw_message->rxf0.bit.RTR;
-    canio_message_obj_t *message = m_new_obj(canio_message_obj_t);
     message->base.type = rtr ? &canio_remote_transmission_request_type : &canio_message_type;
     message->extended = hw_message->rxf0.bit.XTD;
     if (message->extended) {
@@ -381,7 +385,11 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
         memcpy(message->data, hw_message->data, message->size);
     }
     self->hw->RXFA.bit.F0AI = index;
-    return message;
+    return true;
+}
+
+uint32_t common_hal_canio_listener_get_overflow_count(canio_listener_obj_t *self) {
+    return self->can->rx_lost_count[self->fifo_idx];
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
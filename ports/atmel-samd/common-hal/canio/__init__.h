@@ -30,8 +30,8 @@
 #include "component/can.h"
 
 #define COMMON_HAL_CANIO_MAX_MESSAGE_LENGTH (8)
-#define COMMON_HAL_CANIO_RX_FIFO_SIZE (3)
-#define COMMON_HAL_CANIO_RX_FILTER_SIZE (4)
+#define COMMON_HAL_CANIO_RX_FIFO_SIZE (16)
+#define COMMON_HAL_CANIO_RX_FILTER_SIZE (8)
 #define COMMON_HAL_CANIO_TX_FIFO_SIZE (1)
 
 // This appears to be a typo (transposition error) in the ASF4 headers
@@ -67,6 +67,15 @@
 // Only support simpler HID descriptors on SAMD21.
 #define CIRCUITPY_USB_HID_MAX_REPORT_IDS_PER_DESCRIPTOR (1)
 
+// Cache a single external flash sector; RAM is too tight for more.
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (1)
+
+// Write USB mass storage blocks straight through.
+#define CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS (0)
+
+// Decompress messages each time rather than caching them.
+#define CIRCUITPY_TRANSLATE_CACHE_ENTRIES (0)
+
 #endif // SAMD21
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
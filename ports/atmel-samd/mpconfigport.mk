@@ -18,6 +18,8 @@ ifeq ($(CHIP_FAMILY),samd21)
 
 # The ?='s allow overriding in mpconfigboard.mk.
 
+MPY_CROSS_NATIVE_ARCH ?= armv6m
+
 # Some of these are on by default with CIRCUITPY_FULL_BUILD, but don't
 # fit in 256kB of flash
 
@@ -92,6 +94,8 @@ ifeq ($(CHIP_FAMILY),samd51)
 # No native touchio on SAMD51.
 CIRCUITPY_TOUCHIO_USE_NATIVE = 0
 
+MPY_CROSS_NATIVE_ARCH ?= armv7emsp
+
 ifeq ($(CIRCUITPY_FULL_BUILD),0)
 CIRCUITPY_LTO_PARTITION ?= one
 endif
@@ -100,6 +104,7 @@ endif
 
 
 CIRCUITPY_ALARM ?= 1
+CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE ?= 1
 CIRCUITPY_FLOPPYIO ?= $(CIRCUITPY_FULL_BUILD)
 CIRCUITPY_FRAMEBUFFERIO ?= $(CIRCUITPY_FULL_BUILD)
 CIRCUITPY_PS2IO ?= 1
@@ -119,6 +124,8 @@ ifeq ($(CHIP_FAMILY),same51)
 # No native touchio on SAME51.
 CIRCUITPY_TOUCHIO_USE_NATIVE = 0
 
+MPY_CROSS_NATIVE_ARCH ?= armv7emsp
+
 ifeq ($(CIRCUITPY_FULL_BUILD),0)
 CIRCUITPY_LTO_PARTITION ?= one
 endif
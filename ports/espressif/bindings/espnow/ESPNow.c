@@ -27,6 +27,7 @@
  * THE SOFTWARE.
  */
 
+#include "py/binary.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
 #include "py/stream.h"
@@ -57,6 +58,9 @@ static void espnow_check_for_deinit(espnow_obj_t *self) {
 //|         """Allocate and initialize `ESPNow` instance as a singleton.
 //|
 //|         :param int buffer_size: The size of the internal ring buffer. Default: 526 bytes.
+//|             Each packet takes its message length plus 13 bytes. The buffer comes from the
+//|             heap, which is in PSRAM on boards that have it, so it can be made large enough to
+//|             hold bursts from many peers.
 //|         :param int phy_rate: The ESP-NOW physical layer rate. Default: 1 Mbps.
 //|             `wifi_phy_rate_t <https://docs.espressif.com/projects/esp-idf/en/release-v4.4/esp32/api-reference/network/esp_wifi.html#_CPPv415wifi_phy_rate_t>`_
 //|         """
@@ -120,14 +124,15 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espnow___exit___obj, 4, 4, espnow_obj
 //|     def send(
 //|         self,
 //|         message: ReadableBuffer,
-//|         peer: Optional[Peer] = None,
+//|         peer: Optional[Union[Peer, Sequence[Peer]]] = None,
 //|     ) -> None:
 //|         """Send a message to the peer's mac address.
 //|
 //|         This blocks until a timeout of ``2`` seconds if the ESP-NOW internal buffers are full.
 //|
 //|         :param ReadableBuffer message: The message to send (length <= 250 bytes).
-//|         :param Peer peer: Send message to this peer. If `None`, send to all registered peers.
+//|         :param Peer peer: Send message to this peer, or to each peer in a list or tuple of them.
+//|             If `None`, send to all registered peers.
 //|         """
 //|         ...
 STATIC mp_obj_t espnow_send(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -147,9 +152,21 @@ STATIC mp_obj_t espnow_send(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
     mp_buffer_info_t message;
     mp_get_buffer_raise(args[ARG_message].u_obj, &message, MP_BUFFER_READ);
 
+    mp_obj_t peer_in = args[ARG_peer].u_obj;
+    if (mp_obj_is_type(peer_in, &mp_type_tuple) || mp_obj_is_type(peer_in, &mp_type_list)) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(peer_in, &len, &items);
+        for (size_t i = 0; i < len; i++) {
+            const espnow_peer_obj_t *peer = MP_OBJ_TO_PTR(mp_arg_validate_type(items[i], &espnow_peer_type, MP_QSTR_peer));
+            common_hal_espnow_send(self, &message, peer->peer_info.peer_addr);
+        }
+        return mp_const_none;
+    }
+
     const uint8_t *mac = NULL;
-    if (args[ARG_peer].u_obj != mp_const_none) {
-        const espnow_peer_obj_t *peer = MP_OBJ_FROM_PTR(mp_arg_validate_type_or_none(args[ARG_peer].u_obj, &espnow_peer_type, MP_QSTR_peer));
+    if (peer_in != mp_const_none) {
+        const espnow_peer_obj_t *peer = MP_OBJ_FROM_PTR(mp_arg_validate_type_or_none(peer_in, &espnow_peer_type, MP_QSTR_peer));
         mac = peer->peer_info.peer_addr;
     }
 
@@ -172,6 +189,72 @@ STATIC mp_obj_t espnow_read(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(espnow_read_obj, espnow_read);
 
+//|     def recv_into(
+//|         self,
+//|         buffer: WriteableBuffer,
+//|         mac: Optional[WriteableBuffer] = None,
+//|         info: Optional[WriteableBuffer] = None,
+//|     ) -> Optional[int]:
+//|         """Read a packet from the receive buffer into buffers supplied by the caller,
+//|         without allocating. Use it in place of `read()` when packets arrive too quickly for
+//|         the garbage collection that creating an `ESPNowPacket` for each one causes.
+//|
+//|         This is non-blocking, the packet is received asynchronously from the peer(s).
+//|
+//|         :param WriteableBuffer buffer: Buffer for the message. If the message is longer,
+//|             the rest of it is discarded.
+//|         :param WriteableBuffer mac: At least 6 bytes to store the sender's mac address in.
+//|         :param WriteableBuffer info: An integer array of length 2, such as
+//|             ``array.array("l", [0, 0])``, to store the RSSI and receive time in ms in.
+//|         :returns: The length of the message if a packet was available, otherwise `None`."""
+//|         ...
+STATIC mp_obj_t espnow_recv_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_mac, ARG_info };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,   MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_mac,      MP_ARG_OBJ, { .u_obj = mp_const_none } },
+        { MP_QSTR_info,     MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    espnow_obj_t *self = pos_args[0];
+    espnow_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+
+    uint8_t mac_buf[ESP_NOW_ETH_ALEN];
+    uint8_t *mac = mac_buf;
+    if (args[ARG_mac].u_obj != mp_const_none) {
+        mp_buffer_info_t macinfo;
+        mp_get_buffer_raise(args[ARG_mac].u_obj, &macinfo, MP_BUFFER_WRITE);
+        mp_arg_validate_length_min(macinfo.len, ESP_NOW_ETH_ALEN, MP_QSTR_mac);
+        mac = macinfo.buf;
+    }
+
+    mp_buffer_info_t info;
+    bool have_info = args[ARG_info].u_obj != mp_const_none;
+    if (have_info) {
+        mp_get_buffer_raise(args[ARG_info].u_obj, &info, MP_BUFFER_WRITE);
+        mp_arg_validate_length_min(info.len / mp_binary_get_size('@', info.typecode, NULL), 2, MP_QSTR_info);
+    }
+
+    mp_int_t rssi;
+    mp_uint_t time_ms;
+    mp_int_t msg_len = common_hal_espnow_recv_into(self, bufinfo.buf, bufinfo.len, mac, &rssi, &time_ms);
+    if (msg_len < 0) {
+        return mp_const_none;
+    }
+    if (have_info) {
+        mp_binary_set_val_array_from_int(info.typecode, info.buf, 0, rssi);
+        mp_binary_set_val_array_from_int(info.typecode, info.buf, 1, time_ms);
+    }
+    return MP_OBJ_NEW_SMALL_INT(msg_len);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(espnow_recv_into_obj, 2, espnow_recv_into);
+
 //|     send_success: int
 //|     """The number of tx packets received by the peer(s) ``ESP_NOW_SEND_SUCCESS``. (read-only)"""
 //|
@@ -297,6 +380,7 @@ STATIC const mp_rom_map_elem_t espnow_locals_dict_table[] = {
 
     // Read messages
     { MP_ROM_QSTR(MP_QSTR_read),        MP_ROM_PTR(&espnow_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recv_into),   MP_ROM_PTR(&espnow_recv_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_success),MP_ROM_PTR(&espnow_read_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_read_failure),MP_ROM_PTR(&espnow_read_failure_obj)},
 
@@ -149,6 +149,57 @@ STATIC mp_obj_t espulp_ulp_halt(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(espulp_ulp_halt_obj, espulp_ulp_halt);
 
+//|     memory: memoryview
+//|     """The RTC slow memory the program is loaded into and runs from, as bytes. (read-only)
+//|
+//|     The program's variables are at the offsets given for their symbols in the
+//|     map file from the ULP build. Use `struct.unpack_from` and `struct.pack_into`
+//|     to exchange values with a running program."""
+//|
+STATIC mp_obj_t espulp_ulp_get_memory(mp_obj_t self_in) {
+    espulp_ulp_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    size_t length;
+    uint8_t *memory = common_hal_espulp_ulp_get_memory(self, &length);
+    return mp_obj_new_memoryview('B', length, memory);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espulp_ulp_get_memory_obj, espulp_ulp_get_memory);
+
+MP_PROPERTY_GETTER(espulp_ulp_memory_obj,
+    (mp_obj_t)&espulp_ulp_get_memory_obj);
+
+//|     def read_ring(self, offset: int, buffer: WriteableBuffer) -> int:
+//|         """Move the bytes a running program has queued in a ring at ``offset`` in
+//|         `memory` into ``buffer``. Return how many bytes were read, up to ``len(buffer)``.
+//|
+//|         The ring is laid out as this C struct, aligned to 4 bytes::
+//|
+//|             struct {
+//|                 volatile uint32_t head;  // bytes written, advanced by the ULP
+//|                 volatile uint32_t tail;  // bytes read, advanced by read_ring()
+//|                 uint32_t size;           // a power of 2
+//|                 uint8_t data[size];
+//|             };
+//|
+//|         The program writes byte ``head % size`` and then increments ``head``. It
+//|         must not let ``head - tail`` exceed ``size``. If it does, the queued
+//|         bytes are dropped. To sample while the main processor sleeps, have the
+//|         program call ``ulp_riscv_wakeup_main_processor()`` once ``head - tail``
+//|         reaches a high water mark, and wait for a `ULPAlarm`."""
+//|         ...
+STATIC mp_obj_t espulp_ulp_read_ring(mp_obj_t self_in, mp_obj_t offset_in, mp_obj_t buffer_in) {
+    espulp_ulp_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_int_t offset = mp_arg_validate_int_min(mp_obj_get_int(offset_in), 0, MP_QSTR_offset);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espulp_ulp_read_ring(self, offset, bufinfo.buf, bufinfo.len));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(espulp_ulp_read_ring_obj, espulp_ulp_read_ring);
+
 //|     arch: Architecture
 //|     """The ulp architecture. (read-only)"""
 //|
@@ -170,6 +221,8 @@ STATIC const mp_rom_map_elem_t espulp_ulp_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_run),         MP_ROM_PTR(&espulp_ulp_run_obj) },
     { MP_ROM_QSTR(MP_QSTR_halt),        MP_ROM_PTR(&espulp_ulp_halt_obj) },
     { MP_ROM_QSTR(MP_QSTR_arch),        MP_ROM_PTR(&espulp_ulp_arch_obj) },
+    { MP_ROM_QSTR(MP_QSTR_memory),      MP_ROM_PTR(&espulp_ulp_memory_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_ring),   MP_ROM_PTR(&espulp_ulp_read_ring_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(espulp_ulp_locals_dict, espulp_ulp_locals_table);
 
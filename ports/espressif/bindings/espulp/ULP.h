@@ -37,3 +37,6 @@ void common_hal_espulp_ulp_deinit(espulp_ulp_obj_t *self);
 
 void common_hal_espulp_ulp_run(espulp_ulp_obj_t *self, uint32_t *program, size_t length, uint32_t pin_mask);
 void common_hal_espulp_ulp_halt(espulp_ulp_obj_t *self);
+
+uint8_t *common_hal_espulp_ulp_get_memory(espulp_ulp_obj_t *self, size_t *length);
+size_t common_hal_espulp_ulp_read_ring(espulp_ulp_obj_t *self, size_t offset, uint8_t *buf, size_t len);
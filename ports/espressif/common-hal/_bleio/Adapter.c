@@ -217,7 +217,7 @@ static int _scan_event(struct ble_gap_event *event, void *scan_results_in) {
 }
 
 mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t *prefixes,
-    size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout,
+    size_t prefix_length, uint8_t *services, size_t services_length, bool remove_duplicates, bool extended, mp_int_t buffer_size, mp_float_t timeout,
     mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active) {
     if (self->scan_results != NULL) {
         if (!shared_module_bleio_scanresults_get_done(self->scan_results)) {
@@ -226,7 +226,8 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t
         self->scan_results = NULL;
     }
 
-    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi);
+    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length,
+        services, services_length, remove_duplicates, minimum_rssi);
     // size_t max_packet_size = extended ? BLE_HCI_MAX_EXT_ADV_DATA_LEN : BLE_HCI_MAX_ADV_DATA_LEN;
 
     uint8_t own_addr_type;
@@ -301,6 +302,10 @@ STATIC void _new_connection(uint16_t conn_handle) {
     connection->mtu = 0;
 
     ble_gattc_exchange_mtu(conn_handle, _mtu_reply, connection);
+    // Prefer 2M PHY where the controller and peer support it. This is a
+    // nice-to-have so ignore any error.
+    ble_gap_set_prefered_le_phy(conn_handle, BLE_GAP_LE_PHY_2M_MASK | BLE_GAP_LE_PHY_1M_MASK,
+        BLE_GAP_LE_PHY_2M_MASK | BLE_GAP_LE_PHY_1M_MASK, BLE_GAP_LE_PHY_CODED_ANY);
 
     // Change the callback for the connection.
     ble_gap_set_event_cb(conn_handle, bleio_connection_event_cb, connection);
@@ -64,3 +64,7 @@ void common_hal_alarm_sleep_memory_get_bytes(alarm_sleep_memory_obj_t *self, uin
     }
     memcpy(values, (uint8_t *)(_sleep_mem + start_index), len);
 }
+
+uint8_t *common_hal_alarm_sleep_memory_get_buffer(alarm_sleep_memory_obj_t *self) {
+    return _sleep_mem;
+}
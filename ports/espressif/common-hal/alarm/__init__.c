@@ -46,6 +46,7 @@
 #include "common-hal/digitalio/DigitalInOut.h"
 
 #include "supervisor/port.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/workflow.h"
 
 #include "esp_sleep.h"
@@ -184,7 +185,7 @@ mp_obj_t common_hal_alarm_light_sleep_until_alarms(size_t n_alarms, const mp_obj
             shared_alarm_save_wake_alarm(wake_alarm);
             break;
         }
-        port_idle_until_interrupt();
+        supervisor_idle_until_interrupt();
     }
 
     if (mp_hal_is_interrupted()) {
@@ -70,6 +70,7 @@ static void stop_dma(analogbufio_bufferedin_obj_t *self);
 void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *self, const mcu_pin_obj_t *pin, uint32_t sample_rate) {
     self->pin = pin;
     self->sample_rate = sample_rate;
+    self->sampling = false;
 }
 
 static void start_dma(analogbufio_bufferedin_obj_t *self, adc_digi_convert_mode_t *convert_mode, adc_digi_output_format_t *output_format) {
@@ -201,6 +202,7 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
     if (common_hal_analogbufio_bufferedin_deinited(self)) {
         return;
     }
+    common_hal_analogbufio_bufferedin_stop(self);
     self->pin = NULL;
 }
 
@@ -234,21 +236,36 @@ static bool check_valid_data(const adc_digi_output_data_t *data, const mcu_pin_o
     return true;
 }
 
-uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t *self) {
+    if (self->sampling) {
+        return;
+    }
+    start_dma(self, &self->convert_mode, &self->output_format);
+    self->sampling = true;
+}
+
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t *self) {
+    if (!self->sampling) {
+        return;
+    }
+    stop_dma(self);
+    self->sampling = false;
+}
+
+bool common_hal_analogbufio_bufferedin_get_sampling(analogbufio_bufferedin_obj_t *self) {
+    return self->sampling;
+}
+
+// The ADC driver keeps converting into its own store buffer until it is stopped, so
+// reading while started picks up where the last read left off.
+static uint32_t _readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len,
+    adc_digi_convert_mode_t convert_mode, adc_digi_output_format_t output_format) {
     uint8_t result[NUM_SAMPLES_PER_INTERRUPT] __attribute__ ((aligned(4))) = {0};
     uint32_t captured_samples = 0;
     uint32_t captured_bytes = 0;
     esp_err_t ret;
     uint32_t ret_num = 0;
     uint32_t adc_reading = 0;
-    adc_digi_convert_mode_t convert_mode = ADC_CONV_SINGLE_UNIT_2;
-    adc_digi_output_format_t output_format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
-
-    if (bytes_per_sample != 2) {
-        mp_raise_ValueError_varg(translate("%q must be array of type 'H'"), MP_QSTR_buffer);
-    }
-
-    start_dma(self, &convert_mode, &output_format);
 
     #if defined(DEBUG_ANALOGBUFIO)
     mp_printf(&mp_plat_print,"Required bytes: %d\n",len);
@@ -276,7 +293,6 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
                         captured_bytes += sizeof(uint16_t);
                         captured_samples++;
                     } else {
-                        stop_dma(self);
                         return captured_samples;
                     }
                 } else {
@@ -286,7 +302,6 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
                     #if defined(DEBUG_ANALOGBUFIO)
                     mp_printf(&mp_plat_print,"Invalid sample received: 0x%x\n",pResult->val);
                     #endif // DEBUG_ANALOGBUFIO
-                    stop_dma(self);
                     return captured_samples;
                     #endif
                 }
@@ -295,20 +310,34 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
             #if defined(DEBUG_ANALOGBUFIO)
             mp_printf(&mp_plat_print,"ADC Timeout\n");
             #endif // DEBUG_ANALOGBUFIO
-            stop_dma(self);
             return captured_samples;
         } else {
             #if defined(DEBUG_ANALOGBUFIO)
             mp_printf(&mp_plat_print,"adc_digi_read_bytes failed error code:%d\n",ret);
             #endif // DEBUG_ANALOGBUFIO
-            stop_dma(self);
             return captured_samples;
         }
     }
 
-    stop_dma(self);
     #if defined(DEBUG_ANALOGBUFIO)
     mp_printf(&mp_plat_print,"Captured bytes: %d\n",captured_bytes);
     #endif // DEBUG_ANALOGBUFIO
     return captured_samples;
 }
+
+uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    if (bytes_per_sample != 2) {
+        mp_raise_ValueError_varg(translate("%q must be array of type 'H'"), MP_QSTR_buffer);
+    }
+
+    if (self->sampling) {
+        return _readinto(self, buffer, len, self->convert_mode, self->output_format);
+    }
+
+    adc_digi_convert_mode_t convert_mode = ADC_CONV_SINGLE_UNIT_2;
+    adc_digi_output_format_t output_format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+    start_dma(self, &convert_mode, &output_format);
+    uint32_t captured_samples = _readinto(self, buffer, len, convert_mode, output_format);
+    stop_dma(self);
+    return captured_samples;
+}
@@ -32,11 +32,16 @@
 #include "common-hal/microcontroller/Pin.h"
 #include "py/obj.h"
 
+#include "driver/adc.h"
+
 //  This is the analogbufio object
 typedef struct {
     mp_obj_base_t base;
     const mcu_pin_obj_t *pin;
     uint32_t sample_rate;
+    bool sampling;
+    adc_digi_convert_mode_t convert_mode;
+    adc_digi_output_format_t output_format;
 } analogbufio_bufferedin_obj_t;
 
 #endif // MICROPY_INCLUDED_ESP32_COMMON_HAL_ANALOGBUFIO_BUFFEREDIN_H
@@ -176,7 +176,7 @@ static void i2s_event_task(void *self_in) {
         i2s_event_type_t event;
         BaseType_t result = xQueueReceive(i2s_queues[self->instance], &event, portMAX_DELAY);
         if (result && event == I2S_EVENT_TX_DONE) {
-            background_callback_add(&self->callback, i2s_callback_fun, self_in);
+            background_callback_add_priority(&self->callback, i2s_callback_fun, self_in, BACKGROUND_CALLBACK_REALTIME, 0);
         }
     }
 }
@@ -231,7 +231,7 @@ void port_i2s_play(i2s_t *self, mp_obj_t sample, bool loop) {
         self->i2s_config.sample_rate = sample_rate;
     }
 
-    background_callback_add(&self->callback, i2s_callback_fun, self);
+    background_callback_add_priority(&self->callback, i2s_callback_fun, self, BACKGROUND_CALLBACK_REALTIME, 0);
 }
 
 bool port_i2s_playing(i2s_t *self) {
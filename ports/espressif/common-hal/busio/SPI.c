@@ -113,6 +113,8 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
     self->MOSI = mosi;
     self->MISO = miso;
     self->clock = clock;
+    self->background_write_pending = false;
+    self->background_write_buffer = MP_OBJ_NULL;
 
     if (mosi != NULL) {
         claim_pin(mosi);
@@ -276,6 +278,49 @@ bool common_hal_busio_spi_transfer(busio_spi_obj_t *self,
     return true;
 }
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+bool common_hal_busio_spi_start_write(busio_spi_obj_t *self,
+    const uint8_t *data, size_t len) {
+    int bits_to_send = len * 8 / self->bits * self->bits;
+    // Only writes that fit in a single DMA transaction are queued in the background.
+    if (self->MOSI == NULL || len <= 4 || bits_to_send > SPI_MAX_DMA_BITS) {
+        return false;
+    }
+    memset(&self->background_transaction, 0, sizeof(spi_transaction_t));
+    self->background_transaction.length = bits_to_send;
+    self->background_transaction.tx_buffer = data;
+    if (spi_device_queue_trans(spi_handle[self->host_id], &self->background_transaction, 0) != ESP_OK) {
+        return false;
+    }
+    self->background_write_pending = true;
+    return true;
+}
+
+void common_hal_busio_spi_finish_write(busio_spi_obj_t *self) {
+    if (!self->background_write_pending) {
+        return;
+    }
+    spi_transaction_t *rtrans;
+    while (spi_device_get_trans_result(spi_handle[self->host_id], &rtrans, 0) != ESP_OK) {
+        RUN_BACKGROUND_TASKS;
+    }
+    self->background_write_pending = false;
+}
+
+bool common_hal_busio_spi_write_done(busio_spi_obj_t *self) {
+    if (!self->background_write_pending) {
+        return true;
+    }
+    // Collecting the result here means finish_write() has nothing left to wait for.
+    spi_transaction_t *rtrans;
+    if (spi_device_get_trans_result(spi_handle[self->host_id], &rtrans, 0) != ESP_OK) {
+        return false;
+    }
+    self->background_write_pending = false;
+    return true;
+}
+#endif
+
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t *self) {
     return self->baudrate;
 }
@@ -45,6 +45,13 @@ typedef struct {
     uint32_t baudrate;
 
     bool has_lock;
+    // Queued by common_hal_busio_spi_start_write() and collected by _finish_write().
+    bool background_write_pending;
+    spi_transaction_t background_transaction;
+    // Set by SPI.write_async() so the data isn't collected before it is sent.
+    mp_obj_t background_write_buffer;
+    // Counts SPI.write_async() writes so each SPIWrite knows whether it is the one in progress.
+    uint32_t background_write_sequence;
 } busio_spi_obj_t;
 
 void spi_reset(void);
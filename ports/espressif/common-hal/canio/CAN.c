@@ -132,6 +132,9 @@ void common_hal_canio_can_construct(canio_can_obj_t *self, const mcu_pin_obj_t *
     twai_general_config_t g_config = TWAI_GENERAL_CONFIG_DEFAULT(-1, -1, TWAI_MODE_NORMAL);
     g_config.tx_io = tx->number;
     g_config.rx_io = rx->number;
+    // The driver's interrupt handler moves messages from the single message
+    // hardware buffer into this queue, so it has to cover bursts and GC pauses.
+    g_config.rx_queue_len = 32;
     if (loopback) {
         g_config.mode = TWAI_MODE_NO_ACK;
     }
@@ -59,50 +59,80 @@ static void canio_set_acc_filter(twai_dev_t *hw, uint32_t code, uint32_t mask, b
     hw->mode_reg.afm = single_filter;
 }
 
-STATIC void install_standard_filter(canio_listener_obj_t *self, canio_match_obj_t *match) {
+STATIC void install_standard_filter(canio_match_obj_t *match) {
     canio_set_acc_filter(&TWAI, match->id << 21, ~(match->mask << 21), true);
-    self->extended = false;
-    self->standard = true;
 }
 
-STATIC void install_extended_filter(canio_listener_obj_t *self, canio_match_obj_t *match) {
+STATIC void install_extended_filter(canio_match_obj_t *match) {
     canio_set_acc_filter(&TWAI, match->id << 3, ~(match->mask << 3), true);
-    self->extended = true;
-    self->standard = false;
 }
 
-STATIC void install_all_match_filter(canio_listener_obj_t *self) {
+STATIC void install_all_match_filter(void) {
     canio_set_acc_filter(&TWAI, 0u, ~0u, true);
-    self->extended = true;
-    self->standard = true;
 }
 
+// There is a single acceptance filter, so install one that accepts every
+// message any of the matches accept: only the id bits that all matches care
+// about and agree on are checked. in_waiting then drops messages that don't
+// exactly match, without them ever reaching Python.
 __attribute__((noinline,optimize("O0")))
 STATIC void set_filters(canio_listener_obj_t *self, size_t nmatch, canio_match_obj_t **matches) {
+    canio_match_obj_t combined = { .mask = 0 };
+    if (nmatch) {
+        combined = *matches[0];
+        for (size_t i = 1; i < nmatch; i++) {
+            if (matches[i]->extended != combined.extended) {
+                combined.mask = 0;
+                break;
+            }
+            combined.mask &= matches[i]->mask & ~(matches[i]->id ^ combined.id);
+        }
+        combined.id &= combined.mask;
+    }
+
     twai_ll_enter_reset_mode(&TWAI);
 
-    if (!nmatch) {
-        install_all_match_filter(self);
+    if (!combined.mask) {
+        install_all_match_filter();
+    } else if (combined.extended) {
+        install_extended_filter(&combined);
     } else {
-        canio_match_obj_t *match = matches[0];
-        if (match->extended) {
-            install_extended_filter(self, match);
-        } else {
-            install_standard_filter(self, match);
-        }
+        install_standard_filter(&combined);
     }
 
     twai_ll_exit_reset_mode(&TWAI);
 }
 
+STATIC bool message_matches(canio_listener_obj_t *self, const twai_message_t *message) {
+    if (!self->nmatch) {
+        return true;
+    }
+    for (size_t i = 0; i < self->nmatch; i++) {
+        canio_match_obj_t *match = &self->matches[i];
+        if (match->extended == message->extd && ((message->identifier ^ match->id) & match->mask) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+STATIC uint32_t rx_lost_count(void) {
+    twai_status_info_t info;
+    twai_get_status_info(&info);
+    return info.rx_missed_count + info.rx_overrun_count;
+}
 
 void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_obj_t *can, size_t nmatch, canio_match_obj_t **matches, float timeout) {
     if (can->fifo_in_use) {
         mp_raise_ValueError(translate("All RX FIFOs in use"));
     }
-    if (nmatch > 1) {
-        mp_raise_ValueError(translate("Filters too complex"));
+
+    // The caller's list of matches doesn't outlive this call.
+    self->matches = nmatch ? m_new(canio_match_obj_t, nmatch) : NULL;
+    for (size_t i = 0; i < nmatch; i++) {
+        self->matches[i] = *matches[i];
     }
+    self->nmatch = nmatch;
 
     // Nothing can fail now so it's safe to assign self->can
     can->fifo_in_use = 1;
@@ -110,7 +140,7 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
     self->pending = false;
 
     set_filters(self, nmatch, matches);
-    self->extended = self->standard = true;
+    self->rx_lost_at_start = rx_lost_count();
 
     common_hal_canio_listener_set_timeout(self, timeout);
 }
@@ -134,27 +164,25 @@ void common_hal_canio_listener_check_for_deinit(canio_listener_obj_t *self) {
 // and then we can say that we have 1 message pending
 int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     while (!self->pending && twai_receive(&self->message_in, 0) == ESP_OK) {
-        if (self->message_in.extd && self->extended) {
-            self->pending = true;
-        }
-        if (!self->message_in.extd && self->standard) {
-            self->pending = true;
-        }
+        self->pending = message_matches(self, &self->message_in);
     }
     return self->pending;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait) {
     if (!common_hal_canio_listener_in_waiting(self)) {
+        if (!wait) {
+            return false;
+        }
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
@@ -162,7 +190,6 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     bool rtr = self->message_in.rtr;
 
     int dlc = self->message_in.data_length_code;
-    canio_message_obj_t *message = m_new_obj(canio_message_obj_t);
     message->base.type = rtr ? &canio_remote_transmission_request_type : &canio_message_type;
     message->extended = self->message_in.extd;
     message->id = self->message_in.identifier;
@@ -175,7 +202,11 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
 
     self->pending = false;
 
-    return message;
+    return true;
+}
+
+uint32_t common_hal_canio_listener_get_overflow_count(canio_listener_obj_t *self) {
+    return rx_lost_count() - self->rx_lost_at_start;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
@@ -183,4 +214,6 @@ void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
         self->can->fifo_in_use = false;
     }
     self->can = NULL;
+    self->matches = NULL;
+    self->nmatch = 0;
 }
@@ -32,9 +32,10 @@
 typedef struct canio_listener_obj {
     mp_obj_base_t base;
     canio_can_obj_t *can;
-    bool extended : 1;
-    bool standard : 1;
+    canio_match_obj_t *matches;
+    size_t nmatch;
     bool pending : 1;
     twai_message_t message_in;
     uint32_t timeout_ms;
+    uint32_t rx_lost_at_start;
 } canio_listener_obj_t;
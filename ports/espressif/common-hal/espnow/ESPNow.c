@@ -205,36 +205,59 @@ mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *mess
     return mp_const_none;
 }
 
-mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
+// Take the next packet from the receive buffer, storing its peer address and up to msg_max bytes
+// of its message. The rest of a longer message is discarded. Returns false if there is no packet.
+static bool espnow_get_packet(espnow_obj_t *self, espnow_header_t *header, uint8_t *mac, uint8_t *msg, size_t msg_max) {
     if (!ringbuf_num_filled(self->recv_buffer)) {
-        return mp_const_none;
+        return false;
     }
 
     // Read the packet header from the incoming buffer
-    espnow_header_t header;
-    if (ringbuf_get_n(self->recv_buffer, (uint8_t *)&header, sizeof(header)) != sizeof(header)) {
+    if (ringbuf_get_n(self->recv_buffer, (uint8_t *)header, sizeof(*header)) != sizeof(*header)) {
         mp_arg_error_invalid(MP_QSTR_buffer);
     }
 
-    uint8_t msg_len = header.msg_len;
-
-    uint8_t mac_buf[ESP_NOW_ETH_ALEN];
-    uint8_t msg_buf[msg_len];
+    uint8_t msg_len = header->msg_len;
+    size_t stored = MIN(msg_len, msg_max);
 
     // Check the message packet header format and read the message data
-    if (header.magic != ESPNOW_MAGIC ||
+    if (header->magic != ESPNOW_MAGIC ||
         msg_len > ESP_NOW_MAX_DATA_LEN ||
-        ringbuf_get_n(self->recv_buffer, mac_buf, ESP_NOW_ETH_ALEN) != ESP_NOW_ETH_ALEN ||
-        ringbuf_get_n(self->recv_buffer, msg_buf, msg_len) != msg_len) {
+        ringbuf_get_n(self->recv_buffer, mac, ESP_NOW_ETH_ALEN) != ESP_NOW_ETH_ALEN ||
+        ringbuf_get_n(self->recv_buffer, msg, stored) != stored) {
         mp_arg_error_invalid(MP_QSTR_buffer);
     }
+    for (size_t i = stored; i < msg_len; i++) {
+        ringbuf_get(self->recv_buffer);
+    }
+    return true;
+}
+
+mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
+    espnow_header_t header;
+    uint8_t mac_buf[ESP_NOW_ETH_ALEN];
+    uint8_t msg_buf[ESP_NOW_MAX_DATA_LEN];
+
+    if (!espnow_get_packet(self, &header, mac_buf, msg_buf, sizeof(msg_buf))) {
+        return mp_const_none;
+    }
 
     mp_obj_t elems[4] = {
         mp_obj_new_bytes(mac_buf, ESP_NOW_ETH_ALEN),
-        mp_obj_new_bytes(msg_buf, msg_len),
+        mp_obj_new_bytes(msg_buf, header.msg_len),
         MP_OBJ_NEW_SMALL_INT(header.rssi),
         mp_obj_new_int(header.time_ms),
     };
 
     return namedtuple_make_new((const mp_obj_type_t *)&espnow_packet_type_obj, 4, 0, elems);
 }
+
+mp_int_t common_hal_espnow_recv_into(espnow_obj_t *self, uint8_t *buf, size_t len, uint8_t *mac, mp_int_t *rssi, mp_uint_t *time_ms) {
+    espnow_header_t header;
+    if (!espnow_get_packet(self, &header, mac, buf, len)) {
+        return -1;
+    }
+    *rssi = header.rssi;
+    *time_ms = header.time_ms;
+    return header.msg_len;
+}
@@ -57,3 +57,4 @@ extern void common_hal_espnow_set_pmk(espnow_obj_t *self, const uint8_t *key);
 
 extern mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *message, const uint8_t *mac);
 extern mp_obj_t common_hal_espnow_read(espnow_obj_t *self);
+extern mp_int_t common_hal_espnow_recv_into(espnow_obj_t *self, uint8_t *buf, size_t len, uint8_t *mac, mp_int_t *rssi, mp_uint_t *time_ms);
@@ -27,6 +27,8 @@
 #include "bindings/espulp/__init__.h"
 #include "bindings/espulp/ULP.h"
 
+#include <string.h>
+
 #include "py/runtime.h"
 
 #include "shared-bindings/microcontroller/Pin.h"
@@ -133,6 +135,50 @@ void common_hal_espulp_ulp_halt(espulp_ulp_obj_t *self) {
     }
 }
 
+uint8_t *common_hal_espulp_ulp_get_memory(espulp_ulp_obj_t *self, size_t *length) {
+    *length = ULP_COPROC_RESERVE_MEM;
+    return (uint8_t *)RTC_SLOW_MEM;
+}
+
+// The ring shared with the ULP program. The ULP writes data and then advances head. We
+// copy it out and then advance tail. head and tail count bytes and are masked by size - 1
+// to index data, so a full ring is told apart from an empty one.
+typedef struct {
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t size;
+    uint8_t data[];
+} espulp_ring_t;
+
+size_t common_hal_espulp_ulp_read_ring(espulp_ulp_obj_t *self, size_t offset, uint8_t *buf, size_t len) {
+    if (offset % 4 != 0 || offset + sizeof(espulp_ring_t) > ULP_COPROC_RESERVE_MEM) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_offset);
+    }
+    espulp_ring_t *ring = (espulp_ring_t *)((uint8_t *)RTC_SLOW_MEM + offset);
+    uint32_t size = ring->size;
+    if (size == 0 || (size & (size - 1)) != 0) {
+        mp_raise_ValueError_varg(translate("%q must be power of 2"), MP_QSTR_size);
+    }
+    if (size > ULP_COPROC_RESERVE_MEM - offset - sizeof(espulp_ring_t)) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_size);
+    }
+
+    uint32_t tail = ring->tail;
+    uint32_t available = ring->head - tail;
+    if (available > size) {
+        // The ULP overwrote data we had not read. Drop all of it.
+        ring->tail = ring->head;
+        return 0;
+    }
+    len = MIN(len, available);
+    size_t start = tail & (size - 1);
+    size_t first = MIN(len, size - start);
+    memcpy(buf, ring->data + start, first);
+    memcpy(buf + first, ring->data, len - first);
+    ring->tail = tail + len;
+    return len;
+}
+
 void common_hal_espulp_ulp_construct(espulp_ulp_obj_t *self, espulp_architecture_t arch) {
     // Use a static variable to track ULP in use so that subsequent code runs can
     // use a running ULP. This is only to prevent multiple portions of user code
@@ -28,11 +28,13 @@
 #define MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_HASHLIB_HASH_H
 
 #include "components/mbedtls/mbedtls/include/mbedtls/sha1.h"
+#include "components/mbedtls/mbedtls/include/mbedtls/sha256.h"
 
 typedef struct {
     mp_obj_base_t base;
     union {
         mbedtls_sha1_context sha1;
+        mbedtls_sha256_context sha256;
     };
     // Of MBEDTLS_SSL_HASH_*
     uint8_t hash_type;
@@ -57,6 +57,9 @@ StackType_t socket_select_stack[2 * configMINIMAL_STACK_SIZE];
 STATIC uint8_t socket_fd_state[CONFIG_LWIP_MAX_SOCKETS];
 
 STATIC socketpool_socket_obj_t *user_socket[CONFIG_LWIP_MAX_SOCKETS];
+// Set by CircuitPython when a poll found a user socket not readable, so that the select task
+// watches user sockets too and wakes it once one is. Cleared again when that happens.
+STATIC volatile bool user_socket_wakeup;
 StaticTask_t socket_select_task_buffer;
 TaskHandle_t socket_select_task_handle;
 STATIC int socket_change_fd = -1;
@@ -71,8 +74,9 @@ STATIC void socket_select_task(void *arg) {
         FD_ZERO(&excptfds);
         FD_SET(socket_change_fd, &readfds);
         int max_fd = socket_change_fd;
+        bool watch_user_sockets = user_socket_wakeup;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
-            if ((socket_fd_state[i] == FDSTATE_OPEN) && (user_socket[i] == NULL)) {
+            if ((socket_fd_state[i] == FDSTATE_OPEN) && (user_socket[i] == NULL || watch_user_sockets)) {
                 int sockfd = i + LWIP_SOCKET_OFFSET;
                 max_fd = MAX(max_fd, sockfd);
                 FD_SET(sockfd, &readfds);
@@ -96,6 +100,7 @@ STATIC void socket_select_task(void *arg) {
         }
 
         // Handle active FDs, close the dead ones
+        bool user_socket_ready = false;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             int sockfd = i + LWIP_SOCKET_OFFSET;
             if (socket_fd_state[i] != FDSTATE_CLOSED) {
@@ -103,11 +108,21 @@ STATIC void socket_select_task(void *arg) {
                     if (socket_fd_state[i] == FDSTATE_CLOSING) {
                         socket_fd_state[i] = FDSTATE_CLOSED;
                         num_triggered--;
+                    } else if (user_socket[i] != NULL) {
+                        user_socket_ready = true;
+                        num_triggered--;
                     }
                 }
             }
         }
 
+        if (user_socket_ready) {
+            // Stop watching the user sockets until CircuitPython polls them again, so that
+            // unread data doesn't keep triggering the select.
+            user_socket_wakeup = false;
+            port_wake_main_task();
+        }
+
         if (num_triggered > 0) {
             // Wake up CircuitPython by queuing request
             supervisor_workflow_request_background();
@@ -121,6 +136,7 @@ STATIC void socket_select_task(void *arg) {
 }
 
 void socket_user_reset(void) {
+    user_socket_wakeup = false;
     if (socket_change_fd < 0) {
         esp_vfs_eventfd_config_t config = ESP_VFS_EVENTD_CONFIG_DEFAULT();
         ESP_ERROR_CHECK(esp_vfs_eventfd_register(&config));
@@ -562,9 +578,12 @@ mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const
     return sent;
 }
 
-mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
-    const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len) {
+mp_uint_t common_hal_socketpool_socket_sendall_part(socketpool_socket_obj_t *self, mp_obj_t owner, const uint8_t *buf, uint32_t len) {
+    // The socket API always copies.
+    return common_hal_socketpool_socket_send(self, buf, len);
+}
 
+STATIC void resolve_dest_addr_raise(const char *host, uint32_t port, struct sockaddr_in *dest_addr) {
     // Set parameters
     const struct addrinfo hints = {
         .ai_family = AF_INET,
@@ -577,15 +596,20 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     }
 
     // Set parameters
-    struct sockaddr_in dest_addr;
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wcast-align"
-    dest_addr.sin_addr.s_addr = ((struct sockaddr_in *)result_i->ai_addr)->sin_addr.s_addr;
+    dest_addr->sin_addr.s_addr = ((struct sockaddr_in *)result_i->ai_addr)->sin_addr.s_addr;
     #pragma GCC diagnostic pop
     freeaddrinfo(result_i);
 
-    dest_addr.sin_family = AF_INET;
-    dest_addr.sin_port = htons(port);
+    dest_addr->sin_family = AF_INET;
+    dest_addr->sin_port = htons(port);
+}
+
+mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
+    const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len) {
+    struct sockaddr_in dest_addr;
+    resolve_dest_addr_raise(host, port, &dest_addr);
 
     int bytes_sent = lwip_sendto(self->num, buf, len, 0, (struct sockaddr *)&dest_addr, sizeof(dest_addr));
     if (bytes_sent < 0) {
@@ -595,6 +619,63 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     return bytes_sent;
 }
 
+mp_uint_t common_hal_socketpool_socket_sendto_many(socketpool_socket_obj_t *self,
+    const char *host, size_t hostlen, uint32_t port, const uint8_t *buf,
+    const uint16_t *ends, size_t count) {
+    struct sockaddr_in dest_addr;
+    resolve_dest_addr_raise(host, port, &dest_addr);
+
+    size_t sent = 0;
+    mp_uint_t start = 0;
+    for (; sent < count; sent++) {
+        mp_uint_t end = ends[sent];
+        if (lwip_sendto(self->num, buf + start, end - start, 0, (struct sockaddr *)&dest_addr, sizeof(dest_addr)) < 0) {
+            if (sent == 0) {
+                mp_raise_BrokenPipeError();
+            }
+            // Report what was sent; the caller can resend the rest.
+            break;
+        }
+        start = end;
+    }
+    return sent;
+}
+
+mp_uint_t common_hal_socketpool_socket_recvfrom_many_into(socketpool_socket_obj_t *self,
+    uint8_t *buf, uint32_t len, uint16_t *ends, size_t count,
+    uint8_t *ip, uint32_t *port) {
+    // Wait for the first datagram as recvfrom_into() does.
+    mp_uint_t used = common_hal_socketpool_socket_recvfrom_into(self, buf, len, ip, port);
+    ends[0] = used;
+
+    // Then take any others already queued from the same source that fit whole. Each is peeked
+    // first so one that doesn't qualify stays queued for the next call.
+    size_t received = 1;
+    while (received < count) {
+        struct sockaddr_in source_addr;
+        struct iovec iov = {
+            .iov_base = buf + used,
+            .iov_len = len - used,
+        };
+        struct msghdr msg = {
+            .msg_name = &source_addr,
+            .msg_namelen = sizeof(source_addr),
+            .msg_iov = &iov,
+            .msg_iovlen = 1,
+        };
+        int peeked = lwip_recvmsg(self->num, &msg, MSG_PEEK | MSG_DONTWAIT);
+        if (peeked < 0 || (msg.msg_flags & MSG_TRUNC) ||
+            htons(source_addr.sin_port) != *port ||
+            memcmp(&source_addr.sin_addr.s_addr, ip, sizeof(source_addr.sin_addr.s_addr)) != 0) {
+            break;
+        }
+        lwip_recv(self->num, buf + used, len - used, MSG_DONTWAIT);
+        used += peeked;
+        ends[received++] = used;
+    }
+    return received;
+}
+
 void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms) {
     self->timeout_ms = timeout_ms;
 }
@@ -616,6 +697,13 @@ bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
     FD_SET(self->num, &fds);
     int num_triggered = select(self->num + 1, &fds, NULL, &fds, &immediate);
 
+    if (num_triggered == 0 && !user_socket_wakeup && socket_change_fd >= 0) {
+        // Have the select task wake us when this, or another user socket, becomes readable.
+        user_socket_wakeup = true;
+        uint64_t signal = 1;
+        write(socket_change_fd, &signal, sizeof(signal));
+    }
+
     // including returning true in the error case
     return num_triggered != 0;
 }
@@ -34,7 +34,75 @@
 #include "py/runtime.h"
 
 void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        self->session_cache[i].hostname = MP_OBJ_NULL;
+        self->session_cache[i].session = NULL;
+    }
+    self->session_cache_next = 0;
+    self->session_hits = 0;
+    self->session_misses = 0;
+}
+
+void common_hal_ssl_sslcontext_deinit(ssl_sslcontext_obj_t *self) {
+    // The sessions live on the IDF heap, so they must be freed explicitly.
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        if (self->session_cache[i].session != NULL) {
+            esp_tls_free_client_session(self->session_cache[i].session);
+            self->session_cache[i].session = NULL;
+        }
+        self->session_cache[i].hostname = MP_OBJ_NULL;
+    }
+}
+
+mp_uint_t common_hal_ssl_sslcontext_get_session_hits(ssl_sslcontext_obj_t *self) {
+    return self->session_hits;
+}
+
+mp_uint_t common_hal_ssl_sslcontext_get_session_misses(ssl_sslcontext_obj_t *self) {
+    return self->session_misses;
+}
 
+STATIC ssl_session_cache_entry_t *find_entry(ssl_sslcontext_obj_t *self, const char *hostname) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        ssl_session_cache_entry_t *entry = &self->session_cache[i];
+        if (entry->hostname != MP_OBJ_NULL && strcmp(mp_obj_str_get_str(entry->hostname), hostname) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+esp_tls_client_session_t *ssl_sslcontext_find_session(ssl_sslcontext_obj_t *self, const char *hostname) {
+    ssl_session_cache_entry_t *entry = find_entry(self, hostname);
+    return entry == NULL ? NULL : entry->session;
+}
+
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, esp_tls_t *tls, const char *hostname) {
+    esp_tls_client_session_t *session = esp_tls_get_client_session(tls);
+    ssl_session_cache_entry_t *entry = find_entry(self, hostname);
+    // A resumed session keeps the start time of the full handshake that created it, while a
+    // new one is stamped with the current time. ESP-TLS gives no more direct indication.
+    if (entry != NULL && session != NULL &&
+        entry->session->saved_session.start == session->saved_session.start) {
+        self->session_hits++;
+    } else {
+        self->session_misses++;
+    }
+    if (session == NULL) {
+        return;
+    }
+    if (entry == NULL) {
+        entry = &self->session_cache[self->session_cache_next];
+        self->session_cache_next = (self->session_cache_next + 1) % CIRCUITPY_SSL_SESSION_CACHE_SIZE;
+        if (entry->session != NULL) {
+            esp_tls_free_client_session(entry->session);
+        }
+        entry->hostname = mp_obj_new_str(hostname, strlen(hostname));
+    } else {
+        esp_tls_free_client_session(entry->session);
+    }
+    // Keep the newest session, since the server may have issued a new ticket.
+    entry->session = session;
 }
 
 ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t *self,
@@ -31,9 +31,21 @@
 
 #include "components/esp-tls/esp_tls.h"
 
+typedef struct {
+    mp_obj_t hostname;
+    esp_tls_client_session_t *session;
+} ssl_session_cache_entry_t;
+
 typedef struct {
     mp_obj_base_t base;
     esp_tls_cfg_t ssl_config;
+    // Client sessions, keyed by server hostname, that later connections try to resume.
+    ssl_session_cache_entry_t session_cache[CIRCUITPY_SSL_SESSION_CACHE_SIZE];
+    uint8_t session_cache_next;
+    mp_uint_t session_hits, session_misses;
 } ssl_sslcontext_obj_t;
 
+esp_tls_client_session_t *ssl_sslcontext_find_session(ssl_sslcontext_obj_t *self, const char *hostname);
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, esp_tls_t *tls, const char *hostname);
+
 #endif // MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_SSL_SSL_CONTEXT_H
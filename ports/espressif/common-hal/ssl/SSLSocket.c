@@ -33,6 +33,7 @@
 #include "shared/runtime/interrupt_char.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
+#include "supervisor/shared/cpu.h"
 #include "supervisor/shared/tick.h"
 
 ssl_sslsocket_obj_t *common_hal_ssl_sslsocket_accept(ssl_sslsocket_obj_t *self,
@@ -55,7 +56,17 @@ void common_hal_ssl_sslsocket_close(ssl_sslsocket_obj_t *self) {
 
 void common_hal_ssl_sslsocket_connect(ssl_sslsocket_obj_t *self,
     const char *host, size_t hostlen, uint32_t port) {
+    const char *server_hostname = self->ssl_config.common_name;
+    if (server_hostname != NULL) {
+        self->ssl_config.client_session = ssl_sslcontext_find_session(self->ssl_context, server_hostname);
+    }
+    #if CIRCUITPY_CPU_GOVERNOR
+    cpu_governor_busy(CPU_BUSY_NETWORK, true);
+    #endif
     int result = esp_tls_conn_new_sync(host, hostlen, port, &self->ssl_config, self->tls);
+    #if CIRCUITPY_CPU_GOVERNOR
+    cpu_governor_busy(CPU_BUSY_NETWORK, false);
+    #endif
     self->sock->connected = result >= 0;
     if (result < 0) {
         int esp_tls_code;
@@ -81,6 +92,10 @@ void common_hal_ssl_sslsocket_connect(ssl_sslsocket_obj_t *self,
         tv.tv_usec = 0;
         setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
         setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+        if (server_hostname != NULL) {
+            ssl_sslcontext_save_session(self->ssl_context, self->tls, server_hostname);
+        }
     }
 }
 
@@ -92,6 +107,30 @@ bool common_hal_ssl_sslsocket_get_connected(ssl_sslsocket_obj_t *self) {
     return self->sock->connected;
 }
 
+STATIC bool poll_tls_fd(ssl_sslsocket_obj_t *self, bool write) {
+    int fd;
+    if (esp_tls_get_conn_sockfd(self->tls, &fd) != ESP_OK) {
+        return true;
+    }
+    struct timeval immediate = {0, 0};
+
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(fd, &fds);
+    int num_triggered = select(fd + 1, write ? NULL : &fds, write ? &fds : NULL, &fds, &immediate);
+
+    // including returning true in the error case
+    return num_triggered != 0;
+}
+
+bool common_hal_ssl_sslsocket_readable(ssl_sslsocket_obj_t *self) {
+    return esp_tls_get_bytes_avail(self->tls) > 0 || poll_tls_fd(self, false);
+}
+
+bool common_hal_ssl_sslsocket_writable(ssl_sslsocket_obj_t *self) {
+    return poll_tls_fd(self, true);
+}
+
 bool common_hal_ssl_sslsocket_listen(ssl_sslsocket_obj_t *self, int backlog) {
     return common_hal_socketpool_socket_listen(self->sock, backlog);
 }
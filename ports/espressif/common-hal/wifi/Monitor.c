@@ -27,71 +27,150 @@
 #include <string.h>
 
 #include "py/mpstate.h"
+#include "py/objstr.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/wifi/Monitor.h"
 #include "shared-bindings/wifi/Packet.h"
 
-#include "esp_log.h"
-
 #define MONITOR_PAYLOAD_FCS_LEN     (4)
-#define MONITOR_QUEUE_TIMEOUT_TICK  (0)
 
-typedef struct {
-    void *payload;
-    unsigned channel;
-    uint32_t length;
-    signed rssi;
-} monitor_packet_t;
+// Copy len bytes at offset bytes past the read position of the ring.
+static void monitor_ring_copy(wifi_monitor_obj_t *self, size_t offset, void *dest, size_t len) {
+    size_t start = (self->ring_read + offset) % self->ring_size;
+    size_t first = MIN(len, self->ring_size - start);
+    memcpy(dest, self->ring + start, first);
+    memcpy((uint8_t *)dest + first, self->ring, len - first);
+}
+
+static void monitor_ring_put(wifi_monitor_obj_t *self, const void *src, size_t len) {
+    size_t first = MIN(len, self->ring_size - self->ring_write);
+    memcpy(self->ring + self->ring_write, src, first);
+    memcpy(self->ring, (const uint8_t *)src + first, len - first);
+    self->ring_write = (self->ring_write + len) % self->ring_size;
+}
+
+// Drop the record at the read position, which is size bytes long in all.
+static void monitor_ring_release(wifi_monitor_obj_t *self, size_t size) {
+    self->ring_read = (self->ring_read + size) % self->ring_size;
+    portENTER_CRITICAL(&self->ring_lock);
+    self->ring_used -= size;
+    self->queued--;
+    portEXIT_CRITICAL(&self->ring_lock);
+}
 
-static const char *TAG = "monitor";
+static bool monitor_frame_matches(wifi_monitor_obj_t *self, const uint8_t *frame, size_t len) {
+    if (len < 2) {
+        return false;
+    }
+    // The first byte of the frame control field holds the type and subtype.
+    if (self->frame_type >= 0 && ((frame[0] >> 2) & 0x3) != self->frame_type) {
+        return false;
+    }
+    if (self->frame_subtype >= 0 && (frame[0] >> 4) != self->frame_subtype) {
+        return false;
+    }
+    if (self->match_mac) {
+        // Look for the MAC in the first three addresses, as far as the frame has them.
+        for (size_t offset = 4; offset <= 16 && offset + sizeof(self->mac) <= len; offset += sizeof(self->mac)) {
+            if (memcmp(frame + offset, self->mac, sizeof(self->mac)) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return true;
+}
 
 static void wifi_monitor_cb(void *recv_buf, wifi_promiscuous_pkt_type_t type) {
     wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)recv_buf;
+    wifi_monitor_obj_t *self = MP_STATE_VM(wifi_monitor_singleton);
+
+    // for now, the monitor only dumps the length of the MISC type frame
+    if (type == WIFI_PKT_MISC || pkt->rx_ctrl.rx_state || self->ring == NULL ||
+        pkt->rx_ctrl.sig_len < MONITOR_PAYLOAD_FCS_LEN) {
+        return;
+    }
 
-    // prepare packet
-    monitor_packet_t packet = {
+    // Filter and cut the frame before anything is copied.
+    uint16_t frame_length = pkt->rx_ctrl.sig_len - MONITOR_PAYLOAD_FCS_LEN;
+    if (!monitor_frame_matches(self, pkt->payload, frame_length)) {
+        return;
+    }
+    wifi_monitor_record_t record = {
+        .length = frame_length,
+        .frame_length = frame_length,
         .channel = pkt->rx_ctrl.channel,
-        .length = pkt->rx_ctrl.sig_len,
         .rssi = pkt->rx_ctrl.rssi,
+        .timestamp = pkt->rx_ctrl.timestamp,
     };
+    if (self->snaplen != 0 && record.length > self->snaplen) {
+        record.length = self->snaplen;
+    }
+    size_t record_size = sizeof(record) + record.length;
 
-    // for now, the monitor only dumps the length of the MISC type frame
-    if (type != WIFI_PKT_MISC && !pkt->rx_ctrl.rx_state) {
-        packet.length -= MONITOR_PAYLOAD_FCS_LEN;
-        packet.payload = malloc(packet.length);
-        if (packet.payload) {
-            memcpy(packet.payload, pkt->payload, packet.length);
-            wifi_monitor_obj_t *self = MP_STATE_VM(wifi_monitor_singleton);
-            if (self->queue) {
-                // send packet
-                if (xQueueSendFromISR(self->queue, &packet, NULL) != pdTRUE) {
-                    self->lost++;
-                    free(packet.payload);
-                    ESP_LOGE(TAG, "packet queue full");
-                }
-            }
-        } else {
-            ESP_LOGE(TAG, "not enough memory for packet");
-        }
+    portENTER_CRITICAL(&self->ring_lock);
+    bool fits = self->queued < self->queue_length && self->ring_used + record_size <= self->ring_size;
+    if (!fits) {
+        self->lost++;
+    }
+    portEXIT_CRITICAL(&self->ring_lock);
+    if (!fits) {
+        return;
     }
+
+    monitor_ring_put(self, &record, sizeof(record));
+    monitor_ring_put(self, pkt->payload, record.length);
+
+    portENTER_CRITICAL(&self->ring_lock);
+    self->ring_used += record_size;
+    self->queued++;
+    portEXIT_CRITICAL(&self->ring_lock);
 }
 
-void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel, size_t queue) {
+void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel, size_t queue,
+    size_t buffer_size, uint16_t snaplen, int8_t frame_type, int8_t frame_subtype, const uint8_t *mac) {
     const compressed_string_t *monitor_mode_init_error = translate("monitor init failed");
 
-    self->queue = xQueueCreate(queue, sizeof(monitor_packet_t));
-    if (!self->queue) {
-        mp_raise_RuntimeError(monitor_mode_init_error);
+    // The ring is on the heap, which is in PSRAM on boards that have it.
+    self->ring = m_malloc(buffer_size, false);
+    self->ring_size = buffer_size;
+    self->ring_read = 0;
+    self->ring_write = 0;
+    self->ring_used = 0;
+    self->queued = 0;
+    self->lost = 0;
+    self->ring_lock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+
+    self->snaplen = snaplen;
+    self->frame_type = frame_type;
+    self->frame_subtype = frame_subtype;
+    self->match_mac = mac != NULL;
+    if (mac != NULL) {
+        memcpy(self->mac, mac, sizeof(self->mac));
     }
 
-    // start wifi promicuous mode
+    // start wifi promicuous mode, letting the driver drop the frame types that aren't wanted
+    static const uint32_t filter_masks[] = {
+        WIFI_PROMIS_FILTER_MASK_MGMT,
+        WIFI_PROMIS_FILTER_MASK_CTRL,
+        WIFI_PROMIS_FILTER_MASK_DATA,
+    };
     wifi_promiscuous_filter_t wifi_filter = {
-        .filter_mask = WIFI_PROMIS_FILTER_MASK_MGMT,
+        .filter_mask = frame_type < 0 ?
+            WIFI_PROMIS_FILTER_MASK_MGMT | WIFI_PROMIS_FILTER_MASK_CTRL | WIFI_PROMIS_FILTER_MASK_DATA :
+            filter_masks[frame_type],
     };
     esp_wifi_set_promiscuous_filter(&wifi_filter);
+    if (wifi_filter.filter_mask & WIFI_PROMIS_FILTER_MASK_CTRL) {
+        wifi_promiscuous_filter_t ctrl_filter = {
+            .filter_mask = WIFI_PROMIS_CTRL_FILTER_MASK_ALL,
+        };
+        esp_wifi_set_promiscuous_ctrl_filter(&ctrl_filter);
+    }
     esp_wifi_set_promiscuous_rx_cb(wifi_monitor_cb);
     if (esp_wifi_set_promiscuous(true) != ESP_OK) {
+        self->ring = NULL;
         mp_raise_RuntimeError(monitor_mode_init_error);
     }
     esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE);
@@ -113,15 +192,8 @@ void common_hal_wifi_monitor_deinit(wifi_monitor_obj_t *self) {
     // disable wifi promiscuous mode
     esp_wifi_set_promiscuous(false);
 
-    // make sure to free all resources in the left items
-    UBaseType_t left_items = uxQueueMessagesWaiting(self->queue);
-    monitor_packet_t packet;
-    while (left_items--) {
-        xQueueReceive(self->queue, &packet, MONITOR_QUEUE_TIMEOUT_TICK);
-        free(packet.payload);
-    }
-    vQueueDelete(self->queue);
-    self->queue = NULL;
+    // the ring is freed along with the rest of the heap
+    self->ring = NULL;
 }
 
 void common_hal_wifi_monitor_set_channel(wifi_monitor_obj_t *self, uint8_t channel) {
@@ -138,32 +210,53 @@ mp_obj_t common_hal_wifi_monitor_get_queue(wifi_monitor_obj_t *self) {
 }
 
 mp_obj_t common_hal_wifi_monitor_get_lost(wifi_monitor_obj_t *self) {
+    portENTER_CRITICAL(&self->ring_lock);
     size_t lost = self->lost;
     self->lost = 0;
+    portEXIT_CRITICAL(&self->ring_lock);
     return mp_obj_new_int_from_uint(lost);
 }
 
 mp_obj_t common_hal_wifi_monitor_get_queued(wifi_monitor_obj_t *self) {
-    return mp_obj_new_int_from_uint(uxQueueMessagesWaiting(self->queue));
+    return mp_obj_new_int_from_uint(self->queued);
 }
 
 mp_obj_t common_hal_wifi_monitor_get_packet(wifi_monitor_obj_t *self) {
-    monitor_packet_t packet;
-
-    if (xQueueReceive(self->queue, &packet, MONITOR_QUEUE_TIMEOUT_TICK) != pdTRUE) {
+    if (self->queued == 0) {
         return (mp_obj_t)&mp_const_empty_dict_obj;
     }
 
+    wifi_monitor_record_t record;
+    monitor_ring_copy(self, 0, &record, sizeof(record));
+    mp_obj_t raw = mp_obj_new_bytes_of_zeros(record.length);
+    monitor_ring_copy(self, sizeof(record), (uint8_t *)((mp_obj_str_t *)MP_OBJ_TO_PTR(raw))->data, record.length);
+    monitor_ring_release(self, sizeof(record) + record.length);
+
     mp_obj_dict_t *dict = MP_OBJ_TO_PTR(mp_obj_new_dict(4));
 
-    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_CH), MP_OBJ_NEW_SMALL_INT(packet.channel));
+    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_CH), MP_OBJ_NEW_SMALL_INT(record.channel));
 
-    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_LEN), MP_OBJ_NEW_SMALL_INT(packet.length));
+    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_LEN), MP_OBJ_NEW_SMALL_INT(record.frame_length));
 
-    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_RAW), mp_obj_new_bytes(packet.payload, packet.length));
-    free(packet.payload);
+    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_RAW), raw);
 
-    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_RSSI), MP_OBJ_NEW_SMALL_INT(packet.rssi));
+    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_RSSI), MP_OBJ_NEW_SMALL_INT(record.rssi));
 
     return MP_OBJ_FROM_PTR(dict);
 }
+
+size_t common_hal_wifi_monitor_readinto(wifi_monitor_obj_t *self, uint8_t *buf, size_t len) {
+    size_t written = 0;
+    while (self->queued > 0) {
+        wifi_monitor_record_t record;
+        monitor_ring_copy(self, 0, &record, sizeof(record));
+        size_t record_size = sizeof(record) + record.length;
+        if (written + record_size > len) {
+            break;
+        }
+        monitor_ring_copy(self, 0, buf + written, record_size);
+        monitor_ring_release(self, record_size);
+        written += record_size;
+    }
+    return written;
+}
@@ -30,12 +30,34 @@
 #include "py/obj.h"
 #include "components/esp_wifi/include/esp_wifi.h"
 
+// What precedes each captured frame in the ring, and in what readinto() returns.
+typedef struct __attribute__((packed)) {
+    uint16_t length;       // Bytes of the frame that follow.
+    uint16_t frame_length; // Length of the frame before it was cut to the snap length.
+    uint8_t channel;
+    int8_t rssi;
+    uint32_t timestamp;    // Microseconds, from the WiFi hardware.
+} wifi_monitor_record_t;
+
 typedef struct {
     mp_obj_base_t base;
     uint8_t channel;
     size_t lost;
     size_t queue_length;
-    QueueHandle_t queue;
+    // Records the WiFi task writes and readers take, end to end in a byte ring.
+    uint8_t *ring;
+    size_t ring_size;
+    size_t ring_read;  // Moved only by readers.
+    size_t ring_write; // Moved only by the WiFi task.
+    size_t ring_used;  // Changed only with ring_lock held.
+    size_t queued;     // Likewise.
+    portMUX_TYPE ring_lock;
+    // Frames are kept only if they match these, and are cut to snaplen bytes if that is not 0.
+    uint16_t snaplen;
+    int8_t frame_type;    // -1 for any.
+    int8_t frame_subtype; // -1 for any.
+    bool match_mac;
+    uint8_t mac[6];
 } wifi_monitor_obj_t;
 
 #endif // MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_WIFI_MONITOR_H
@@ -42,6 +42,7 @@
 
 #include "components/esp_wifi/include/esp_wifi.h"
 #include "components/lwip/include/apps/ping/ping_sock.h"
+#include "lwip/stats.h"
 
 #if CIRCUITPY_MDNS
 #include "components/mdns/include/mdns.h"
@@ -150,6 +151,66 @@ void common_hal_wifi_radio_set_tx_power(wifi_radio_obj_t *self, const mp_float_t
     esp_wifi_set_max_tx_power(tx_power * 4.0f);
 }
 
+wifi_power_management_t common_hal_wifi_radio_get_power_management(wifi_radio_obj_t *self) {
+    wifi_ps_type_t ps;
+    esp_err_t ret = esp_wifi_get_ps(&ps);
+    if (ret == ESP_OK) {
+        switch (ps) {
+            case WIFI_PS_MIN_MODEM:
+                return POWER_MANAGEMENT_MIN;
+            case WIFI_PS_MAX_MODEM:
+                return POWER_MANAGEMENT_MAX;
+            case WIFI_PS_NONE:
+                return POWER_MANAGEMENT_NONE;
+        }
+    }
+    return POWER_MANAGEMENT_UNKNOWN;
+}
+
+void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_power_management_t power_management) {
+    switch (power_management) {
+        case POWER_MANAGEMENT_MIN:
+            esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+            break;
+        case POWER_MANAGEMENT_MAX:
+            // listen_interval is how many beacons to sleep for in this mode.
+            esp_wifi_set_ps(WIFI_PS_MAX_MODEM);
+            break;
+        case POWER_MANAGEMENT_NONE:
+            esp_wifi_set_ps(WIFI_PS_NONE);
+            break;
+        default:
+            break;
+    }
+}
+
+mp_int_t common_hal_wifi_radio_get_listen_interval(wifi_radio_obj_t *self) {
+    // ESP-IDF uses 3 when the value is left at 0.
+    uint16_t listen_interval = self->sta_config.sta.listen_interval;
+    return listen_interval == 0 ? 3 : listen_interval;
+}
+
+void common_hal_wifi_radio_set_listen_interval(wifi_radio_obj_t *self, mp_int_t listen_interval) {
+    // Sent to the access point when the station connects.
+    self->sta_config.sta.listen_interval = mp_arg_validate_int_range(listen_interval, 1, 0xffff, MP_QSTR_listen_interval);
+}
+
+mp_int_t common_hal_wifi_radio_get_pbuf_pool_exhausted(wifi_radio_obj_t *self) {
+    #if LWIP_STATS && MEMP_STATS
+    return lwip_stats.memp[MEMP_PBUF_POOL]->err;
+    #else
+    mp_raise_NotImplementedError(NULL);
+    #endif
+}
+
+mp_int_t common_hal_wifi_radio_get_tcp_retransmits(wifi_radio_obj_t *self) {
+    #if LWIP_STATS && MIB2_STATS
+    return lwip_stats.mib2.tcpretranssegs;
+    #else
+    mp_raise_NotImplementedError(NULL);
+    #endif
+}
+
 mp_obj_t common_hal_wifi_radio_get_mac_address_ap(wifi_radio_obj_t *self) {
     uint8_t mac[MAC_ADDRESS_LENGTH];
     esp_wifi_get_mac(ESP_IF_WIFI_AP, mac);
@@ -0,0 +1,77 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdbool.h>
+
+#include "py/gc.h"
+#include "py/mpconfig.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#if defined(CONFIG_FREERTOS_UNICORE) && CONFIG_FREERTOS_UNICORE
+bool gc_port_start_mark_helper(void) {
+    return false;
+}
+
+void gc_port_finish_mark_helper(void) {
+}
+#else
+static TaskHandle_t mark_task = NULL;
+static SemaphoreHandle_t mark_done = NULL;
+
+static void mark_task_main(void *arg) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        gc_mark_helper();
+        xSemaphoreGive(mark_done);
+    }
+}
+
+bool gc_port_start_mark_helper(void) {
+    if (mark_task == NULL) {
+        if (mark_done == NULL) {
+            mark_done = xSemaphoreCreateBinary();
+            if (mark_done == NULL) {
+                return false;
+            }
+        }
+        // Pin the task to whichever core CircuitPython isn't running on.
+        if (xTaskCreatePinnedToCore(mark_task_main, "gc_mark", 2048, NULL,
+            CONFIG_PTHREAD_TASK_PRIO_DEFAULT, &mark_task, !xPortGetCoreID()) != pdPASS) {
+            mark_task = NULL;
+            return false;
+        }
+    }
+    xTaskNotifyGive(mark_task);
+    return true;
+}
+
+void gc_port_finish_mark_helper(void) {
+    xSemaphoreTake(mark_done, portMAX_DELAY);
+}
+#endif
@@ -35,6 +35,16 @@
 
 #define CIRCUITPY_DIGITALIO_HAVE_INPUT_ONLY (1)
 
+// PSRAM heaps are megabytes so allocation scans skip full chunks.
+#define MICROPY_GC_FREE_RUN_INDEX           (1)
+// Sweeping them takes long enough to be worth spreading out.
+#define MICROPY_GC_INCREMENTAL_SWEEP        (1)
+#define MICROPY_GC_MINOR_COLLECT            (1)
+// Long running devices end up with their free memory in small pieces. Only gc.compact()
+// compacts because ESP-IDF and DMA descriptors may hold buffers the collector can't see.
+#define MICROPY_GC_COMPACT                  (1)
+#define MICROPY_GC_STATS                    (1)
+
 #include "py/circuitpy_mpconfig.h"
 
 #if CIRCUITPY_BLEIO
@@ -55,8 +65,19 @@
     ESPNOW_ROOT_POINTERS
 
 #define MICROPY_NLR_SETJMP                  (1)
+
+#if CIRCUITPY_NATIVE_EMITTERS
+// Native code has to be copied out of the GC heap into executable memory.
+#include <stddef.h>
+#define MP_PLAT_COMMIT_EXEC(buf, len, reloc) esp_native_code_commit(buf, len, reloc)
+void *esp_native_code_commit(void *buf, size_t len, void *reloc);
+#endif
 #define CIRCUITPY_DEFAULT_STACK_SIZE        0x6000
 
+// The socket select task wakes a select.poll() sleep when a plain socket becomes readable.
+// Other streams, such as UARTs and TLS sockets, do not, so sleeps are kept short.
+#define CIRCUITPY_SELECT_IDLE_MAX_MS        (10)
+
 // Nearly all boards have this because it is used to enter the ROM bootloader.
 #ifndef CIRCUITPY_BOOT_BUTTON
   #ifdef CONFIG_IDF_TARGET_ESP32C3
@@ -9,6 +9,17 @@ LONGINT_IMPL = MPZ
 
 # Enable more features
 CIRCUITPY_FULL_BUILD ?= 1
+# CIRCUITPY_NATIVE_EMITTERS is off unless a board sets it. Native code is then copied into
+# IRAM, see native_code.c, and memory protection is turned off on the S2, S3 and C3. The C3's
+# RISC-V emitter is untested on hardware and mpy_ld.py can't link natmods for it.
+ifeq ($(IDF_TARGET),esp32c3)
+MPY_CROSS_NATIVE_ARCH ?= rv32imc
+else
+MPY_CROSS_NATIVE_ARCH ?= xtensawin
+endif
+
+# mbedtls is always linked, and ESP-IDF runs its AES on the AES peripheral.
+CIRCUITPY_AESIO_MBEDTLS ?= 1
 
 # These modules are implemented in ports/<port>/common-hal:
 CIRCUITPY_ALARM ?= 1
@@ -23,6 +34,7 @@ CIRCUITPY_AUDIOMP3 ?= 0
 CIRCUITPY_BLEIO ?= 1
 CIRCUITPY_BLEIO_HCI = 0
 CIRCUITPY_CANIO ?= 1
+CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE ?= 1
 CIRCUITPY_COUNTIO ?= 1
 CIRCUITPY_DUALBANK ?= 1
 CIRCUITPY_ESPCAMERA ?= 1
@@ -42,6 +54,10 @@ CIRCUITPY_TOUCHIO_USE_NATIVE ?= 1
 CIRCUITPY_WATCHDOG ?= 1
 CIRCUITPY_WIFI ?= 1
 
+# Run the VM functions marked PLACE_IN_ITCM from IRAM. IRAM and DRAM share SRAM
+# on the newer chips, so this costs a little heap.
+CIRCUITPY_ITCM_IN_IRAM ?= 1
+
 # Conditionally turn off modules/features
 ifeq ($(IDF_TARGET),esp32)
 # Modules
@@ -50,6 +66,8 @@ CIRCUITPY_PARALLELDISPLAY = 0
 CIRCUITPY_RGBMATRIX = 0
 # Features
 CIRCUITPY_USB = 0
+# IRAM is a separate, nearly full region on the ESP32.
+CIRCUITPY_ITCM_IN_IRAM = 0
 
 else ifeq ($(IDF_TARGET),esp32c3)
 # Modules
@@ -74,6 +92,9 @@ CIRCUITPY_BLEIO = 0
 else ifeq ($(IDF_TARGET),esp32s3)
 # Modules
 CIRCUITPY_PARALLELDISPLAY = 0
+# Features
+# The other core marks PSRAM heaps alongside the CircuitPython core.
+MICROPY_GC_PARALLEL_MARK ?= 1
 endif
 
 # No room for dualbank on boards with 2MB flash
@@ -51,10 +51,13 @@
 #include "common-hal/watchdog/WatchDogTimer.h"
 #include "common-hal/socketpool/Socket.h"
 #include "common-hal/wifi/__init__.h"
+#include "native_code.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/memory.h"
 #include "supervisor/shared/tick.h"
+#include "supervisor/trace.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/microcontroller/Processor.h"
 #include "shared-bindings/microcontroller/RunMode.h"
 #include "shared-bindings/rtc/__init__.h"
 #include "shared-bindings/socketpool/__init__.h"
@@ -91,6 +94,7 @@
 #include "soc/rtc_cntl_reg.h"
 
 #include "esp_debug_helpers.h"
+#include "hal/cpu_hal.h"
 
 #include "bootloader_flash_config.h"
 #include "esp_efuse.h"
@@ -106,6 +110,9 @@
 
 uint32_t *heap;
 uint32_t heap_size;
+#ifdef CONFIG_SPIRAM
+static bool heap_in_psram;
+#endif
 
 STATIC esp_timer_handle_t _tick_timer;
 STATIC esp_timer_handle_t _sleep_timer;
@@ -303,6 +310,7 @@ safe_mode_t port_init(void) {
         if (spiram_size > 0) {
             heap = (uint32_t *)heap_start;
             heap_size = (heap_end - heap_start) / sizeof(uint32_t);
+            heap_in_psram = true;
         } else {
             ESP_LOGE(TAG, "CONFIG_SPIRAM enabled but no spiram heap available");
         }
@@ -411,6 +419,10 @@ void reset_port(void) {
     watchdog_reset();
     #endif
 
+    #if CIRCUITPY_NATIVE_EMITTERS
+    esp_native_code_free_all();
+    #endif
+
     // Yield so the idle task can run and do any IDF cleanup needed.
     port_yield();
 }
@@ -427,6 +439,24 @@ void reset_cpu(void) {
     esp_restart();
 }
 
+#ifdef CONFIG_SPIRAM
+// The heap is in PSRAM when there is some, so keep the Python stack in internal RAM.
+static uint32_t *fast_pystack;
+static size_t fast_pystack_length;
+
+uint32_t *port_fast_pystack(size_t length) {
+    if (!heap_in_psram) {
+        return NULL;
+    }
+    if (length != fast_pystack_length) {
+        heap_caps_free(fast_pystack);
+        fast_pystack = heap_caps_malloc(length, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        fast_pystack_length = fast_pystack ? length : 0;
+    }
+    return fast_pystack;
+}
+#endif
+
 uint32_t *port_heap_get_bottom(void) {
     return heap;
 }
@@ -481,6 +511,16 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return all_subticks / 32;
 }
 
+#if CIRCUITPY_TRACE || CIRCUITPY_BENCHMARK
+uint32_t port_get_cycle_count(void) {
+    return cpu_hal_get_cycle_count();
+}
+
+uint32_t port_get_cycle_frequency(void) {
+    return common_hal_mcu_processor_get_frequency();
+}
+#endif
+
 // Enable 1/1024 second tick.
 void port_enable_tick(void) {
     esp_timer_start_periodic(_tick_timer, 1000000 / 1024);
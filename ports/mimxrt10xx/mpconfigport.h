@@ -52,6 +52,13 @@ extern uint8_t _ld_default_stack_size;
 #define MICROPY_PORT_ROOT_POINTERS \
     CIRCUITPY_COMMON_ROOT_POINTERS \
 
+#if CIRCUITPY_NATIVE_EMITTERS
+// Native code has to be copied out of the GC heap into ITCM to be executed.
+#include <stddef.h>
+#define MP_PLAT_COMMIT_EXEC(buf, len, reloc) imxrt_native_code_commit(buf, len, reloc)
+void *imxrt_native_code_commit(void *buf, size_t len, void *reloc);
+#endif
+
 // TODO:
 //    mp_obj_t playing_audio[AUDIO_DMA_CHANNEL_COUNT];
 
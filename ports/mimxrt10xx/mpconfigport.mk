@@ -11,6 +11,10 @@ CIRCUITPY_TUSB_MEM_ALIGN = 32
 
 INTERNAL_FLASH_FILESYSTEM = 1
 
+# CIRCUITPY_NATIVE_EMITTERS is off unless a board sets it. Native code is then copied into
+# ITCM, see native_code.c, and the ITCM stays writable.
+MPY_CROSS_NATIVE_ARCH ?= armv7emdp
+
 CIRCUITPY_AUDIOBUSIO ?= 1
 CIRCUITPY_AUDIOBUSIO_PDMIN = 0
 CIRCUITPY_AUDIOCORE ?= 1
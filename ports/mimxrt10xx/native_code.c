@@ -0,0 +1,63 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/persistentcode.h"
+#include "py/runtime.h"
+
+#include "fsl_device_registers.h"
+
+#include "native_code.h"
+
+// OCRAM, where the GC heap lives, is marked as not executable so native code is
+// copied into the part of ITCM that the linker script leaves unused. It is only
+// reclaimed when the VM is reset.
+extern uint32_t _ld_itcm_free_start;
+extern uint32_t _ld_itcm_free_end;
+
+static uint32_t *native_code_next = &_ld_itcm_free_start;
+
+void *imxrt_native_code_commit(void *buf, size_t len, void *reloc) {
+    size_t words = (len + 3) / 4;
+    if (words > (size_t)(&_ld_itcm_free_end - native_code_next)) {
+        m_malloc_fail(len);
+    }
+    uint32_t *p = native_code_next;
+    native_code_next += words;
+    if (reloc) {
+        mp_native_relocate(reloc, buf, (uintptr_t)p);
+    }
+    memcpy(p, buf, len);
+    // ITCM isn't cached but the writes must land before the code is fetched.
+    __DSB();
+    __ISB();
+    return p;
+}
+
+void imxrt_native_code_free_all(void) {
+    native_code_next = &_ld_itcm_free_start;
+}
@@ -44,6 +44,7 @@
 #include "common-hal/pwmio/PWMOut.h"
 #include "common-hal/rtc/RTC.h"
 #include "common-hal/busio/SPI.h"
+#include "native_code.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
 #if CIRCUITPY_PEW
@@ -265,9 +266,14 @@ __attribute__((used, naked, no_instrument_function, optimize("no-tree-loop-distr
     MPU->RASR = ARM_MPU_RASR(EXECUTION, ARM_MPU_AP_FULL, NORMAL, NOT_SHAREABLE, CACHEABLE, BUFFERABLE, subregion_mask, region_size);
 
     // This the ITCM. Set it to read-only because we've loaded everything already and it's easy to
-    // accidentally write the wrong value to 0x00000000 (aka NULL).
+    // accidentally write the wrong value to 0x00000000 (aka NULL). Native code is copied into it at
+    // runtime though, so then it has to stay writable.
     MPU->RBAR = ARM_MPU_RBAR(12, 0x00000000U);
+    #if CIRCUITPY_NATIVE_EMITTERS
+    MPU->RASR = ARM_MPU_RASR(EXECUTION, ARM_MPU_AP_FULL, NORMAL, NOT_SHAREABLE, CACHEABLE, BUFFERABLE, NO_SUBREGIONS, ARM_MPU_REGION_SIZE_32KB);
+    #else
     MPU->RASR = ARM_MPU_RASR(EXECUTION, ARM_MPU_AP_RO, NORMAL, NOT_SHAREABLE, CACHEABLE, BUFFERABLE, NO_SUBREGIONS, ARM_MPU_REGION_SIZE_32KB);
+    #endif
 
     // This the DTCM.
     MPU->RBAR = ARM_MPU_RBAR(13, 0x20000000U);
@@ -476,6 +482,10 @@ void reset_port(void) {
     pew_reset();
     #endif
 
+    #if CIRCUITPY_NATIVE_EMITTERS
+    imxrt_native_code_free_all();
+    #endif
+
     // reset_event_system();
 
     reset_all_pins();
@@ -43,6 +43,7 @@
 #include "supervisor/port.h"
 #include "supervisor/serial.h"  // serial_connected()
 #include "supervisor/qspi_flash.h"
+#include "supervisor/shared/tick.h"
 
 #include "nrf.h"
 #include "nrf_power.h"
@@ -200,7 +201,7 @@ STATIC void system_on_idle_until_alarm(int64_t timediff_ms, bool wake_from_seria
             port_interrupt_after_ticks(remaining);
         }
         // Idle until an interrupt happens.
-        port_idle_until_interrupt();
+        supervisor_idle_until_interrupt();
         if (have_timeout) {
             remaining = end_tick - port_get_raw_ticks(NULL);
             if (remaining <= 0) {
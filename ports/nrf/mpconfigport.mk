@@ -12,6 +12,9 @@ USB_NUM_ENDPOINT_PAIRS = 8
 # All nRF ports have longints.
 LONGINT_IMPL = MPZ
 
+# Architecture for frozen native and viper modules.
+MPY_CROSS_NATIVE_ARCH ?= armv7emsp
+
 # The ?='s allow overriding in mpconfigboard.mk.
 
 # Audio via PWM
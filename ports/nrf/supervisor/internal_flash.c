@@ -89,6 +89,10 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t n
     return 0; // success
 }
 
+const void *supervisor_flash_get_block_address(uint32_t block) {
+    return (void *)lba2addr(block);
+}
+
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32_t num_blocks) {
     while (num_blocks) {
         uint32_t const addr = lba2addr(lba);
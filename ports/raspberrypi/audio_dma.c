@@ -32,6 +32,13 @@
 #include "bindings/rp2pio/StateMachine.h"
 #include "supervisor/background_callback.h"
 
+#if CIRCUITPY_AUDIO_CORE1
+#include "shared-bindings/audiomixer/Mixer.h"
+#include "shared-bindings/synthio/MidiTrack.h"
+#include "shared-bindings/synthio/Synthesizer.h"
+#include "shared-module/audiomixer/MixerVoice.h"
+#endif
+
 #include "py/mpstate.h"
 #include "py/runtime.h"
 
@@ -120,36 +127,59 @@ STATIC size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
     return output_length_used;
 }
 
+// Reads the next block of the sample into dma->buffer[buffer_idx], converting
+// it as necessary. Returns false if the sample had an error, which the caller
+// handles by stopping playback.
+STATIC bool audio_dma_read_block(audio_dma_t *dma, size_t buffer_idx,
+    audioio_get_buffer_result_t *get_buffer_result, uint8_t **output_buffer, size_t *output_length_used) {
+    uint8_t *sample_buffer;
+    uint32_t sample_buffer_length;
+    *get_buffer_result = audiosample_get_buffer(dma->sample,
+        dma->single_channel_output, dma->audio_channel, &sample_buffer, &sample_buffer_length);
+
+    if (*get_buffer_result == GET_BUFFER_ERROR) {
+        return false;
+    }
+
+    if (dma->passthrough) {
+        // The sample is already in the output format. It fills its two buffers
+        // in turn, so the one handed back now isn't the one still being played.
+        *output_buffer = sample_buffer;
+        *output_length_used = sample_buffer_length;
+    } else {
+        // Convert the sample format resolution and signedness, as necessary.
+        // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
+        // The output buffer is one of the DMA buffers (passed in).
+        *output_buffer = dma->buffer[buffer_idx];
+        *output_length_used = audio_dma_convert_samples(
+            dma, sample_buffer, sample_buffer_length,
+            dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+    }
+    return true;
+}
+
 // buffer_idx is 0 or 1.
 STATIC void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
     size_t dma_channel = dma->channel[buffer_idx];
 
     audioio_get_buffer_result_t get_buffer_result;
-    uint8_t *sample_buffer;
-    uint32_t sample_buffer_length;
-    get_buffer_result = audiosample_get_buffer(dma->sample,
-        dma->single_channel_output, dma->audio_channel, &sample_buffer, &sample_buffer_length);
-
-    if (get_buffer_result == GET_BUFFER_ERROR) {
+    uint8_t *output_buffer;
+    size_t output_length_used;
+    if (!audio_dma_read_block(dma, buffer_idx, &get_buffer_result, &output_buffer, &output_length_used)) {
         audio_dma_stop(dma);
         return;
     }
+    dma->channel_buffer[buffer_idx] = buffer_idx;
+    dma->buffer_used[buffer_idx] = output_length_used;
 
-    // Convert the sample format resolution and signedness, as necessary.
-    // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
-    // The output buffer is one of the DMA buffers (passed in).
-
-    size_t output_length_used = audio_dma_convert_samples(
-        dma, sample_buffer, sample_buffer_length,
-        dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
-
-    dma_channel_set_read_addr(dma_channel, dma->buffer[buffer_idx], false /* trigger */);
+    dma_channel_set_read_addr(dma_channel, output_buffer, false /* trigger */);
     dma_channel_set_trans_count(dma_channel, output_length_used / dma->output_size, false /* trigger */);
 
     if (get_buffer_result == GET_BUFFER_DONE) {
         if (dma->loop) {
             audiosample_reset_buffer(dma->sample, dma->single_channel_output, dma->audio_channel);
         } else {
+            dma->sample_done = true;
             // Set channel trigger to ourselves so we don't keep going.
             dma_channel_hw_t *c = &dma_hw->ch[dma_channel];
             c->al1_ctrl =
@@ -167,6 +197,178 @@ STATIC void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
     }
 }
 
+// With more than two buffers, the ones not being played by a DMA channel form
+// a ring. The background fills it, and the DMA interrupt hands the next block
+// in it to the channel that just finished, so playback carries on through VM
+// pauses for as long as the ring lasts.
+//
+// Fills up to count buffers from ring_write on. When publish is true each one is
+// handed to the interrupt as soon as it is filled. Otherwise the caller hands
+// over the filled ones later, which lets the second core do this without
+// touching anything the interrupt reads. ended is set when a sample that
+// doesn't loop has given its last block. Returns false if the sample had an
+// error.
+STATIC bool audio_dma_render_ring(audio_dma_t *dma, size_t count, bool publish, size_t *filled, bool *ended) {
+    bool reset = false;
+    *filled = 0;
+    *ended = false;
+    while (!*ended && *filled < count) {
+        size_t buffer_idx = dma->ring_write;
+        audioio_get_buffer_result_t get_buffer_result;
+        uint8_t *output_buffer;
+        size_t output_length_used;
+        if (!audio_dma_read_block(dma, buffer_idx, &get_buffer_result, &output_buffer, &output_length_used)) {
+            return false;
+        }
+        if (get_buffer_result == GET_BUFFER_DONE) {
+            if (dma->loop) {
+                audiosample_reset_buffer(dma->sample, dma->single_channel_output, dma->audio_channel);
+            } else {
+                *ended = true;
+            }
+        }
+        if (output_length_used == 0) {
+            // A looping sample may give back an empty block before it starts
+            // again, but don't spin on one that is always empty.
+            if (get_buffer_result == GET_BUFFER_DONE && dma->loop && !reset) {
+                reset = true;
+                continue;
+            }
+            break;
+        }
+        dma->buffer_used[buffer_idx] = output_length_used;
+        dma->ring_write = (buffer_idx + 1) % dma->buffer_count;
+        *filled += 1;
+        if (publish) {
+            common_hal_mcu_disable_interrupts();
+            dma->ring_filled += 1;
+            common_hal_mcu_enable_interrupts();
+        }
+    }
+    return true;
+}
+
+STATIC void audio_dma_fill_ring(audio_dma_t *dma) {
+    if (dma->sample_done) {
+        return;
+    }
+    size_t filled;
+    bool ended;
+    bool ok = audio_dma_render_ring(dma, dma->buffer_count - 2 - dma->ring_filled, true, &filled, &ended);
+    if (ended) {
+        dma->sample_done = true;
+    }
+    if (!ok) {
+        audio_dma_stop(dma);
+    }
+}
+
+#if CIRCUITPY_AUDIO_CORE1
+// Samples that only read memory can be rendered on the second core. Files can't
+// be read there because the filesystem is only safe to use from this core.
+STATIC bool audio_dma_sample_in_ram(mp_obj_t sample) {
+    if (mp_obj_is_type(sample, &audioio_rawsample_type)) {
+        return true;
+    }
+    #if CIRCUITPY_SYNTHIO
+    if (mp_obj_is_type(sample, &synthio_synthesizer_type) ||
+        mp_obj_is_type(sample, &synthio_miditrack_type)) {
+        return true;
+    }
+    #endif
+    #if CIRCUITPY_AUDIOMIXER
+    if (mp_obj_is_type(sample, &audiomixer_mixer_type)) {
+        audiomixer_mixer_obj_t *mixer = MP_OBJ_TO_PTR(sample);
+        for (size_t i = 0; i < mixer->voice_count; i++) {
+            audiomixer_mixervoice_obj_t *voice = MP_OBJ_TO_PTR(mixer->voice[i]);
+            if (voice->sample != NULL && !audio_dma_sample_in_ram(voice->sample)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    #endif
+    return false;
+}
+
+STATIC void audio_dma_render_job(void *arg) {
+    audio_dma_t *dma = arg;
+    size_t filled;
+    dma->render_error = !audio_dma_render_ring(dma, dma->render_count, false, &filled, &dma->render_ended);
+    dma->rendered = filled;
+}
+
+// Hands filling the ring to the second core. It finishes before the VM runs
+// again, in audio_dma_finish_renders, so Python can't change the sample while
+// it is read. Meanwhile this core gets on with the other background tasks.
+STATIC bool audio_dma_start_render(audio_dma_t *dma) {
+    if (dma->sample_done || !audio_dma_sample_in_ram(dma->sample)) {
+        return false;
+    }
+    dma->render_count = dma->buffer_count - 2 - dma->ring_filled;
+    if (dma->render_count == 0) {
+        return true;
+    }
+    dma->render_job.fun = audio_dma_render_job;
+    dma->render_job.arg = dma;
+    dma->render_pending = core1_worker_submit(&dma->render_job);
+    return dma->render_pending;
+}
+
+STATIC void audio_dma_finish_render(audio_dma_t *dma) {
+    core1_worker_wait(&dma->render_job);
+    dma->render_pending = false;
+    common_hal_mcu_disable_interrupts();
+    dma->ring_filled += dma->rendered;
+    common_hal_mcu_enable_interrupts();
+    if (dma->render_ended) {
+        dma->sample_done = true;
+    }
+    if (dma->render_error) {
+        audio_dma_stop(dma);
+    } else if (dma->sample_done && dma->ring_filled == 0 &&
+               !dma_channel_is_busy(dma->channel[0]) &&
+               !dma_channel_is_busy(dma->channel[1])) {
+        audio_dma_stop(dma);
+    }
+}
+
+void audio_dma_finish_renders(void) {
+    for (size_t channel = 0; channel < NUM_DMA_CHANNELS; channel++) {
+        audio_dma_t *dma = MP_STATE_PORT(playing_audio)[channel];
+        if (dma != NULL && dma->render_pending) {
+            audio_dma_finish_render(dma);
+        }
+    }
+}
+#endif
+
+// Called from the DMA interrupt when channel_idx has finished its block. The
+// other channel is playing its block by now.
+STATIC void audio_dma_ring_next(audio_dma_t *dma, size_t channel_idx) {
+    size_t dma_channel = dma->channel[channel_idx];
+    size_t buffer_idx = dma->channel_buffer[channel_idx];
+    if (dma->ring_filled > 0) {
+        buffer_idx = dma->ring_read;
+        dma->ring_read = (buffer_idx + 1) % dma->buffer_count;
+        dma->ring_filled -= 1;
+        dma->channel_buffer[channel_idx] = buffer_idx;
+    } else if (dma->sample_done) {
+        // Let the other channel play the last block without chaining back here.
+        size_t other_channel = dma->channel[1 - channel_idx];
+        dma_channel_hw_t *c = &dma_hw->ch[other_channel];
+        c->al1_ctrl =
+            (c->al1_ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) |
+            (other_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB);
+        return;
+    } else {
+        // Play the same block again rather than reading past its end.
+        dma->underruns += 1;
+    }
+    dma_channel_set_read_addr(dma_channel, dma->buffer[buffer_idx], false /* trigger */);
+    dma_channel_set_trans_count(dma_channel, dma->buffer_used[buffer_idx] / dma->output_size, false /* trigger */);
+}
+
 // Playback should be shutdown before calling this.
 audio_dma_result audio_dma_setup_playback(
     audio_dma_t *dma,
@@ -227,16 +429,22 @@ audio_dma_result audio_dma_setup_playback(
         max_buffer_length /= dma->sample_spacing;
     }
 
-    dma->buffer[0] = (uint8_t *)m_realloc(dma->buffer[0], max_buffer_length);
-    dma->buffer_length[0] = max_buffer_length;
-    if (dma->buffer[0] == NULL) {
-        return AUDIO_DMA_MEMORY_ERROR;
-    }
-
-    if (!single_buffer) {
-        dma->buffer[1] = (uint8_t *)m_realloc(dma->buffer[1], max_buffer_length);
-        dma->buffer_length[1] = max_buffer_length;
-        if (dma->buffer[1] == NULL) {
+    dma->ring = !single_buffer && dma->buffer_count > 2;
+
+    // A double buffered sample that already matches the output is played from
+    // its own buffers without copying. Single buffered samples are still
+    // copied because the DMA chaining below loops over dma->buffer[0], and
+    // the ring needs more buffers than the sample has.
+    dma->passthrough = !single_buffer && !dma->ring &&
+        output_signed == samples_signed &&
+        dma->sample_spacing == 1 &&
+        dma->sample_resolution == dma->output_resolution;
+
+    size_t buffer_count = single_buffer ? 1 : dma->ring ? dma->buffer_count : 2;
+    for (size_t i = 0; i < buffer_count && !dma->passthrough; i++) {
+        dma->buffer[i] = (uint8_t *)m_realloc(dma->buffer[i], max_buffer_length);
+        dma->buffer_length[i] = max_buffer_length;
+        if (dma->buffer[i] == NULL) {
             return AUDIO_DMA_MEMORY_ERROR;
         }
     }
@@ -279,11 +487,20 @@ audio_dma_result audio_dma_setup_playback(
     MP_STATE_PORT(playing_audio)[dma->channel[0]] = dma;
     MP_STATE_PORT(playing_audio)[dma->channel[1]] = dma;
 
-    // Load the first two blocks up front.
+    // Load the first two blocks up front, and fill the ring behind them.
+    dma->sample_done = false;
     audio_dma_load_next_block(dma, 0);
     if (!single_buffer) {
         audio_dma_load_next_block(dma, 1);
     }
+    if (dma->ring) {
+        dma->ring_read = 2;
+        dma->ring_write = 2;
+        dma->ring_filled = 0;
+        audio_dma_fill_ring(dma);
+    }
+    dma->underruns = 0;
+    dma->late_fills = 0;
 
     // Special case the DMA for a single buffer. It's commonly used for a single wave length of sound
     // and may be short. Therefore, we use DMA chaining to loop quickly without involving interrupts.
@@ -316,6 +533,12 @@ audio_dma_result audio_dma_setup_playback(
 }
 
 void audio_dma_stop(audio_dma_t *dma) {
+    #if CIRCUITPY_AUDIO_CORE1
+    if (dma->render_pending) {
+        core1_worker_wait(&dma->render_job);
+        dma->render_pending = false;
+    }
+    #endif
     // Disable our interrupts.
     uint32_t channel_mask = 0;
     if (dma->channel[0] < NUM_DMA_CHANNELS) {
@@ -389,19 +612,36 @@ bool audio_dma_get_paused(audio_dma_t *dma) {
 }
 
 void audio_dma_init(audio_dma_t *dma) {
-    dma->buffer[0] = NULL;
-    dma->buffer[1] = NULL;
+    for (size_t i = 0; i < AUDIO_DMA_MAX_BUFFERS; i++) {
+        dma->buffer[i] = NULL;
+    }
+    dma->buffer_count = 2;
 
     dma->channel[0] = NUM_DMA_CHANNELS;
     dma->channel[1] = NUM_DMA_CHANNELS;
 }
 
 void audio_dma_deinit(audio_dma_t *dma) {
-    m_free(dma->buffer[0]);
-    dma->buffer[0] = NULL;
+    for (size_t i = 0; i < AUDIO_DMA_MAX_BUFFERS; i++) {
+        m_free(dma->buffer[i]);
+        dma->buffer[i] = NULL;
+    }
+}
+
+void audio_dma_set_buffer_count(audio_dma_t *dma, uint8_t buffer_count) {
+    dma->buffer_count = buffer_count;
+}
 
-    m_free(dma->buffer[1]);
-    dma->buffer[1] = NULL;
+uint8_t audio_dma_get_buffer_count(audio_dma_t *dma) {
+    return dma->buffer_count;
+}
+
+uint32_t audio_dma_get_underruns(audio_dma_t *dma) {
+    return dma->underruns;
+}
+
+uint32_t audio_dma_get_late_fills(audio_dma_t *dma) {
+    return dma->late_fills;
 }
 
 bool audio_dma_get_playing(audio_dma_t *dma) {
@@ -426,6 +666,26 @@ STATIC void dma_callback_fun(void *arg) {
     dma->channels_to_load_mask = 0;
     common_hal_mcu_enable_interrupts();
 
+    if (dma->ring) {
+        if (dma->ring_filled == 0 && !dma->sample_done) {
+            // Nothing is queued behind the block being played.
+            dma->late_fills += 1;
+        }
+        #if CIRCUITPY_AUDIO_CORE1
+        if (dma->render_pending || audio_dma_start_render(dma)) {
+            return;
+        }
+        #endif
+        // The interrupt has already queued the next blocks.
+        audio_dma_fill_ring(dma);
+        if (dma->sample_done && dma->ring_filled == 0 &&
+            !dma_channel_is_busy(dma->channel[0]) &&
+            !dma_channel_is_busy(dma->channel[1])) {
+            audio_dma_stop(dma);
+        }
+        return;
+    }
+
     // Load the blocks for the requested channels.
     uint32_t channel = 0;
     while (channels_to_load_mask) {
@@ -455,9 +715,12 @@ void isr_dma_0(void) {
         dma_hw->ints0 = mask;
         if (MP_STATE_PORT(playing_audio)[i] != NULL) {
             audio_dma_t *dma = MP_STATE_PORT(playing_audio)[i];
+            if (dma->ring) {
+                audio_dma_ring_next(dma, dma->channel[0] == i ? 0 : 1);
+            }
             // Record all channels whose DMA has completed; they need loading.
             dma->channels_to_load_mask |= mask;
-            background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
+            background_callback_add_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_REALTIME, 0);
         }
         if (MP_STATE_PORT(background_pio)[i] != NULL) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio)[i];
@@ -30,16 +30,35 @@
 #include "py/obj.h"
 #include "supervisor/background_callback.h"
 
+#if CIRCUITPY_AUDIO_CORE1
+#include "core1_worker.h"
+#endif
+
 #include "src/rp2_common/hardware_dma/include/hardware/dma.h"
 
+// Most buffers one playback can use. Two are being played by the DMA channels
+// at any time, and the rest are filled ahead of them.
+#define AUDIO_DMA_MAX_BUFFERS (8)
+
 typedef struct {
     mp_obj_t sample;
-    uint8_t *buffer[2];
-    size_t buffer_length[2];
+    uint8_t *buffer[AUDIO_DMA_MAX_BUFFERS];
+    size_t buffer_length[AUDIO_DMA_MAX_BUFFERS];
+    size_t buffer_used[AUDIO_DMA_MAX_BUFFERS]; // in bytes, when using the ring
     uint32_t channels_to_load_mask;
+    uint32_t underruns; // blocks replayed because the next wasn't ready
+    uint32_t late_fills; // fills started with nothing queued behind the DMA
     uint32_t output_register_address;
     background_callback_t callback;
+    #if CIRCUITPY_AUDIO_CORE1
+    core1_worker_job_t render_job;
+    #endif
     uint8_t channel[2];
+    uint8_t channel_buffer[2]; // buffer each channel is playing, when using the ring
+    uint8_t buffer_count;
+    uint8_t ring_read; // next filled buffer to hand to the DMA
+    uint8_t ring_write; // next buffer to fill
+    volatile uint8_t ring_filled; // filled buffers not handed to the DMA yet
     uint8_t audio_channel;
     uint8_t output_size;
     uint8_t sample_spacing;
@@ -50,7 +69,17 @@ typedef struct {
     bool signed_to_unsigned;
     bool unsigned_to_signed;
     bool output_signed;
+    bool passthrough; // DMA straight from the sample's own buffers
+    bool ring; // more than two buffers, handed to the DMA from its interrupt
+    bool sample_done;
     bool playing_in_progress;
+    #if CIRCUITPY_AUDIO_CORE1
+    uint8_t render_count; // ring buffers the second core may fill
+    uint8_t rendered; // filled by the second core, not handed to the interrupt yet
+    bool render_pending;
+    bool render_ended;
+    bool render_error;
+    #endif
 } audio_dma_t;
 
 typedef enum {
@@ -89,4 +118,17 @@ void audio_dma_pause(audio_dma_t *dma);
 void audio_dma_resume(audio_dma_t *dma);
 bool audio_dma_get_paused(audio_dma_t *dma);
 
+// The number of buffers to use, from 2 to AUDIO_DMA_MAX_BUFFERS. It takes
+// effect the next time playback is set up.
+void audio_dma_set_buffer_count(audio_dma_t *dma, uint8_t buffer_count);
+uint8_t audio_dma_get_buffer_count(audio_dma_t *dma);
+
+#if CIRCUITPY_AUDIO_CORE1
+// Hands over the blocks the second core rendered during this pass of background tasks.
+void audio_dma_finish_renders(void);
+#endif
+// Counts since playback was last set up.
+uint32_t audio_dma_get_underruns(audio_dma_t *dma);
+uint32_t audio_dma_get_late_fills(audio_dma_t *dma);
+
 #endif  // MICROPY_INCLUDED_RASPBERRYPI_AUDIO_DMA_OUT_H
@@ -28,6 +28,14 @@
 #include "py/runtime.h"
 #include "supervisor/port.h"
 
+#if CIRCUITPY_NVM
+#include "shared-bindings/nvm/ByteArray.h"
+#endif
+
+#if CIRCUITPY_ROTARYIO
+#include "common-hal/rotaryio/IncrementalEncoder.h"
+#endif
+
 void port_start_background_tick(void) {
 }
 
@@ -35,6 +43,12 @@ void port_finish_background_tick(void) {
 }
 
 void port_background_tick(void) {
+    #if CIRCUITPY_NVM
+    nvm_bytearray_background();
+    #endif
+    #if CIRCUITPY_ROTARYIO
+    incrementalencoder_background();
+    #endif
 }
 
 void port_background_task(void) {
@@ -45,6 +45,15 @@ void bindings_cyw43_wifi_enforce_pm() {
     cyw43_wifi_pm(&cyw43_state, power_management_value);
 }
 
+int bindings_cyw43_get_power_management(void) {
+    return power_management_value;
+}
+
+void bindings_cyw43_set_power_management(int value) {
+    power_management_value = value;
+    bindings_cyw43_wifi_enforce_pm();
+}
+
 //| class CywPin:
 //|     """A class that represents a GPIO pin attached to the wifi chip.
 //|
@@ -102,8 +111,7 @@ const mp_obj_type_t cyw43_pin_type = {
 //|
 STATIC mp_obj_t cyw43_set_power_management(const mp_obj_t value_in) {
     mp_int_t value = mp_obj_get_int(value_in);
-    power_management_value = value;
-    bindings_cyw43_wifi_enforce_pm();
+    bindings_cyw43_set_power_management(value);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(cyw43_set_power_management_obj, cyw43_set_power_management);
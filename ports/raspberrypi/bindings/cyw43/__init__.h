@@ -52,4 +52,6 @@ const mcu_pin_obj_t *validate_obj_is_pin_including_cyw43(mp_obj_t obj, qstr arg_
 #define PM_DISABLED CONSTANT_CYW43_PM_VALUE(CYW43_NO_POWERSAVE_MODE, 200, 1, 1, 10)
 
 extern void bindings_cyw43_wifi_enforce_pm(void);
+extern int bindings_cyw43_get_power_management(void);
+extern void bindings_cyw43_set_power_management(int value);
 void cyw43_enter_deep_sleep(void);
@@ -50,6 +50,7 @@
 //|         blue_dp: microcontroller.Pin,
 //|         blue_dn: microcontroller.Pin,
 //|         color_depth: int = 8,
+//|         double_buffer: bool = False,
 //|     ) -> None:
 //|         """Create a Framebuffer object with the given dimensions. Memory is
 //|         allocated outside of onto the heap and then moved outside on VM end.
@@ -80,6 +81,12 @@
 //|         A Framebuffer is often used in conjunction with a
 //|         `framebufferio.FramebufferDisplay`.
 //|
+//|         With ``double_buffer``, a second framebuffer is allocated so that drawing
+//|         never touches the one being scanned out. `framebufferio.FramebufferDisplay`
+//|         refreshes draw into the back buffer and then `swap` it in, which avoids
+//|         tearing. This doubles the memory used, so it is only practical for color
+//|         framebuffers.
+//|
 //|         :param int width: the width of the target display signal. Only 320, 400, 640 or 800 is currently supported depending on color_depth.
 //|         :param int height: the height of the target display signal. Only 240 or 480 is currently supported depending on color_depth.
 //|         :param ~microcontroller.Pin clk_dp: the positive clock signal pin
@@ -92,11 +99,12 @@
 //|         :param ~microcontroller.Pin blue_dn: the negative blue signal pin
 //|         :param int color_depth: the color depth of the framebuffer in bits. 1, 2 for grayscale
 //|           and 8 or 16 for color
+//|         :param bool double_buffer: allocate a back buffer for tear-free updates
 //|         """
 
 STATIC mp_obj_t picodvi_framebuffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_width, ARG_height, ARG_clk_dp, ARG_clk_dn, ARG_red_dp, ARG_red_dn, ARG_green_dp,
-           ARG_green_dn, ARG_blue_dp, ARG_blue_dn, ARG_color_depth };
+           ARG_green_dn, ARG_blue_dp, ARG_blue_dn, ARG_color_depth, ARG_double_buffer };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED },
         { MP_QSTR_height, MP_ARG_INT | MP_ARG_REQUIRED },
@@ -111,6 +119,7 @@ STATIC mp_obj_t picodvi_framebuffer_make_new(const mp_obj_type_t *type, size_t n
         { MP_QSTR_blue_dn, MP_ARG_KW_ONLY | MP_ARG_OBJ | MP_ARG_REQUIRED },
 
         { MP_QSTR_color_depth, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 8} },
+        { MP_QSTR_double_buffer, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -134,7 +143,8 @@ STATIC mp_obj_t picodvi_framebuffer_make_new(const mp_obj_type_t *type, size_t n
         validate_obj_is_free_pin(args[ARG_green_dn].u_obj, MP_QSTR_green_dn),
         validate_obj_is_free_pin(args[ARG_blue_dp].u_obj, MP_QSTR_blue_dp),
         validate_obj_is_free_pin(args[ARG_blue_dn].u_obj, MP_QSTR_blue_dn),
-        color_depth);
+        color_depth,
+        args[ARG_double_buffer].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -171,7 +181,6 @@ MP_PROPERTY_GETTER(picodvi_framebuffer_width_obj,
 
 //|     height: int
 //|     """The width of the framebuffer, in pixels. It may be doubled for output."""
-//|
 STATIC mp_obj_t picodvi_framebuffer_get_height(mp_obj_t self_in) {
     picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
     check_for_deinit(self);
@@ -182,11 +191,40 @@ MP_DEFINE_CONST_FUN_OBJ_1(picodvi_framebuffer_get_height_obj, picodvi_framebuffe
 MP_PROPERTY_GETTER(picodvi_framebuffer_height_obj,
     (mp_obj_t)&picodvi_framebuffer_get_height_obj);
 
+//|     double_buffer: bool
+//|     """True when the framebuffer has a back buffer for drawing. (read only)"""
+STATIC mp_obj_t picodvi_framebuffer_get_double_buffer(mp_obj_t self_in) {
+    picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_picodvi_framebuffer_get_double_buffer(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(picodvi_framebuffer_get_double_buffer_obj, picodvi_framebuffer_get_double_buffer);
+
+MP_PROPERTY_GETTER(picodvi_framebuffer_double_buffer_obj,
+    (mp_obj_t)&picodvi_framebuffer_get_double_buffer_obj);
+
+//|     def swap(self) -> None:
+//|         """Show the back buffer from the start of the next frame and wait until it is
+//|         being scanned out. The buffer protocol then refers to the previously shown
+//|         buffer, which holds the frame before the one just swapped in. Does nothing
+//|         when the framebuffer is not double buffered."""
+//|         ...
+//|
+STATIC mp_obj_t picodvi_framebuffer_swap(mp_obj_t self_in) {
+    picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    check_for_deinit(self);
+    common_hal_picodvi_framebuffer_swap(self, NULL);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(picodvi_framebuffer_swap_obj, picodvi_framebuffer_swap);
+
 STATIC const mp_rom_map_elem_t picodvi_framebuffer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&picodvi_framebuffer_deinit_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&picodvi_framebuffer_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&picodvi_framebuffer_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_double_buffer), MP_ROM_PTR(&picodvi_framebuffer_double_buffer_obj) },
+    { MP_ROM_QSTR(MP_QSTR_swap), MP_ROM_PTR(&picodvi_framebuffer_swap_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(picodvi_framebuffer_locals_dict, picodvi_framebuffer_locals_dict_table);
 
@@ -197,8 +235,8 @@ STATIC void picodvi_framebuffer_get_bufinfo(mp_obj_t self_in, mp_buffer_info_t *
 // These versions exist so that the prototype matches the protocol,
 // avoiding a type cast that can hide errors
 STATIC void picodvi_framebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmap) {
-    (void)dirty_row_bitmap;
     common_hal_picodvi_framebuffer_refresh(self_in);
+    common_hal_picodvi_framebuffer_swap(self_in, dirty_row_bitmap);
 }
 
 STATIC void picodvi_framebuffer_deinit_proto(mp_obj_t self_in) {
@@ -38,10 +38,14 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
     const mcu_pin_obj_t *red_dp, const mcu_pin_obj_t *red_dn,
     const mcu_pin_obj_t *green_dp, const mcu_pin_obj_t *green_dn,
     const mcu_pin_obj_t *blue_dp, const mcu_pin_obj_t *blue_dn,
-    mp_uint_t color_depth);
+    mp_uint_t color_depth, bool double_buffer);
 void common_hal_picodvi_framebuffer_deinit(picodvi_framebuffer_obj_t *self);
 bool common_hal_picodvi_framebuffer_deinited(picodvi_framebuffer_obj_t *self);
 void common_hal_picodvi_framebuffer_refresh(picodvi_framebuffer_obj_t *self);
+bool common_hal_picodvi_framebuffer_get_double_buffer(picodvi_framebuffer_obj_t *self);
+// Waits for the back buffer to be shown. Rows set in dirty_row_bitmask, if not NULL,
+// are then copied into the new back buffer.
+void common_hal_picodvi_framebuffer_swap(picodvi_framebuffer_obj_t *self, const uint8_t *dirty_row_bitmask);
 int common_hal_picodvi_framebuffer_get_width(picodvi_framebuffer_obj_t *self);
 int common_hal_picodvi_framebuffer_get_height(picodvi_framebuffer_obj_t *self);
 int common_hal_picodvi_framebuffer_get_row_stride(picodvi_framebuffer_obj_t *self);
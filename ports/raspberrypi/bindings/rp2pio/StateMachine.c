@@ -470,10 +470,10 @@ MP_DEFINE_CONST_FUN_OBJ_KW(rp2pio_statemachine_write_obj, 2, rp2pio_statemachine
 //|         """
 //|         ...
 
-STATIC void fill_buf_info(sm_buf_info *info, mp_obj_t obj, size_t *stride_in_bytes) {
+STATIC void fill_buf_info(sm_buf_info *info, mp_obj_t obj, size_t *stride_in_bytes, mp_uint_t direction) {
     if (obj != mp_const_none) {
         info->obj = obj;
-        mp_get_buffer_raise(obj, &info->info, MP_BUFFER_READ);
+        mp_get_buffer_raise(obj, &info->info, direction);
         size_t stride = mp_binary_get_size('@', info->info.typecode, NULL);
         if (stride > 4) {
             mp_raise_ValueError(translate("Buffer elements must be 4 bytes long or less"));
@@ -502,8 +502,8 @@ STATIC mp_obj_t rp2pio_statemachine_background_write(size_t n_args, const mp_obj
     sm_buf_info once_info;
     sm_buf_info loop_info;
     size_t stride_in_bytes = 0;
-    fill_buf_info(&once_info, args[ARG_once].u_obj, &stride_in_bytes);
-    fill_buf_info(&loop_info, args[ARG_loop].u_obj, &stride_in_bytes);
+    fill_buf_info(&once_info, args[ARG_once].u_obj, &stride_in_bytes, MP_BUFFER_READ);
+    fill_buf_info(&loop_info, args[ARG_loop].u_obj, &stride_in_bytes, MP_BUFFER_READ);
     if (!stride_in_bytes) {
         return mp_const_none;
     }
@@ -570,6 +570,207 @@ const mp_obj_property_t rp2pio_statemachine_pending_obj = {
               MP_ROM_NONE},
 };
 
+//|     def background_read(
+//|         self,
+//|         once: Optional[WriteableBuffer] = None,
+//|         *,
+//|         loop: Optional[WriteableBuffer] = None,
+//|         swap: bool = False,
+//|     ) -> None:
+//|         """Read data from the RX fifo in the background, with optional looping.
+//|
+//|         This is the counterpart of `background_write`. First, if any previous ``once`` or ``loop``
+//|         buffer has not been started, this function blocks until they have been started.
+//|         Then the ``once`` and/or ``loop`` buffers are queued and the function returns.
+//|         The ``once`` buffer (if specified) will be filled just once.
+//|         Finally, the ``loop`` buffer (if specified) will continue being filled indefinitely.
+//|
+//|         Reads from the FIFO will match the buffer's element size, aligned as for `readinto`.
+//|
+//|         To capture continuously, alternate between a pair of buffers: pass one as ``loop``,
+//|         wait for `last_read` to return it, then pass the other as ``loop`` while processing
+//|         the first one. The next buffer starts as soon as the previous one is full, so no
+//|         data is lost between them as long as each is processed in time.
+//|
+//|         Having neither ``once`` nor ``loop`` terminates an existing
+//|         background looping read after exactly a whole loop. This is in contrast to
+//|         `stop_background_read`, which interrupts an ongoing DMA operation.
+//|
+//|         :param ~Optional[circuitpython_typing.WriteableBuffer] once: Buffer to be filled once
+//|         :param ~Optional[circuitpython_typing.WriteableBuffer] loop: Buffer to be filled repeatedly
+//|         :param bool swap: For 2- and 4-byte elements, swap (reverse) the byte order
+//|         """
+//|         ...
+
+STATIC mp_obj_t rp2pio_statemachine_background_read(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_once, ARG_loop, ARG_swap };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_once,     MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_loop,     MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_swap,   MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    sm_buf_info once_info;
+    sm_buf_info loop_info;
+    size_t stride_in_bytes = 0;
+    fill_buf_info(&once_info, args[ARG_once].u_obj, &stride_in_bytes, MP_BUFFER_WRITE);
+    fill_buf_info(&loop_info, args[ARG_loop].u_obj, &stride_in_bytes, MP_BUFFER_WRITE);
+    if (!stride_in_bytes) {
+        return mp_const_none;
+    }
+
+    bool ok = common_hal_rp2pio_statemachine_background_read(self, &once_info, &loop_info, stride_in_bytes, args[ARG_swap].u_bool);
+
+    if (mp_hal_is_interrupted()) {
+        return mp_const_none;
+    }
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(rp2pio_statemachine_background_read_obj, 1, rp2pio_statemachine_background_read);
+
+//|     def stop_background_read(self) -> None:
+//|         """Immediately stop a background read, if one is in progress.  Any
+//|         DMA in progress is halted, but items already in the RX FIFO are not
+//|         affected."""
+STATIC mp_obj_t rp2pio_statemachine_obj_stop_background_read(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    bool ok = common_hal_rp2pio_statemachine_stop_background_read(self);
+    if (mp_hal_is_interrupted()) {
+        return mp_const_none;
+    }
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_stop_background_read_obj, rp2pio_statemachine_obj_stop_background_read);
+
+//|     reading: bool
+//|     """Returns True if a background read is in progress"""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_reading(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_rp2pio_statemachine_get_reading(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_reading_obj, rp2pio_statemachine_obj_get_reading);
+
+const mp_obj_property_t rp2pio_statemachine_reading_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&rp2pio_statemachine_get_reading_obj,
+              MP_ROM_NONE,
+              MP_ROM_NONE},
+};
+
+//|     pending_read: int
+//|     """Returns the number of pending buffers for background reading.
+//|
+//|     If the number is 0, then a `StateMachine.background_read` call will not block."""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_pending_read(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(common_hal_rp2pio_statemachine_get_pending_read(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_pending_read_obj, rp2pio_statemachine_obj_get_pending_read);
+
+const mp_obj_property_t rp2pio_statemachine_pending_read_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&rp2pio_statemachine_get_pending_read_obj,
+              MP_ROM_NONE,
+              MP_ROM_NONE},
+};
+
+//|     last_read: WriteableBuffer
+//|     """Returns the buffer most recently filled by background reading.
+//|
+//|     This is self-clearing: after it returns a buffer, it returns an empty ``bytes``
+//|     until another buffer has been filled."""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_last_read(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_rp2pio_statemachine_get_last_read(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_last_read_obj, rp2pio_statemachine_obj_get_last_read);
+
+const mp_obj_property_t rp2pio_statemachine_last_read_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&rp2pio_statemachine_get_last_read_obj,
+              MP_ROM_NONE,
+              MP_ROM_NONE},
+};
+
+//|     def connect(self, target: StateMachine, *, swap: bool = False, crc: bool = False) -> None:
+//|         """Move each 32 bit word pushed to this state machine's RX FIFO into the TX FIFO of
+//|         ``target`` with DMA, without involving the CPU. State machines connected this way form a
+//|         pipeline, such as an input decoder feeding an output encoder, that runs at the rate of
+//|         the PIO programs while Python only sets it up. ``target`` may be a state machine on either PIO.
+//|
+//|         Words move as soon as this state machine pushes them, so ``target`` must pull them at
+//|         least as fast or words are lost once its TX FIFO is full. Any previous connection from this
+//|         state machine is replaced. Call `disconnect` (or `deinit`) before deinitializing ``target``.
+//|
+//|         :param StateMachine target: The state machine to feed
+//|         :param bool swap: Swap (reverse) the byte order of each word on the way
+//|         :param bool crc: Compute a CRC-32 of the words moved, readable from `crc`. Only one
+//|           connection at a time can do this."""
+//|         ...
+
+STATIC mp_obj_t rp2pio_statemachine_connect(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_target, ARG_swap, ARG_crc };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_target,   MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_swap,     MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_crc,      MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    rp2pio_statemachine_obj_t *target = MP_OBJ_TO_PTR(mp_arg_validate_type(args[ARG_target].u_obj, &rp2pio_statemachine_type, MP_QSTR_target));
+    check_for_deinit(target);
+
+    if (!common_hal_rp2pio_statemachine_connect(self, target, args[ARG_swap].u_bool, args[ARG_crc].u_bool)) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(rp2pio_statemachine_connect_obj, 2, rp2pio_statemachine_connect);
+
+//|     def disconnect(self) -> None:
+//|         """Stop moving words to the state machine given to `connect`. Words already in either
+//|         FIFO are not affected."""
+//|         ...
+STATIC mp_obj_t rp2pio_statemachine_obj_disconnect(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_rp2pio_statemachine_disconnect(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_disconnect_obj, rp2pio_statemachine_obj_disconnect);
+
+//|     crc: Optional[int]
+//|     """The CRC-32 of the words moved so far by a connection made with ``crc=True``, or ``None``
+//|     otherwise. The bytes of each word are taken least significant first, giving the same value
+//|     as ``binascii.crc32()`` would over the same bytes."""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_crc(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_rp2pio_statemachine_get_crc(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_crc_obj, rp2pio_statemachine_obj_get_crc);
+
+const mp_obj_property_t rp2pio_statemachine_crc_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&rp2pio_statemachine_get_crc_obj,
+              MP_ROM_NONE,
+              MP_ROM_NONE},
+};
+
 //|     def readinto(
 //|         self,
 //|         buffer: WriteableBuffer,
@@ -836,6 +1037,14 @@ STATIC const mp_rom_map_elem_t rp2pio_statemachine_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_stop_background_write), MP_ROM_PTR(&rp2pio_statemachine_stop_background_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_writing), MP_ROM_PTR(&rp2pio_statemachine_writing_obj) },
     { MP_ROM_QSTR(MP_QSTR_pending), MP_ROM_PTR(&rp2pio_statemachine_pending_obj) },
+    { MP_ROM_QSTR(MP_QSTR_background_read), MP_ROM_PTR(&rp2pio_statemachine_background_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop_background_read), MP_ROM_PTR(&rp2pio_statemachine_stop_background_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reading), MP_ROM_PTR(&rp2pio_statemachine_reading_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pending_read), MP_ROM_PTR(&rp2pio_statemachine_pending_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_last_read), MP_ROM_PTR(&rp2pio_statemachine_last_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&rp2pio_statemachine_connect_obj) },
+    { MP_ROM_QSTR(MP_QSTR_disconnect), MP_ROM_PTR(&rp2pio_statemachine_disconnect_obj) },
+    { MP_ROM_QSTR(MP_QSTR_crc), MP_ROM_PTR(&rp2pio_statemachine_crc_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&rp2pio_statemachine_frequency_obj) },
     { MP_ROM_QSTR(MP_QSTR_rxstall), MP_ROM_PTR(&rp2pio_statemachine_rxstall_obj) },
@@ -70,6 +70,16 @@ bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *
 bool common_hal_rp2pio_statemachine_stop_background_write(rp2pio_statemachine_obj_t *self);
 mp_int_t common_hal_rp2pio_statemachine_get_pending(rp2pio_statemachine_obj_t *self);
 bool common_hal_rp2pio_statemachine_get_writing(rp2pio_statemachine_obj_t *self);
+
+bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *self, const sm_buf_info *once_obj, const sm_buf_info *loop_obj, uint8_t stride_in_bytes, bool swap);
+bool common_hal_rp2pio_statemachine_stop_background_read(rp2pio_statemachine_obj_t *self);
+mp_int_t common_hal_rp2pio_statemachine_get_pending_read(rp2pio_statemachine_obj_t *self);
+bool common_hal_rp2pio_statemachine_get_reading(rp2pio_statemachine_obj_t *self);
+mp_obj_t common_hal_rp2pio_statemachine_get_last_read(rp2pio_statemachine_obj_t *self);
+
+bool common_hal_rp2pio_statemachine_connect(rp2pio_statemachine_obj_t *self, rp2pio_statemachine_obj_t *target, bool swap, bool crc);
+void common_hal_rp2pio_statemachine_disconnect(rp2pio_statemachine_obj_t *self);
+mp_obj_t common_hal_rp2pio_statemachine_get_crc(rp2pio_statemachine_obj_t *self);
 bool common_hal_rp2pio_statemachine_readinto(rp2pio_statemachine_obj_t *self, uint8_t *data, size_t len, uint8_t stride_in_bytes, bool swap);
 bool common_hal_rp2pio_statemachine_write_readinto(rp2pio_statemachine_obj_t *self,
     const uint8_t *data_out, size_t out_len, uint8_t out_stride_in_bytes,
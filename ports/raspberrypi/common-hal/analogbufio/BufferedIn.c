@@ -34,6 +34,7 @@
 #include "shared-bindings/analogbufio/BufferedIn.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared/runtime/interrupt_char.h"
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "supervisor/shared/translate/translate.h"
 #include "src/rp2_common/hardware_adc/include/hardware/adc.h"
@@ -46,6 +47,12 @@
 #define ADC_CLOCK_INPUT 48000000
 #define ADC_MAX_CLOCK_DIV (1 << (ADC_DIV_INT_MSB - ADC_DIV_INT_LSB + 1))
 
+// The ring is 8kB so that it can wrap on the DMA's alignment boundary.
+#define RING_SAMPLES (4096)
+#define RING_BYTES (RING_SAMPLES * sizeof(uint16_t))
+#define RING_SIZE_BITS (13)
+#define RING_TRANSFER_COUNT (0xffffffff)
+
 void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *self, const mcu_pin_obj_t *pin, uint32_t sample_rate) {
     // Make sure pin number is in range for ADC
     if (pin->number < ADC_FIRST_PIN_NUMBER || pin->number >= (ADC_FIRST_PIN_NUMBER + ADC_PIN_COUNT)) {
@@ -95,6 +102,10 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
     // Pace transfers based on availability of ADC samples
     channel_config_set_dreq(&(self->cfg), DREQ_ADC);
 
+    self->sampling = false;
+    self->ring_alloc = NULL;
+    self->ring = NULL;
+
     // clear any previous activity
     adc_fifo_drain();
     adc_run(false);
@@ -109,6 +120,8 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
         return;
     }
 
+    common_hal_analogbufio_bufferedin_stop(self);
+
     // Release ADC Pin
     reset_pin_number(self->pin->number);
     self->pin = NULL;
@@ -117,7 +130,100 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
     dma_channel_unclaim(self->dma_chan);
 }
 
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t *self) {
+    if (self->sampling) {
+        return;
+    }
+    // The DMA ring must be aligned to its size. Over allocate when the first try isn't.
+    uint16_t *alloc = gc_alloc(RING_BYTES, false, true);
+    if (alloc != NULL && ((uintptr_t)alloc & (RING_BYTES - 1)) != 0) {
+        gc_free(alloc);
+        alloc = gc_alloc(RING_BYTES * 2, false, true);
+    }
+    if (alloc == NULL) {
+        m_malloc_fail(RING_BYTES);
+    }
+    self->ring_alloc = alloc;
+    self->ring = (uint16_t *)(((uintptr_t)alloc + RING_BYTES - 1) & ~(uintptr_t)(RING_BYTES - 1));
+    self->ring_base = 0;
+    self->ring_read = 0;
+
+    // Keep the raw 12-bit value. readinto() scales it for the buffer it is given.
+    adc_fifo_setup(true, true, 1, false, false);
+
+    channel_config_set_transfer_data_size(&(self->cfg), DMA_SIZE_16);
+    channel_config_set_ring(&(self->cfg), true, RING_SIZE_BITS);
+    dma_channel_configure(self->dma_chan, &(self->cfg),
+        self->ring,
+        &adc_hw->fifo,
+        RING_TRANSFER_COUNT,
+        true);
+    // Leave the config as readinto() expects it.
+    channel_config_set_ring(&(self->cfg), true, 0);
+
+    adc_run(true);
+    self->sampling = true;
+}
+
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t *self) {
+    if (!self->sampling) {
+        return;
+    }
+    adc_run(false);
+    dma_channel_abort(self->dma_chan);
+    adc_fifo_drain();
+    self->sampling = false;
+    self->ring_alloc = NULL;
+    self->ring = NULL;
+}
+
+bool common_hal_analogbufio_bufferedin_get_sampling(analogbufio_bufferedin_obj_t *self) {
+    return self->sampling;
+}
+
+// Samples captured since start(), modulo 2**32. Re-arms the channel if it ever
+// counts down to zero; the ADC FIFO holds a few samples meanwhile.
+STATIC uint32_t _ring_written(analogbufio_bufferedin_obj_t *self) {
+    uint32_t remaining = dma_channel_hw_addr(self->dma_chan)->transfer_count;
+    if (!dma_channel_is_busy(self->dma_chan)) {
+        self->ring_base += RING_TRANSFER_COUNT;
+        dma_channel_set_trans_count(self->dma_chan, RING_TRANSFER_COUNT, true);
+        remaining = RING_TRANSFER_COUNT;
+    }
+    return self->ring_base + (RING_TRANSFER_COUNT - remaining);
+}
+
+STATIC uint32_t _continuous_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    uint32_t sample_count = len / bytes_per_sample;
+    uint32_t captured_count = 0;
+    while (captured_count < sample_count && !mp_hal_is_interrupted()) {
+        uint32_t written = _ring_written(self);
+        if (written - self->ring_read > RING_SAMPLES) {
+            // We fell behind by a whole ring, so skip to the oldest sample still there.
+            self->ring_read = written - RING_SAMPLES;
+        }
+        while (self->ring_read != written && captured_count < sample_count) {
+            uint16_t value = self->ring[self->ring_read & (RING_SAMPLES - 1)] & 0xfff;
+            if (bytes_per_sample == 2) {
+                ((uint16_t *)buffer)[captured_count] = (value << 4) | (value >> 8);
+            } else {
+                buffer[captured_count] = value >> 4;
+            }
+            self->ring_read++;
+            captured_count++;
+        }
+        if (captured_count < sample_count) {
+            RUN_BACKGROUND_TASKS;
+        }
+    }
+    return captured_count;
+}
+
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    if (self->sampling) {
+        return _continuous_readinto(self, buffer, len, bytes_per_sample);
+    }
+
     // RP2040 Implementation Detail
     // Fills the supplied buffer with ADC values using DMA transfer.
     // If the buffer is 8-bit, then values are 8-bit shifted and error bit is off.
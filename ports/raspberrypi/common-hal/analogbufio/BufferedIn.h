@@ -44,6 +44,12 @@ typedef struct {
     uint8_t chan;
     uint dma_chan;
     dma_channel_config cfg;
+    // Continuous sampling runs the DMA forever around a ring of 16-bit samples.
+    bool sampling;
+    uint16_t *ring_alloc;
+    uint16_t *ring;
+    uint32_t ring_base;
+    uint32_t ring_read;
 } analogbufio_bufferedin_obj_t;
 
 #endif // MICROPY_INCLUDED_RASPBERRYPI_COMMON_HAL_ANALOGBUFIO_BUFFEREDIN_H
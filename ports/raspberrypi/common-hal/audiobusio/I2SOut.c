@@ -240,3 +240,19 @@ bool common_hal_audiobusio_i2sout_get_playing(audiobusio_i2sout_obj_t *self) {
     }
     return playing;
 }
+
+void common_hal_audiobusio_i2sout_set_buffer_count(audiobusio_i2sout_obj_t *self, uint8_t buffer_count) {
+    audio_dma_set_buffer_count(&self->dma, buffer_count);
+}
+
+uint8_t common_hal_audiobusio_i2sout_get_buffer_count(audiobusio_i2sout_obj_t *self) {
+    return audio_dma_get_buffer_count(&self->dma);
+}
+
+uint32_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
+
+uint32_t common_hal_audiobusio_i2sout_get_late_fills(audiobusio_i2sout_obj_t *self) {
+    return audio_dma_get_late_fills(&self->dma);
+}
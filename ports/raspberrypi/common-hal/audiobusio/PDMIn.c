@@ -32,16 +32,23 @@
 #include "py/runtime.h"
 #include "shared-bindings/audiobusio/PDMIn.h"
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared/runtime/interrupt_char.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate/translate.h"
 
 #include "audio_dma.h"
 
 #define OVERSAMPLING 64
-#define SAMPLES_PER_BUFFER 32
 
 // MEMS microphones must be clocked at at least 1MHz.
 #define MIN_MIC_CLOCK 1000000
 
+// The PDM bits are sampled in two PIO cycles.
+#define PIO_CYCLES_PER_BIT 2
+
+// Unsigned output for silence.
+#define SILENCE 0x8000
+
 const uint16_t pdmin[] = {
     // in pins 1        side 0b1
     0x5001,
@@ -49,6 +56,22 @@ const uint16_t pdmin[] = {
     0x8040
 };
 
+// a windowed sinc filter for 44 khz, 64 samples
+//
+// This is the first stage of the decimation. It is applied to the last 64 bits
+// every 32 bits, so its output is at twice the sample rate, and half-band
+// filters take it down from there.
+const uint16_t sinc_filter[OVERSAMPLING] = {
+    0, 2, 9, 21, 39, 63, 94, 132,
+    179, 236, 302, 379, 467, 565, 674, 792,
+    920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
+    2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
+    2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
+    1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
+    674, 565, 467, 379, 302, 236, 179, 132,
+    94, 63, 39, 21, 9, 2, 0, 0
+};
+
 // Caller validates that pins are free.
 void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t *self,
     const mcu_pin_obj_t *clock_pin,
@@ -61,10 +84,18 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t *self,
         mp_raise_NotImplementedError(translate("Only 8 or 16 bit mono with " MP_STRINGIFY(OVERSAMPLING) "x oversampling is supported."));
     }
 
+    // Low sample rates clock the microphone faster and decimate by two more times.
+    uint8_t halfband_stages = 1;
+    while ((uint64_t)sample_rate * OVERSAMPLING << (halfband_stages - 1) < MIN_MIC_CLOCK &&
+           halfband_stages < PDMIN_MAX_HALFBAND_STAGES) {
+        halfband_stages++;
+    }
+    uint32_t bit_rate = sample_rate * OVERSAMPLING << (halfband_stages - 1);
+
     // Use the state machine to manage pins.
     common_hal_rp2pio_statemachine_construct(&self->state_machine,
         pdmin, MP_ARRAY_SIZE(pdmin),
-        sample_rate * 32 * 2, // Frequency based on sample rate
+        bit_rate * PIO_CYCLES_PER_BIT, // Frequency based on sample rate
         NULL, 0,
         NULL, 1, 0, 0xffffffff, // out pin
         data_pin, 1, // in pins
@@ -81,13 +112,33 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t *self,
         false, // Not user-interruptible.
         0, -1); // wrap settings
 
-    uint32_t actual_frequency = common_hal_rp2pio_statemachine_get_frequency(&self->state_machine);
-    if (actual_frequency < MIN_MIC_CLOCK) {
+    uint32_t actual_bit_rate = common_hal_rp2pio_statemachine_get_frequency(&self->state_machine) / PIO_CYCLES_PER_BIT;
+    if (actual_bit_rate < MIN_MIC_CLOCK) {
+        common_hal_rp2pio_statemachine_deinit(&self->state_machine);
         mp_raise_ValueError(translate("sampling rate out of range"));
     }
 
-    self->sample_rate = actual_frequency / oversample;
+    self->sample_rate = (actual_bit_rate / oversample) >> (halfband_stages - 1);
     self->bit_depth = bit_depth;
+    self->bytes_per_sample = bit_depth / 8;
+    self->halfband_stages = halfband_stages;
+    self->recording = false;
+    self->ring = NULL;
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+
+    // Tabulate what the first filter adds for each nibble of the two words it covers.
+    for (size_t nibble = 0; nibble < 16; nibble++) {
+        for (size_t bits = 0; bits < 16; bits++) {
+            uint16_t sum = 0;
+            for (size_t i = 0; i < 4; i++) {
+                if (bits & (1 << i)) {
+                    sum += sinc_filter[nibble * 4 + i];
+                }
+            }
+            self->nibble_sums[nibble][bits] = sum;
+        }
+    }
 }
 
 bool common_hal_audiobusio_pdmin_deinited(audiobusio_pdmin_obj_t *self) {
@@ -98,7 +149,11 @@ void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t *self) {
     if (common_hal_audiobusio_pdmin_deinited(self)) {
         return;
     }
-    return common_hal_rp2pio_statemachine_deinit(&self->state_machine);
+    common_hal_audiobusio_pdmin_stop(self);
+    self->ring = NULL;
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    common_hal_rp2pio_statemachine_deinit(&self->state_machine);
 }
 
 uint8_t common_hal_audiobusio_pdmin_get_bit_depth(audiobusio_pdmin_obj_t *self) {
@@ -109,67 +164,191 @@ uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t *sel
     return self->sample_rate;
 }
 
-// a windowed sinc filter for 44 khz, 64 samples
-//
-// This filter is good enough to use for lower sample rates as
-// well. It does not increase the noise enough to be a problem.
-//
-// In the long run we could use a fast filter like this to do the
-// decimation and initial filtering in real time, filtering to a
-// higher sample rate than specified.  Then after the audio is
-// recorded, a more expensive filter non-real-time filter could be
-// used to down-sample and low-pass.
-const uint16_t sinc_filter[OVERSAMPLING] = {
-    0, 2, 9, 21, 39, 63, 94, 132,
-    179, 236, 302, 379, 467, 565, 674, 792,
-    920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
-    2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
-    2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
-    1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
-    674, 565, 467, 379, 302, 236, 179, 132,
-    94, 63, 39, 21, 9, 2, 0, 0
-};
+// What the first filter adds for one word of bits, from eight nibble lookups.
+static inline uint32_t word_sum(const uint16_t (*nibble_sums)[16], uint32_t word) {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < 8; i++) {
+        sum += nibble_sums[i][word & 0xf];
+        word >>= 4;
+    }
+    return sum;
+}
 
-#define REPEAT_32_TIMES(X) do { X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X } while (0)
+// Half-band filter with taps -1, 0, 9, 16, 9, 0, -1 (/32), keeping every other
+// output. Returns whether *sample has been replaced by an output.
+static inline bool halfband_decimate(pdmin_halfband_t *halfband, int32_t *sample) {
+    int32_t *h = halfband->history;
+    for (size_t i = PDMIN_HALFBAND_TAPS - 1; i > 0; i--) {
+        h[i] = h[i - 1];
+    }
+    h[0] = *sample;
+    halfband->odd = !halfband->odd;
+    if (halfband->odd) {
+        return false;
+    }
+    *sample = (16 * h[3] + 9 * (h[2] + h[4]) - (h[0] + h[6])) >> 5;
+    return true;
+}
 
-static uint16_t filter_sample(uint32_t pdm_samples[2]) {
-    uint16_t running_sum = 0;
-    const uint16_t *filter_ptr = sinc_filter;
-    for (uint8_t i = 0; i < 2; i++) {
-        uint32_t pdm_sample = pdm_samples[i];
-        REPEAT_32_TIMES({
-            if (pdm_sample & 0x1) {
-                running_sum += *filter_ptr;
-            }
-            filter_ptr++;
-            pdm_sample >>= 1;
+void common_hal_audiobusio_pdmin_start(audiobusio_pdmin_obj_t *self) {
+    if (self->recording) {
+        return;
+    }
+    if (self->ring == NULL) {
+        self->ring = m_new(uint32_t, PDMIN_RING_WORDS);
+    }
+
+    // Start from silence: half of the first filter's earlier taps, and zero in the half-band filters.
+    self->lo_sum = 0;
+    for (size_t nibble = 0; nibble < 8; nibble++) {
+        self->lo_sum += self->nibble_sums[nibble][0xf];
+    }
+    self->lo_sum /= 2;
+    memset(self->halfband, 0, sizeof(self->halfband));
+
+    self->ring_read = 0;
+    self->overflowed = false;
+    sm_buf_info once = {0};
+    sm_buf_info loop = {
+        .obj = MP_OBJ_NULL,
+        .info = { .buf = self->ring, .len = PDMIN_RING_WORDS * sizeof(uint32_t) },
+    };
+    common_hal_rp2pio_statemachine_clear_rxfifo(&self->state_machine);
+    if (!common_hal_rp2pio_statemachine_background_read(&self->state_machine, &once, &loop, sizeof(uint32_t), false)) {
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+    self->recording = true;
+}
+
+void common_hal_audiobusio_pdmin_stop(audiobusio_pdmin_obj_t *self) {
+    if (!self->recording) {
+        return;
+    }
+    common_hal_rp2pio_statemachine_stop_background_read(&self->state_machine);
+    self->recording = false;
+}
+
+bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t *self) {
+    return self->recording;
+}
+
+// Filter the words the DMA has put in the ring since the last call into at most
+// max_samples samples. output_buffer may be a byte buffer or a halfword buffer.
+static size_t decimate(audiobusio_pdmin_obj_t *self, uint8_t *output_buffer, size_t max_samples) {
+    // ring_read counts bytes so that it wraps along with the count from the DMA.
+    size_t available = (rp2pio_statemachine_get_bytes_read(&self->state_machine) - self->ring_read) / sizeof(uint32_t);
+    if (available > PDMIN_RING_WORDS * 3 / 4) {
+        // The DMA has caught up with us: drop the oldest words before they are overwritten.
+        self->overflowed = true;
+        self->ring_read += (available - PDMIN_RING_WORDS / 2) * sizeof(uint32_t);
+        available = PDMIN_RING_WORDS / 2;
+    }
+
+    size_t output_count = 0;
+    for (; available > 0 && output_count < max_samples; available--) {
+        uint32_t word = self->ring[(self->ring_read / sizeof(uint32_t)) % PDMIN_RING_WORDS];
+        self->ring_read += sizeof(uint32_t);
+
+        int32_t sample = (int32_t)(self->lo_sum + word_sum(&self->nibble_sums[8], word)) - SILENCE;
+        self->lo_sum = word_sum(&self->nibble_sums[0], word);
+
+        size_t stage = 0;
+        while (stage < self->halfband_stages && halfband_decimate(&self->halfband[stage], &sample)) {
+            stage++;
+        }
+        if (stage < self->halfband_stages) {
+            continue;
         }
-            );
+
+        uint16_t value = MAX(0, MIN(0xffff, sample + SILENCE));
+        if (self->bit_depth == 8) {
+            // Truncate to 8 bits.
+            output_buffer[output_count] = value >> 8;
+        } else {
+            ((uint16_t *)output_buffer)[output_count] = value;
+        }
+        output_count++;
     }
-    return running_sum;
+    return output_count;
 }
 
 // output_buffer may be a byte buffer or a halfword buffer.
 // output_buffer_length is the number of slots, not the number of bytes.
 uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *self,
     uint16_t *output_buffer, uint32_t output_buffer_length) {
-    uint32_t samples[2];
+    bool was_recording = self->recording;
+    common_hal_audiobusio_pdmin_start(self);
+    self->overflowed = false;
+
     size_t output_count = 0;
-    common_hal_rp2pio_statemachine_clear_rxfifo(&self->state_machine);
-    // Do one read to get the mic going and throw it away.
-    common_hal_rp2pio_statemachine_readinto(&self->state_machine, (uint8_t *)samples, 2 * sizeof(uint32_t), sizeof(uint32_t), false);
-    while (output_count < output_buffer_length && !common_hal_rp2pio_statemachine_get_rxstall(&self->state_machine)) {
-        common_hal_rp2pio_statemachine_readinto(&self->state_machine, (uint8_t *)samples, 2 * sizeof(uint32_t), sizeof(uint32_t), false);
-        // Call filter_sample just one place so it can be inlined.
-        uint16_t value = filter_sample(samples);
+    while (output_count < output_buffer_length) {
+        output_count += decimate(self, (uint8_t *)output_buffer + output_count * self->bytes_per_sample,
+            output_buffer_length - output_count);
+        // Samples have been missed, so what has been recorded is no longer continuous.
+        if (self->overflowed) {
+            break;
+        }
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            break;
+        }
+    }
+
+    if (!was_recording) {
+        common_hal_audiobusio_pdmin_stop(self);
+    }
+    return output_count;
+}
+
+void audiobusio_pdmin_reset_buffer(audiobusio_pdmin_obj_t *self,
+    bool single_channel_output, uint8_t channel) {
+    for (size_t i = 0; i < 2; i++) {
+        if (self->buffer[i] == NULL) {
+            self->buffer[i] = m_malloc(PDMIN_BUFFER_SAMPLES * self->bytes_per_sample, false);
+        }
+    }
+    self->buffer_index = 0;
+    common_hal_audiobusio_pdmin_start(self);
+}
+
+audioio_get_buffer_result_t audiobusio_pdmin_get_buffer(audiobusio_pdmin_obj_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length) {
+    if (!self->recording) {
+        *buffer_length = 0;
+        return GET_BUFFER_DONE;
+    }
+    uint8_t *output_buffer = self->buffer[self->buffer_index];
+    self->buffer_index ^= 1;
+
+    // Keep each buffer's worth of PDM bits to a quarter of the ring.
+    size_t samples = PDMIN_BUFFER_SAMPLES >> (self->halfband_stages - 1);
+    size_t output_count = decimate(self, output_buffer, samples);
+
+    // The microphone fills the ring as fast as a player at the same rate empties it,
+    // so the rest is at most about a buffer away. If it doesn't come, play silence.
+    uint64_t deadline = supervisor_ticks_ms64() + 1 + samples * 1000 / self->sample_rate;
+    while (output_count < samples && supervisor_ticks_ms64() < deadline) {
+        output_count += decimate(self, output_buffer + output_count * self->bytes_per_sample, samples - output_count);
+    }
+    if (output_count < samples) {
         if (self->bit_depth == 8) {
-            // Truncate to 8 bits.
-            ((uint8_t *)output_buffer)[output_count] = value >> 8;
+            memset(output_buffer + output_count, SILENCE >> 8, samples - output_count);
         } else {
-            output_buffer[output_count] = value;
+            for (size_t i = output_count; i < samples; i++) {
+                ((uint16_t *)output_buffer)[i] = SILENCE;
+            }
         }
-        output_count++;
     }
 
-    return output_count;
+    *buffer = output_buffer;
+    *buffer_length = samples * self->bytes_per_sample;
+    return GET_BUFFER_MORE_DATA;
+}
+
+void audiobusio_pdmin_get_buffer_structure(audiobusio_pdmin_obj_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed, uint32_t *max_buffer_length, uint8_t *spacing) {
+    *single_buffer = false;
+    *samples_signed = false;
+    *max_buffer_length = PDMIN_BUFFER_SAMPLES * self->bytes_per_sample;
+    *spacing = 1;
 }
@@ -32,6 +32,21 @@
 
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
+
+// Words of PDM bits in the ring the RX FIFO is read into. A power of two.
+#define PDMIN_RING_WORDS (2048)
+// Samples in each of the two buffers handed out as an audio sample.
+#define PDMIN_BUFFER_SAMPLES (256)
+// Decimate-by-2 stages after the first filter. One is always needed; more let
+// the microphone run at least at its minimum clock for lower sample rates.
+#define PDMIN_MAX_HALFBAND_STAGES (4)
+#define PDMIN_HALFBAND_TAPS (7)
+
+typedef struct {
+    int32_t history[PDMIN_HALFBAND_TAPS];
+    bool odd;
+} pdmin_halfband_t;
 
 typedef struct {
     mp_obj_base_t base;
@@ -40,9 +55,30 @@ typedef struct {
     uint8_t clock_unit;
     uint8_t bytes_per_sample;
     uint8_t bit_depth;
+    uint8_t halfband_stages;
+    bool recording;
+    bool overflowed;
     rp2pio_statemachine_obj_t state_machine;
+
+    // The first filter, as the sum its taps give each nibble of a pair of words.
+    uint16_t nibble_sums[16][16];
+    uint32_t lo_sum; // the earlier word's part of the next first-filter output
+    pdmin_halfband_t halfband[PDMIN_MAX_HALFBAND_STAGES];
+
+    uint32_t *ring;
+    size_t ring_read; // words taken from the ring since recording started
+    uint8_t *buffer[2];
+    uint8_t buffer_index;
 } audiobusio_pdmin_obj_t;
 
+// Audio sample protocol, for playing the microphone while it records.
+void audiobusio_pdmin_reset_buffer(audiobusio_pdmin_obj_t *self,
+    bool single_channel_output, uint8_t channel);
+audioio_get_buffer_result_t audiobusio_pdmin_get_buffer(audiobusio_pdmin_obj_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length);
+void audiobusio_pdmin_get_buffer_structure(audiobusio_pdmin_obj_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed, uint32_t *max_buffer_length, uint8_t *spacing);
+
 void pdmin_reset(void);
 
 void pdmin_background(void);
@@ -285,3 +285,19 @@ void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t *self
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t *self) {
     return audio_dma_get_paused(&self->dma);
 }
+
+void common_hal_audiopwmio_pwmaudioout_set_buffer_count(audiopwmio_pwmaudioout_obj_t *self, uint8_t buffer_count) {
+    audio_dma_set_buffer_count(&self->dma, buffer_count);
+}
+
+uint8_t common_hal_audiopwmio_pwmaudioout_get_buffer_count(audiopwmio_pwmaudioout_obj_t *self) {
+    return audio_dma_get_buffer_count(&self->dma);
+}
+
+uint32_t common_hal_audiopwmio_pwmaudioout_get_underruns(audiopwmio_pwmaudioout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
+
+uint32_t common_hal_audiopwmio_pwmaudioout_get_late_fills(audiopwmio_pwmaudioout_obj_t *self) {
+    return audio_dma_get_late_fills(&self->dma);
+}
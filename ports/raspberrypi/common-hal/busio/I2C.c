@@ -32,7 +32,9 @@
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/bitbangio/I2C.h"
+#include "supervisor/shared/tick.h"
 
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
 
 // Synopsys  DW_apb_i2c  (v2.01)  IP
@@ -42,6 +44,12 @@
 // One second
 #define BUS_TIMEOUT_US 1000000
 
+// Transfers at least this long are fed to the FIFOs by DMA so that background tasks run while the
+// bytes are on the bus.
+#define DMA_MIN_SIZE 32
+// DMA commands for the TX FIFO are generated this many at a time.
+#define DMA_COMMAND_CHUNK 32
+
 STATIC bool never_reset_i2c[2];
 STATIC i2c_inst_t *i2c[2] = {i2c0, i2c1};
 
@@ -166,6 +174,132 @@ void common_hal_busio_i2c_unlock(busio_i2c_obj_t *self) {
     self->has_lock = false;
 }
 
+// Returns an errno if the transfer was aborted or has timed out, 0 otherwise.
+STATIC uint8_t _dma_transfer_status(i2c_hw_t *hw, uint64_t deadline) {
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        uint32_t abort_reason = hw->tx_abrt_source;
+        // Reading clears the abort and lets the TX FIFO accept commands again.
+        (void)hw->clr_tx_abrt;
+        if (abort_reason & I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS) {
+            return MP_ENODEV;
+        }
+        return MP_EIO;
+    }
+    if (supervisor_ticks_ms64() > deadline) {
+        // Have the controller give up the bus.
+        hw->enable |= I2C_IC_ENABLE_ABORT_BITS;
+        return MP_ETIMEDOUT;
+    }
+    return 0;
+}
+
+// Writes out_data and then reads in_data, with a repeated start in between and a stop at the end,
+// as one DMA-fed command stream. Returns 0 or an errno.
+STATIC uint8_t _dma_write_read(busio_i2c_obj_t *self, uint16_t addr,
+    const uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len,
+    int chan_tx, int chan_rx) {
+    i2c_hw_t *hw = i2c_get_hw(self->peripheral);
+    hw->enable = 0;
+    hw->tar = addr;
+    // Ask for more commands while the 16 entry TX FIFO is at most half full.
+    hw->dma_tdlr = 8;
+    hw->dma_rdlr = 0;
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+    hw->enable = 1;
+    (void)hw->clr_tx_abrt;
+    (void)hw->clr_stop_det;
+
+    if (in_len > 0) {
+        dma_channel_config c = dma_channel_get_default_config(chan_rx);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+        channel_config_set_dreq(&c, i2c_get_dreq(self->peripheral, false));
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        dma_channel_configure(chan_rx, &c, in_data, &hw->data_cmd, in_len, true);
+    }
+
+    dma_channel_config c = dma_channel_get_default_config(chan_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_dreq(&c, i2c_get_dreq(self->peripheral, true));
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+
+    uint64_t deadline = supervisor_ticks_ms64() + BUS_TIMEOUT_US / 1000;
+    uint8_t status = 0;
+    uint16_t commands[DMA_COMMAND_CHUNK];
+    size_t total = out_len + in_len;
+    size_t sent = 0;
+    while (status == 0 && sent < total) {
+        size_t count = MIN(DMA_COMMAND_CHUNK, total - sent);
+        for (size_t i = 0; i < count; i++) {
+            size_t index = sent + i;
+            uint16_t command;
+            if (index < out_len) {
+                command = out_data[index];
+            } else {
+                command = I2C_IC_DATA_CMD_CMD_BITS;
+                if (index == out_len && out_len > 0) {
+                    command |= I2C_IC_DATA_CMD_RESTART_BITS;
+                }
+            }
+            if (index == total - 1) {
+                command |= I2C_IC_DATA_CMD_STOP_BITS;
+            }
+            commands[i] = command;
+        }
+        dma_channel_configure(chan_tx, &c, &hw->data_cmd, commands, count, true);
+        while (dma_channel_is_busy(chan_tx) && status == 0) {
+            RUN_BACKGROUND_TASKS;
+            status = _dma_transfer_status(hw, deadline);
+        }
+        sent += count;
+    }
+
+    // Wait for the last bytes to be read and for the stop.
+    while (status == 0 &&
+           ((in_len > 0 && dma_channel_is_busy(chan_rx)) ||
+            !(hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS))) {
+        RUN_BACKGROUND_TASKS;
+        status = _dma_transfer_status(hw, deadline);
+    }
+
+    if (status != 0) {
+        dma_channel_abort(chan_tx);
+        dma_channel_abort(chan_rx);
+        // The controller sends a stop itself after an abort.
+        uint64_t stop_deadline = supervisor_ticks_ms64() + 10;
+        while (!(hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS) &&
+               supervisor_ticks_ms64() < stop_deadline) {
+        }
+    }
+    (void)hw->clr_stop_det;
+    hw->dma_cr = 0;
+    self->peripheral->restart_on_next = false;
+    return status;
+}
+
+// Uses DMA for long transfers if two channels are free. Returns false without doing anything
+// otherwise.
+STATIC bool _try_dma_write_read(busio_i2c_obj_t *self, uint16_t addr,
+    const uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len, uint8_t *status) {
+    if (MAX(out_len, in_len) < DMA_MIN_SIZE) {
+        return false;
+    }
+    int chan_tx = dma_claim_unused_channel(false);
+    int chan_rx = dma_claim_unused_channel(false);
+    bool use_dma = chan_tx >= 0 && chan_rx >= 0;
+    if (use_dma) {
+        *status = _dma_write_read(self, addr, out_data, out_len, in_data, in_len, chan_tx, chan_rx);
+    }
+    if (chan_rx >= 0) {
+        dma_channel_unclaim(chan_rx);
+    }
+    if (chan_tx >= 0) {
+        dma_channel_unclaim(chan_tx);
+    }
+    return use_dma;
+}
+
 STATIC uint8_t _common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
     const uint8_t *data, size_t len, bool transmit_stop_bit) {
     if (len == 0) {
@@ -190,6 +324,11 @@ STATIC uint8_t _common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
         return status;
     }
 
+    uint8_t status;
+    if (transmit_stop_bit && _try_dma_write_read(self, addr, data, len, NULL, 0, &status)) {
+        return status;
+    }
+
     size_t result = i2c_write_timeout_us(self->peripheral, addr, data, len, !transmit_stop_bit, BUS_TIMEOUT_US);
     if (result == len) {
         return 0;
@@ -211,6 +350,11 @@ uint8_t common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
 
 uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t addr,
     uint8_t *data, size_t len) {
+    uint8_t status;
+    if (_try_dma_write_read(self, addr, NULL, 0, data, len, &status)) {
+        return status;
+    }
+
     size_t result = i2c_read_timeout_us(self->peripheral, addr, data, len, false, BUS_TIMEOUT_US);
     if (result == len) {
         return 0;
@@ -227,6 +371,11 @@ uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t addr,
 
 uint8_t common_hal_busio_i2c_write_read(busio_i2c_obj_t *self, uint16_t addr,
     uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len) {
+    uint8_t status;
+    if (out_len > 0 && _try_dma_write_read(self, addr, out_data, out_len, in_data, in_len, &status)) {
+        return status;
+    }
+
     uint8_t result = _common_hal_busio_i2c_write(self, addr, out_data, out_len, false);
     if (result != 0) {
         return result;
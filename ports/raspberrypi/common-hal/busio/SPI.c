@@ -113,6 +113,10 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
         gpio_set_function(miso->number, GPIO_FUNC_SPI);
         claim_pin(miso);
     }
+
+    self->background_chan_tx = -1;
+    self->background_chan_rx = -1;
+    self->background_write_buffer = MP_OBJ_NULL;
 }
 
 void common_hal_busio_spi_never_reset(busio_spi_obj_t *self) {
@@ -270,6 +274,71 @@ static bool _transfer(busio_spi_obj_t *self,
     return true;
 }
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+bool common_hal_busio_spi_start_write(busio_spi_obj_t *self,
+    const uint8_t *data, size_t len) {
+    int chan_tx = dma_claim_unused_channel(false);
+    int chan_rx = dma_claim_unused_channel(false);
+    if (chan_tx < 0 || chan_rx < 0) {
+        if (chan_rx >= 0) {
+            dma_channel_unclaim(chan_rx);
+        }
+        if (chan_tx >= 0) {
+            dma_channel_unclaim(chan_tx);
+        }
+        return false;
+    }
+
+    dma_channel_config c = dma_channel_get_default_config(chan_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(chan_tx, &c,
+        &spi_get_hw(self->peripheral)->dr,
+        data,
+        len,
+        false);
+
+    c = dma_channel_get_default_config(chan_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(chan_rx, &c,
+        &self->background_rx_sink,
+        &spi_get_hw(self->peripheral)->dr,
+        len,
+        false);
+
+    self->background_chan_tx = chan_tx;
+    self->background_chan_rx = chan_rx;
+    dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
+    return true;
+}
+
+void common_hal_busio_spi_finish_write(busio_spi_obj_t *self) {
+    if (self->background_chan_tx < 0) {
+        return;
+    }
+    // Waiting on RX as well ensures the last byte has actually left the shift register.
+    while (dma_channel_is_busy(self->background_chan_rx) || dma_channel_is_busy(self->background_chan_tx)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    dma_channel_unclaim(self->background_chan_rx);
+    dma_channel_unclaim(self->background_chan_tx);
+    self->background_chan_tx = -1;
+    self->background_chan_rx = -1;
+}
+
+bool common_hal_busio_spi_write_done(busio_spi_obj_t *self) {
+    if (self->background_chan_tx < 0) {
+        return true;
+    }
+    return !dma_channel_is_busy(self->background_chan_rx) && !dma_channel_is_busy(self->background_chan_tx);
+}
+#endif
+
 bool common_hal_busio_spi_write(busio_spi_obj_t *self,
     const uint8_t *data, size_t len) {
     uint32_t data_in;
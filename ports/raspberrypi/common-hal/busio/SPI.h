@@ -45,6 +45,15 @@ typedef struct {
     uint8_t polarity;
     uint8_t phase;
     uint8_t bits;
+    // DMA channels used by a background write, -1 when none is in progress.
+    int8_t background_chan_tx;
+    int8_t background_chan_rx;
+    // The RX FIFO must be drained during a write; received bytes land here.
+    uint32_t background_rx_sink;
+    // Set by SPI.write_async() so the data isn't collected before it is sent.
+    mp_obj_t background_write_buffer;
+    // Counts SPI.write_async() writes so each SPIWrite knows whether it is the one in progress.
+    uint32_t background_write_sequence;
 } busio_spi_obj_t;
 
 void reset_spi(void);
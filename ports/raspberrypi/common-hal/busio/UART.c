@@ -26,6 +26,9 @@
 
 #include "shared-bindings/busio/UART.h"
 
+#include <string.h>
+
+#include "py/gc.h"
 #include "py/stream.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
@@ -36,9 +39,15 @@
 
 #include "src/rp2_common/hardware_irq/include/hardware/irq.h"
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
 
 #define NO_PIN 0xff
 
+// The DMA ring wraps on a power of two boundary up to 32kB.
+#define RX_DMA_MIN_SIZE (32)
+#define RX_DMA_MAX_SIZE (1 << 15)
+#define RX_DMA_TRANSFER_COUNT (0xffffffff)
+
 #define UART_INST(uart) (((uart) ? uart1 : uart0))
 
 typedef enum {
@@ -49,9 +58,26 @@ typedef enum {
 
 static uart_status_t uart_status[NUM_UARTS];
 
+static busio_uart_obj_t *active_uarts[NUM_UARTS];
+
+static void _rx_dma_release(busio_uart_obj_t *self) {
+    if (self->rx_dma_channel < 0) {
+        return;
+    }
+    uart_get_hw(self->uart)->dmacr = 0;
+    dma_channel_abort(self->rx_dma_channel);
+    dma_channel_unclaim(self->rx_dma_channel);
+    self->rx_dma_channel = -1;
+    self->rx_dma_alloc = NULL;
+    self->rx_dma_buffer = NULL;
+}
+
 void reset_uart(void) {
     for (uint8_t num = 0; num < NUM_UARTS; num++) {
         if (uart_status[num] == STATUS_BUSY) {
+            if (active_uarts[num] != NULL) {
+                _rx_dma_release(active_uarts[num]);
+            }
             uart_status[num] = STATUS_FREE;
             uart_deinit(UART_INST(num));
         }
@@ -74,8 +100,6 @@ static uint8_t pin_init(const uint8_t uart, const mcu_pin_obj_t *pin, const uint
     return pin->number;
 }
 
-static busio_uart_obj_t *active_uarts[NUM_UARTS];
-
 static void _copy_into_ringbuf(ringbuf_t *r, uart_inst_t *uart) {
     while (uart_is_readable(uart) && ringbuf_num_empty(r) > 0) {
         ringbuf_put(r, (uint8_t)uart_get_hw(uart)->dr);
@@ -97,6 +121,90 @@ static void uart1_callback(void) {
     shared_callback(active_uarts[1]);
 }
 
+// Receive straight into a ring in RAM so that nothing depends on servicing an
+// interrupt per FIFO threshold. Returns false when DMA isn't available.
+static bool _rx_dma_start(busio_uart_obj_t *self, uint16_t receiver_buffer_size) {
+    uint32_t size = RX_DMA_MIN_SIZE;
+    uint8_t ring_bits = 5;
+    while (size < receiver_buffer_size) {
+        size <<= 1;
+        ring_bits++;
+    }
+    if (size > RX_DMA_MAX_SIZE) {
+        return false;
+    }
+
+    // The ring must be aligned to its size. Over allocate when the first try isn't.
+    uint8_t *alloc = gc_alloc(size, false, true);
+    if (alloc != NULL && ((uintptr_t)alloc & (size - 1)) != 0) {
+        gc_free(alloc);
+        alloc = gc_alloc(size * 2, false, true);
+    }
+    if (alloc == NULL) {
+        return false;
+    }
+    int channel = dma_claim_unused_channel(false);
+    if (channel == -1) {
+        gc_free(alloc);
+        return false;
+    }
+
+    self->rx_dma_channel = channel;
+    self->rx_dma_alloc = alloc;
+    self->rx_dma_buffer = (uint8_t *)(((uintptr_t)alloc + size - 1) & ~(uintptr_t)(size - 1));
+    self->rx_dma_size = size;
+    self->rx_dma_base = 0;
+    self->rx_dma_read = 0;
+
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, uart_get_dreq(self->uart, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ring_bits);
+    dma_channel_configure(channel, &c,
+        self->rx_dma_buffer,
+        &uart_get_hw(self->uart)->dr,
+        RX_DMA_TRANSFER_COUNT,
+        true);
+    uart_get_hw(self->uart)->dmacr = UART_UARTDMACR_RXDMAE_BITS;
+    return true;
+}
+
+// Total bytes received, modulo 2**32. Re-arms the channel if it ever counts down
+// to zero; anything that came in meanwhile waits in the FIFO.
+static uint32_t _rx_dma_written(busio_uart_obj_t *self) {
+    uint32_t remaining = dma_hw->ch[self->rx_dma_channel].transfer_count;
+    if (!dma_channel_is_busy(self->rx_dma_channel)) {
+        self->rx_dma_base += RX_DMA_TRANSFER_COUNT;
+        dma_channel_set_trans_count(self->rx_dma_channel, RX_DMA_TRANSFER_COUNT, true);
+        remaining = RX_DMA_TRANSFER_COUNT;
+    }
+    return self->rx_dma_base + (RX_DMA_TRANSFER_COUNT - remaining);
+}
+
+static uint32_t _rx_dma_available(busio_uart_obj_t *self) {
+    uint32_t written = _rx_dma_written(self);
+    uint32_t available = written - self->rx_dma_read;
+    if (available > self->rx_dma_size) {
+        // The ring has lapped the reader so the oldest bytes are gone.
+        self->rx_dma_read = written - self->rx_dma_size;
+        available = self->rx_dma_size;
+    }
+    return available;
+}
+
+static size_t _rx_dma_get_n(busio_uart_obj_t *self, uint8_t *data, size_t len) {
+    size_t count = MIN(len, _rx_dma_available(self));
+    uint32_t start = self->rx_dma_read & (self->rx_dma_size - 1);
+    // At most two copies: up to the end of the ring, then from its start.
+    size_t first = MIN(count, self->rx_dma_size - start);
+    memcpy(data, self->rx_dma_buffer + start, first);
+    memcpy(data + first, self->rx_dma_buffer, count - first);
+    self->rx_dma_read += count;
+    return count;
+}
+
 void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     const mcu_pin_obj_t *tx, const mcu_pin_obj_t *rx,
     const mcu_pin_obj_t *rts, const mcu_pin_obj_t *cts,
@@ -148,6 +256,9 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     self->uart_id = uart_id;
     self->baudrate = baudrate;
     self->timeout_ms = timeout * 1000;
+    self->rx_dma_channel = -1;
+    self->rx_dma_alloc = NULL;
+    self->rx_dma_buffer = NULL;
 
     uart_init(self->uart, self->baudrate);
     uart_set_fifo_enabled(self->uart, true);
@@ -156,7 +267,10 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
 
     if (rx != NULL) {
         // Use the provided buffer when given.
-        if (receiver_buffer != NULL) {
+        if (receiver_buffer == NULL && _rx_dma_start(self, receiver_buffer_size)) {
+            // DMA fills its own ring; the interrupt driven ringbuf is unused.
+            ringbuf_init(&self->ringbuf, NULL, 0);
+        } else if (receiver_buffer != NULL) {
             ringbuf_init(&self->ringbuf, receiver_buffer, receiver_buffer_size);
         } else {
             // Initially allocate the UART's buffer in the long-lived part of the
@@ -181,7 +295,7 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
         irq_set_exclusive_handler(self->uart_irq_id, uart0_callback);
     }
     irq_set_enabled(self->uart_irq_id, true);
-    uart_set_irq_enables(self->uart, true /* rx has data */, false /* tx needs data */);
+    uart_set_irq_enables(self->uart, self->rx_dma_channel < 0 /* rx has data */, false /* tx needs data */);
 }
 
 bool common_hal_busio_uart_deinited(busio_uart_obj_t *self) {
@@ -192,6 +306,7 @@ void common_hal_busio_uart_deinit(busio_uart_obj_t *self) {
     if (common_hal_busio_uart_deinited(self)) {
         return;
     }
+    _rx_dma_release(self);
     uart_deinit(self->uart);
     ringbuf_deinit(&self->ringbuf);
     active_uarts[self->uart_id] = NULL;
@@ -247,6 +362,30 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
         return 0;
     }
 
+    if (self->rx_dma_channel >= 0) {
+        size_t total_read = _rx_dma_get_n(self, data, len);
+        uint64_t start_ticks = supervisor_ticks_ms64();
+        // Wait until we have enough or the line has been idle for the timeout.
+        while (total_read < len && (supervisor_ticks_ms64() - start_ticks < self->timeout_ms)) {
+            RUN_BACKGROUND_TASKS;
+            size_t count = _rx_dma_get_n(self, data + total_read, len - total_read);
+            if (count > 0) {
+                total_read += count;
+                // Reset the timeout on every chunk read.
+                start_ticks = supervisor_ticks_ms64();
+            }
+            // Allow user to break out of a timeout with a KeyboardInterrupt.
+            if (mp_hal_is_interrupted()) {
+                break;
+            }
+        }
+        if (total_read == 0) {
+            *errcode = EAGAIN;
+            return MP_STREAM_ERROR;
+        }
+        return total_read;
+    }
+
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
 
@@ -312,6 +451,9 @@ void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t timeou
 }
 
 uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
+    if (self->rx_dma_channel >= 0) {
+        return _rx_dma_available(self);
+    }
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
     // The UART only interrupts after a threshold so make sure to copy anything
@@ -322,6 +464,10 @@ uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
 }
 
 void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self) {
+    if (self->rx_dma_channel >= 0) {
+        self->rx_dma_read = _rx_dma_written(self);
+        return;
+    }
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
     ringbuf_clear(&self->ringbuf);
@@ -46,6 +46,13 @@ typedef struct {
     uint32_t timeout_ms;
     uart_inst_t *uart;
     ringbuf_t ringbuf;
+    // When RX DMA is in use, received bytes land in rx_dma_buffer instead of ringbuf.
+    int8_t rx_dma_channel;
+    uint8_t *rx_dma_alloc;
+    uint8_t *rx_dma_buffer;
+    uint32_t rx_dma_size;
+    uint32_t rx_dma_base;
+    uint32_t rx_dma_read;
 } busio_uart_obj_t;
 
 extern void reset_uart(void);
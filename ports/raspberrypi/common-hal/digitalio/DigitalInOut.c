@@ -33,6 +33,7 @@
 #include "common-hal/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
+#include "common-hal/neopixel_write/__init__.h"
 #include "supervisor/shared/translate/translate.h"
 
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
@@ -78,6 +79,9 @@ void common_hal_digitalio_digitalinout_deinit(digitalio_digitalinout_obj_t *self
     if (common_hal_digitalio_digitalinout_deinited(self)) {
         return;
     }
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    neopixel_write_finish_pin(self->pin->number);
+    #endif
     common_hal_reset_pin(self->pin);
     self->pin = NULL;
 }
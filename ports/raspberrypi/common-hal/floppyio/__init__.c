@@ -0,0 +1,138 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "common-hal/floppyio/__init__.h"
+
+#include <string.h>
+
+#include "bindings/rp2pio/StateMachine.h"
+#include "py/runtime.h"
+
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
+#include "src/rp2_common/hardware_pio/include/hardware/pio.h"
+#include "src/rp2_common/hardware_pio/include/hardware/pio_instructions.h"
+
+// Each count takes two PIO cycles whether the data line is high or low.
+// X counts down from the value pulled at the start, and the six cycles spent
+// between one falling edge and the next count are added by preloading it
+// three short of 255. A pulse that runs out of counts is stored as 255.
+#define FLUX_START_COUNT (255 - 3)
+
+STATIC void build_program(floppyio_capture_t *self, uint data) {
+    const uint16_t program[] = {
+        pio_encode_pull(false, true),
+        // Start timing at a falling edge.
+        pio_encode_wait_gpio(1, data),
+        pio_encode_wait_gpio(0, data),
+        // .wrap_target
+        pio_encode_mov(pio_x, pio_osr),
+        // low: count until the line rises.
+        pio_encode_jmp_pin(8),
+        pio_encode_jmp_x_dec(4),
+        pio_encode_mov(pio_x, pio_null),
+        pio_encode_wait_gpio(1, data),
+        // high: count until the line falls.
+        pio_encode_jmp_pin(10),
+        pio_encode_jmp(13),
+        pio_encode_jmp_x_dec(8),
+        pio_encode_mov(pio_x, pio_null),
+        pio_encode_wait_gpio(0, data),
+        // done: store the count.
+        pio_encode_mov_not(pio_x, pio_x),
+        pio_encode_in(pio_x, 8),
+        pio_encode_push(false, false),
+        // .wrap
+    };
+    MP_STATIC_ASSERT(sizeof(program) == sizeof(self->program));
+    memcpy(self->program, program, sizeof(program));
+}
+
+bool floppyio_capture_start(floppyio_capture_t *self, uint8_t *buf, size_t len, uint8_t ring_bits, digitalio_digitalinout_obj_t *data) {
+    self->dma_channel = dma_claim_unused_channel(false);
+    if (self->dma_channel == -1) {
+        return false;
+    }
+    build_program(self, data->pin->number);
+    // The pins stay with their DigitalInOuts. PIO can read a pin whatever
+    // function it is set to, so nothing is claimed or reconfigured.
+    bool ok = rp2pio_statemachine_construct(&self->state_machine,
+        self->program, MP_ARRAY_SIZE(self->program),
+        FLOPPYIO_SAMPLERATE * 2, // two cycles per count
+        NULL, 0, // init program
+        NULL, 0, // out
+        NULL, 0, // in
+        0, 0, // in pulls
+        NULL, 0, // set
+        NULL, 0, // sideset
+        0, 0, // initial pin state
+        data->pin, // jump pin
+        0, true, true,
+        false, 32, false, // no auto pull
+        false, // wait for TX stall
+        false, 32, false, // no auto push, count in the low byte
+        false, // claim pins
+        false, // Not user-interruptible.
+        false, // No sideset enable
+        3, -1); // wrap settings
+    if (!ok) {
+        dma_channel_unclaim(self->dma_channel);
+        return false;
+    }
+
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+    self->len = ring_bits ? UINT32_MAX : len;
+
+    dma_channel_config c = dma_channel_get_default_config(self->dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    if (ring_bits) {
+        channel_config_set_ring(&c, true, ring_bits);
+    }
+    dma_channel_configure(self->dma_channel, &c,
+        buf,
+        (const volatile uint8_t *)&pio->rxf[sm],
+        self->len,
+        true);
+
+    pio_sm_put_blocking(pio, sm, FLUX_START_COUNT);
+    return true;
+}
+
+size_t floppyio_capture_count(floppyio_capture_t *self) {
+    return self->len - dma_channel_hw_addr(self->dma_channel)->transfer_count;
+}
+
+void floppyio_capture_stop(floppyio_capture_t *self) {
+    pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+    dma_channel_abort(self->dma_channel);
+    dma_channel_unclaim(self->dma_channel);
+    self->dma_channel = -1;
+    rp2pio_statemachine_deinit(&self->state_machine, true);
+}
@@ -24,14 +24,27 @@
  * THE SOFTWARE.
  */
 
+
 #pragma once
 
-// empirical-ish from RP2040 @ 125MHz for floppy_flux_readinto
+#include "common-hal/rp2pio/StateMachine.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+
+// A PIO state machine times each flux transition and DMA stores the counts,
+// so reads leave interrupts enabled and do not depend on the CPU clock.
 #define FLOPPYIO_SAMPLERATE (24000000)
-// empirical-ish from RP2040 @ 125MHz for floppy_mfm_readinto
-// my guess is these are slower because the more complex routine falls out of cache, but it's just
-// speculation because the loops are very similar. When looking at raw bins with a modified
-// version of adafruit_floppy, it can be seen that there are _two_ peaks for T2 and T3, rather
-// than a single one, around 36 (mostly) and 43 (rarer), compared to a single peak around 48.
-#define T2_5 (54)
-#define T3_5 (75)
+#define FLOPPYIO_FLUX_CAPTURE (1)
+
+typedef struct {
+    rp2pio_statemachine_obj_t state_machine;
+    uint16_t program[16];
+    int dma_channel;
+    size_t len;
+} floppyio_capture_t;
+
+// Start storing flux counts in buf. With ring_bits, buf is a ring of
+// 1 << ring_bits bytes aligned to its size, refilled until stopped.
+bool floppyio_capture_start(floppyio_capture_t *self, uint8_t *buf, size_t len, uint8_t ring_bits, digitalio_digitalinout_obj_t *data);
+// How many counts have been stored since the start, including any overwritten in a ring.
+size_t floppyio_capture_count(floppyio_capture_t *self);
+void floppyio_capture_stop(floppyio_capture_t *self);
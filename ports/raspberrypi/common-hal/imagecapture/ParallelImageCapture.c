@@ -120,12 +120,15 @@ void common_hal_imagecapture_parallelimagecapture_construct(imagecapture_paralle
         true, 32, true,  // in settings
         false, // Not user-interruptible.
         2, 5); // wrap settings
+
+    self->buffer1 = self->buffer2 = self->held = MP_OBJ_NULL;
 }
 
 void common_hal_imagecapture_parallelimagecapture_deinit(imagecapture_parallelimagecapture_obj_t *self) {
     if (common_hal_imagecapture_parallelimagecapture_deinited(self)) {
         return;
     }
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
     return common_hal_rp2pio_statemachine_deinit(&self->state_machine);
 }
 
@@ -133,10 +136,8 @@ bool common_hal_imagecapture_parallelimagecapture_deinited(imagecapture_parallel
     return common_hal_rp2pio_statemachine_deinited(&self->state_machine);
 }
 
-void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer) {
-    mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_RW);
-
+// Restart the program so that it waits for the start of the next frame.
+STATIC void imagecapture_restart(imagecapture_parallelimagecapture_obj_t *self) {
     PIO pio = self->state_machine.pio;
     uint sm = self->state_machine.state_machine;
     uint8_t offset = rp2pio_statemachine_program_offset(&self->state_machine);
@@ -147,8 +148,77 @@ void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecaptur
     pio_sm_restart(pio, sm);
     pio_sm_exec(pio, sm, pio_encode_jmp(offset));
     pio_sm_set_enabled(pio, sm, true);
+}
+
+void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_RW);
+
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
+    imagecapture_restart(self);
 
     common_hal_rp2pio_statemachine_readinto(&self->state_machine, bufinfo.buf, bufinfo.len, 4, false);
 
-    pio_sm_set_enabled(pio, sm, false);
+    pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+}
+
+// Frames are read back to back, one DMA transfer per frame. The DMA fills buffer1 once and then
+// loops on buffer2. Each get_frame() queues the frame it handed out last time to loop on next, and
+// waits for the DMA to move to it. The frame it then returns is complete and is not written to
+// until the following get_frame().
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_start(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer1, mp_obj_t buffer2) {
+    sm_buf_info once = { .obj = buffer1 };
+    sm_buf_info loop = { .obj = buffer2 };
+    mp_get_buffer_raise(buffer1, &once.info, MP_BUFFER_RW);
+    mp_get_buffer_raise(buffer2, &loop.info, MP_BUFFER_RW);
+    if (once.info.len != loop.info.len) {
+        mp_raise_ValueError(translate("Buffers must be same size"));
+    }
+
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
+    imagecapture_restart(self);
+
+    if (!common_hal_rp2pio_statemachine_background_read(&self->state_machine, &once, &loop, 4, false)) {
+        pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+    self->buffer1 = buffer1;
+    self->buffer2 = buffer2;
+    self->held = MP_OBJ_NULL;
+}
+
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->buffer1 == MP_OBJ_NULL) {
+        return;
+    }
+    common_hal_rp2pio_statemachine_stop_background_read(&self->state_machine);
+    pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+    self->buffer1 = self->buffer2 = self->held = MP_OBJ_NULL;
+}
+
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->buffer1 == MP_OBJ_NULL) {
+        mp_raise_RuntimeError(translate("No capture in progress"));
+    }
+
+    mp_obj_t next = self->buffer1;
+    mp_obj_t writing = self->buffer2;
+    if (self->held != MP_OBJ_NULL) {
+        writing = self->held;
+        next = writing == self->buffer1 ? self->buffer2 : self->buffer1;
+        sm_buf_info info = { .obj = writing };
+        mp_get_buffer_raise(writing, &info.info, MP_BUFFER_RW);
+        common_hal_rp2pio_statemachine_background_read(&self->state_machine, &info, &info, 4, false);
+    }
+
+    // The DMA interrupt updates current_read when it moves to the next buffer.
+    while (*(volatile mp_obj_t *)&self->state_machine.current_read.obj != writing) {
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            return mp_const_none;
+        }
+    }
+
+    self->held = next;
+    return next;
 }
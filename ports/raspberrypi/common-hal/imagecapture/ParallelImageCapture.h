@@ -32,4 +32,6 @@
 struct imagecapture_parallelimagecapture_obj {
     mp_obj_base_t base;
     rp2pio_statemachine_obj_t state_machine;
+    // The continuous capture buffers, and the one last returned by get_frame.
+    mp_obj_t buffer1, buffer2, held;
 };
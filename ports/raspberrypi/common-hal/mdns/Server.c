@@ -46,6 +46,8 @@ STATIC bool object_inited = false;
 #define NETIF_STA (&cyw43_state.netif[CYW43_ITF_STA])
 #define NETIF_AP (&cyw43_state.netif[CYW43_ITF_AP])
 
+STATIC void stop_search(void);
+
 void mdns_server_construct(mdns_server_obj_t *self, bool workflow) {
     if (object_inited) {
         // Mark the object as deinit since another is already using MDNS.
@@ -60,6 +62,7 @@ void mdns_server_construct(mdns_server_obj_t *self, bool workflow) {
         mdns_resp_restart(NETIF_STA);
     }
     self->inited = true;
+    object_inited = true;
 
     uint8_t mac[6];
     wifi_radio_get_mac_address(&common_hal_wifi_radio_obj, mac);
@@ -92,6 +95,7 @@ void common_hal_mdns_server_deinit(mdns_server_obj_t *self) {
     }
     self->inited = false;
     object_inited = false;
+    stop_search();
     mdns_resp_remove_netif(NETIF_STA);
 }
 
@@ -121,13 +125,6 @@ void common_hal_mdns_server_set_instance_name(mdns_server_obj_t *self, const cha
     self->instance_name = instance_name;
 }
 
-typedef struct {
-    uint8_t request_id;
-    size_t i;
-    mdns_remoteservice_obj_t *out;
-    size_t out_len;
-} nonalloc_search_state_t;
-
 STATIC void copy_data_into_remote_service(struct mdns_answer *answer, const char *varpart, int varlen, mdns_remoteservice_obj_t *out) {
     if (varlen > 0) {
         if (answer->info.type == DNS_RRTYPE_A) {
@@ -167,129 +164,172 @@ STATIC void copy_data_into_remote_service(struct mdns_answer *answer, const char
     }
 }
 
-STATIC void search_result_cb(struct mdns_answer *answer, const char *varpart, int varlen, int flags, void *arg) {
-    nonalloc_search_state_t *state = arg;
-    state->out[state->i].base.type = &mdns_remoteservice_type;
+// Discovered services are cached until their DNS TTL runs out. The cache and the search that
+// keeps filling it are not on the VM heap, so both carry on across soft reloads and find() can
+// answer from them without waiting again.
+#define SERVICE_CACHE_SIZE (32)
+// Re-send the query this often so that services that appeared since are found.
+#define SEARCH_REFRESH_MS (60 * 1000)
 
-    copy_data_into_remote_service(answer, varpart, varlen, &state->out[state->i]);
+typedef struct {
+    mdns_remoteservice_obj_t service;
+    uint64_t expires_ms;
+} cached_service_t;
+
+STATIC cached_service_t service_cache[SERVICE_CACHE_SIZE];
+// The result being received, which is added to the cache once its last record arrives.
+STATIC cached_service_t pending_service;
+
+STATIC uint8_t search_request_id = MDNS_MAX_REQUESTS;
+STATIC char search_service_type[sizeof(pending_service.service.service_name)];
+STATIC enum mdns_sd_proto search_proto;
+// When the search for this type first started, and when its query was last sent.
+STATIC uint64_t search_started_ms;
+STATIC uint64_t search_sent_ms;
+
+STATIC void cache_add(const cached_service_t *entry) {
+    cached_service_t *match = NULL;
+    cached_service_t *oldest = &service_cache[0];
+    for (size_t i = 0; i < SERVICE_CACHE_SIZE; i++) {
+        cached_service_t *cached = &service_cache[i];
+        if (strcmp(cached->service.instance_name, entry->service.instance_name) == 0 &&
+            strcmp(cached->service.service_name, entry->service.service_name) == 0 &&
+            strcmp(cached->service.protocol, entry->service.protocol) == 0) {
+            match = cached;
+            break;
+        }
+        if (cached->expires_ms < oldest->expires_ms) {
+            oldest = cached;
+        }
+    }
+    if (entry->expires_ms <= supervisor_ticks_ms64()) {
+        // A TTL of zero says that the service has gone away.
+        if (match != NULL) {
+            match->expires_ms = 0;
+        }
+        return;
+    }
+    // A new service replaces whichever entry expires first.
+    *(match != NULL ? match : oldest) = *entry;
+}
 
-    if ((flags & MDNS_SEARCH_RESULT_LAST) != 0) {
-        state->i += 1;
+STATIC void cache_search_result_cb(struct mdns_answer *answer, const char *varpart, int varlen, int flags, void *arg) {
+    (void)arg;
+    if ((flags & MDNS_SEARCH_RESULT_FIRST) != 0) {
+        memset(&pending_service, 0, sizeof(pending_service));
+        pending_service.expires_ms = UINT64_MAX;
     }
 
-    if (state->i == state->out_len) {
-        mdns_search_stop(state->request_id);
-        state->request_id = MDNS_MAX_REQUESTS;
+    copy_data_into_remote_service(answer, varpart, varlen, &pending_service.service);
+    pending_service.expires_ms = MIN(pending_service.expires_ms, supervisor_ticks_ms64() + answer->ttl * 1000ULL);
+
+    if ((flags & MDNS_SEARCH_RESULT_LAST) != 0 && pending_service.service.instance_name[0] != '\0') {
+        cache_add(&pending_service);
     }
 }
 
-size_t mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol,
-    mp_float_t timeout, mdns_remoteservice_obj_t *out, size_t out_len) {
+STATIC void stop_search(void) {
+    if (search_request_id < MDNS_MAX_REQUESTS) {
+        mdns_search_stop(search_request_id);
+        search_request_id = MDNS_MAX_REQUESTS;
+    }
+}
 
+// Make sure the background search is for the given service and return when it started, or 0
+// if it could not be started.
+STATIC uint64_t start_search(const char *service_type, const char *protocol) {
     enum mdns_sd_proto proto = DNSSD_PROTO_UDP;
     if (strcmp(protocol, "_tcp") == 0) {
         proto = DNSSD_PROTO_TCP;
     }
 
-    nonalloc_search_state_t state;
-    state.i = 0;
-    state.out = out;
-    state.out_len = out_len;
+    uint64_t now = supervisor_ticks_ms64();
+    bool same_search = search_request_id < MDNS_MAX_REQUESTS && search_proto == proto &&
+        strcmp(search_service_type, service_type) == 0;
+    if (same_search && now - search_sent_ms < SEARCH_REFRESH_MS) {
+        return search_started_ms;
+    }
+    stop_search();
 
     err_t err = mdns_search_service(NULL, service_type, proto,
-        NETIF_STA, &search_result_cb, &state,
-        &state.request_id);
+        NETIF_STA, &cache_search_result_cb, NULL,
+        &search_request_id);
     if (err != ERR_OK) {
+        search_request_id = MDNS_MAX_REQUESTS;
         return 0;
     }
+    if (!same_search) {
+        strncpy(search_service_type, service_type, sizeof(search_service_type) - 1);
+        search_service_type[sizeof(search_service_type) - 1] = '\0';
+        search_proto = proto;
+        search_started_ms = now;
+    }
+    search_sent_ms = now;
+    return search_started_ms;
+}
 
-    uint64_t start_ticks = supervisor_ticks_ms64();
+// Wait until the search has run for timeout seconds, which is immediately if an earlier find()
+// started it long enough ago.
+STATIC void wait_for_search(uint64_t started_ms, mp_float_t timeout) {
     uint64_t timeout_ms = timeout * 1000;
-
-    while (state.request_id < MDNS_MAX_REQUESTS &&
-           !mp_hal_is_interrupted() &&
-           supervisor_ticks_ms64() - start_ticks < timeout_ms) {
+    while (!mp_hal_is_interrupted() &&
+           supervisor_ticks_ms64() - started_ms < timeout_ms) {
         RUN_BACKGROUND_TASKS;
     }
-    if (state.request_id < MDNS_MAX_REQUESTS) {
-        mdns_search_stop(state.request_id);
-        state.request_id = MDNS_MAX_REQUESTS;
-    }
-
-    return state.i;
 }
 
-typedef struct {
-    uint8_t request_id;
-    mdns_remoteservice_obj_t *head;
-    size_t count;
-} alloc_search_state_t;
-
-STATIC void alloc_search_result_cb(struct mdns_answer *answer, const char *varpart, int varlen, int flags, void *arg) {
-    alloc_search_state_t *state = arg;
+STATIC bool cached_service_matches(const cached_service_t *cached, const char *service_type, const char *protocol, uint64_t now) {
+    return cached->expires_ms > now &&
+           strncmp(cached->service.service_name, service_type, sizeof(cached->service.service_name) - 1) == 0 &&
+           strncmp(cached->service.protocol, protocol, sizeof(cached->service.protocol) - 1) == 0;
+}
 
-    if ((flags & MDNS_SEARCH_RESULT_FIRST) != 0) {
-        // first
-        mdns_remoteservice_obj_t *service = gc_alloc(sizeof(mdns_remoteservice_obj_t), 0, false);
-        if (service == NULL) {
-            // alloc fails
-            mdns_search_stop(state->request_id);
-            state->request_id = MDNS_MAX_REQUESTS;
-            if (state->count == 0) {
-                m_malloc_fail(sizeof(mdns_remoteservice_obj_t));
+size_t mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol,
+    mp_float_t timeout, mdns_remoteservice_obj_t *out, size_t out_len) {
+    uint64_t started_ms = start_search(service_type, protocol);
+    if (started_ms == 0) {
+        return 0;
+    }
+    wait_for_search(started_ms, timeout);
+
+    uint64_t now = supervisor_ticks_ms64();
+    size_t count = 0;
+    for (size_t i = 0; i < SERVICE_CACHE_SIZE; i++) {
+        if (cached_service_matches(&service_cache[i], service_type, protocol, now)) {
+            if (count < out_len) {
+                out[count] = service_cache[i].service;
+                out[count].base.type = &mdns_remoteservice_type;
             }
-            return;
+            count++;
         }
-        service->base.type = &mdns_remoteservice_type;
-        state->count++;
-        service->next = state->head;
-        state->head = service;
     }
-
-    copy_data_into_remote_service(answer, varpart, varlen, state->head);
+    return count;
 }
 
 mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
-    enum mdns_sd_proto proto = DNSSD_PROTO_UDP;
-    if (strcmp(protocol, "_tcp") == 0) {
-        proto = DNSSD_PROTO_TCP;
-    }
-
-    alloc_search_state_t state;
-    state.count = 0;
-    state.head = NULL;
-
-    err_t err = mdns_search_service(NULL, service_type, proto,
-        NETIF_STA, &alloc_search_result_cb, &state,
-        &state.request_id);
-    if (err != ERR_OK) {
+    uint64_t started_ms = start_search(service_type, protocol);
+    if (started_ms == 0) {
         mp_raise_RuntimeError(translate("Unable to start mDNS query"));
     }
+    wait_for_search(started_ms, timeout);
 
-    uint64_t start_ticks = supervisor_ticks_ms64();
-    uint64_t timeout_ms = timeout * 1000;
-
-    while (state.request_id < MDNS_MAX_REQUESTS &&
-           !mp_hal_is_interrupted() &&
-           supervisor_ticks_ms64() - start_ticks < timeout_ms) {
-        RUN_BACKGROUND_TASKS;
-    }
-    if (state.request_id < MDNS_MAX_REQUESTS) {
-        mdns_search_stop(state.request_id);
-        state.request_id = MDNS_MAX_REQUESTS;
+    uint64_t now = supervisor_ticks_ms64();
+    size_t count = 0;
+    for (size_t i = 0; i < SERVICE_CACHE_SIZE; i++) {
+        if (cached_service_matches(&service_cache[i], service_type, protocol, now)) {
+            count++;
+        }
     }
-
-    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(state.count, NULL));
-    mdns_remoteservice_obj_t *next = state.head;
-    uint8_t added = 0;
-    while (next != NULL) {
-        mdns_remoteservice_obj_t *cur = next;
-        tuple->items[added] = MP_OBJ_FROM_PTR(cur);
-        next = cur->next;
-        // Set next back to NULL so that each service object is independently
-        // tracked for GC.
-        cur->next = NULL;
-        added++;
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
+    size_t added = 0;
+    for (size_t i = 0; i < SERVICE_CACHE_SIZE && added < count; i++) {
+        if (cached_service_matches(&service_cache[i], service_type, protocol, now)) {
+            mdns_remoteservice_obj_t *service = m_new_obj(mdns_remoteservice_obj_t);
+            *service = service_cache[i].service;
+            service->base.type = &mdns_remoteservice_type;
+            service->next = NULL;
+            tuple->items[added++] = MP_OBJ_FROM_PTR(service);
+        }
     }
 
     return MP_OBJ_FROM_PTR(tuple);
@@ -311,7 +351,13 @@ void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const cha
         }
     }
     if (existing_slot < MDNS_MAX_SERVICES) {
+        // The web workflow advertises again after every reload. Don't announce the service
+        // all over again when nothing about it has changed.
+        if (self->service_port[existing_slot] == port) {
+            return;
+        }
         mdns_resp_del_service(NETIF_STA, existing_slot);
+        self->service_type[existing_slot] = NULL;
     }
     int8_t slot = mdns_resp_add_service(NETIF_STA, self->instance_name, service_type, proto, port, NULL, NULL);
     if (slot < 0) {
@@ -319,4 +365,5 @@ void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const cha
         return;
     }
     self->service_type[slot] = service_type;
+    self->service_port[slot] = port;
 }
@@ -36,6 +36,7 @@ typedef struct {
     const char *instance_name;
     char default_hostname[sizeof("cpy-XXXXXX")];
     const char *service_type[MDNS_MAX_SERVICES];
+    uint16_t service_port[MDNS_MAX_SERVICES];
     // Track if this object owns access to the underlying MDNS service.
     bool inited;
 } mdns_server_obj_t;
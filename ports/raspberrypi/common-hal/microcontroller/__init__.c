@@ -88,6 +88,9 @@ void common_hal_mcu_on_next_reset(mcu_runmode_t runmode) {
 
 void common_hal_mcu_reset(void) {
     filesystem_flush();
+    #if CIRCUITPY_NVM
+    common_hal_nvm_bytearray_flush(&common_hal_mcu_nvm_obj);
+    #endif
     if (next_reset_to_bootloader) {
         reset_to_bootloader();
     } else {
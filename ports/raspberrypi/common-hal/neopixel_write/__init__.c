@@ -24,15 +24,22 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-bindings/neopixel_write/__init__.h"
+#include "common-hal/neopixel_write/__init__.h"
 
 #include "bindings/rp2pio/StateMachine.h"
+#include "common-hal/microcontroller/Pin.h"
 #include "common-hal/rp2pio/StateMachine.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 
+#include "py/runtime.h"
 #include "supervisor/port.h"
 
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
+
 uint64_t next_start_raw_ticks = 0;
 
 // NeoPixels are 800khz bit streams. We are choosing zeros as <312ns hi, 936 lo> and ones
@@ -54,14 +61,9 @@ const uint16_t neopixel_program[] = {
     0xa442
 };
 
-void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
-    // Set everything up.
-    rp2pio_statemachine_obj_t state_machine;
-
-    // TODO: Cache the state machine after we create it once. We'll need a way to
-    // change the pins then though.
+STATIC bool _construct(rp2pio_statemachine_obj_t *state_machine, const digitalio_digitalinout_obj_t *digitalinout) {
     uint32_t pins_we_use = 1 << digitalinout->pin->number;
-    bool ok = rp2pio_statemachine_construct(&state_machine,
+    return rp2pio_statemachine_construct(state_machine,
         neopixel_program, sizeof(neopixel_program) / sizeof(neopixel_program[0]),
         12800000, // 12.8MHz, to get appropriate sub-bit times in PIO program.
         NULL, 0, // init program
@@ -80,6 +82,81 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
         false, // Not user-interruptible.
         false, // No sideset enable
         0, -1); // wrap
+}
+
+STATIC void _release(rp2pio_statemachine_obj_t *state_machine, const digitalio_digitalinout_obj_t *digitalinout) {
+    // Use a private deinit of the state machine that doesn't reset the pin.
+    rp2pio_statemachine_deinit(state_machine, true);
+
+    // Reset the pin and release it from the PIO
+    gpio_init(digitalinout->pin->number);
+    common_hal_digitalio_digitalinout_switch_to_output((digitalio_digitalinout_obj_t *)digitalinout, false, DRIVE_MODE_PUSH_PULL);
+
+    // Update the next start to +2 ticks. This ensures we give it at least 300us.
+    next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
+}
+
+#if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+// One strip at a time may be sent in the background. Its state machine stays set up
+// until the next write, which waits for it to finish first. Only the pin number is kept
+// because the DigitalInOut may be deinited or collected in the meantime; the copy of the
+// pixels is held in a root pointer so it outlives the call.
+STATIC rp2pio_statemachine_obj_t _background_state_machine;
+STATIC int _background_dma_channel = -1;
+STATIC uint8_t _background_pin_number;
+// True while a finished write waits for its last bits. A background task may write again.
+STATIC bool _background_finishing = false;
+STATIC size_t _background_buffer_len = 0;
+
+STATIC void _finish_background_write(void) {
+    int channel = _background_dma_channel;
+    if (channel == -1) {
+        return;
+    }
+    // Clear the state first so that a write from a background task doesn't wait on it too.
+    _background_dma_channel = -1;
+    _background_finishing = true;
+    rp2pio_statemachine_obj_t *state_machine = &_background_state_machine;
+    while (dma_channel_is_busy(channel)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    // Clear the stall bit so we can detect when the state machine is done transmitting.
+    uint32_t stall_mask = 1 << (PIO_FDEBUG_TXSTALL_LSB + state_machine->state_machine);
+    state_machine->pio->fdebug = stall_mask;
+    while (!pio_sm_is_tx_fifo_empty(state_machine->pio, state_machine->state_machine) ||
+           (state_machine->pio->fdebug & stall_mask) == 0) {
+        RUN_BACKGROUND_TASKS;
+    }
+    dma_channel_unclaim(channel);
+
+    // Like _release() but the pin is only driven low if a DigitalInOut still owns it.
+    rp2pio_statemachine_deinit(state_machine, true);
+    gpio_init(_background_pin_number);
+    if (!pin_number_is_free(_background_pin_number)) {
+        gpio_set_dir(_background_pin_number, GPIO_OUT);
+    }
+    next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
+    _background_finishing = false;
+}
+
+void neopixel_write_finish_pin(uint8_t pin_number) {
+    if (_background_dma_channel != -1 && _background_pin_number == pin_number) {
+        _finish_background_write();
+    }
+}
+#endif
+
+void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    _finish_background_write();
+    #endif
+
+    // Set everything up.
+    rp2pio_statemachine_obj_t state_machine;
+
+    // TODO: Cache the state machine after we create it once. We'll need a way to
+    // change the pins then though.
+    bool ok = _construct(&state_machine, digitalinout);
     if (!ok) {
         // Do nothing. Maybe bitbang?
         return;
@@ -92,13 +169,65 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
 
     common_hal_rp2pio_statemachine_write(&state_machine, pixels, num_bytes, 1 /* stride in bytes */, false);
 
-    // Use a private deinit of the state machine that doesn't reset the pin.
-    rp2pio_statemachine_deinit(&state_machine, true);
+    _release(&state_machine, digitalinout);
+}
 
-    // Reset the pin and release it from the PIO
-    gpio_init(digitalinout->pin->number);
-    common_hal_digitalio_digitalinout_switch_to_output((digitalio_digitalinout_obj_t *)digitalinout, false, DRIVE_MODE_PUSH_PULL);
+#if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+void common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
+    _finish_background_write();
 
-    // Update the next start to +2 ticks. This ensures we give it at least 300us.
-    next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
+    // The state machine is still in use when called from a background task while it finishes.
+    int channel = _background_finishing ? -1 : dma_claim_unused_channel(false);
+    if (channel == -1) {
+        common_hal_neopixel_write(digitalinout, pixels, num_bytes);
+        return;
+    }
+    rp2pio_statemachine_obj_t *state_machine = &_background_state_machine;
+    if (!_construct(state_machine, digitalinout)) {
+        dma_channel_unclaim(channel);
+        return;
+    }
+
+    // Copy the pixels so the caller can start on the next frame straight away.
+    if (_background_buffer_len < num_bytes) {
+        MP_STATE_PORT(neopixel_write_buffer) = NULL;
+        MP_STATE_PORT(neopixel_write_buffer) = m_malloc(num_bytes, false);
+        _background_buffer_len = num_bytes;
+    }
+    uint8_t *buffer = MP_STATE_PORT(neopixel_write_buffer);
+    memcpy(buffer, pixels, num_bytes);
+
+    _background_dma_channel = channel;
+    _background_pin_number = digitalinout->pin->number;
+
+    // Wait to make sure we don't append onto the last transmission.
+    while (port_get_raw_ticks(NULL) < next_start_raw_ticks) {
+    }
+
+    // Bytes go in the top of the FIFO word because the state machine shifts out msb first.
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, pio_get_dreq(state_machine->pio, state_machine->state_machine, true));
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(channel, &c,
+        (volatile uint8_t *)&state_machine->pio->txf[state_machine->state_machine] + 3,
+        buffer,
+        num_bytes,
+        true);
+}
+#endif
+
+void neopixel_write_reset(void) {
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    if (_background_dma_channel != -1) {
+        dma_channel_abort(_background_dma_channel);
+        dma_channel_unclaim(_background_dma_channel);
+        _background_dma_channel = -1;
+        rp2pio_statemachine_deinit(&_background_state_machine, true);
+    }
+    _background_finishing = false;
+    MP_STATE_PORT(neopixel_write_buffer) = NULL;
+    _background_buffer_len = 0;
+    #endif
 }
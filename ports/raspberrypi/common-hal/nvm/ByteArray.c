@@ -32,90 +32,111 @@
 #include "py/runtime.h"
 #include "src/rp2_common/hardware_flash/include/hardware/flash.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "supervisor/shared/tick.h"
 
 extern uint32_t __flash_binary_start;
 static const uint32_t flash_binary_start = (uint32_t)&__flash_binary_start;
 
 #define RMV_OFFSET(addr) addr - flash_binary_start
 
+// Writes are staged in RAM and committed to flash together, either by flush() or once no write
+// has happened for NVM_COMMIT_DELAY_MS. Committing only erases the sector when a staged byte needs
+// a bit changed from 0 to 1. Otherwise just the changed pages are programmed.
+#define NVM_COMMIT_DELAY_MS (1000)
+#define NVM_PAGES (CIRCUITPY_INTERNAL_NVM_SIZE / FLASH_PAGE_SIZE)
+
+static uint8_t staged[CIRCUITPY_INTERNAL_NVM_SIZE];
+static uint32_t staged_pages[(NVM_PAGES + 31) / 32];
+static bool staging = false;
+static uint64_t last_write_ms;
+
 uint32_t common_hal_nvm_bytearray_get_length(const nvm_bytearray_obj_t *self) {
     return self->len;
 }
 
-static void write_page(uint32_t page_addr, uint32_t offset, uint32_t len, uint8_t *bytes) {
-    // Write a whole page to flash, buffering it first and then erasing and rewriting it
-    // since we can only write a whole page at a time.
-    if (offset == 0 && len == FLASH_PAGE_SIZE) {
-        // disable interrupts to prevent core hang on rp2040
-        common_hal_mcu_disable_interrupts();
-        flash_range_program(RMV_OFFSET(page_addr), bytes, FLASH_PAGE_SIZE);
-        common_hal_mcu_enable_interrupts();
-    } else {
-        uint8_t buffer[FLASH_PAGE_SIZE];
-        memcpy(buffer, (uint8_t *)page_addr, FLASH_PAGE_SIZE);
-        memcpy(buffer + offset, bytes, len);
-        common_hal_mcu_disable_interrupts();
-        flash_range_program(RMV_OFFSET(page_addr), buffer, FLASH_PAGE_SIZE);
-        common_hal_mcu_enable_interrupts();
-    }
-
+static void program_page(size_t page) {
+    uint32_t offset = page * FLASH_PAGE_SIZE;
+    // disable interrupts to prevent core hang on rp2040
+    common_hal_mcu_disable_interrupts();
+    flash_range_program(RMV_OFFSET(CIRCUITPY_INTERNAL_NVM_START_ADDR) + offset, staged + offset, FLASH_PAGE_SIZE);
+    common_hal_mcu_enable_interrupts();
 }
 
-static void erase_and_write_sector(uint32_t address, uint32_t len, uint8_t *bytes) {
-    // Write a whole sector to flash, buffering it first and then erasing and rewriting it
-    // since we can only erase a whole sector at a time.
-    uint8_t buffer[FLASH_SECTOR_SIZE];
-    #pragma GCC diagnostic push
-    #if __GNUC__ >= 11
-    // TODO: Update this to a better workaround for GCC 11 when one is provided.
-    // See: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=99578#c20
-    #pragma GCC diagnostic ignored "-Warray-bounds"
-    #pragma GCC diagnostic ignored "-Wstringop-overread"
-    #endif
-    memcpy(buffer, (uint8_t *)CIRCUITPY_INTERNAL_NVM_START_ADDR, FLASH_SECTOR_SIZE);
-    #pragma GCC diagnostic pop
-    memcpy(buffer + address, bytes, len);
+static void erase_and_write_sector(void) {
     // disable interrupts to prevent core hang on rp2040
     common_hal_mcu_disable_interrupts();
     flash_range_erase(RMV_OFFSET(CIRCUITPY_INTERNAL_NVM_START_ADDR), FLASH_SECTOR_SIZE);
-    flash_range_program(RMV_OFFSET(CIRCUITPY_INTERNAL_NVM_START_ADDR), buffer, FLASH_SECTOR_SIZE);
+    flash_range_program(RMV_OFFSET(CIRCUITPY_INTERNAL_NVM_START_ADDR), staged, FLASH_SECTOR_SIZE);
     common_hal_mcu_enable_interrupts();
 }
 
+static bool page_is_staged(size_t page) {
+    return (staged_pages[page / 32] & (1u << (page % 32))) != 0;
+}
+
+void common_hal_nvm_bytearray_flush(const nvm_bytearray_obj_t *self) {
+    (void)self;
+    if (!staging) {
+        return;
+    }
+    const uint8_t *flash = (const uint8_t *)CIRCUITPY_INTERNAL_NVM_START_ADDR;
+    bool needs_erase = false;
+    for (size_t i = 0; i < CIRCUITPY_INTERNAL_NVM_SIZE && !needs_erase; i++) {
+        // Programming can only clear bits.
+        needs_erase = (flash[i] & staged[i]) != staged[i];
+    }
+    if (needs_erase) {
+        erase_and_write_sector();
+    } else {
+        for (size_t page = 0; page < NVM_PAGES; page++) {
+            if (page_is_staged(page) && memcmp(flash + page * FLASH_PAGE_SIZE, staged + page * FLASH_PAGE_SIZE, FLASH_PAGE_SIZE) != 0) {
+                program_page(page);
+            }
+        }
+    }
+    memset(staged_pages, 0, sizeof(staged_pages));
+    staging = false;
+    supervisor_disable_tick();
+}
+
+void nvm_bytearray_background(void) {
+    if (staging && supervisor_ticks_ms64() - last_write_ms >= NVM_COMMIT_DELAY_MS) {
+        common_hal_nvm_bytearray_flush(&common_hal_mcu_nvm_obj);
+    }
+}
+
 void common_hal_nvm_bytearray_get_bytes(const nvm_bytearray_obj_t *self,
     uint32_t start_index, uint32_t len, uint8_t *values) {
-    memcpy(values, self->start_address + start_index, len);
+    if (staging) {
+        memcpy(values, staged + start_index, len);
+    } else {
+        memcpy(values, self->start_address + start_index, len);
+    }
 }
 
 bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
     uint32_t start_index, uint8_t *values, uint32_t len) {
-    uint8_t values_in[len];
-    common_hal_nvm_bytearray_get_bytes(self, start_index, len, values_in);
-
-    bool all_ones = true;
-    for (uint32_t i = 0; i < len; i++) {
-        if (values_in[i] != UINT8_MAX) {
-            all_ones = false;
-            break;
-        }
+    if (!staging) {
+        #pragma GCC diagnostic push
+        #if __GNUC__ >= 11
+        // TODO: Update this to a better workaround for GCC 11 when one is provided.
+        // See: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=99578#c20
+        #pragma GCC diagnostic ignored "-Warray-bounds"
+        #pragma GCC diagnostic ignored "-Wstringop-overread"
+        #endif
+        memcpy(staged, (uint8_t *)CIRCUITPY_INTERNAL_NVM_START_ADDR, CIRCUITPY_INTERNAL_NVM_SIZE);
+        #pragma GCC diagnostic pop
+        staging = true;
+        // Keep background ticks running until the staged data is committed.
+        supervisor_enable_tick();
     }
-
-    if (all_ones) {
-        uint32_t address = (uint32_t)self->start_address + start_index;
-        uint32_t offset = address % FLASH_PAGE_SIZE;
-        uint32_t page_addr = address - offset;
-
-        while (len) {
-            uint32_t write_len = MIN(len, FLASH_PAGE_SIZE - offset);
-            write_page(page_addr, offset, write_len, values);
-            len -= write_len;
-            values += write_len;
-            page_addr += FLASH_PAGE_SIZE;
-            offset = 0;
+    memcpy(staged + start_index, values, len);
+    if (len > 0) {
+        for (size_t page = start_index / FLASH_PAGE_SIZE; page <= (start_index + len - 1) / FLASH_PAGE_SIZE; page++) {
+            staged_pages[page / 32] |= 1u << (page % 32);
         }
-    } else {
-        erase_and_write_sector(start_index, len, values);
     }
+    last_write_ms = supervisor_ticks_ms64();
 
     return true;
 }
@@ -35,4 +35,7 @@ typedef struct {
     uint32_t len;
 } nvm_bytearray_obj_t;
 
+// Commits staged writes once they have been left alone for a while.
+void nvm_bytearray_background(void);
+
 #endif // MICROPY_INCLUDED_RASPBERRYPI_COMMON_HAL_NVM_BYTEARRAY_H
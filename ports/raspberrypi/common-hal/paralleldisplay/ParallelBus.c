@@ -27,6 +27,7 @@
 #include "shared-bindings/paralleldisplay/ParallelBus.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "common-hal/microcontroller/Pin.h"
 #include "py/runtime.h"
@@ -35,6 +36,8 @@
 #include "bindings/rp2pio/StateMachine.h"
 #include "common-hal/rp2pio/StateMachine.h"
 
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
+
 static const uint16_t parallel_program[] = {
 // .side_set 1
 // .wrap_target
@@ -164,6 +167,52 @@ void common_hal_paralleldisplay_parallelbus_send(mp_obj_t obj, display_byte_type
     common_hal_rp2pio_statemachine_write(&self->state_machine, data, data_length, 1, false);
 }
 
+bool common_hal_paralleldisplay_parallelbus_send_fill(mp_obj_t obj, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *pattern, uint32_t pattern_length, uint32_t count) {
+    if (pattern_length != 1 && pattern_length != 2 && pattern_length != 4) {
+        return false;
+    }
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+        return false;
+    }
+    paralleldisplay_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
+    rp2pio_statemachine_obj_t *sm = &self->state_machine;
+
+    // The ring wraps the read address on a pattern_length boundary so the
+    // DMA repeats the pattern without any CPU help.
+    uint32_t repeated;
+    memcpy(&repeated, pattern, pattern_length);
+
+    volatile uint8_t *tx_destination = (volatile uint8_t *)&sm->pio->txf[sm->state_machine];
+    if (!sm->out_shift_right) {
+        tx_destination += 3;
+    }
+
+    common_hal_digitalio_digitalinout_set_value(&self->command, byte_type == DISPLAY_DATA);
+
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, sm->tx_dreq);
+    channel_config_set_write_increment(&c, false);
+    if (pattern_length == 1) {
+        channel_config_set_read_increment(&c, false);
+    } else {
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_ring(&c, false, pattern_length == 2 ? 1 : 2);
+    }
+    dma_channel_configure(channel, &c, tx_destination, &repeated, count * pattern_length, true);
+    while (dma_channel_is_busy(channel)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    dma_channel_unclaim(channel);
+
+    while (!pio_sm_is_tx_fifo_empty(sm->pio, sm->state_machine)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    return true;
+}
+
 void common_hal_paralleldisplay_parallelbus_end_transaction(mp_obj_t obj) {
     paralleldisplay_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
@@ -26,12 +26,18 @@
 
 #include "bindings/picodvi/Framebuffer.h"
 
+#include <string.h>
+
 #include "py/gc.h"
 #include "py/runtime.h"
 #include "shared-bindings/time/__init__.h"
 #include "common-hal/pwmio/PWMOut.h"
 #include "common-hal/rp2pio/StateMachine.h"
 
+#if CIRCUITPY_DISPLAYIO_CORE1 || CIRCUITPY_AUDIO_CORE1
+#include "core1_worker.h"
+#endif
+
 #include "src/common/pico_stdlib/include/pico/stdlib.h"
 #include "src/rp2040/hardware_structs/include/hardware/structs/mpu.h"
 #include "src/rp2_common/cmsis/stub/CMSIS/Device/RaspberryPi/RP2040/Include/RP2040.h"
@@ -45,6 +51,15 @@ picodvi_framebuffer_obj_t *active_picodvi = NULL;
 
 STATIC PIO pio_instances[2] = {pio0, pio1};
 
+// The TMDS buffers follow the framebuffers in the allocation.
+static inline uint32_t *_tmds_buffers(picodvi_framebuffer_obj_t *self) {
+    return self->framebuffer + self->framebuffer_len * self->buffer_count;
+}
+
+static inline uint32_t *_framebuffer(picodvi_framebuffer_obj_t *self, uint8_t index) {
+    return self->framebuffer + self->framebuffer_len * index;
+}
+
 static void __not_in_flash_func(core1_main)(void) {
     // The MPU is reset before this starts.
 
@@ -82,7 +97,7 @@ static void __not_in_flash_func(core1_main)(void) {
             // Better than writing the wrong memory that is shared with CP.
             while (index >= DVI_N_TMDS_BUFFERS) {
             }
-            tmdsbuf = self->framebuffer + self->framebuffer_len + (self->tmdsbuf_size * index);
+            tmdsbuf = _tmds_buffers(self) + (self->tmdsbuf_size * index);
             tmdsbuf[self->tmdsbuf_size - 1] = (uint32_t)self->framebuffer;
         }
         uint pixwidth = self->dvi.timing->h_active_pixels;
@@ -114,7 +129,7 @@ static void __not_in_flash_func(core1_main)(void) {
 static void __not_in_flash_func(core1_scanline_callback)(void) {
     picodvi_framebuffer_obj_t *self = active_picodvi;
     uint32_t *next_scanline_buf;
-    next_scanline_buf = self->framebuffer + (self->pitch * self->next_scanline);
+    next_scanline_buf = _framebuffer(self, self->front_buffer) + (self->pitch * self->next_scanline);
     queue_add_blocking_u32(&self->dvi.q_colour_valid, &next_scanline_buf);
 
     // Remove any buffers that were sent back to us.
@@ -125,6 +140,12 @@ static void __not_in_flash_func(core1_scanline_callback)(void) {
         self->next_scanline = 0;
         // Update the framebuffer pointer in case it moved.
         self->framebuffer = self->allocation->ptr;
+        // The last line of the frame is queued, so a swap takes effect from the
+        // first line of the next one and never splits a frame.
+        if (self->swap_pending) {
+            self->front_buffer ^= 1;
+            self->swap_pending = false;
+        }
     }
 }
 
@@ -137,7 +158,7 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
     const mcu_pin_obj_t *red_dp, const mcu_pin_obj_t *red_dn,
     const mcu_pin_obj_t *green_dp, const mcu_pin_obj_t *green_dn,
     const mcu_pin_obj_t *blue_dp, const mcu_pin_obj_t *blue_dn,
-    mp_uint_t color_depth) {
+    mp_uint_t color_depth, bool double_buffer) {
     if (active_picodvi != NULL) {
         mp_raise_msg_varg(&mp_type_RuntimeError, translate("%q in use"), MP_QSTR_picodvi);
     }
@@ -241,8 +262,9 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
     }
     self->pitch /= sizeof(uint32_t);
     size_t framebuffer_size = self->pitch * self->height;
+    self->buffer_count = double_buffer ? 2 : 1;
     self->tmdsbuf_size = tmds_bufs_per_scanline * scanline_width / DVI_SYMBOLS_PER_WORD + 1;
-    size_t total_allocation_size = sizeof(uint32_t) * (framebuffer_size + DVI_N_TMDS_BUFFERS * self->tmdsbuf_size);
+    size_t total_allocation_size = sizeof(uint32_t) * (framebuffer_size * self->buffer_count + DVI_N_TMDS_BUFFERS * self->tmdsbuf_size);
     self->allocation = allocate_memory(total_allocation_size, false, true);
     if (self->allocation == NULL) {
         m_malloc_fail(total_allocation_size);
@@ -272,6 +294,8 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
     self->framebuffer_len = framebuffer_size;
     self->framebuffer = self->allocation->ptr;
     self->color_depth = color_depth;
+    self->front_buffer = 0;
+    self->swap_pending = false;
 
     self->dvi.timing = timing;
     self->dvi.ser_cfg.pio = pio_instances[pio_index];
@@ -294,7 +318,7 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
 
     // Load up the TMDS buffers.
     for (int i = 0; i < DVI_N_TMDS_BUFFERS; ++i) {
-        uint32_t *tmdsbuf = self->framebuffer + (self->framebuffer_len + self->tmdsbuf_size * i);
+        uint32_t *tmdsbuf = _tmds_buffers(self) + self->tmdsbuf_size * i;
         // Use the last word in the buffer to track its original root. That way
         // we can detect when framebuffer is moved.
         tmdsbuf[self->tmdsbuf_size - 1] = (uint32_t)self->framebuffer;
@@ -303,6 +327,10 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
 
     active_picodvi = self;
 
+    #if CIRCUITPY_DISPLAYIO_CORE1 || CIRCUITPY_AUDIO_CORE1
+    core1_worker_deinit();
+    #endif
+
     // Core 1 will wait until it sees the first colour buffer, then start up the
     // DVI signalling.
     multicore_launch_core1(core1_main);
@@ -396,6 +424,32 @@ bool common_hal_picodvi_framebuffer_deinited(picodvi_framebuffer_obj_t *self) {
 void common_hal_picodvi_framebuffer_refresh(picodvi_framebuffer_obj_t *self) {
 }
 
+bool common_hal_picodvi_framebuffer_get_double_buffer(picodvi_framebuffer_obj_t *self) {
+    return self->buffer_count > 1;
+}
+
+void common_hal_picodvi_framebuffer_swap(picodvi_framebuffer_obj_t *self, const uint8_t *dirty_row_bitmask) {
+    if (self->buffer_count == 1) {
+        return;
+    }
+    self->swap_pending = true;
+    // The scanline callback runs on the other core, so this waits at most one frame.
+    while (self->swap_pending) {
+    }
+    if (dirty_row_bitmask == NULL) {
+        return;
+    }
+    // Bring the new back buffer up to date with the rows that just changed so
+    // that the next partial refresh only has to draw its own dirty areas.
+    uint32_t *front = _framebuffer(self, self->front_buffer);
+    uint32_t *back = _framebuffer(self, self->front_buffer ^ 1);
+    for (mp_uint_t y = 0; y < self->height; y++) {
+        if (dirty_row_bitmask[y / 8] & (1 << (y & 7))) {
+            memcpy(back + self->pitch * y, front + self->pitch * y, self->pitch * sizeof(uint32_t));
+        }
+    }
+}
+
 int common_hal_picodvi_framebuffer_get_width(picodvi_framebuffer_obj_t *self) {
     return self->width;
 }
@@ -410,7 +464,8 @@ int common_hal_picodvi_framebuffer_get_color_depth(picodvi_framebuffer_obj_t *se
 
 mp_int_t common_hal_picodvi_framebuffer_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
     picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
-    bufinfo->buf = self->framebuffer;
+    // Drawing goes to the back buffer, which is the front one when single buffered.
+    bufinfo->buf = _framebuffer(self, self->front_buffer ^ (self->buffer_count - 1));
     char typecode = 'B';
     if (self->color_depth == 16) {
         typecode = 'H';
@@ -36,7 +36,7 @@ typedef struct {
     mp_obj_base_t base;
     supervisor_allocation *allocation;
     uint32_t *framebuffer;
-    size_t framebuffer_len; // in words
+    size_t framebuffer_len; // in words, for one of buffer_count framebuffers
     size_t tmdsbuf_size; // in words
     struct dvi_inst dvi;
     mp_uint_t width;
@@ -44,8 +44,18 @@ typedef struct {
     uint tmds_lock;
     uint colour_lock;
     uint16_t next_scanline;
+    // Index of the framebuffer being scanned out. Drawing goes to the other one
+    // when double buffered.
+    volatile uint8_t front_buffer;
+    // Set by swap and cleared by the scanline callback once the back buffer is
+    // shown from the start of a frame.
+    volatile bool swap_pending;
+    uint8_t buffer_count;
     uint16_t pitch; // Number of words between rows. (May be more than a width's worth.)
     uint8_t color_depth;
     uint8_t pwm_slice;
     int8_t pin_pair[4];
 } picodvi_framebuffer_obj_t;
+
+// Set while the DVI output owns the second core.
+extern picodvi_framebuffer_obj_t *active_picodvi;
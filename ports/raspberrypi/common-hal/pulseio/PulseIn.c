@@ -40,8 +40,29 @@
 #define MAX_PULSE 65535
 #define MIN_PULSE 0
 
+// Each pass of a counting loop takes two cycles. Count in quarter microseconds so
+// the few cycles spent pushing a result barely affect the next pulse.
+#define LOOPS_PER_US 4
+#define PROGRAM_LOW_START 6
+
+// Times each level on the jmp pin and pushes one word per edge, so the CPU only
+// hears about edges rather than every 32 samples.
 static const uint16_t pulsein_program[] = {
-    0x4001, //  1: in     pins, 1
+// high:
+    0xa02b, //  0: mov    x, ~null
+// high_loop:
+    0x00c3, //  1: jmp    pin, 3
+    0x0004, //  2: jmp    4
+    0x0041, //  3: jmp    x--, 1
+    0xa0c9, //  4: mov    isr, ~x
+    0x8000, //  5: push   noblock
+// low:
+    0xa02b, //  6: mov    x, ~null
+// low_loop:
+    0x00c9, //  7: jmp    pin, 9
+    0x0047, //  8: jmp    x--, 7
+    0xa0c9, //  9: mov    isr, ~x
+    0x8000, // 10: push   noblock
 };
 
 void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
@@ -59,19 +80,19 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
 
     common_hal_rp2pio_statemachine_construct(&self->state_machine,
         pulsein_program, MP_ARRAY_SIZE(pulsein_program),
-        1000000, // frequency
+        2 * LOOPS_PER_US * 1000000, // frequency
         NULL, 0, // init, init_len
         NULL, 0, 0, 0, // first out pin, # out pins, initial_out_pin_state
         pin, 1, 0, 0, // first in pin, # in pins
         NULL, 0, 0, 0, // first set pin
         NULL, 0, 0, 0, // first sideset pin
         false, // No sideset enable
-        NULL, PULL_NONE, // jump pin, jmp_pull
+        pin, PULL_NONE, // jump pin, jmp_pull
         0, // wait gpio pins
         true, // exclusive pin usage
         false, 8, false, // TX, setting we don't use
         false, // wait for TX stall
-        true, 32, true, // RX auto pull every 32 bits. shift left to output msb first
+        false, 32, true, // RX, pushed by the program
         false, // Not user-interruptible.
         0, -1); // wrap settings
 
@@ -101,42 +122,27 @@ void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t *self) {
     pio_sm_restart(self->state_machine.pio, self->state_machine.state_machine);
     pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
     pio_sm_clear_fifos(self->state_machine.pio,self->state_machine.state_machine);
-    self->last_level = self->idle_state;
-    self->level_count = 0;
     self->paused = true;
 }
 void common_hal_pulseio_pulsein_interrupt(void *self_in) {
     pulseio_pulsein_obj_t *self = self_in;
-
-    uint32_t rxfifo = 0;
-
-    rxfifo = pio_sm_get_blocking(self->state_machine.pio, self->state_machine.state_machine);
-    // translate from fifo to buffer
-    if ((rxfifo == 0 && self->last_level == false) || (rxfifo == 0xffffffff && self->last_level == true)) {
-        self->level_count = self->level_count + 32;
-    } else {
-        for (uint i = 0; i < 32; i++) {
-            bool level = (rxfifo & (1 << i)) >> i;
-            if (level == self->last_level) {
-                self->level_count++;
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+
+    while (!pio_sm_is_rx_fifo_empty(pio, sm)) {
+        uint32_t result = pio_sm_get(pio, sm) / LOOPS_PER_US;
+        // Pulses that are longer than MAX_PULSE will return MAX_PULSE
+        if (result > MAX_PULSE) {
+            result = MAX_PULSE;
+        }
+        // return  pulses that are not too short
+        if (result > MIN_PULSE) {
+            size_t buf_index = (self->start + self->len) % self->maxlen;
+            self->buffer[buf_index] = (uint16_t)result;
+            if (self->len < self->maxlen) {
+                self->len++;
             } else {
-                uint32_t result = self->level_count;
-                self->last_level = level;
-                self->level_count = 1;
-                // Pulses that are longer than MAX_PULSE will return MAX_PULSE
-                if (result > MAX_PULSE) {
-                    result = MAX_PULSE;
-                }
-                // return  pulses that are not too short
-                if (result > MIN_PULSE) {
-                    size_t buf_index = (self->start + self->len) % self->maxlen;
-                    self->buffer[buf_index] = (uint16_t)result;
-                    if (self->len < self->maxlen) {
-                        self->len++;
-                    } else {
-                        self->start = (self->start + 1) % self->maxlen;
-                    }
-                }
+                self->start = (self->start + 1) % self->maxlen;
             }
         }
     }
@@ -154,6 +160,11 @@ void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t *self,
         gpio_set_function(self->pin,GPIO_FUNC_PIO0);
     }
 
+    // The first pulse is the opposite of the idle level so start timing that one.
+    uint8_t offset = rp2pio_statemachine_program_offset(&self->state_machine);
+    pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine,
+        pio_encode_jmp(offset + (self->idle_state ? PROGRAM_LOW_START : 0)));
+
     // exec a wait for the selected pin to change state
     if (self->idle_state == true) {
         pio_sm_exec(self->state_machine.pio,self->state_machine.state_machine,0x2020);
@@ -40,8 +40,6 @@ typedef struct {
     bool paused;
     uint16_t maxlen;
     uint16_t *buffer;
-    volatile bool last_level;
-    volatile uint32_t level_count;
     volatile uint16_t len;
     volatile uint16_t start;
     rp2pio_statemachine_obj_t state_machine;
@@ -26,17 +26,20 @@
 
 #include "py/runtime.h"
 
-#include <hardware/regs/pio.h>
 #include "common-hal/rotaryio/IncrementalEncoder.h"
 #include "shared-bindings/rotaryio/IncrementalEncoder.h"
 #include "shared-module/rotaryio/IncrementalEncoder.h"
-#include "bindings/rp2pio/__init__.h"
+#include "shared-bindings/microcontroller/Pin.h"
 #include "bindings/rp2pio/StateMachine.h"
+#include "supervisor/shared/tick.h"
 
-STATIC const uint16_t encoder[] = {
+// One state machine watches the pins of every encoder. It pushes a snapshot of
+// all of them whenever any one changes, and DMA stores the snapshots in a ring
+// that is decoded in the background and whenever a position is read.
+STATIC uint16_t encoder_mux[] = {
     //  again:
-    //      in pins, 2
-    0x4002,
+    //      in pins, <pin count>    (the count is filled in when the state machine starts)
+    0x4000,
     //      mov x, isr
     0xa026,
     //      jmp x!=y, push_data
@@ -52,85 +55,186 @@ STATIC const uint16_t encoder[] = {
     0xa041,
 };
 
-STATIC const uint16_t encoder_init[] = {
-    //      set y, 31
-    0xe05f,
+STATIC const uint16_t encoder_mux_init[] = {
+    //      mov y, ~null    (never equal to a snapshot, so the first one is pushed)
+    0xa04b,
 };
 
-STATIC void incrementalencoder_interrupt_handler(void *self_in);
+// Five instructions per unchanged sample, so the pins are sampled at 1 MHz.
+#define ENCODER_MUX_FREQUENCY (5000000)
 
-void common_hal_rotaryio_incrementalencoder_construct(rotaryio_incrementalencoder_obj_t *self,
-    const mcu_pin_obj_t *pin_a, const mcu_pin_obj_t *pin_b) {
-    const mcu_pin_obj_t *pins[] = { pin_a, pin_b };
-
-    // Start out with swapped to match behavior with other ports.
-    self->swapped = true;
-    if (!common_hal_rp2pio_pins_are_sequential(2, pins)) {
-        pins[0] = pin_b;
-        pins[1] = pin_a;
-        self->swapped = false;
-        if (!common_hal_rp2pio_pins_are_sequential(2, pins)) {
-            mp_raise_RuntimeError(translate("Pins must be sequential GPIO pins"));
+STATIC rp2pio_statemachine_obj_t mux_state_machine = { .state_machine = NUM_PIO_STATE_MACHINES };
+STATIC uint32_t mux_pins;          // Bitmask of the pins of every encoder.
+STATIC uint8_t mux_first_pin;      // The pin the state machine's snapshots start at.
+STATIC uint32_t last_snapshot;     // The most recently decoded snapshot, masked to mux_pins.
+STATIC size_t ring_read;           // Bytes taken from the ring since the state machine started.
+
+STATIC uint32_t encoder_pins(rotaryio_incrementalencoder_obj_t *self) {
+    return (1u << self->pin_a) | (1u << self->pin_b);
+}
+
+// Decode the snapshots the DMA has stored since the last call.
+STATIC void incrementalencoder_process(void) {
+    if (common_hal_rp2pio_statemachine_deinited(&mux_state_machine)) {
+        return;
+    }
+    const uint32_t *ring = MP_STATE_PORT(incrementalencoder_ring);
+    // ring_read counts bytes so that it wraps along with the count from the DMA.
+    size_t available = (rp2pio_statemachine_get_bytes_read(&mux_state_machine) - ring_read) / sizeof(uint32_t);
+    if (available > INCREMENTALENCODER_RING_WORDS * 3 / 4) {
+        // The DMA has caught up with us and may have overwritten snapshots. Skip
+        // to the newest one; encoders that moved more than a step meanwhile miss counts.
+        ring_read += (available - 1) * sizeof(uint32_t);
+        available = 1;
+    }
+
+    for (; available > 0; available--) {
+        uint32_t snapshot = (ring[(ring_read / sizeof(uint32_t)) % INCREMENTALENCODER_RING_WORDS] << mux_first_pin) & mux_pins;
+        ring_read += sizeof(uint32_t);
+        uint32_t changed = snapshot ^ last_snapshot;
+        last_snapshot = snapshot;
+        for (rotaryio_incrementalencoder_obj_t *self = MP_STATE_PORT(incrementalencoders);
+             changed != 0 && self != NULL; self = self->next) {
+            if (changed & encoder_pins(self)) {
+                changed &= ~encoder_pins(self);
+                uint8_t new_state = ((snapshot >> self->pin_a) & 1) << 1 | ((snapshot >> self->pin_b) & 1);
+                shared_module_softencoder_state_update(self, new_state);
+            }
         }
     }
+}
 
-    self->position = 0;
-    self->sub_count = 0;
-
-    common_hal_rp2pio_statemachine_construct(&self->state_machine,
-        encoder, MP_ARRAY_SIZE(encoder),
-        1000000,
-        encoder_init, MP_ARRAY_SIZE(encoder_init), // init
-        NULL, 0, 0, 0, // out pin
-        pins[0], 2, // in pins
-        3, 0, // in pulls
-        NULL, 0, 0, 0x1f, // set pins
-        NULL, 0, 0, 0x1f, // sideset pins
-        false, // No sideset enable
-        NULL, PULL_NONE, // jump pin
-        0, // wait gpio pins
-        true, // exclusive pin use
+// Restart the state machine so that it watches exactly the given pins, decoding
+// what the old one recorded first. Returns false if no state machine or DMA
+// channel is free, with nothing running.
+STATIC bool incrementalencoder_restart(uint32_t pins) {
+    if (!common_hal_rp2pio_statemachine_deinited(&mux_state_machine)) {
+        incrementalencoder_process();
+        // Leave the pins alone: those that are still used keep their pulls.
+        rp2pio_statemachine_deinit(&mux_state_machine, true);
+    }
+    mux_pins = pins;
+    last_snapshot &= pins;
+    if (pins == 0) {
+        return true;
+    }
+
+    if (MP_STATE_PORT(incrementalencoder_ring) == NULL) {
+        MP_STATE_PORT(incrementalencoder_ring) = m_new(uint32_t, INCREMENTALENCODER_RING_WORDS);
+    }
+
+    mux_first_pin = __builtin_ctz(pins);
+    uint8_t pin_count = 32 - __builtin_clz(pins) - mux_first_pin;
+    // A count of 32 is encoded as 0.
+    encoder_mux[0] = 0x4000 | (pin_count & 0x1f);
+
+    if (!rp2pio_statemachine_construct(&mux_state_machine,
+        encoder_mux, MP_ARRAY_SIZE(encoder_mux),
+        ENCODER_MUX_FREQUENCY,
+        encoder_mux_init, MP_ARRAY_SIZE(encoder_mux_init), // init
+        NULL, 0, // out pins
+        mcu_get_pin_by_number(mux_first_pin), pin_count, // in pins
+        pins, 0, // in pulls
+        NULL, 0, // set pins
+        NULL, 0, // sideset pins
+        0, 0, // initial pin state and direction
+        NULL, // jump pin
+        pins, false, true, // only the encoders' pins, RX FIFO only
         false, 32, false, // out settings
         false, // Wait for txstall
         false, 32, false, // in settings
+        true, // claim pins
         false, // Not user-interruptible.
-        0, MP_ARRAY_SIZE(encoder) - 1 // wrap settings
-        );
+        false, // No sideset enable
+        0, MP_ARRAY_SIZE(encoder_mux) - 1 // wrap settings
+        )) {
+        return false;
+    }
 
-    // We're guaranteed by the init code that some output will be available promptly
-    uint8_t quiescent_state;
-    common_hal_rp2pio_statemachine_readinto(&self->state_machine, &quiescent_state, 1, 1, false);
+    ring_read = 0;
+    sm_buf_info once = {0};
+    sm_buf_info loop = {
+        .obj = MP_OBJ_NULL,
+        .info = { .buf = MP_STATE_PORT(incrementalencoder_ring), .len = INCREMENTALENCODER_RING_WORDS * sizeof(uint32_t) },
+    };
+    if (!common_hal_rp2pio_statemachine_background_read(&mux_state_machine, &once, &loop, sizeof(uint32_t), false)) {
+        rp2pio_statemachine_deinit(&mux_state_machine, true);
+        return false;
+    }
+    return true;
+}
+
+void common_hal_rotaryio_incrementalencoder_construct(rotaryio_incrementalencoder_obj_t *self,
+    const mcu_pin_obj_t *pin_a, const mcu_pin_obj_t *pin_b) {
+    self->pin_a = pin_a->number;
+    self->pin_b = pin_b->number;
 
-    shared_module_softencoder_state_init(self, quiescent_state & 3);
-    common_hal_rp2pio_statemachine_set_interrupt_handler(&self->state_machine, incrementalencoder_interrupt_handler, self, PIO_IRQ0_INTF_SM0_RXNEMPTY_BITS);
+    uint32_t old_pins = mux_pins;
+    if (!incrementalencoder_restart(old_pins | encoder_pins(self))) {
+        // Put the other encoders back the way they were.
+        incrementalencoder_restart(old_pins);
+        self->pin_a = NUM_BANK0_GPIOS;
+        mp_raise_RuntimeError(translate("All state machines in use"));
+    }
+
+    // The init code guarantees that the first snapshot arrives promptly.
+    while (rp2pio_statemachine_get_bytes_read(&mux_state_machine) == 0) {
+    }
+    uint32_t snapshot = MP_STATE_PORT(incrementalencoder_ring)[0] << mux_first_pin;
+    shared_module_softencoder_state_init(self, ((snapshot >> self->pin_a) & 1) << 1 | ((snapshot >> self->pin_b) & 1));
+
+    if (MP_STATE_PORT(incrementalencoders) == NULL) {
+        // Decode in the background so that the ring doesn't overflow between reads.
+        supervisor_enable_tick();
+    }
+    self->next = MP_STATE_PORT(incrementalencoders);
+    MP_STATE_PORT(incrementalencoders) = self;
 }
 
 bool common_hal_rotaryio_incrementalencoder_deinited(rotaryio_incrementalencoder_obj_t *self) {
-    return common_hal_rp2pio_statemachine_deinited(&self->state_machine);
+    return self->pin_a == NUM_BANK0_GPIOS;
 }
 
 void common_hal_rotaryio_incrementalencoder_deinit(rotaryio_incrementalencoder_obj_t *self) {
     if (common_hal_rotaryio_incrementalencoder_deinited(self)) {
         return;
     }
-    common_hal_rp2pio_statemachine_set_interrupt_handler(&self->state_machine, NULL, NULL, 0);
-    common_hal_rp2pio_statemachine_deinit(&self->state_machine);
+    // Count what is pending before this encoder is taken out of the list.
+    incrementalencoder_process();
+    rotaryio_incrementalencoder_obj_t **link = &MP_STATE_PORT(incrementalencoders);
+    while (*link != self) {
+        link = &(*link)->next;
+    }
+    *link = self->next;
+    self->next = NULL;
+    if (MP_STATE_PORT(incrementalencoders) == NULL) {
+        supervisor_disable_tick();
+    }
+
+    // The remaining encoders have the same pins or fewer, so restarting can't fail
+    // for want of a state machine or DMA channel.
+    incrementalencoder_restart(mux_pins & ~encoder_pins(self));
+    reset_pin_number(self->pin_a);
+    reset_pin_number(self->pin_b);
+    self->pin_a = NUM_BANK0_GPIOS;
 }
 
-STATIC void incrementalencoder_interrupt_handler(void *self_in) {
-    rotaryio_incrementalencoder_obj_t *self = self_in;
-
-    while (common_hal_rp2pio_statemachine_get_in_waiting(&self->state_machine)) {
-        // Bypass all the logic of StateMachine.c:_transfer, we need something
-        // very simple and fast for an interrupt!
-        uint8_t new_state = self->state_machine.pio->rxf[self->state_machine.state_machine];
-        if (self->swapped) {
-            if (new_state == 0x1) {
-                new_state = 0x2;
-            } else if (new_state == 0x2) {
-                new_state = 0x1;
-            }
-        }
-        shared_module_softencoder_state_update(self, new_state);
+void shared_module_softencoder_update(rotaryio_incrementalencoder_obj_t *self) {
+    incrementalencoder_process();
+}
+
+void incrementalencoder_background(void) {
+    incrementalencoder_process();
+}
+
+void reset_rotaryio(void) {
+    // The state machine itself is reset along with the others.
+    if (MP_STATE_PORT(incrementalencoders) != NULL) {
+        supervisor_disable_tick();
     }
+    MP_STATE_PORT(incrementalencoders) = NULL;
+    MP_STATE_PORT(incrementalencoder_ring) = NULL;
+    mux_state_machine.state_machine = NUM_PIO_STATE_MACHINES;
+    mux_pins = 0;
+    last_snapshot = 0;
 }
@@ -26,17 +26,25 @@
 
 #pragma once
 
-#include "common-hal/rp2pio/StateMachine.h"
 #include "common-hal/microcontroller/Pin.h"
 
 #include "py/obj.h"
 
-typedef struct {
+// Words of pin snapshots in the ring the shared state machine is read into. A power of two.
+#define INCREMENTALENCODER_RING_WORDS (1024)
+
+typedef struct _rotaryio_incrementalencoder_obj_t {
     mp_obj_base_t base;
-    rp2pio_statemachine_obj_t state_machine;
+    // All encoders share one state machine, which pushes a snapshot of their
+    // pins whenever one of them changes.
+    struct _rotaryio_incrementalencoder_obj_t *next;
+    uint8_t pin_a;
+    uint8_t pin_b;
     uint8_t state;        // <old A><old B>
     int8_t sub_count; // count intermediate transitions between detents
     int8_t divisor; // Number of quadrature edges required per count
-    bool swapped;         // Did the pins need to be swapped to be sequential?
     mp_int_t position;
 } rotaryio_incrementalencoder_obj_t;
+
+void incrementalencoder_background(void);
+void reset_rotaryio(void);
@@ -63,6 +63,26 @@ STATIC int8_t _sm_dma_plus_one[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 #define SM_DMA_CLEAR_CHANNEL(pio_index, sm) (_sm_dma_plus_one[(pio_index)][(sm)] = 0)
 #define SM_DMA_SET_CHANNEL(pio_isntance, sm, channel) (_sm_dma_plus_one[(pio_index)][(sm)] = (channel) + 1)
 
+// The DMA channel used for background reads, separate from the one for background writes.
+STATIC int8_t _sm_dma_read_plus_one[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+
+#define SM_DMA_READ_ALLOCATED(pio_index, sm) (_sm_dma_read_plus_one[(pio_index)][(sm)] != 0)
+#define SM_DMA_READ_GET_CHANNEL(pio_index, sm) (_sm_dma_read_plus_one[(pio_index)][(sm)] - 1)
+#define SM_DMA_READ_CLEAR_CHANNEL(pio_index, sm) (_sm_dma_read_plus_one[(pio_index)][(sm)] = 0)
+#define SM_DMA_READ_SET_CHANNEL(pio_index, sm, channel) (_sm_dma_read_plus_one[(pio_index)][(sm)] = (channel) + 1)
+
+// The DMA channel that moves words from this state machine's RX FIFO to another one's TX FIFO.
+STATIC int8_t _sm_dma_pipe_plus_one[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+
+#define SM_DMA_PIPE_ALLOCATED(pio_index, sm) (_sm_dma_pipe_plus_one[(pio_index)][(sm)] != 0)
+#define SM_DMA_PIPE_GET_CHANNEL(pio_index, sm) (_sm_dma_pipe_plus_one[(pio_index)][(sm)] - 1)
+#define SM_DMA_PIPE_CLEAR_CHANNEL(pio_index, sm) (_sm_dma_pipe_plus_one[(pio_index)][(sm)] = 0)
+#define SM_DMA_PIPE_SET_CHANNEL(pio_index, sm, channel) (_sm_dma_pipe_plus_one[(pio_index)][(sm)] = (channel) + 1)
+
+// A connection runs until it is stopped, so its channel is restarted with this count each time it
+// completes.
+#define PIPE_TRANSFER_COUNT (0xffffffff)
+
 STATIC PIO pio_instances[2] = {pio0, pio1};
 typedef void (*interrupt_handler_type)(void *);
 STATIC interrupt_handler_type _interrupt_handler[NUM_PIOS][NUM_PIO_STATE_MACHINES];
@@ -81,24 +101,48 @@ static void rp2pio_statemachine_set_pull(uint32_t pull_pin_up, uint32_t pull_pin
     }
 }
 
+STATIC void _release_dma_channel(int channel) {
+    uint32_t channel_mask = 1u << channel;
+    dma_hw->inte0 &= ~channel_mask;
+    if (!dma_hw->inte0) {
+        irq_set_mask_enabled(1 << DMA_IRQ_0, false);
+    }
+    MP_STATE_PORT(background_pio)[channel] = NULL;
+    dma_channel_abort(channel);
+    dma_channel_unclaim(channel);
+}
+
 STATIC void rp2pio_statemachine_clear_dma(int pio_index, int sm) {
     if (SM_DMA_ALLOCATED(pio_index, sm)) {
-        int channel = SM_DMA_GET_CHANNEL(pio_index, sm);
-        uint32_t channel_mask = 1u << channel;
-        dma_hw->inte0 &= ~channel_mask;
-        if (!dma_hw->inte0) {
-            irq_set_mask_enabled(1 << DMA_IRQ_0, false);
-        }
-        MP_STATE_PORT(background_pio)[channel] = NULL;
-        dma_channel_abort(channel);
-        dma_channel_unclaim(channel);
+        _release_dma_channel(SM_DMA_GET_CHANNEL(pio_index, sm));
     }
     SM_DMA_CLEAR_CHANNEL(pio_index, sm);
 }
 
+STATIC void rp2pio_statemachine_clear_dma_read(int pio_index, int sm) {
+    if (SM_DMA_READ_ALLOCATED(pio_index, sm)) {
+        _release_dma_channel(SM_DMA_READ_GET_CHANNEL(pio_index, sm));
+    }
+    SM_DMA_READ_CLEAR_CHANNEL(pio_index, sm);
+}
+
+STATIC void rp2pio_statemachine_clear_dma_pipe(int pio_index, int sm) {
+    if (SM_DMA_PIPE_ALLOCATED(pio_index, sm)) {
+        int channel = SM_DMA_PIPE_GET_CHANNEL(pio_index, sm);
+        if ((dma_hw->sniff_ctrl & DMA_SNIFF_CTRL_EN_BITS) &&
+            ((dma_hw->sniff_ctrl & DMA_SNIFF_CTRL_DMACH_BITS) >> DMA_SNIFF_CTRL_DMACH_LSB) == (uint)channel) {
+            dma_hw->sniff_ctrl = 0;
+        }
+        _release_dma_channel(channel);
+    }
+    SM_DMA_PIPE_CLEAR_CHANNEL(pio_index, sm);
+}
+
 STATIC void _reset_statemachine(PIO pio, uint8_t sm, bool leave_pins) {
     uint8_t pio_index = pio_get_index(pio);
     rp2pio_statemachine_clear_dma(pio_index, sm);
+    rp2pio_statemachine_clear_dma_read(pio_index, sm);
+    rp2pio_statemachine_clear_dma_pipe(pio_index, sm);
     uint32_t program_id = _current_program_id[pio_index][sm];
     if (program_id == 0) {
         return;
@@ -369,6 +413,8 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
 
     // no DMA allocated
     SM_DMA_CLEAR_CHANNEL(pio_index, state_machine);
+    SM_DMA_READ_CLEAR_CHANNEL(pio_index, state_machine);
+    SM_DMA_PIPE_CLEAR_CHANNEL(pio_index, state_machine);
 
     pio_sm_init(self->pio, self->state_machine, program_offset, &c);
     common_hal_rp2pio_statemachine_run(self, init, init_len);
@@ -645,6 +691,8 @@ void rp2pio_statemachine_never_reset(PIO pio, int sm) {
 void rp2pio_statemachine_deinit(rp2pio_statemachine_obj_t *self, bool leave_pins) {
     common_hal_rp2pio_statemachine_stop(self);
     (void)common_hal_rp2pio_statemachine_stop_background_write(self);
+    (void)common_hal_rp2pio_statemachine_stop_background_read(self);
+    common_hal_rp2pio_statemachine_disconnect(self);
 
     uint8_t sm = self->state_machine;
     uint8_t pio_index = pio_get_index(self->pio);
@@ -1019,7 +1067,35 @@ bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *
     return true;
 }
 
+STATIC void _dma_complete_read(rp2pio_statemachine_obj_t *self, int channel) {
+    self->bytes_read += self->current_read.info.len;
+    self->last_read = self->current_read.obj;
+    self->current_read = self->once_read;
+    self->once_read = self->loop_read;
+
+    if (self->current_read.info.buf) {
+        if (self->pending_buffers_read > 0) {
+            self->pending_buffers_read--;
+        }
+        dma_channel_set_write_addr(channel, self->current_read.info.buf, false);
+        dma_channel_set_trans_count(channel, self->current_read.info.len / self->background_read_stride_in_bytes, true);
+    } else {
+        self->dma_completed_read = true;
+        self->pending_buffers_read = 0; // should be a no-op
+    }
+}
+
 void rp2pio_statemachine_dma_complete(rp2pio_statemachine_obj_t *self, int channel) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    if (SM_DMA_READ_ALLOCATED(pio_index, sm) && SM_DMA_READ_GET_CHANNEL(pio_index, sm) == channel) {
+        _dma_complete_read(self, channel);
+        return;
+    }
+    if (SM_DMA_PIPE_ALLOCATED(pio_index, sm) && SM_DMA_PIPE_GET_CHANNEL(pio_index, sm) == channel) {
+        dma_channel_set_trans_count(channel, PIPE_TRANSFER_COUNT, true);
+        return;
+    }
     self->current = self->once;
     self->once = self->loop;
 
@@ -1053,3 +1129,203 @@ bool common_hal_rp2pio_statemachine_get_writing(rp2pio_statemachine_obj_t *self)
 int common_hal_rp2pio_statemachine_get_pending(rp2pio_statemachine_obj_t *self) {
     return self->pending_buffers;
 }
+
+bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *self, const sm_buf_info *once, const sm_buf_info *loop, uint8_t stride_in_bytes, bool swap) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+
+    int pending_buffers = (once->info.len != 0) + (loop->info.len != 0);
+    if (!once->info.len) {
+        once = loop;
+    }
+
+    if (SM_DMA_READ_ALLOCATED(pio_index, sm)) {
+        if (stride_in_bytes != self->background_read_stride_in_bytes) {
+            mp_raise_ValueError(translate("Mismatched data size"));
+        }
+        if (swap != self->byteswap_read) {
+            mp_raise_ValueError(translate("Mismatched swap flag"));
+        }
+
+        while (self->pending_buffers_read) {
+            RUN_BACKGROUND_TASKS;
+            if (self->user_interruptible && mp_hal_is_interrupted()) {
+                return false;
+            }
+        }
+
+        common_hal_mcu_disable_interrupts();
+        self->once_read = *once;
+        self->loop_read = *loop;
+        self->pending_buffers_read = pending_buffers;
+
+        if (self->dma_completed_read && self->once_read.info.len) {
+            rp2pio_statemachine_dma_complete(self, SM_DMA_READ_GET_CHANNEL(pio_index, sm));
+            self->dma_completed_read = false;
+        }
+
+        common_hal_mcu_enable_interrupts();
+
+        return true;
+    }
+
+    int channel = dma_claim_unused_channel(false);
+    if (channel == -1) {
+        return false;
+    }
+
+    SM_DMA_READ_SET_CHANNEL(pio_index, sm, channel);
+
+    const volatile uint8_t *rx_source = (const volatile uint8_t *)&self->pio->rxf[self->state_machine];
+    if (self->in_shift_right) {
+        rx_source += 4 - stride_in_bytes;
+    }
+
+    self->rx_dreq = pio_get_dreq(self->pio, self->state_machine, false);
+
+    dma_channel_config c;
+
+    self->current_read = *once;
+    self->once_read = *loop;
+    self->loop_read = *loop;
+    self->last_read = MP_OBJ_NULL;
+    self->bytes_read = 0;
+    self->pending_buffers_read = pending_buffers;
+    self->dma_completed_read = false;
+    self->background_read_stride_in_bytes = stride_in_bytes;
+    self->byteswap_read = swap;
+
+    c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, _stride_to_dma_size(stride_in_bytes));
+    channel_config_set_dreq(&c, self->rx_dreq);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_bswap(&c, swap);
+    dma_channel_configure(channel, &c,
+        once->info.buf,
+        rx_source,
+        once->info.len / stride_in_bytes,
+        false);
+
+    common_hal_mcu_disable_interrupts();
+    MP_STATE_PORT(background_pio)[channel] = self;
+    dma_hw->inte0 |= 1u << channel;
+    irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+    dma_start_channel_mask(1u << channel);
+    common_hal_mcu_enable_interrupts();
+
+    return true;
+}
+
+bool common_hal_rp2pio_statemachine_stop_background_read(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    rp2pio_statemachine_clear_dma_read(pio_index, sm);
+    memset(&self->current_read, 0, sizeof(self->current_read));
+    memset(&self->once_read, 0, sizeof(self->once_read));
+    memset(&self->loop_read, 0, sizeof(self->loop_read));
+    self->pending_buffers_read = 0;
+    self->dma_completed_read = true;
+    return true;
+}
+
+// The number of bytes the background read has stored since it started,
+// including those in the buffer it is filling now.
+size_t rp2pio_statemachine_get_bytes_read(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    common_hal_mcu_disable_interrupts();
+    size_t bytes_read = self->bytes_read;
+    if (SM_DMA_READ_ALLOCATED(pio_index, sm) && !self->dma_completed_read) {
+        int channel = SM_DMA_READ_GET_CHANNEL(pio_index, sm);
+        bytes_read += (uint8_t *)dma_hw->ch[channel].write_addr - (uint8_t *)self->current_read.info.buf;
+    }
+    common_hal_mcu_enable_interrupts();
+    return bytes_read;
+}
+
+bool common_hal_rp2pio_statemachine_get_reading(rp2pio_statemachine_obj_t *self) {
+    return SM_DMA_READ_ALLOCATED(pio_get_index(self->pio), self->state_machine) && !self->dma_completed_read;
+}
+
+mp_int_t common_hal_rp2pio_statemachine_get_pending_read(rp2pio_statemachine_obj_t *self) {
+    return self->pending_buffers_read;
+}
+
+mp_obj_t common_hal_rp2pio_statemachine_get_last_read(rp2pio_statemachine_obj_t *self) {
+    common_hal_mcu_disable_interrupts();
+    mp_obj_t last_read = self->last_read;
+    self->last_read = MP_OBJ_NULL;
+    common_hal_mcu_enable_interrupts();
+    if (last_read == MP_OBJ_NULL) {
+        return mp_const_empty_bytes;
+    }
+    return last_read;
+}
+
+bool common_hal_rp2pio_statemachine_connect(rp2pio_statemachine_obj_t *self, rp2pio_statemachine_obj_t *target, bool swap, bool crc) {
+    common_hal_rp2pio_statemachine_disconnect(self);
+
+    if (crc && (dma_hw->sniff_ctrl & DMA_SNIFF_CTRL_EN_BITS)) {
+        // There is only one sniffer.
+        mp_raise_ValueError_varg(translate("%q in use"), MP_QSTR_crc);
+    }
+
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+
+    int channel = dma_claim_unused_channel(false);
+    if (channel == -1) {
+        return false;
+    }
+
+    SM_DMA_PIPE_SET_CHANNEL(pio_index, sm, channel);
+    self->pipe_target = target;
+    self->rx_dreq = pio_get_dreq(self->pio, self->state_machine, false);
+
+    // Words move whenever the source has one ready, so the target must keep up.
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_dreq(&c, self->rx_dreq);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_bswap(&c, swap);
+    if (crc) {
+        channel_config_set_sniff_enable(&c, true);
+        dma_hw->sniff_data = 0xffffffff;
+        dma_hw->sniff_ctrl = (channel << DMA_SNIFF_CTRL_DMACH_LSB) |
+            (DMA_SNIFF_CTRL_CALC_VALUE_CRC32R << DMA_SNIFF_CTRL_CALC_LSB) |
+            DMA_SNIFF_CTRL_OUT_REV_BITS | DMA_SNIFF_CTRL_OUT_INV_BITS |
+            DMA_SNIFF_CTRL_EN_BITS;
+    }
+    dma_channel_configure(channel, &c,
+        &target->pio->txf[target->state_machine],
+        &self->pio->rxf[self->state_machine],
+        PIPE_TRANSFER_COUNT,
+        false);
+
+    common_hal_mcu_disable_interrupts();
+    MP_STATE_PORT(background_pio)[channel] = self;
+    dma_hw->inte0 |= 1u << channel;
+    irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+    dma_start_channel_mask(1u << channel);
+    common_hal_mcu_enable_interrupts();
+
+    return true;
+}
+
+void common_hal_rp2pio_statemachine_disconnect(rp2pio_statemachine_obj_t *self) {
+    rp2pio_statemachine_clear_dma_pipe(pio_get_index(self->pio), self->state_machine);
+    self->pipe_target = NULL;
+}
+
+mp_obj_t common_hal_rp2pio_statemachine_get_crc(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    if (!SM_DMA_PIPE_ALLOCATED(pio_index, sm) ||
+        !(dma_hw->sniff_ctrl & DMA_SNIFF_CTRL_EN_BITS) ||
+        ((dma_hw->sniff_ctrl & DMA_SNIFF_CTRL_DMACH_BITS) >> DMA_SNIFF_CTRL_DMACH_LSB) != (uint)SM_DMA_PIPE_GET_CHANNEL(pio_index, sm)) {
+        return mp_const_none;
+    }
+    return mp_obj_new_int_from_uint(dma_hw->sniff_data);
+}
@@ -37,7 +37,7 @@ typedef struct sm_buf_info {
     mp_buffer_info_t info;
 } sm_buf_info;
 
-typedef struct {
+typedef struct _rp2pio_statemachine_obj_t {
     mp_obj_base_t base;
     uint32_t pins; // Bitmask of what pins this state machine uses.
     int state_machine;
@@ -65,6 +65,19 @@ typedef struct {
     sm_buf_info current, once, loop;
     int background_stride_in_bytes;
     bool dma_completed, byteswap;
+
+    // background read items, filled from the RX FIFO on their own DMA channel
+    volatile int pending_buffers_read;
+    sm_buf_info current_read, once_read, loop_read;
+    // The most recently filled buffer, or MP_OBJ_NULL once it has been fetched.
+    volatile mp_obj_t last_read;
+    // Bytes stored by the background read in the buffers it has completed.
+    volatile size_t bytes_read;
+    int background_read_stride_in_bytes;
+    bool dma_completed_read, byteswap_read;
+
+    // The state machine whose TX FIFO this one's RX FIFO feeds, if connected.
+    struct _rp2pio_statemachine_obj_t *pipe_target;
 } rp2pio_statemachine_obj_t;
 
 void reset_rp2pio_statemachine(void);
@@ -91,6 +104,7 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
     int wrap_target, int wrap);
 
 uint8_t rp2pio_statemachine_program_offset(rp2pio_statemachine_obj_t *self);
+size_t rp2pio_statemachine_get_bytes_read(rp2pio_statemachine_obj_t *self);
 
 void rp2pio_statemachine_deinit(rp2pio_statemachine_obj_t *self, bool leave_pins);
 void rp2pio_statemachine_dma_complete(rp2pio_statemachine_obj_t *self, int channel);
@@ -0,0 +1,808 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// 4-bit SD bus driven by three PIO state machines. The command state machine
+// generates the bus clock continuously, so the card always sees a free running
+// clock, and shifts commands and responses on CMD. The data state machines
+// follow that clock by polling the pin with `wait gpio` and move whole blocks
+// between the FIFOs and memory under DMA. Each transfer uses a pair of DMA
+// channels: a data channel bound to the state machine and a control channel
+// that reprograms it from a list, so that data and CRC words of consecutive
+// blocks land in (or come from) separate buffers without CPU involvement.
+
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "py/runtime.h"
+
+#include "bindings/rp2pio/StateMachine.h"
+#include "common-hal/sdioio/SDCard.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/sdioio/SDCard.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/tick.h"
+
+#include "src/rp2_common/hardware_clocks/include/hardware/clocks.h"
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
+#include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_pio/include/hardware/pio.h"
+#include "src/rp2_common/hardware_pio/include/hardware/pio_instructions.h"
+
+#define SDIO_BLOCK_WORDS (512 / 4)
+// Start nibble, 1024 data nibbles and 16 CRC nibbles; the end nibble is not
+// captured.
+#define SDIO_RX_NIBBLES (1 + 1024 + 16 - 1)
+// Seven idle nibbles, start nibble, data, CRC and end nibble.
+#define SDIO_TX_NIBBLES (8 + 1024 + 16 + 1)
+// Blocks moved by one read or write command, bounding the size of the DMA
+// control lists kept on the stack.
+#define SDIO_MAX_CHAIN_BLOCKS (16)
+#define SDIO_INIT_FREQUENCY (400000)
+#define SDIO_MAX_FREQUENCY (25000000)
+// Clock periods the card needs between a response and the next command.
+#define SDIO_IDLE_CLOCKS (8)
+
+#define SDIO_COMMAND_TIMEOUT_MS (10)
+#define SDIO_DATA_TIMEOUT_MS (1000)
+#define SDIO_BUSY_TIMEOUT_MS (1000)
+
+// R1 status bits that mean the command was not carried out.
+#define R1_ERROR_BITS (0xfdf80000)
+
+#define SIDE(x) pio_encode_sideset(1, (x))
+
+STATIC void build_programs(sdioio_sdcard_obj_t *self) {
+    uint clock = self->clock->number;
+    // Clock on side-set, CMD on out/set/in/jmp pin. Runs at twice the bus clock.
+    // Each command is two words: the first byte of the first word is the number
+    // of bits to send less one, the second is the number of response bits to
+    // receive less two (zero for no response).
+    const uint16_t command_program[] = {
+        // idle: keep the clock running until a command is queued. Status is
+        // all-ones while the TX FIFO is empty.
+        pio_encode_mov_not(pio_y, pio_status) | SIDE(1),
+        pio_encode_jmp_not_y(0) | SIDE(0),
+        pio_encode_out(pio_x, 8) | SIDE(1),
+        pio_encode_out(pio_y, 8) | SIDE(0),
+        pio_encode_set(pio_pins, 1) | SIDE(1),
+        pio_encode_set(pio_pindirs, 1) | SIDE(0),
+        // send: card samples on the rising edge.
+        pio_encode_out(pio_pins, 1) | SIDE(0),
+        pio_encode_jmp_x_dec(6) | SIDE(1),
+        pio_encode_set(pio_pindirs, 0) | SIDE(0),
+        pio_encode_jmp_not_y(0) | SIDE(1),
+        // wait for the response start bit.
+        pio_encode_nop() | SIDE(1),
+        pio_encode_jmp_pin(10) | SIDE(0),
+        pio_encode_mov(pio_x, pio_y) | SIDE(1),
+        pio_encode_in(pio_pins, 1) | SIDE(0),
+        pio_encode_jmp_x_dec(13) | SIDE(1),
+        pio_encode_push(false, true) | SIDE(0),
+    };
+    // Receive: Y holds the nibble count less one. Samples follow the falling
+    // edge, when the card's output is stable.
+    const uint16_t rx_program[] = {
+        pio_encode_mov(pio_x, pio_y),
+        pio_encode_wait_gpio(1, clock),
+        pio_encode_wait_gpio(0, clock),
+        pio_encode_jmp_pin(1),
+        pio_encode_wait_gpio(1, clock),
+        pio_encode_wait_gpio(0, clock),
+        pio_encode_in(pio_pins, 4),
+        pio_encode_jmp_x_dec(4),
+    };
+    // Transmit: each block is preceded by its nibble count less one and
+    // followed by the CRC status token, which is pushed to the RX FIFO.
+    // Outputs change after the rising edge, leaving the card a full half
+    // period of setup time.
+    const uint16_t tx_program[] = {
+        pio_encode_out(pio_x, 32),
+        pio_encode_wait_pin(1, 0),
+        pio_encode_set(pio_pindirs, 15),
+        pio_encode_wait_gpio(0, clock),
+        pio_encode_wait_gpio(1, clock),
+        pio_encode_out(pio_pins, 4),
+        pio_encode_jmp_x_dec(3),
+        pio_encode_out(pio_null, 28),
+        // hold the end nibble through the next rising edge, then let go.
+        pio_encode_wait_gpio(0, clock),
+        pio_encode_wait_gpio(1, clock),
+        pio_encode_set(pio_pindirs, 0),
+        pio_encode_wait_gpio(1, clock),
+        pio_encode_wait_gpio(0, clock),
+        pio_encode_jmp_pin(11),
+        pio_encode_set(pio_x, 7),
+        pio_encode_wait_gpio(1, clock),
+        pio_encode_wait_gpio(0, clock),
+        pio_encode_in(pio_pins, 1),
+        pio_encode_jmp_x_dec(15),
+        pio_encode_push(false, true),
+    };
+    MP_STATIC_ASSERT(sizeof(command_program) == sizeof(self->command_program));
+    MP_STATIC_ASSERT(sizeof(rx_program) == sizeof(self->rx_program));
+    MP_STATIC_ASSERT(sizeof(tx_program) == sizeof(self->tx_program));
+    memcpy(self->command_program, command_program, sizeof(command_program));
+    memcpy(self->rx_program, rx_program, sizeof(rx_program));
+    memcpy(self->tx_program, tx_program, sizeof(tx_program));
+}
+
+static uint8_t CRC7(const uint8_t *data, uint8_t n) {
+    uint8_t crc = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        uint8_t d = data[i];
+        for (uint8_t j = 0; j < 8; j++) {
+            crc <<= 1;
+            if ((d & 0x80) ^ (crc & 0x80)) {
+                crc ^= 0x09;
+            }
+            d <<= 1;
+        }
+    }
+    return (crc << 1) | 1;
+}
+
+// CRC16 of each of the four data lines at once. The result is the 16 CRC
+// nibbles in transmission order, first nibble in the top bits, which is how
+// the state machines shift them.
+STATIC uint64_t crc16_4bit(const uint32_t *data, size_t n_words) {
+    uint64_t crc = 0;
+    for (size_t i = 0; i < n_words; i++) {
+        uint32_t x = (uint32_t)(crc >> 32) ^ __builtin_bswap32(data[i]);
+        uint64_t f = x ^ (x >> 16);
+        crc = (crc << 32) ^ f ^ (f << 20) ^ (f << 48);
+    }
+    return crc;
+}
+
+// Extract up to 32 bits of a response. Positions count from the start bit,
+// which the state machine does not capture.
+STATIC uint32_t response_field(const uint32_t *response, size_t start, size_t count) {
+    uint32_t result = 0;
+    for (size_t i = start - 1; i < start - 1 + count; i++) {
+        result = (result << 1) | ((response[i / 32] >> (31 - i % 32)) & 1);
+    }
+    return result;
+}
+
+STATIC void restart_state_machine(rp2pio_statemachine_obj_t *sm_obj, uint16_t side) {
+    PIO pio = sm_obj->pio;
+    uint sm = sm_obj->state_machine;
+    pio_sm_set_enabled(pio, sm, false);
+    pio_sm_clear_fifos(pio, sm);
+    pio_sm_restart(pio, sm);
+    pio_sm_exec(pio, sm, pio_encode_set(pio_pins, 31) | side);
+    pio_sm_exec(pio, sm, pio_encode_set(pio_pindirs, 0) | side);
+    pio_sm_exec(pio, sm, pio_encode_jmp(rp2pio_statemachine_program_offset(sm_obj)) | side);
+}
+
+STATIC void restart_command_sm(sdioio_sdcard_obj_t *self) {
+    restart_state_machine(&self->command_sm, SIDE(0));
+    pio_sm_set_enabled(self->command_sm.pio, self->command_sm.state_machine, true);
+}
+
+STATIC void idle_clocks(sdioio_sdcard_obj_t *self, uint32_t clocks) {
+    mp_hal_delay_us(clocks * 1000000 / self->frequency + 1);
+}
+
+// Send a command and collect a 48 or 136 bit response, or none when
+// response_bits is zero. R1-type responses are checked for the echoed
+// command index and CRC.
+STATIC int sdio_command(sdioio_sdcard_obj_t *self, uint8_t index, uint32_t arg, size_t response_bits, uint32_t *response) {
+    PIO pio = self->command_sm.pio;
+    uint sm = self->command_sm.state_machine;
+    uint8_t cmd[5] = {0x40 | index, arg >> 24, arg >> 16, arg >> 8, arg};
+    uint32_t receive = response_bits ? response_bits - 2 : 0;
+
+    pio_sm_put(pio, sm, 47 << 24 | receive << 16 | cmd[0] << 8 | cmd[1]);
+    pio_sm_put(pio, sm, arg << 8 | CRC7(cmd, 5));
+
+    if (!response_bits) {
+        while (!pio_sm_is_tx_fifo_empty(pio, sm)) {
+        }
+        idle_clocks(self, 48 + SDIO_IDLE_CLOCKS);
+        return 0;
+    }
+
+    size_t n_words = (response_bits - 1 + 31) / 32;
+    uint64_t deadline = supervisor_ticks_ms64() + SDIO_COMMAND_TIMEOUT_MS;
+    for (size_t i = 0; i < n_words; i++) {
+        while (pio_sm_is_rx_fifo_empty(pio, sm)) {
+            if (supervisor_ticks_ms64() > deadline) {
+                restart_command_sm(self);
+                return -MP_ETIMEDOUT;
+            }
+        }
+        response[i] = pio_sm_get(pio, sm);
+    }
+    // The final partial word was pushed right-aligned.
+    response[n_words - 1] <<= 32 - (response_bits - 1) % 32;
+    idle_clocks(self, SDIO_IDLE_CLOCKS);
+
+    // R2 (136 bits) and R3 (ACMD41) carry no index or CRC.
+    if (response_bits == 48 && index != 41) {
+        uint8_t r[5] = {response_field(response, 2, 6)};
+        for (size_t i = 1; i < 5; i++) {
+            r[i] = response_field(response, 8 * i, 8);
+        }
+        if (r[0] != index || response_field(response, 40, 8) != CRC7(r, 5)) {
+            return -MP_EIO;
+        }
+    }
+    return 0;
+}
+
+STATIC int app_command(sdioio_sdcard_obj_t *self, uint8_t index, uint32_t arg, uint32_t *response) {
+    int result = sdio_command(self, 55, self->rca << 16, 48, response);
+    if (result < 0) {
+        return result;
+    }
+    return sdio_command(self, index, arg, 48, response);
+}
+
+STATIC int check_status(int result, const uint32_t *response) {
+    if (result < 0) {
+        return result;
+    }
+    if (response_field(response, 8, 32) & R1_ERROR_BITS) {
+        return -MP_EIO;
+    }
+    return 0;
+}
+
+STATIC int wait_not_busy(sdioio_sdcard_obj_t *self) {
+    uint64_t deadline = supervisor_ticks_ms64() + SDIO_BUSY_TIMEOUT_MS;
+    while (!gpio_get(self->data[0]->number)) {
+        if (supervisor_ticks_ms64() > deadline) {
+            return -MP_ETIMEDOUT;
+        }
+    }
+    return 0;
+}
+
+STATIC void set_clock(sdioio_sdcard_obj_t *self, uint32_t frequency) {
+    // The data state machines need a few system clocks per bus clock to
+    // follow the edges.
+    frequency = MIN(frequency, MIN(SDIO_MAX_FREQUENCY, clock_get_hz(clk_sys) / 6));
+    common_hal_rp2pio_statemachine_set_frequency(&self->command_sm, frequency * 2);
+    self->frequency = self->command_sm.actual_frequency / 2;
+}
+
+typedef struct {
+    int data;
+    int control;
+} sdio_dma_t;
+
+STATIC bool claim_dma(sdio_dma_t *dma) {
+    dma->data = dma_claim_unused_channel(false);
+    dma->control = dma_claim_unused_channel(false);
+    if (dma->data >= 0 && dma->control >= 0) {
+        return true;
+    }
+    if (dma->data >= 0) {
+        dma_channel_unclaim(dma->data);
+    }
+    if (dma->control >= 0) {
+        dma_channel_unclaim(dma->control);
+    }
+    return false;
+}
+
+// Point the control channel at a list of register pairs for the data
+// channel; a pair of zeroes is a null trigger that ends the chain.
+STATIC void start_dma(sdio_dma_t *dma, rp2pio_statemachine_obj_t *sm_obj, bool tx, const uint32_t *list) {
+    dma_channel_config c = dma_channel_get_default_config(dma->data);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, tx);
+    channel_config_set_write_increment(&c, !tx);
+    channel_config_set_dreq(&c, pio_get_dreq(sm_obj->pio, sm_obj->state_machine, tx));
+    channel_config_set_bswap(&c, true);
+    channel_config_set_chain_to(&c, dma->control);
+    if (tx) {
+        dma_channel_configure(dma->data, &c, &sm_obj->pio->txf[sm_obj->state_machine], NULL, 0, false);
+    } else {
+        dma_channel_configure(dma->data, &c, NULL, &sm_obj->pio->rxf[sm_obj->state_machine], 0, false);
+    }
+
+    c = dma_channel_get_default_config(dma->control);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, 3);
+    volatile uint32_t *target = tx ? &dma_hw->ch[dma->data].al3_transfer_count : &dma_hw->ch[dma->data].al1_write_addr;
+    dma_channel_configure(dma->control, &c, target, list, 2, true);
+}
+
+STATIC int finish_dma(sdio_dma_t *dma, const uint32_t *list_end, uint64_t deadline) {
+    int result = 0;
+    while (dma_hw->ch[dma->control].read_addr != (uintptr_t)list_end ||
+           dma_channel_is_busy(dma->control) || dma_channel_is_busy(dma->data)) {
+        if (supervisor_ticks_ms64() > deadline) {
+            result = -MP_ETIMEDOUT;
+            break;
+        }
+    }
+    // Disable both channels before aborting so that an aborted data channel
+    // cannot chain into the next control block.
+    hw_clear_bits(&dma_hw->ch[dma->control].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+    hw_clear_bits(&dma_hw->ch[dma->data].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+    dma_channel_abort(dma->control);
+    dma_channel_abort(dma->data);
+    dma_channel_unclaim(dma->data);
+    dma_channel_unclaim(dma->control);
+    return result;
+}
+
+STATIC uint32_t block_address(sdioio_sdcard_obj_t *self, uint32_t block) {
+    return self->high_capacity ? block : block * 512;
+}
+
+STATIC int read_chunk(sdioio_sdcard_obj_t *self, uint32_t block, uint32_t *buf, uint32_t count) {
+    uint32_t crc[2 * SDIO_MAX_CHAIN_BLOCKS];
+    // {write_addr, transfer_count} pairs: data, then CRC, for each block.
+    uint32_t list[4 * SDIO_MAX_CHAIN_BLOCKS + 2];
+    uint32_t *entry = list;
+    for (size_t i = 0; i < count; i++) {
+        *entry++ = (uintptr_t)(buf + i * SDIO_BLOCK_WORDS);
+        *entry++ = SDIO_BLOCK_WORDS;
+        *entry++ = (uintptr_t)&crc[2 * i];
+        *entry++ = 2;
+    }
+    *entry++ = 0;
+    *entry++ = 0;
+
+    int result = wait_not_busy(self);
+    if (result < 0) {
+        return result;
+    }
+
+    sdio_dma_t dma;
+    if (!claim_dma(&dma)) {
+        return -MP_EAGAIN;
+    }
+
+    PIO pio = self->rx_sm.pio;
+    uint sm = self->rx_sm.state_machine;
+    restart_state_machine(&self->rx_sm, 0);
+    pio_sm_put(pio, sm, SDIO_RX_NIBBLES - 1);
+    pio_sm_exec(pio, sm, pio_encode_pull(false, false));
+    pio_sm_exec(pio, sm, pio_encode_mov(pio_y, pio_osr));
+    pio_sm_set_enabled(pio, sm, true);
+    start_dma(&dma, &self->rx_sm, false, list);
+
+    uint32_t response[2];
+    result = check_status(sdio_command(self, count == 1 ? 17 : 18, block_address(self, block), 48, response), response);
+    if (result == 0) {
+        result = finish_dma(&dma, entry, supervisor_ticks_ms64() + SDIO_DATA_TIMEOUT_MS);
+    } else {
+        finish_dma(&dma, entry, 0);
+    }
+    if (count > 1) {
+        sdio_command(self, 12, 0, 48, response);
+    }
+    pio_sm_set_enabled(pio, sm, false);
+    int busy = wait_not_busy(self);
+    if (result < 0) {
+        return result;
+    }
+    if (busy < 0) {
+        return busy;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        uint64_t received = (uint64_t)__builtin_bswap32(crc[2 * i]) << 32 | __builtin_bswap32(crc[2 * i + 1]);
+        if (crc16_4bit(buf + i * SDIO_BLOCK_WORDS, SDIO_BLOCK_WORDS) != received) {
+            return -MP_EIO;
+        }
+    }
+    return 0;
+}
+
+STATIC int write_chunk(sdioio_sdcard_obj_t *self, uint32_t block, const uint32_t *buf, uint32_t count) {
+    // Per block: nibble count and start word, then the CRC and end words.
+    // They are stored byte-swapped because the data channel swaps every word
+    // so that buffer bytes go out in order.
+    uint32_t frame[5 * SDIO_MAX_CHAIN_BLOCKS];
+    // {transfer_count, read_addr} pairs: header, data, trailer, for each block.
+    uint32_t list[6 * SDIO_MAX_CHAIN_BLOCKS + 2];
+    uint32_t *entry = list;
+    for (size_t i = 0; i < count; i++) {
+        const uint32_t *data = buf + i * SDIO_BLOCK_WORDS;
+        uint32_t *f = &frame[5 * i];
+        uint64_t crc = crc16_4bit(data, SDIO_BLOCK_WORDS);
+        f[0] = __builtin_bswap32(SDIO_TX_NIBBLES - 1);
+        f[1] = __builtin_bswap32(0xfffffff0);
+        f[2] = __builtin_bswap32(crc >> 32);
+        f[3] = __builtin_bswap32(crc);
+        f[4] = 0xffffffff;
+        *entry++ = 2;
+        *entry++ = (uintptr_t)&f[0];
+        *entry++ = SDIO_BLOCK_WORDS;
+        *entry++ = (uintptr_t)data;
+        *entry++ = 3;
+        *entry++ = (uintptr_t)&f[2];
+    }
+    *entry++ = 0;
+    *entry++ = 0;
+
+    int result = wait_not_busy(self);
+    if (result < 0) {
+        return result;
+    }
+
+    uint32_t response[2];
+    if (count > 1) {
+        // ACMD23 lets the card pre-erase; failure only costs speed.
+        app_command(self, 23, count, response);
+    }
+    result = check_status(sdio_command(self, count == 1 ? 24 : 25, block_address(self, block), 48, response), response);
+    if (result < 0) {
+        return result;
+    }
+
+    sdio_dma_t dma;
+    if (!claim_dma(&dma)) {
+        result = -MP_EAGAIN;
+    } else {
+        PIO pio = self->tx_sm.pio;
+        uint sm = self->tx_sm.state_machine;
+        restart_state_machine(&self->tx_sm, 0);
+        pio_sm_set_enabled(pio, sm, true);
+        start_dma(&dma, &self->tx_sm, true, list);
+
+        uint64_t deadline = supervisor_ticks_ms64() + SDIO_DATA_TIMEOUT_MS;
+        for (size_t accepted = 0; accepted < count && result == 0;) {
+            if (!pio_sm_is_rx_fifo_empty(pio, sm)) {
+                uint32_t token = pio_sm_get(pio, sm);
+                if (((token >> 4) & 0xf) != 0x5) {
+                    result = -MP_EIO;
+                }
+                accepted++;
+                deadline = supervisor_ticks_ms64() + SDIO_DATA_TIMEOUT_MS;
+            } else if (supervisor_ticks_ms64() > deadline) {
+                result = -MP_ETIMEDOUT;
+            }
+        }
+        finish_dma(&dma, entry, 0);
+        // Stop driving the data lines whatever state the program was left in.
+        restart_state_machine(&self->tx_sm, 0);
+    }
+
+    if (count > 1) {
+        sdio_command(self, 12, 0, 48, response);
+    }
+    int busy = wait_not_busy(self);
+    return result < 0 ? result : busy;
+}
+
+STATIC const compressed_string_t *init_card(sdioio_sdcard_obj_t *self) {
+    uint32_t response[5];
+
+    // The command state machine has been clocking the card with CMD high,
+    // which covers the 74 clocks needed after power up.
+    mp_hal_delay_ms(1);
+
+    sdio_command(self, 0, 0, 0, NULL);
+
+    bool v2 = sdio_command(self, 8, 0x1aa, 48, response) == 0 &&
+        (response_field(response, 8, 32) & 0xfff) == 0x1aa;
+
+    uint32_t ocr = 0;
+    for (int i = 0; i < 100; i++) {
+        if (app_command(self, 41, v2 ? 0x40ff8000 : 0x00ff8000, response) < 0) {
+            return translate("no SD card");
+        }
+        ocr = response_field(response, 8, 32);
+        if (ocr & 0x80000000) {
+            break;
+        }
+        mp_hal_delay_ms(10);
+    }
+    if (!(ocr & 0x80000000)) {
+        return v2 ? translate("timeout waiting for v2 card") : translate("timeout waiting for v1 card");
+    }
+    self->high_capacity = ocr & 0x40000000;
+
+    if (sdio_command(self, 2, 0, 136, response) < 0 ||
+        sdio_command(self, 3, 0, 48, response) < 0) {
+        return translate("couldn't determine SD card version");
+    }
+    self->rca = response_field(response, 8, 16);
+
+    {
+        if (sdio_command(self, 9, self->rca << 16, 136, response) < 0) {
+            return translate("no response from SD card");
+        }
+        uint8_t csd[16];
+        for (size_t i = 0; i < sizeof(csd); i++) {
+            csd[i] = response_field(response, 8 + 8 * i, 8);
+        }
+        int csd_version = (csd[0] & 0xC0) >> 6;
+        if (csd_version >= 2) {
+            return translate("SD card CSD format not supported");
+        }
+
+        if (csd_version == 1) {
+            uint32_t c_size = (csd[7] & 0x3f) << 16 | csd[8] << 8 | csd[9];
+            self->capacity = (c_size + 1) * 1024;
+        } else {
+            uint32_t block_length = 1 << (csd[5] & 0xF);
+            uint32_t c_size = ((csd[6] & 0x3) << 10) | (csd[7] << 2) | ((csd[8] & 0xC0) >> 6);
+            uint32_t mult = 1 << (((csd[9] & 0x3) << 1 | (csd[10] & 0x80) >> 7) + 2);
+            self->capacity = block_length / 512 * mult * (c_size + 1);
+        }
+    }
+
+    if (sdio_command(self, 7, self->rca << 16, 48, response) < 0 || wait_not_busy(self) < 0) {
+        return translate("no response from SD card");
+    }
+
+    // ACMD6: switch the card to the 4-bit bus.
+    if (check_status(app_command(self, 6, 2, response), response) < 0) {
+        return translate("no response from SD card");
+    }
+
+    if (check_status(sdio_command(self, 16, 512, 48, response), response) < 0) {
+        return translate("can't set 512 block size");
+    }
+
+    return NULL;
+}
+
+void common_hal_sdioio_sdcard_construct(sdioio_sdcard_obj_t *self,
+    const mcu_pin_obj_t *clock, const mcu_pin_obj_t *command,
+    uint8_t num_data, const mcu_pin_obj_t **data, uint32_t frequency) {
+
+    mp_arg_validate_length(num_data, 4, MP_QSTR_data);
+    for (size_t i = 1; i < 4; i++) {
+        if (data[i]->number != data[0]->number + i) {
+            mp_raise_RuntimeError(translate("Pins must be sequential GPIO pins"));
+        }
+    }
+
+    self->clock = clock;
+    self->command = command;
+    for (size_t i = 0; i < 4; i++) {
+        self->data[i] = data[i];
+    }
+    self->rca = 0;
+    build_programs(self);
+
+    uint32_t clock_mask = 1 << clock->number;
+    uint32_t command_mask = 1 << command->number;
+    uint32_t data_mask = 0xf << data[0]->number;
+
+    // The data state machines share a PIO, and so DAT0..DAT3; place them
+    // before the command state machine, which can go on either.
+    bool ok = rp2pio_statemachine_construct(&self->rx_sm,
+        self->rx_program, MP_ARRAY_SIZE(self->rx_program),
+        0, // full speed, to follow the bus clock
+        NULL, 0, // init program
+        NULL, 0, // out
+        data[0], 4, // in
+        data_mask, 0, // in pulls
+        NULL, 0, // set
+        NULL, 0, // sideset
+        data_mask, 0, // initial pin state
+        data[0], // jump pin
+        data_mask, true, true,
+        false, 32, false, // no auto pull
+        false, // wait for TX stall
+        true, 32, false, // RX, auto push every 32 bits, first nibble in the top bits
+        true, // claim pins
+        false, // Not user-interruptible.
+        false, // No sideset enable
+        0, -1); // wrap settings
+    if (ok) {
+        ok = rp2pio_statemachine_construct(&self->tx_sm,
+            self->tx_program, MP_ARRAY_SIZE(self->tx_program),
+            0, // full speed, to follow the bus clock
+            NULL, 0, // init program
+            data[0], 4, // out
+            data[0], 4, // in
+            data_mask, 0, // in pulls
+            data[0], 4, // set
+            NULL, 0, // sideset
+            data_mask, 0, // initial pin state
+            data[0], // jump pin
+            data_mask, true, true,
+            true, 32, false, // TX, auto pull every 32 bits, first nibble in the top bits
+            false, // wait for TX stall
+            false, 32, false, // no auto push
+            false, // pins already claimed by the receive state machine
+            false, // Not user-interruptible.
+            false, // No sideset enable
+            0, -1); // wrap settings
+        if (!ok) {
+            rp2pio_statemachine_deinit(&self->rx_sm, false);
+        }
+    }
+    if (ok) {
+        ok = rp2pio_statemachine_construct(&self->command_sm,
+            self->command_program, MP_ARRAY_SIZE(self->command_program),
+            SDIO_INIT_FREQUENCY * 2,
+            NULL, 0, // init program
+            command, 1, // out
+            command, 1, // in
+            command_mask, 0, // in pulls
+            command, 1, // set
+            clock, 1, // sideset
+            command_mask, clock_mask, // initial pin state
+            command, // jump pin
+            clock_mask | command_mask, true, true,
+            true, 32, false, // TX, auto pull every 32 bits, msb first
+            false, // wait for TX stall
+            true, 32, false, // RX, auto push every 32 bits, msb first
+            true, // claim pins
+            false, // Not user-interruptible.
+            false, // No sideset enable
+            0, -1); // wrap settings
+        if (!ok) {
+            rp2pio_statemachine_deinit(&self->tx_sm, false);
+            rp2pio_statemachine_deinit(&self->rx_sm, false);
+        }
+    }
+    if (!ok) {
+        mp_raise_RuntimeError(translate("All state machines in use"));
+    }
+
+    // The idle loop tests for an empty TX FIFO; set up the status source,
+    // then start over so that the change takes effect from the first
+    // instruction.
+    PIO pio = self->command_sm.pio;
+    uint sm = self->command_sm.state_machine;
+    hw_write_masked(&pio->sm[sm].execctrl,
+        (STATUS_TX_LESSTHAN << PIO_SM0_EXECCTRL_STATUS_SEL_LSB) | (1 << PIO_SM0_EXECCTRL_STATUS_N_LSB),
+        PIO_SM0_EXECCTRL_STATUS_SEL_BITS | PIO_SM0_EXECCTRL_STATUS_N_BITS);
+    restart_command_sm(self);
+    self->frequency = self->command_sm.actual_frequency / 2;
+
+    const compressed_string_t *result = init_card(self);
+    if (result != NULL) {
+        common_hal_sdioio_sdcard_deinit(self);
+        mp_raise_OSError_msg(result);
+    }
+
+    set_clock(self, frequency);
+}
+
+STATIC void check_for_deinit(sdioio_sdcard_obj_t *self) {
+    if (common_hal_sdioio_sdcard_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+uint32_t common_hal_sdioio_sdcard_get_count(sdioio_sdcard_obj_t *self) {
+    return self->capacity;
+}
+
+uint32_t common_hal_sdioio_sdcard_get_frequency(sdioio_sdcard_obj_t *self) {
+    return self->frequency;
+}
+
+uint8_t common_hal_sdioio_sdcard_get_width(sdioio_sdcard_obj_t *self) {
+    return 4;
+}
+
+STATIC void check_whole_block(mp_buffer_info_t *bufinfo) {
+    if (bufinfo->len % 512) {
+        mp_raise_ValueError(translate("Buffer must be a multiple of 512 bytes"));
+    }
+}
+
+int common_hal_sdioio_sdcard_readblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo) {
+    check_for_deinit(self);
+    check_whole_block(bufinfo);
+    uint8_t *buf = bufinfo->buf;
+    uint32_t count = bufinfo->len / 512;
+    while (count) {
+        uint32_t n;
+        int result;
+        if ((uintptr_t)buf & 3) {
+            // DMA needs word alignment; go through a bounce buffer.
+            uint32_t bounce[SDIO_BLOCK_WORDS];
+            n = 1;
+            result = read_chunk(self, start_block, bounce, n);
+            memcpy(buf, bounce, 512);
+        } else {
+            n = MIN(count, SDIO_MAX_CHAIN_BLOCKS);
+            result = read_chunk(self, start_block, (uint32_t *)buf, n);
+        }
+        if (result < 0) {
+            return result;
+        }
+        buf += n * 512;
+        start_block += n;
+        count -= n;
+    }
+    return 0;
+}
+
+int common_hal_sdioio_sdcard_writeblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo) {
+    check_for_deinit(self);
+    check_whole_block(bufinfo);
+    const uint8_t *buf = bufinfo->buf;
+    uint32_t count = bufinfo->len / 512;
+    while (count) {
+        uint32_t n;
+        int result;
+        if ((uintptr_t)buf & 3) {
+            uint32_t bounce[SDIO_BLOCK_WORDS];
+            n = 1;
+            memcpy(bounce, buf, 512);
+            result = write_chunk(self, start_block, bounce, n);
+        } else {
+            n = MIN(count, SDIO_MAX_CHAIN_BLOCKS);
+            result = write_chunk(self, start_block, (const uint32_t *)buf, n);
+        }
+        if (result < 0) {
+            return result;
+        }
+        buf += n * 512;
+        start_block += n;
+        count -= n;
+    }
+    return 0;
+}
+
+bool common_hal_sdioio_sdcard_configure(sdioio_sdcard_obj_t *self, uint32_t frequency, uint8_t bits) {
+    check_for_deinit(self);
+    // Only the 4-bit bus is supported, so just the clock can change.
+    if (frequency) {
+        set_clock(self, frequency);
+    }
+    return true;
+}
+
+void common_hal_sdioio_sdcard_unlock(sdioio_sdcard_obj_t *self) {
+}
+
+bool common_hal_sdioio_sdcard_deinited(sdioio_sdcard_obj_t *self) {
+    return common_hal_rp2pio_statemachine_deinited(&self->command_sm);
+}
+
+void common_hal_sdioio_sdcard_deinit(sdioio_sdcard_obj_t *self) {
+    if (common_hal_sdioio_sdcard_deinited(self)) {
+        return;
+    }
+    rp2pio_statemachine_deinit(&self->command_sm, false);
+    rp2pio_statemachine_deinit(&self->tx_sm, false);
+    rp2pio_statemachine_deinit(&self->rx_sm, false);
+}
+
+void common_hal_sdioio_sdcard_never_reset(sdioio_sdcard_obj_t *self) {
+    if (common_hal_sdioio_sdcard_deinited(self)) {
+        return;
+    }
+    rp2pio_statemachine_never_reset(self->command_sm.pio, self->command_sm.state_machine);
+    rp2pio_statemachine_never_reset(self->tx_sm.pio, self->tx_sm.state_machine);
+    rp2pio_statemachine_never_reset(self->rx_sm.pio, self->rx_sm.state_machine);
+    common_hal_never_reset_pin(self->clock);
+    common_hal_never_reset_pin(self->command);
+    for (size_t i = 0; i < MP_ARRAY_SIZE(self->data); i++) {
+        common_hal_never_reset_pin(self->data[i]);
+    }
+}
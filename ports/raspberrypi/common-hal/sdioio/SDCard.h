@@ -0,0 +1,54 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "common-hal/microcontroller/Pin.h"
+#include "common-hal/rp2pio/StateMachine.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    // One state machine clocks the bus and runs commands; the other two share
+    // DAT0..DAT3 and move data blocks in each direction.
+    rp2pio_statemachine_obj_t command_sm;
+    rp2pio_statemachine_obj_t rx_sm;
+    rp2pio_statemachine_obj_t tx_sm;
+    // The programs are assembled at construct time, since the data programs
+    // wait on the clock pin by number. rp2pio identifies programs by address,
+    // so they live here rather than on the stack.
+    uint16_t command_program[16];
+    uint16_t rx_program[8];
+    uint16_t tx_program[20];
+    const mcu_pin_obj_t *clock;
+    const mcu_pin_obj_t *command;
+    const mcu_pin_obj_t *data[4];
+    uint32_t frequency;
+    uint32_t capacity;
+    uint16_t rca;
+    bool high_capacity;
+} sdioio_sdcard_obj_t;
@@ -142,6 +142,10 @@ STATIC void lwip_socket_free_incoming(socketpool_socket_obj_t *socket) {
             pbuf_free(socket->incoming.pbuf);
             socket->incoming.pbuf = NULL;
         }
+        for (uint8_t i = 0; i < socket->backlog_len; i++) {
+            pbuf_free(socket->backlog[i]);
+        }
+        socket->backlog_len = 0;
     } else {
         uint8_t alloc = socket->incoming.connection.alloc;
         struct tcp_pcb *volatile *tcp_array = lwip_socket_incoming_array(socket);
@@ -167,6 +171,45 @@ static inline void exec_user_callback(socketpool_socket_obj_t *socket) {
     }
     #endif
     supervisor_workflow_request_background();
+    // Wake a select.poll() waiting on this socket.
+    port_wake_main_task();
+}
+
+// Stash an incoming datagram and its source: in incoming.pbuf if the socket has nothing unread,
+// or else at the end of the backlog.
+STATIC void lwip_udp_queue_incoming(socketpool_socket_obj_t *socket, struct pbuf *p, const ip_addr_t *addr, u16_t port) {
+    if (socket->incoming.pbuf == NULL) {
+        socket->incoming.pbuf = p;
+        socket->peer_port = (mp_uint_t)port;
+        memcpy(&socket->peer, addr, sizeof(socket->peer));
+    } else if (socket->backlog_len < SOCKETPOOL_UDP_BACKLOG) {
+        uint8_t i = socket->backlog_len++;
+        socket->backlog[i] = p;
+        socket->backlog_port[i] = port;
+        memcpy(socket->backlog_peer[i], addr, sizeof(socket->backlog_peer[i]));
+    } else {
+        // That's why they call it "unreliable". No room in the inn, drop the packet.
+        pbuf_free(p);
+    }
+}
+
+// Free the datagram in incoming.pbuf, which has been read, and move the oldest one in the
+// backlog into its place. Must be called with the lwIP lock held.
+STATIC void lwip_udp_next_incoming(socketpool_socket_obj_t *socket) {
+    pbuf_free(socket->incoming.pbuf);
+    socket->incoming.pbuf = NULL;
+    if (socket->backlog_len == 0) {
+        return;
+    }
+    socket->incoming.pbuf = socket->backlog[0];
+    socket->peer_port = socket->backlog_port[0];
+    memcpy(&socket->peer, socket->backlog_peer[0], sizeof(socket->peer));
+    socket->backlog_len--;
+    for (uint8_t i = 0; i < socket->backlog_len; i++) {
+        socket->backlog[i] = socket->backlog[i + 1];
+        socket->backlog_port[i] = socket->backlog_port[i + 1];
+        memcpy(socket->backlog_peer[i], socket->backlog_peer[i + 1], sizeof(socket->backlog_peer[i]));
+    }
 }
 
 #if MICROPY_PY_LWIP_SOCK_RAW
@@ -179,12 +222,7 @@ STATIC u8_t _lwip_raw_incoming(void *arg, struct raw_pcb *pcb, struct pbuf *p, c
 {
     socketpool_socket_obj_t *socket = (socketpool_socket_obj_t *)arg;
 
-    if (socket->incoming.pbuf != NULL) {
-        pbuf_free(p);
-    } else {
-        socket->incoming.pbuf = p;
-        memcpy(&socket->peer, addr, sizeof(socket->peer));
-    }
+    lwip_udp_queue_incoming(socket, p, addr, 0);
     return 1; // we ate the packet
 }
 #endif
@@ -199,14 +237,24 @@ STATIC void _lwip_udp_incoming(void *arg, struct udp_pcb *upcb, struct pbuf *p,
 {
     socketpool_socket_obj_t *socket = (socketpool_socket_obj_t *)arg;
 
-    if (socket->incoming.pbuf != NULL) {
-        // That's why they call it "unreliable". No room in the inn, drop the packet.
-        pbuf_free(p);
-    } else {
-        socket->incoming.pbuf = p;
-        socket->peer_port = (mp_uint_t)port;
-        memcpy(&socket->peer, addr, sizeof(socket->peer));
+    lwip_udp_queue_incoming(socket, p, addr, port);
+}
+
+// Forget pinned objects whose data has been acknowledged, so lwIP no longer refers to it.
+// Returns whether any are still pinned. Must be called with the lwIP lock held.
+STATIC bool lwip_tcp_release_pinned(socketpool_socket_obj_t *socket) {
+    bool pinned = false;
+    for (size_t i = 0; i < SOCKETPOOL_PINNED_WRITES; i++) {
+        if (socket->pinned[i] == MP_OBJ_NULL) {
+            continue;
+        }
+        if (socket->pcb.tcp == NULL || TCP_SEQ_GEQ(socket->pcb.tcp->lastack, socket->pinned_end[i])) {
+            socket->pinned[i] = MP_OBJ_NULL;
+        } else {
+            pinned = true;
+        }
     }
+    return pinned;
 }
 
 // Callback for general tcp errors.
@@ -219,6 +267,9 @@ STATIC void _lwip_tcp_error(void *arg, err_t err) {
     socket->state = err;
     // If we got here, the lwIP stack either has deallocated or will deallocate the pcb.
     socket->pcb.tcp = NULL;
+    // Along with any segments that refer to pinned data.
+    lwip_tcp_release_pinned(socket);
+    port_wake_main_task();
 }
 
 // Callback for tcp connection requests. Error code err is unused. (See tcp.h)
@@ -226,6 +277,7 @@ STATIC err_t _lwip_tcp_connected(void *arg, struct tcp_pcb *tpcb, err_t err) {
     socketpool_socket_obj_t *socket = (socketpool_socket_obj_t *)arg;
 
     socket->state = STATE_CONNECTED;
+    port_wake_main_task();
     return ERR_OK;
 }
 
@@ -428,8 +480,7 @@ STATIC mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf
     MICROPY_PY_LWIP_ENTER
 
     u16_t result = pbuf_copy_partial(p, buf, ((p->tot_len > len) ? len : p->tot_len), 0);
-    pbuf_free(p);
-    socket->incoming.pbuf = NULL;
+    lwip_udp_next_incoming(socket);
 
     MICROPY_PY_LWIP_EXIT
 
@@ -454,8 +505,27 @@ STATIC mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf
     assert(socket->pcb.tcp);
 
 
-// Helper function for send/sendto to handle TCP packets
-STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf, mp_uint_t len, int *_errno) {
+// Returns the slot to pin owner in, or -1 if there is none free and the data must be copied.
+// Must be called with the lwIP lock held.
+STATIC int lwip_tcp_pin_slot(socketpool_socket_obj_t *socket, mp_obj_t owner) {
+    lwip_tcp_release_pinned(socket);
+    int free_slot = -1;
+    for (size_t i = 0; i < SOCKETPOOL_PINNED_WRITES; i++) {
+        if (socket->pinned[i] == owner) {
+            return i;
+        }
+        if (socket->pinned[i] == MP_OBJ_NULL && free_slot < 0) {
+            free_slot = i;
+        }
+    }
+    return free_slot;
+}
+
+// Helper function for send/sendto to handle TCP packets. For sendall(), which will send the rest
+// of buf straight after, a write of only part of buf is marked as having more to follow. When
+// owner isn't MP_OBJ_NULL, it is an immutable object holding buf and is pinned so that the data
+// needn't be copied.
+STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf, mp_uint_t len, bool sendall, mp_obj_t owner, int *_errno) {
     // Check for any pending errors
     STREAM_ERROR_CHECK(socket);
 
@@ -494,6 +564,11 @@ STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf,
 
     u16_t write_len = MIN(available, len);
 
+    int pin = -1;
+    if (owner != MP_OBJ_NULL) {
+        pin = lwip_tcp_pin_slot(socket, owner);
+    }
+
     // If tcp_write returns ERR_MEM then there's currently not enough memory to
     // queue the write, so wait and keep trying until it succeeds (with 10s limit).
     // Note: if the socket is non-blocking then this code will actually block until
@@ -501,7 +576,11 @@ STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf,
     // committed to being able to write the data.
     err_t err;
     for (int i = 0; i < 200; ++i) {
-        err = tcp_write(socket->pcb.tcp, buf, write_len, TCP_WRITE_FLAG_COPY);
+        u8_t flags = pin < 0 ? TCP_WRITE_FLAG_COPY : 0;
+        if (sendall && write_len < len) {
+            flags |= TCP_WRITE_FLAG_MORE;
+        }
+        err = tcp_write(socket->pcb.tcp, buf, write_len, flags);
         if (err != ERR_MEM) {
             break;
         }
@@ -519,8 +598,15 @@ STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf,
         MICROPY_PY_LWIP_REENTER
     }
 
-    // If the output buffer is getting full then send the data to the lower layers
-    if (err == ERR_OK && tcp_sndbuf(socket->pcb.tcp) < TCP_SND_BUF / 4) {
+    if (err == ERR_OK && pin >= 0) {
+        socket->pinned[pin] = owner;
+        socket->pinned_end[pin] = socket->pcb.tcp->snd_lbb;
+    }
+
+    // If the output buffer is getting full, or all of a sendall() has been written, then send
+    // the data to the lower layers
+    if (err == ERR_OK && (tcp_sndbuf(socket->pcb.tcp) < TCP_SND_BUF / 4 ||
+                          (sendall && write_len == len))) {
         err = tcp_output(socket->pcb.tcp);
     }
 
@@ -578,32 +664,35 @@ STATIC mp_uint_t lwip_tcp_receive(socketpool_socket_obj_t *socket, byte *buf, mp
 
     assert(socket->pcb.tcp != NULL);
 
+    // Copy from as many pbufs of the chain as fit, and acknowledge them all at once.
     struct pbuf *p = socket->incoming.pbuf;
-
-    mp_uint_t remaining = p->len - socket->recv_offset;
-    if (len > remaining) {
-        len = remaining;
-    }
-
-    memcpy(buf, (byte *)p->payload + socket->recv_offset, len);
-
-    remaining -= len;
-    if (remaining == 0) {
-        socket->incoming.pbuf = p->next;
-        // If we don't ref here, free() will free the entire chain,
-        // if we ref, it does what we need: frees 1st buf, and decrements
-        // next buf's refcount back to 1.
-        pbuf_ref(p->next);
-        pbuf_free(p);
-        socket->recv_offset = 0;
-    } else {
-        socket->recv_offset += len;
+    mp_uint_t received = 0;
+    while (p != NULL && received < len) {
+        mp_uint_t remaining = p->len - socket->recv_offset;
+        mp_uint_t n = MIN(remaining, len - received);
+
+        memcpy(buf + received, (byte *)p->payload + socket->recv_offset, n);
+        received += n;
+
+        if (n == remaining) {
+            struct pbuf *next = p->next;
+            // If we don't ref here, free() will free the entire chain,
+            // if we ref, it does what we need: frees 1st buf, and decrements
+            // next buf's refcount back to 1.
+            pbuf_ref(next);
+            pbuf_free(p);
+            p = next;
+            socket->recv_offset = 0;
+        } else {
+            socket->recv_offset += n;
+        }
     }
-    tcp_recved(socket->pcb.tcp, len);
+    socket->incoming.pbuf = p;
+    tcp_recved(socket->pcb.tcp, received);
 
     MICROPY_PY_LWIP_EXIT
 
-    return len;
+    return received;
 }
 
 
@@ -673,6 +762,7 @@ bool socketpool_socket(socketpool_socketpool_obj_t *self,
 
     socket->timeout = -1;
     socket->recv_offset = 0;
+    socket->backlog_len = 0;
     socket->domain = SOCKETPOOL_AF_INET;
     socket->type = type;
     socket->callback = MP_OBJ_NULL;
@@ -813,6 +903,7 @@ int socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_
     accepted->domain = MOD_NETWORK_AF_INET;
     accepted->type = MOD_NETWORK_SOCK_STREAM;
     accepted->incoming.pbuf = NULL;
+    accepted->backlog_len = 0;
     accepted->timeout = self->timeout;
     accepted->state = STATE_CONNECTED;
     accepted->recv_offset = 0;
@@ -902,8 +993,30 @@ STATIC err_t _lwip_tcp_close_poll(void *arg, struct tcp_pcb *pcb) {
     return ERR_OK;
 }
 
+// Data written without copying must stay valid for as long as lwIP may retransmit it, so wait
+// for it to be acknowledged. Returns false when it isn't, and the connection must be aborted.
+STATIC bool lwip_tcp_wait_pinned(socketpool_socket_obj_t *socket) {
+    mp_uint_t start = mp_hal_ticks_ms();
+    while (true) {
+        MICROPY_PY_LWIP_ENTER
+        bool pinned = lwip_tcp_release_pinned(socket);
+        MICROPY_PY_LWIP_EXIT
+        if (!pinned) {
+            return true;
+        }
+        // A finaliser can't wait, and the pinned objects may be collected along with the socket.
+        if (gc_is_locked() || mp_hal_is_interrupted() ||
+            mp_hal_ticks_ms() - start > MICROPY_PY_LWIP_TCP_CLOSE_TIMEOUT_MS) {
+            return false;
+        }
+        RUN_BACKGROUND_TASKS;
+        mp_hal_delay_ms(1);
+    }
+}
+
 void socketpool_socket_close(socketpool_socket_obj_t *socket) {
     unregister_open_socket(socket);
+    bool abort = socket->type == SOCKETPOOL_SOCK_STREAM && !lwip_tcp_wait_pinned(socket);
     MICROPY_PY_LWIP_ENTER
     if (socket->pcb.tcp == NULL) { // already closed
         MICROPY_PY_LWIP_EXIT
@@ -924,7 +1037,10 @@ void socketpool_socket_close(socketpool_socket_obj_t *socket) {
                 // the latter may free the pcb; if it doesn't then the callback will be active.
                 tcp_poll(socket->pcb.tcp, _lwip_tcp_close_poll, MICROPY_PY_LWIP_TCP_CLOSE_TIMEOUT_MS / 500);
             }
-            if (tcp_close(socket->pcb.tcp) != ERR_OK) {
+            if (abort) {
+                // Drops the segments that refer to pinned data.
+                tcp_abort(socket->pcb.tcp);
+            } else if (tcp_close(socket->pcb.tcp) != ERR_OK) {
                 DEBUG_printf("lwip_close: had to call tcp_abort()\n");
                 tcp_abort(socket->pcb.tcp);
             }
@@ -944,6 +1060,7 @@ void socketpool_socket_close(socketpool_socket_obj_t *socket) {
 
     socket->pcb.tcp = NULL;
     socket->state = _ERR_BADF;
+    lwip_tcp_release_pinned(socket);
     MICROPY_PY_LWIP_EXIT
 }
 
@@ -1127,7 +1244,7 @@ int socketpool_socket_send(socketpool_socket_obj_t *socket, const uint8_t *buf,
     int _errno = 0;
     switch (socket->type) {
         case SOCKETPOOL_SOCK_STREAM: {
-            ret = lwip_tcp_send(socket, buf, len, &_errno);
+            ret = lwip_tcp_send(socket, buf, len, false, MP_OBJ_NULL, &_errno);
             break;
         }
         case SOCKETPOOL_SOCK_DGRAM:
@@ -1152,6 +1269,18 @@ mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const
     return sent;
 }
 
+mp_uint_t common_hal_socketpool_socket_sendall_part(socketpool_socket_obj_t *self, mp_obj_t owner, const uint8_t *buf, uint32_t len) {
+    if (self->type != SOCKETPOOL_SOCK_STREAM) {
+        return common_hal_socketpool_socket_send(self, buf, len);
+    }
+    int _errno = 0;
+    mp_uint_t sent = lwip_tcp_send(self, buf, len, true, owner, &_errno);
+    if (sent == (unsigned)-1) {
+        mp_raise_OSError(_errno);
+    }
+    return sent;
+}
+
 mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *socket,
     const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len) {
     int _errno;
@@ -1161,7 +1290,7 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *socket,
     mp_uint_t ret = 0;
     switch (socket->type) {
         case SOCKETPOOL_SOCK_STREAM: {
-            ret = lwip_tcp_send(socket, buf, len, &_errno);
+            ret = lwip_tcp_send(socket, buf, len, false, MP_OBJ_NULL, &_errno);
             break;
         }
         case SOCKETPOOL_SOCK_DGRAM:
@@ -1178,6 +1307,63 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *socket,
     return ret;
 }
 
+mp_uint_t common_hal_socketpool_socket_sendto_many(socketpool_socket_obj_t *socket,
+    const char *host, size_t hostlen, uint32_t port, const uint8_t *buf,
+    const uint16_t *ends, size_t count) {
+    if (socket->type == SOCKETPOOL_SOCK_STREAM) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+    ip_addr_t ip;
+    socketpool_resolve_host_raise(socket->pool, host, &ip);
+
+    size_t sent = 0;
+    mp_uint_t start = 0;
+    for (; sent < count; sent++) {
+        mp_uint_t end = ends[sent];
+        int _errno;
+        if (lwip_raw_udp_send(socket, buf + start, end - start, &ip, port, &_errno) == (unsigned)-1) {
+            if (sent == 0) {
+                mp_raise_OSError(_errno);
+            }
+            // Report what was sent; the caller can resend the rest.
+            break;
+        }
+        start = end;
+    }
+    return sent;
+}
+
+mp_uint_t common_hal_socketpool_socket_recvfrom_many_into(socketpool_socket_obj_t *socket,
+    uint8_t *buf, uint32_t len, uint16_t *ends, size_t count,
+    uint8_t *ip, uint32_t *port) {
+    if (socket->type == SOCKETPOOL_SOCK_STREAM) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+    // Wait for the first datagram as recvfrom_into() does.
+    int _errno;
+    mp_uint_t used = lwip_raw_udp_receive(socket, buf, len, ip, port, &_errno);
+    if (used == (unsigned)-1) {
+        mp_raise_OSError(_errno);
+    }
+    ends[0] = used;
+
+    // Then take any others already queued from the same source that fit whole.
+    size_t received = 1;
+    MICROPY_PY_LWIP_ENTER
+    while (received < count) {
+        struct pbuf *p = socket->incoming.pbuf;
+        if (p == NULL || p->tot_len > len - used ||
+            socket->peer_port != *port || memcmp(socket->peer, ip, sizeof(socket->peer)) != 0) {
+            break;
+        }
+        used += pbuf_copy_partial(p, buf + used, p->tot_len, 0);
+        lwip_udp_next_incoming(socket);
+        ends[received++] = used;
+    }
+    MICROPY_PY_LWIP_EXIT
+    return received;
+}
+
 void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms) {
     self->timeout = timeout_ms;
 }
@@ -60,6 +60,20 @@ typedef struct _lwip_socket_obj_t {
     mp_uint_t timeout;
     uint16_t recv_offset;
 
+    // Immutable objects whose data lwIP refers to, having been written without copying, and
+    // the sequence number just past that data. They are kept until it has been acknowledged.
+    #define SOCKETPOOL_PINNED_WRITES 4
+    mp_obj_t pinned[SOCKETPOOL_PINNED_WRITES];
+    uint32_t pinned_end[SOCKETPOOL_PINNED_WRITES];
+
+    // Datagrams that arrived while incoming.pbuf was still unread, and their sources, so that
+    // a burst can be collected by one recvfrom_many_into() instead of being dropped.
+    #define SOCKETPOOL_UDP_BACKLOG 4
+    struct pbuf *backlog[SOCKETPOOL_UDP_BACKLOG];
+    byte backlog_peer[SOCKETPOOL_UDP_BACKLOG][4];
+    uint16_t backlog_port[SOCKETPOOL_UDP_BACKLOG];
+    uint8_t backlog_len;
+
     uint8_t domain;
     uint8_t type;
 
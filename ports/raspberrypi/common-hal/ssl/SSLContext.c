@@ -35,6 +35,68 @@
 
 void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self) {
     common_hal_ssl_sslcontext_set_default_verify_paths(self);
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        self->session_cache[i].hostname = MP_OBJ_NULL;
+        mbedtls_ssl_session_init(&self->session_cache[i].session);
+    }
+    self->session_cache_next = 0;
+    self->session_hits = 0;
+    self->session_misses = 0;
+}
+
+void common_hal_ssl_sslcontext_deinit(ssl_sslcontext_obj_t *self) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        self->session_cache[i].hostname = MP_OBJ_NULL;
+        mbedtls_ssl_session_free(&self->session_cache[i].session);
+    }
+}
+
+mp_uint_t common_hal_ssl_sslcontext_get_session_hits(ssl_sslcontext_obj_t *self) {
+    return self->session_hits;
+}
+
+mp_uint_t common_hal_ssl_sslcontext_get_session_misses(ssl_sslcontext_obj_t *self) {
+    return self->session_misses;
+}
+
+STATIC ssl_session_cache_entry_t *find_session(ssl_sslcontext_obj_t *self, mp_obj_t hostname) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        ssl_session_cache_entry_t *entry = &self->session_cache[i];
+        if (entry->hostname != MP_OBJ_NULL && mp_obj_equal(entry->hostname, hostname)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+void ssl_sslcontext_resume_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname) {
+    ssl_session_cache_entry_t *entry = find_session(self, hostname);
+    if (entry != NULL) {
+        // On failure the handshake is simply a full one.
+        (void)mbedtls_ssl_set_session(ssl, &entry->session);
+    }
+}
+
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname, bool resumed) {
+    if (resumed) {
+        self->session_hits++;
+    } else {
+        self->session_misses++;
+    }
+    ssl_session_cache_entry_t *entry = find_session(self, hostname);
+    if (entry == NULL) {
+        entry = &self->session_cache[self->session_cache_next];
+        self->session_cache_next = (self->session_cache_next + 1) % CIRCUITPY_SSL_SESSION_CACHE_SIZE;
+        entry->hostname = hostname;
+    }
+    // Keep the newest session, since the server may have issued a new ticket.
+    mbedtls_ssl_session_free(&entry->session);
+    mbedtls_ssl_session_init(&entry->session);
+    if (mbedtls_ssl_get_session(ssl, &entry->session) != 0) {
+        mbedtls_ssl_session_free(&entry->session);
+        mbedtls_ssl_session_init(&entry->session);
+        entry->hostname = MP_OBJ_NULL;
+    }
 }
 
 void common_hal_ssl_sslcontext_load_verify_locations(ssl_sslcontext_obj_t *self,
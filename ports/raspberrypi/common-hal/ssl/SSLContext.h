@@ -30,6 +30,11 @@
 #include "py/obj.h"
 #include "mbedtls/ssl.h"
 
+typedef struct {
+    mp_obj_t hostname;
+    mbedtls_ssl_session session;
+} ssl_session_cache_entry_t;
+
 typedef struct {
     mp_obj_base_t base;
     bool check_name, use_global_ca_store;
@@ -37,4 +42,11 @@ typedef struct {
     size_t cacert_bytes;
     int (*crt_bundle_attach)(mbedtls_ssl_config *conf);
     mp_buffer_info_t cert_buf, key_buf;
+    // Client sessions, keyed by server hostname, that later connections try to resume.
+    ssl_session_cache_entry_t session_cache[CIRCUITPY_SSL_SESSION_CACHE_SIZE];
+    uint8_t session_cache_next;
+    mp_uint_t session_hits, session_misses;
 } ssl_sslcontext_obj_t;
+
+void ssl_sslcontext_resume_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname);
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname, bool resumed);
@@ -40,6 +40,9 @@
 #include "py/stream.h"
 #include "supervisor/shared/tick.h"
 
+// For the handshake state, to tell whether a session was resumed.
+#include "mbedtls/ssl_internal.h"
+
 #if defined(MBEDTLS_ERROR_C)
 #include "../../lib/mbedtls_errors/mp_mbedtls_errors.c"
 #endif
@@ -56,6 +59,15 @@ STATIC void mbedtls_debug(void *ctx, int level, const char *file, int line, cons
 #define DEBUG(...) do {} while (0)
 #endif
 
+// Offer the curves that are cheapest to compute first. X25519 and P-256 cover nearly all servers.
+STATIC const mbedtls_ecp_group_id ssl_curve_preference[] = {
+    MBEDTLS_ECP_DP_CURVE25519,
+    MBEDTLS_ECP_DP_SECP256R1,
+    MBEDTLS_ECP_DP_SECP384R1,
+    MBEDTLS_ECP_DP_SECP521R1,
+    MBEDTLS_ECP_DP_NONE
+};
+
 STATIC NORETURN void mbedtls_raise_error(int err) {
     // _mbedtls_ssl_send and _mbedtls_ssl_recv (below) turn positive error codes from the
     // underlying socket into negative codes to pass them through mbedtls. Here we turn them
@@ -144,6 +156,7 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
     o->base.type = &ssl_sslsocket_type;
     o->ssl_context = self;
     o->sock = socket;
+    o->server_hostname = MP_OBJ_NULL;
 
     mbedtls_ssl_init(&o->ssl);
     mbedtls_ssl_config_init(&o->conf);
@@ -186,6 +199,7 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
         mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_NONE);
     }
     mbedtls_ssl_conf_rng(&o->conf, mbedtls_ctr_drbg_random, &o->ctr_drbg);
+    mbedtls_ssl_conf_curves(&o->conf, ssl_curve_preference);
     #ifdef MBEDTLS_DEBUG_C
     mbedtls_ssl_conf_dbg(&o->conf, mbedtls_debug, NULL);
     #endif
@@ -200,6 +214,10 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
         if (ret != 0) {
             goto cleanup;
         }
+        if (!server_side) {
+            o->server_hostname = mp_obj_new_str(server_hostname, strlen(server_hostname));
+            ssl_sslcontext_resume_session(self, &o->ssl, o->server_hostname);
+        }
     }
 
     mbedtls_ssl_set_bio(&o->ssl, &o->sock, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
@@ -301,7 +319,17 @@ void common_hal_ssl_sslsocket_close(ssl_sslsocket_obj_t *self) {
 
 STATIC void do_handshake(ssl_sslsocket_obj_t *self) {
     int ret;
-    while ((ret = mbedtls_ssl_handshake(&self->ssl)) != 0) {
+    bool resumed = false;
+    // Step through the handshake, rather than use mbedtls_ssl_handshake(), to see whether the
+    // server accepted the offered session: the handshake state is freed once it is over.
+    while (self->ssl.state != MBEDTLS_SSL_HANDSHAKE_OVER) {
+        ret = mbedtls_ssl_handshake_step(&self->ssl);
+        if (self->ssl.handshake != NULL && self->ssl.handshake->resume) {
+            resumed = true;
+        }
+        if (ret == 0) {
+            continue;
+        }
         if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
             goto cleanup;
         }
@@ -312,6 +340,9 @@ STATIC void do_handshake(ssl_sslsocket_obj_t *self) {
         mp_hal_delay_ms(1);
     }
 
+    if (self->server_hostname != MP_OBJ_NULL) {
+        ssl_sslcontext_save_session(self->ssl_context, &self->ssl, self->server_hostname, resumed);
+    }
     return;
 
 cleanup:
@@ -348,6 +379,14 @@ bool common_hal_ssl_sslsocket_get_connected(ssl_sslsocket_obj_t *self) {
     return !self->closed;
 }
 
+bool common_hal_ssl_sslsocket_readable(ssl_sslsocket_obj_t *self) {
+    return mbedtls_ssl_get_bytes_avail(&self->ssl) > 0 || common_hal_socketpool_readable(self->sock);
+}
+
+bool common_hal_ssl_sslsocket_writable(ssl_sslsocket_obj_t *self) {
+    return common_hal_socketpool_writable(self->sock);
+}
+
 bool common_hal_ssl_sslsocket_listen(ssl_sslsocket_obj_t *self, int backlog) {
     return common_hal_socketpool_socket_listen(self->sock, backlog);
 }
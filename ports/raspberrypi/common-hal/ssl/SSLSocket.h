@@ -50,5 +50,7 @@ typedef struct {
     mbedtls_x509_crt cacert;
     mbedtls_x509_crt cert;
     mbedtls_pk_context pkey;
+    // Set for client sockets: the key of this connection's cached session.
+    mp_obj_t server_hostname;
     bool closed;
 } ssl_sslsocket_obj_t;
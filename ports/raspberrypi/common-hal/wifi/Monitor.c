@@ -39,7 +39,8 @@
 typedef struct {
 } monitor_packet_t;
 
-void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel, size_t queue) {
+void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel, size_t queue,
+    size_t buffer_size, uint16_t snaplen, int8_t frame_type, int8_t frame_subtype, const uint8_t *mac) {
     mp_raise_NotImplementedError(translate("wifi.Monitor not available"));
 }
 
@@ -72,3 +73,7 @@ mp_obj_t common_hal_wifi_monitor_get_queued(wifi_monitor_obj_t *self) {
 mp_obj_t common_hal_wifi_monitor_get_packet(wifi_monitor_obj_t *self) {
     return mp_const_none;
 }
+
+size_t common_hal_wifi_monitor_readinto(wifi_monitor_obj_t *self, uint8_t *buf, size_t len) {
+    return 0;
+}
@@ -46,6 +46,7 @@
 #include "lwip/dns.h"
 #include "lwip/icmp.h"
 #include "lwip/raw.h"
+#include "lwip/stats.h"
 #include "lwip_src/ping.h"
 
 #include "shared/netutils/dhcpserver.h"
@@ -121,6 +122,64 @@ void common_hal_wifi_radio_set_tx_power(wifi_radio_obj_t *self, const mp_float_t
     cyw43_ioctl(&cyw43_state, CYW43_IOCTL_SET_VAR, 9 + 4, buf, CYW43_ITF_AP);
 }
 
+// The default matches the listen interval in the cyw43.PM_* values.
+#define DEFAULT_LISTEN_INTERVAL (10)
+
+// The CYW43 power management value for power_management, using the radio's listen interval.
+STATIC int power_management_value(wifi_radio_obj_t *self, wifi_power_management_t power_management) {
+    mp_int_t listen_interval = common_hal_wifi_radio_get_listen_interval(self);
+    switch (power_management) {
+        case POWER_MANAGEMENT_MIN:
+            // Wake for every DTIM beacon.
+            return CONSTANT_CYW43_PM_VALUE(CYW43_PM2_POWERSAVE_MODE, 200, 1, 1, listen_interval);
+        case POWER_MANAGEMENT_MAX:
+            // Sleep for listen_interval beacons at a time.
+            return CONSTANT_CYW43_PM_VALUE(CYW43_PM2_POWERSAVE_MODE, 2000, listen_interval, 0, listen_interval);
+        default:
+            return PM_DISABLED;
+    }
+}
+
+wifi_power_management_t common_hal_wifi_radio_get_power_management(wifi_radio_obj_t *self) {
+    int value = bindings_cyw43_get_power_management();
+    if (value == power_management_value(self, POWER_MANAGEMENT_NONE)) {
+        return POWER_MANAGEMENT_NONE;
+    }
+    if (value == power_management_value(self, POWER_MANAGEMENT_MIN)) {
+        return POWER_MANAGEMENT_MIN;
+    }
+    if (value == power_management_value(self, POWER_MANAGEMENT_MAX)) {
+        return POWER_MANAGEMENT_MAX;
+    }
+    return POWER_MANAGEMENT_UNKNOWN;
+}
+
+void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_power_management_t power_management) {
+    bindings_cyw43_set_power_management(power_management_value(self, power_management));
+}
+
+mp_int_t common_hal_wifi_radio_get_listen_interval(wifi_radio_obj_t *self) {
+    return self->listen_interval == 0 ? DEFAULT_LISTEN_INTERVAL : self->listen_interval;
+}
+
+void common_hal_wifi_radio_set_listen_interval(wifi_radio_obj_t *self, mp_int_t listen_interval) {
+    // The interval is a 4-bit field of the power management value.
+    mp_arg_validate_int_range(listen_interval, 1, 15, MP_QSTR_listen_interval);
+    wifi_power_management_t power_management = common_hal_wifi_radio_get_power_management(self);
+    self->listen_interval = listen_interval;
+    if (power_management == POWER_MANAGEMENT_MIN || power_management == POWER_MANAGEMENT_MAX) {
+        common_hal_wifi_radio_set_power_management(self, power_management);
+    }
+}
+
+mp_int_t common_hal_wifi_radio_get_pbuf_pool_exhausted(wifi_radio_obj_t *self) {
+    return lwip_stats.memp[MEMP_PBUF_POOL]->err;
+}
+
+mp_int_t common_hal_wifi_radio_get_tcp_retransmits(wifi_radio_obj_t *self) {
+    return lwip_stats.mib2.tcpretranssegs;
+}
+
 mp_obj_t common_hal_wifi_radio_get_mac_address_ap(wifi_radio_obj_t *self) {
     return common_hal_wifi_radio_get_mac_address(self);
 }
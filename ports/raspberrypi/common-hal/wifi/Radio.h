@@ -37,6 +37,8 @@ typedef struct {
     wifi_scannednetworks_obj_t *current_scan;
     uint8_t connected_ssid[32];
     uint8_t connected_ssid_len;
+    // For wifi.PowerManagement.MAX, in beacon intervals. 0 until set.
+    uint8_t listen_interval;
     bool enabled;
 } wifi_radio_obj_t;
 
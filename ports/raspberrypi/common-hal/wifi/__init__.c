@@ -41,6 +41,26 @@ wifi_radio_obj_t common_hal_wifi_radio_obj;
 #include "supervisor/shared/status_bar.h"
 #include "supervisor/workflow.h"
 
+#if CIRCUITPY_OS_GETENV
+#include "shared-module/os/__init__.h"
+#endif
+
+#include "lwip/opt.h"
+
+// Read by lwIP as TCP_WND and TCP_SND_BUF when it sets up each connection.
+unsigned int circuitpy_lwip_tcp_wnd = 8 * TCP_MSS;
+unsigned int circuitpy_lwip_tcp_snd_buf = 8 * TCP_MSS;
+
+static unsigned int lwip_tcp_setting(const char *key, unsigned int value, unsigned int max) {
+    #if CIRCUITPY_OS_GETENV
+    mp_int_t new_value;
+    if (common_hal_os_getenv_int(key, &new_value) == GETENV_OK) {
+        value = MIN(MAX(new_value, 2 * TCP_MSS), (mp_int_t)max);
+    }
+    #endif
+    return value;
+}
+
 static bool wifi_inited;
 static bool wifi_ever_inited;
 static bool wifi_user_initiated;
@@ -60,6 +80,10 @@ void common_hal_wifi_init(bool user_initiated) {
     common_hal_wifi_radio_obj.current_scan = NULL;
 
     if (!wifi_ever_inited) {
+        circuitpy_lwip_tcp_wnd = lwip_tcp_setting("CIRCUITPY_LWIP_TCP_WND",
+            circuitpy_lwip_tcp_wnd, CIRCUITPY_LWIP_TCP_WND_MAX);
+        circuitpy_lwip_tcp_snd_buf = lwip_tcp_setting("CIRCUITPY_LWIP_TCP_SND_BUF",
+            circuitpy_lwip_tcp_snd_buf, CIRCUITPY_LWIP_TCP_SND_BUF_MAX);
     }
     wifi_ever_inited = true;
 
@@ -0,0 +1,111 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "core1_worker.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "py/mpconfig.h"
+
+#if CIRCUITPY_PICODVI
+#include "common-hal/picodvi/Framebuffer.h"
+#endif
+
+#include "src/rp2_common/hardware_sync/include/hardware/sync.h"
+#include "src/rp2_common/pico_multicore/include/pico/multicore.h"
+
+#define CORE1_WORKER_QUEUE_LENGTH (4)
+
+// A single producer, single consumer ring. Core 0 is the only writer of head and of the slot
+// at head, and core 1 is the only writer of tail, so neither side needs a lock.
+static core1_worker_job_t *volatile queue[CORE1_WORKER_QUEUE_LENGTH];
+static volatile uint8_t head = 0;
+static volatile uint8_t tail = 0;
+static bool core1_running = false;
+
+// Waiting happens from RAM so that core 0 can write flash while this core is idle.
+static void __not_in_flash_func(core1_main)(void) {
+    while (true) {
+        while (tail == head) {
+            __wfe();
+        }
+        __dmb();
+        core1_worker_job_t *job = queue[tail];
+        job->fun(job->arg);
+        __dmb();
+        job->done = true;
+        tail = (tail + 1) % CORE1_WORKER_QUEUE_LENGTH;
+        __sev();
+    }
+}
+
+bool core1_worker_submit(core1_worker_job_t *job) {
+    #if CIRCUITPY_PICODVI
+    if (active_picodvi != NULL) {
+        return false;
+    }
+    #endif
+    uint8_t next = (head + 1) % CORE1_WORKER_QUEUE_LENGTH;
+    if (next == tail) {
+        return false;
+    }
+    if (!core1_running) {
+        multicore_launch_core1(core1_main);
+        core1_running = true;
+    }
+    job->done = false;
+    queue[head] = job;
+    __dmb();
+    head = next;
+    __sev();
+    return true;
+}
+
+void core1_worker_wait(core1_worker_job_t *job) {
+    while (!job->done) {
+        __wfe();
+    }
+    __dmb();
+}
+
+// Also called before flash is written because jobs may run from flash.
+void core1_worker_wait_all(void) {
+    while (tail != head) {
+        __wfe();
+    }
+    __dmb();
+}
+
+void core1_worker_deinit(void) {
+    if (!core1_running) {
+        return;
+    }
+    core1_worker_wait_all();
+    multicore_reset_core1();
+    core1_running = false;
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_RASPBERRYPI_CORE1_WORKER_H
+#define MICROPY_INCLUDED_RASPBERRYPI_CORE1_WORKER_H
+
+#include <stdbool.h>
+
+// Runs native work for core 0 on the second core, one job at a time in the order it was
+// submitted. A job must not touch the VM: no allocation, no exceptions and no objects that
+// Python code can change before the job is waited for.
+typedef struct {
+    void (*fun)(void *arg);
+    void *arg;
+    volatile bool done;
+} core1_worker_job_t;
+
+// Queues job and returns true, or returns false when the caller must do the work itself
+// because the queue is full or the second core is in use by something else. Only core 0
+// submits jobs. The job must stay valid until it is done.
+bool core1_worker_submit(core1_worker_job_t *job);
+
+// Waits for one job, or for every job submitted so far.
+void core1_worker_wait(core1_worker_job_t *job);
+void core1_worker_wait_all(void);
+
+// Finishes the queued jobs and stops the second core so that something else can use it. It
+// starts again on the next submit.
+void core1_worker_deinit(void);
+
+#endif  // MICROPY_INCLUDED_RASPBERRYPI_CORE1_WORKER_H
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdbool.h>
+
+#include "py/mpconfig.h"
+#include "shared-module/displayio/display_core.h"
+
+#include "core1_worker.h"
+
+// Core 0 waits for the job to finish before it lets Python run again, which keeps the group
+// from changing while core 1 reads it.
+typedef struct {
+    core1_worker_job_t work;
+    displayio_display_core_t *core;
+    displayio_area_t area;
+    uint32_t *mask;
+    uint32_t *buffer;
+} fill_job_t;
+
+static fill_job_t job;
+static bool job_pending = false;
+
+static void fill_area(void *arg) {
+    fill_job_t *fill = arg;
+    displayio_display_core_fill_area(fill->core, &fill->area, fill->mask, fill->buffer);
+}
+
+bool displayio_core1_start_fill_area(displayio_display_core_t *core, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
+    // A second display may ask while the first one's job is running.
+    if (job_pending) {
+        return false;
+    }
+    job.work.fun = fill_area;
+    job.work.arg = &job;
+    job.core = core;
+    job.area = *area;
+    job.area.next = NULL;
+    job.mask = mask;
+    job.buffer = buffer;
+    job_pending = core1_worker_submit(&job.work);
+    return job_pending;
+}
+
+void displayio_core1_finish_fill_area(void) {
+    if (!job_pending) {
+        return;
+    }
+    core1_worker_wait(&job.work);
+    job_pending = false;
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdbool.h>
+
+#include "py/gc.h"
+#include "py/mpconfig.h"
+
+#if CIRCUITPY_PICODVI
+#include "common-hal/picodvi/Framebuffer.h"
+#endif
+
+#if CIRCUITPY_DISPLAYIO_CORE1 || CIRCUITPY_AUDIO_CORE1
+#include "core1_worker.h"
+#endif
+
+#include "src/rp2_common/hardware_sync/include/hardware/sync.h"
+#include "src/rp2_common/pico_multicore/include/pico/multicore.h"
+
+// The Cortex-M0+ has no atomic read-modify-write instructions so both cores take this hardware
+// spin lock to mark a block. Nothing else here runs an OS that would want it.
+#define ATB_SPIN_LOCK_ID (PICO_SPINLOCK_ID_OS1)
+
+static volatile bool mark_done = false;
+
+static void __not_in_flash_func(core1_mark)(void) {
+    gc_mark_helper();
+    __dmb();
+    mark_done = true;
+    __sev();
+    while (true) {
+        __wfe();
+    }
+}
+
+bool gc_port_start_mark_helper(void) {
+    #if CIRCUITPY_PICODVI
+    if (active_picodvi != NULL) {
+        return false;
+    }
+    #endif
+    #if CIRCUITPY_DISPLAYIO_CORE1 || CIRCUITPY_AUDIO_CORE1
+    // The worker starts core 1 again the next time it is given a job.
+    core1_worker_deinit();
+    #endif
+    mark_done = false;
+    __dmb();
+    multicore_launch_core1(core1_mark);
+    return true;
+}
+
+void gc_port_finish_mark_helper(void) {
+    while (!mark_done) {
+        __wfe();
+    }
+    __dmb();
+    multicore_reset_core1();
+}
+
+uint8_t __not_in_flash_func(gc_port_atb_fetch_or)(uint8_t *atb, uint8_t bits) {
+    spin_lock_t *lock = spin_lock_instance(ATB_SPIN_LOCK_ID);
+    spin_lock_unsafe_blocking(lock);
+    uint8_t old = *atb;
+    *atb = old | bits;
+    spin_unlock_unsafe(lock);
+    return old;
+}
@@ -21,25 +21,39 @@
 #endif
 #define MEM_ALIGNMENT               4
 #define MEM_SIZE                    4000
-#define MEMP_NUM_TCP_SEG            32
 #define MEMP_NUM_ARP_QUEUE          10
 #define PBUF_POOL_SIZE              24
 #define LWIP_ARP                    1
 #define LWIP_ETHERNET               1
 #define LWIP_ICMP                   1
 #define LWIP_RAW                    1
-#define TCP_WND                     (8 * TCP_MSS)
 #define TCP_MSS                     1460
-#define TCP_SND_BUF                 (8 * TCP_MSS)
+// TCP_WND and TCP_SND_BUF are read from settings.toml (CIRCUITPY_LWIP_TCP_WND and
+// CIRCUITPY_LWIP_TCP_SND_BUF) when wifi first starts, up to these maxima. The segment
+// pool is sized for the largest send buffer.
+#define CIRCUITPY_LWIP_TCP_WND_MAX      (16 * TCP_MSS)
+#define CIRCUITPY_LWIP_TCP_SND_BUF_MAX  (16 * TCP_MSS)
+#ifndef __ASSEMBLER__
+extern unsigned int circuitpy_lwip_tcp_wnd;
+extern unsigned int circuitpy_lwip_tcp_snd_buf;
+#endif
+#define TCP_WND                     (circuitpy_lwip_tcp_wnd)
+#define TCP_SND_BUF                 (circuitpy_lwip_tcp_snd_buf)
 #define TCP_SND_QUEUELEN            ((4 * (TCP_SND_BUF) + (TCP_MSS - 1)) / (TCP_MSS))
+#define MEMP_NUM_TCP_SEG            ((4 * (CIRCUITPY_LWIP_TCP_SND_BUF_MAX) + (TCP_MSS - 1)) / (TCP_MSS))
+// The window sizes aren't constants, so lwIP can't check them at compile time.
+#define LWIP_DISABLE_TCP_SANITY_CHECKS 1
 #define LWIP_NETIF_STATUS_CALLBACK  1
 #define LWIP_NETIF_LINK_CALLBACK    1
 #define LWIP_NETIF_HOSTNAME         1
 #define LWIP_NETCONN                0
+// Pool and TCP counters back wifi.radio.pbuf_pool_exhausted and wifi.radio.tcp_retransmits.
+#define LWIP_STATS                  1
 #define MEM_STATS                   0
 #define SYS_STATS                   0
-#define MEMP_STATS                  0
+#define MEMP_STATS                  1
 #define LINK_STATS                  0
+#define MIB2_STATS                  1
 // #define ETH_PAD_SIZE                2
 #define LWIP_CHKSUM_ALGORITHM       3
 #define LWIP_DHCP                   1
@@ -65,7 +79,6 @@
 
 #ifndef NDEBUG
 #define LWIP_DEBUG                  1
-#define LWIP_STATS                  1
 #define LWIP_STATS_DISPLAY          1
 #endif
 
@@ -48,6 +48,12 @@
 
 #define CIRCUITPY_PROCESSOR_COUNT           (2)
 
+// Parallel marking takes a hardware spin lock to set a mark.
+#define MICROPY_GC_PORT_ATB_FETCH_OR        (1)
+
+// Any interrupt, including the CYW43's and lwIP's socket callbacks, ends a select.poll() sleep.
+#define CIRCUITPY_SELECT_IDLE_MAX_MS        (1000)
+
 // This also includes mpconfigboard.h.
 #include "py/circuitpy_mpconfig.h"
 
@@ -55,6 +61,9 @@
     mp_obj_t counting[NUM_PWM_SLICES]; \
     mp_obj_t playing_audio[NUM_DMA_CHANNELS]; \
     mp_obj_t background_pio[NUM_DMA_CHANNELS]; \
+    uint8_t *neopixel_write_buffer; \
+    struct _rotaryio_incrementalencoder_obj_t *incrementalencoders; \
+    uint32_t *incrementalencoder_ring; \
     CIRCUITPY_COMMON_ROOT_POINTERS;
 
 #if CIRCUITPY_CYW43
@@ -9,16 +9,22 @@ CIRCUITPY_ALARM ?= 1
 
 CIRCUITPY_RP2PIO ?= 1
 CIRCUITPY_NEOPIXEL_WRITE ?= $(CIRCUITPY_RP2PIO)
+CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND ?= $(CIRCUITPY_NEOPIXEL_WRITE)
 CIRCUITPY_FLOPPYIO ?= 1
 CIRCUITPY_FRAMEBUFFERIO ?= $(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_FULL_BUILD ?= 1
+# Architecture for frozen native and viper modules.
+MPY_CROSS_NATIVE_ARCH ?= armv6m
 CIRCUITPY_AUDIOMP3 ?= 1
 CIRCUITPY_BITOPS ?= 1
+CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE ?= 1
 CIRCUITPY_IMAGECAPTURE ?= 1
 CIRCUITPY_PWMIO ?= 1
 CIRCUITPY_RGBMATRIX ?= $(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_ROTARYIO ?= 1
 CIRCUITPY_ROTARYIO_SOFTENCODER = 1
+CIRCUITPY_SDIOIO ?= 1
+CIRCUITPY_STORAGE_MMAP ?= 1
 CIRCUITPY_SYNTHIO_MAX_CHANNELS = 12
 
 # Things that need to be implemented.
@@ -36,8 +42,10 @@ CIRCUITPY_ANALOGBUFIO = 1
 # Audio via PWM
 CIRCUITPY_AUDIOIO = 0
 CIRCUITPY_AUDIOBUSIO ?= 1
+CIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND ?= $(CIRCUITPY_AUDIOBUSIO_PDMIN)
 CIRCUITPY_AUDIOCORE ?= 1
 CIRCUITPY_AUDIOPWMIO ?= 1
+CIRCUITPY_AUDIO_BUFFER_RING ?= 1
 
 CIRCUITPY_AUDIOMIXER ?= 1
 
@@ -42,6 +42,10 @@
 #include "supervisor/flash.h"
 #include "supervisor/usb.h"
 
+#if CIRCUITPY_DISPLAYIO_CORE1 || CIRCUITPY_AUDIO_CORE1
+#include "core1_worker.h"
+#endif
+
 #include "src/rp2040/hardware_structs/include/hardware/structs/sio.h"
 #include "src/rp2_common/hardware_flash/include/hardware/flash.h"
 #include "src/common/pico_binary_info/include/pico/binary_info.h"
@@ -95,6 +99,10 @@ void port_internal_flash_flush(void) {
     if (_cache_lba == NO_CACHE) {
         return;
     }
+    #if CIRCUITPY_DISPLAYIO_CORE1 || CIRCUITPY_AUDIO_CORE1
+    // Core 1 can't run its jobs from flash while it is written.
+    core1_worker_wait_all();
+    #endif
     // Make sure we don't have an interrupt while we do flash operations.
     common_hal_mcu_disable_interrupts();
     flash_range_erase(CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR + _cache_lba, SECTOR_SIZE);
@@ -111,6 +119,10 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t n
     return 0;
 }
 
+const void *supervisor_flash_get_block_address(uint32_t block) {
+    return (void *)(XIP_BASE + CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR + block * FILESYSTEM_BLOCK_SIZE);
+}
+
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32_t num_blocks) {
     uint32_t blocks_per_sector = SECTOR_SIZE / FILESYSTEM_BLOCK_SIZE;
     uint32_t block = 0;
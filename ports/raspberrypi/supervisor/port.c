@@ -29,6 +29,7 @@
 
 #include "supervisor/background_callback.h"
 #include "supervisor/board.h"
+#include "supervisor/cycle_count.h"
 #include "supervisor/port.h"
 
 #include "bindings/rp2pio/StateMachine.h"
@@ -41,6 +42,14 @@
 #include "shared-bindings/rtc/__init__.h"
 #include "shared-bindings/pwmio/PWMOut.h"
 
+#if CIRCUITPY_NVM
+#include "shared-bindings/nvm/ByteArray.h"
+#endif
+
+#if CIRCUITPY_ROTARYIO
+#include "shared-bindings/rotaryio/IncrementalEncoder.h"
+#endif
+
 #if CIRCUITPY_SSL
 #include "common-hal/ssl/__init__.h"
 #endif
@@ -51,6 +60,7 @@
 
 #include "common-hal/rtc/RTC.h"
 #include "common-hal/busio/UART.h"
+#include "common-hal/neopixel_write/__init__.h"
 
 #include "supervisor/shared/safe_mode.h"
 #include "supervisor/shared/stack.h"
@@ -183,10 +193,18 @@ void reset_port(void) {
     pwmout_reset();
     #endif
 
+    #if CIRCUITPY_NEOPIXEL_WRITE
+    neopixel_write_reset();
+    #endif
+
     #if CIRCUITPY_RP2PIO
     reset_rp2pio_statemachine();
     #endif
 
+    #if CIRCUITPY_ROTARYIO
+    reset_rotaryio();
+    #endif
+
     #if CIRCUITPY_RTC
     rtc_reset();
     #endif
@@ -206,6 +224,10 @@ void reset_port(void) {
     wifi_reset();
     #endif
 
+    #if CIRCUITPY_NVM
+    common_hal_nvm_bytearray_flush(&common_hal_mcu_nvm_obj);
+    #endif
+
     reset_all_pins();
 }
 
@@ -265,6 +287,17 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return 1024 * (microseconds / 1000000) + (microseconds % 1000000) / 977;
 }
 
+#if CIRCUITPY_TRACE || CIRCUITPY_BENCHMARK
+// The M0+ has no DWT cycle counter, so use the low word of the 1MHz timer.
+uint32_t port_get_cycle_count(void) {
+    return timer_hw->timerawl;
+}
+
+uint32_t port_get_cycle_frequency(void) {
+    return 1000000;
+}
+#endif
+
 STATIC void _tick_callback(uint alarm_num) {
     if (ticks_enabled) {
         supervisor_tick();
@@ -297,6 +330,16 @@ void port_interrupt_after_ticks(uint32_t ticks) {
     _woken_up = false;
 }
 
+// Keeps the next port_idle_until_interrupt() from sleeping, for wake ups, such as lwIP
+// socket callbacks, that happen just before it.
+void port_wake_main_task(void) {
+    _woken_up = true;
+}
+
+void port_wake_main_task_from_isr(void) {
+    _woken_up = true;
+}
+
 void port_idle_until_interrupt(void) {
     common_hal_mcu_disable_interrupts();
     if (!background_callback_pending() && !tud_task_event_ready() && !_woken_up) {
@@ -336,3 +379,9 @@ void port_boot_info(void) {
     mp_printf(&mp_plat_print, "\n");
     #endif
 }
+
+#if CIRCUITPY_AUDIO_CORE1
+void port_background_callbacks_done(void) {
+    audio_dma_finish_renders();
+}
+#endif
@@ -183,6 +183,9 @@ void common_hal_bleio_adapter_set_name(bleio_adapter_obj_t *self,
 mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self,
     uint8_t *prefixes,
     size_t prefix_length,
+    uint8_t *services,
+    size_t services_length,
+    bool remove_duplicates,
     bool extended,
     mp_int_t buffer_size,
     mp_float_t timeout,
@@ -212,6 +215,9 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self,
     self->scan_results = shared_module_bleio_new_scanresults(buffer_size,
         prefixes,
         prefix_length,
+        services,
+        services_length,
+        remove_duplicates,
         minimum_rssi);
     xscan_event = xEventGroupCreate();
     if (xscan_event != NULL) {
@@ -38,6 +38,7 @@
 #include "shared-bindings/microcontroller/__init__.h"
 
 #include "supervisor/port.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/workflow.h"
 
 // Singleton instance of SleepMemory.
@@ -137,7 +138,7 @@ mp_obj_t common_hal_alarm_light_sleep_until_alarms(size_t n_alarms, const mp_obj
             break;
         }
         // HAL_PWR_EnterSLEEPMode is just a WFI anyway so don't bother
-        port_idle_until_interrupt();
+        supervisor_idle_until_interrupt();
     }
 
     if (mp_hal_is_interrupted()) {
@@ -185,7 +186,7 @@ void common_hal_alarm_pretending_deep_sleep(void) {
 
     alarm_set_wakeup_reason(STM_WAKEUP_UNDEF);
 
-    port_idle_until_interrupt();
+    supervisor_sleep_until_interrupt();
 }
 
 void common_hal_alarm_gc_collect(void) {
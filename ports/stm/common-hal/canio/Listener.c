@@ -241,6 +241,9 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
 
     // Nothing can fail now so it's safe to assign self->can
     self->can = can;
+    self->overflow_count = 0;
+    // Forget overruns from before this listener existed.
+    *(self->rfr) = CAN_RF0R_FOVR0;
 
     self->mailbox = &can->handle.Instance->sFIFOMailBox[self->fifo_idx];
     set_filters(self, nmatch, matches);
@@ -263,20 +266,29 @@ void common_hal_canio_listener_check_for_deinit(canio_listener_obj_t *self) {
 }
 
 int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
-    return *(self->rfr) & CAN_RF0R_FMP0;
+    uint32_t rfr = *(self->rfr);
+    // The FIFO overrun flag is only polled, so several lost messages may be counted once.
+    if (rfr & CAN_RF0R_FOVR0) {
+        *(self->rfr) = CAN_RF0R_FOVR0;
+        self->overflow_count++;
+    }
+    return rfr & CAN_RF0R_FMP0;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait) {
     if (!common_hal_canio_listener_in_waiting(self)) {
+        if (!wait) {
+            return false;
+        }
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
@@ -285,7 +297,6 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     uint32_t rdtr = self->mailbox->RDTR;
 
     bool rtr = rir & CAN_RI0R_RTR;
-    canio_message_obj_t *message = m_new_obj(canio_message_obj_t);
     message->base.type = rtr ? &canio_remote_transmission_request_type : &canio_message_type;
     message->extended = rir & CAN_RI0R_IDE;
     if (message->extended) {
@@ -299,9 +310,15 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
         MP_STATIC_ASSERT(sizeof(payload) == sizeof(message->data));
         memcpy(message->data, payload, sizeof(payload));
     }
-    // Release the mailbox
-    SET_BIT(*self->rfr, CAN_RF0R_RFOM0);
-    return message;
+    // Release the mailbox. Don't read-modify-write, which would also clear
+    // the overrun flag before it is counted.
+    *(self->rfr) = CAN_RF0R_RFOM0;
+    return true;
+}
+
+uint32_t common_hal_canio_listener_get_overflow_count(canio_listener_obj_t *self) {
+    common_hal_canio_listener_in_waiting(self);
+    return self->overflow_count;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
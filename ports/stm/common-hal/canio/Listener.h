@@ -35,5 +35,6 @@ typedef struct canio_listener_obj {
     CAN_FIFOMailBox_TypeDef *mailbox;
     __IO uint32_t *rfr;
     uint32_t timeout_ms;
+    uint32_t overflow_count;
     uint8_t fifo_idx;
 } canio_listener_obj_t;
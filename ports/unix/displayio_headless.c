@@ -0,0 +1,301 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "py/mphal.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "displayio_headless.h"
+#include "shared-bindings/displayio/Group.h"
+#include "shared-module/displayio/display_core.h"
+#include "shared-module/vectorio/__init__.h"
+#include "supervisor/shared/translate/translate.h"
+
+//| class HeadlessDisplay:
+//|     """An RGB565 display held in memory, only available on the unix port.
+//|
+//|     It composites its `root_group` with the same code as a
+//|     `framebufferio.FramebufferDisplay`, so displayio rendering can be
+//|     tested and profiled on the host. There is no auto refresh; call
+//|     `refresh()`."""
+//|
+//|     def __init__(self, width: int, height: int, *, buffer_size: int = 128) -> None:
+//|         """Create a black display.
+//|
+//|         :param int width: The width in pixels
+//|         :param int height: The height in pixels
+//|         :param int buffer_size: Bytes composited at a time, which matches
+//|           ``CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE`` on boards by default"""
+//|         ...
+STATIC mp_obj_t displayio_headlessdisplay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_width, ARG_height, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_height, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 128} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t width = mp_arg_validate_int_range(args[ARG_width].u_int, 1, 0x7fff, MP_QSTR_width);
+    mp_int_t height = mp_arg_validate_int_range(args[ARG_height].u_int, 1, 0x7fff, MP_QSTR_height);
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    displayio_headlessdisplay_obj_t *self = m_new_obj(displayio_headlessdisplay_obj_t);
+    memset(self, 0, sizeof(*self));
+    self->base.type = &displayio_headlessdisplay_type;
+    self->width = width;
+    self->height = height;
+    self->pixels = m_new0(uint16_t, width * height);
+    self->buffer_size = buffer_size / sizeof(uint32_t);
+
+    // The same colorspace framebufferio uses for a 16 bit framebuffer.
+    self->colorspace.depth = 16;
+    self->colorspace.bytes_per_cell = 2;
+
+    self->transform = null_transform;
+    self->area.x2 = width;
+    self->area.y2 = height;
+    self->full_refresh = true;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC void headlessdisplay_refresh_area(displayio_headlessdisplay_obj_t *self, const displayio_area_t *area) {
+    displayio_area_t clipped;
+    if (!displayio_area_compute_overlap(&self->area, area, &clipped)) {
+        return;
+    }
+    uint16_t width = displayio_area_width(&clipped);
+    // Two pixels per word, as in framebufferio's _refresh_area.
+    uint16_t rows_per_buffer = MAX(1, self->buffer_size * 2 / width);
+    uint32_t pixels_per_buffer = rows_per_buffer * width;
+    uint32_t buffer[(pixels_per_buffer + 1) / 2];
+    uint32_t mask[pixels_per_buffer / 32 + 1];
+
+    for (int16_t y = clipped.y1; y < clipped.y2; y += rows_per_buffer) {
+        displayio_area_t subrectangle = {
+            .x1 = clipped.x1,
+            .y1 = y,
+            .x2 = clipped.x2,
+            .y2 = MIN(y + rows_per_buffer, clipped.y2),
+        };
+        memset(buffer, 0, sizeof(buffer));
+        memset(mask, 0, sizeof(mask));
+        if (self->root_group != NULL) {
+            displayio_group_fill_area(self->root_group, &self->colorspace, &subrectangle, mask, buffer);
+            vectorio_finish_fill_area(&self->colorspace, buffer);
+        }
+        const uint16_t *src = (const uint16_t *)buffer;
+        for (int16_t row = subrectangle.y1; row < subrectangle.y2; row++) {
+            memcpy(self->pixels + row * self->width + clipped.x1, src, width * sizeof(uint16_t));
+            src += width;
+        }
+        self->pixels_refreshed += displayio_area_size(&subrectangle);
+    }
+}
+
+//|     def refresh(self) -> bool:
+//|         """Composite everything that changed since the last refresh.
+//|
+//|         :return: ``True`` if any pixels were redrawn"""
+//|         ...
+STATIC mp_obj_t displayio_headlessdisplay_refresh(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t start = mp_hal_ticks_us();
+
+    const displayio_area_t *areas = NULL;
+    if (self->full_refresh) {
+        self->area.next = NULL;
+        areas = &self->area;
+    } else if (self->root_group != NULL) {
+        areas = displayio_group_get_refresh_areas(self->root_group, NULL);
+    }
+    // Like framebufferio, only merge areas when that adds no pixels.
+    displayio_area_t merged[DISPLAYIO_MAX_REFRESH_AREAS];
+    areas = displayio_area_coalesce(areas, merged, DISPLAYIO_MAX_REFRESH_AREAS, 0);
+
+    self->pixels_refreshed = 0;
+    for (const displayio_area_t *area = areas; area != NULL; area = area->next) {
+        headlessdisplay_refresh_area(self, area);
+    }
+    if (self->root_group != NULL) {
+        displayio_group_finish_refresh(self->root_group);
+    }
+    self->full_refresh = false;
+    self->last_refresh_us = mp_hal_ticks_us() - start;
+    return mp_obj_new_bool(self->pixels_refreshed > 0);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_refresh_obj, displayio_headlessdisplay_refresh);
+
+//|     def dump(self, filename: str) -> None:
+//|         """Write the display's contents to ``filename`` as a binary PPM image."""
+//|         ...
+STATIC mp_obj_t displayio_headlessdisplay_dump(mp_obj_t self_in, mp_obj_t filename_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const char *filename = mp_obj_str_get_str(filename_in);
+    FILE *f = fopen(filename, "wb");
+    if (f == NULL) {
+        mp_raise_OSError(errno);
+    }
+    fprintf(f, "P6\n%d %d\n255\n", self->width, self->height);
+    uint8_t row[self->width * 3];
+    for (uint16_t y = 0; y < self->height; y++) {
+        const uint16_t *src = self->pixels + y * self->width;
+        for (uint16_t x = 0; x < self->width; x++) {
+            uint8_t r = src[x] >> 11, g = (src[x] >> 5) & 0x3f, b = src[x] & 0x1f;
+            row[x * 3] = (r << 3) | (r >> 2);
+            row[x * 3 + 1] = (g << 2) | (g >> 4);
+            row[x * 3 + 2] = (b << 3) | (b >> 2);
+        }
+        if (fwrite(row, 1, sizeof(row), f) != sizeof(row)) {
+            int err = errno;
+            fclose(f);
+            mp_raise_OSError(err);
+        }
+    }
+    fclose(f);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_headlessdisplay_dump_obj, displayio_headlessdisplay_dump);
+
+//|     root_group: Optional[displayio.Group]
+//|     """The group shown on the display, or ``None`` to show nothing."""
+STATIC mp_obj_t displayio_headlessdisplay_get_root_group(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->root_group == NULL ? mp_const_none : MP_OBJ_FROM_PTR(self->root_group);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_root_group_obj, displayio_headlessdisplay_get_root_group);
+
+STATIC mp_obj_t displayio_headlessdisplay_set_root_group(mp_obj_t self_in, mp_obj_t group_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    displayio_group_t *group = NULL;
+    if (group_in != mp_const_none) {
+        group = MP_OBJ_TO_PTR(native_group(group_in));
+    }
+    if (group == self->root_group) {
+        return mp_const_none;
+    }
+    if (group != NULL && group->in_group) {
+        mp_raise_ValueError(translate("Group already used"));
+    }
+    if (self->root_group != NULL) {
+        self->root_group->in_group = false;
+    }
+    if (group != NULL) {
+        displayio_group_update_transform(group, &self->transform);
+        group->in_group = true;
+    }
+    self->root_group = group;
+    self->full_refresh = true;
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_headlessdisplay_set_root_group_obj, displayio_headlessdisplay_set_root_group);
+
+MP_PROPERTY_GETSET(displayio_headlessdisplay_root_group_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_root_group_obj,
+    (mp_obj_t)&displayio_headlessdisplay_set_root_group_obj);
+
+//|     width: int
+//|     """The width in pixels. (read-only)"""
+STATIC mp_obj_t displayio_headlessdisplay_get_width(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->width);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_width_obj, displayio_headlessdisplay_get_width);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_width_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_width_obj);
+
+//|     height: int
+//|     """The height in pixels. (read-only)"""
+STATIC mp_obj_t displayio_headlessdisplay_get_height(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->height);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_height_obj, displayio_headlessdisplay_get_height);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_height_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_height_obj);
+
+//|     last_refresh_us: int
+//|     """How long the last `refresh()` took, in microseconds. (read-only)"""
+STATIC mp_obj_t displayio_headlessdisplay_get_last_refresh_us(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->last_refresh_us);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_last_refresh_us_obj, displayio_headlessdisplay_get_last_refresh_us);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_last_refresh_us_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_last_refresh_us_obj);
+
+//|     pixels_refreshed: int
+//|     """How many pixels the last `refresh()` composited. (read-only)"""
+//|
+STATIC mp_obj_t displayio_headlessdisplay_get_pixels_refreshed(mp_obj_t self_in) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->pixels_refreshed);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_headlessdisplay_get_pixels_refreshed_obj, displayio_headlessdisplay_get_pixels_refreshed);
+
+MP_PROPERTY_GETTER(displayio_headlessdisplay_pixels_refreshed_obj,
+    (mp_obj_t)&displayio_headlessdisplay_get_pixels_refreshed_obj);
+
+STATIC mp_int_t displayio_headlessdisplay_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    displayio_headlessdisplay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if ((flags & MP_BUFFER_WRITE) != 0) {
+        return 1;
+    }
+    bufinfo->buf = self->pixels;
+    bufinfo->len = self->width * self->height * sizeof(uint16_t);
+    bufinfo->typecode = 'H';
+    return 0;
+}
+
+STATIC const mp_rom_map_elem_t displayio_headlessdisplay_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_refresh), MP_ROM_PTR(&displayio_headlessdisplay_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&displayio_headlessdisplay_dump_obj) },
+    { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&displayio_headlessdisplay_root_group_obj) },
+    { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_headlessdisplay_width_obj) },
+    { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_headlessdisplay_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_last_refresh_us), MP_ROM_PTR(&displayio_headlessdisplay_last_refresh_us_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pixels_refreshed), MP_ROM_PTR(&displayio_headlessdisplay_pixels_refreshed_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(displayio_headlessdisplay_locals_dict, displayio_headlessdisplay_locals_dict_table);
+
+const mp_obj_type_t displayio_headlessdisplay_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_HeadlessDisplay,
+    .make_new = displayio_headlessdisplay_make_new,
+    .locals_dict = (mp_obj_dict_t *)&displayio_headlessdisplay_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .buffer_p = { .get_buffer = displayio_headlessdisplay_get_buffer },
+        ),
+};
@@ -0,0 +1,51 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/displayio/Group.h"
+#include "shared-module/displayio/Palette.h"
+#include "shared-module/displayio/area.h"
+
+// An RGB565 display held in memory, so that the displayio compositor can be
+// run and profiled on the host.
+typedef struct {
+    mp_obj_base_t base;
+    displayio_group_t *root_group;
+    uint16_t *pixels;
+    displayio_buffer_transform_t transform;
+    displayio_area_t area;
+    _displayio_colorspace_t colorspace;
+    uint32_t buffer_size; // In uint32_ts, like CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE.
+    uint32_t last_refresh_us;
+    uint32_t pixels_refreshed;
+    uint16_t width;
+    uint16_t height;
+    bool full_refresh;
+} displayio_headlessdisplay_obj_t;
+
+extern const mp_obj_type_t displayio_headlessdisplay_type;
@@ -25,6 +25,9 @@
  */
 
 #include <stdio.h>
+#if MICROPY_GC_PARALLEL_MARK
+#include <pthread.h>
+#endif
 
 #include "py/mpstate.h"
 #include "py/gc.h"
@@ -33,6 +36,55 @@
 
 #if MICROPY_ENABLE_GC
 
+#if MICROPY_GC_PARALLEL_MARK
+// A plain pthread rather than an mp_thread, so that it isn't asked to scan a stack of its own.
+STATIC pthread_mutex_t mark_helper_mutex = PTHREAD_MUTEX_INITIALIZER;
+STATIC pthread_cond_t mark_helper_cond = PTHREAD_COND_INITIALIZER;
+STATIC bool mark_helper_started = false;
+STATIC bool mark_helper_pending = false;
+
+STATIC void *mark_helper_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&mark_helper_mutex);
+    for (;;) {
+        while (!mark_helper_pending) {
+            pthread_cond_wait(&mark_helper_cond, &mark_helper_mutex);
+        }
+        pthread_mutex_unlock(&mark_helper_mutex);
+        gc_mark_helper();
+        pthread_mutex_lock(&mark_helper_mutex);
+        mark_helper_pending = false;
+        pthread_cond_broadcast(&mark_helper_cond);
+    }
+    return NULL;
+}
+
+bool gc_port_start_mark_helper(void) {
+    pthread_mutex_lock(&mark_helper_mutex);
+    if (!mark_helper_started) {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, mark_helper_main, NULL) != 0) {
+            pthread_mutex_unlock(&mark_helper_mutex);
+            return false;
+        }
+        pthread_detach(thread);
+        mark_helper_started = true;
+    }
+    mark_helper_pending = true;
+    pthread_cond_broadcast(&mark_helper_cond);
+    pthread_mutex_unlock(&mark_helper_mutex);
+    return true;
+}
+
+void gc_port_finish_mark_helper(void) {
+    pthread_mutex_lock(&mark_helper_mutex);
+    while (mark_helper_pending) {
+        pthread_cond_wait(&mark_helper_cond, &mark_helper_mutex);
+    }
+    pthread_mutex_unlock(&mark_helper_mutex);
+}
+#endif
+
 void gc_collect(void) {
     // gc_dump_info();
 
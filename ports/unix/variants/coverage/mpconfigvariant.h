@@ -30,6 +30,8 @@
 #define MICROPY_VFS                    (1)
 #define MICROPY_PY_UOS_VFS             (1)
 
+#define MICROPY_COMP_INCREMENTAL       (1)
+#define MICROPY_COMP_GLOBAL_CONST      (1)
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_OPT_MATH_FACTORIAL     (1)
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH (1)
@@ -58,8 +60,30 @@
 #define MICROPY_PY_URE_SUB             (1)
 #define MICROPY_VFS_POSIX              (1)
 #define MICROPY_FATFS_USE_LABEL        (1)
+#define MICROPY_GC_FREE_RUN_INDEX      (1)
+#define MICROPY_GC_INCREMENTAL_SWEEP   (1)
+#define MICROPY_GC_MINOR_COLLECT       (1)
+#define MICROPY_GC_COMPACT             (1)
+#define MICROPY_GC_COMPACT_AUTO        (1)
+#define MICROPY_GC_STATS               (1)
+#define MICROPY_GC_PARALLEL_MARK       (MICROPY_PY_THREAD)
+#define MICROPY_OPT_LOAD_METHOD_CACHE  (1)
+#define MICROPY_OPT_LOAD_GLOBAL_CACHE  (1)
+#define MICROPY_OPT_MAP_ORDERED_INDEX  (1)
+#define MICROPY_OPT_QSTR_INDEX         (1)
+#define MICROPY_OPT_VM_SMALL_INT_BINARY_OP (1)
+#define MICROPY_MPZ_PROMOTION_STATS    (1)
+#define CIRCUITPY_TRANSLATE_CACHE_ENTRIES (4)
+#define CIRCUITPY_TRANSLATE_CACHE_MAX_LEN (64)
+#define MICROPY_OPT_SUPERINSTRUCTIONS  (1)
+#define MICROPY_MODULE_COMPILE_CACHE   (1)
+#define MICROPY_PERSISTENT_CODE_SAVE   (1)
+#define MICROPY_MODULE_COMPILE_CACHE_ENABLED (0)
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY_MIN_SIZE (1)
 #define MICROPY_FF_MKFS_FAT32          (1)
 #define MICROPY_PY_FRAMEBUF            (1)
+#define MICROPY_PY_FRAMEBUF_BITMAP     (1)
 #define MICROPY_PY_COLLECTIONS_NAMEDTUPLE__ASDICT (1)
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT (1)
 #define MICROPY_PY_STRUCT              (0) // uses shared-bindings struct
@@ -67,6 +91,9 @@
 #define MICROPY_PY_UCRYPTOLIB_CTR      (1)
 #define MICROPY_PY_MICROPYTHON_HEAP_LOCKED (1)
 #define MICROPY_CPYTHON_EXCEPTION_CHAIN (1)
+#define MICROPY_PREALLOC_OSERROR       (1)
+#define MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX (1)
+#define MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN (64)
 
 // use vfs's functions for import stat and builtin open
 #define mp_import_stat mp_vfs_import_stat
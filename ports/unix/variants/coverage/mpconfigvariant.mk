@@ -27,20 +27,42 @@ $(BUILD)/lib/quirc/lib/%.o: CFLAGS += -Wno-shadow -Wno-sign-compare -include sha
 
 SRC_BITMAP := \
 	shared/runtime/context_manager_helpers.c \
+	displayio_headless.c \
 	displayio_min.c \
 	shared-bindings/aesio/aes.c \
 	shared-bindings/aesio/__init__.c \
+	shared-bindings/arrayops/__init__.c \
+	shared-bindings/arrayops/RingBuffer.c \
 	shared-bindings/audiocore/__init__.c \
 	shared-bindings/audiocore/RawSample.c \
 	shared-bindings/audiocore/WaveFile.c \
+	shared-bindings/audiofx/__init__.c \
+	shared-bindings/audiofx/Compressor.c \
+	shared-bindings/audiofx/Delay.c \
+	shared-bindings/audiofx/EQ.c \
+	shared-bindings/audiofx/Reverb.c \
 	shared-bindings/audiomixer/__init__.c \
 	shared-bindings/audiomixer/Mixer.c \
 	shared-bindings/audiomixer/MixerVoice.c \
 	shared-bindings/bitmaptools/__init__.c \
+	shared-bindings/bitops/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
+	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/Group.c \
+	shared-bindings/displayio/OnDiskBitmap.c \
+	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/Shape.c \
+	shared-bindings/displayio/TileGrid.c \
+	shared-bindings/fontio/__init__.c \
+	shared-bindings/fontio/BuiltinFont.c \
+	shared-bindings/fontio/Glyph.c \
+	shared-bindings/jpegio/__init__.c \
+	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/rainbowio/__init__.c \
 	shared-bindings/struct/__init__.c \
+	shared-bindings/struct/Struct.c \
 	shared-bindings/synthio/__init__.c \
+	shared-bindings/synthio/Biquad.c \
 	shared-bindings/synthio/Math.c \
 	shared-bindings/synthio/MidiTrack.c \
 	shared-bindings/synthio/LFO.c \
@@ -48,48 +70,86 @@ SRC_BITMAP := \
 	shared-bindings/synthio/Synthesizer.c \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
+	shared-bindings/vectorio/__init__.c \
+	shared-bindings/vectorio/Circle.c \
+	shared-bindings/vectorio/Polygon.c \
+	shared-bindings/vectorio/Rectangle.c \
+	shared-bindings/vectorio/VectorShape.c \
 	shared-bindings/zlib/__init__.c \
+	shared-bindings/zlib/Compressor.c \
+	shared-bindings/zlib/DecompIO.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
+	shared-module/arrayops/__init__.c \
+	shared-module/arrayops/RingBuffer.c \
 	shared-module/audiocore/__init__.c \
 	shared-module/audiocore/RawSample.c \
 	shared-module/audiocore/WaveFile.c \
+	shared-module/audiofx/__init__.c \
+	shared-module/audiofx/Compressor.c \
+	shared-module/audiofx/Delay.c \
+	shared-module/audiofx/EQ.c \
+	shared-module/audiofx/Reverb.c \
 	shared-module/audiomixer/__init__.c \
 	shared-module/audiomixer/Mixer.c \
 	shared-module/audiomixer/MixerVoice.c \
 	shared-module/bitmaptools/__init__.c \
+	shared-module/bitops/__init__.c \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
-	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/Group.c \
+	shared-module/displayio/OnDiskBitmap.c \
+	shared-module/displayio/Palette.c \
+	shared-module/displayio/Shape.c \
+	shared-module/displayio/TileGrid.c \
+	shared-module/fontio/__init__.c \
+	shared-module/fontio/BuiltinFont.c \
+	shared-module/jpegio/__init__.c \
+	shared-module/jpegio/JpegDecoder.c \
 	shared-module/os/getenv.c \
 	shared-module/rainbowio/__init__.c \
 	shared-module/struct/__init__.c \
+	shared-module/struct/Struct.c \
 	shared-module/synthio/__init__.c \
+	shared-module/synthio/Biquad.c \
 	shared-module/synthio/Math.c \
 	shared-module/synthio/MidiTrack.c \
 	shared-module/synthio/LFO.c \
 	shared-module/synthio/Note.c \
 	shared-module/synthio/Synthesizer.c \
 	shared-module/traceback/__init__.c \
+	shared-module/vectorio/__init__.c \
+	shared-module/vectorio/Circle.c \
+	shared-module/vectorio/Polygon.c \
+	shared-module/vectorio/Rectangle.c \
+	shared-module/vectorio/VectorShape.c \
 	shared-module/zlib/__init__.c \
+	shared-module/zlib/Compressor.c \
+	shared-module/zlib/DecompIO.c \
 
 SRC_C += $(SRC_BITMAP)
 
 CFLAGS += \
 	-DCIRCUITPY_AESIO=1 \
+	-DCIRCUITPY_ARRAYOPS=1 \
 	-DCIRCUITPY_AUDIOCORE=1 \
+	-DCIRCUITPY_AUDIOFX=1 \
 	-DCIRCUITPY_AUDIOMIXER=1 \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
+	-DCIRCUITPY_BITOPS=1 \
 	-DCIRCUITPY_DISPLAYIO_UNIX=1 \
+	-DCIRCUITPY_FONTIO=1 \
 	-DCIRCUITPY_GIFIO=1 \
+	-DCIRCUITPY_JPEGIO=1 \
 	-DCIRCUITPY_OS_GETENV=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
 	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
 	-DCIRCUITPY_TRACEBACK=1 \
+	-DCIRCUITPY_VECTORIO=1 \
 	-DCIRCUITPY_ZLIB=1
 
 SRC_C += coverage.c
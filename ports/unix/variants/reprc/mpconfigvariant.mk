@@ -0,0 +1,4 @@
+# build interpreter with 30-bit inline floats as object model (object repr C)
+PROG = micropython-reprc
+
+MICROPY_FORCE_32BIT = 1
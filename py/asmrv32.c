@@ -0,0 +1,274 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <assert.h>
+
+#include "py/mpconfig.h"
+
+// wrapper around everything in this file
+#if MICROPY_EMIT_RV32
+
+#include "py/asmrv32.h"
+
+#define WORD_SIZE (4)
+#define SIGNED_FIT6(x) ((((x) & 0xffffffe0) == 0) || (((x) & 0xffffffe0) == 0xffffffe0))
+#define SIGNED_FIT12(x) ((((x) & 0xfffff800) == 0) || (((x) & 0xfffff800) == 0xfffff800))
+#define SIGNED_FIT13(x) ((((x) & 0xfffff000) == 0) || (((x) & 0xfffff000) == 0xfffff000))
+
+// upper 20 bits of a 32-bit value, rounded so that adding the sign-extended
+// lower 12 bits restores the value
+#define HI20(x) ((((uint32_t)(x)) + 0x800) >> 12)
+#define LO12(x) (((uint32_t)(x)) & 0xfff)
+
+// registers saved on entry, in the order they are stored on the stack
+static const uint8_t asm_rv32_saved_regs[] = {
+    ASM_RV32_REG_RA,
+    ASM_RV32_REG_S1,
+    ASM_RV32_REG_S2,
+    ASM_RV32_REG_S3,
+    ASM_RV32_REG_S4,
+};
+
+void asm_rv32_end_pass(asm_rv32_t *as) {
+    (void)as;
+    #if 0
+    // make a hex dump of the machine code
+    if (as->base.pass == MP_ASM_PASS_EMIT) {
+        uint8_t *d = as->base.code_base;
+        printf("RV32 ASM:");
+        for (int i = 0; i < ((as->base.code_size + 15) & ~15); ++i) {
+            if (i % 16 == 0) {
+                printf("\n%08x:", (uint32_t)&d[i]);
+            }
+            if (i % 2 == 0) {
+                printf(" ");
+            }
+            printf("%02x", d[i]);
+        }
+        printf("\n");
+    }
+    #endif
+}
+
+void asm_rv32_entry(asm_rv32_t *as, int num_locals) {
+    // adjust the stack-pointer to store ra, s1-s4 and locals, 16-byte aligned
+    as->stack_adjust = (((ASM_RV32_NUM_REGS_SAVED + num_locals) * WORD_SIZE) + 15) & ~15;
+    if (SIGNED_FIT12(-as->stack_adjust)) {
+        asm_rv32_op_addi(as, ASM_RV32_REG_SP, ASM_RV32_REG_SP, -as->stack_adjust);
+    } else {
+        asm_rv32_mov_reg_i32_optimised(as, ASM_RV32_REG_T0, as->stack_adjust);
+        asm_rv32_op_sub(as, ASM_RV32_REG_SP, ASM_RV32_REG_SP, ASM_RV32_REG_T0);
+    }
+
+    // save return address (ra) and callee-save registers (s1, s2, s3, s4)
+    for (size_t i = 0; i < MP_ARRAY_SIZE(asm_rv32_saved_regs); ++i) {
+        asm_rv32_op_c_swsp(as, asm_rv32_saved_regs[i], i * WORD_SIZE);
+    }
+}
+
+void asm_rv32_exit(asm_rv32_t *as) {
+    // restore registers
+    for (size_t i = MP_ARRAY_SIZE(asm_rv32_saved_regs); i-- > 0;) {
+        asm_rv32_op_c_lwsp(as, asm_rv32_saved_regs[i], i * WORD_SIZE);
+    }
+
+    // restore stack-pointer and return
+    if (SIGNED_FIT12(as->stack_adjust)) {
+        asm_rv32_op_addi(as, ASM_RV32_REG_SP, ASM_RV32_REG_SP, as->stack_adjust);
+    } else {
+        asm_rv32_mov_reg_i32_optimised(as, ASM_RV32_REG_T0, as->stack_adjust);
+        asm_rv32_op_c_add(as, ASM_RV32_REG_SP, ASM_RV32_REG_T0);
+    }
+
+    asm_rv32_op_c_jr(as, ASM_RV32_REG_RA);
+}
+
+STATIC uint32_t get_label_dest(asm_rv32_t *as, uint label) {
+    assert(label < as->base.max_num_labels);
+    return as->base.label_offsets[label];
+}
+
+void asm_rv32_op16(asm_rv32_t *as, uint16_t op) {
+    uint8_t *c = mp_asm_base_get_cur_to_write_bytes(&as->base, 2);
+    if (c != NULL) {
+        c[0] = op;
+        c[1] = op >> 8;
+    }
+}
+
+void asm_rv32_op32(asm_rv32_t *as, uint32_t op) {
+    // code is only guaranteed to be 2-byte aligned, so write the bytes individually
+    uint8_t *c = mp_asm_base_get_cur_to_write_bytes(&as->base, 4);
+    if (c != NULL) {
+        c[0] = op;
+        c[1] = op >> 8;
+        c[2] = op >> 16;
+        c[3] = op >> 24;
+    }
+}
+
+void asm_rv32_j_label(asm_rv32_t *as, uint label) {
+    uint32_t dest = get_label_dest(as, label);
+    int32_t rel = dest - as->base.code_offset;
+    if (dest != (uint32_t)-1 && rel < 0 && SIGNED_FIT12(rel)) {
+        // is a short backwards jump, so we know the size of the jump on the first pass
+        asm_rv32_op_c_j(as, rel);
+    } else {
+        // we assume rel, as a signed int, fits in 21-bits
+        asm_rv32_op_jal(as, ASM_RV32_REG_ZERO, rel);
+    }
+}
+
+void asm_rv32_bcc_reg_reg_label(asm_rv32_t *as, uint cond, uint reg1, uint reg2, uint label) {
+    uint32_t dest = get_label_dest(as, label);
+    int32_t rel = dest - as->base.code_offset;
+    if (dest != (uint32_t)-1 && rel < 0 && SIGNED_FIT13(rel)) {
+        // is a short backwards jump, so we know the size of the jump on the first pass
+        asm_rv32_op_bcc(as, cond, reg1, reg2, rel);
+    } else {
+        // is a forwards or long jump, so reverse the sense of the branch to
+        // jump over an unconditional jump with a 21-bit range
+        asm_rv32_op_bcc(as, cond ^ 1, reg1, reg2, 8);
+        asm_rv32_op_jal(as, ASM_RV32_REG_ZERO, rel - 4);
+    }
+}
+
+// convenience function; reg_dest may be the same as reg_src[12]
+void asm_rv32_setcc_reg_reg_reg(asm_rv32_t *as, uint cond, uint reg_dest, uint reg_src1, uint reg_src2) {
+    switch (cond) {
+        case ASM_RV32_CC_EQ:
+            asm_rv32_op_sub(as, reg_dest, reg_src1, reg_src2);
+            asm_rv32_op_sltiu(as, reg_dest, reg_dest, 1);
+            break;
+        case ASM_RV32_CC_NE:
+            asm_rv32_op_sub(as, reg_dest, reg_src1, reg_src2);
+            asm_rv32_op_sltu(as, reg_dest, ASM_RV32_REG_ZERO, reg_dest);
+            break;
+        case ASM_RV32_CC_LT:
+        case ASM_RV32_CC_GE:
+            asm_rv32_op_slt(as, reg_dest, reg_src1, reg_src2);
+            break;
+        default:
+            asm_rv32_op_sltu(as, reg_dest, reg_src1, reg_src2);
+            break;
+    }
+    if (cond == ASM_RV32_CC_GE || cond == ASM_RV32_CC_GEU) {
+        asm_rv32_op_xori(as, reg_dest, reg_dest, 1);
+    }
+}
+
+size_t asm_rv32_mov_reg_i32(asm_rv32_t *as, uint reg_dest, uint32_t i32) {
+    // this is always 8 bytes so the value can be patched when linking
+    size_t loc = mp_asm_base_get_code_pos(&as->base);
+    asm_rv32_op_lui(as, reg_dest, HI20(i32));
+    asm_rv32_op_addi(as, reg_dest, reg_dest, LO12(i32));
+    return loc;
+}
+
+void asm_rv32_mov_reg_i32_optimised(asm_rv32_t *as, uint reg_dest, uint32_t i32) {
+    if (SIGNED_FIT6(i32)) {
+        asm_rv32_op_c_li(as, reg_dest, i32);
+    } else if (SIGNED_FIT12(i32)) {
+        asm_rv32_op_addi(as, reg_dest, ASM_RV32_REG_ZERO, i32);
+    } else {
+        asm_rv32_op_lui(as, reg_dest, HI20(i32));
+        if (LO12(i32) != 0) {
+            asm_rv32_op_addi(as, reg_dest, reg_dest, LO12(i32));
+        }
+    }
+}
+
+void asm_rv32_mov_reg_reg(asm_rv32_t *as, uint reg_dest, uint reg_src) {
+    asm_rv32_op_c_mv(as, reg_dest, reg_src);
+}
+
+void asm_rv32_add_reg_reg(asm_rv32_t *as, uint reg_dest, uint reg_src) {
+    asm_rv32_op_c_add(as, reg_dest, reg_src);
+}
+
+// the offset must be word aligned; t0 is used as a temporary if it doesn't fit in 12 bits
+void asm_rv32_load_reg_reg_offset(asm_rv32_t *as, uint reg_dest, uint reg_base, int32_t byte_offset) {
+    if (reg_base == ASM_RV32_REG_SP && 0 <= byte_offset && byte_offset < 256) {
+        asm_rv32_op_c_lwsp(as, reg_dest, byte_offset);
+    } else if (ASM_RV32_REG_IS_C(reg_dest) && ASM_RV32_REG_IS_C(reg_base) && 0 <= byte_offset && byte_offset < 128) {
+        asm_rv32_op_c_lw(as, reg_dest, reg_base, byte_offset);
+    } else if (SIGNED_FIT12(byte_offset)) {
+        asm_rv32_op_lw(as, reg_dest, reg_base, byte_offset);
+    } else {
+        asm_rv32_op_lui(as, ASM_RV32_REG_T0, HI20(byte_offset));
+        asm_rv32_op_add(as, ASM_RV32_REG_T0, ASM_RV32_REG_T0, reg_base);
+        asm_rv32_op_lw(as, reg_dest, ASM_RV32_REG_T0, LO12(byte_offset));
+    }
+}
+
+// the offset must be word aligned; t0 is used as a temporary if it doesn't fit in 12 bits
+void asm_rv32_store_reg_reg_offset(asm_rv32_t *as, uint reg_src, uint reg_base, int32_t byte_offset) {
+    if (reg_base == ASM_RV32_REG_SP && 0 <= byte_offset && byte_offset < 256) {
+        asm_rv32_op_c_swsp(as, reg_src, byte_offset);
+    } else if (ASM_RV32_REG_IS_C(reg_src) && ASM_RV32_REG_IS_C(reg_base) && 0 <= byte_offset && byte_offset < 128) {
+        asm_rv32_op_c_sw(as, reg_src, reg_base, byte_offset);
+    } else if (SIGNED_FIT12(byte_offset)) {
+        asm_rv32_op_sw(as, reg_src, reg_base, byte_offset);
+    } else {
+        asm_rv32_op_lui(as, ASM_RV32_REG_T0, HI20(byte_offset));
+        asm_rv32_op_add(as, ASM_RV32_REG_T0, ASM_RV32_REG_T0, reg_base);
+        asm_rv32_op_sw(as, reg_src, ASM_RV32_REG_T0, LO12(byte_offset));
+    }
+}
+
+void asm_rv32_mov_local_reg(asm_rv32_t *as, int local_num, uint reg_src) {
+    asm_rv32_store_reg_reg_offset(as, reg_src, ASM_RV32_REG_SP, local_num * WORD_SIZE);
+}
+
+void asm_rv32_mov_reg_local(asm_rv32_t *as, uint reg_dest, int local_num) {
+    asm_rv32_load_reg_reg_offset(as, reg_dest, ASM_RV32_REG_SP, local_num * WORD_SIZE);
+}
+
+void asm_rv32_mov_reg_local_addr(asm_rv32_t *as, uint reg_dest, int local_num) {
+    uint off = local_num * WORD_SIZE;
+    if (SIGNED_FIT12(off)) {
+        asm_rv32_op_addi(as, reg_dest, ASM_RV32_REG_SP, off);
+    } else {
+        asm_rv32_mov_reg_i32_optimised(as, reg_dest, off);
+        asm_rv32_op_c_add(as, reg_dest, ASM_RV32_REG_SP);
+    }
+}
+
+void asm_rv32_mov_reg_pcrel(asm_rv32_t *as, uint reg_dest, uint label) {
+    // Get relative offset from PC of the auipc instruction
+    uint32_t dest = get_label_dest(as, label);
+    int32_t rel = dest - as->base.code_offset;
+    asm_rv32_op_auipc(as, reg_dest, HI20(rel));
+    asm_rv32_op_addi(as, reg_dest, reg_dest, LO12(rel));
+}
+
+void asm_rv32_call_ind(asm_rv32_t *as, uint idx) {
+    asm_rv32_load_reg_reg_offset(as, ASM_RV32_REG_T0, ASM_RV32_REG_FUN_TABLE, idx * WORD_SIZE);
+    asm_rv32_op_c_jalr(as, ASM_RV32_REG_T0);
+}
+
+#endif // MICROPY_EMIT_RV32
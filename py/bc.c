@@ -125,8 +125,10 @@ void PLACE_IN_ITCM(mp_setup_code_state)(mp_code_state_t * code_state, size_t n_a
     code_state->prev = NULL;
     #endif
 
-    #if MICROPY_PY_SYS_SETTRACE
+    #if MICROPY_VM_TRACK_CODE_STATE
     code_state->prev_state = NULL;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     code_state->frame = NULL;
     #endif
 
@@ -39,14 +39,15 @@
 // Nibbles in magic number are: BB BB BB BB BB BO VV QU
 #define MP_BC_FORMAT(op) ((0x000003a4 >> (2 * ((op) >> 4))) & 3)
 
-// Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op
+// Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op,
+// superinstruction (s)
 #define MP_BC_BASE_RESERVED                 (0x00) // ----------------
-#define MP_BC_BASE_QSTR_O                   (0x10) // LLLLLLSSSDDII---
+#define MP_BC_BASE_QSTR_O                   (0x10) // LLLLLLSSSDDIIsss
 #define MP_BC_BASE_VINT_E                   (0x20) // MMLLLLSSDDBBBBBB
 #define MP_BC_BASE_VINT_O                   (0x30) // UUMMCCCC--------
 #define MP_BC_BASE_JUMP_E                   (0x40) // J-JJJJJEEEEF----
 #define MP_BC_BASE_BYTE_O                   (0x50) // LLLLSSDTTTTTEEFF
-#define MP_BC_BASE_BYTE_E                   (0x60) // --BREEEYYI------
+#define MP_BC_BASE_BYTE_E                   (0x60) // ssBREEEYYI------
 #define MP_BC_LOAD_CONST_SMALL_INT_MULTI    (0x70) // LLLLLLLLLLLLLLLL
 //                                          (0x80) // LLLLLLLLLLLLLLLL
 //                                          (0x90) // LLLLLLLLLLLLLLLL
@@ -147,4 +148,17 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// Superinstructions, emitted only with MICROPY_OPT_SUPERINSTRUCTIONS. Each does the
+// same as the sequence of opcodes shown, where local 0 is the first argument.
+#define MP_BC_LOAD_FAST0_ATTR               (MP_BC_BASE_QSTR_O + 0x0d) // qstr; LOAD_FAST 0, LOAD_ATTR
+#define MP_BC_LOAD_FAST0_METHOD             (MP_BC_BASE_QSTR_O + 0x0e) // qstr; LOAD_FAST 0, LOAD_METHOD
+#define MP_BC_STORE_FAST0_ATTR              (MP_BC_BASE_QSTR_O + 0x0f) // qstr; LOAD_FAST 0, STORE_ATTR
+#define MP_BC_LOAD_FAST_FAST                (MP_BC_BASE_BYTE_E + 0x00) // extra byte a << 4 | b; LOAD_FAST a, LOAD_FAST b
+#define MP_BC_ADD_FAST_SMALL_INT            (MP_BC_BASE_BYTE_E + 0x01) // extra byte n << 4 | inplace << 3 | c;
+                                                                       // LOAD_FAST n, LOAD_CONST_SMALL_INT c, BINARY_OP (INPLACE_)ADD, STORE_FAST n
+
+// Only found in the stub of a function whose code hasn't been loaded from a .mpy
+// file yet, with MICROPY_PERSISTENT_CODE_LOAD_LAZY.
+#define MP_BC_LAZY_LOAD                     (MP_BC_BASE_BYTE_E + 0x0a)
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
@@ -32,6 +32,18 @@ mp_obj_t mp_builtin___import__(size_t n_args, const mp_obj_t *args);
 mp_obj_t mp_builtin_open(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs);
 mp_obj_t mp_micropython_mem_info(size_t n_args, const mp_obj_t *args);
 
+#if MICROPY_MODULE_COMPILE_CACHE
+// State of the import compile cache.  It is not reset by mp_init so that a
+// setting made in boot.py lasts for later runs.
+typedef struct _mp_compile_cache_t {
+    bool enabled;
+    size_t hits;
+    size_t misses;
+} mp_compile_cache_t;
+
+extern mp_compile_cache_t mp_compile_cache;
+#endif
+
 MP_DECLARE_CONST_FUN_OBJ_VAR(mp_builtin___build_class___obj);
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_builtin___import___obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_builtin___repl_print___obj);
@@ -201,6 +201,190 @@ STATIC void do_execute_raw_code(mp_obj_t module_obj, mp_raw_code_t *raw_code, co
 }
 #endif
 
+#if MICROPY_MODULE_COMPILE_CACHE
+
+#include "extmod/vfs.h"
+#include "py/stream.h"
+
+// Each cache file starts with a key identifying the source it was compiled
+// from (its size, modification time, a hash of its contents and its path) and
+// the optimisation level used, followed by the .mpy data. The contents are
+// hashed because FAT modification times only have a 2 second resolution.
+// Cache files are named after a hash of the source path.
+#define COMPILE_CACHE_KEY_VERSION (2)
+
+mp_compile_cache_t mp_compile_cache = {
+    .enabled = MICROPY_MODULE_COMPILE_CACHE_ENABLED,
+};
+
+STATIC void compile_cache_add_uint32(vstr_t *vstr, uint32_t n) {
+    for (int i = 0; i < 4; ++i) {
+        vstr_add_byte(vstr, n & 0xff);
+        n >>= 8;
+    }
+}
+
+// 32-bit FNV-1a
+#define COMPILE_CACHE_HASH_INIT (2166136261u)
+
+STATIC uint32_t compile_cache_hash(uint32_t hash, byte b) {
+    return (hash ^ b) * 16777619u;
+}
+
+STATIC uint32_t compile_cache_hash_file(const char *file_str) {
+    mp_reader_t reader;
+    mp_reader_new_file(&reader, file_str);
+    uint32_t hash = COMPILE_CACHE_HASH_INIT;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_uint_t b;
+        while ((b = reader.readbyte(reader.data)) != MP_READER_EOF) {
+            hash = compile_cache_hash(hash, b);
+        }
+        nlr_pop();
+    } else {
+        reader.close(reader.data);
+        nlr_jump(nlr.ret_val);
+    }
+    reader.close(reader.data);
+    return hash;
+}
+
+STATIC void compile_cache_make_key(vstr_t *key, const char *file_str, size_t file_len) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_tuple_get(mp_vfs_stat(mp_obj_new_str(file_str, file_len)), &len, &items);
+    vstr_add_byte(key, 'P');
+    vstr_add_byte(key, COMPILE_CACHE_KEY_VERSION);
+    vstr_add_byte(key, MP_STATE_VM(mp_optimise_value));
+    compile_cache_add_uint32(key, mp_obj_get_int_truncated(items[6]));
+    compile_cache_add_uint32(key, mp_obj_get_int_truncated(items[8]));
+    compile_cache_add_uint32(key, compile_cache_hash_file(file_str));
+    compile_cache_add_uint32(key, file_len);
+    vstr_add_strn(key, file_str, file_len);
+}
+
+// Sets path to the cache file for the given source, without its extension.
+STATIC void compile_cache_make_path(vstr_t *path, const char *file_str, size_t file_len) {
+    uint32_t hash = COMPILE_CACHE_HASH_INIT;
+    for (size_t i = 0; i < file_len; ++i) {
+        hash = compile_cache_hash(hash, file_str[i]);
+    }
+    vstr_printf(path, "%s/%08x", MICROPY_MODULE_COMPILE_CACHE_DIR, (unsigned int)hash);
+}
+
+// Returns NULL if the cache file is for some other version of the source.
+STATIC mp_raw_code_t *compile_cache_load(const char *cache_file, const vstr_t *key) {
+    mp_reader_t reader;
+    mp_reader_new_file(&reader, cache_file);
+    mp_raw_code_t *raw_code = NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        size_t i = 0;
+        while (i < key->len && reader.readbyte(reader.data) == (byte)key->buf[i]) {
+            ++i;
+        }
+        if (i == key->len) {
+            // This closes the reader once the code is loaded.
+            raw_code = mp_raw_code_load(&reader);
+        } else {
+            reader.close(reader.data);
+        }
+        nlr_pop();
+    } else {
+        reader.close(reader.data);
+        nlr_jump(nlr.ret_val);
+    }
+    return raw_code;
+}
+
+STATIC void compile_cache_save(vstr_t *path, const vstr_t *key, mp_raw_code_t *rc) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_vfs_mkdir(mp_obj_new_str(MICROPY_MODULE_COMPILE_CACHE_DIR, strlen(MICROPY_MODULE_COMPILE_CACHE_DIR)));
+        nlr_pop();
+    }
+
+    // Write to a temporary file and rename it into place, so that an interrupted
+    // write can't leave a cache file that seems valid.
+    size_t base_len = path->len;
+    vstr_add_str(path, ".tmp");
+    mp_obj_t tmp_path = mp_obj_new_str(path->buf, path->len);
+    mp_obj_t args[2] = { tmp_path, MP_OBJ_NEW_QSTR(MP_QSTR_wb) };
+    mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), args, (mp_map_t *)&mp_const_empty_map);
+    if (nlr_push(&nlr) == 0) {
+        mp_stream_write(file, key->buf, key->len, MP_STREAM_RW_WRITE);
+        mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+        mp_raw_code_save(rc, &print);
+        nlr_pop();
+    } else {
+        mp_stream_close(file);
+        mp_vfs_remove(tmp_path);
+        nlr_jump(nlr.ret_val);
+    }
+    mp_stream_close(file);
+
+    path->len = base_len;
+    vstr_add_str(path, ".mpy");
+    mp_obj_t cache_path = mp_obj_new_str(path->buf, path->len);
+    if (nlr_push(&nlr) == 0) {
+        mp_vfs_remove(cache_path);
+        nlr_pop();
+    }
+    mp_vfs_rename(tmp_path, cache_path);
+}
+
+// Compiles the given source file, using the compile cache when it holds an
+// up-to-date copy and adding to it otherwise.  Failures to read or write the
+// cache (for example, because the filesystem is read-only) are ignored.
+STATIC mp_raw_code_t *compile_cache_get(const char *file_str, size_t file_len) {
+    vstr_t key;
+    vstr_t path;
+    vstr_init(&key, 16 + file_len);
+    vstr_init(&path, sizeof(MICROPY_MODULE_COMPILE_CACHE_DIR) + 13);
+    mp_raw_code_t *raw_code = NULL;
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        compile_cache_make_key(&key, file_str, file_len);
+        compile_cache_make_path(&path, file_str, file_len);
+        vstr_add_str(&path, ".mpy");
+        raw_code = compile_cache_load(vstr_null_terminated_str(&path), &key);
+        nlr_pop();
+    } else {
+        raw_code = NULL;
+    }
+
+    if (raw_code != NULL) {
+        ++mp_compile_cache.hits;
+    } else {
+        ++mp_compile_cache.misses;
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
+        #if MICROPY_COMP_INCREMENTAL
+        raw_code = mp_compile_incremental_to_raw_code(lex);
+        #else
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        raw_code = mp_compile_to_raw_code(&parse_tree, source_name, false);
+        #endif
+
+        // Native code refers to the running firmware, so isn't cached.
+        if (path.len > 0 && !mp_raw_code_has_native(raw_code)) {
+            path.len -= 4;
+            if (nlr_push(&nlr) == 0) {
+                compile_cache_save(&path, &key, raw_code);
+                nlr_pop();
+            }
+        }
+    }
+
+    vstr_clear(&key);
+    vstr_clear(&path);
+    return raw_code;
+}
+
+#endif // MICROPY_MODULE_COMPILE_CACHE
+
 STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_ENABLE_COMPILER || (MICROPY_PERSISTENT_CODE_LOAD && MICROPY_HAS_FILE_READER)
     const char *file_str = vstr_null_terminated_str(file);
@@ -248,6 +432,13 @@ STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        #if MICROPY_MODULE_COMPILE_CACHE
+        if (mp_compile_cache.enabled) {
+            mp_raw_code_t *raw_code = compile_cache_get(file_str, file->len);
+            do_execute_raw_code(module_obj, raw_code, file_str);
+            return;
+        }
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
         do_load_from_lexer(module_obj, lex);
         return;
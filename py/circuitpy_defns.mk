@@ -115,6 +115,9 @@ endif
 ifeq ($(CIRCUITPY_ANALOGIO),1)
 SRC_PATTERNS += analogio/%
 endif
+ifeq ($(CIRCUITPY_ARRAYOPS),1)
+SRC_PATTERNS += arrayops/%
+endif
 ifeq ($(CIRCUITPY_ATEXIT),1)
 SRC_PATTERNS += atexit/%
 endif
@@ -130,12 +133,18 @@ endif
 ifeq ($(CIRCUITPY_AUDIOCORE),1)
 SRC_PATTERNS += audiocore/%
 endif
+ifeq ($(CIRCUITPY_AUDIOFX),1)
+SRC_PATTERNS += audiofx/%
+endif
 ifeq ($(CIRCUITPY_AUDIOMIXER),1)
 SRC_PATTERNS += audiomixer/%
 endif
 ifeq ($(CIRCUITPY_AUDIOMP3),1)
 SRC_PATTERNS += audiomp3/%
 endif
+ifeq ($(CIRCUITPY_BENCHMARK),1)
+SRC_PATTERNS += benchmark/%
+endif
 ifeq ($(CIRCUITPY_BITBANGIO),1)
 SRC_PATTERNS += bitbangio/%
 endif
@@ -230,6 +239,9 @@ endif
 ifeq ($(CIRCUITPY_IS31FL3741),1)
 SRC_PATTERNS += is31fl3741/%
 endif
+ifeq ($(CIRCUITPY_JPEGIO),1)
+SRC_PATTERNS += jpegio/%
+endif
 ifeq ($(CIRCUITPY_KEYPAD),1)
 SRC_PATTERNS += keypad/%
 endif
@@ -489,6 +501,7 @@ SRC_COMMON_HAL_ALL = \
 	ssl/SSLContext.c \
 	ssl/SSLSocket.c \
 	supervisor/Runtime.c \
+	supervisor/WebSocketData.c \
 	supervisor/__init__.c \
 	usb_host/__init__.c \
 	usb_host/Port.c \
@@ -543,6 +556,7 @@ $(filter $(SRC_PATTERNS), \
 	supervisor/StatusBar.c \
 	wifi/AuthMode.c \
 	wifi/Packet.c \
+	wifi/PowerManagement.c \
 )
 
 ifeq ($(CIRCUITPY_SAFEMODE_PY),1)
@@ -568,10 +582,17 @@ SRC_SHARED_MODULE_ALL = \
 	_stage/__init__.c \
 	aesio/__init__.c \
 	aesio/aes.c \
+	arrayops/__init__.c \
+	arrayops/RingBuffer.c \
 	atexit/__init__.c \
 	audiocore/RawSample.c \
 	audiocore/WaveFile.c \
 	audiocore/__init__.c \
+	audiofx/Compressor.c \
+	audiofx/Delay.c \
+	audiofx/EQ.c \
+	audiofx/Reverb.c \
+	audiofx/__init__.c \
 	audioio/__init__.c \
 	audiomixer/Mixer.c \
 	audiomixer/MixerVoice.c \
@@ -579,6 +600,8 @@ SRC_SHARED_MODULE_ALL = \
 	audiomp3/MP3Decoder.c \
 	audiomp3/__init__.c \
 	audiopwmio/__init__.c \
+	benchmark/Timer.c \
+	benchmark/__init__.c \
 	bitbangio/I2C.c \
 	bitbangio/SPI.c \
 	bitbangio/__init__.c \
@@ -604,6 +627,7 @@ SRC_SHARED_MODULE_ALL = \
 	displayio/TileGrid.c \
 	displayio/area.c \
 	displayio/__init__.c \
+	dualbank/Updater.c \
 	floppyio/__init__.c \
 	fontio/BuiltinFont.c \
 	fontio/__init__.c \
@@ -619,6 +643,8 @@ SRC_SHARED_MODULE_ALL = \
 	is31fl3741/IS31FL3741.c \
 	is31fl3741/FrameBuffer.c \
 	is31fl3741/__init__.c \
+	jpegio/__init__.c \
+	jpegio/JpegDecoder.c \
 	keypad/__init__.c \
 	keypad/Event.c \
 	keypad/EventQueue.c \
@@ -627,6 +653,7 @@ SRC_SHARED_MODULE_ALL = \
 	keypad/Keys.c \
 	memorymonitor/__init__.c \
 	memorymonitor/AllocationAlarm.c \
+	memorymonitor/AllocationSites.c \
 	memorymonitor/AllocationSize.c \
 	network/__init__.c \
 	msgpack/__init__.c \
@@ -646,10 +673,13 @@ SRC_SHARED_MODULE_ALL = \
 	sharpdisplay/SharpMemoryFramebuffer.c \
 	sharpdisplay/__init__.c \
 	socket/__init__.c \
+	socketpool/ConnectionPool.c \
 	storage/__init__.c \
 	struct/__init__.c \
+	struct/Struct.c \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
+	synthio/Biquad.c \
 	synthio/LFO.c \
 	synthio/Math.c \
 	synthio/MidiTrack.c \
@@ -664,8 +694,11 @@ SRC_SHARED_MODULE_ALL = \
 	usb/__init__.c \
 	usb/core/__init__.c \
 	usb/core/Device.c \
+	usb_host/MassStorage.c \
 	ustack/__init__.c \
 	zlib/__init__.c \
+	zlib/Compressor.c \
+	zlib/DecompIO.c \
 	vectorio/Circle.c \
 	vectorio/Polygon.c \
 	vectorio/Rectangle.c \
@@ -66,9 +66,25 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_MODULE_CONST        (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (0)
+#define MICROPY_COMP_INCREMENTAL         (1)
 #define MICROPY_DEBUG_PRINTERS           (0)
-#define MICROPY_EMIT_INLINE_THUMB        (CIRCUITPY_ENABLE_MPY_NATIVE)
-#define MICROPY_EMIT_THUMB               (CIRCUITPY_ENABLE_MPY_NATIVE)
+#if CIRCUITPY_NATIVE_EMITTERS
+#if defined(__thumb__)
+#define MICROPY_EMIT_INLINE_THUMB        (1)
+#define MICROPY_EMIT_THUMB               (1)
+#if !defined(__thumb2__)
+// Cortex-M0+ only has the 16-bit Thumb instructions.
+#define MICROPY_EMIT_THUMB_ARMV7M        (0)
+#endif
+#if !defined(__ARM_FP)
+#define MICROPY_EMIT_INLINE_THUMB_FLOAT  (0)
+#endif
+#elif defined(__xtensa__)
+#define MICROPY_EMIT_XTENSAWIN           (1)
+#elif defined(__riscv)
+#define MICROPY_EMIT_RV32                (1)
+#endif
+#endif
 #define MICROPY_EMIT_X64                 (0)
 #define MICROPY_ENABLE_DOC_STRING        (0)
 #define MICROPY_ENABLE_FINALISER         (1)
@@ -80,18 +96,29 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
+#define MICROPY_GC_CENSUS                (CIRCUITPY_UHEAP)
 #define MICROPY_HELPER_LEXER_UNIX        (0)
 #define MICROPY_HELPER_REPL              (1)
 #define MICROPY_KBD_EXCEPTION            (1)
 #define MICROPY_MEM_STATS                (0)
 #define MICROPY_MODULE_BUILTIN_INIT      (1)
+#define MICROPY_MODULE_COMPILE_CACHE     (CIRCUITPY_COMPILE_CACHE)
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
+#define MICROPY_PREALLOC_OSERROR         (CIRCUITPY_FULL_BUILD)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
+#define MICROPY_OPT_LOAD_GLOBAL_CACHE (CIRCUITPY_OPT_LOAD_GLOBAL_CACHE)
+#define MICROPY_OPT_LOAD_METHOD_CACHE (CIRCUITPY_OPT_LOAD_METHOD_CACHE)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_MAP_ORDERED_INDEX (CIRCUITPY_OPT_MAP_ORDERED_INDEX)
+#define MICROPY_OPT_QSTR_INDEX        (CIRCUITPY_OPT_QSTR_INDEX)
+#define MICROPY_OPT_VM_SMALL_INT_BINARY_OP (CIRCUITPY_OPT_VM_SMALL_INT_BINARY_OP)
+#define MICROPY_OPT_SUPERINSTRUCTIONS (CIRCUITPY_OPT_SUPERINSTRUCTIONS)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY (CIRCUITPY_PERSISTENT_CODE_LOAD_LAZY)
+#define MICROPY_PERSISTENT_CODE_SAVE     (CIRCUITPY_COMPILE_CACHE)
 
 #define MICROPY_PY_ARRAY                 (CIRCUITPY_ARRAY)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
@@ -113,10 +140,13 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_BUILTINS_SLICE_ATTRS  (1)
 #define MICROPY_PY_BUILTINS_SLICE_INDICES (1)
 #define MICROPY_PY_BUILTINS_STR_UNICODE  (1)
+#define MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN (CIRCUITPY_FULL_BUILD ? 64 : 0)
 
 #define MICROPY_PY_CMATH                 (0)
 #define MICROPY_PY_COLLECTIONS           (CIRCUITPY_COLLECTIONS)
 #define MICROPY_PY_DESCRIPTORS           (1)
+#define MICROPY_PY_FRAMEBUF_BITMAP       (CIRCUITPY_DISPLAYIO)
 #define MICROPY_PY_IO_FILEIO             (1)
 #define MICROPY_PY_GC                    (1)
 // Supplanted by shared-bindings/math
@@ -259,6 +289,15 @@ typedef long mp_off_t;
 #define MICROPY_FF_MKFS_FAT32           (CIRCUITPY_FULL_BUILD)
 #endif
 
+// storage.mmap() relies on f_expand() to lay files out contiguously.
+#ifndef MICROPY_FATFS_USE_EXPAND
+#define MICROPY_FATFS_USE_EXPAND        (CIRCUITPY_STORAGE_MMAP)
+#endif
+
+#ifndef MICROPY_FATFS_IO_STATS
+#define MICROPY_FATFS_IO_STATS          (CIRCUITPY_STORAGE_STATS)
+#endif
+
 // LONGINT_IMPL_xxx are defined in the Makefile.
 //
 #ifdef LONGINT_IMPL_NONE
@@ -350,19 +389,43 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
 #endif
 
+// Size in bytes of the buffer that audiomp3 reads ahead into from a background
+// task, so that slow storage doesn't stall audio. 0 reads the file only when
+// the decoder needs more data.
+#ifndef CIRCUITPY_AUDIOMP3_READAHEAD
+#define CIRCUITPY_AUDIOMP3_READAHEAD (4096)
+#endif
+
+// The same, for audiocore.WaveFile. Must be a multiple of 512.
+#ifndef CIRCUITPY_AUDIOCORE_READAHEAD
+#define CIRCUITPY_AUDIOCORE_READAHEAD (4096)
+#endif
+
 #if CIRCUITPY_KEYPAD
 #define KEYPAD_ROOT_POINTERS mp_obj_t keypad_scanners_linked_list;
 #else
 #define KEYPAD_ROOT_POINTERS
 #endif
 
+#if CIRCUITPY_PROFILE
+#define PROFILE_ROOT_POINTERS void *profile_table;
+#else
+#define PROFILE_ROOT_POINTERS
+#endif
+
 #if CIRCUITPY_MEMORYMONITOR
 #define MEMORYMONITOR_ROOT_POINTERS mp_obj_t active_allocationsizes; \
-    mp_obj_t active_allocationalarms;
+    mp_obj_t active_allocationalarms; \
+    mp_obj_t active_allocationsites;
 #else
 #define MEMORYMONITOR_ROOT_POINTERS
 #endif
 
+// The profiler and memorymonitor.AllocationSites look up the running Python code.
+#if CIRCUITPY_PROFILE || CIRCUITPY_MEMORYMONITOR
+#define MICROPY_VM_TRACK_CODE_STATE (1)
+#endif
+
 // This is not a top-level module; it's microcontroller.nvm.
 #if CIRCUITPY_NVM
 extern const struct _mp_obj_module_t nvm_module;
@@ -433,6 +496,7 @@ struct _supervisor_allocation_node;
     BOARD_UART_ROOT_POINTER \
     WIFI_MONITOR_ROOT_POINTERS \
     MEMORYMONITOR_ROOT_POINTERS \
+    PROFILE_ROOT_POINTERS \
     vstr_t *repl_line; \
     mp_obj_t pew_singleton; \
     mp_obj_t rtc_time_source; \
@@ -473,6 +537,88 @@ void background_callback_run_all(void);
 
 #define CIRCUITPY_BOOT_OUTPUT_FILE "/boot_out.txt"
 
+// How long bulk background callbacks may run in one pass before the rest wait
+// for the next one.
+#ifndef CIRCUITPY_BACKGROUND_BULK_BUDGET_US
+#define CIRCUITPY_BACKGROUND_BULK_BUDGET_US (1000)
+#endif
+
+// The number of distinct callback functions timed by CIRCUITPY_BACKGROUND_CALLBACK_STATS.
+// The last slot also counts any functions beyond that.
+#ifndef CIRCUITPY_BACKGROUND_CALLBACK_STATS_SLOTS
+#define CIRCUITPY_BACKGROUND_CALLBACK_STATS_SLOTS (16)
+#endif
+
+// How many of the innermost functions CIRCUITPY_PROFILE records per sample.
+// Each stack in the table takes 12 bytes plus a pointer per function.
+#ifndef CIRCUITPY_PROFILE_DEPTH
+#define CIRCUITPY_PROFILE_DEPTH (8)
+#endif
+
+// The number of events held by CIRCUITPY_TRACE, 12 bytes each.
+#ifndef CIRCUITPY_TRACE_EVENTS
+#define CIRCUITPY_TRACE_EVENTS (256)
+#endif
+
+// CIRCUITPY_TRACE records when the VM goes longer than this between checks
+// for background tasks.
+#ifndef CIRCUITPY_TRACE_VM_GAP_US
+#define CIRCUITPY_TRACE_VM_GAP_US (1000)
+#endif
+
+// The number of HTTP connections the web workflow serves at once, each with
+// about 1.2kB of request state.
+#ifndef CIRCUITPY_WEB_WORKFLOW_CONNECTIONS
+#define CIRCUITPY_WEB_WORKFLOW_CONNECTIONS (4)
+#endif
+
+// The buffer that web workflow file downloads and uploads go through. A
+// multiple of the 512 byte sector size.
+#ifndef CIRCUITPY_WEB_WORKFLOW_TRANSFER_BUFFER
+#define CIRCUITPY_WEB_WORKFLOW_TRANSFER_BUFFER (4096)
+#endif
+
+// Binary websocket messages for supervisor.websocket_data are buffered here
+// until code.py reads them.
+#ifndef CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_DATA_BUFFER
+#define CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_DATA_BUFFER (512)
+#endif
+
+// serial_write_substring() collects up to this much output each for the
+// display terminal and the web workflow websocket before writing it out.
+#ifndef CIRCUITPY_SERIAL_OUTPUT_BUFFER
+#define CIRCUITPY_SERIAL_OUTPUT_BUFFER (256)
+#endif
+
+// The TinyUSB FIFO sizes for each USB CDC interface, the console and
+// usb_cdc.data. TinyUSB allocates them statically so they are set per build.
+#ifndef CIRCUITPY_USB_CDC_RX_BUFSIZE
+#define CIRCUITPY_USB_CDC_RX_BUFSIZE (CIRCUITPY_FULL_BUILD ? 256 : 64)
+#endif
+#ifndef CIRCUITPY_USB_CDC_TX_BUFSIZE
+#define CIRCUITPY_USB_CDC_TX_BUFSIZE (CIRCUITPY_FULL_BUILD ? 1024 : 64)
+#endif
+
+// How much write data a windowed BLE file transfer client may have in flight.
+// A multiple of the 512 byte sector size, each sector taking about 580 bytes of
+// receive buffer.
+#ifndef CIRCUITPY_BLE_FILE_TRANSFER_WRITE_WINDOW
+#define CIRCUITPY_BLE_FILE_TRANSFER_WRITE_WINDOW (4 * 512)
+#endif
+
+// The longest select.poll() and select.select() sleep between polls of their objects while
+// none is ready. Ports enable this when the events that make their streams ready wake the
+// main task: 0 keeps polling continuously.
+#ifndef CIRCUITPY_SELECT_IDLE_MAX_MS
+#define CIRCUITPY_SELECT_IDLE_MAX_MS (0)
+#endif
+
+// How many server hostnames an ssl.SSLContext remembers a TLS session for, so
+// that reconnecting to them can resume instead of doing a full handshake.
+#ifndef CIRCUITPY_SSL_SESSION_CACHE_SIZE
+#define CIRCUITPY_SSL_SESSION_CACHE_SIZE (2)
+#endif
+
 #ifndef CIRCUITPY_BOOT_COUNTER
 #define CIRCUITPY_BOOT_COUNTER 0
 #endif
@@ -495,6 +641,16 @@ void background_callback_run_all(void);
 #define CIRCUITPY_REPL_LOGO (1)
 #endif
 
+// The number of decompressed messages to keep, and the longest one kept
+// (including the NUL). 0 entries turns the cache off.
+#ifndef CIRCUITPY_TRANSLATE_CACHE_ENTRIES
+#define CIRCUITPY_TRANSLATE_CACHE_ENTRIES (4)
+#endif
+
+#ifndef CIRCUITPY_TRANSLATE_CACHE_MAX_LEN
+#define CIRCUITPY_TRANSLATE_CACHE_MAX_LEN (64)
+#endif
+
 // USB settings
 
 // Debug level for TinyUSB. Only outputs over debug UART so it doesn't cause
@@ -503,6 +659,12 @@ void background_callback_run_all(void);
 #define CIRCUITPY_DEBUG_TINYUSB 0
 #endif
 
+// The number of blocks written over USB mass storage that can be held in ram
+// and acknowledged before they reach the disk. 0 writes them synchronously.
+#ifndef CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS
+#define CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS (16)
+#endif
+
 #ifndef CIRCUITPY_USB_DEVICE_INSTANCE
 #define CIRCUITPY_USB_DEVICE_INSTANCE 0
 #endif
@@ -563,6 +725,22 @@ void background_callback_run_all(void);
 #error "CIRCUITPY_USB_HID_MAX_REPORT_IDS_PER_DESCRIPTOR must be at least 1"
 #endif
 
+// HID IN reports that can wait for the host to poll. All the HID devices share the queue.
+#ifndef CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH
+#define CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH (4)
+#elif CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH < 1 || CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH > 128 || \
+    (CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH & (CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH - 1)) != 0
+#error "CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH must be a power of 2, at most 128"
+#endif
+
+// USB MIDI event packets received and timestamped but not yet read.
+#ifndef CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH
+#define CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH (32)
+#elif CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH < 1 || CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH > 32768 || \
+    (CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH & (CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH - 1)) != 0
+#error "CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH must be a power of 2, at most 32768"
+#endif
+
 #ifndef CIRCUITPY_PORT_NUM_SUPERVISOR_ALLOCATIONS
 #define CIRCUITPY_PORT_NUM_SUPERVISOR_ALLOCATIONS (0)
 #endif
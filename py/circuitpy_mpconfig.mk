@@ -58,9 +58,19 @@ CFLAGS += -DMICROPY_PY_USELECT=$(MICROPY_PY_USELECT)
 MICROPY_PY_USELECT_SELECT ?= $(MICROPY_PY_USELECT)
 CFLAGS += -DMICROPY_PY_USELECT_SELECT=$(MICROPY_PY_USELECT_SELECT)
 
+# Mark the heap from the second core while the first marks from the stacks.
+# The raspberrypi and espressif (dual core chips only) ports provide the second core's side.
+MICROPY_GC_PARALLEL_MARK ?= 0
+CFLAGS += -DMICROPY_GC_PARALLEL_MARK=$(MICROPY_GC_PARALLEL_MARK)
+
 CIRCUITPY_AESIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_AESIO=$(CIRCUITPY_AESIO)
 
+# Run aesio on the port's mbedtls, which uses the AES peripheral where the chip has one,
+# instead of the built-in table implementation.
+CIRCUITPY_AESIO_MBEDTLS ?= 0
+CFLAGS += -DCIRCUITPY_AESIO_MBEDTLS=$(CIRCUITPY_AESIO_MBEDTLS)
+
 # TODO: CIRCUITPY_ALARM will gradually be added to as many ports as possible
 # so make this 1 or CIRCUITPY_FULL_BUILD eventually
 CIRCUITPY_ALARM ?= 0
@@ -75,6 +85,9 @@ CFLAGS += -DCIRCUITPY_ANALOGIO=$(CIRCUITPY_ANALOGIO)
 CIRCUITPY_ARRAY ?= 1
 CFLAGS += -DCIRCUITPY_ARRAY=$(CIRCUITPY_ARRAY)
 
+CIRCUITPY_ARRAYOPS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_ARRAYOPS=$(CIRCUITPY_ARRAYOPS)
+
 CIRCUITPY_ATEXIT ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ATEXIT=$(CIRCUITPY_ATEXIT)
 
@@ -89,6 +102,10 @@ CFLAGS += -DCIRCUITPY_AUDIOBUSIO_I2SOUT=$(CIRCUITPY_AUDIOBUSIO_I2SOUT)
 CIRCUITPY_AUDIOBUSIO_PDMIN ?= $(CIRCUITPY_AUDIOBUSIO)
 CFLAGS += -DCIRCUITPY_AUDIOBUSIO_PDMIN=$(CIRCUITPY_AUDIOBUSIO_PDMIN)
 
+# PDMIn can record continuously in the background and be played as an audio sample.
+CIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND ?= 0
+CFLAGS += -DCIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND=$(CIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND)
+
 CIRCUITPY_AUDIOIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_AUDIOIO=$(CIRCUITPY_AUDIOIO)
 
@@ -107,11 +124,24 @@ CFLAGS += -DCIRCUITPY_AUDIOCORE=$(CIRCUITPY_AUDIOCORE)
 CIRCUITPY_AUDIOMIXER ?= $(CIRCUITPY_AUDIOIO)
 CFLAGS += -DCIRCUITPY_AUDIOMIXER=$(CIRCUITPY_AUDIOMIXER)
 
+CIRCUITPY_AUDIOFX ?= $(CIRCUITPY_AUDIOMIXER)
+CFLAGS += -DCIRCUITPY_AUDIOFX=$(CIRCUITPY_AUDIOFX)
+
 ifndef CIRCUITPY_AUDIOCORE_DEBUG
 CIRCUITPY_AUDIOCORE_DEBUG ?= 0
 endif
 CFLAGS += -DCIRCUITPY_AUDIOCORE_DEBUG=$(CIRCUITPY_AUDIOCORE_DEBUG)
 
+# Audio outputs have buffer_count, underruns and late_fills. Only ports whose
+# audio DMA can queue more than two buffers implement these.
+CIRCUITPY_AUDIO_BUFFER_RING ?= 0
+CFLAGS += -DCIRCUITPY_AUDIO_BUFFER_RING=$(CIRCUITPY_AUDIO_BUFFER_RING)
+
+# CIRCUITPY_AUDIO_CORE1 renders audio blocks on the second core.
+# It is handled in the raspberrypi tree.
+CIRCUITPY_AUDIO_CORE1 ?= 0
+CFLAGS += -DCIRCUITPY_AUDIO_CORE1=$(CIRCUITPY_AUDIO_CORE1)
+
 ifndef CIRCUITPY_AUDIOMP3
 ifeq ($(CIRCUITPY_FULL_BUILD),1)
 CIRCUITPY_AUDIOMP3 = $(CIRCUITPY_AUDIOCORE)
@@ -121,6 +151,14 @@ endif
 endif
 CFLAGS += -DCIRCUITPY_AUDIOMP3=$(CIRCUITPY_AUDIOMP3)
 
+# Record how long each background callback function runs, for supervisor.background_callback_stats().
+CIRCUITPY_BACKGROUND_CALLBACK_STATS ?= 0
+CFLAGS += -DCIRCUITPY_BACKGROUND_CALLBACK_STATS=$(CIRCUITPY_BACKGROUND_CALLBACK_STATS)
+
+# CPU cycle counter and Timer for measuring firmware performance on the board itself.
+CIRCUITPY_BENCHMARK ?= 0
+CFLAGS += -DCIRCUITPY_BENCHMARK=$(CIRCUITPY_BENCHMARK)
+
 CIRCUITPY_BINASCII ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_BINASCII=$(CIRCUITPY_BINASCII)
 
@@ -165,6 +203,11 @@ CFLAGS += -DCIRCUITPY_BUSIO_SPI=$(CIRCUITPY_BUSIO_SPI)
 CIRCUITPY_BUSIO_UART ?= 1
 CFLAGS += -DCIRCUITPY_BUSIO_UART=$(CIRCUITPY_BUSIO_UART)
 
+# Set by ports whose busio.SPI can start a write and return before it completes. displayio uses it
+# to composite the next block of pixels while the previous one is sent.
+CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE ?= 0
+CFLAGS += -DCIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE=$(CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE)
+
 CIRCUITPY_CAMERA ?= 0
 CFLAGS += -DCIRCUITPY_CAMERA=$(CIRCUITPY_CAMERA)
 
@@ -174,6 +217,10 @@ CFLAGS += -DCIRCUITPY_CANIO=$(CIRCUITPY_CANIO)
 CIRCUITPY_COLLECTIONS ?= 1
 CFLAGS += -DCIRCUITPY_COLLECTIONS=$(CIRCUITPY_COLLECTIONS)
 
+# Cache compiled .py imports as .mpy files on the filesystem
+CIRCUITPY_COMPILE_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_COMPILE_CACHE=$(CIRCUITPY_COMPILE_CACHE)
+
 CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE ?= 0
 CFLAGS += -DCIRCUITPY_COMPUTED_GOTO_SAVE_SPACE=$(CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 
@@ -189,6 +236,11 @@ CFLAGS += -DCIRCUITPY_COPROC=$(CIRCUITPY_COPROC)
 CIRCUITPY_COUNTIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_COUNTIO=$(CIRCUITPY_COUNTIO)
 
+# Slow the CPU while the supervisor waits for an interrupt. Ports provide
+# port_set_cpu_performance(); supervisor.cpu_residency() reports the results.
+CIRCUITPY_CPU_GOVERNOR ?= 0
+CFLAGS += -DCIRCUITPY_CPU_GOVERNOR=$(CIRCUITPY_CPU_GOVERNOR)
+
 CIRCUITPY_DISPLAYIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_DISPLAYIO=$(CIRCUITPY_DISPLAYIO)
 
@@ -199,6 +251,11 @@ CIRCUITPY_PARALLELDISPLAY = 0
 endif
 CFLAGS += -DCIRCUITPY_PARALLELDISPLAY=$(CIRCUITPY_PARALLELDISPLAY)
 
+# CIRCUITPY_DISPLAYIO_CORE1 composites display refreshes on the second core.
+# It is handled in the raspberrypi tree.
+CIRCUITPY_DISPLAYIO_CORE1 ?= 0
+CFLAGS += -DCIRCUITPY_DISPLAYIO_CORE1=$(CIRCUITPY_DISPLAYIO_CORE1)
+
 # bitmaptools and framebufferio rely on displayio
 ifeq ($(CIRCUITPY_DISPLAYIO),1)
 CIRCUITPY_BITMAPTOOLS ?= $(CIRCUITPY_FULL_BUILD)
@@ -213,6 +270,7 @@ CFLAGS += -DCIRCUITPY_BITMAPTOOLS=$(CIRCUITPY_BITMAPTOOLS)
 CFLAGS += -DCIRCUITPY_FRAMEBUFFERIO=$(CIRCUITPY_FRAMEBUFFERIO)
 CFLAGS += -DCIRCUITPY_VECTORIO=$(CIRCUITPY_VECTORIO)
 
+# dualbank.Updater hashes images with the port's hashlib common-hal.
 CIRCUITPY_DUALBANK ?= 0
 CFLAGS += -DCIRCUITPY_DUALBANK=$(CIRCUITPY_DUALBANK)
 
@@ -220,6 +278,13 @@ CFLAGS += -DCIRCUITPY_DUALBANK=$(CIRCUITPY_DUALBANK)
 CIRCUITPY_ENABLE_MPY_NATIVE ?= 0
 CFLAGS += -DCIRCUITPY_ENABLE_MPY_NATIVE=$(CIRCUITPY_ENABLE_MPY_NATIVE)
 
+# The @micropython.native and @micropython.viper emitters for the CPU the build
+# targets, plus loading native code from .mpy files. CIRCUITPY_ENABLE_MPY_NATIVE
+# is the older name for this. Off by default: on espressif and mimxrt10xx it
+# relaxes memory protection so that code can be written to executable RAM.
+CIRCUITPY_NATIVE_EMITTERS ?= $(CIRCUITPY_ENABLE_MPY_NATIVE)
+CFLAGS += -DCIRCUITPY_NATIVE_EMITTERS=$(CIRCUITPY_NATIVE_EMITTERS)
+
 CIRCUITPY_OS_GETENV ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OS_GETENV=$(CIRCUITPY_OS_GETENV)
 
@@ -285,6 +350,13 @@ CFLAGS += -DCIRCUITPY_IPADDRESS=$(CIRCUITPY_IPADDRESS)
 CIRCUITPY_IS31FL3741 ?= 0
 CFLAGS += -DCIRCUITPY_IS31FL3741=$(CIRCUITPY_IS31FL3741)
 
+ifeq ($(CIRCUITPY_DISPLAYIO),1)
+CIRCUITPY_JPEGIO ?= $(CIRCUITPY_FULL_BUILD)
+else
+CIRCUITPY_JPEGIO ?= 0
+endif
+CFLAGS += -DCIRCUITPY_JPEGIO=$(CIRCUITPY_JPEGIO)
+
 CIRCUITPY_JSON ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_JSON=$(CIRCUITPY_JSON)
 
@@ -321,6 +393,10 @@ CFLAGS += -DCIRCUITPY_MSGPACK=$(CIRCUITPY_MSGPACK)
 CIRCUITPY_NEOPIXEL_WRITE ?= 1
 CFLAGS += -DCIRCUITPY_NEOPIXEL_WRITE=$(CIRCUITPY_NEOPIXEL_WRITE)
 
+# Set by ports that can send neopixel_write(..., background=True) while the VM keeps running.
+CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND ?= 0
+CFLAGS += -DCIRCUITPY_NEOPIXEL_WRITE_BACKGROUND=$(CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND)
+
 CIRCUITPY_NVM ?= 1
 CFLAGS += -DCIRCUITPY_NVM=$(CIRCUITPY_NVM)
 
@@ -330,15 +406,43 @@ CFLAGS += -DCIRCUITPY_ONEWIREIO=$(CIRCUITPY_ONEWIREIO)
 CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH ?= 1
 CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 
+CIRCUITPY_OPT_LOAD_GLOBAL_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_LOAD_GLOBAL_CACHE=$(CIRCUITPY_OPT_LOAD_GLOBAL_CACHE)
+
+CIRCUITPY_OPT_LOAD_METHOD_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_LOAD_METHOD_CACHE=$(CIRCUITPY_OPT_LOAD_METHOD_CACHE)
+
+CIRCUITPY_OPT_SUPERINSTRUCTIONS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_SUPERINSTRUCTIONS=$(CIRCUITPY_OPT_SUPERINSTRUCTIONS)
+ifeq ($(CIRCUITPY_OPT_SUPERINSTRUCTIONS),1)
+MPY_CROSS_FLAGS += -msuperinstructions
+endif
+
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+# Hash index for large OrderedDicts
+CIRCUITPY_OPT_MAP_ORDERED_INDEX ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_MAP_ORDERED_INDEX=$(CIRCUITPY_OPT_MAP_ORDERED_INDEX)
+
+# Hash index for qstrs interned at runtime
+CIRCUITPY_OPT_QSTR_INDEX ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_QSTR_INDEX=$(CIRCUITPY_OPT_QSTR_INDEX)
+
+# Small int binary operations done inline in the VM
+CIRCUITPY_OPT_VM_SMALL_INT_BINARY_OP ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_VM_SMALL_INT_BINARY_OP=$(CIRCUITPY_OPT_VM_SMALL_INT_BINARY_OP)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
 CIRCUITPY_PEW ?= 0
 CFLAGS += -DCIRCUITPY_PEW=$(CIRCUITPY_PEW)
 
+# Load functions in imported .mpy files when they are first called
+CIRCUITPY_PERSISTENT_CODE_LOAD_LAZY ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_PERSISTENT_CODE_LOAD_LAZY=$(CIRCUITPY_PERSISTENT_CODE_LOAD_LAZY)
+
 # CIRCUITPY_PICODVI is handled in the raspberrypi tree.
 # Only for RP2 chips. Assume not a raspberrypi build.
 CIRCUITPY_PICODVI ?= 0
@@ -350,6 +454,10 @@ CFLAGS += -DCIRCUITPY_PIXELBUF=$(CIRCUITPY_PIXELBUF)
 CIRCUITPY_PIXELMAP ?= $(CIRCUITPY_PIXELBUF)
 CFLAGS += -DCIRCUITPY_PIXELMAP=$(CIRCUITPY_PIXELMAP)
 
+# Record how long the supervisor spends idle and asleep, for supervisor.power_stats().
+CIRCUITPY_POWER_STATS ?= 0
+CFLAGS += -DCIRCUITPY_POWER_STATS=$(CIRCUITPY_POWER_STATS)
+
 # Only for SAMD boards for the moment
 CIRCUITPY_PS2IO ?= 0
 CFLAGS += -DCIRCUITPY_PS2IO=$(CIRCUITPY_PS2IO)
@@ -441,18 +549,42 @@ CFLAGS += -DCIRCUITPY_STAGE=$(CIRCUITPY_STAGE)
 CIRCUITPY_STATUS_BAR ?= 1
 CFLAGS += -DCIRCUITPY_STATUS_BAR=$(CIRCUITPY_STATUS_BAR)
 
+# Show the collection count and longest pause on the status bar. Needs MICROPY_GC_STATS.
+CIRCUITPY_STATUS_BAR_GC_STATS ?= 0
+CFLAGS += -DCIRCUITPY_STATUS_BAR_GC_STATS=$(CIRCUITPY_STATUS_BAR_GC_STATS)
+
 CIRCUITPY_STORAGE ?= 1
 CFLAGS += -DCIRCUITPY_STORAGE=$(CIRCUITPY_STORAGE)
 
 CIRCUITPY_STORAGE_EXTEND ?= $(CIRCUITPY_DUALBANK)
 CFLAGS += -DCIRCUITPY_STORAGE_EXTEND=$(CIRCUITPY_STORAGE_EXTEND)
 
+# Offer storage.VfsLfs, a LittleFS v2 filesystem for block devices such as SD cards.
+# CIRCUITPY itself stays FAT.
+CIRCUITPY_STORAGE_LFS ?= 0
+CFLAGS += -DCIRCUITPY_STORAGE_LFS=$(CIRCUITPY_STORAGE_LFS)
+MICROPY_VFS_LFS2 ?= $(CIRCUITPY_STORAGE_LFS)
+
+# Offer storage.mmap(), which maps contiguous files on a memory-mapped CIRCUITPY
+# drive. The port provides supervisor_flash_get_block_address().
+CIRCUITPY_STORAGE_MMAP ?= 0
+CFLAGS += -DCIRCUITPY_STORAGE_MMAP=$(CIRCUITPY_STORAGE_MMAP)
+
+# Offer storage.stats(): operation counts and latency histograms for FAT
+# volumes and the CIRCUITPY flash. Costs a timer read around each block operation.
+CIRCUITPY_STORAGE_STATS ?= 0
+CFLAGS += -DCIRCUITPY_STORAGE_STATS=$(CIRCUITPY_STORAGE_STATS)
+
 CIRCUITPY_STRUCT ?= 1
 CFLAGS += -DCIRCUITPY_STRUCT=$(CIRCUITPY_STRUCT)
 
 CIRCUITPY_SUPERVISOR ?= 1
 CFLAGS += -DCIRCUITPY_SUPERVISOR=$(CIRCUITPY_SUPERVISOR)
 
+# Report free supervisor memory and fragmentation, for supervisor.memory_info().
+CIRCUITPY_SUPERVISOR_MEMORY_INFO ?= 0
+CFLAGS += -DCIRCUITPY_SUPERVISOR_MEMORY_INFO=$(CIRCUITPY_SUPERVISOR_MEMORY_INFO)
+
 CIRCUITPY_SYNTHIO ?= $(CIRCUITPY_AUDIOCORE)
 CFLAGS += -DCIRCUITPY_SYNTHIO=$(CIRCUITPY_SYNTHIO)
 
@@ -481,6 +613,15 @@ CFLAGS += -DCIRCUITPY_TOUCHIO_USE_NATIVE=$(CIRCUITPY_TOUCHIO_USE_NATIVE)
 CIRCUITPY_TOUCHIO ?= 1
 CFLAGS += -DCIRCUITPY_TOUCHIO=$(CIRCUITPY_TOUCHIO)
 
+# Sample the running Python code for supervisor.profile_start() and
+# supervisor.profile_stop(). Slows down every function call slightly.
+CIRCUITPY_PROFILE ?= 0
+CFLAGS += -DCIRCUITPY_PROFILE=$(CIRCUITPY_PROFILE)
+
+# Record background task timings for supervisor.trace(). For debugging.
+CIRCUITPY_TRACE ?= 0
+CFLAGS += -DCIRCUITPY_TRACE=$(CIRCUITPY_TRACE)
+
 CIRCUITPY_TRACEBACK ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_TRACEBACK=$(CIRCUITPY_TRACEBACK)
 
@@ -520,6 +661,10 @@ CFLAGS += -DCIRCUITPY_USB_HID_ENABLED_DEFAULT=$(CIRCUITPY_USB_HID_ENABLED_DEFAUL
 CIRCUITPY_USB_HOST ?= 0
 CFLAGS += -DCIRCUITPY_USB_HOST=$(CIRCUITPY_USB_HOST)
 
+# Use keyboards attached to the USB host port as serial console input.
+CIRCUITPY_USB_KEYBOARD_WORKFLOW ?= $(CIRCUITPY_USB_HOST)
+CFLAGS += -DCIRCUITPY_USB_KEYBOARD_WORKFLOW=$(CIRCUITPY_USB_KEYBOARD_WORKFLOW)
+
 CIRCUITPY_USB_IDENTIFICATION ?= $(CIRCUITPY_USB)
 CFLAGS += -DCIRCUITPY_USB_IDENTIFICATION=$(CIRCUITPY_USB_IDENTIFICATION)
 
@@ -623,8 +768,24 @@ $(BUILD)/frozen_mpy: $(FROZEN_MPY_DIRS)
 	$(Q)$(MKDIR) -p $@
 	$(Q)$(PREPROCESS_FROZEN_MODULES) -o $@ $(FROZEN_MPY_DIRS)
 
+# Modules or packages in FROZEN_MPY_NATIVE and FROZEN_MPY_VIPER are paths
+# relative to the frozen library directories, eg neopixel.py or
+# adafruit_display_text. They are frozen as machine code for the port's
+# MPY_CROSS_NATIVE_ARCH instead of as bytecode.
+ifneq ($(FROZEN_MPY_NATIVE)$(FROZEN_MPY_VIPER),)
+ifneq ($(CIRCUITPY_NATIVE_EMITTERS),1)
+$(error FROZEN_MPY_NATIVE and FROZEN_MPY_VIPER need CIRCUITPY_NATIVE_EMITTERS = 1)
+endif
+ifeq ($(MPY_CROSS_NATIVE_ARCH),)
+$(error FROZEN_MPY_NATIVE and FROZEN_MPY_VIPER need MPY_CROSS_NATIVE_ARCH to be set)
+endif
+endif
+
 $(BUILD)/manifest.py: $(BUILD)/frozen_mpy | $(TOP)/py/circuitpy_mpconfig.mk mpconfigport.mk boards/$(BOARD)/mpconfigboard.mk
 	$(ECHO) MKMANIFEST $(FROZEN_MPY_DIRS)
-	(cd $(BUILD)/frozen_mpy && find * -name \*.py -exec printf 'freeze_as_mpy("frozen_mpy", "%s")\n' {} \; )> $@.tmp && mv -f $@.tmp $@
+	(cd $(BUILD)/frozen_mpy && find * -name \*.py -exec printf 'freeze_as_mpy("frozen_mpy", "%s")\n' {} \; \
+		$(if $(FROZEN_MPY_NATIVE),&& printf 'freeze_as_mpy("frozen_mpy", "%s", native=True)\n' $(FROZEN_MPY_NATIVE)) \
+		$(if $(FROZEN_MPY_VIPER),&& printf 'freeze_as_mpy("frozen_mpy", "%s", viper=True)\n' $(FROZEN_MPY_VIPER)) \
+		)> $@.tmp && mv -f $@.tmp $@
 FROZEN_MANIFEST=$(BUILD)/manifest.py
 endif
@@ -104,6 +104,7 @@ STATIC const emit_method_table_t *emit_native_table[] = {
     &emit_native_thumb_method_table,
     &emit_native_xtensa_method_table,
     &emit_native_xtensawin_method_table,
+    &emit_native_rv32_method_table,
 };
 
 #elif MICROPY_EMIT_NATIVE
@@ -120,6 +121,8 @@ STATIC const emit_method_table_t *emit_native_table[] = {
 #define NATIVE_EMITTER(f) emit_native_xtensa_##f
 #elif MICROPY_EMIT_XTENSAWIN
 #define NATIVE_EMITTER(f) emit_native_xtensawin_##f
+#elif MICROPY_EMIT_RV32
+#define NATIVE_EMITTER(f) emit_native_rv32_##f
 #else
 #error "unknown native emitter"
 #endif
@@ -162,6 +165,21 @@ STATIC const emit_inline_asm_method_table_t *emit_asm_table[] = {
 #define EMIT_INLINE_ASM(fun) (comp->emit_inline_asm_method_table->fun(comp->emit_inline_asm))
 #define EMIT_INLINE_ASM_ARG(fun, ...) (comp->emit_inline_asm_method_table->fun(comp->emit_inline_asm, __VA_ARGS__))
 
+#if MICROPY_COMP_GLOBAL_CONST
+// A top-level name that -O2 may optimise: a constant that loads can be
+// replaced with, or a private function that may be left out if unused.
+typedef enum { OPT_GLOBAL_CONST, OPT_GLOBAL_FUNC } opt_global_kind_t;
+
+typedef struct _compile_opt_global_t {
+    qstr qst;
+    uint8_t kind; // holds enum type opt_global_kind_t
+    uint8_t num_stores; // saturates at 2, only whether it is 1 matters
+    uint8_t loaded;
+    uint8_t assigned_pass; // pass in which the module assigned the constant
+    mp_parse_node_struct_t *pns; // the top-level statement defining the name
+} compile_opt_global_t;
+#endif
+
 // elements in this struct are ordered to make it compact
 typedef struct _compiler_t {
     qstr source_file;
@@ -169,6 +187,14 @@ typedef struct _compiler_t {
     uint8_t is_repl;
     uint8_t pass; // holds enum type pass_kind_t
     uint8_t have_star;
+    uint8_t range_assigned; // the name range is assigned or deleted somewhere in the module
+    #if MICROPY_COMP_GLOBAL_CONST
+    uint8_t optimise_globals; // -O2: propagate module constants, drop unused private functions
+    uint8_t globals_dynamic; // the module can rebind globals behind the compiler's back
+    uint16_t opt_globals_alloc;
+    uint16_t opt_globals_len;
+    compile_opt_global_t *opt_globals;
+    #endif
 
     // try to keep compiler clean from nlr
     mp_obj_t compile_error; // set to an exception object if there's an error
@@ -196,6 +222,12 @@ typedef struct _compiler_t {
     emit_inline_asm_t *emit_inline_asm;                                   // current emitter for inline asm
     const emit_inline_asm_method_table_t *emit_inline_asm_method_table;   // current emit method table for inline asm
     #endif
+
+    #if MICROPY_COMP_INCREMENTAL
+    scope_t *early_scope_head; // top-level functions and classes compiled while parsing
+    scope_t *early_scope_tail;
+    scope_t *early_scope_next; // next one to be claimed by the module's MP_PASS_SCOPE
+    #endif
 } compiler_t;
 
 STATIC void compile_error_set_line(compiler_t *comp, mp_parse_node_t pn) {
@@ -289,10 +321,180 @@ STATIC void compile_generic_all_nodes(compiler_t *comp, mp_parse_node_struct_t *
     }
 }
 
+#if MICROPY_COMP_GLOBAL_CONST
+
+// A name is taken to be a constant if, like the names given to const(), it is
+// written in capitals: it has an upper case letter and no lower case ones.
+STATIC bool compile_is_const_name(qstr qst) {
+    size_t len;
+    const byte *str = qstr_data(qst, &len);
+    bool has_upper = false;
+    for (size_t i = 0; i < len; ++i) {
+        if (unichar_islower(str[i])) {
+            return false;
+        }
+        has_upper |= unichar_isupper(str[i]);
+    }
+    return has_upper;
+}
+
+STATIC bool compile_is_private_name(qstr qst) {
+    const char *str = qstr_str(qst);
+    return str[0] == '_' && str[1] != '_';
+}
+
+STATIC bool compile_is_literal(mp_parse_node_t pn) {
+    return (MP_PARSE_NODE_IS_LEAF(pn) && !MP_PARSE_NODE_IS_ID(pn))
+           || MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_const_object);
+}
+
+STATIC bool compile_funcdef_has_defaults(mp_parse_node_struct_t *pns) {
+    mp_parse_node_t *nodes;
+    size_t n = mp_parse_node_extract_list(&pns->nodes[1], PN_typedargslist, &nodes);
+    for (size_t i = 0; i < n; i++) {
+        if (MP_PARSE_NODE_IS_STRUCT_KIND(nodes[i], PN_typedargslist_name)
+            && !MP_PARSE_NODE_IS_NULL(((mp_parse_node_struct_t *)nodes[i])->nodes[2])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Collect the top-level statements of the module that -O2 may optimise:
+//   NAME = <literal>           with NAME in capitals
+//   def _name(<no defaults>):  undecorated
+// Whether they are actually optimised depends on the rest of the module, which
+// is counted during MP_PASS_SCOPE.
+STATIC void compile_find_opt_globals(compiler_t *comp, mp_parse_node_t pn) {
+    mp_parse_node_t *nodes;
+    size_t n = mp_parse_node_extract_list(&pn, PN_file_input_2, &nodes);
+    comp->opt_globals = m_new(compile_opt_global_t, n);
+    comp->opt_globals_alloc = n;
+    for (size_t i = 0; i < n; i++) {
+        if (!MP_PARSE_NODE_IS_STRUCT(nodes[i])) {
+            continue;
+        }
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)nodes[i];
+        compile_opt_global_t g = { .pns = pns };
+        if (MP_PARSE_NODE_STRUCT_KIND(pns) == PN_expr_stmt
+            && MP_PARSE_NODE_IS_ID(pns->nodes[0])
+            && compile_is_literal(pns->nodes[1])
+            && compile_is_const_name(MP_PARSE_NODE_LEAF_ARG(pns->nodes[0]))) {
+            g.qst = MP_PARSE_NODE_LEAF_ARG(pns->nodes[0]);
+            g.kind = OPT_GLOBAL_CONST;
+        } else if (MP_PARSE_NODE_STRUCT_KIND(pns) == PN_funcdef
+                   && compile_is_private_name(MP_PARSE_NODE_LEAF_ARG(pns->nodes[0]))
+                   && !compile_funcdef_has_defaults(pns)) {
+            g.qst = MP_PARSE_NODE_LEAF_ARG(pns->nodes[0]);
+            g.kind = OPT_GLOBAL_FUNC;
+        } else {
+            continue;
+        }
+        size_t j = 0;
+        while (j < comp->opt_globals_len && comp->opt_globals[j].qst != g.qst) {
+            ++j;
+        }
+        if (j == comp->opt_globals_len) {
+            comp->opt_globals[comp->opt_globals_len++] = g;
+        }
+    }
+}
+
+STATIC compile_opt_global_t *compile_get_opt_global(compiler_t *comp, qstr qst) {
+    for (size_t i = 0; i < comp->opt_globals_len; ++i) {
+        if (comp->opt_globals[i].qst == qst) {
+            return &comp->opt_globals[i];
+        }
+    }
+    return NULL;
+}
+
+// Return the opt global for the name if it qualifies for optimisation: it is
+// assigned exactly once (and, for a function, never loaded) in the module.
+// Only valid after MP_PASS_SCOPE.
+STATIC compile_opt_global_t *compile_get_opt_global_qualified(compiler_t *comp, qstr qst) {
+    if (comp->pass == MP_PASS_SCOPE || comp->globals_dynamic) {
+        return NULL;
+    }
+    compile_opt_global_t *g = compile_get_opt_global(comp, qst);
+    if (g == NULL || g->num_stores != 1 || (g->kind == OPT_GLOBAL_FUNC && g->loaded)) {
+        return NULL;
+    }
+    return g;
+}
+
+STATIC void compile_count_opt_global(compiler_t *comp, qstr qst, bool is_store) {
+    compile_opt_global_t *g = compile_get_opt_global(comp, qst);
+    if (g != NULL) {
+        if (is_store) {
+            g->num_stores = MIN(g->num_stores + 1, 2);
+        } else {
+            g->loaded = true;
+        }
+    }
+}
+
+// Return the literal that a load of the given name can be replaced with, or
+// MP_PARSE_NODE_NULL if the name must be looked up when the code runs.
+STATIC mp_parse_node_t compile_opt_global_value(compiler_t *comp, qstr qst) {
+    compile_opt_global_t *g = compile_get_opt_global_qualified(comp, qst);
+    if (g == NULL || g->kind != OPT_GLOBAL_CONST) {
+        return MP_PARSE_NODE_NULL;
+    }
+    // at the top level the constant only exists once its assignment has run
+    if (comp->scope_cur->kind == SCOPE_MODULE && g->assigned_pass != comp->pass) {
+        return MP_PARSE_NODE_NULL;
+    }
+    // the name must not be shadowed by a local or parameter
+    id_info_t *id = scope_find(comp->scope_cur, qst);
+    if (id != NULL && id->kind != ID_INFO_KIND_GLOBAL_IMPLICIT && id->kind != ID_INFO_KIND_GLOBAL_EXPLICIT) {
+        return MP_PARSE_NODE_NULL;
+    }
+    return g->pns->nodes[1];
+}
+
+#endif // MICROPY_COMP_GLOBAL_CONST
+
+// Fold a condition made of a module constant, or "not" of one, to its value
+// so that the branch it guards can be compiled out.
+STATIC mp_parse_node_t compile_fold_cond(compiler_t *comp, mp_parse_node_t pn) {
+    #if MICROPY_COMP_GLOBAL_CONST
+    if (MP_PARSE_NODE_IS_ID(pn)) {
+        mp_parse_node_t value = compile_opt_global_value(comp, MP_PARSE_NODE_LEAF_ARG(pn));
+        if (value != MP_PARSE_NODE_NULL) {
+            return value;
+        }
+    } else if (MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_not_test_2)) {
+        mp_parse_node_t arg = compile_fold_cond(comp, ((mp_parse_node_struct_t *)pn)->nodes[0]);
+        if (mp_parse_node_is_const_false(arg)) {
+            return mp_parse_node_new_leaf(MP_PARSE_NODE_TOKEN, MP_TOKEN_KW_TRUE);
+        } else if (mp_parse_node_is_const_true(arg)) {
+            return mp_parse_node_new_leaf(MP_PARSE_NODE_TOKEN, MP_TOKEN_KW_FALSE);
+        }
+    }
+    #else
+    (void)comp;
+    #endif
+    return pn;
+}
+
 STATIC void compile_load_id(compiler_t *comp, qstr qst) {
     if (comp->pass == MP_PASS_SCOPE) {
+        #if MICROPY_COMP_GLOBAL_CONST
+        if (comp->optimise_globals) {
+            comp->globals_dynamic |= qst == MP_QSTR_globals || qst == MP_QSTR_exec || qst == MP_QSTR_eval;
+            compile_count_opt_global(comp, qst, false);
+        }
+        #endif
         mp_emit_common_get_id_for_load(comp->scope_cur, qst);
     } else {
+        #if MICROPY_COMP_GLOBAL_CONST
+        mp_parse_node_t value = compile_opt_global_value(comp, qst);
+        if (value != MP_PARSE_NODE_NULL) {
+            compile_node(comp, value);
+            return;
+        }
+        #endif
         #if NEED_METHOD_TABLE
         mp_emit_common_id_op(comp->emit, &comp->emit_method_table->load_id, comp->scope_cur, qst);
         #else
@@ -303,6 +505,10 @@ STATIC void compile_load_id(compiler_t *comp, qstr qst) {
 
 STATIC void compile_store_id(compiler_t *comp, qstr qst) {
     if (comp->pass == MP_PASS_SCOPE) {
+        comp->range_assigned |= qst == MP_QSTR_range;
+        #if MICROPY_COMP_GLOBAL_CONST
+        compile_count_opt_global(comp, qst, true);
+        #endif
         mp_emit_common_get_id_for_modification(comp->scope_cur, qst);
     } else {
         #if NEED_METHOD_TABLE
@@ -315,6 +521,10 @@ STATIC void compile_store_id(compiler_t *comp, qstr qst) {
 
 STATIC void compile_delete_id(compiler_t *comp, qstr qst) {
     if (comp->pass == MP_PASS_SCOPE) {
+        comp->range_assigned |= qst == MP_QSTR_range;
+        #if MICROPY_COMP_GLOBAL_CONST
+        compile_count_opt_global(comp, qst, true);
+        #endif
         mp_emit_common_get_id_for_modification(comp->scope_cur, qst);
     } else {
         #if NEED_METHOD_TABLE
@@ -335,6 +545,7 @@ STATIC void compile_generic_tuple(compiler_t *comp, mp_parse_node_struct_t *pns)
 }
 
 STATIC void c_if_cond(compiler_t *comp, mp_parse_node_t pn, bool jump_if, int label) {
+    pn = compile_fold_cond(comp, pn);
     if (mp_parse_node_is_const_false(pn)) {
         if (jump_if == false) {
             EMIT_ARG(jump, label);
@@ -733,14 +944,32 @@ STATIC void compile_funcdef_lambdef(compiler_t *comp, scope_t *scope, mp_parse_n
     comp->num_default_params = orig_num_default_params;
 }
 
+#if MICROPY_COMP_INCREMENTAL
+STATIC scope_t *compile_claim_early_scope(compiler_t *comp) {
+    // early scopes are claimed in the same order that they were compiled
+    scope_t *s = comp->early_scope_next;
+    assert(s != NULL);
+    comp->early_scope_next = s->next;
+    return s;
+}
+#endif
+
 // leaves function object on stack
 // returns function name
 STATIC qstr compile_funcdef_helper(compiler_t *comp, mp_parse_node_struct_t *pns, uint emit_options) {
     if (comp->pass == MP_PASS_SCOPE) {
-        // create a new scope for this function
-        scope_t *s = scope_new_and_link(comp, SCOPE_FUNCTION, (mp_parse_node_t)pns, emit_options);
-        // store the function scope so the compiling function can use it at each pass
-        pns->nodes[4] = (mp_parse_node_t)s;
+        #if MICROPY_COMP_INCREMENTAL
+        if (MP_PARSE_NODE_IS_NULL(pns->nodes[3])) {
+            // the body was compiled while parsing, so use that scope
+            pns->nodes[4] = (mp_parse_node_t)compile_claim_early_scope(comp);
+        } else
+        #endif
+        {
+            // create a new scope for this function
+            scope_t *s = scope_new_and_link(comp, SCOPE_FUNCTION, (mp_parse_node_t)pns, emit_options);
+            // store the function scope so the compiling function can use it at each pass
+            pns->nodes[4] = (mp_parse_node_t)s;
+        }
     }
 
     // get the scope for this function
@@ -757,10 +986,18 @@ STATIC qstr compile_funcdef_helper(compiler_t *comp, mp_parse_node_struct_t *pns
 // returns class name
 STATIC qstr compile_classdef_helper(compiler_t *comp, mp_parse_node_struct_t *pns, uint emit_options) {
     if (comp->pass == MP_PASS_SCOPE) {
-        // create a new scope for this class
-        scope_t *s = scope_new_and_link(comp, SCOPE_CLASS, (mp_parse_node_t)pns, emit_options);
-        // store the class scope so the compiling function can use it at each pass
-        pns->nodes[3] = (mp_parse_node_t)s;
+        #if MICROPY_COMP_INCREMENTAL
+        if (MP_PARSE_NODE_IS_NULL(pns->nodes[2])) {
+            // the body was compiled while parsing, so use that scope
+            pns->nodes[3] = (mp_parse_node_t)compile_claim_early_scope(comp);
+        } else
+        #endif
+        {
+            // create a new scope for this class
+            scope_t *s = scope_new_and_link(comp, SCOPE_CLASS, (mp_parse_node_t)pns, emit_options);
+            // store the class scope so the compiling function can use it at each pass
+            pns->nodes[3] = (mp_parse_node_t)s;
+        }
     }
 
     EMIT(load_build_class);
@@ -913,6 +1150,13 @@ STATIC void compile_decorated(compiler_t *comp, mp_parse_node_struct_t *pns) {
 }
 
 STATIC void compile_funcdef(compiler_t *comp, mp_parse_node_struct_t *pns) {
+    #if MICROPY_COMP_GLOBAL_CONST
+    // optimisation: leave out a private top-level function that is never used
+    compile_opt_global_t *g = compile_get_opt_global_qualified(comp, MP_PARSE_NODE_LEAF_ARG(pns->nodes[0]));
+    if (g != NULL && g->pns == pns) {
+        return;
+    }
+    #endif
     qstr fname = compile_funcdef_helper(comp, pns, comp->scope_cur->emit_options);
     // store function object into function name
     compile_store_id(comp, fname);
@@ -1170,6 +1414,9 @@ STATIC void compile_import_from(compiler_t *comp, mp_parse_node_struct_t *pns) {
         // do the import
         qstr dummy_q;
         do_import_name(comp, pn_import_source, &dummy_q);
+        #if MICROPY_COMP_GLOBAL_CONST
+        comp->globals_dynamic = true;
+        #endif
         EMIT_ARG(import, MP_QSTRnull, MP_EMIT_IMPORT_STAR);
 
     } else {
@@ -1275,14 +1522,15 @@ STATIC void compile_if_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
     uint l_end = comp_next_label(comp);
 
     // optimisation: don't emit anything when "if False"
-    if (!mp_parse_node_is_const_false(pns->nodes[0])) {
+    mp_parse_node_t pn_cond = compile_fold_cond(comp, pns->nodes[0]);
+    if (!mp_parse_node_is_const_false(pn_cond)) {
         uint l_fail = comp_next_label(comp);
-        c_if_cond(comp, pns->nodes[0], false, l_fail); // if condition
+        c_if_cond(comp, pn_cond, false, l_fail); // if condition
 
         compile_node(comp, pns->nodes[1]); // if block
 
         // optimisation: skip everything else when "if True"
-        if (mp_parse_node_is_const_true(pns->nodes[0])) {
+        if (mp_parse_node_is_const_true(pn_cond)) {
             goto done;
         }
 
@@ -1307,14 +1555,15 @@ STATIC void compile_if_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
         mp_parse_node_struct_t *pns_elif = (mp_parse_node_struct_t *)pn_elif[i];
 
         // optimisation: don't emit anything when "if False"
-        if (!mp_parse_node_is_const_false(pns_elif->nodes[0])) {
+        pn_cond = compile_fold_cond(comp, pns_elif->nodes[0]);
+        if (!mp_parse_node_is_const_false(pn_cond)) {
             uint l_fail = comp_next_label(comp);
-            c_if_cond(comp, pns_elif->nodes[0], false, l_fail); // elif condition
+            c_if_cond(comp, pn_cond, false, l_fail); // elif condition
 
             compile_node(comp, pns_elif->nodes[1]); // elif block
 
             // optimisation: skip everything else when "elif True"
-            if (mp_parse_node_is_const_true(pns_elif->nodes[0])) {
+            if (mp_parse_node_is_const_true(pn_cond)) {
                 goto done;
             }
 
@@ -1351,15 +1600,16 @@ done:
 STATIC void compile_while_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
     START_BREAK_CONTINUE_BLOCK
 
-    if (!mp_parse_node_is_const_false(pns->nodes[0])) { // optimisation: don't emit anything for "while False"
+    mp_parse_node_t pn_cond = compile_fold_cond(comp, pns->nodes[0]);
+    if (!mp_parse_node_is_const_false(pn_cond)) { // optimisation: don't emit anything for "while False"
         uint top_label = comp_next_label(comp);
-        if (!mp_parse_node_is_const_true(pns->nodes[0])) { // optimisation: don't jump to cond for "while True"
+        if (!mp_parse_node_is_const_true(pn_cond)) { // optimisation: don't jump to cond for "while True"
             EMIT_ARG(jump, continue_label);
         }
         EMIT_ARG(label_assign, top_label);
         compile_node(comp, pns->nodes[1]); // body
         EMIT_ARG(label_assign, continue_label);
-        c_if_cond(comp, pns->nodes[0], true, top_label); // condition
+        c_if_cond(comp, pn_cond, true, top_label); // condition
     }
 
     // break/continue apply to outer loop (if any) in the else block
@@ -1468,6 +1718,18 @@ STATIC void compile_for_stmt_optimised_range(compiler_t *comp, mp_parse_node_t p
     }
 }
 
+// Whether range in the current scope must be the builtin: it is not assigned in
+// the module, nor is it a parameter here or in an enclosing function.  Only valid
+// after MP_PASS_SCOPE.  When compiling incrementally, code with a range loop is
+// left to the module's passes, so every assignment in the module is known.
+STATIC bool compile_range_is_builtin(compiler_t *comp) {
+    if (comp->range_assigned) {
+        return false;
+    }
+    id_info_t *id = scope_find(comp->scope_cur, MP_QSTR_range);
+    return id == NULL || id->kind == ID_INFO_KIND_GLOBAL_IMPLICIT || id->kind == ID_INFO_KIND_GLOBAL_EXPLICIT;
+}
+
 STATIC void compile_for_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
     // this bit optimises: for <x> in range(...), turning it into an explicitly incremented variable
     // this is actually slower, but uses no heap memory
@@ -1518,6 +1780,16 @@ STATIC void compile_for_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
                     }
                 }
             }
+            // range must not be shadowed.  MP_PASS_SCOPE records the use of the name, so
+            // that a parameter of an enclosing function called range is closed over, and
+            // it takes the optimised path, which needs more labels than the generic one.
+            if (optimize) {
+                if (comp->pass == MP_PASS_SCOPE) {
+                    compile_load_id(comp, MP_QSTR_range);
+                } else {
+                    optimize = compile_range_is_builtin(comp);
+                }
+            }
             if (optimize) {
                 compile_for_stmt_optimised_range(comp, pns->nodes[0], pn_range_start, pn_range_end, pn_range_step, pns->nodes[2], pns->nodes[3]);
                 return;
@@ -1946,6 +2218,18 @@ STATIC void compile_async_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
 #endif
 
 STATIC void compile_expr_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
+    #if MICROPY_COMP_GLOBAL_CONST
+    if (MP_PARSE_NODE_IS_ID(pns->nodes[0])) {
+        compile_opt_global_t *g = compile_get_opt_global_qualified(comp, MP_PARSE_NODE_LEAF_ARG(pns->nodes[0]));
+        if (g != NULL && g->pns == pns) {
+            g->assigned_pass = comp->pass;
+            // optimisation: like _NAME = const(value), a private constant needs no global
+            if (compile_is_private_name(g->qst)) {
+                return;
+            }
+        }
+    }
+    #endif
     mp_parse_node_t pn_rhs = pns->nodes[1];
     if (MP_PARSE_NODE_IS_NULL(pn_rhs)) {
         if (comp->is_repl && comp->scope_cur->kind == SCOPE_MODULE) {
@@ -3022,6 +3306,11 @@ STATIC void compile_scope(compiler_t *comp, scope_t *scope, pass_kind_t pass) {
         if (!comp->is_repl) {
             check_for_doc_string(comp, scope->pn);
         }
+        #if MICROPY_COMP_GLOBAL_CONST
+        if (comp->pass == MP_PASS_SCOPE && comp->optimise_globals) {
+            compile_find_opt_globals(comp, scope->pn);
+        }
+        #endif
         compile_node(comp, scope->pn);
         EMIT_ARG(load_const_tok, MP_TOKEN_KW_NONE);
         EMIT(return_value);
@@ -3429,14 +3718,7 @@ STATIC void scope_compute_things(scope_t *scope) {
     }
 }
 
-#if !MICROPY_PERSISTENT_CODE_SAVE
-STATIC
-#endif
-mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl) {
-    // put compiler state on the stack, it's relatively small
-    compiler_t comp_state = {0};
-    compiler_t *comp = &comp_state;
-
+STATIC void compile_init(compiler_t *comp, qstr source_file, bool is_repl) {
     comp->source_file = source_file;
     comp->is_repl = is_repl;
     comp->break_label = INVALID_LABEL;
@@ -3448,8 +3730,12 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
     #else
     const uint emit_opt = MP_EMIT_OPT_NONE;
     #endif
-    scope_t *module_scope = scope_new_and_link(comp, SCOPE_MODULE, parse_tree->root, emit_opt);
+    // its parse node is filled in by compile_module
+    scope_new_and_link(comp, SCOPE_MODULE, MP_PARSE_NODE_NULL, emit_opt);
+}
 
+// compile all scopes in the list starting at comp->scope_head
+STATIC void compile_scopes(compiler_t *comp) {
     // create standard emitter; it's used at least for MP_PASS_SCOPE
     emit_t *emit_bc = emit_bc_new();
 
@@ -3483,6 +3769,17 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
         }
     }
 
+    #if MICROPY_EMIT_NATIVE
+    // Functions and classes have now taken the default emitter from the module
+    // scope.  Viper code has no prelude though, and the module's prelude is
+    // where its source file comes from (eg for frozen modules), so the module
+    // itself is compiled as native Python.
+    scope_t *module_scope = comp->scope_head;
+    if (module_scope->kind == SCOPE_MODULE && module_scope->emit_options == MP_EMIT_OPT_VIPER) {
+        module_scope->emit_options = MP_EMIT_OPT_NATIVE_PYTHON;
+    }
+    #endif
+
     // compute some things related to scope and identifiers
     for (scope_t *s = comp->scope_head; s != NULL && comp->compile_error == MP_OBJ_NULL; s = s->next) {
         scope_compute_things(s);
@@ -3581,6 +3878,28 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
     #if MICROPY_EMIT_INLINE_ASM
     if (comp->emit_inline_asm != NULL) {
         ASM_EMITTER(free)(comp->emit_inline_asm);
+        comp->emit_inline_asm = NULL;
+    }
+    #endif
+}
+
+STATIC void compile_free_scopes(scope_t *s) {
+    while (s != NULL) {
+        scope_t *next = s->next;
+        scope_free(s);
+        s = next;
+    }
+}
+
+STATIC mp_raw_code_t *compile_module(compiler_t *comp, mp_parse_tree_t *parse_tree) {
+    scope_t *module_scope = comp->scope_head;
+    module_scope->pn = parse_tree->root;
+
+    compile_scopes(comp);
+
+    #if MICROPY_COMP_GLOBAL_CONST
+    if (comp->opt_globals != NULL) {
+        m_del(compile_opt_global_t, comp->opt_globals, comp->opt_globals_alloc);
     }
     #endif
 
@@ -3589,11 +3908,10 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
 
     // free the scopes
     mp_raw_code_t *outer_raw_code = module_scope->raw_code;
-    for (scope_t *s = module_scope; s;) {
-        scope_t *next = s->next;
-        scope_free(s);
-        s = next;
-    }
+    compile_free_scopes(module_scope);
+    #if MICROPY_COMP_INCREMENTAL
+    compile_free_scopes(comp->early_scope_head);
+    #endif
 
     if (comp->compile_error != MP_OBJ_NULL) {
         nlr_raise(comp->compile_error);
@@ -3602,6 +3920,163 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
     }
 }
 
+#if !MICROPY_PERSISTENT_CODE_SAVE
+STATIC
+#endif
+mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl) {
+    // put compiler state on the stack, it's relatively small
+    compiler_t comp_state = {0};
+    compiler_t *comp = &comp_state;
+
+    compile_init(comp, source_file, is_repl);
+    #if MICROPY_COMP_GLOBAL_CONST
+    comp->optimise_globals = MP_STATE_VM(mp_optimise_value) >= 2 && !is_repl;
+    #endif
+    return compile_module(comp, parse_tree);
+}
+
+#if MICROPY_COMP_INCREMENTAL
+
+// Work out the defaults of a function the same way that close_over_variables_etc()
+// will, because its prelude is emitted before the module code that makes it.
+STATIC void compile_early_funcdef_defaults(scope_t *scope, mp_parse_node_t pn_params) {
+    mp_parse_node_t *nodes;
+    size_t n = mp_parse_node_extract_list(&pn_params, PN_typedargslist, &nodes);
+    bool have_star = false;
+    for (size_t i = 0; i < n; i++) {
+        if (MP_PARSE_NODE_IS_STRUCT_KIND(nodes[i], PN_typedargslist_star)) {
+            have_star = true;
+        } else if (MP_PARSE_NODE_IS_STRUCT_KIND(nodes[i], PN_typedargslist_name)
+                   && !MP_PARSE_NODE_IS_NULL(((mp_parse_node_struct_t *)nodes[i])->nodes[2])) {
+            if (have_star) {
+                scope->scope_flags |= MP_SCOPE_FLAG_DEFKWARGS;
+            } else {
+                scope->num_def_pos_args += 1;
+            }
+        }
+    }
+}
+
+// Whether pn contains a for loop over a call to range, which compile_for_stmt
+// may optimise depending on assignments to range later in the module.
+STATIC bool compile_early_has_range_loop(mp_parse_node_t pn) {
+    if (!MP_PARSE_NODE_IS_STRUCT(pn) || MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_const_object)) {
+        return false;
+    }
+    mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)pn;
+    if (MP_PARSE_NODE_STRUCT_KIND(pns) == PN_for_stmt
+        && MP_PARSE_NODE_IS_STRUCT_KIND(pns->nodes[1], PN_atom_expr_normal)) {
+        mp_parse_node_struct_t *pns_it = (mp_parse_node_struct_t *)pns->nodes[1];
+        if (MP_PARSE_NODE_IS_ID(pns_it->nodes[0]) && MP_PARSE_NODE_LEAF_ARG(pns_it->nodes[0]) == MP_QSTR_range) {
+            return true;
+        }
+    }
+    size_t n = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
+    for (size_t i = 0; i < n; i++) {
+        if (compile_early_has_range_loop(pns->nodes[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Statement hook for mp_parse_incremental: compile a top-level function or
+// class as soon as it has been parsed, then cut its body out of the parse tree.
+STATIC bool compile_early_stmt(void *env, mp_parse_node_t pn) {
+    compiler_t *comp = env;
+    mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)pn;
+
+    if (MP_PARSE_NODE_STRUCT_KIND(pns) == PN_decorated) {
+        // built-in decorators change the emitter, so leave them to the normal passes
+        mp_parse_node_t *nodes;
+        size_t n = mp_parse_node_extract_list(&pns->nodes[0], PN_decorators, &nodes);
+        for (size_t i = 0; i < n; i++) {
+            mp_parse_node_struct_t *pns_decorator = (mp_parse_node_struct_t *)nodes[i];
+            mp_parse_node_t *name_nodes;
+            mp_parse_node_extract_list(&pns_decorator->nodes[0], PN_dotted_name, &name_nodes);
+            if (MP_PARSE_NODE_IS_ID(name_nodes[0]) && MP_PARSE_NODE_LEAF_ARG(name_nodes[0]) == MP_QSTR_micropython) {
+                return false;
+            }
+        }
+        pns = (mp_parse_node_struct_t *)pns->nodes[1];
+    }
+
+    scope_kind_t kind;
+    mp_parse_node_t *body;
+    if (MP_PARSE_NODE_STRUCT_KIND(pns) == PN_funcdef) {
+        kind = SCOPE_FUNCTION;
+        body = &pns->nodes[3];
+    } else if (MP_PARSE_NODE_STRUCT_KIND(pns) == PN_classdef) {
+        kind = SCOPE_CLASS;
+        body = &pns->nodes[2];
+    } else {
+        return false;
+    }
+
+    // a later module-level assignment to range must still stop the range loop
+    // optimisation, so such code waits for the module's passes
+    if (compile_early_has_range_loop(*body)) {
+        return false;
+    }
+
+    // compile the definition, and any scopes within it, as their own list
+    scope_t *module_scope = comp->scope_head;
+    scope_t *s = scope_new(kind, (mp_parse_node_t)pns, comp->source_file, module_scope->emit_options);
+    s->parent = module_scope;
+    if (kind == SCOPE_FUNCTION) {
+        compile_early_funcdef_defaults(s, pns->nodes[1]);
+    }
+    comp->scope_head = s;
+    compile_scopes(comp);
+    if (comp->compile_error != MP_OBJ_NULL) {
+        nlr_raise(comp->compile_error);
+    }
+    comp->scope_head = module_scope;
+    comp->scope_cur = module_scope;
+
+    // the raw code of the nested scopes is referenced by that of s, and the
+    // module only needs s itself to make the function or class
+    compile_free_scopes(s->next);
+    s->next = NULL;
+    s->pn = MP_PARSE_NODE_NULL;
+    if (comp->early_scope_head == NULL) {
+        comp->early_scope_head = s;
+    } else {
+        comp->early_scope_tail->next = s;
+    }
+    comp->early_scope_tail = s;
+
+    *body = MP_PARSE_NODE_NULL;
+    return true;
+}
+
+mp_raw_code_t *mp_compile_incremental_to_raw_code(mp_lexer_t *lex) {
+    #if MICROPY_COMP_GLOBAL_CONST
+    // optimising module globals needs the whole module before anything is compiled
+    if (MP_STATE_VM(mp_optimise_value) >= 2) {
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        return mp_compile_to_raw_code(&parse_tree, source_name, false);
+    }
+    #endif
+
+    compiler_t comp_state = {0};
+    compiler_t *comp = &comp_state;
+
+    compile_init(comp, lex->source_name, false);
+    mp_parse_tree_t parse_tree = mp_parse_incremental(lex, MP_PARSE_FILE_INPUT, compile_early_stmt, comp);
+    comp->early_scope_next = comp->early_scope_head;
+    return compile_module(comp, &parse_tree);
+}
+
+mp_obj_t mp_compile_incremental(mp_lexer_t *lex) {
+    mp_raw_code_t *rc = mp_compile_incremental_to_raw_code(lex);
+    // return function that executes the outer module
+    return mp_make_function_from_raw_code(rc, MP_OBJ_NULL, MP_OBJ_NULL);
+}
+
+#endif
+
 mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl) {
     mp_raw_code_t *rc = mp_compile_to_raw_code(parse_tree, source_file, is_repl);
     // return function that executes the outer module
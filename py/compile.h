@@ -39,6 +39,14 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
 mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl);
 #endif
 
+#if MICROPY_COMP_INCREMENTAL
+// parse and compile file input, compiling each top-level function and class as
+// soon as it has been parsed so that its parse nodes can be freed straight away
+// this frees the lexer, and otherwise has the same semantics as mp_compile
+mp_obj_t mp_compile_incremental(mp_lexer_t *lex);
+mp_raw_code_t *mp_compile_incremental_to_raw_code(mp_lexer_t *lex);
+#endif
+
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
 
@@ -39,6 +39,16 @@
 #define BYTES_FOR_INT ((MP_BYTES_PER_OBJ_WORD * 8 + 6) / 7)
 #define DUMMY_DATA_SIZE (BYTES_FOR_INT)
 
+#if MICROPY_OPT_SUPERINSTRUCTIONS
+// The sequences of opcodes that the next one may combine with.
+enum {
+    FUSE_NONE,
+    FUSE_LOAD_FAST, // LOAD_FAST n
+    FUSE_LOAD_FAST_SMALL_INT, // LOAD_FAST n, LOAD_CONST_SMALL_INT c
+    FUSE_ADD_FAST_SMALL_INT, // LOAD_FAST n, LOAD_CONST_SMALL_INT c, BINARY_OP (INPLACE_)ADD
+};
+#endif
+
 struct _emit_t {
     // Accessed as mp_obj_t, so must be aligned as such, and we rely on the
     // memory allocator returning a suitably aligned pointer.
@@ -67,6 +77,15 @@ struct _emit_t {
     size_t n_info;
     size_t n_cell;
 
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    // The sequence that ends at fuse_end, where it is still the end of the bytecode
+    // and no label or line number refers to a position within it.
+    byte fuse_kind;
+    byte fuse_arg;
+    size_t fuse_start;
+    size_t fuse_end;
+    #endif
+
     #if MICROPY_PERSISTENT_CODE
     uint16_t ct_cur_obj;
     uint16_t ct_num_obj;
@@ -308,6 +327,29 @@ STATIC void emit_write_bytecode_byte_signed_label(emit_t *emit, int stack_adj, b
     c[2] = bytecode_offset >> 8;
 }
 
+#if MICROPY_OPT_SUPERINSTRUCTIONS
+STATIC int emit_fuse_kind(emit_t *emit) {
+    if (!MICROPY_OPT_SUPERINSTRUCTIONS_DYNAMIC || emit->fuse_end != emit->bytecode_offset) {
+        return FUSE_NONE;
+    }
+    return emit->fuse_kind;
+}
+
+// Records that the opcodes from start to the current position form a sequence of the given kind.
+STATIC void emit_fuse_set(emit_t *emit, int kind, size_t start, byte arg) {
+    emit->fuse_kind = kind;
+    emit->fuse_arg = arg;
+    emit->fuse_start = start;
+    emit->fuse_end = emit->bytecode_offset;
+}
+
+// Removes the sequence so that a superinstruction can be emitted in its place.
+STATIC void emit_fuse_rewind(emit_t *emit) {
+    emit->bytecode_offset = emit->fuse_start;
+    emit->fuse_kind = FUSE_NONE;
+}
+#endif
+
 void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->pass = pass;
     emit->stack_size = 0;
@@ -323,6 +365,9 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     #endif
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    emit->fuse_kind = FUSE_NONE;
+    #endif
 
     // Write local state size, exception stack size, scope flags and number of arguments
     {
@@ -478,6 +523,9 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
         emit_write_code_info_bytes_lines(emit, bytes_to_skip, lines_to_skip);
         emit->last_source_line_offset = emit->bytecode_offset;
         emit->last_source_line = source_line;
+        #if MICROPY_OPT_SUPERINSTRUCTIONS
+        emit->fuse_kind = FUSE_NONE;
+        #endif
     }
     #else
     (void)emit;
@@ -490,6 +538,9 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
     if (emit->pass == MP_PASS_SCOPE) {
         return;
     }
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    emit->fuse_kind = FUSE_NONE;
+    #endif
     assert(l < emit->max_num_labels);
     if (emit->pass < MP_PASS_EMIT) {
         // assign label offset
@@ -523,6 +574,15 @@ void mp_emit_bc_load_const_tok(emit_t *emit, mp_token_kind_t tok) {
 }
 
 void mp_emit_bc_load_const_small_int(emit_t *emit, mp_int_t arg) {
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    if (emit_fuse_kind(emit) == FUSE_LOAD_FAST && 0 <= arg && arg <= 7) {
+        size_t start = emit->fuse_start;
+        byte n = emit->fuse_arg;
+        emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS + arg);
+        emit_fuse_set(emit, FUSE_LOAD_FAST_SMALL_INT, start, n << 4 | arg);
+        return;
+    }
+    #endif
     if (-MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS <= arg
         && arg < MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS) {
         emit_write_bytecode_byte(emit, 1,
@@ -549,7 +609,21 @@ void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_LOAD_DEREF);
     (void)qst;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        #if MICROPY_OPT_SUPERINSTRUCTIONS
+        // Local 0 is left to combine with a following attribute access instead.
+        if (emit_fuse_kind(emit) == FUSE_LOAD_FAST && local_num != 0) {
+            byte a = emit->fuse_arg;
+            emit_fuse_rewind(emit);
+            emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_FAST);
+            emit_write_bytecode_raw_byte(emit, a << 4 | local_num);
+            return;
+        }
+        size_t start = emit->bytecode_offset;
         emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_MULTI + local_num);
+        emit_fuse_set(emit, FUSE_LOAD_FAST, start, local_num);
+        #else
+        emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_MULTI + local_num);
+        #endif
     } else {
         emit_write_bytecode_byte_uint(emit, 1, MP_BC_LOAD_FAST_N + kind, local_num);
     }
@@ -563,6 +637,13 @@ void mp_emit_bc_load_global(emit_t *emit, qstr qst, int kind) {
 }
 
 void mp_emit_bc_load_method(emit_t *emit, qstr qst, bool is_super) {
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    if (!is_super && emit_fuse_kind(emit) == FUSE_LOAD_FAST && emit->fuse_arg == 0) {
+        emit_fuse_rewind(emit);
+        emit_write_bytecode_byte_qstr(emit, 1, MP_BC_LOAD_FAST0_METHOD, qst);
+        return;
+    }
+    #endif
     int stack_adj = 1 - 2 * is_super;
     emit_write_bytecode_byte_qstr(emit, stack_adj, is_super ? MP_BC_LOAD_SUPER_METHOD : MP_BC_LOAD_METHOD, qst);
 }
@@ -584,6 +665,17 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 }
 
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    if (kind != MP_EMIT_ATTR_DELETE && emit_fuse_kind(emit) == FUSE_LOAD_FAST && emit->fuse_arg == 0) {
+        emit_fuse_rewind(emit);
+        if (kind == MP_EMIT_ATTR_LOAD) {
+            emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_FAST0_ATTR, qst);
+        } else {
+            emit_write_bytecode_byte_qstr(emit, -2, MP_BC_STORE_FAST0_ATTR, qst);
+        }
+        return;
+    }
+    #endif
     if (kind == MP_EMIT_ATTR_LOAD) {
         emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR, qst);
     } else {
@@ -600,6 +692,15 @@ void mp_emit_bc_store_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kin
     MP_STATIC_ASSERT(MP_BC_STORE_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_STORE_DEREF);
     (void)qst;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        #if MICROPY_OPT_SUPERINSTRUCTIONS
+        if (emit_fuse_kind(emit) == FUSE_ADD_FAST_SMALL_INT && emit->fuse_arg >> 4 == local_num) {
+            byte arg = emit->fuse_arg;
+            emit_fuse_rewind(emit);
+            emit_write_bytecode_byte(emit, -1, MP_BC_ADD_FAST_SMALL_INT);
+            emit_write_bytecode_raw_byte(emit, arg);
+            return;
+        }
+        #endif
         emit_write_bytecode_byte(emit, -1, MP_BC_STORE_FAST_MULTI + local_num);
     } else {
         emit_write_bytecode_byte_uint(emit, -1, MP_BC_STORE_FAST_N + kind, local_num);
@@ -736,6 +837,15 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         invert = true;
         op = MP_BINARY_OP_IS;
     }
+    #if MICROPY_OPT_SUPERINSTRUCTIONS
+    if (emit_fuse_kind(emit) == FUSE_LOAD_FAST_SMALL_INT && (op == MP_BINARY_OP_ADD || op == MP_BINARY_OP_INPLACE_ADD)) {
+        size_t start = emit->fuse_start;
+        byte arg = emit->fuse_arg | (op == MP_BINARY_OP_INPLACE_ADD) << 3;
+        emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
+        emit_fuse_set(emit, FUSE_ADD_FAST_SMALL_INT, start, arg);
+        return;
+    }
+    #endif
     emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
     if (invert) {
         emit_write_bytecode_byte(emit, 0, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
@@ -77,6 +77,10 @@
 #define N_XTENSA (0)
 #endif
 
+#ifndef N_RV32
+#define N_RV32 (0)
+#endif
+
 #ifndef N_NLR_SETJMP
 #define N_NLR_SETJMP (0)
 #endif
@@ -86,7 +90,7 @@
 #endif
 
 // wrapper around everything in this file
-#if N_X64 || N_X86 || N_THUMB || N_ARM || N_XTENSA || N_XTENSAWIN
+#if N_X64 || N_X86 || N_THUMB || N_ARM || N_XTENSA || N_XTENSAWIN || N_RV32
 
 // C stack layout for native functions:
 //  0:                          nlr_buf_t [optional]
@@ -2569,6 +2573,29 @@ STATIC void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
             } else {
                 asm_xtensa_setcc_reg_reg_reg(emit->as, cc & ~0x80, REG_RET, reg_rhs, REG_ARG_2);
             }
+            #elif N_RV32
+            static uint8_t ccs[6 + 6] = {
+                // unsigned
+                ASM_RV32_CC_LTU,
+                0x80 | ASM_RV32_CC_LTU, // for GTU we'll swap args
+                ASM_RV32_CC_EQ,
+                0x80 | ASM_RV32_CC_GEU, // for LEU we'll swap args
+                ASM_RV32_CC_GEU,
+                ASM_RV32_CC_NE,
+                // signed
+                ASM_RV32_CC_LT,
+                0x80 | ASM_RV32_CC_LT, // for GT we'll swap args
+                ASM_RV32_CC_EQ,
+                0x80 | ASM_RV32_CC_GE, // for LE we'll swap args
+                ASM_RV32_CC_GE,
+                ASM_RV32_CC_NE,
+            };
+            uint8_t cc = ccs[op_idx];
+            if ((cc & 0x80) == 0) {
+                asm_rv32_setcc_reg_reg_reg(emit->as, cc, REG_RET, REG_ARG_2, reg_rhs);
+            } else {
+                asm_rv32_setcc_reg_reg_reg(emit->as, cc & ~0x80, REG_RET, reg_rhs, REG_ARG_2);
+            }
             #else
             #error not implemented
             #endif
@@ -0,0 +1,22 @@
+// RISC-V RV32 specific stuff
+
+#include "py/mpconfig.h"
+
+#if MICROPY_EMIT_RV32
+
+// this is defined so that the assembler exports generic assembler API macros
+#define GENERIC_ASM_API (1)
+#include "py/asmrv32.h"
+
+// Word indices of REG_LOCAL_x in nlr_buf_t, which holds a newlib jmp_buf
+// starting with ra, s0, s1, ...
+#define NLR_BUF_IDX_LOCAL_1 (2 + 2) // s1
+#define NLR_BUF_IDX_LOCAL_2 (2 + 3) // s2
+#define NLR_BUF_IDX_LOCAL_3 (2 + 4) // s3
+
+#define N_NLR_SETJMP (1)
+#define N_RV32 (1)
+#define EXPORT_FUN(name) emit_native_rv32_##name
+#include "py/emitnative.c"
+
+#endif
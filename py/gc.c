@@ -31,6 +31,13 @@
 
 #include "py/gc.h"
 #include "py/runtime.h"
+#include "py/mphal.h"
+
+#if MICROPY_GC_COMPACT
+#include "py/binary.h"
+#include "py/objarray.h"
+#include "py/objlist.h"
+#endif
 
 #if MICROPY_DEBUG_VALGRIND
 #include <valgrind/memcheck.h>
@@ -82,6 +89,20 @@
 #define ATB_FREE_TO_TAIL(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] |= (AT_TAIL << BLOCK_SHIFT(block)); } while (0)
 #define ATB_HEAD_TO_MARK(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block)); } while (0)
 #define ATB_MARK_TO_HEAD(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] &= (~(AT_TAIL << BLOCK_SHIFT(block))); } while (0)
+#if MICROPY_GC_PARALLEL_MARK
+// Both cores may reach the same head while marking. The mark is set atomically and only the core
+// that turned the head into a mark goes on to trace it.
+#if MICROPY_GC_PORT_ATB_FETCH_OR
+#define ATB_FETCH_OR(atb, bits) gc_port_atb_fetch_or(atb, bits)
+#else
+#define ATB_FETCH_OR(atb, bits) __atomic_fetch_or(atb, bits, __ATOMIC_RELAXED)
+#endif
+#define ATB_TRY_MARK(block) (((ATB_FETCH_OR(&MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB], AT_MARK << BLOCK_SHIFT(block)) >> BLOCK_SHIFT(block)) & 3) == AT_HEAD)
+#else
+#define ATB_TRY_MARK(block) ((MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block))), true)
+#endif
+// Outside of a collection, marked heads are live blocks that a pending sweep hasn't reached yet.
+#define ATB_IS_HEAD(block) ((ATB_GET_KIND(block) & AT_HEAD) != 0)
 
 #define BLOCK_FROM_PTR(ptr) (((byte *)(ptr) - MP_STATE_MEM(gc_pool_start)) / BYTES_PER_BLOCK)
 #define PTR_FROM_BLOCK(block) (((block) * BYTES_PER_BLOCK + (uintptr_t)MP_STATE_MEM(gc_pool_start)))
@@ -98,6 +119,33 @@
 #define FTB_CLEAR(block) do { MP_STATE_MEM(gc_finaliser_table_start)[(block) / BLOCKS_PER_FTB] &= (~(1 << ((block) & 7))); } while (0)
 #endif
 
+#if MICROPY_GC_FREE_RUN_INDEX
+// The free run index summarises each chunk of the heap with its free runs so that gc_alloc can
+// skip chunks that can't hold an allocation. Allocating and freeing mark a chunk dirty and the
+// next search to reach it summarises it again. gc_sweep rebuilds the whole index.
+#define ATBS_PER_CHUNK (32)
+#define BLOCKS_PER_CHUNK (ATBS_PER_CHUNK * BLOCKS_PER_ATB)
+#define CHUNK_DIRTY (0xff)
+#define CHUNK_FROM_BLOCK(block) ((block) / BLOCKS_PER_CHUNK)
+
+typedef struct _gc_free_run_t {
+    uint8_t head; // free blocks at the start of the chunk
+    uint8_t tail; // free blocks at the end of the chunk
+    uint8_t longest; // longest free run in the chunk or CHUNK_DIRTY if unknown
+} gc_free_run_t;
+#endif
+
+#if MICROPY_GC_INCREMENTAL_SWEEP
+#define SWEEP_END_BLOCK (MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB)
+// Blocks swept between checks of the time budget.
+#define SWEEP_STEP_BLOCKS (256)
+#endif
+
+#if MICROPY_GC_MINOR_COLLECT
+// The first long lived ATB. Any blocks sharing an ATB with the nursery count as nursery.
+#define NURSERY_END_ATB ((BLOCK_FROM_PTR(MP_STATE_MEM(gc_lowest_long_lived_ptr)) + BLOCKS_PER_ATB - 1) / BLOCKS_PER_ATB)
+#endif
+
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
 #define GC_ENTER() mp_thread_mutex_lock(&MP_STATE_MEM(gc_mutex), 1)
 #define GC_EXIT() mp_thread_mutex_unlock(&MP_STATE_MEM(gc_mutex))
@@ -129,6 +177,15 @@ void gc_init(void *start, void *end) {
     //     P = A * BLOCKS_PER_ATB * BYTES_PER_BLOCK
     // => T = A * (1 + BLOCKS_PER_ATB / BLOCKS_PER_FTB + BLOCKS_PER_ATB * BYTES_PER_BLOCK)
     size_t total_byte_len = (byte *)end - (byte *)start;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // The free run index goes first. Size it for an alloc table covering the whole area because
+    // the real one is a little smaller.
+    size_t free_run_index_len = (total_byte_len / (BLOCKS_PER_CHUNK * BYTES_PER_BLOCK) + 1) * sizeof(gc_free_run_t);
+    MP_STATE_MEM(gc_free_run_index) = start;
+    memset(start, CHUNK_DIRTY, free_run_index_len);
+    start = (byte *)start + free_run_index_len;
+    total_byte_len -= free_run_index_len;
+    #endif
     #if MICROPY_ENABLE_FINALISER
     MP_STATE_MEM(gc_alloc_table_byte_len) = (total_byte_len - 1) * MP_BITS_PER_BYTE / (MP_BITS_PER_BYTE + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_FTB + MP_BITS_PER_BYTE * BLOCKS_PER_ATB * BYTES_PER_BLOCK);
     #else
@@ -175,6 +232,32 @@ void gc_init(void *start, void *end) {
     // allow auto collection
     MP_STATE_MEM(gc_auto_collect_enabled) = true;
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_block) = SWEEP_END_BLOCK;
+    MP_STATE_MEM(gc_sweep_deferred) = false;
+    #endif
+
+    #if MICROPY_GC_MINOR_COLLECT
+    MP_STATE_MEM(gc_collect_minor) = false;
+    #endif
+
+    #if MICROPY_GC_COMPACT
+    MP_STATE_MEM(gc_compact_buffers) = NULL;
+    #endif
+
+    #if MICROPY_GC_PARALLEL_MARK
+    MP_STATE_MEM(gc_helper_running) = false;
+    #endif
+
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_collections) = 0;
+    MP_STATE_MEM(gc_stats_total_pause_us) = 0;
+    MP_STATE_MEM(gc_stats_max_pause_us) = 0;
+    MP_STATE_MEM(gc_stats_marked_blocks) = 0;
+    MP_STATE_MEM(gc_stats_stack_overflows) = 0;
+    MP_STATE_MEM(gc_stats_swept_bytes) = 0;
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     // by default, maxuint for gc threshold, effectively turning gc-by-threshold off
     MP_STATE_MEM(gc_alloc_threshold) = (size_t)-1;
@@ -233,9 +316,11 @@ bool gc_is_locked(void) {
 // topmost block on the stack and repeat with that one.
 // We don't instrument these functions because they occur a lot during GC and
 // fill up the output buffer quickly.
-STATIC void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block) {
+// Returns the number of blocks whose children were checked.
+STATIC size_t MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree_with_stack)(size_t block, MICROPY_GC_STACK_ENTRY_TYPE *stack) {
     // Start with the block passed in the argument.
     size_t sp = 0;
+    size_t marked_blocks = 0;
     for (;;) {
         MICROPY_GC_HOOK_LOOP
         // work out number of consecutive blocks in the chain starting with this one
@@ -243,6 +328,7 @@ STATIC void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block) {
         do {
             n_blocks += 1;
         } while (ATB_GET_KIND(block + n_blocks) == AT_TAIL);
+        marked_blocks += n_blocks;
 
         // check this block's children
         void **ptrs = (void **)PTR_FROM_BLOCK(block);
@@ -252,12 +338,11 @@ STATIC void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block) {
             if (VERIFY_PTR(ptr)) {
                 // Mark and push this pointer
                 size_t childblock = BLOCK_FROM_PTR(ptr);
-                if (ATB_GET_KIND(childblock) == AT_HEAD) {
+                if (ATB_GET_KIND(childblock) == AT_HEAD && ATB_TRY_MARK(childblock)) {
                     // an unmarked head, mark it, and push it on gc stack
                     TRACE_MARK(childblock, ptr);
-                    ATB_HEAD_TO_MARK(childblock);
                     if (sp < MICROPY_ALLOC_GC_STACK_SIZE) {
-                        MP_STATE_MEM(gc_stack)[sp++] = childblock;
+                        stack[sp++] = childblock;
                     } else {
                         MP_STATE_MEM(gc_stack_overflow) = 1;
                     }
@@ -271,13 +356,45 @@ STATIC void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block) {
         }
 
         // pop the next block off the stack
-        block = MP_STATE_MEM(gc_stack)[--sp];
+        block = stack[--sp];
     }
+    return marked_blocks;
+}
+
+STATIC void gc_mark_subtree(size_t block) {
+    size_t marked_blocks = gc_mark_subtree_with_stack(block, MP_STATE_MEM(gc_stack));
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_marked_blocks) += marked_blocks;
+    #else
+    (void)marked_blocks;
+    #endif
 }
 
+#if MICROPY_GC_PARALLEL_MARK
+// Runs on the second core, with its own mark stack, while the collecting core marks from the rest
+// of the roots. A mark stack overflow on either core is dealt with once both have finished.
+void gc_mark_helper(void) {
+    void **ptrs = MP_STATE_MEM(gc_helper_roots);
+    size_t marked_blocks = 0;
+    for (size_t i = 0; i < MP_STATE_MEM(gc_helper_root_count); i++) {
+        void *ptr = ptrs[i];
+        if (VERIFY_PTR(ptr)) {
+            size_t block = BLOCK_FROM_PTR(ptr);
+            if (ATB_GET_KIND(block) == AT_HEAD && ATB_TRY_MARK(block)) {
+                marked_blocks += gc_mark_subtree_with_stack(block, MP_STATE_MEM(gc_helper_stack));
+            }
+        }
+    }
+    MP_STATE_MEM(gc_helper_marked_blocks) = marked_blocks;
+}
+#endif
+
 STATIC void gc_deal_with_stack_overflow(void) {
     while (MP_STATE_MEM(gc_stack_overflow)) {
         MP_STATE_MEM(gc_stack_overflow) = 0;
+        #if MICROPY_GC_STATS
+        MP_STATE_MEM(gc_stats_stack_overflows)++;
+        #endif
 
         // scan entire memory looking for blocks which have been marked but not their children
         for (size_t block = 0; block < MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB; block++) {
@@ -290,18 +407,145 @@ STATIC void gc_deal_with_stack_overflow(void) {
     }
 }
 
-STATIC void gc_sweep(void) {
-    #if MICROPY_PY_GC_COLLECT_RETVAL
-    MP_STATE_MEM(gc_collected) = 0;
-    #endif
-    // free unmarked heads and their tails
+#if MICROPY_GC_FREE_RUN_INDEX
+STATIC void gc_free_run_mark_dirty(size_t start_block, size_t end_block) {
+    for (size_t chunk = CHUNK_FROM_BLOCK(start_block); chunk <= CHUNK_FROM_BLOCK(end_block); chunk++) {
+        MP_STATE_MEM(gc_free_run_index)[chunk].longest = CHUNK_DIRTY;
+    }
+}
+
+STATIC void gc_free_run_summarise(size_t chunk) {
+    size_t block = chunk * BLOCKS_PER_CHUNK;
+    size_t end_block = MIN(block + BLOCKS_PER_CHUNK, MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB);
+    size_t head = 0;
+    size_t run = 0;
+    size_t longest = 0;
+    bool in_head = true;
+    while (block < end_block) {
+        // Whole free ATBs are common so take them four blocks at a time.
+        if (block % BLOCKS_PER_ATB == 0 && block + BLOCKS_PER_ATB <= end_block &&
+            MP_STATE_MEM(gc_alloc_table_start)[block / BLOCKS_PER_ATB] == 0) {
+            run += BLOCKS_PER_ATB;
+            block += BLOCKS_PER_ATB;
+            continue;
+        }
+        if (ATB_GET_KIND(block) == AT_FREE) {
+            run++;
+        } else {
+            if (in_head) {
+                head = run;
+                in_head = false;
+            }
+            longest = MAX(longest, run);
+            run = 0;
+        }
+        block++;
+    }
+    if (in_head) {
+        head = run;
+    }
+    gc_free_run_t *summary = &MP_STATE_MEM(gc_free_run_index)[chunk];
+    summary->head = head;
+    summary->tail = run;
+    summary->longest = MAX(longest, run);
+}
+
+// Skips the chunk that the search enters at ATB *i when none of its free runs can complete an
+// allocation of n_blocks. Then *i is left on the chunk's last ATB in the search direction and
+// *n_free is the exact run carried out of the chunk.
+STATIC bool gc_free_run_skip_chunk(size_t *i, int8_t direction, size_t n_blocks, size_t *n_free,
+    size_t first_free, size_t crossover_block, bool collected) {
+    size_t atb = *i;
+    if (atb % ATBS_PER_CHUNK != (direction == 1 ? 0 : ATBS_PER_CHUNK - 1)) {
+        return false;
+    }
+    size_t chunk = atb / ATBS_PER_CHUNK;
+    size_t first_atb = chunk * ATBS_PER_CHUNK;
+    size_t last_atb = first_atb + ATBS_PER_CHUNK - 1;
+    if (first_atb < first_free || last_atb > MP_STATE_MEM(gc_last_free_atb_index)) {
+        return false;
+    }
+    // Before a collection the search stops at the first used block across the crossover so
+    // only chunks on the search's own side may be skipped.
+    if (!collected &&
+        ((direction == 1 && (last_atb + 1) * BLOCKS_PER_ATB > crossover_block) ||
+         (direction == -1 && first_atb * BLOCKS_PER_ATB < crossover_block))) {
+        return false;
+    }
+    gc_free_run_t *summary = &MP_STATE_MEM(gc_free_run_index)[chunk];
+    if (summary->longest == CHUNK_DIRTY) {
+        gc_free_run_summarise(chunk);
+    }
+    size_t entry_run = direction == 1 ? summary->head : summary->tail;
+    if (*n_free + entry_run >= n_blocks || summary->longest >= n_blocks) {
+        return false;
+    }
+    // Count the run leaving the chunk directly in case the summary is out of date.
+    size_t bound = direction == 1 ? summary->tail : summary->head;
+    size_t block = direction == 1 ? (last_atb + 1) * BLOCKS_PER_ATB - 1 : first_atb * BLOCKS_PER_ATB;
+    size_t run = 0;
+    while (run < bound && ATB_GET_KIND(block) == AT_FREE) {
+        run++;
+        block -= direction;
+    }
+    if (run == BLOCKS_PER_CHUNK) {
+        run += *n_free;
+    }
+    *n_free = run;
+    *i = direction == 1 ? last_atb : first_atb;
+    return true;
+}
+#endif
+
+#if MICROPY_GC_MINOR_COLLECT
+// A minor collection treats every head in the long lived area as reachable. Marking them all up
+// front stops tracing at the edge of the area, and tracing from each of them then marks the
+// nursery blocks the long lived area refers to.
+STATIC void gc_minor_mark_long_lived(void) {
+    byte *atb = MP_STATE_MEM(gc_alloc_table_start);
+    size_t start = NURSERY_END_ATB;
+    size_t len = MP_STATE_MEM(gc_alloc_table_byte_len);
+    // Only heads have the low bit set so setting the high bit too turns them into marks.
+    for (size_t i = start; i < len; i++) {
+        atb[i] |= (atb[i] & 0x55) << 1;
+    }
+    for (size_t i = start; i < len; i++) {
+        MICROPY_GC_HOOK_LOOP
+        byte marks = atb[i] & 0x55;
+        for (size_t j = 0; marks != 0; j++, marks >>= 2) {
+            if (marks & 1) {
+                gc_mark_subtree(i * BLOCKS_PER_ATB + j);
+            }
+        }
+    }
+}
+
+STATIC void gc_minor_unmark_long_lived(void) {
+    byte *atb = MP_STATE_MEM(gc_alloc_table_start);
+    for (size_t i = NURSERY_END_ATB; i < MP_STATE_MEM(gc_alloc_table_byte_len); i++) {
+        // Clearing the high bit of each mark turns it back into a head.
+        atb[i] &= ~((atb[i] & 0x55) << 1);
+    }
+}
+#endif
+
+// Frees unmarked heads and their tails from block to end_block and returns where it stopped. It
+// carries on past end_block to the end of the chain it is in so that a later call never starts
+// partway through a chain it was freeing. Without run_finalisers, unmarked heads that have a
+// finaliser are left allocated for the next collection to find.
+STATIC size_t gc_sweep_blocks(size_t block, size_t end_block, bool run_finalisers) {
+    size_t max_block = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
     int free_tail = 0;
-    for (size_t block = 0; block < MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB; block++) {
+    for (; block < end_block || (block < max_block && ATB_GET_KIND(block) == AT_TAIL); block++) {
         MICROPY_GC_HOOK_LOOP
         switch (ATB_GET_KIND(block)) {
             case AT_HEAD:
                 #if MICROPY_ENABLE_FINALISER
                 if (FTB_GET(block)) {
+                    if (!run_finalisers) {
+                        free_tail = 0;
+                        break;
+                    }
                     mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(block);
                     if (obj->type != NULL) {
                         // if the object has a type then see if it has a __del__ method
@@ -321,6 +565,8 @@ STATIC void gc_sweep(void) {
                     // clear finaliser flag
                     FTB_CLEAR(block);
                 }
+                #else
+                (void)run_finalisers;
                 #endif
                 free_tail = 1;
                 DEBUG_printf("gc_sweep(%p)\n", (void *)PTR_FROM_BLOCK(block));
@@ -337,6 +583,9 @@ STATIC void gc_sweep(void) {
             case AT_TAIL:
                 if (free_tail) {
                     ATB_ANY_TO_FREE(block);
+                    #if MICROPY_GC_STATS
+                    MP_STATE_MEM(gc_stats_swept_bytes) += BYTES_PER_BLOCK;
+                    #endif
                     #if CLEAR_ON_SWEEP
                     memset((void *)PTR_FROM_BLOCK(block), 0, BYTES_PER_BLOCK);
                     #endif
@@ -349,16 +598,375 @@ STATIC void gc_sweep(void) {
                 break;
         }
     }
+    return block;
 }
 
+#if MICROPY_GC_INCREMENTAL_SWEEP
+bool gc_sweep_pending(void) {
+    return MP_STATE_MEM(gc_sweep_block) < SWEEP_END_BLOCK;
+}
+
+// Sweeps on from where the pending sweep got to. The GC must be entered and locked.
+STATIC void gc_sweep_continue(size_t end_block, bool run_finalisers) {
+    size_t start_block = MP_STATE_MEM(gc_sweep_block);
+    size_t block = gc_sweep_blocks(start_block, MIN(end_block, SWEEP_END_BLOCK), run_finalisers);
+    MP_STATE_MEM(gc_sweep_block) = block;
+    if (block == start_block) {
+        return;
+    }
+    #if MICROPY_GC_FREE_RUN_INDEX
+    gc_free_run_mark_dirty(start_block, block - 1);
+    #endif
+    // Allocations may have moved the free indices past blocks this step freed.
+    size_t start_atb = start_block / BLOCKS_PER_ATB;
+    for (size_t i = 0; i < MICROPY_ATB_INDICES; i++) {
+        if (MP_STATE_MEM(gc_first_free_atb_index)[i] > start_atb) {
+            MP_STATE_MEM(gc_first_free_atb_index)[i] = start_atb;
+        }
+    }
+    MP_STATE_MEM(gc_last_free_atb_index) = MAX(MP_STATE_MEM(gc_last_free_atb_index), (block - 1) / BLOCKS_PER_ATB);
+}
+
+STATIC void gc_sweep_finish(void) {
+    GC_ENTER();
+    MP_STATE_THREAD(gc_lock_depth)++;
+    gc_sweep_continue(SWEEP_END_BLOCK, true);
+    MP_STATE_THREAD(gc_lock_depth)--;
+    GC_EXIT();
+}
+
+void gc_sweep_step(mp_uint_t budget_us, bool run_finalisers) {
+    if (MP_STATE_THREAD(gc_lock_depth) > 0 || !gc_sweep_pending()) {
+        return;
+    }
+    GC_ENTER();
+    MP_STATE_THREAD(gc_lock_depth)++;
+    mp_uint_t start = mp_hal_ticks_us();
+    while (gc_sweep_pending() && mp_hal_ticks_us() - start < budget_us) {
+        gc_sweep_continue(MP_STATE_MEM(gc_sweep_block) + SWEEP_STEP_BLOCKS, run_finalisers);
+    }
+    MP_STATE_THREAD(gc_lock_depth)--;
+    GC_EXIT();
+}
+#endif
+
+STATIC void gc_sweep(void) {
+    #if MICROPY_PY_GC_COLLECT_RETVAL
+    MP_STATE_MEM(gc_collected) = 0;
+    #endif
+    #if MICROPY_GC_MINOR_COLLECT
+    if (MP_STATE_MEM(gc_collect_minor)) {
+        size_t end_block = gc_sweep_blocks(0, NURSERY_END_ATB * BLOCKS_PER_ATB, true);
+        gc_minor_unmark_long_lived();
+        #if MICROPY_GC_FREE_RUN_INDEX
+        if (end_block > 0) {
+            gc_free_run_mark_dirty(0, end_block - 1);
+        }
+        #else
+        (void)end_block;
+        #endif
+        return;
+    }
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_block) = 0;
+    if (!MP_STATE_MEM(gc_sweep_deferred)) {
+        gc_sweep_continue(SWEEP_END_BLOCK, true);
+    }
+    #else
+    gc_sweep_blocks(0, MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB, true);
+    #if MICROPY_GC_FREE_RUN_INDEX
+    size_t chunks = (MP_STATE_MEM(gc_alloc_table_byte_len) + ATBS_PER_CHUNK - 1) / ATBS_PER_CHUNK;
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        gc_free_run_summarise(chunk);
+    }
+    #endif
+    #endif
+}
+
+#if MICROPY_GC_COMPACT
+// A buffer that gc_compact() may move. Blocks are stored rather than pointers so that the table
+// doesn't refer to the buffers itself.
+typedef struct _gc_compact_buffer_t {
+    size_t owner_block;
+    size_t block;
+    size_t n_blocks;
+    size_t refs;
+} gc_compact_buffer_t;
+
+// Returns where the object at block keeps its item storage if it is a bytearray, array or list
+// that was allocated on its own, otherwise NULL. *n_bytes is set to the storage it needs.
+STATIC void **gc_compact_storage(size_t block, size_t *n_bytes) {
+    mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(block);
+    size_t obj_bytes = gc_nbytes(obj);
+    if (obj->type == &mp_type_list) {
+        mp_obj_list_t *list = (mp_obj_list_t *)obj;
+        if (obj_bytes < sizeof(mp_obj_list_t) || obj_bytes >= sizeof(mp_obj_list_t) + BYTES_PER_BLOCK ||
+            list->len > list->alloc) {
+            return NULL;
+        }
+        *n_bytes = list->alloc * sizeof(mp_obj_t);
+        return (void **)&list->items;
+    }
+    #if MICROPY_PY_BUILTINS_BYTEARRAY || MICROPY_PY_ARRAY
+    if (
+        #if MICROPY_PY_BUILTINS_BYTEARRAY
+        obj->type == &mp_type_bytearray ||
+        #endif
+        #if MICROPY_PY_ARRAY
+        obj->type == &mp_type_array ||
+        #endif
+        false) {
+        mp_obj_array_t *array = (mp_obj_array_t *)obj;
+        if (obj_bytes < sizeof(mp_obj_array_t) || obj_bytes >= sizeof(mp_obj_array_t) + BYTES_PER_BLOCK) {
+            return NULL;
+        }
+        *n_bytes = (array->len + array->free) * mp_binary_get_size('@', array->typecode, NULL);
+        return &array->items;
+    }
+    #endif
+    return NULL;
+}
+
+STATIC void gc_compact_count_ref(void *ptr) {
+    // Pointers into the middle of a buffer pin it too.
+    if (!HEAP_PTR(ptr)) {
+        return;
+    }
+    size_t block = BLOCK_FROM_PTR(ptr);
+    gc_compact_buffer_t *buffers = MP_STATE_MEM(gc_compact_buffers);
+    size_t lo = 0;
+    size_t hi = MP_STATE_MEM(gc_compact_buffer_count);
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (block < buffers[mid].block) {
+            hi = mid;
+        } else if (block >= buffers[mid].block + buffers[mid].n_blocks) {
+            lo = mid + 1;
+        } else {
+            buffers[mid].refs++;
+            return;
+        }
+    }
+}
+
+// Finds the largest movable buffers before the long lived area, sorted by block.
+STATIC size_t gc_compact_find_buffers(gc_compact_buffer_t *buffers) {
+    size_t count = 0;
+    size_t end_block = BLOCK_FROM_PTR(MP_STATE_MEM(gc_lowest_long_lived_ptr));
+    size_t max_block = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
+    for (size_t block = 0; block < max_block; block++) {
+        size_t n_bytes;
+        void **storage;
+        if (ATB_GET_KIND(block) != AT_HEAD || (storage = gc_compact_storage(block, &n_bytes)) == NULL) {
+            continue;
+        }
+        void *items = *storage;
+        if (!VERIFY_PTR(items) || !ATB_IS_HEAD(BLOCK_FROM_PTR(items)) || BLOCK_FROM_PTR(items) >= end_block) {
+            continue;
+        }
+        size_t n_blocks = gc_nbytes(items) / BYTES_PER_BLOCK;
+        if (n_blocks * BYTES_PER_BLOCK < n_bytes) {
+            continue;
+        }
+        // Replace the smallest buffer once the table is full.
+        size_t i = count;
+        if (count == MICROPY_GC_COMPACT_BUFFERS) {
+            i = 0;
+            for (size_t j = 1; j < count; j++) {
+                if (buffers[j].n_blocks < buffers[i].n_blocks) {
+                    i = j;
+                }
+            }
+            if (buffers[i].n_blocks >= n_blocks) {
+                continue;
+            }
+        } else {
+            count++;
+        }
+        buffers[i].owner_block = block;
+        buffers[i].block = BLOCK_FROM_PTR(items);
+        buffers[i].n_blocks = n_blocks;
+        buffers[i].refs = 0;
+    }
+    for (size_t i = 1; i < count; i++) {
+        gc_compact_buffer_t buffer = buffers[i];
+        size_t j = i;
+        for (; j > 0 && buffers[j - 1].block > buffer.block; j--) {
+            buffers[j] = buffers[j - 1];
+        }
+        buffers[j] = buffer;
+    }
+    return count;
+}
+
+// Items storage can only move when the only reference to it is its owner's. The roots are
+// counted by a collection that doesn't mark and the heap by walking every allocated block.
+STATIC size_t gc_compact_heap(void) {
+    if (MP_STATE_THREAD(gc_lock_depth) > 0) {
+        return 0;
+    }
+    gc_compact_buffer_t buffers[MICROPY_GC_COMPACT_BUFFERS];
+    size_t count = gc_compact_find_buffers(buffers);
+    if (count == 0) {
+        return 0;
+    }
+    MP_STATE_MEM(gc_compact_buffers) = buffers;
+    MP_STATE_MEM(gc_compact_buffer_count) = count;
+    gc_collect();
+    size_t max_block = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
+    for (size_t block = 0; block < max_block; block++) {
+        if (ATB_GET_KIND(block) == AT_FREE) {
+            continue;
+        }
+        void **ptrs = (void **)PTR_FROM_BLOCK(block);
+        for (size_t i = 0; i < BYTES_PER_BLOCK / sizeof(void *); i++) {
+            gc_compact_count_ref(ptrs[i]);
+        }
+    }
+    MP_STATE_MEM(gc_compact_buffers) = NULL;
+
+    // Move the highest buffers first so that they take the lowest free runs.
+    bool auto_collect = MP_STATE_MEM(gc_auto_collect_enabled);
+    MP_STATE_MEM(gc_auto_collect_enabled) = false;
+    size_t moved = 0;
+    for (size_t i = count; i-- > 0;) {
+        gc_compact_buffer_t *buffer = &buffers[i];
+        size_t n_bytes;
+        void **storage = gc_compact_storage(buffer->owner_block, &n_bytes);
+        void *old_items = (void *)PTR_FROM_BLOCK(buffer->block);
+        if (buffer->refs != 1 || storage == NULL || *storage != old_items) {
+            continue;
+        }
+        void *new_items = gc_alloc(buffer->n_blocks * BYTES_PER_BLOCK, 0, false);
+        if (new_items == NULL) {
+            continue;
+        }
+        if (new_items > old_items) {
+            gc_free(new_items);
+            continue;
+        }
+        memcpy(new_items, old_items, buffer->n_blocks * BYTES_PER_BLOCK);
+        *storage = new_items;
+        gc_free(old_items);
+        moved++;
+    }
+    MP_STATE_MEM(gc_auto_collect_enabled) = auto_collect;
+    return moved;
+}
+
+size_t gc_compact(void) {
+    gc_collect();
+    return gc_compact_heap();
+}
+#endif
+
+#if MICROPY_GC_CENSUS
+void *gc_census_next(void *prev, size_t *n_bytes) {
+    GC_ENTER();
+    size_t max_block = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
+    size_t block = prev == NULL ? 0 : BLOCK_FROM_PTR(prev) + 1;
+    for (; block < max_block; block++) {
+        if (ATB_IS_HEAD(block)) {
+            size_t n_blocks = 0;
+            do {
+                n_blocks += 1;
+            } while (ATB_GET_KIND(block + n_blocks) == AT_TAIL);
+            *n_bytes = n_blocks * BYTES_PER_BLOCK;
+            GC_EXIT();
+            return (void *)PTR_FROM_BLOCK(block);
+        }
+    }
+    GC_EXIT();
+    return NULL;
+}
+
+STATIC size_t gc_census_marked_blocks(void) {
+    size_t marked_blocks = 0;
+    size_t max_block = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
+    bool in_mark = false;
+    for (size_t block = 0; block < max_block; block++) {
+        size_t kind = ATB_GET_KIND(block);
+        in_mark = kind == AT_MARK || (in_mark && kind == AT_TAIL);
+        marked_blocks += in_mark;
+    }
+    return marked_blocks;
+}
+
+STATIC bool gc_census_is_root(void *const *roots, size_t n_roots, size_t block) {
+    for (size_t i = 0; i < n_roots; i++) {
+        if (VERIFY_PTR(roots[i]) && BLOCK_FROM_PTR(roots[i]) == block) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The roots are marked before any is traced so that tracing stops at them. The mark bits are
+// cleared again at the end, so this has to run with the GC locked and no sweep pending.
+void gc_census_retained(void *const *roots, size_t n_roots, size_t *bytes) {
+    GC_ENTER();
+    MP_STATE_THREAD(gc_lock_depth)++;
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_continue(SWEEP_END_BLOCK, true);
+    #endif
+    MP_STATE_MEM(gc_stack_overflow) = 0;
+
+    for (size_t i = 0; i < n_roots; i++) {
+        bytes[i] = 0;
+        if (VERIFY_PTR(roots[i]) && ATB_GET_KIND(BLOCK_FROM_PTR(roots[i])) == AT_HEAD) {
+            ATB_HEAD_TO_MARK(BLOCK_FROM_PTR(roots[i]));
+        }
+    }
+    size_t marked_blocks = gc_census_marked_blocks();
+    size_t max_block = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
+    for (size_t i = 0; i < n_roots; i++) {
+        if (!VERIFY_PTR(roots[i]) || ATB_GET_KIND(BLOCK_FROM_PTR(roots[i])) != AT_MARK) {
+            continue;
+        }
+        size_t root_block = BLOCK_FROM_PTR(roots[i]);
+        size_t root_blocks = 0;
+        do {
+            root_blocks += 1;
+        } while (ATB_GET_KIND(root_block + root_blocks) == AT_TAIL);
+        gc_mark_subtree_with_stack(root_block, MP_STATE_MEM(gc_stack));
+        // Like gc_deal_with_stack_overflow(), except that the roots not yet traced are left alone.
+        while (MP_STATE_MEM(gc_stack_overflow)) {
+            MP_STATE_MEM(gc_stack_overflow) = 0;
+            for (size_t block = 0; block < max_block; block++) {
+                if (ATB_GET_KIND(block) == AT_MARK && !gc_census_is_root(roots + i + 1, n_roots - i - 1, block)) {
+                    gc_mark_subtree_with_stack(block, MP_STATE_MEM(gc_stack));
+                }
+            }
+        }
+        size_t now_marked = gc_census_marked_blocks();
+        bytes[i] = (now_marked - marked_blocks + root_blocks) * BYTES_PER_BLOCK;
+        marked_blocks = now_marked;
+    }
+
+    for (size_t block = 0; block < max_block; block++) {
+        if (ATB_GET_KIND(block) == AT_MARK) {
+            ATB_MARK_TO_HEAD(block);
+        }
+    }
+    MP_STATE_THREAD(gc_lock_depth)--;
+    GC_EXIT();
+}
+#endif
+
 // Mark can handle NULL pointers because it verifies the pointer is within the heap bounds.
 STATIC void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark)(void *ptr) {
+    #if MICROPY_GC_COMPACT
+    if (MP_STATE_MEM(gc_compact_buffers) != NULL) {
+        gc_compact_count_ref(ptr);
+        return;
+    }
+    #endif
     if (VERIFY_PTR(ptr)) {
         size_t block = BLOCK_FROM_PTR(ptr);
-        if (ATB_GET_KIND(block) == AT_HEAD) {
+        if (ATB_GET_KIND(block) == AT_HEAD && ATB_TRY_MARK(block)) {
             // An unmarked head: mark it, and mark all its children
             TRACE_MARK(block, ptr);
-            ATB_HEAD_TO_MARK(block);
             gc_mark_subtree(block);
         }
     }
@@ -371,6 +979,20 @@ void gc_collect_start(void) {
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_start_us) = mp_hal_ticks_us();
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Marking would skip the children of marked heads the last sweep hasn't reached yet.
+    gc_sweep_continue(SWEEP_END_BLOCK, true);
+    #endif
+
+    #if MICROPY_GC_MINOR_COLLECT
+    if (MP_STATE_MEM(gc_collect_minor)) {
+        gc_minor_mark_long_lived();
+    }
+    #endif
 
     // Trace root pointers.  This relies on the root pointers being organised
     // correctly in the mp_state_ctx structure.  We scan nlr_top, dict_locals,
@@ -378,7 +1000,22 @@ void gc_collect_start(void) {
     void **ptrs = (void **)(void *)&mp_state_ctx;
     size_t root_start = offsetof(mp_state_ctx_t, thread.dict_locals);
     size_t root_end = offsetof(mp_state_ctx_t, vm.qstr_last_chunk);
+    #if MICROPY_GC_PARALLEL_MARK
+    // The second core marks from these while this one goes on to the stacks and port roots.
+    MP_STATE_MEM(gc_helper_roots) = ptrs + root_start / sizeof(void *);
+    MP_STATE_MEM(gc_helper_root_count) = (root_end - root_start) / sizeof(void *);
+    #if MICROPY_GC_COMPACT
+    // Counting references for gc_compact() isn't done in parallel.
+    MP_STATE_MEM(gc_helper_running) = MP_STATE_MEM(gc_compact_buffers) == NULL && gc_port_start_mark_helper();
+    #else
+    MP_STATE_MEM(gc_helper_running) = gc_port_start_mark_helper();
+    #endif
+    if (!MP_STATE_MEM(gc_helper_running)) {
+        gc_collect_root(MP_STATE_MEM(gc_helper_roots), MP_STATE_MEM(gc_helper_root_count));
+    }
+    #else
     gc_collect_root(ptrs + root_start / sizeof(void *), (root_end - root_start) / sizeof(void *));
+    #endif
 
     gc_mark(MP_STATE_MEM(permanent_pointers));
 
@@ -417,12 +1054,36 @@ void gc_collect_root(void **ptrs, size_t len) {
 }
 
 void gc_collect_end(void) {
+    #if MICROPY_GC_COMPACT
+    // Counting references for gc_compact() doesn't mark anything to sweep.
+    if (MP_STATE_MEM(gc_compact_buffers) != NULL) {
+        MP_STATE_THREAD(gc_lock_depth)--;
+        GC_EXIT();
+        return;
+    }
+    #endif
+    #if MICROPY_GC_PARALLEL_MARK
+    if (MP_STATE_MEM(gc_helper_running)) {
+        gc_port_finish_mark_helper();
+        MP_STATE_MEM(gc_helper_running) = false;
+        #if MICROPY_GC_STATS
+        MP_STATE_MEM(gc_stats_marked_blocks) += MP_STATE_MEM(gc_helper_marked_blocks);
+        #endif
+    }
+    #endif
     gc_deal_with_stack_overflow();
     gc_sweep();
     for (size_t i = 0; i < MICROPY_ATB_INDICES; i++) {
         MP_STATE_MEM(gc_first_free_atb_index)[i] = 0;
     }
     MP_STATE_MEM(gc_last_free_atb_index) = MP_STATE_MEM(gc_alloc_table_byte_len) - 1;
+    #if MICROPY_GC_STATS
+    // A deferred sweep carries on after this, so only the part done here is counted.
+    mp_uint_t pause_us = mp_hal_ticks_us() - MP_STATE_MEM(gc_stats_start_us);
+    MP_STATE_MEM(gc_stats_collections)++;
+    MP_STATE_MEM(gc_stats_total_pause_us) += pause_us;
+    MP_STATE_MEM(gc_stats_max_pause_us) = MAX(MP_STATE_MEM(gc_stats_max_pause_us), pause_us);
+    #endif
     MP_STATE_THREAD(gc_lock_depth)--;
     GC_EXIT();
 }
@@ -431,9 +1092,24 @@ void gc_sweep_all(void) {
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_start_us) = mp_hal_ticks_us();
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_continue(SWEEP_END_BLOCK, true);
+    #endif
     gc_collect_end();
 }
 
+#if MICROPY_GC_INCREMENTAL_SWEEP
+void gc_collect_with_budget(mp_uint_t budget_us) {
+    MP_STATE_MEM(gc_sweep_deferred) = true;
+    gc_collect();
+    MP_STATE_MEM(gc_sweep_deferred) = false;
+    gc_sweep_step(budget_us, true);
+}
+#endif
+
 void gc_info(gc_info_t *info) {
     GC_ENTER();
     info->total = MP_STATE_MEM(gc_pool_end) - MP_STATE_MEM(gc_pool_start);
@@ -454,6 +1130,7 @@ void gc_info(gc_info_t *info) {
                 break;
 
             case AT_HEAD:
+            case AT_MARK:
                 info->used += 1;
                 len = 1;
                 break;
@@ -462,10 +1139,6 @@ void gc_info(gc_info_t *info) {
                 info->used += 1;
                 len += 1;
                 break;
-
-            case AT_MARK:
-                // shouldn't happen
-                break;
         }
 
         block++;
@@ -475,7 +1148,7 @@ void gc_info(gc_info_t *info) {
             kind = ATB_GET_KIND(block);
         }
 
-        if (finish || kind == AT_FREE || kind == AT_HEAD) {
+        if (finish || kind != AT_TAIL) {
             if (len == 1) {
                 info->num_1block += 1;
             } else if (len == 2) {
@@ -484,7 +1157,7 @@ void gc_info(gc_info_t *info) {
             if (len > info->max_block) {
                 info->max_block = len;
             }
-            if (finish || kind == AT_HEAD) {
+            if (finish || (kind & AT_HEAD)) {
                 if (len_free > info->max_free) {
                     info->max_free = len_free;
                 }
@@ -530,6 +1203,12 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags, bool long_lived) {
     size_t start_block;
     size_t n_free;
     bool collected = !MP_STATE_MEM(gc_auto_collect_enabled);
+    #if MICROPY_GC_MINOR_COLLECT
+    bool minor_collected = collected || long_lived;
+    #endif
+    #if MICROPY_GC_COMPACT_AUTO
+    bool compacted = false;
+    #endif
 
     #if MICROPY_GC_ALLOC_THRESHOLD
     if (!collected && MP_STATE_MEM(gc_alloc_amount) >= MP_STATE_MEM(gc_alloc_threshold)) {
@@ -557,6 +1236,11 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags, bool long_lived) {
         n_free = 0;
         // look for a run of n_blocks available blocks
         for (size_t i = start; keep_looking && first_free <= i && i <= MP_STATE_MEM(gc_last_free_atb_index); i += direction) {
+            #if MICROPY_GC_FREE_RUN_INDEX
+            if (gc_free_run_skip_chunk(&i, direction, n_blocks, &n_free, first_free, crossover_block, collected)) {
+                continue;
+            }
+            #endif
             byte a = MP_STATE_MEM(gc_alloc_table_start)[i];
             // Four ATB states are packed into a single byte.
             int j = 0;
@@ -586,10 +1270,43 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags, bool long_lived) {
         }
 
         GC_EXIT();
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        // Finishing a pending sweep is cheaper than a collection.
+        if (gc_sweep_pending()) {
+            gc_sweep_finish();
+            keep_looking = true;
+            GC_ENTER();
+            continue;
+        }
+        #endif
         // nothing found!
         if (collected) {
+            #if MICROPY_GC_COMPACT_AUTO
+            // Moving buffers down the heap may join enough free blocks together.
+            if (!compacted && MP_STATE_MEM(gc_auto_collect_enabled)) {
+                compacted = true;
+                if (gc_compact_heap() > 0) {
+                    keep_looking = true;
+                    GC_ENTER();
+                    continue;
+                }
+            }
+            #endif
             return NULL;
         }
+        #if MICROPY_GC_MINOR_COLLECT
+        // Most short lived garbage is found without tracing or sweeping the long lived area.
+        if (!minor_collected && NURSERY_END_ATB < MP_STATE_MEM(gc_alloc_table_byte_len)) {
+            DEBUG_printf("gc_alloc(" UINT_FMT "): no free mem, triggering minor GC\n", n_bytes);
+            MP_STATE_MEM(gc_collect_minor) = true;
+            gc_collect();
+            MP_STATE_MEM(gc_collect_minor) = false;
+            minor_collected = true;
+            keep_looking = true;
+            GC_ENTER();
+            continue;
+        }
+        #endif
         DEBUG_printf("gc_alloc(" UINT_FMT "): no free mem, triggering GC\n", n_bytes);
         gc_collect();
         collected = true;
@@ -627,6 +1344,12 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags, bool long_lived) {
 
     // mark first block as used head
     ATB_FREE_TO_HEAD(start_block);
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // The pending sweep frees unmarked heads so mark any it hasn't reached yet.
+    if (start_block >= MP_STATE_MEM(gc_sweep_block)) {
+        ATB_HEAD_TO_MARK(start_block);
+    }
+    #endif
 
     // mark rest of blocks as used tail
     // TODO for a run of many blocks can make this more efficient
@@ -634,6 +1357,10 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags, bool long_lived) {
         ATB_FREE_TO_TAIL(bl);
     }
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    gc_free_run_mark_dirty(start_block, end_block);
+    #endif
+
     // get pointer to first block
     // we must create this pointer before unlocking the GC so a collection can find it
     void *ret_ptr = (void *)(MP_STATE_MEM(gc_pool_start) + start_block * BYTES_PER_BLOCK);
@@ -719,7 +1446,7 @@ void gc_free(void *ptr) {
         // get the GC block number corresponding to this pointer
         assert(VERIFY_PTR(ptr));
         size_t start_block = BLOCK_FROM_PTR(ptr);
-        assert(ATB_GET_KIND(start_block) == AT_HEAD);
+        assert(ATB_IS_HEAD(start_block));
 
         #if MICROPY_ENABLE_FINALISER
         FTB_CLEAR(start_block);
@@ -734,6 +1461,9 @@ void gc_free(void *ptr) {
             ATB_ANY_TO_FREE(block);
             block += 1;
         } while (ATB_GET_KIND(block) == AT_TAIL);
+        #if MICROPY_GC_FREE_RUN_INDEX
+        gc_free_run_mark_dirty(start_block, block - 1);
+        #endif
 
         // Update the first free pointer for our size only. Not much calls gc_free directly so there
         // is decent chance we'll want to allocate this size again. By only updating the specific
@@ -761,7 +1491,7 @@ size_t gc_nbytes(const void *ptr) {
     GC_ENTER();
     if (VERIFY_PTR(ptr)) {
         size_t block = BLOCK_FROM_PTR(ptr);
-        if (ATB_GET_KIND(block) == AT_HEAD) {
+        if (ATB_IS_HEAD(block)) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -873,7 +1603,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     // get the GC block number corresponding to this pointer
     assert(VERIFY_PTR(ptr));
     size_t block = BLOCK_FROM_PTR(ptr);
-    assert(ATB_GET_KIND(block) == AT_HEAD);
+    assert(ATB_IS_HEAD(block));
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -916,6 +1646,9 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         for (size_t bl = block + new_blocks, count = n_blocks - new_blocks; count > 0; bl++, count--) {
             ATB_ANY_TO_FREE(bl);
         }
+        #if MICROPY_GC_FREE_RUN_INDEX
+        gc_free_run_mark_dirty(block + new_blocks, block + n_blocks - 1);
+        #endif
 
         // set the last_free pointer to end of this block if it's earlier in the heap
         size_t new_free_atb = (block + new_blocks) / BLOCKS_PER_ATB;
@@ -951,6 +1684,9 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
             assert(ATB_GET_KIND(bl) == AT_FREE);
             ATB_FREE_TO_TAIL(bl);
         }
+        #if MICROPY_GC_FREE_RUN_INDEX
+        gc_free_run_mark_dirty(block + n_blocks, block + new_blocks - 1);
+        #endif
 
         GC_EXIT();
 
@@ -69,6 +69,42 @@ bool gc_alloc_possible(void);
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
+#if MICROPY_GC_COMPACT
+// Moves buffers down the heap to join free blocks together. Returns how many moved.
+size_t gc_compact(void);
+#endif
+
+#if MICROPY_GC_CENSUS
+// Returns the allocation after prev (the first one when prev is NULL), or NULL after the last
+// one, and sets *n_bytes to its size.
+void *gc_census_next(void *prev, size_t *n_bytes);
+// Sets bytes[i] to the heap retained by roots[i]: the allocations reachable from it, without
+// passing through another root, that no earlier root reaches.
+void gc_census_retained(void *const *roots, size_t n_roots, size_t *bytes);
+#endif
+
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Collects but only sweeps for up to budget_us. The rest of the sweep is left to
+// gc_sweep_step() and is finished by the next collection or failed allocation.
+void gc_collect_with_budget(mp_uint_t budget_us);
+bool gc_sweep_pending(void);
+// Sweeps for up to budget_us. Garbage with a finaliser is kept for the next
+// collection unless run_finalisers is set.
+void gc_sweep_step(mp_uint_t budget_us, bool run_finalisers);
+#endif
+
+#if MICROPY_GC_PARALLEL_MARK
+// Ports provide these to run gc_mark_helper() on another core until it is finished. Starting
+// returns false when the other core isn't available, and the roots are then marked in place.
+bool gc_port_start_mark_helper(void);
+void gc_port_finish_mark_helper(void);
+void gc_mark_helper(void);
+#if MICROPY_GC_PORT_ATB_FETCH_OR
+// Atomically ORs bits into an allocation table byte and returns its previous value.
+uint8_t gc_port_atb_fetch_or(uint8_t *atb, uint8_t bits);
+#endif
+#endif
+
 enum {
     GC_ALLOC_FLAG_HAS_FINALISER = 1,
 };
@@ -28,6 +28,7 @@
 #include "py/gc_long_lived.h"
 #include "py/gc.h"
 #include "py/mpstate.h"
+#include "py/runtime.h"
 
 mp_obj_fun_bc_t *make_fun_bc_long_lived(mp_obj_fun_bc_t *fun_bc, uint8_t max_depth) {
     #ifndef MICROPY_ENABLE_GC
@@ -101,6 +102,9 @@ mp_obj_dict_t *make_dict_long_lived(mp_obj_dict_t *dict, uint8_t max_depth) {
 
     // Update all of the references first so that we reduce the chance of references to the old
     // copies.
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    mp_load_global_cache_map_changed(&dict->map);
+    #endif
     dict->map.table = gc_make_long_lived(dict->map.table);
     for (size_t i = 0; i < dict->map.alloc; i++) {
         if (mp_map_slot_is_filled(&dict->map, i)) {
@@ -348,6 +348,14 @@ def parse_input_headers(infiles):
         sys.stderr.write("ERROR: Empty preprocessor output - check for errors above\n")
         sys.exit(1)
 
+    # The static qstrs and the special method names must keep their place, but
+    # the rest of the qstrs are sorted by their bytes so that qstr_find_strn can
+    # use a binary search over this part of the ROM pool.  (makeqstrdefs.py has
+    # already sorted the input lines, which almost gives this order.)
+    rest = sorted((q for q in qstrs.values() if q[0] >= 0), key=lambda q: bytes_cons(q[2], "utf8"))
+    for order, (_, ident, qstr) in enumerate(rest):
+        qstrs[ident] = (order, ident, qstr)
+
     return qcfgs, qstrs, i18ns
 
 
@@ -411,8 +419,15 @@ def print_qstr_enums(qstrs):
     print("QENUM(MP_QSTRnull)")
 
     # go through each qstr and print it out
+    sorted_first = None
     for order, ident, qstr in sorted(qstrs.values(), key=lambda x: x[0]):
         print("QENUM(MP_QSTR_%s)" % (ident,))
+        if order >= 0 and sorted_first is None:
+            sorted_first = ident
+
+    # the qstrs from this one to the end of the pool are sorted
+    if sorted_first is not None:
+        print("#define MP_QSTRsorted_first MP_QSTR_%s" % (sorted_first,))
 
 
 if __name__ == "__main__":
@@ -32,6 +32,7 @@
 #include "py/mpconfig.h"
 #include "py/misc.h"
 #include "py/runtime.h"
+#include "py/objstr.h"
 
 #include "supervisor/linker.h"
 
@@ -42,6 +43,12 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
+#if MICROPY_OPT_LOAD_GLOBAL_CACHE
+#define MAP_KEYS_CHANGED(map) mp_load_global_cache_map_changed(map)
+#else
+#define MAP_KEYS_CHANGED(map)
+#endif
+
 #if MICROPY_OPT_MAP_LOOKUP_CACHE
 // MP_STATE_VM(map_lookup_cache) provides a cache of index to the last known
 // position of that index in any map. On a cache hit, this allows
@@ -100,6 +107,8 @@ void mp_map_init(mp_map_t *map, size_t n) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
     map->is_ordered = 0;
+    map->is_versioned = 0;
+    map->has_index = 0;
 }
 
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
@@ -108,11 +117,14 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 1;
     map->is_ordered = 1;
+    map->is_versioned = 0;
+    map->has_index = 0;
     map->table = (mp_map_elem_t *)table;
 }
 
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
+    MAP_KEYS_CHANGED(map);
     if (!map->is_fixed) {
         m_del(mp_map_elem_t, map->table, map->alloc);
     }
@@ -120,6 +132,7 @@ void mp_map_deinit(mp_map_t *map) {
 }
 
 void mp_map_clear(mp_map_t *map) {
+    MAP_KEYS_CHANGED(map);
     if (!map->is_fixed) {
         m_del(mp_map_elem_t, map->table, map->alloc);
     }
@@ -127,6 +140,7 @@ void mp_map_clear(mp_map_t *map) {
     map->used = 0;
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
+    map->has_index = 0;
     map->table = NULL;
 }
 
@@ -134,6 +148,7 @@ STATIC void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
     size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
     DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
+    MAP_KEYS_CHANGED(map);
     mp_map_elem_t *old_table = map->table;
     mp_map_elem_t *new_table = m_new0(mp_map_elem_t, new_alloc);
     // If we reach this point, table resizing succeeded, now we can edit the old map.
@@ -149,6 +164,96 @@ STATIC void mp_map_rehash(mp_map_t *map) {
     m_del(mp_map_elem_t, old_table, old_alloc);
 }
 
+#if MICROPY_OPT_MAP_ORDERED_INDEX
+// The hash index of an ordered map is stored after the last slot of its table,
+// in the same heap block.  Each index slot holds the position of an entry in
+// the table, or all ones if it is empty, and collisions are resolved by linear
+// probing.  The index is only kept while all keys are strings, which hash
+// quickly and can't raise.  Removing entries moves the ones after them, so the
+// index is then rebuilt by the next lookup, which is also how a new index is
+// filled in.
+
+typedef struct _map_index_t {
+    size_t n_indexed; // number of table entries in the index, or SIZE_MAX if out of date
+    size_t mask; // number of index slots minus one
+} map_index_t;
+
+#define MAP_INDEX(map) ((map_index_t *)&(map)->table[(map)->alloc])
+#define MAP_INDEX_WIDE(map) ((map)->alloc >= 0xff)
+#define MAP_INDEX_EMPTY (0xffff)
+
+STATIC mp_uint_t map_index_hash(mp_obj_t key) {
+    GET_STR_HASH(key, hash);
+    if (hash == 0) {
+        GET_STR_DATA_LEN(key, data, len);
+        hash = qstr_compute_hash(data, len);
+    }
+    return hash;
+}
+
+STATIC size_t map_index_slots(size_t alloc) {
+    size_t n = 16;
+    while (n < 2 * alloc) {
+        n <<= 1;
+    }
+    return n;
+}
+
+STATIC size_t map_index_size(size_t alloc) {
+    return sizeof(map_index_t) + map_index_slots(alloc) * (alloc >= 0xff ? 2 : 1);
+}
+
+STATIC size_t map_index_get(mp_map_t *map, size_t slot) {
+    map_index_t *idx = MAP_INDEX(map);
+    if (MAP_INDEX_WIDE(map)) {
+        return ((uint16_t *)(idx + 1))[slot];
+    }
+    size_t pos = ((uint8_t *)(idx + 1))[slot];
+    return pos == 0xff ? MAP_INDEX_EMPTY : pos;
+}
+
+STATIC void map_index_add(mp_map_t *map, size_t pos) {
+    map_index_t *idx = MAP_INDEX(map);
+    size_t slot = map_index_hash(map->table[pos].key) & idx->mask;
+    while (map_index_get(map, slot) != MAP_INDEX_EMPTY) {
+        slot = (slot + 1) & idx->mask;
+    }
+    if (MAP_INDEX_WIDE(map)) {
+        ((uint16_t *)(idx + 1))[slot] = pos;
+    } else {
+        ((uint8_t *)(idx + 1))[slot] = pos;
+    }
+    idx->n_indexed = pos + 1;
+}
+
+STATIC void map_index_rebuild(mp_map_t *map) {
+    map_index_t *idx = MAP_INDEX(map);
+    idx->mask = map_index_slots(map->alloc) - 1;
+    memset(idx + 1, 0xff, map_index_size(map->alloc) - sizeof(map_index_t));
+    for (size_t pos = 0; pos < map->used; ++pos) {
+        map_index_add(map, pos);
+    }
+    idx->n_indexed = map->used;
+}
+
+STATIC mp_map_elem_t *map_index_lookup(mp_map_t *map, mp_obj_t index, bool compare_only_ptrs) {
+    map_index_t *idx = MAP_INDEX(map);
+    if (idx->n_indexed != map->used) {
+        map_index_rebuild(map);
+    }
+    for (size_t slot = map_index_hash(index) & idx->mask;; slot = (slot + 1) & idx->mask) {
+        size_t pos = map_index_get(map, slot);
+        if (pos == MAP_INDEX_EMPTY) {
+            return NULL;
+        }
+        mp_map_elem_t *elem = &map->table[pos];
+        if (elem->key == index || (!compare_only_ptrs && mp_obj_equal(elem->key, index))) {
+            return elem;
+        }
+    }
+}
+#endif
+
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
 // MP_MAP_LOOKUP_ADD_IF_NOT_FOUND behaviour:
@@ -190,14 +295,26 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         }
     }
 
-    // if the map is an ordered array then we must do a brute force linear search
+    // if the map is an ordered array then we must do a brute force linear search,
+    // unless it has a hash index
     if (map->is_ordered) {
-        for (mp_map_elem_t *elem = &map->table[0], *top = &map->table[map->used]; elem < top; elem++) {
+        mp_map_elem_t *top = &map->table[map->used];
+        mp_map_elem_t *elem = &map->table[0];
+        #if MICROPY_OPT_MAP_ORDERED_INDEX
+        if (map->has_index && mp_obj_is_str(index)) {
+            elem = map_index_lookup(map, index, compare_only_ptrs);
+            if (elem == NULL) {
+                elem = top;
+            }
+        }
+        #endif
+        for (; elem < top; elem++) {
             if (elem->key == index || (!compare_only_ptrs && mp_obj_equal(elem->key, index))) {
                 #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
                 if (MP_UNLIKELY(lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND)) {
                     // remove the found element by moving the rest of the array down
                     mp_obj_t value = elem->value;
+                    MAP_KEYS_CHANGED(map);
                     --map->used;
                     memmove(elem, elem + 1, (top - elem - 1) * sizeof(*elem));
                     // put the found element after the end so the caller can access it if needed
@@ -205,6 +322,11 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                     elem = &map->table[map->used];
                     elem->key = MP_OBJ_NULL;
                     elem->value = value;
+                    #if MICROPY_OPT_MAP_ORDERED_INDEX
+                    if (map->has_index) {
+                        MAP_INDEX(map)->n_indexed = SIZE_MAX;
+                    }
+                    #endif
                 }
                 #endif
                 MAP_CACHE_SET(index, elem - map->table);
@@ -215,17 +337,53 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         if (MP_LIKELY(lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)) {
             return NULL;
         }
+        MAP_KEYS_CHANGED(map);
         if (map->used == map->alloc) {
             // TODO: Alloc policy
+            #if MICROPY_OPT_MAP_ORDERED_INDEX
+            size_t old_size = map->alloc * sizeof(mp_map_elem_t);
+            if (map->has_index) {
+                old_size += map_index_size(map->alloc);
+            }
+            map->alloc += 4;
+            size_t new_size = map->alloc * sizeof(mp_map_elem_t);
+            bool has_index = map->alloc >= MICROPY_OPT_MAP_ORDERED_INDEX_MIN && map->alloc < MAP_INDEX_EMPTY;
+            for (size_t i = 0; has_index && i < map->used; ++i) {
+                has_index = mp_obj_is_str(map->table[i].key);
+            }
+            if (has_index) {
+                new_size += map_index_size(map->alloc);
+            }
+            map->table = (mp_map_elem_t *)m_renew(byte, map->table, old_size, new_size);
+            mp_seq_clear(map->table, map->used, map->alloc, sizeof(*map->table));
+            map->has_index = has_index;
+            if (has_index) {
+                // the index is built when it is next needed
+                MAP_INDEX(map)->n_indexed = SIZE_MAX;
+            }
+            #else
             map->alloc += 4;
             map->table = m_renew(mp_map_elem_t, map->table, map->used, map->alloc);
             mp_seq_clear(map->table, map->used, map->alloc, sizeof(*map->table));
+            #endif
         }
-        mp_map_elem_t *elem = map->table + map->used++;
+        elem = map->table + map->used++;
         elem->key = index;
         if (!mp_obj_is_qstr(index)) {
             map->all_keys_are_qstrs = 0;
         }
+        #if MICROPY_OPT_MAP_ORDERED_INDEX
+        if (map->has_index) {
+            if (!mp_obj_is_str(index)) {
+                map->has_index = 0;
+            } else if (MAP_INDEX(map)->n_indexed == map->used - 1) {
+                map_index_add(map, map->used - 1);
+            } else {
+                // dict.popitem() removes the last entry without updating the index
+                MAP_INDEX(map)->n_indexed = SIZE_MAX;
+            }
+        }
+        #endif
         return elem;
         #else
         return NULL;
@@ -258,6 +416,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         if (slot->key == MP_OBJ_NULL) {
             // found NULL slot, so index is not in table
             if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+                MAP_KEYS_CHANGED(map);
                 map->used += 1;
                 if (avail_slot == NULL) {
                     avail_slot = slot;
@@ -281,6 +440,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             // Note: CPython does not replace the index; try x={True:'true'};x[1]='one';x
             if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
                 // delete element in this slot
+                MAP_KEYS_CHANGED(map);
                 map->used--;
                 if (map->table[(pos + 1) % map->alloc].key == MP_OBJ_NULL) {
                     // optimisation if next slot is empty
@@ -302,6 +462,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
                 if (avail_slot != NULL) {
                     // there was an available slot, so use that
+                    MAP_KEYS_CHANGED(map);
                     map->used++;
                     avail_slot->key = index;
                     avail_slot->value = MP_OBJ_NULL;
@@ -26,20 +26,56 @@
 
 #include "py/mpstate.h"
 #include "py/obj.h"
+#include "py/runtime.h"
 #include "py/gc.h"
+#include "py/smallint.h"
 
 #if MICROPY_PY_GC && MICROPY_ENABLE_GC
 
-// collect(): run a garbage collection
-STATIC mp_obj_t py_gc_collect(void) {
-    gc_collect();
+STATIC mp_obj_t gc_collect_result(void) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     return MP_OBJ_NEW_SMALL_INT(MP_STATE_MEM(gc_collected));
     #else
     return mp_const_none;
     #endif
 }
+
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// collect(*, budget_us=None): run a garbage collection, optionally sweeping for at most
+// budget_us and leaving the rest of the sweep to background tasks
+STATIC mp_obj_t py_gc_collect(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_budget_us };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_budget_us, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (args[ARG_budget_us].u_obj == mp_const_none) {
+        gc_collect();
+    } else {
+        mp_int_t budget_us = mp_arg_validate_int_min(mp_obj_get_int(args[ARG_budget_us].u_obj), 0, MP_QSTR_budget_us);
+        gc_collect_with_budget(budget_us);
+    }
+    return gc_collect_result();
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(gc_collect_obj, 0, py_gc_collect);
+#else
+// collect(): run a garbage collection
+STATIC mp_obj_t py_gc_collect(void) {
+    gc_collect();
+    return gc_collect_result();
+}
 MP_DEFINE_CONST_FUN_OBJ_0(gc_collect_obj, py_gc_collect);
+#endif
+
+#if MICROPY_GC_COMPACT
+// compact(): collect and then move buffers to join free memory together
+STATIC mp_obj_t py_gc_compact(void) {
+    return MP_OBJ_NEW_SMALL_INT(gc_compact());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_compact_obj, py_gc_compact);
+#endif
 
 // disable(): disable the garbage collector
 STATIC mp_obj_t gc_disable(void) {
@@ -76,6 +112,30 @@ STATIC mp_obj_t gc_mem_alloc(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(gc_mem_alloc_obj, gc_mem_alloc);
 
+#if MICROPY_GC_STATS
+STATIC mp_obj_t gc_stats_int(uint64_t value) {
+    if (value <= (uint64_t)MP_SMALL_INT_MAX) {
+        return MP_OBJ_NEW_SMALL_INT(value);
+    }
+    return mp_obj_new_int_from_ull(value);
+}
+
+// stats(): return a tuple of (collections, total_pause_us, max_pause_us,
+// marked_blocks, stack_overflows, swept_bytes) counted since the heap was set up
+STATIC mp_obj_t gc_stats(void) {
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_collections)),
+        gc_stats_int(MP_STATE_MEM(gc_stats_total_pause_us)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_max_pause_us)),
+        gc_stats_int(MP_STATE_MEM(gc_stats_marked_blocks)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_stack_overflows)),
+        gc_stats_int(MP_STATE_MEM(gc_stats_swept_bytes)),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_stats_obj, gc_stats);
+#endif
+
 #if MICROPY_GC_ALLOC_THRESHOLD
 STATIC mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
     if (n_args == 0) {
@@ -98,11 +158,17 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
+    #if MICROPY_GC_COMPACT
+    { MP_ROM_QSTR(MP_QSTR_compact), MP_ROM_PTR(&gc_compact_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_disable), MP_ROM_PTR(&gc_disable_obj) },
     { MP_ROM_QSTR(MP_QSTR_enable), MP_ROM_PTR(&gc_enable_obj) },
     { MP_ROM_QSTR(MP_QSTR_isenabled), MP_ROM_PTR(&gc_isenabled_obj) },
     { MP_ROM_QSTR(MP_QSTR_mem_free), MP_ROM_PTR(&gc_mem_free_obj) },
     { MP_ROM_QSTR(MP_QSTR_mem_alloc), MP_ROM_PTR(&gc_mem_alloc_obj) },
+    #if MICROPY_GC_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&gc_stats_obj) },
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
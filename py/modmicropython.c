@@ -49,6 +49,39 @@ STATIC mp_obj_t mp_micropython_opt_level(size_t n_args, const mp_obj_t *args) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_opt_level_obj, 0, 1, mp_micropython_opt_level);
 #endif
 
+#if MICROPY_MODULE_COMPILE_CACHE
+STATIC mp_obj_t mp_micropython_compile_cache(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_bool(mp_compile_cache.enabled);
+    } else {
+        mp_compile_cache.enabled = mp_obj_is_true(args[0]);
+        return mp_const_none;
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_compile_cache_obj, 0, 1, mp_micropython_compile_cache);
+
+STATIC mp_obj_t mp_micropython_compile_cache_stats(void) {
+    mp_obj_t items[2] = {
+        mp_obj_new_int_from_uint(mp_compile_cache.hits),
+        mp_obj_new_int_from_uint(mp_compile_cache.misses),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(mp_micropython_compile_cache_stats_obj, mp_micropython_compile_cache_stats);
+#endif
+
+#if MICROPY_MPZ_PROMOTION_STATS
+STATIC mp_obj_t mp_micropython_mpz_promotions(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_int_from_uint(MP_STATE_VM(mpz_promotions));
+    } else {
+        MP_STATE_VM(mpz_promotions) = mp_obj_get_int(args[0]);
+        return mp_const_none;
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_mpz_promotions_obj, 0, 1, mp_micropython_mpz_promotions);
+#endif
+
 #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_PY_MICROPYTHON_MEM_INFO
 
 #if MICROPY_MEM_STATS
@@ -172,6 +205,13 @@ STATIC const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_ENABLE_COMPILER
     { MP_ROM_QSTR(MP_QSTR_opt_level), MP_ROM_PTR(&mp_micropython_opt_level_obj) },
     #endif
+    #if MICROPY_MODULE_COMPILE_CACHE
+    { MP_ROM_QSTR(MP_QSTR_compile_cache), MP_ROM_PTR(&mp_micropython_compile_cache_obj) },
+    { MP_ROM_QSTR(MP_QSTR_compile_cache_stats), MP_ROM_PTR(&mp_micropython_compile_cache_stats_obj) },
+    #endif
+    #if MICROPY_MPZ_PROMOTION_STATS
+    { MP_ROM_QSTR(MP_QSTR_mpz_promotions), MP_ROM_PTR(&mp_micropython_mpz_promotions_obj) },
+    #endif
     #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_PY_MICROPYTHON_MEM_INFO
     #if MICROPY_MEM_STATS
     { MP_ROM_QSTR(MP_QSTR_mem_total), MP_ROM_PTR(&mp_micropython_mem_total_obj) },
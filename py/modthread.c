@@ -178,6 +178,15 @@ STATIC void *thread_entry(void *args_in) {
 
     ts.mp_pending_exception = MP_OBJ_NULL;
 
+    #if MICROPY_OPT_LOAD_METHOD_CACHE
+    memset(ts.load_method_cache, 0, sizeof(ts.load_method_cache));
+    ts.load_method_cache_fill.type = NULL;
+    #endif
+
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    memset(ts.load_global_cache, 0, sizeof(ts.load_global_cache));
+    #endif
+
     // set locals and globals from the calling context
     mp_locals_set(args->dict_locals);
     mp_globals_set(args->dict_globals);
@@ -306,6 +306,70 @@
 #define MICROPY_ATB_INDICES (8)
 #endif
 
+// Whether to keep a summary of the free runs in each chunk of the heap so that
+// allocations can skip chunks that can't hold them without scanning their atbs.
+// This costs 3 bytes per 2KB of heap and is worthwhile for large heaps.
+#ifndef MICROPY_GC_FREE_RUN_INDEX
+#define MICROPY_GC_FREE_RUN_INDEX (0)
+#endif
+
+// Whether gc.collect(budget_us=...) can leave the sweep of the heap unfinished so
+// that it continues in steps of at most MICROPY_GC_SWEEP_STEP_US from background
+// tasks. Marking still happens all at once. Requires mp_hal_ticks_us().
+#ifndef MICROPY_GC_INCREMENTAL_SWEEP
+#define MICROPY_GC_INCREMENTAL_SWEEP (0)
+#endif
+
+#ifndef MICROPY_GC_SWEEP_STEP_US
+#define MICROPY_GC_SWEEP_STEP_US (250)
+#endif
+
+// Whether a short lived allocation that runs into the long lived area first tries
+// a minor collection, which only frees blocks before the long lived area.
+#ifndef MICROPY_GC_MINOR_COLLECT
+#define MICROPY_GC_MINOR_COLLECT (0)
+#endif
+
+// Whether gc.compact() is available. It moves the item storage of bytearrays,
+// arrays and lists when nothing but their owner refers to it.
+#ifndef MICROPY_GC_COMPACT
+#define MICROPY_GC_COMPACT (0)
+#endif
+
+// Whether compaction is also tried when an allocation fails even after a collection.
+// Only safe when no code outside the heap (an SDK, an RTOS or DMA descriptors) keeps
+// pointers to buffers that the collector can't see.
+#ifndef MICROPY_GC_COMPACT_AUTO
+#define MICROPY_GC_COMPACT_AUTO (0)
+#endif
+
+// Whether the heap can be walked to account for what it holds, as uheap.census() does.
+#ifndef MICROPY_GC_CENSUS
+#define MICROPY_GC_CENSUS (0)
+#endif
+
+// How many of the largest movable buffers each compaction considers.
+#ifndef MICROPY_GC_COMPACT_BUFFERS
+#define MICROPY_GC_COMPACT_BUFFERS (16)
+#endif
+
+// Whether a second core marks from the VM's root pointers while the collecting core marks from
+// the stacks. The port provides gc_port_start_mark_helper() and gc_port_finish_mark_helper().
+#ifndef MICROPY_GC_PARALLEL_MARK
+#define MICROPY_GC_PARALLEL_MARK (0)
+#endif
+
+// Whether the port provides gc_port_atb_fetch_or() for parallel marking, for CPUs without
+// atomic read-modify-write instructions.
+#ifndef MICROPY_GC_PORT_ATB_FETCH_OR
+#define MICROPY_GC_PORT_ATB_FETCH_OR (0)
+#endif
+
+// Whether to count collections, their pauses and the work they do for gc.stats().
+#ifndef MICROPY_GC_STATS
+#define MICROPY_GC_STATS (0)
+#endif
+
 /*****************************************************************************/
 /* MicroPython emitters                                                     */
 
@@ -314,6 +378,19 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// Whether bytecode functions in .mpy files imported from a filesystem are
+// only loaded when first called.  Until then each function is a small stub
+// that records where its code is in the file.  The first call needs the heap
+// and the file, unchanged, so it raises if either isn't available.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_LAZY
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY (0)
+#endif
+
+// Bytecode functions smaller than this (in bytes) are loaded straight away
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_LAZY_MIN_SIZE
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY_MIN_SIZE (192)
+#endif
+
 // Whether to support saving of persistent code
 #ifndef MICROPY_PERSISTENT_CODE_SAVE
 #define MICROPY_PERSISTENT_CODE_SAVE (0)
@@ -385,8 +462,13 @@
 #define MICROPY_EMIT_XTENSAWIN (0)
 #endif
 
+// Whether to emit RISC-V RV32 (IMC) native code
+#ifndef MICROPY_EMIT_RV32
+#define MICROPY_EMIT_RV32 (0)
+#endif
+
 // Convenience definition for whether any native emitter is enabled
-#define MICROPY_EMIT_NATIVE (MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM || MICROPY_EMIT_XTENSA || MICROPY_EMIT_XTENSAWIN)
+#define MICROPY_EMIT_NATIVE (MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM || MICROPY_EMIT_XTENSA || MICROPY_EMIT_XTENSAWIN || MICROPY_EMIT_RV32)
 
 // Select prelude-as-bytes-object for certain emitters
 #define MICROPY_EMIT_NATIVE_PRELUDE_AS_BYTES_OBJ (MICROPY_EMIT_XTENSAWIN)
@@ -426,8 +508,10 @@
 // Configure dynamic compiler macros
 #if MICROPY_DYNAMIC_COMPILER
 #define MICROPY_PY_BUILTINS_STR_UNICODE_DYNAMIC (mp_dynamic_compiler.py_builtins_str_unicode)
+#define MICROPY_OPT_SUPERINSTRUCTIONS_DYNAMIC (mp_dynamic_compiler.opt_superinstructions)
 #else
 #define MICROPY_PY_BUILTINS_STR_UNICODE_DYNAMIC MICROPY_PY_BUILTINS_STR_UNICODE
+#define MICROPY_OPT_SUPERINSTRUCTIONS_DYNAMIC MICROPY_OPT_SUPERINSTRUCTIONS
 #endif
 
 // Whether to enable constant folding; eg 1+2 rewritten as 3
@@ -468,11 +552,27 @@
 #define MICROPY_COMP_RETURN_IF_EXPR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// Whether optimisation level 2 and above (eg mpy-cross -O2) replaces loads of
+// module-level constants (NAME = <literal>, assigned once) with their value,
+// compiles out the branches they make dead and leaves out unused private
+// top-level functions
+#ifndef MICROPY_COMP_GLOBAL_CONST
+#define MICROPY_COMP_GLOBAL_CONST (0)
+#endif
+
 // Whether to include parsing of f-string literals
 #ifndef MICROPY_COMP_FSTRING_LITERAL
 #define MICROPY_COMP_FSTRING_LITERAL (1)
 #endif
 
+// Whether mp_compile_file() compiles each top-level function and class of a
+// file as soon as it has been parsed, so its parse nodes can be freed before
+// the rest of the file is parsed. This bounds the peak memory of compiling a
+// file by its largest definition rather than by its total size.
+#ifndef MICROPY_COMP_INCREMENTAL
+#define MICROPY_COMP_INCREMENTAL (0)
+#endif
+
 /*****************************************************************************/
 /* Internal debugging stuff                                                  */
 
@@ -558,6 +658,66 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// Keep a hash index next to the table of ordered maps that can grow (that is,
+// OrderedDict) once they have MICROPY_OPT_MAP_ORDERED_INDEX_MIN slots, so
+// their lookups don't need a linear search.  The index holds one byte per
+// slot (two for more than 254 slots) with at most half of them in use, plus
+// two words.
+#ifndef MICROPY_OPT_MAP_ORDERED_INDEX
+#define MICROPY_OPT_MAP_ORDERED_INDEX (0)
+#endif
+
+#ifndef MICROPY_OPT_MAP_ORDERED_INDEX_MIN
+#define MICROPY_OPT_MAP_ORDERED_INDEX_MIN (8)
+#endif
+
+// Keep a hash index over the qstrs interned at runtime so that qstr_find_strn
+// doesn't need to search each of their pools.  The index holds two bytes per
+// slot with at most half of them in use.  It is dropped if there are ever more
+// than 65535 qstrs, and lookups then fall back to searching the pools.
+#ifndef MICROPY_OPT_QSTR_INDEX
+#define MICROPY_OPT_QSTR_INDEX (0)
+#endif
+
+// Do binary operations on two small ints inline in the VM rather than calling
+// mp_binary_op.  Ones that overflow, raise or have to allocate (true division
+// and divmod) still go through mp_binary_op.
+#ifndef MICROPY_OPT_VM_SMALL_INT_BINARY_OP
+#define MICROPY_OPT_VM_SMALL_INT_BINARY_OP (0)
+#endif
+
+// Cache what LOAD_ATTR and LOAD_METHOD found in a type's locals dict (or those of
+// its bases), indexed by the bytecode location and the type of the object. Any
+// store to a class attribute invalidates the whole cache. Each thread has its
+// own cache of MICROPY_OPT_LOAD_METHOD_CACHE_SIZE entries of 5 words each.
+#ifndef MICROPY_OPT_LOAD_METHOD_CACHE
+#define MICROPY_OPT_LOAD_METHOD_CACHE (0)
+#endif
+
+#ifndef MICROPY_OPT_LOAD_METHOD_CACHE_SIZE
+#define MICROPY_OPT_LOAD_METHOD_CACHE_SIZE (32)
+#endif
+
+// Cache the map slot LOAD_GLOBAL and LOAD_NAME found a name in, indexed by the
+// bytecode location. Adding or removing a name in any module's globals (or the
+// builtins) invalidates the whole cache; storing to an existing name doesn't.
+// Each thread has its own cache of MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE entries of
+// 4 words each.
+#ifndef MICROPY_OPT_LOAD_GLOBAL_CACHE
+#define MICROPY_OPT_LOAD_GLOBAL_CACHE (0)
+#endif
+
+#ifndef MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE
+#define MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE (32)
+#endif
+
+// Whether the bytecode emitter combines common sequences of opcodes into the
+// superinstructions listed at the end of py/bc0.h, and the VM can run them.
+// .mpy files that may contain them are marked with MPY_FEATURE_SUPERINSTRUCTIONS.
+#ifndef MICROPY_OPT_SUPERINSTRUCTIONS
+#define MICROPY_OPT_SUPERINSTRUCTIONS (0)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
@@ -674,6 +834,19 @@
 #define MICROPY_KBD_EXCEPTION (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// Whether mp_raise_OSError() raises preallocated exception objects for EAGAIN
+// and ETIMEDOUT, so that polling for I/O in a loop doesn't allocate.  Like the
+// KeyboardInterrupt object they are reused, so one that is kept after it has
+// been caught is reset by the next raise of the same errno.
+#ifndef MICROPY_PREALLOC_OSERROR
+#define MICROPY_PREALLOC_OSERROR (0)
+#endif
+
+// Number of traceback entries kept by a preallocated OSError; more are dropped
+#ifndef MICROPY_PREALLOC_OSERROR_TRACEBACK_LEN
+#define MICROPY_PREALLOC_OSERROR_TRACEBACK_LEN (4)
+#endif
+
 // Prefer to raise KeyboardInterrupt asynchronously (from signal or interrupt
 // handler) - if supported by a particular port.
 #ifndef MICROPY_ASYNC_KBD_INTR
@@ -738,6 +911,12 @@
 typedef long long mp_longint_impl_t;
 #endif
 
+// Count how many times a machine int was made into an mpz because it didn't
+// fit in a small int, for micropython.mpz_promotions().
+#ifndef MICROPY_MPZ_PROMOTION_STATS
+#define MICROPY_MPZ_PROMOTION_STATS (0)
+#endif
+
 // Whether to include information in the byte code to determine source
 // line number (increases RAM usage, but doesn't slow byte code execution)
 #ifndef MICROPY_ENABLE_SOURCE_LINE
@@ -890,6 +1069,24 @@ typedef double mp_float_t;
 #define MICROPY_MODULE_FROZEN (MICROPY_MODULE_FROZEN_STR || MICROPY_MODULE_FROZEN_MPY)
 #endif
 
+// Whether to cache the compiled form of imported .py files as .mpy files on
+// the filesystem, and import from the cache while the source is unchanged.
+// Requires MICROPY_VFS, MICROPY_PERSISTENT_CODE_LOAD and MICROPY_PERSISTENT_CODE_SAVE.
+#ifndef MICROPY_MODULE_COMPILE_CACHE
+#define MICROPY_MODULE_COMPILE_CACHE (0)
+#endif
+
+// Directory holding the compile cache files
+#ifndef MICROPY_MODULE_COMPILE_CACHE_DIR
+#define MICROPY_MODULE_COMPILE_CACHE_DIR "/.pycache"
+#endif
+
+// Whether the compile cache is in use at startup; micropython.compile_cache()
+// can turn it on at runtime
+#ifndef MICROPY_MODULE_COMPILE_CACHE_ENABLED
+#define MICROPY_MODULE_COMPILE_CACHE_ENABLED (0)
+#endif
+
 // Whether you can override builtins in the builtins module
 #ifndef MICROPY_CAN_OVERRIDE_BUILTINS
 #define MICROPY_CAN_OVERRIDE_BUILTINS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
@@ -1012,6 +1209,33 @@ typedef double mp_float_t;
 #define MICROPY_PY_BUILTINS_STR_UNICODE_CHECK (MICROPY_PY_BUILTINS_STR_UNICODE)
 #endif
 
+// Whether indexing a unicode str avoids walking its UTF-8 data from the start.
+// strs created at runtime record whether they are all ASCII, and long non-ASCII
+// strs get an index of the byte offset of every Nth character.
+#ifndef MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX
+#define MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX (0)
+#endif
+
+// Number of long strs whose character offset index is kept
+#ifndef MICROPY_PY_BUILTINS_STR_UNICODE_INDEX_CACHE_SIZE
+#define MICROPY_PY_BUILTINS_STR_UNICODE_INDEX_CACHE_SIZE (4)
+#endif
+
+// Number of characters between entries of a character offset index
+#ifndef MICROPY_PY_BUILTINS_STR_UNICODE_INDEX_STEP
+#define MICROPY_PY_BUILTINS_STR_UNICODE_INDEX_STEP (32)
+#endif
+
+// Slices of bytes objects at least this many bytes long, and covering at least a
+// quarter of the parent, share the parent's data instead of copying it. 0 disables.
+#ifndef MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN
+#if MICROPY_ENABLE_GC && MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES
+#define MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN (64)
+#else
+#define MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN (0)
+#endif
+#endif
+
 // Whether str.center() method provided
 #ifndef MICROPY_PY_BUILTINS_STR_CENTER
 #define MICROPY_PY_BUILTINS_STR_CENTER (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
@@ -1398,6 +1622,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_SYS_SETTRACE (0)
 #endif
 
+// Whether the VM maintains MP_STATE_THREAD(current_code_state) and the chain of
+// code_state->prev_state links, so the running call stack can be inspected
+// from outside the VM (eg by a sampling profiler). Required by sys.settrace.
+#ifndef MICROPY_VM_TRACK_CODE_STATE
+#define MICROPY_VM_TRACK_CODE_STATE (MICROPY_PY_SYS_SETTRACE)
+#endif
+
 // Whether to provide "sys.getsizeof" function
 #ifndef MICROPY_PY_SYS_GETSIZEOF
 #define MICROPY_PY_SYS_GETSIZEOF (0)
@@ -1522,6 +1753,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_URE_SUB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// Number of compiled patterns kept for reuse by the module-level re.match(),
+// re.search() and re.sub() functions. 0 disables the cache.
+#ifndef MICROPY_PY_URE_CACHE_SIZE
+#define MICROPY_PY_URE_CACHE_SIZE (4)
+#endif
+
 #ifndef MICROPY_PY_UHEAPQ
 #define MICROPY_PY_UHEAPQ (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -1627,6 +1864,11 @@ typedef double mp_float_t;
 #define MICROPY_PY_FRAMEBUF (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// Whether framebuf.FrameBuffer can be made over the pixels of a displayio.Bitmap
+#ifndef MICROPY_PY_FRAMEBUF_BITMAP
+#define MICROPY_PY_FRAMEBUF_BITMAP (0)
+#endif
+
 #ifndef MICROPY_PY_BTREE
 #define MICROPY_PY_BTREE (0)
 #endif
@@ -1919,6 +2161,22 @@ typedef double mp_float_t;
 #if MICROPY_COMP_CONST
 #error "MICROPY_PY_SYS_SETTRACE requires MICROPY_COMP_CONST to be disabled"
 #endif
+#if !MICROPY_VM_TRACK_CODE_STATE
+#error "MICROPY_PY_SYS_SETTRACE requires MICROPY_VM_TRACK_CODE_STATE to be enabled"
+#endif
+#endif
+#if MICROPY_MODULE_COMPILE_CACHE
+#if !MICROPY_VFS || !MICROPY_PERSISTENT_CODE_LOAD || !MICROPY_PERSISTENT_CODE_SAVE
+#error "MICROPY_MODULE_COMPILE_CACHE requires MICROPY_VFS, MICROPY_PERSISTENT_CODE_LOAD and MICROPY_PERSISTENT_CODE_SAVE to be enabled"
+#endif
+#endif
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+#if !MICROPY_PERSISTENT_CODE_LOAD || !MICROPY_HAS_FILE_READER
+#error "MICROPY_PERSISTENT_CODE_LOAD_LAZY requires MICROPY_PERSISTENT_CODE_LOAD and a file reader to be enabled"
+#endif
+#if MICROPY_PY_SYS_SETTRACE
+#error "MICROPY_PERSISTENT_CODE_LOAD_LAZY requires MICROPY_PY_SYS_SETTRACE to be disabled"
+#endif
 #endif
 
 #endif // MICROPY_INCLUDED_PY_MPCONFIG_H
@@ -45,6 +45,7 @@
 typedef struct mp_dynamic_compiler_t {
     uint8_t small_int_bits; // must be <= host small_int_bits
     bool py_builtins_str_unicode;
+    bool opt_superinstructions;
     uint8_t native_arch;
     uint8_t nlr_buf_num_regs;
 } mp_dynamic_compiler_t;
@@ -61,6 +62,27 @@ typedef struct _mp_sched_item_t {
     mp_obj_t arg;
 } mp_sched_item_t;
 
+#if MICROPY_OPT_LOAD_METHOD_CACHE
+typedef struct _mp_load_method_cache_entry_t {
+    const mp_obj_type_t *type;
+    // The type whose locals dict holds the member, which decides how it binds.
+    const mp_obj_type_t *owner;
+    mp_obj_t member;
+    qstr attr;
+    size_t version;
+} mp_load_method_cache_entry_t;
+#endif
+
+#if MICROPY_OPT_LOAD_GLOBAL_CACHE
+typedef struct _mp_load_global_cache_entry_t {
+    mp_obj_dict_t *globals;
+    qstr qst;
+    size_t version;
+    // The slot of globals or of the builtins that holds qst.
+    mp_map_elem_t *elem;
+} mp_load_global_cache_entry_t;
+#endif
+
 // This structure hold information about the memory allocation system.
 typedef struct _mp_state_mem_t {
     #if MICROPY_MEM_STATS
@@ -82,6 +104,15 @@ typedef struct _mp_state_mem_t {
     int gc_stack_overflow;
     MICROPY_GC_STACK_ENTRY_TYPE gc_stack[MICROPY_ALLOC_GC_STACK_SIZE];
 
+    #if MICROPY_GC_PARALLEL_MARK
+    // The roots the second core marks from, and its own mark stack.
+    void **gc_helper_roots;
+    size_t gc_helper_root_count;
+    size_t gc_helper_marked_blocks;
+    bool gc_helper_running;
+    MICROPY_GC_STACK_ENTRY_TYPE gc_helper_stack[MICROPY_ALLOC_GC_STACK_SIZE];
+    #endif
+
     // This variable controls auto garbage collection.  If set to false then the
     // GC won't automatically run when gc_alloc can't find enough blocks.  But
     // you can still allocate/free memory and also explicitly call gc_collect.
@@ -95,6 +126,41 @@ typedef struct _mp_state_mem_t {
     size_t gc_first_free_atb_index[MICROPY_ATB_INDICES];
     size_t gc_last_free_atb_index;
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    struct _gc_free_run_t *gc_free_run_index;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // The next block the sweep will look at. It is the end of the heap when no
+    // sweep is pending.
+    size_t gc_sweep_block;
+    // Set while gc_collect() should leave the sweep for gc_sweep_step().
+    bool gc_sweep_deferred;
+    #endif
+
+    #if MICROPY_GC_MINOR_COLLECT
+    // Set while gc_collect() should only collect blocks before the long lived area.
+    bool gc_collect_minor;
+    #endif
+
+    #if MICROPY_GC_COMPACT
+    // Set while gc_collect() should only count the root references to these
+    // buffers rather than mark anything.
+    struct _gc_compact_buffer_t *gc_compact_buffers;
+    size_t gc_compact_buffer_count;
+    #endif
+
+    #if MICROPY_GC_STATS
+    // Totals since gc_init() for gc.stats().
+    size_t gc_stats_collections;
+    uint64_t gc_stats_total_pause_us;
+    mp_uint_t gc_stats_max_pause_us;
+    mp_uint_t gc_stats_start_us;
+    uint64_t gc_stats_marked_blocks;
+    size_t gc_stats_stack_overflows;
+    uint64_t gc_stats_swept_bytes;
+    #endif
+
     #if MICROPY_PY_GC_COLLECT_RETVAL
     size_t gc_collected;
     #endif
@@ -119,6 +185,11 @@ typedef struct _mp_state_vm_t {
 
     qstr_pool_t *last_pool;
 
+    #if MICROPY_OPT_QSTR_INDEX
+    // hash index of the qstrs in the pools allocated at runtime, see qstr.c
+    uint16_t *qstr_index;
+    #endif
+
     #if MICROPY_TRACKED_ALLOC
     struct _m_tracked_node_t *m_tracked_head;
     #endif
@@ -148,6 +219,14 @@ typedef struct _mp_state_vm_t {
     // exception object of type ReloadException
     mp_obj_exception_t mp_reload_exception;
 
+    #if MICROPY_PREALLOC_OSERROR
+    // exception objects of type OSError for EAGAIN and ETIMEDOUT, and storage
+    // for their tracebacks
+    mp_obj_exception_t mp_prealloc_oserror[2];
+    mp_obj_traceback_t mp_prealloc_oserror_traceback[2];
+    size_t mp_prealloc_oserror_traceback_data[2][MICROPY_PREALLOC_OSERROR_TRACEBACK_LEN * 3];
+    #endif
+
     // dictionary with loaded modules (may be exposed as sys.modules)
     mp_obj_dict_t mp_loaded_modules_dict;
 
@@ -190,6 +269,17 @@ typedef struct _mp_state_vm_t {
 
     // root pointers for extmod
 
+    #if MICROPY_PY_URE && MICROPY_PY_URE_CACHE_SIZE
+    // most recently used compiled patterns, first entry is the newest
+    mp_obj_t re_cache[MICROPY_PY_URE_CACHE_SIZE];
+    #endif
+
+    #if MICROPY_PY_BUILTINS_STR_UNICODE && MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX
+    // character offset indexes of the most recently indexed long strs, see
+    // objstrunicode.c
+    struct _mp_str_index_t *str_index_cache[MICROPY_PY_BUILTINS_STR_UNICODE_INDEX_CACHE_SIZE];
+    #endif
+
     #if MICROPY_REPL_EVENT_DRIVEN
     vstr_t *repl_line;
     #endif
@@ -209,11 +299,19 @@ typedef struct _mp_state_vm_t {
     size_t qstr_last_alloc;
     size_t qstr_last_used;
 
+    #if MICROPY_OPT_QSTR_INDEX
+    size_t qstr_index_alloc;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make qstr interning thread-safe.
     mp_thread_mutex_t qstr_mutex;
     #endif
 
+    #if MICROPY_MPZ_PROMOTION_STATS
+    mp_uint_t mpz_promotions;
+    #endif
+
     #if MICROPY_ENABLE_COMPILER
     mp_uint_t mp_optimise_value;
     #if MICROPY_EMIT_NATIVE
@@ -241,6 +339,16 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    #if MICROPY_OPT_LOAD_METHOD_CACHE
+    // Bumped to invalidate every thread's load_method_cache.
+    size_t load_method_cache_version;
+    #endif
+
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    // Bumped to invalidate every thread's load_global_cache.
+    size_t load_global_cache_version;
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread.
@@ -283,9 +391,26 @@ typedef struct _mp_state_thread_t {
     // If MP_OBJ_STOP_ITERATION is propagated then this holds its argument.
     mp_obj_t stop_iteration_arg;
 
+    #if MICROPY_OPT_LOAD_METHOD_CACHE
+    // See mp_load_method_cached. Being root pointers keeps the cached types
+    // alive, so their addresses can't be reused by other types.
+    mp_load_method_cache_entry_t load_method_cache[MICROPY_OPT_LOAD_METHOD_CACHE_SIZE];
+    // The last lookup that can be cached, for mp_load_method_cached to pick up.
+    mp_load_method_cache_entry_t load_method_cache_fill;
+    #endif
+
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    // See mp_load_global_cached. Keeping the globals dicts alive means their
+    // addresses can't be reused by other dicts.
+    mp_load_global_cache_entry_t load_global_cache[MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE];
+    #endif
+
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+
+    #if MICROPY_VM_TRACK_CODE_STATE
     struct _mp_code_state_t *current_code_state;
     #endif
 } mp_state_thread_t;
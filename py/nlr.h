@@ -42,6 +42,8 @@
 #define MICROPY_NLR_NUM_REGS_AARCH64        (13)
 #define MICROPY_NLR_NUM_REGS_XTENSA         (10)
 #define MICROPY_NLR_NUM_REGS_XTENSAWIN      (17)
+// newlib's RISC-V jmp_buf, which has room for 14 integer and 12 double registers
+#define MICROPY_NLR_NUM_REGS_RV32I          (14 + 12 * 2)
 
 // *FORMAT-OFF*
 
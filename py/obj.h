@@ -441,7 +441,9 @@ typedef struct _mp_map_t {
     size_t is_ordered : 1;  // an ordered array
     size_t scanning : 1;    // true if we're in the middle of scanning linked dictionaries,
                             // e.g., make_dict_long_lived()
-    size_t used : (8 * sizeof(size_t) - 4);
+    size_t is_versioned : 1; // changes to its keys invalidate mp_load_global_cached()
+    size_t has_index : 1;   // an ordered array with a hash index after the table
+    size_t used : (8 * sizeof(size_t) - 6);
     size_t alloc;
     mp_map_elem_t *table;
 } mp_map_t;
@@ -466,10 +466,14 @@ STATIC mp_obj_t array_extend(mp_obj_t self_in, mp_obj_t arg_in) {
         size_t len = arg_bufinfo.len / sz;
 
         // make sure we have enough room to extend
-        // TODO: alloc policy; at the moment we go conservative
         if (self->free < len) {
-            self->items = m_renew(byte, self->items, (self->len + self->free) * sz, (self->len + len) * sz);
-            self->free = 0;
+            // Grow by half again once there is data, so that a series of extends is
+            // amortised; the first extend of an empty array allocates just what it needs.
+            size_t new_len = self->len + len;
+            size_t new_free = self->len > 0 ? new_len / 2 : 0;
+            self->items = m_renew(byte, self->items, (self->len + self->free) * sz, (new_len + new_free) * sz);
+            mp_seq_clear(self->items, new_len, new_len + new_free, sz);
+            self->free = new_free;
         } else {
             self->free -= len;
         }
@@ -353,6 +353,9 @@ STATIC mp_obj_t dict_popitem(mp_obj_t self_in) {
     #endif
     mp_map_elem_t *next = dict_iter_next(self, &cur);
     assert(next);
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    mp_load_global_cache_map_changed(&self->map);
+    #endif
     self->map.used--;
     mp_obj_t items[] = {next->key, next->value};
     next->key = MP_OBJ_SENTINEL; // must mark key as sentinel to indicate that it was deleted
@@ -161,6 +161,38 @@ void mp_obj_exception_initialize0(mp_obj_exception_t *o_exc, const mp_obj_type_t
     mp_obj_exception_clear_traceback(o_exc);
 }
 
+#if MICROPY_PREALLOC_OSERROR
+STATIC const mp_rom_obj_tuple_t prealloc_oserror_args_eagain = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_EAGAIN)}};
+STATIC const mp_rom_obj_tuple_t prealloc_oserror_args_etimedout = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_ETIMEDOUT)}};
+
+mp_obj_t mp_obj_exception_prealloc_oserror(int errno_) {
+    size_t i;
+    const mp_rom_obj_tuple_t *args;
+    if (errno_ == MP_EAGAIN) {
+        i = 0;
+        args = &prealloc_oserror_args_eagain;
+    } else if (errno_ == MP_ETIMEDOUT) {
+        i = 1;
+        args = &prealloc_oserror_args_etimedout;
+    } else {
+        return MP_OBJ_NULL;
+    }
+
+    mp_obj_exception_t *o_exc = &MP_STATE_VM(mp_prealloc_oserror)[i];
+    mp_obj_exception_initialize0(o_exc, &mp_type_OSError);
+    o_exc->args = (mp_obj_tuple_t *)args;
+
+    // the traceback uses fixed storage, which mp_obj_exception_add_traceback never grows
+    mp_obj_traceback_t *tb = &MP_STATE_VM(mp_prealloc_oserror_traceback)[i];
+    *tb = mp_const_empty_traceback_obj;
+    tb->data = MP_STATE_VM(mp_prealloc_oserror_traceback_data)[i];
+    tb->alloc = MICROPY_PREALLOC_OSERROR_TRACEBACK_LEN * TRACEBACK_ENTRY_LEN;
+    o_exc->traceback = tb;
+
+    return MP_OBJ_FROM_PTR(o_exc);
+}
+#endif
+
 mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_arg_check_num(n_args, n_kw, 0, MP_OBJ_FUN_ARGS_MAX, false);
 
@@ -600,14 +632,20 @@ void mp_obj_exception_clear_traceback(mp_obj_t self_in) {
 void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qstr block) {
     mp_obj_exception_t *self = mp_obj_exception_get_native(self_in);
 
-    // Try to allocate memory for the traceback, with fallback to emergency traceback object
+    // Try to allocate memory for the traceback together with its first entry,
+    // with fallback to emergency traceback object
     if (self->traceback == NULL || self->traceback == (mp_obj_traceback_t *)&mp_const_empty_traceback_obj) {
-        self->traceback = m_new_obj_maybe(mp_obj_traceback_t);
+        self->traceback = m_new_obj_var_maybe(mp_obj_traceback_t, size_t, TRACEBACK_ENTRY_LEN);
         if (self->traceback == NULL) {
             self->traceback = &MP_STATE_VM(mp_emergency_traceback_obj);
+            // populate traceback object
+            *self->traceback = mp_const_empty_traceback_obj;
+        } else {
+            // populate traceback object, with the data stored inline
+            *self->traceback = mp_const_empty_traceback_obj;
+            self->traceback->data = (size_t *)(self->traceback + 1);
+            self->traceback->alloc = TRACEBACK_ENTRY_LEN;
         }
-        // populate traceback object
-        *self->traceback = mp_const_empty_traceback_obj;
     }
 
     // append the provided traceback info to traceback data
@@ -642,9 +680,25 @@ void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qs
             return;
         }
         #endif
+        #if MICROPY_PREALLOC_OSERROR
+        if (self->traceback >= &MP_STATE_VM(mp_prealloc_oserror_traceback)[0]
+            && self->traceback <= &MP_STATE_VM(mp_prealloc_oserror_traceback)[1]) {
+            // Can't resize the storage of a preallocated OSError
+            return;
+        }
+        #endif
         // be conservative with growing traceback data
-        size_t *tb_data = m_renew_maybe(size_t, self->traceback->data, self->traceback->alloc,
-            self->traceback->alloc + TRACEBACK_ENTRY_LEN, true);
+        size_t *tb_data;
+        if (self->traceback->data == (size_t *)(self->traceback + 1)) {
+            // the data is stored inline, so move it to its own allocation
+            tb_data = m_new_maybe(size_t, self->traceback->alloc + TRACEBACK_ENTRY_LEN);
+            if (tb_data != NULL) {
+                memcpy(tb_data, self->traceback->data, self->traceback->len * sizeof(size_t));
+            }
+        } else {
+            tb_data = m_renew_maybe(size_t, self->traceback->data, self->traceback->alloc,
+                self->traceback->alloc + TRACEBACK_ENTRY_LEN, true);
+        }
         if (tb_data == NULL) {
             return;
         }
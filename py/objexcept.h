@@ -44,6 +44,11 @@ typedef struct _mp_obj_exception_t {
 void mp_obj_exception_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t kind);
 void mp_obj_exception_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest);
 void mp_obj_exception_initialize0(mp_obj_exception_t *o_exc, const mp_obj_type_t *type);
+
+#if MICROPY_PREALLOC_OSERROR
+// Reset and return the preallocated OSError for errno_, or MP_OBJ_NULL if there isn't one.
+mp_obj_t mp_obj_exception_prealloc_oserror(int errno_);
+#endif
 mp_obj_exception_t *mp_obj_exception_get_native(mp_obj_t self_in);
 
 #define MP_DEFINE_EXCEPTION(exc_name, base_name) \
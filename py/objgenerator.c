@@ -199,6 +199,16 @@ STATIC void gen_instance_print(const mp_print_t *print, mp_obj_t self_in, mp_pri
     #endif
 }
 
+// A finished generator can never run again, but the object may still be
+// referenced (eg by a uasyncio Task, or by a local in "g = f(); await g").
+// Drop the references held by its locals and stack so the GC can reclaim
+// them without waiting for the generator object itself to become garbage.
+STATIC void gen_instance_release_state(mp_obj_gen_instance_t *self) {
+    for (size_t i = 0; i < self->code_state.n_state; ++i) {
+        self->code_state.state[i] = MP_OBJ_NULL;
+    }
+}
+
 mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_obj_t throw_value, mp_obj_t *ret_val) {
     MP_STACK_CHECK();
     mp_check_self(mp_obj_is_type(self_in, &mp_type_gen_instance));
@@ -267,6 +277,7 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
             self->code_state.ip = 0;
             // This is an optimised "raise StopIteration(*ret_val)".
             *ret_val = *self->code_state.sp;
+            gen_instance_release_state(self);
             break;
 
         case MP_VM_RETURN_YIELD:
@@ -279,6 +290,7 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
         case MP_VM_RETURN_EXCEPTION: {
             self->code_state.ip = 0;
             *ret_val = self->code_state.state[0];
+            gen_instance_release_state(self);
             // PEP479: if StopIteration is raised inside a generator it is replaced with RuntimeError
             if (mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(mp_obj_get_type(*ret_val)), MP_OBJ_FROM_PTR(&mp_type_StopIteration))) {
                 *ret_val = mp_obj_new_exception_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("generator raised StopIteration"));
@@ -390,12 +390,18 @@ mp_obj_t mp_obj_new_int(mp_int_t value) {
 }
 
 mp_obj_t mp_obj_new_int_from_ll(long long val) {
+    #if MICROPY_MPZ_PROMOTION_STATS
+    MP_STATE_VM(mpz_promotions) += 1;
+    #endif
     mp_obj_int_t *o = mp_obj_int_new_mpz();
     mpz_set_from_ll(&o->mpz, val, true);
     return MP_OBJ_FROM_PTR(o);
 }
 
 mp_obj_t mp_obj_new_int_from_ull(unsigned long long val) {
+    #if MICROPY_MPZ_PROMOTION_STATS
+    MP_STATE_VM(mpz_promotions) += 1;
+    #endif
     mp_obj_int_t *o = mp_obj_int_new_mpz();
     mpz_set_from_ll(&o->mpz, val, false);
     return MP_OBJ_FROM_PTR(o);
@@ -29,7 +29,6 @@
 
 #include "py/objlist.h"
 #include "py/runtime.h"
-#include "py/stackctrl.h"
 
 #include "supervisor/shared/translate/translate.h"
 
@@ -304,39 +303,287 @@ STATIC mp_obj_t list_pop(size_t n_args, const mp_obj_t *args) {
     return mp_obj_list_pop(self, index);
 }
 
-STATIC void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj_t binop_less_result) {
-    MP_STACK_CHECK();
-    while (head < tail) {
-        mp_obj_t *h = head - 1;
-        mp_obj_t *t = tail;
-        mp_obj_t v = key_fn == MP_OBJ_NULL ? tail[0] : mp_call_function_1(key_fn, tail[0]); // get pivot using key_fn
-        for (;;) {
-            do {++h;
-            } while (h < t && mp_binary_op(MP_BINARY_OP_LESS, key_fn == MP_OBJ_NULL ? h[0] : mp_call_function_1(key_fn, h[0]), v) == binop_less_result);
-            do {--t;
-            } while (h < t && mp_binary_op(MP_BINARY_OP_LESS, v, key_fn == MP_OBJ_NULL ? t[0] : mp_call_function_1(key_fn, t[0])) == binop_less_result);
-            if (h >= t) {
+// list.sort() is a stable merge sort.  Natural runs are found (descending ones
+// are reversed) and short ones are extended to SORT_MIN_RUN with a binary
+// insertion sort.  Runs are then merged, keeping the run lengths balanced as
+// in timsort.  Merges use a buffer of half the list.  If there is no memory
+// for that, merges that do not fit a short buffer are done in place by rotation.  With a key function, the keys are
+// computed once and sorted as (key, item) pairs if there is memory for them.
+
+#define SORT_MIN_RUN (16)
+// Elements in the merge buffer when there is no memory for half the list
+#define SORT_SHORT_TMP (64)
+// Enough for any list: run lengths grow at least as fast as Fibonacci numbers.
+#define SORT_MAX_RUNS (48)
+
+typedef struct _sort_ctx_t {
+    mp_obj_t *base;
+    // 1 when sorting items, 2 when sorting (key, item) pairs
+    size_t width;
+    // called on each comparison when it could not be cached
+    mp_obj_t key_fn;
+    bool reverse;
+    mp_obj_t *tmp;
+    size_t tmp_len;
+    // elements waiting in tmp during a merge, copied back if a comparison raises
+    mp_obj_t *pending_src;
+    mp_obj_t *pending_dst;
+    size_t pending_len;
+} sort_ctx_t;
+
+static inline void sort_copy(size_t w, mp_obj_t *dst, const mp_obj_t *src) {
+    dst[0] = src[0];
+    if (w == 2) {
+        dst[1] = src[1];
+    }
+}
+
+STATIC bool sort_less(sort_ctx_t *ctx, const mp_obj_t *a, const mp_obj_t *b) {
+    mp_obj_t x = a[0];
+    mp_obj_t y = b[0];
+    if (ctx->key_fn != MP_OBJ_NULL) {
+        x = mp_call_function_1(ctx->key_fn, x);
+        y = mp_call_function_1(ctx->key_fn, y);
+    }
+    if (ctx->reverse) {
+        mp_obj_t t = x;
+        x = y;
+        y = t;
+    }
+    if (mp_obj_is_small_int(x) && mp_obj_is_small_int(y)) {
+        return MP_OBJ_SMALL_INT_VALUE(x) < MP_OBJ_SMALL_INT_VALUE(y);
+    }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (mp_obj_is_float(x) && mp_obj_is_float(y)) {
+        return mp_obj_float_get(x) < mp_obj_float_get(y);
+    }
+    #endif
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, x, y));
+}
+
+STATIC void sort_reverse(sort_ctx_t *ctx, mp_obj_t *lo, mp_obj_t *hi) {
+    size_t w = ctx->width;
+    for (hi -= w; lo < hi; lo += w, hi -= w) {
+        for (size_t i = 0; i < w; i++) {
+            mp_obj_t t = lo[i];
+            lo[i] = hi[i];
+            hi[i] = t;
+        }
+    }
+}
+
+// Swap the adjacent blocks [lo, mid) and [mid, hi).
+STATIC void sort_rotate(sort_ctx_t *ctx, mp_obj_t *lo, mp_obj_t *mid, mp_obj_t *hi) {
+    sort_reverse(ctx, lo, mid);
+    sort_reverse(ctx, mid, hi);
+    sort_reverse(ctx, lo, hi);
+}
+
+// The first element of [lo, hi) that v sorts before, or after too if after_equal.
+STATIC mp_obj_t *sort_search(sort_ctx_t *ctx, mp_obj_t *lo, mp_obj_t *hi, const mp_obj_t *v, bool after_equal) {
+    size_t w = ctx->width;
+    while (lo < hi) {
+        mp_obj_t *m = lo + (hi - lo) / w / 2 * w;
+        if (after_equal ? sort_less(ctx, v, m) : !sort_less(ctx, m, v)) {
+            hi = m;
+        } else {
+            lo = m + w;
+        }
+    }
+    return lo;
+}
+
+// Sort [lo, hi) given that [lo, start) is sorted.
+STATIC void sort_insertion(sort_ctx_t *ctx, mp_obj_t *lo, mp_obj_t *start, mp_obj_t *hi) {
+    size_t w = ctx->width;
+    for (; start < hi; start += w) {
+        mp_obj_t *p = sort_search(ctx, lo, start, start, true);
+        if (p < start) {
+            mp_obj_t v[2];
+            sort_copy(w, v, start);
+            memmove(p + w, p, (start - p) * sizeof(mp_obj_t));
+            sort_copy(w, p, v);
+        }
+    }
+}
+
+// Return the end of the run starting at lo, reversing it if it is descending.
+STATIC mp_obj_t *sort_count_run(sort_ctx_t *ctx, mp_obj_t *lo, mp_obj_t *hi) {
+    size_t w = ctx->width;
+    mp_obj_t *p = lo + w;
+    if (p == hi) {
+        return p;
+    }
+    if (sort_less(ctx, p, lo)) {
+        // Strictly descending, so that reversing it keeps the sort stable.
+        for (p += w; p < hi && sort_less(ctx, p, p - w); p += w) {
+        }
+        sort_reverse(ctx, lo, p);
+    } else {
+        for (p += w; p < hi && !sort_less(ctx, p, p - w); p += w) {
+        }
+    }
+    return p;
+}
+
+STATIC void sort_merge(sort_ctx_t *ctx, mp_obj_t *lo, mp_obj_t *mid, mp_obj_t *hi) {
+    size_t w = ctx->width;
+    const size_t sz = sizeof(mp_obj_t);
+    // Elements of the left run that are already in place need not move, nor do
+    // those of the right run.
+    lo = sort_search(ctx, lo, mid, mid, true);
+    if (lo == mid) {
+        return;
+    }
+    hi = sort_search(ctx, mid, hi, mid - w, false);
+
+    if ((size_t)(mid - lo) > ctx->tmp_len && (size_t)(hi - mid) > ctx->tmp_len) {
+        // Move each stretch of the right run to the place it belongs in the left.
+        // On entry to the loop, *lo sorts after *mid.
+        while (lo < mid && mid < hi) {
+            mp_obj_t *p = sort_search(ctx, mid + w, hi, lo, false);
+            sort_rotate(ctx, lo, mid, p);
+            lo += p - mid + w;
+            mid = p;
+            if (mid < hi) {
+                lo = sort_search(ctx, lo, mid, mid, true);
+            }
+        }
+    } else if (mid - lo <= hi - mid) {
+        // Merge forwards with the left run in tmp.
+        memcpy(ctx->tmp, lo, (mid - lo) * sz);
+        ctx->pending_src = ctx->tmp;
+        ctx->pending_dst = lo;
+        ctx->pending_len = mid - lo;
+        mp_obj_t *b = mid;
+        while (ctx->pending_len > 0 && b < hi) {
+            if (sort_less(ctx, b, ctx->pending_src)) {
+                sort_copy(w, ctx->pending_dst, b);
+                b += w;
+            } else {
+                sort_copy(w, ctx->pending_dst, ctx->pending_src);
+                ctx->pending_src += w;
+                ctx->pending_len -= w;
+            }
+            ctx->pending_dst += w;
+        }
+    } else {
+        // Merge backwards with the right run in tmp.
+        memcpy(ctx->tmp, mid, (hi - mid) * sz);
+        ctx->pending_src = ctx->tmp;
+        ctx->pending_dst = mid;
+        ctx->pending_len = hi - mid;
+        mp_obj_t *out = hi;
+        while (ctx->pending_len > 0 && ctx->pending_dst > lo) {
+            out -= w;
+            if (sort_less(ctx, ctx->tmp + ctx->pending_len - w, ctx->pending_dst - w)) {
+                ctx->pending_dst -= w;
+                sort_copy(w, out, ctx->pending_dst);
+            } else {
+                ctx->pending_len -= w;
+                sort_copy(w, out, ctx->tmp + ctx->pending_len);
+            }
+        }
+    }
+    memcpy(ctx->pending_dst, ctx->pending_src, ctx->pending_len * sz);
+    ctx->pending_len = 0;
+}
+
+STATIC void sort_elements(sort_ctx_t *ctx, size_t n) {
+    struct {
+        mp_obj_t *start;
+        size_t len;
+    } runs[SORT_MAX_RUNS];
+    size_t n_runs = 0;
+    size_t w = ctx->width;
+    mp_obj_t *lo = ctx->base;
+    mp_obj_t *end = ctx->base + n * w;
+
+    while (lo < end) {
+        mp_obj_t *run_end = sort_count_run(ctx, lo, end);
+        if ((size_t)(run_end - lo) < SORT_MIN_RUN * w) {
+            mp_obj_t *force_end = (size_t)(end - lo) < SORT_MIN_RUN * w ? end : lo + SORT_MIN_RUN * w;
+            sort_insertion(ctx, lo, run_end, force_end);
+            run_end = force_end;
+        }
+        assert(n_runs < SORT_MAX_RUNS);
+        runs[n_runs].start = lo;
+        runs[n_runs].len = (run_end - lo) / w;
+        n_runs++;
+        lo = run_end;
+
+        // Merge until each run is longer than the next and than the two after
+        // it together, or when the list is done, until one run is left.
+        while (n_runs > 1) {
+            size_t i = n_runs - 2;
+            if ((i > 0 && runs[i - 1].len <= runs[i].len + runs[i + 1].len)
+                || (i > 1 && runs[i - 2].len <= runs[i - 1].len + runs[i].len)
+                || lo == end) {
+                if (i > 0 && runs[i - 1].len < runs[i + 1].len) {
+                    i--;
+                }
+            } else if (runs[i].len > runs[i + 1].len) {
                 break;
             }
-            mp_obj_t x = h[0];
-            h[0] = t[0];
-            t[0] = x;
+            sort_merge(ctx, runs[i].start, runs[i + 1].start, runs[i + 1].start + runs[i + 1].len * w);
+            runs[i].len += runs[i + 1].len;
+            if (i + 2 < n_runs) {
+                runs[i + 1] = runs[i + 2];
+            }
+            n_runs--;
         }
-        mp_obj_t x = h[0];
-        h[0] = tail[0];
-        tail[0] = x;
-        // do the smaller recursive call first, to keep stack within O(log(N))
-        if (t - head < tail - h - 1) {
-            mp_quicksort(head, t, key_fn, binop_less_result);
-            head = h + 1;
-        } else {
-            mp_quicksort(h + 1, tail, key_fn, binop_less_result);
-            tail = t;
+    }
+}
+
+STATIC void mp_sort(mp_obj_t *items, size_t n, mp_obj_t key_fn, bool reverse) {
+    sort_ctx_t ctx = { .base = items, .width = 1, .key_fn = key_fn, .reverse = reverse };
+    mp_obj_t *pairs = NULL;
+    if (key_fn != MP_OBJ_NULL) {
+        pairs = m_new_maybe(mp_obj_t, 2 * n);
+        if (pairs != NULL) {
+            for (size_t i = 0; i < n; i++) {
+                pairs[2 * i] = mp_call_function_1(key_fn, items[i]);
+                pairs[2 * i + 1] = items[i];
+            }
+            ctx.base = pairs;
+            ctx.width = 2;
+            ctx.key_fn = MP_OBJ_NULL;
+        }
+    }
+    // Fall back to a short buffer, so that only long merges are done in place.
+    ctx.tmp_len = n / 2 * ctx.width;
+    ctx.tmp = m_new_maybe(mp_obj_t, ctx.tmp_len);
+    if (ctx.tmp == NULL && ctx.tmp_len > SORT_SHORT_TMP * ctx.width) {
+        ctx.tmp_len = SORT_SHORT_TMP * ctx.width;
+        ctx.tmp = m_new_maybe(mp_obj_t, ctx.tmp_len);
+    }
+    if (ctx.tmp == NULL) {
+        ctx.tmp_len = 0;
+    }
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        sort_elements(&ctx, n);
+        nlr_pop();
+    } else {
+        // Keep every item in the list if a comparison raised mid-merge.
+        if (ctx.pending_len > 0) {
+            memcpy(ctx.pending_dst, ctx.pending_src, ctx.pending_len * sizeof(mp_obj_t));
+        }
+        nlr_jump(nlr.ret_val);
+    }
+
+    if (pairs != NULL) {
+        for (size_t i = 0; i < n; i++) {
+            items[i] = pairs[2 * i + 1];
         }
+        m_del(mp_obj_t, pairs, 2 * n);
+    }
+    if (ctx.tmp != NULL) {
+        m_del(mp_obj_t, ctx.tmp, ctx.tmp_len);
     }
 }
 
-// TODO Python defines sort to be stable but ours is not
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
@@ -354,9 +601,9 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_obj_list_t *self = native_list(pos_args[0]);
 
     if (self->len > 1) {
-        mp_quicksort(self->items, self->items + self->len - 1,
+        mp_sort(self->items, self->len,
             args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
-            args.reverse.u_bool ? mp_const_false : mp_const_true);
+            args.reverse.u_bool);
     }
 
     return mp_const_none;
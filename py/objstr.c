@@ -34,6 +34,7 @@
 #include "py/objtype.h"
 #include "py/runtime.h"
 #include "py/stackctrl.h"
+#include "py/gc.h"
 
 #include "supervisor/shared/translate/translate.h"
 
@@ -50,6 +51,53 @@ const char nibble_to_hex_upper[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8
 const char nibble_to_hex_lower[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
                                       'a', 'b', 'c', 'd', 'e', 'f'};
 
+#if MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN
+// A bytes slice whose data points into its parent's data instead of a copy of it. The view
+// holds the parent so that the GC keeps the data alive. Views are allocated a GC block larger
+// than other bytes objects, which is how they are told apart, and parent is cleared once a
+// view has been given data of its own.
+typedef struct _mp_obj_bytes_view_t {
+    mp_obj_str_t str;
+    mp_obj_t parent;
+} mp_obj_bytes_view_t;
+
+#define BYTES_VIEW_NBYTES (sizeof(mp_obj_str_t) + MICROPY_BYTES_PER_GC_BLOCK)
+
+// self_in must be of type bytes. Returns NULL unless it is a view that still shares its data.
+STATIC mp_obj_bytes_view_t *bytes_get_view(mp_obj_t self_in) {
+    mp_obj_bytes_view_t *self = MP_OBJ_TO_PTR(self_in);
+    if (gc_nbytes(self) < BYTES_VIEW_NBYTES || self->parent == MP_OBJ_NULL) {
+        return NULL;
+    }
+    return self;
+}
+
+STATIC mp_obj_t bytes_new_view(mp_obj_t parent, const byte *data, size_t len) {
+    // Refer to the object that owns the data so that intermediate views can be freed.
+    mp_obj_bytes_view_t *parent_view = bytes_get_view(parent);
+    if (parent_view != NULL) {
+        parent = parent_view->parent;
+    }
+    mp_obj_bytes_view_t *o = m_malloc(BYTES_VIEW_NBYTES, false);
+    o->str.base.type = &mp_type_bytes;
+    // The hash is computed when first needed.
+    o->str.hash = 0;
+    o->str.len = len;
+    o->str.data = data;
+    o->parent = parent;
+    return MP_OBJ_FROM_PTR(o);
+}
+
+// Copies the data of a view so that it is null terminated, as C strings are.
+STATIC void bytes_view_materialize(mp_obj_bytes_view_t *self) {
+    byte *p = m_new(byte, self->str.len + 1);
+    memcpy(p, self->str.data, self->str.len);
+    p[self->str.len] = '\0';
+    self->str.data = p;
+    self->parent = MP_OBJ_NULL;
+}
+#endif
+
 /******************************************************************************/
 /* str                                                                        */
 
@@ -176,6 +224,13 @@ mp_obj_t mp_obj_str_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_
                     return MP_OBJ_NEW_QSTR(q);
                 }
 
+                #if MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN
+                // A str can't keep the parent of a view alive, so it gets a copy.
+                if (bytes_get_view(args[0]) != NULL) {
+                    return mp_obj_new_str_copy(type, str_data, str_len);
+                }
+                #endif
+
                 mp_obj_str_t *o = MP_OBJ_TO_PTR(mp_obj_new_str_copy(type, NULL, str_len));
                 o->data = str_data;
                 o->hash = str_hash;
@@ -435,8 +490,9 @@ size_t str_offset_to_index(const mp_obj_type_t *type, const byte *self_data, siz
     return offset;
 }
 
-const byte *str_index_to_ptr(const mp_obj_type_t *type, const byte *self_data, size_t self_len,
+const byte *str_index_to_ptr(const mp_obj_type_t *type, mp_obj_t self_in, const byte *self_data, size_t self_len,
     mp_obj_t index, bool is_slice) {
+    (void)self_in;
     size_t index_val = mp_get_index(type, self_len, index, is_slice);
     return self_data + index_val;
 }
@@ -454,7 +510,16 @@ STATIC mp_obj_t bytes_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
             if (!mp_seq_get_fast_slice_indexes(self_len, index, &slice)) {
                 mp_raise_NotImplementedError(MP_ERROR_TEXT("only slices with step=1 (aka None) are supported"));
             }
-            return mp_obj_new_str_of_type(type, self_data + slice.start, slice.stop - slice.start);
+            size_t slice_len = slice.stop - slice.start;
+            #if MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN
+            // Small slices of large objects are copied so that they don't keep the whole
+            // parent alive.
+            if (type == &mp_type_bytes && slice_len >= MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN
+                && slice_len >= self_len / 4) {
+                return bytes_new_view(self_in, self_data + slice.start, slice_len);
+            }
+            #endif
+            return mp_obj_new_str_of_type(type, self_data + slice.start, slice_len);
         }
         #endif
         size_t index_val = mp_get_index(type, self_len, index, false);
@@ -729,10 +794,10 @@ STATIC mp_obj_t str_finder(size_t n_args, const mp_obj_t *args, int direction, b
     const byte *start = haystack;
     const byte *end = haystack + haystack_len;
     if (n_args >= 3 && args[2] != mp_const_none) {
-        start = str_index_to_ptr(self_type, haystack, haystack_len, args[2], true);
+        start = str_index_to_ptr(self_type, args[0], haystack, haystack_len, args[2], true);
     }
     if (n_args >= 4 && args[3] != mp_const_none) {
-        end = str_index_to_ptr(self_type, haystack, haystack_len, args[3], true);
+        end = str_index_to_ptr(self_type, args[0], haystack, haystack_len, args[3], true);
     }
 
     if (end < start) {
@@ -787,7 +852,7 @@ STATIC mp_obj_t str_startswith(size_t n_args, const mp_obj_t *args) {
     const char *prefix = mp_obj_str_get_data(args[1], &prefix_len);
     const byte *start = str;
     if (n_args > 2) {
-        start = str_index_to_ptr(self_type, str, str_len, args[2], true);
+        start = str_index_to_ptr(self_type, args[0], str, str_len, args[2], true);
     }
     if (prefix_len + (start - str) > str_len) {
         return mp_const_false;
@@ -971,10 +1036,10 @@ STATIC NORETURN void terse_str_format_value_error(void) {
 #define terse_str_format_value_error()
 #endif
 
-STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
+STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, size_t size_hint, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
     vstr_t vstr;
     mp_print_t print;
-    vstr_init_print(&vstr, 16, &print);
+    vstr_init_print(&vstr, size_hint, &print);
 
     for (; str < top; str++) {
         if (*str == '}') {
@@ -990,7 +1055,12 @@ STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
             #endif
         }
         if (*str != '{') {
-            vstr_add_byte(&vstr, *str);
+            // copy the whole run of literal text up to the next brace
+            const char *run = str;
+            while (str + 1 < top && str[1] != '{' && str[1] != '}') {
+                str++;
+            }
+            vstr_add_strn(&vstr, run, str + 1 - run);
             continue;
         }
 
@@ -1134,6 +1204,12 @@ STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
                 assert(conversion == 'r');
                 print_kind = PRINT_REPR;
             }
+            if (!format_spec) {
+                // "{}" or "{!r}": print straight into the result, without
+                // going through a temporary str
+                mp_obj_print_helper(&print, arg, print_kind);
+                continue;
+            }
             vstr_t arg_vstr;
             mp_print_t arg_print;
             vstr_init_print(&arg_vstr, 16, &arg_print);
@@ -1161,7 +1237,7 @@ STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
 
             // recursively call the formatter to format any nested specifiers
             MP_STACK_CHECK();
-            vstr_t format_spec_vstr = mp_obj_str_format_helper(format_spec, str, arg_i, n_args, args, kwargs);
+            vstr_t format_spec_vstr = mp_obj_str_format_helper(format_spec, str, 16, arg_i, n_args, args, kwargs);
             const char *s = vstr_null_terminated_str(&format_spec_vstr);
             const char *stop = s + format_spec_vstr.len;
             if (isalignment(*s)) {
@@ -1421,8 +1497,25 @@ mp_obj_t mp_obj_str_format(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs
     mp_check_self(mp_obj_is_str_or_bytes(args[0]));
 
     GET_STR_DATA_LEN(args[0], str, len);
+
+    // Size the result for the format string plus the text of any str
+    // arguments, and a few bytes for each other argument, so that it
+    // usually doesn't need to grow.
+    size_t size_hint = len;
+    for (size_t i = 1; i < n_args; i++) {
+        if (mp_obj_is_str_or_bytes(args[i])) {
+            GET_STR_LEN(args[i], l);
+            size_hint += l;
+        } else {
+            size_hint += 8;
+        }
+    }
+    if (kwargs != NULL) {
+        size_hint += kwargs->used * 8;
+    }
+
     int arg_i = 0;
-    vstr_t vstr = mp_obj_str_format_helper((const char *)str, (const char *)str + len, &arg_i, n_args, args, kwargs);
+    vstr_t vstr = mp_obj_str_format_helper((const char *)str, (const char *)str + len, size_hint, &arg_i, n_args, args, kwargs);
     return mp_obj_new_str_from_vstr(mp_obj_get_type(args[0]), &vstr);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(str_format_obj, 1, mp_obj_str_format);
@@ -1756,10 +1849,10 @@ STATIC mp_obj_t str_count(size_t n_args, const mp_obj_t *args) {
     const byte *start = haystack;
     const byte *end = haystack + haystack_len;
     if (n_args >= 3 && args[2] != mp_const_none) {
-        start = str_index_to_ptr(self_type, haystack, haystack_len, args[2], true);
+        start = str_index_to_ptr(self_type, args[0], haystack, haystack_len, args[2], true);
     }
     if (n_args >= 4 && args[3] != mp_const_none) {
-        end = str_index_to_ptr(self_type, haystack, haystack_len, args[3], true);
+        end = str_index_to_ptr(self_type, args[0], haystack, haystack_len, args[3], true);
     }
 
     // if needle_len is zero then we count each gap between characters as an occurrence
@@ -2045,6 +2138,26 @@ const mp_obj_type_t mp_type_bytes = {
 // The zero-length bytes object, with data that includes a null-terminating byte
 const mp_obj_str_t mp_const_empty_bytes_obj = {{&mp_type_bytes}, 0, 0, (const byte *)""};
 
+// The hash field for a new str/bytes object.  A str whose data is all ASCII also
+// gets MP_OBJ_STR_HASH_ASCII, so that it can be indexed by byte offset.
+STATIC mp_uint_t str_new_hash(const mp_obj_type_t *type, const byte *data, size_t len) {
+    mp_uint_t hash = qstr_compute_hash(data, len);
+    #if MICROPY_PY_BUILTINS_STR_UNICODE && MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX
+    if (type == &mp_type_str) {
+        byte bits = 0;
+        for (size_t i = 0; i < len; i++) {
+            bits |= data[i];
+        }
+        if (!UTF8_IS_NONASCII(bits)) {
+            hash |= MP_OBJ_STR_HASH_ASCII;
+        }
+    }
+    #else
+    (void)type;
+    #endif
+    return hash;
+}
+
 // Create a str/bytes object using the given data.  New memory is allocated and
 // the data is copied across.  This function should only be used if the type is bytes,
 // or if the type is str and the string data is known to be not interned.
@@ -2053,7 +2166,7 @@ mp_obj_t mp_obj_new_str_copy(const mp_obj_type_t *type, const byte *data, size_t
     o->base.type = type;
     o->len = len;
     if (data) {
-        o->hash = qstr_compute_hash(data, len);
+        o->hash = str_new_hash(type, data, len);
         byte *p = m_new(byte, len + 1);
         o->data = p;
         memcpy(p, data, len * sizeof(byte));
@@ -2096,7 +2209,7 @@ mp_obj_t mp_obj_new_str_from_vstr(const mp_obj_type_t *type, vstr_t *vstr) {
     mp_obj_str_t *o = m_new_obj(mp_obj_str_t);
     o->base.type = type;
     o->len = vstr->len;
-    o->hash = qstr_compute_hash((byte *)vstr->buf, vstr->len);
+    o->hash = str_new_hash(type, (byte *)vstr->buf, vstr->len);
     if (vstr->len + 1 == vstr->alloc) {
         o->data = (byte *)vstr->buf;
     } else {
@@ -2188,6 +2301,14 @@ qstr mp_obj_str_get_qstr(mp_obj_t self_in) {
 // at the moment all strings are zero terminated to help with C ASCIIZ compatibility
 const char *mp_obj_str_get_str(mp_obj_t self_in) {
     if (mp_obj_is_str_or_bytes(self_in)) {
+        #if MICROPY_PY_BUILTINS_BYTES_SLICE_VIEW_MIN
+        if (mp_obj_is_type(self_in, &mp_type_bytes)) {
+            mp_obj_bytes_view_t *view = bytes_get_view(self_in);
+            if (view != NULL) {
+                bytes_view_materialize(view);
+            }
+        }
+        #endif
         GET_STR_DATA_LEN(self_in, s, l);
         (void)l; // len unused
         return (const char *)s;
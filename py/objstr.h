@@ -38,11 +38,18 @@ typedef struct _mp_obj_str_t {
 
 #define MP_DEFINE_STR_OBJ(obj_name, str) mp_obj_str_t obj_name = {{&mp_type_str}, 0, sizeof(str) - 1, (const byte *)str}
 
+#if MICROPY_PY_BUILTINS_STR_UNICODE && MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX
+// set in the hash field of a str object whose data is all ASCII; qstr hashes never use this bit
+#define MP_OBJ_STR_HASH_ASCII (MP_OBJ_WORD_MSBIT_HIGH)
+#else
+#define MP_OBJ_STR_HASH_ASCII (0)
+#endif
+
 // use this macro to extract the string hash
 // warning: the hash can be 0, meaning invalid, and must then be explicitly computed from the data
 #define GET_STR_HASH(str_obj_in, str_hash) \
     mp_uint_t str_hash; if (mp_obj_is_qstr(str_obj_in)) \
-    { str_hash = qstr_hash(MP_OBJ_QSTR_VALUE(str_obj_in)); } else { str_hash = ((mp_obj_str_t *)MP_OBJ_TO_PTR(str_obj_in))->hash; }
+    { str_hash = qstr_hash(MP_OBJ_QSTR_VALUE(str_obj_in)); } else { str_hash = ((mp_obj_str_t *)MP_OBJ_TO_PTR(str_obj_in))->hash & ~MP_OBJ_STR_HASH_ASCII; }
 
 // use this macro to extract the string length
 #define GET_STR_LEN(str_obj_in, str_len) \
@@ -73,7 +80,7 @@ mp_int_t mp_obj_str_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_u
 
 size_t str_offset_to_index(const mp_obj_type_t *type, const byte *self_data, size_t self_len,
     size_t offset);
-const byte *str_index_to_ptr(const mp_obj_type_t *type, const byte *self_data, size_t self_len,
+const byte *str_index_to_ptr(const mp_obj_type_t *type, mp_obj_t self_in, const byte *self_data, size_t self_len,
     mp_obj_t index, bool is_slice);
 const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction);
 
@@ -108,12 +108,89 @@ STATIC void uni_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t
     }
 }
 
+#if MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX
+
+#define STR_INDEX_STEP (MICROPY_PY_BUILTINS_STR_UNICODE_INDEX_STEP)
+// Shorter strs are walked; building an index would cost more than it saves.
+#define STR_INDEX_MIN_LEN (4 * STR_INDEX_STEP)
+
+// Byte offsets of every STR_INDEX_STEP'th character of a str. Holding data keeps
+// it alive, and str data never changes, so the offsets stay valid while the
+// index is cached. An all ASCII str has charlen == len and no offsets.
+typedef struct _mp_str_index_t {
+    const byte *data;
+    size_t len;
+    size_t charlen;
+    size_t offsets[];
+} str_index_t;
+
+STATIC bool str_is_ascii(mp_obj_t self_in) {
+    return mp_obj_is_type(self_in, &mp_type_str)
+           && (((mp_obj_str_t *)MP_OBJ_TO_PTR(self_in))->hash & MP_OBJ_STR_HASH_ASCII);
+}
+
+STATIC str_index_t *str_index_new(const byte *data, size_t len) {
+    size_t charlen = utf8_charlen(data, len);
+    size_t n = charlen == len ? 0 : charlen / STR_INDEX_STEP + 1;
+    str_index_t *str_index = m_new_obj_var_maybe(str_index_t, size_t, n);
+    if (str_index == NULL) {
+        return NULL;
+    }
+    str_index->data = data;
+    str_index->len = len;
+    str_index->charlen = charlen;
+    if (n > 0) {
+        size_t c = 0;
+        for (size_t i = 0; i < len; i++) {
+            if (!UTF8_IS_CONT(data[i])) {
+                if (c % STR_INDEX_STEP == 0) {
+                    str_index->offsets[c / STR_INDEX_STEP] = i;
+                }
+                ++c;
+            }
+        }
+    }
+    return str_index;
+}
+
+// Return the cached index for a long str, building it if needed. Returns NULL for
+// short strs, or if there is no memory for the index.
+STATIC const str_index_t *str_index_get(const byte *data, size_t len) {
+    if (len < STR_INDEX_MIN_LEN) {
+        return NULL;
+    }
+    str_index_t **cache = MP_STATE_VM(str_index_cache);
+    size_t i = 0;
+    while (i < MICROPY_PY_BUILTINS_STR_UNICODE_INDEX_CACHE_SIZE - 1 && cache[i] != NULL
+           && (cache[i]->data != data || cache[i]->len != len)) {
+        i++;
+    }
+    str_index_t *str_index = cache[i];
+    if (str_index == NULL || str_index->data != data || str_index->len != len) {
+        str_index = str_index_new(data, len);
+        if (str_index == NULL) {
+            return NULL;
+        }
+    }
+    // Move the entry to the front, dropping the least recently used one if
+    // the cache is full.
+    memmove(&cache[1], &cache[0], i * sizeof(str_index_t *));
+    cache[0] = str_index;
+    return str_index;
+}
+#endif
+
 STATIC mp_obj_t uni_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     GET_STR_DATA_LEN(self_in, str_data, str_len);
     switch (op) {
         case MP_UNARY_OP_BOOL:
             return mp_obj_new_bool(str_len != 0);
         case MP_UNARY_OP_LEN:
+            #if MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX
+            if (str_is_ascii(self_in)) {
+                return MP_OBJ_NEW_SMALL_INT(str_len);
+            }
+            #endif
             return MP_OBJ_NEW_SMALL_INT(utf8_charlen(str_data, str_len));
         default:
             return MP_OBJ_NULL; // op not supported
@@ -142,7 +219,7 @@ size_t str_offset_to_index(const mp_obj_type_t *type, const byte *self_data, siz
 
 // Convert an index into a pointer to its lead byte. Out of bounds indexing will raise IndexError or
 // be capped to the first/last character of the string, depending on is_slice.
-const byte *str_index_to_ptr(const mp_obj_type_t *type, const byte *self_data, size_t self_len,
+const byte *str_index_to_ptr(const mp_obj_type_t *type, mp_obj_t self_in, const byte *self_data, size_t self_len,
     mp_obj_t index, bool is_slice) {
     // All str functions also handle bytes objects, and they call str_index_to_ptr(),
     // so it must handle bytes.
@@ -162,6 +239,41 @@ const byte *str_index_to_ptr(const mp_obj_type_t *type, const byte *self_data, s
         mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q, not %q"), MP_QSTR_index, MP_QSTR_int, mp_obj_get_type(index)->name);
     }
     const byte *s, *top = self_data + self_len;
+    #if MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX
+    // With a known length, bounds are checked up front. Then an ASCII str is
+    // indexed directly, and others walk from the nearest indexed character.
+    const str_index_t *str_index = NULL;
+    if (str_is_ascii(self_in) || (str_index = str_index_get(self_data, self_len)) != NULL) {
+        size_t charlen = str_index != NULL ? str_index->charlen : self_len;
+        if (i < 0) {
+            i += charlen;
+            if (i < 0) {
+                if (is_slice) {
+                    return self_data;
+                }
+                mp_raise_IndexError_varg(MP_ERROR_TEXT("%q index out of range"), MP_QSTR_str);
+            }
+        } else if ((size_t)i >= charlen) {
+            if (is_slice) {
+                return top;
+            }
+            mp_raise_IndexError_varg(MP_ERROR_TEXT("%q index out of range"), MP_QSTR_str);
+        }
+        if (charlen == self_len) {
+            return self_data + i;
+        }
+        s = self_data + str_index->offsets[i / STR_INDEX_STEP];
+        for (i %= STR_INDEX_STEP; i > 0; --i) {
+            ++s;
+            while (UTF8_IS_CONT(*s)) {
+                ++s;
+            }
+        }
+        return s;
+    }
+    #else
+    (void)self_in;
+    #endif
     if (i < 0) {
         // Negative indexing is performed by counting from the end of the string.
         for (s = top - 1; i; --s) {
@@ -224,14 +336,14 @@ STATIC mp_obj_t str_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
 
             const byte *pstart, *pstop;
             if (ostart != mp_const_none) {
-                pstart = str_index_to_ptr(type, self_data, self_len, ostart, true);
+                pstart = str_index_to_ptr(type, self_in, self_data, self_len, ostart, true);
             } else {
                 pstart = self_data;
             }
             if (ostop != mp_const_none) {
                 // pstop will point just after the stop character. This depends on
                 // the \0 at the end of the string.
-                pstop = str_index_to_ptr(type, self_data, self_len, ostop, true);
+                pstop = str_index_to_ptr(type, self_in, self_data, self_len, ostop, true);
             } else {
                 pstop = self_data + self_len;
             }
@@ -241,7 +353,7 @@ STATIC mp_obj_t str_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
             return mp_obj_new_str_of_type(type, (const byte *)pstart, pstop - pstart);
         }
         #endif
-        const byte *s = str_index_to_ptr(type, self_data, self_len, index, false);
+        const byte *s = str_index_to_ptr(type, self_in, self_data, self_len, index, false);
         int len = 1;
         if (UTF8_IS_NONASCII(*s)) {
             // Count the number of 1 bits (after the first)
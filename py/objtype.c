@@ -165,6 +165,11 @@ struct class_lookup_data {
     size_t meth_offset;
     mp_obj_t *dest;
     bool is_type;
+    #if MICROPY_OPT_LOAD_METHOD_CACHE
+    // Where dest came from, when it was converted from a member of a locals dict.
+    const mp_obj_type_t *owner;
+    mp_obj_t member;
+    #endif
 };
 
 STATIC void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_type_t *type) {
@@ -206,6 +211,10 @@ STATIC void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_t
                 } else {
                     mp_obj_instance_t *obj = lookup->obj;
                     mp_convert_member_lookup(MP_OBJ_FROM_PTR(obj), type, elem->value, lookup->dest);
+                    #if MICROPY_OPT_LOAD_METHOD_CACHE
+                    lookup->owner = type;
+                    lookup->member = elem->value;
+                    #endif
                 }
                 #if DEBUG_PRINT
                 DEBUG_printf("mp_obj_class_lookup: Returning: ");
@@ -650,6 +659,11 @@ STATIC void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
     if (member != MP_OBJ_NULL) {
         if (!(self->base.type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS)) {
             // Class doesn't have any special accessors to check so return straight away
+            #if MICROPY_OPT_LOAD_METHOD_CACHE
+            if (lookup.owner != NULL) {
+                mp_load_method_cache_offer(self->base.type, lookup.owner, lookup.member, attr);
+            }
+            #endif
             return;
         }
 
@@ -1123,6 +1137,9 @@ STATIC void type_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
                 // can't apply delete/store to a fixed map
                 return;
             }
+            #if MICROPY_OPT_LOAD_METHOD_CACHE
+            mp_load_method_cache_invalidate();
+            #endif
             if (dest[1] == MP_OBJ_NULL) {
                 // delete attribute
                 mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
@@ -242,6 +242,18 @@ typedef struct _parser_t {
     #if MICROPY_COMP_CONST
     mp_map_t consts;
     #endif
+
+    #if MICROPY_COMP_INCREMENTAL
+    mp_parse_stmt_hook_t stmt_hook;
+    void *stmt_hook_env;
+    // where the current top-level statement starts in the chunks
+    mp_parse_chunk_t *stmt_chunk;
+    size_t stmt_chunk_used;
+    mp_parse_chunk_t *stmt_tree_chunk;
+    // separate chunks holding the statements that the hook has dealt with
+    mp_parse_chunk_t *kept_cur_chunk;
+    mp_parse_chunk_t *kept_tree_chunk;
+    #endif
 } parser_t;
 
 STATIC const uint16_t *get_rule_arg(uint8_t r_id) {
@@ -297,6 +309,93 @@ STATIC void *parser_alloc(parser_t *parser, size_t num_bytes) {
 }
 #pragma GCC diagnostic pop
 
+STATIC void parser_close_chunk(parser_t *parser) {
+    // truncate current chunk and link into chain of chunks
+    mp_parse_chunk_t *chunk = parser->cur_chunk;
+    if (chunk != NULL) {
+        (void)m_renew_maybe(byte, chunk,
+            sizeof(mp_parse_chunk_t) + chunk->alloc,
+            sizeof(mp_parse_chunk_t) + chunk->union_.used,
+            false);
+        chunk->alloc = chunk->union_.used;
+        chunk->union_.next = parser->tree.chunk;
+        parser->tree.chunk = chunk;
+        parser->cur_chunk = NULL;
+    }
+}
+
+#if MICROPY_COMP_INCREMENTAL
+
+STATIC void parser_swap_chunks(parser_t *parser) {
+    mp_parse_chunk_t *chunk = parser->cur_chunk;
+    parser->cur_chunk = parser->kept_cur_chunk;
+    parser->kept_cur_chunk = chunk;
+    chunk = parser->tree.chunk;
+    parser->tree.chunk = parser->kept_tree_chunk;
+    parser->kept_tree_chunk = chunk;
+}
+
+STATIC void parser_mark_stmt(parser_t *parser) {
+    parser->stmt_chunk = parser->cur_chunk;
+    parser->stmt_chunk_used = parser->cur_chunk == NULL ? 0 : parser->cur_chunk->union_.used;
+    parser->stmt_tree_chunk = parser->tree.chunk;
+}
+
+STATIC void parser_free_to_stmt_mark(parser_t *parser) {
+    mp_parse_chunk_t *mark = parser->stmt_chunk;
+    if (parser->cur_chunk != mark) {
+        // free the chunks that were started after the mark, and reopen the
+        // chunk that was current at the mark if it has since been closed
+        m_del(byte, parser->cur_chunk, sizeof(mp_parse_chunk_t) + parser->cur_chunk->alloc);
+        while (parser->tree.chunk != parser->stmt_tree_chunk) {
+            mp_parse_chunk_t *chunk = parser->tree.chunk;
+            parser->tree.chunk = chunk->union_.next;
+            if (chunk != mark) {
+                m_del(byte, chunk, sizeof(mp_parse_chunk_t) + chunk->alloc);
+            }
+        }
+        parser->cur_chunk = mark;
+    }
+    if (mark != NULL) {
+        mark->union_.used = parser->stmt_chunk_used;
+    }
+}
+
+STATIC mp_parse_node_t parser_copy_node(parser_t *parser, mp_parse_node_t pn) {
+    if (!MP_PARSE_NODE_IS_STRUCT(pn)) {
+        return pn;
+    }
+    mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)pn;
+    size_t num_nodes = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
+    mp_parse_node_struct_t *copy = parser_alloc(parser, sizeof(mp_parse_node_struct_t) + sizeof(mp_parse_node_t) * num_nodes);
+    copy->source_line = pns->source_line;
+    copy->kind_num_nodes = pns->kind_num_nodes;
+    for (size_t i = 0; i < num_nodes; i++) {
+        if (MP_PARSE_NODE_STRUCT_KIND(pns) == RULE_const_object) {
+            // the nodes of a const object hold the object itself
+            copy->nodes[i] = pns->nodes[i];
+        } else {
+            copy->nodes[i] = parser_copy_node(parser, pns->nodes[i]);
+        }
+    }
+    return (mp_parse_node_t)copy;
+}
+
+STATIC void parser_finish_stmt(parser_t *parser) {
+    mp_parse_node_t pn = parser->result_stack[parser->result_stack_top - 1];
+    if (MP_PARSE_NODE_IS_STRUCT(pn) && parser->stmt_hook(parser->stmt_hook_env, pn)) {
+        // move what is left of the statement to the kept chunks and free the
+        // memory used to parse all of it
+        parser_swap_chunks(parser);
+        pn = parser_copy_node(parser, pn);
+        parser_swap_chunks(parser);
+        parser_free_to_stmt_mark(parser);
+        parser->result_stack[parser->result_stack_top - 1] = pn;
+    }
+}
+
+#endif
+
 STATIC void push_rule(parser_t *parser, size_t src_line, uint8_t rule_id, size_t arg_i) {
     if (parser->rule_stack_top >= parser->rule_stack_alloc) {
         rule_stack_t *rs = m_renew(rule_stack_t, parser->rule_stack, parser->rule_stack_alloc, parser->rule_stack_alloc + MICROPY_ALLOC_PARSE_RULE_INC);
@@ -870,7 +969,15 @@ STATIC void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     push_result_node(parser, (mp_parse_node_t)pn);
 }
 
+#if MICROPY_COMP_INCREMENTAL
+mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+    return mp_parse_incremental(lex, input_kind, NULL, NULL);
+}
+
+mp_parse_tree_t mp_parse_incremental(mp_lexer_t *lex, mp_parse_input_kind_t input_kind, mp_parse_stmt_hook_t stmt_hook, void *stmt_hook_env) {
+#else
 mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+#endif
 
     // initialise parser and allocate memory for its stacks
 
@@ -912,6 +1019,13 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     mp_map_init(&parser.consts, 0);
     #endif
 
+    #if MICROPY_COMP_INCREMENTAL
+    parser.stmt_hook = stmt_hook;
+    parser.stmt_hook_env = stmt_hook_env;
+    parser.kept_cur_chunk = NULL;
+    parser.kept_tree_chunk = NULL;
+    #endif
+
     // work out the top-level rule to use, and push it on the stack
     size_t top_level_rule;
     switch (input_kind) {
@@ -1099,6 +1213,16 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
             default: {
                 assert((rule_act & RULE_ACT_KIND_MASK) == RULE_ACT_LIST);
 
+                #if MICROPY_COMP_INCREMENTAL
+                if (rule_id == RULE_file_input_2 && !backtrack && parser.stmt_hook != NULL) {
+                    if (i > 0) {
+                        // a top-level statement has just been parsed
+                        parser_finish_stmt(&parser);
+                    }
+                    parser_mark_stmt(&parser);
+                }
+                #endif
+
                 // n=2 is: item item*
                 // n=1 is: item (sep item)*
                 // n=3 is: item (sep item)* [sep]
@@ -1190,15 +1314,22 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     #endif
 
     // truncate final chunk and link into chain of chunks
-    if (parser.cur_chunk != NULL) {
-        (void)m_renew_maybe(byte, parser.cur_chunk,
-            sizeof(mp_parse_chunk_t) + parser.cur_chunk->alloc,
-            sizeof(mp_parse_chunk_t) + parser.cur_chunk->union_.used,
-            false);
-        parser.cur_chunk->alloc = parser.cur_chunk->union_.used;
-        parser.cur_chunk->union_.next = parser.tree.chunk;
-        parser.tree.chunk = parser.cur_chunk;
+    parser_close_chunk(&parser);
+
+    #if MICROPY_COMP_INCREMENTAL
+    // link the kept chunks into the chain too
+    parser_swap_chunks(&parser);
+    parser_close_chunk(&parser);
+    parser_swap_chunks(&parser);
+    if (parser.kept_tree_chunk != NULL) {
+        mp_parse_chunk_t *chunk = parser.kept_tree_chunk;
+        while (chunk->union_.next != NULL) {
+            chunk = chunk->union_.next;
+        }
+        chunk->union_.next = parser.tree.chunk;
+        parser.tree.chunk = parser.kept_tree_chunk;
     }
+    #endif
 
     if (
         lex->tok_kind != MP_TOKEN_END // check we are at the end of the token stream
@@ -104,4 +104,15 @@ typedef struct _mp_parse_t {
 mp_parse_tree_t mp_parse(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind);
 void mp_parse_tree_clear(mp_parse_tree_t *tree);
 
+#if MICROPY_COMP_INCREMENTAL
+// Called for each top-level statement of file input as soon as it has been
+// parsed. If the hook returns true then the parser frees the memory used to
+// parse the statement and keeps a copy of what is left of pn instead, so the
+// hook should have cut out (set to MP_PARSE_NODE_NULL) the parts it dealt with.
+typedef bool (*mp_parse_stmt_hook_t)(void *env, mp_parse_node_t pn);
+
+// this has the same semantics as mp_parse
+mp_parse_tree_t mp_parse_incremental(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind, mp_parse_stmt_hook_t stmt_hook, void *stmt_hook_env);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_PARSE_H
@@ -175,6 +175,20 @@ STATIC void asm_thumb_rewrite_mov(uint8_t *pc, uint16_t val) {
 }
 #endif
 
+#if MICROPY_EMIT_RV32
+STATIC void asm_rv32_rewrite_lui_addi(uint8_t *pc, uint32_t val) {
+    // code is only 2-byte aligned, so access the bytes individually
+    uint32_t hi = (val + 0x800) >> 12;
+    // lui: imm[31:12] in bits 31:12
+    pc[1] = (pc[1] & 0x0f) | (hi << 4 & 0xf0);
+    pc[2] = hi >> 4;
+    pc[3] = hi >> 12;
+    // addi: imm[11:0] in bits 31:20
+    pc[6] = (pc[6] & 0x0f) | (val << 4 & 0xf0);
+    pc[7] = val >> 4;
+}
+#endif
+
 STATIC void arch_link_qstr(uint8_t *pc, bool is_obj, qstr qst) {
     mp_uint_t val = qst;
     if (is_obj) {
@@ -194,6 +208,9 @@ STATIC void arch_link_qstr(uint8_t *pc, bool is_obj, qstr qst) {
         // qstr number, movw instruction
         asm_thumb_rewrite_mov(pc, val); // movw
     }
+    #elif MICROPY_EMIT_RV32
+    // qstr number or object, lui and addi
+    asm_rv32_rewrite_lui_addi(pc, val);
     #endif
 }
 
@@ -353,6 +370,11 @@ STATIC void load_prelude(mp_reader_t *reader, qstr_window_t *qw, byte **ip, byte
     read_bytes(reader, ip_read, *ip - ip_read);
 }
 
+// Bytecode is always copied into RAM, even when the .mpy data is memory-mapped
+// (see mp_raw_code_load_mem): qstr operands are stored in the .mpy as strings
+// and have to be replaced by the qstr numbers of the running VM.  Bytecode that
+// runs in place from flash needs those numbers to be known at build time,
+// which is what freezing with tools/mpy-tool.py does.
 STATIC void load_bytecode(mp_reader_t *reader, qstr_window_t *qw, byte *ip, byte *ip_top) {
     while (ip < ip_top) {
         *ip = read_byte(reader);
@@ -374,7 +396,251 @@ STATIC void load_bytecode(mp_reader_t *reader, qstr_window_t *qw, byte *ip, byte
     }
 }
 
-STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, qstr_window_t *qw) {
+typedef struct _lazy_context_t lazy_context_t;
+
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+
+#if MICROPY_VFS
+#include "extmod/vfs.h"
+#endif
+
+#define LAZY_HASH_INIT (2166136261u)
+#define LAZY_HASH_STEP(h, b) (((h) ^ (b)) * 16777619u)
+
+// Wraps the reader of a .mpy file to track the position in the file and
+// compute a hash of the data of each raw code.  The hash of a raw code covers
+// its own bytes and the hashes of its children, so it comes out the same
+// whether the children are loaded or skipped.
+struct _lazy_context_t {
+    mp_reader_t reader;
+    qstr filename;
+    size_t pos;
+    uint32_t hash;
+    uint32_t last_hash; // hash of the raw code that was finished last
+    uint16_t depth;
+    bool defer;
+};
+
+// A bytecode function whose code is still in the .mpy file.  It is found in
+// the const_table of the function's stub, after the argument names.
+typedef struct _lazy_raw_code_t {
+    uint8_t kind; // MP_CODE_RESERVED, so that this isn't mistaken for a raw code
+    qstr filename;
+    size_t offset;
+    uint32_t hash;
+    mp_raw_code_t *rc;
+    const byte *fun_data; // set once the code is loaded
+    const mp_uint_t *const_table;
+    qstr_window_t qw; // state of the qstr window at offset
+} lazy_raw_code_t;
+
+STATIC mp_uint_t lazy_readbyte(void *data) {
+    lazy_context_t *ctx = data;
+    mp_uint_t b = ctx->reader.readbyte(ctx->reader.data);
+    if (b != MP_READER_EOF) {
+        ++ctx->pos;
+        ctx->hash = LAZY_HASH_STEP(ctx->hash, b);
+    }
+    return b;
+}
+
+STATIC void lazy_close(void *data) {
+    lazy_context_t *ctx = data;
+    ctx->reader.close(ctx->reader.data);
+}
+
+STATIC void lazy_reader_new(mp_reader_t *reader, lazy_context_t *ctx, qstr filename, size_t offset) {
+    mp_reader_new_file_at(&ctx->reader, qstr_str(filename), offset);
+    ctx->filename = filename;
+    ctx->pos = offset;
+    ctx->hash = LAZY_HASH_INIT;
+    ctx->last_hash = 0;
+    ctx->depth = 0;
+    ctx->defer = true;
+    reader->data = ctx;
+    reader->readbyte = lazy_readbyte;
+    reader->close = lazy_close;
+}
+
+// Functions are loaded after the current directory may have changed, so keep
+// the absolute path of the file
+STATIC qstr lazy_filename(const char *filename) {
+    #if MICROPY_VFS
+    if (filename[0] != '/') {
+        vstr_t vstr;
+        vstr_init(&vstr, 32);
+        vstr_add_str(&vstr, mp_obj_str_get_str(mp_vfs_getcwd()));
+        if (vstr.len == 0 || vstr.buf[vstr.len - 1] != '/') {
+            vstr_add_byte(&vstr, '/');
+        }
+        vstr_add_str(&vstr, filename);
+        qstr qst = qstr_from_strn(vstr.buf, vstr.len);
+        vstr_clear(&vstr);
+        return qst;
+    }
+    #endif
+    return qstr_from_str(filename);
+}
+
+STATIC uint32_t lazy_begin(lazy_context_t *ctx) {
+    uint32_t outer_hash = ctx->hash;
+    ctx->hash = LAZY_HASH_INIT;
+    ++ctx->depth;
+    return outer_hash;
+}
+
+STATIC void lazy_end(lazy_context_t *ctx, uint32_t outer_hash) {
+    ctx->last_hash = ctx->hash;
+    ctx->hash = LAZY_HASH_STEP(outer_hash, ctx->hash);
+    --ctx->depth;
+}
+
+STATIC void skip_bytes(mp_reader_t *reader, size_t len) {
+    while (len-- > 0) {
+        read_byte(reader);
+    }
+}
+
+STATIC void skip_obj(mp_reader_t *reader) {
+    if (read_byte(reader) != 'e') {
+        skip_bytes(reader, read_uint(reader, NULL));
+    }
+}
+
+STATIC void skip_raw_code(mp_reader_t *reader, qstr_window_t *qw, lazy_context_t *lazy);
+
+#define LAZY_WRITE_BYTE(ip, b) (*(ip)++ = (b))
+
+// Read past the rest of a bytecode function and its children, loading all
+// qstrs so that the qstr window is the same as after loading the function.
+// If lr is given then a stub is made for the function.
+STATIC void skip_bytecode_raw_code(mp_reader_t *reader, qstr_window_t *qw, lazy_context_t *lazy, size_t fun_data_len, lazy_raw_code_t *lr) {
+    // Read in the prelude header
+    byte header[16];
+    size_t header_len = 0;
+    for (size_t n = 0; n < 2;) {
+        if (header_len == sizeof(header)) {
+            raise_corrupt_mpy();
+        }
+        header[header_len] = read_byte(reader);
+        if ((header[header_len++] & 0x80) == 0) {
+            ++n;
+        }
+    }
+    const byte *ip = header;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    byte *ip_size = (byte *)ip;
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    if (n_info < 4 || header_len + n_info + n_cell > fun_data_len) {
+        raise_corrupt_mpy();
+    }
+
+    // The stub has the same prelude as the function except that its code info
+    // only holds the simple_name and source_file, and its only opcode is
+    // MP_BC_LAZY_LOAD
+    byte *stub = NULL;
+    size_t stub_len = 0;
+    byte *stub_ip = NULL;
+    if (lr != NULL) {
+        size_t stub_info = 4;
+        size_t stub_cell = n_cell;
+        MP_BC_PRELUDE_SIZE_ENCODE(stub_info, stub_cell, LAZY_WRITE_BYTE, ip_size);
+        stub_len = ip_size - header + 4 + n_cell + 1;
+        stub = m_new(byte, stub_len);
+        memcpy(stub, header, ip_size - header);
+        stub_ip = stub + (ip_size - header);
+        load_prelude_qstrs(reader, qw, stub_ip);
+        stub_ip += 4;
+    } else {
+        load_qstr(reader, qw);
+        load_qstr(reader, qw);
+    }
+    skip_bytes(reader, n_info - 4);
+    if (lr != NULL) {
+        read_bytes(reader, stub_ip, n_cell);
+        stub_ip[n_cell] = MP_BC_LAZY_LOAD;
+    } else {
+        skip_bytes(reader, n_cell);
+    }
+
+    // Skip the opcodes
+    size_t pos = header_len + n_info + n_cell;
+    while (pos < fun_data_len) {
+        byte op = read_byte(reader);
+        size_t sz;
+        uint f = mp_opcode_format(&op, &sz, false);
+        pos += sz;
+        --sz;
+        if (f == MP_BC_FORMAT_QSTR) {
+            load_qstr(reader, qw);
+            sz -= 2;
+        } else if (f == MP_BC_FORMAT_VAR_UINT) {
+            while (read_byte(reader) & 0x80) {
+                ++pos;
+            }
+            ++pos;
+        }
+        skip_bytes(reader, sz);
+    }
+
+    // Skip the constant table, keeping the argument names for the stub
+    size_t n_obj = read_uint(reader, NULL);
+    size_t n_raw_code = read_uint(reader, NULL);
+    size_t n_args = n_pos_args + n_kwonly_args;
+    mp_uint_t *const_table = NULL;
+    if (lr != NULL) {
+        const_table = m_new(mp_uint_t, n_args + 1);
+        const_table[n_args] = (mp_uint_t)(uintptr_t)lr;
+    }
+    for (size_t i = 0; i < n_args; ++i) {
+        qstr qst = load_qstr(reader, qw);
+        if (const_table != NULL) {
+            const_table[i] = (mp_uint_t)MP_OBJ_NEW_QSTR(qst);
+        }
+    }
+    for (size_t i = 0; i < n_obj; ++i) {
+        skip_obj(reader);
+    }
+    for (size_t i = 0; i < n_raw_code; ++i) {
+        skip_raw_code(reader, qw, lazy);
+    }
+
+    if (lr != NULL) {
+        lr->rc = mp_emit_glue_new_raw_code();
+        mp_emit_glue_assign_bytecode(lr->rc, stub,
+            #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+            stub_len,
+            #endif
+            const_table,
+            #if MICROPY_PERSISTENT_CODE_SAVE
+            0, 0,
+            #endif
+            scope_flags);
+    }
+}
+
+STATIC void skip_raw_code(mp_reader_t *reader, qstr_window_t *qw, lazy_context_t *lazy) {
+    uint32_t outer_hash = lazy_begin(lazy);
+    size_t kind_len = read_uint(reader, NULL);
+    if ((kind_len & 3) + MP_CODE_BYTECODE != MP_CODE_BYTECODE) {
+        raise_corrupt_mpy();
+    }
+    skip_bytecode_raw_code(reader, qw, lazy, kind_len >> 2, NULL);
+    lazy_end(lazy, outer_hash);
+}
+
+#endif // MICROPY_PERSISTENT_CODE_LOAD_LAZY
+
+STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, qstr_window_t *qw, lazy_context_t *lazy) {
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    size_t offset = 0;
+    uint32_t outer_hash = 0;
+    if (lazy != NULL) {
+        offset = lazy->pos;
+        outer_hash = lazy_begin(lazy);
+    }
+    #endif
+
     // Load function kind and data length
     size_t kind_len = read_uint(reader, NULL);
     int kind = (kind_len & 3) + MP_CODE_BYTECODE;
@@ -395,6 +661,25 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, qstr_window_t *qw) {
     #endif
 
     if (kind == MP_CODE_BYTECODE) {
+        #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+        // Leave the code of all but the outermost function in the file until
+        // it is first called
+        if (lazy != NULL && lazy->defer && lazy->depth > 1
+            && fun_data_len >= MICROPY_PERSISTENT_CODE_LOAD_LAZY_MIN_SIZE) {
+            lazy_raw_code_t *lr = m_new_obj(lazy_raw_code_t);
+            lr->kind = MP_CODE_RESERVED;
+            lr->filename = lazy->filename;
+            lr->offset = offset;
+            lr->fun_data = NULL;
+            lr->const_table = NULL;
+            lr->qw = *qw;
+            skip_bytecode_raw_code(reader, qw, lazy, fun_data_len, lr);
+            lazy_end(lazy, outer_hash);
+            lr->hash = lazy->last_hash;
+            return lr->rc;
+        }
+        #endif
+
         // Allocate memory for the bytecode
         fun_data = m_new(uint8_t, fun_data_len);
 
@@ -517,7 +802,7 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, qstr_window_t *qw) {
             *ct++ = (mp_uint_t)load_obj(reader);
         }
         for (size_t i = 0; i < n_raw_code; ++i) {
-            *ct++ = (mp_uint_t)(uintptr_t)load_raw_code(reader, qw);
+            *ct++ = (mp_uint_t)(uintptr_t)load_raw_code(reader, qw, lazy);
         }
     }
 
@@ -571,15 +856,21 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, qstr_window_t *qw) {
             prelude.n_pos_args, prelude.scope_flags, type_sig);
     #endif
     }
+
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    if (lazy != NULL) {
+        lazy_end(lazy, outer_hash);
+    }
+    #endif
     return rc;
 }
 
-mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader) {
+STATIC mp_raw_code_t *raw_code_load(mp_reader_t *reader, lazy_context_t *lazy) {
     byte header[4];
     read_bytes(reader, header, sizeof(header));
     if (header[0] != 'C'
         || header[1] != MPY_VERSION
-        || MPY_FEATURE_DECODE_FLAGS(header[2]) != MPY_FEATURE_FLAGS
+        || (MPY_FEATURE_DECODE_FLAGS(header[2]) & ~MPY_FEATURE_FLAGS_OPTIONAL) != MPY_FEATURE_FLAGS
         || header[3] > mp_small_int_bits()
         || read_uint(reader, NULL) > QSTR_WINDOW_SIZE) {
         mp_raise_ValueError(MP_ERROR_TEXT("Incompatible .mpy file. Please update all .mpy files. See http://adafru.it/mpy-update for more info."));
@@ -589,14 +880,24 @@ mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader) {
         if (!MPY_FEATURE_ARCH_TEST(arch)) {
             mp_raise_ValueError(MP_ERROR_TEXT("incompatible native .mpy architecture"));
         }
+        #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+        // Only bytecode functions can be loaded later
+        if (lazy != NULL) {
+            lazy->defer = false;
+        }
+        #endif
     }
     qstr_window_t qw;
     qw.idx = 0;
-    mp_raw_code_t *rc = load_raw_code(reader, &qw);
+    mp_raw_code_t *rc = load_raw_code(reader, &qw, lazy);
     reader->close(reader->data);
     return rc;
 }
 
+mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader) {
+    return raw_code_load(reader, NULL);
+}
+
 mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len) {
     mp_reader_t reader;
     mp_reader_new_mem(&reader, buf, len, 0);
@@ -607,10 +908,58 @@ mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len) {
 
 mp_raw_code_t *mp_raw_code_load_file(const char *filename) {
     mp_reader_t reader;
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    lazy_context_t ctx;
+    lazy_reader_new(&reader, &ctx, lazy_filename(filename), 0);
+    return raw_code_load(&reader, &ctx);
+    #else
     mp_reader_new_file(&reader, filename);
     return mp_raw_code_load(&reader);
+    #endif
 }
 
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+
+const byte *mp_raw_code_load_lazy(mp_obj_fun_bc_t *fun) {
+    const byte *ip = fun->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    lazy_raw_code_t *lr = (lazy_raw_code_t *)fun->const_table[n_pos_args + n_kwonly_args];
+
+    if (lr->fun_data == NULL) {
+        mp_reader_t reader;
+        lazy_context_t ctx;
+        lazy_reader_new(&reader, &ctx, lr->filename, lr->offset);
+        qstr_window_t qw = lr->qw;
+        mp_raw_code_t *rc;
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            rc = load_raw_code(&reader, &qw, &ctx);
+            nlr_pop();
+        } else {
+            reader.close(reader.data);
+            nlr_jump(nlr.ret_val);
+        }
+        reader.close(reader.data);
+        // The file must not have changed since it was imported
+        if (ctx.last_hash != lr->hash) {
+            raise_corrupt_mpy();
+        }
+        lr->fun_data = rc->fun_data;
+        lr->const_table = rc->const_table;
+        // Functions made from the raw code from now on get the loaded code
+        *lr->rc = *rc;
+    }
+
+    fun->bytecode = lr->fun_data;
+    fun->const_table = lr->const_table;
+    bytecode_prelude_t prelude;
+    ip = lr->fun_data;
+    extract_prelude(&ip, &prelude);
+    return ip;
+}
+
+#endif // MICROPY_PERSISTENT_CODE_LOAD_LAZY
+
 #endif // MICROPY_HAS_FILE_READER
 
 #endif // MICROPY_PERSISTENT_CODE_LOAD
@@ -802,7 +1151,7 @@ STATIC void save_raw_code(mp_print_t *print, mp_raw_code_t *rc, qstr_window_t *q
     }
 }
 
-STATIC bool mp_raw_code_has_native(mp_raw_code_t *rc) {
+bool mp_raw_code_has_native(mp_raw_code_t *rc) {
     if (rc->kind != MP_CODE_BYTECODE) {
         return true;
     }
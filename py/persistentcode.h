@@ -29,6 +29,7 @@
 #include "py/mpprint.h"
 #include "py/reader.h"
 #include "py/emitglue.h"
+#include "py/objfun.h"
 
 // The current version of .mpy files
 #define MPY_VERSION 5
@@ -42,16 +43,26 @@
 #define MPY_FEATURE_DECODE_ARCH(feat) ((feat) >> 2)
 
 // The feature flag bits encode the compile-time config options that affect
-// the generate bytecode. Note: position 0 is now unused
-// (formerly MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE).
+// the generate bytecode. Position 0 (formerly MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
+// is now MPY_FEATURE_SUPERINSTRUCTIONS.
 #define MPY_FEATURE_FLAGS ( \
     ((MICROPY_PY_BUILTINS_STR_UNICODE) << 1) \
     )
 // This is a version of the flags that can be configured at runtime.
 #define MPY_FEATURE_FLAGS_DYNAMIC ( \
-    ((MICROPY_PY_BUILTINS_STR_UNICODE_DYNAMIC) << 1) \
+    ((MICROPY_OPT_SUPERINSTRUCTIONS_DYNAMIC) << 0) \
+    | ((MICROPY_PY_BUILTINS_STR_UNICODE_DYNAMIC) << 1) \
     )
 
+// Set when the bytecode may use superinstructions. Such files only load when
+// MICROPY_OPT_SUPERINSTRUCTIONS is enabled, but other files load there too.
+#define MPY_FEATURE_SUPERINSTRUCTIONS (1)
+#if MICROPY_OPT_SUPERINSTRUCTIONS
+#define MPY_FEATURE_FLAGS_OPTIONAL (MPY_FEATURE_SUPERINSTRUCTIONS)
+#else
+#define MPY_FEATURE_FLAGS_OPTIONAL (0)
+#endif
+
 // Define the host architecture
 #if MICROPY_EMIT_X86
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_X86)
@@ -76,6 +87,8 @@
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_XTENSA)
 #elif MICROPY_EMIT_XTENSAWIN
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_XTENSAWIN)
+#elif MICROPY_EMIT_RV32
+    #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_RV32IMC)
 #else
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_NONE)
 #endif
@@ -100,14 +113,20 @@ enum {
     MP_NATIVE_ARCH_ARMV7EMDP,
     MP_NATIVE_ARCH_XTENSA,
     MP_NATIVE_ARCH_XTENSAWIN,
+    MP_NATIVE_ARCH_RV32IMC,
 };
 
 mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader);
 mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len);
 mp_raw_code_t *mp_raw_code_load_file(const char *filename);
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+// Loads the code of a function made from a stub, and returns its first opcode
+const byte *mp_raw_code_load_lazy(mp_obj_fun_bc_t *fun);
+#endif
 
 void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print);
 void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename);
+bool mp_raw_code_has_native(mp_raw_code_t *rc);
 
 void mp_native_relocate(void *reloc, uint8_t *text, uintptr_t reloc_text);
 
@@ -100,6 +100,8 @@ PY_CORE_O_BASENAME = $(addprefix py/,\
 	emitnxtensa.o \
 	emitinlinextensa.o \
 	emitnxtensawin.o \
+	asmrv32.o \
+	emitnrv32.o \
 	formatfloat.o \
 	parsenumbase.o \
 	parsenum.o \
@@ -37,8 +37,9 @@
 #include "supervisor/linker.h"
 #include "supervisor/shared/translate/translate.h"
 
-// NOTE: we are using linear arrays to store and search for qstr's (unique strings, interned strings)
-// ultimately we will replace this with a static hash table of some kind
+// NOTE: we are using linear arrays to store qstr's (unique strings, interned strings).  Most of
+// the const pool is sorted so it can be searched with a binary search, and the qstrs
+// added at runtime can have a hash index (MICROPY_OPT_QSTR_INDEX).
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_printf DEBUG_printf
@@ -63,13 +64,16 @@
 // allocated pool is twice this size.  The value here must be <= MP_QSTRnumber_of.
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
-// this must match the equivalent function in makeqstrdata.py
-mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
+STATIC mp_uint_t qstr_compute_full_hash(const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
     mp_uint_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    return hash;
+}
+
+STATIC mp_uint_t qstr_mask_hash(mp_uint_t hash) {
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -77,6 +81,11 @@ mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
     }
     return hash;
 }
+
+// this must match the equivalent function in makeqstrdata.py
+mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
+    return qstr_mask_hash(qstr_compute_full_hash(data, len));
+}
 #ifndef CIRCUITPY_PRECOMPUTE_QSTR_ATTR
 #define CIRCUITPY_PRECOMPUTE_QSTR_ATTR (1)
 #endif
@@ -121,6 +130,10 @@ extern const qstr_pool_t MICROPY_QSTR_EXTRA_POOL;
 void qstr_init(void) {
     MP_STATE_VM(last_pool) = (qstr_pool_t *)&CONST_POOL; // we won't modify the const_pool since it has no allocated room left
     MP_STATE_VM(qstr_last_chunk) = NULL;
+    #if MICROPY_OPT_QSTR_INDEX
+    MP_STATE_VM(qstr_index) = NULL;
+    MP_STATE_VM(qstr_index_alloc) = 0;
+    #endif
 
     #if CIRCUITPY_PRECOMPUTE_QSTR_ATTR == 0
     if (mp_qstr_const_attr[MP_QSTR_circuitpython].len == 0) {
@@ -199,12 +212,137 @@ STATIC qstr qstr_add(mp_uint_t hash, mp_uint_t len, const char *q_ptr) {
     return MP_STATE_VM(last_pool)->total_prev_len + at;
 }
 
+#if MICROPY_OPT_QSTR_INDEX
+
+// The index is an open-addressed hash table of the ids of the qstrs added at runtime, that is
+// those after CONST_POOL, with 0 marking an empty slot.  It uses the full djb2 hash because
+// the stored hash may be only a byte.  The index is rebuilt with four times as many slots as
+// qstrs whenever their number reaches a power of two (from QSTR_INDEX_MIN), so it is never
+// more than half full.  If there is no index the pools are searched instead.
+#define QSTR_INDEX_MIN (16)
+
+STATIC void qstr_index_insert(uint16_t *index, size_t mask, mp_uint_t full_hash, qstr q) {
+    size_t i = full_hash & mask;
+    while (index[i] != 0) {
+        i = (i + 1) & mask;
+    }
+    index[i] = q;
+}
+
+STATIC void qstr_index_free(void) {
+    if (MP_STATE_VM(qstr_index) != NULL) {
+        m_del(uint16_t, MP_STATE_VM(qstr_index), MP_STATE_VM(qstr_index_alloc));
+        MP_STATE_VM(qstr_index) = NULL;
+        MP_STATE_VM(qstr_index_alloc) = 0;
+    }
+}
+
+// qstr_mutex must be taken while in this function
+STATIC void qstr_index_add(qstr q, mp_uint_t full_hash) {
+    size_t first = CONST_POOL.total_prev_len + CONST_POOL.len;
+    size_t n = q + 1 - first;
+    if (q > 0xffff) {
+        // ids no longer fit in the index
+        qstr_index_free();
+        return;
+    }
+    if (n < QSTR_INDEX_MIN || (n & (n - 1)) != 0) {
+        if (MP_STATE_VM(qstr_index) != NULL) {
+            qstr_index_insert(MP_STATE_VM(qstr_index), MP_STATE_VM(qstr_index_alloc) - 1, full_hash, q);
+        }
+        return;
+    }
+
+    // rebuild the index with room for twice as many qstrs
+    qstr_index_free();
+    size_t alloc = 4 * n;
+    uint16_t *index = m_new_ll_maybe(uint16_t, alloc);
+    if (index == NULL) {
+        return;
+    }
+    memset(index, 0, alloc * sizeof(uint16_t));
+    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool->total_prev_len >= first; pool = pool->prev) {
+        for (size_t at = 0; at < pool->len; at++) {
+            mp_uint_t h = qstr_compute_full_hash((const byte *)pool->qstrs[at], pool->attrs[at].len);
+            qstr_index_insert(index, alloc - 1, h, pool->total_prev_len + at);
+        }
+    }
+    MP_STATE_VM(qstr_index) = index;
+    MP_STATE_VM(qstr_index_alloc) = alloc;
+}
+
+STATIC qstr qstr_index_find(mp_uint_t full_hash, const char *str, size_t str_len) {
+    const uint16_t *index = MP_STATE_VM(qstr_index);
+    size_t mask = MP_STATE_VM(qstr_index_alloc) - 1;
+    mp_uint_t str_hash = qstr_mask_hash(full_hash);
+    for (size_t i = full_hash & mask; index[i] != 0; i = (i + 1) & mask) {
+        qstr_attr_t attr;
+        const char *data = find_qstr(index[i], &attr);
+        if (attr.hash == str_hash && attr.len == str_len && memcmp(data, str, str_len) == 0) {
+            return index[i];
+        }
+    }
+    return 0;
+}
+
+#endif
+
+// The qstrs in the const pool before MP_QSTRsorted_first have fixed positions, and the rest are
+// sorted by their bytes (see makeqstrdata.py).
+STATIC qstr qstr_find_in_const_pool(mp_uint_t str_hash, const char *str, size_t str_len) {
+    const qstr_attr_t *attrs = mp_qstr_const_pool.attrs;
+    const char *const *qstrs = mp_qstr_const_pool.qstrs;
+    for (size_t at = 0; at < MP_QSTRsorted_first; at++) {
+        if (attrs[at].hash == str_hash && attrs[at].len == str_len && memcmp(qstrs[at], str, str_len) == 0) {
+            return at;
+        }
+    }
+
+    size_t lo = MP_QSTRsorted_first;
+    size_t hi = MP_QSTRnumber_of;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        size_t mid_len = attrs[mid].len;
+        int cmp = memcmp(qstrs[mid], str, MIN(mid_len, str_len));
+        if (cmp == 0) {
+            if (mid_len == str_len) {
+                return mid;
+            }
+            cmp = mid_len < str_len ? -1 : 1;
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
 qstr qstr_find_strn(const char *str, size_t str_len) {
     // work out hash of str
-    mp_uint_t str_hash = qstr_compute_hash((const byte *)str, str_len);
+    mp_uint_t full_hash = qstr_compute_full_hash((const byte *)str, str_len);
+    mp_uint_t str_hash = qstr_mask_hash(full_hash);
+    const qstr_pool_t *pool = MP_STATE_VM(last_pool);
+
+    #if MICROPY_OPT_QSTR_INDEX
+    // the index covers all the pools after CONST_POOL
+    if (MP_STATE_VM(qstr_index) != NULL) {
+        qstr q = qstr_index_find(full_hash, str, str_len);
+        if (q != 0) {
+            return q;
+        }
+        pool = &CONST_POOL;
+    }
+    #else
+    (void)full_hash;
+    #endif
 
     // search pools for the data
-    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+    for (; pool != NULL; pool = pool->prev) {
+        if (pool == &mp_qstr_const_pool) {
+            return qstr_find_in_const_pool(str_hash, str, str_len);
+        }
         qstr_attr_t *attrs = pool->attrs;
         for (mp_uint_t at = 0, top = pool->len; at < top; at++) {
             if (attrs[at].hash == str_hash && attrs[at].len == str_len && memcmp(pool->qstrs[at], str, str_len) == 0) {
@@ -274,10 +412,13 @@ qstr qstr_from_strn(const char *str, size_t len) {
         MP_STATE_VM(qstr_last_used) += n_bytes;
 
         // store the interned strings' data
-        mp_uint_t hash = qstr_compute_hash((const byte *)str, len);
+        mp_uint_t full_hash = qstr_compute_full_hash((const byte *)str, len);
         memcpy(q_ptr, str, len);
         q_ptr[len] = '\0';
-        q = qstr_add(hash, len, q_ptr);
+        q = qstr_add(qstr_mask_hash(full_hash), len, q_ptr);
+        #if MICROPY_OPT_QSTR_INDEX
+        qstr_index_add(q, full_hash);
+        #endif
     }
     QSTR_EXIT();
     return q;
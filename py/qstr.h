@@ -45,6 +45,11 @@ enum {
     MP_QSTRnumber_of, // no underscore so it can't clash with any of the above
 };
 
+// The const pool is sorted from this qstr onwards (see makeqstrdata.py).
+#ifndef MP_QSTRsorted_first
+#define MP_QSTRsorted_first MP_QSTRnumber_of
+#endif
+
 typedef size_t qstr;
 
 typedef struct _qstr_attr_t {
@@ -88,6 +88,10 @@ void mp_init(void) {
     MICROPY_PORT_INIT_FUNC;
     #endif
 
+    #if MICROPY_MPZ_PROMOTION_STATS
+    MP_STATE_VM(mpz_promotions) = 0;
+    #endif
+
     #if MICROPY_ENABLE_COMPILER
     // optimization disabled by default
     MP_STATE_VM(mp_optimise_value) = 0;
@@ -96,11 +100,24 @@ void mp_init(void) {
     #endif
     #endif
 
+    #if MICROPY_OPT_LOAD_METHOD_CACHE
+    // Types cached before a soft reset are gone.
+    memset(MP_STATE_THREAD(load_method_cache), 0, sizeof(MP_STATE_THREAD(load_method_cache)));
+    MP_STATE_THREAD(load_method_cache_fill).type = NULL;
+    #endif
+
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    memset(MP_STATE_THREAD(load_global_cache), 0, sizeof(MP_STATE_THREAD(load_global_cache)));
+    #endif
+
     // init global module dict
     mp_obj_dict_init(&MP_STATE_VM(mp_loaded_modules_dict), MICROPY_LOADED_MODULES_DICT_SIZE);
 
     // initialise the __main__ module
     mp_obj_dict_init(&MP_STATE_VM(dict_main), 1);
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    MP_STATE_VM(dict_main).map.is_versioned = 1;
+    #endif
     mp_obj_dict_store(MP_OBJ_FROM_PTR(&MP_STATE_VM(dict_main)), MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR___main__));
 
     // locals = globals for outer module (see Objects/frameobject.c/PyFrame_New())
@@ -135,9 +152,20 @@ void mp_init(void) {
     MP_STATE_VM(sys_exitfunc) = mp_const_none;
     #endif
 
+    #if MICROPY_PY_URE && MICROPY_PY_URE_CACHE_SIZE
+    memset(MP_STATE_VM(re_cache), 0, sizeof(MP_STATE_VM(re_cache)));
+    #endif
+
+    #if MICROPY_PY_BUILTINS_STR_UNICODE && MICROPY_PY_BUILTINS_STR_UNICODE_FAST_INDEX
+    memset(MP_STATE_VM(str_index_cache), 0, sizeof(MP_STATE_VM(str_index_cache)));
+    #endif
+
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+
+    #if MICROPY_VM_TRACK_CODE_STATE
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
 
@@ -175,7 +203,7 @@ mp_obj_t MICROPY_WRAP_MP_LOAD_NAME(mp_load_name)(qstr qst) {
     return mp_load_global(qst);
 }
 
-mp_obj_t MICROPY_WRAP_MP_LOAD_GLOBAL(mp_load_global)(qstr qst) {
+STATIC mp_map_elem_t *load_global_elem(qstr qst) {
     // logic: search globals, builtins
     DEBUG_OP_printf("load global %s\n", qstr_str(qst));
     mp_map_elem_t *elem = mp_map_lookup(&mp_globals_get()->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
@@ -185,7 +213,7 @@ mp_obj_t MICROPY_WRAP_MP_LOAD_GLOBAL(mp_load_global)(qstr qst) {
             // lookup in additional dynamic table of builtins first
             elem = mp_map_lookup(&MP_STATE_VM(mp_module_builtins_override_dict)->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
             if (elem != NULL) {
-                return elem->value;
+                return elem;
             }
         }
         #endif
@@ -198,8 +226,31 @@ mp_obj_t MICROPY_WRAP_MP_LOAD_GLOBAL(mp_load_global)(qstr qst) {
             #endif
         }
     }
+    return elem;
+}
+
+mp_obj_t MICROPY_WRAP_MP_LOAD_GLOBAL(mp_load_global)(qstr qst) {
+    return load_global_elem(qst)->value;
+}
+
+#if MICROPY_OPT_LOAD_GLOBAL_CACHE
+mp_obj_t mp_load_global_cached(qstr qst, const byte *site) {
+    mp_obj_dict_t *globals = mp_globals_get();
+    mp_load_global_cache_entry_t *entry = &MP_STATE_THREAD(load_global_cache)[(uintptr_t)site % MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE];
+    if (entry->globals == globals && entry->qst == qst && entry->version == MP_STATE_VM(load_global_cache_version)) {
+        return entry->elem->value;
+    }
+    mp_map_elem_t *elem = load_global_elem(qst);
+    // Changes to other dicts, such as ones passed to exec(), aren't tracked.
+    if (globals->map.is_versioned || globals->map.is_fixed) {
+        entry->globals = globals;
+        entry->qst = qst;
+        entry->version = MP_STATE_VM(load_global_cache_version);
+        entry->elem = elem;
+    }
     return elem->value;
 }
+#endif
 
 mp_obj_t mp_load_build_class(void) {
     DEBUG_OP_printf("load_build_class\n");
@@ -966,6 +1017,77 @@ too_short:
     #endif
 }
 
+#if MICROPY_OPT_LOAD_METHOD_CACHE
+void mp_load_method_cache_offer(const mp_obj_type_t *type, const mp_obj_type_t *owner, mp_obj_t member, qstr attr) {
+    mp_load_method_cache_entry_t *fill = &MP_STATE_THREAD(load_method_cache_fill);
+    fill->type = type;
+    fill->owner = owner;
+    fill->member = member;
+    fill->attr = attr;
+    fill->version = MP_STATE_VM(load_method_cache_version);
+}
+
+void mp_load_method_cache_invalidate(void) {
+    MP_STATE_VM(load_method_cache_version)++;
+}
+
+STATIC mp_load_method_cache_entry_t *load_method_cache_entry(const mp_obj_type_t *type, const byte *site) {
+    size_t index = ((uintptr_t)site ^ ((uintptr_t)type >> 3)) % MICROPY_OPT_LOAD_METHOD_CACHE_SIZE;
+    return &MP_STATE_THREAD(load_method_cache)[index];
+}
+
+STATIC bool load_method_cache_lookup(mp_load_method_cache_entry_t *entry, mp_obj_t base, const mp_obj_type_t *type, qstr attr, mp_obj_t *dest) {
+    if (entry->type != type || entry->attr != attr || entry->version != MP_STATE_VM(load_method_cache_version)) {
+        // Clear the offer so that only the lookup the caller is about to do can fill the entry.
+        MP_STATE_THREAD(load_method_cache_fill).type = NULL;
+        return false;
+    }
+    dest[0] = MP_OBJ_NULL;
+    dest[1] = MP_OBJ_NULL;
+    if (mp_obj_is_instance_type(type)) {
+        // Members of the instance itself come first.
+        mp_obj_instance_t *self = MP_OBJ_TO_PTR(base);
+        mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+        if (elem != NULL) {
+            dest[0] = elem->value;
+            return true;
+        }
+    }
+    mp_convert_member_lookup(base, entry->owner, entry->member, dest);
+    return true;
+}
+
+STATIC void load_method_cache_fill(mp_load_method_cache_entry_t *entry, const mp_obj_type_t *type, qstr attr) {
+    mp_load_method_cache_entry_t *fill = &MP_STATE_THREAD(load_method_cache_fill);
+    if (fill->type == type && fill->attr == attr && fill->version == MP_STATE_VM(load_method_cache_version)) {
+        *entry = *fill;
+    }
+}
+
+mp_obj_t mp_load_attr_cached(mp_obj_t base, qstr attr, const byte *site) {
+    const mp_obj_type_t *type = mp_obj_get_type(base);
+    mp_load_method_cache_entry_t *entry = load_method_cache_entry(type, site);
+    mp_obj_t dest[2];
+    if (!load_method_cache_lookup(entry, base, type, attr, dest)) {
+        mp_load_method(base, attr, dest);
+        load_method_cache_fill(entry, type, attr);
+    }
+    if (dest[1] == MP_OBJ_NULL) {
+        return dest[0];
+    }
+    return mp_obj_new_bound_meth(dest[0], dest[1]);
+}
+
+void mp_load_method_cached(mp_obj_t base, qstr attr, mp_obj_t *dest, const byte *site) {
+    const mp_obj_type_t *type = mp_obj_get_type(base);
+    mp_load_method_cache_entry_t *entry = load_method_cache_entry(type, site);
+    if (!load_method_cache_lookup(entry, base, type, attr, dest)) {
+        mp_load_method(base, attr, dest);
+        load_method_cache_fill(entry, type, attr);
+    }
+}
+#endif
+
 mp_obj_t mp_load_attr(mp_obj_t base, qstr attr) {
     DEBUG_OP_printf("load attr %p.%s\n", base, qstr_str(attr));
     // use load_method
@@ -1150,6 +1272,11 @@ void mp_load_method_maybe(mp_obj_t obj, qstr attr, mp_obj_t *dest) {
         mp_map_t *locals_map = &type->locals_dict->map;
         mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
         if (elem != NULL) {
+            #if MICROPY_OPT_LOAD_METHOD_CACHE
+            if (attr_fun == NULL) {
+                mp_load_method_cache_offer(type, type, elem->value, attr);
+            }
+            #endif
             mp_convert_member_lookup(obj, type, elem->value, dest);
         }
         return;
@@ -1560,9 +1687,17 @@ mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_i
 
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
-        qstr source_name = lex->source_name;
-        mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
-        mp_obj_t module_fun = mp_compile(&parse_tree, source_name, parse_input_kind == MP_PARSE_SINGLE_INPUT);
+        mp_obj_t module_fun;
+        #if MICROPY_COMP_INCREMENTAL
+        if (parse_input_kind == MP_PARSE_FILE_INPUT) {
+            module_fun = mp_compile_incremental(lex);
+        } else
+        #endif
+        {
+            qstr source_name = lex->source_name;
+            mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
+            module_fun = mp_compile(&parse_tree, source_name, parse_input_kind == MP_PARSE_SINGLE_INPUT);
+        }
 
         mp_obj_t ret;
         if (MICROPY_PY_BUILTINS_COMPILE && globals == NULL) {
@@ -1752,6 +1887,12 @@ NORETURN void mp_raise_StopIteration(mp_obj_t arg) {
 }
 
 NORETURN MP_COLD void mp_raise_OSError(int errno_) {
+    #if MICROPY_PREALLOC_OSERROR
+    mp_obj_t exc = mp_obj_exception_prealloc_oserror(errno_);
+    if (exc != MP_OBJ_NULL) {
+        nlr_raise(exc);
+    }
+    #endif
     mp_raise_type_arg(&mp_type_OSError, MP_OBJ_NEW_SMALL_INT(errno_));
 }
 
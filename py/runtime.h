@@ -133,6 +133,16 @@ static MP_INLINE void mp_globals_set(mp_obj_dict_t *d) {
 
 mp_obj_t mp_load_name(qstr qst);
 mp_obj_t mp_load_global(qstr qst);
+#if MICROPY_OPT_LOAD_GLOBAL_CACHE
+// Version of mp_load_global for the VM. site is the bytecode location of the lookup.
+mp_obj_t mp_load_global_cached(qstr qst, const byte *site);
+// Must be called whenever map's keys, or the slots that hold them, change.
+static inline void mp_load_global_cache_map_changed(const mp_map_t *map) {
+    if (map->is_versioned) {
+        MP_STATE_VM(load_global_cache_version)++;
+    }
+}
+#endif
 mp_obj_t mp_load_build_class(void);
 void mp_store_name(qstr qst, mp_obj_t obj);
 void mp_store_global(qstr qst, mp_obj_t obj);
@@ -177,6 +187,16 @@ void mp_load_method(mp_obj_t base, qstr attr, mp_obj_t *dest);
 void mp_load_method_maybe(mp_obj_t base, qstr attr, mp_obj_t *dest);
 void mp_load_method_protected(mp_obj_t obj, qstr attr, mp_obj_t *dest, bool catch_all_exc);
 void mp_load_super_method(qstr attr, mp_obj_t *dest);
+#if MICROPY_OPT_LOAD_METHOD_CACHE
+// Versions of mp_load_attr and mp_load_method for the VM. site is the bytecode
+// location of the lookup.
+mp_obj_t mp_load_attr_cached(mp_obj_t base, qstr attr, const byte *site);
+void mp_load_method_cached(mp_obj_t base, qstr attr, mp_obj_t *dest, const byte *site);
+// Offers the result of a lookup of attr on an object of the given type, when
+// it is convert(obj, owner, member) for any such object without its own attr.
+void mp_load_method_cache_offer(const mp_obj_type_t *type, const mp_obj_type_t *owner, mp_obj_t member, qstr attr);
+void mp_load_method_cache_invalidate(void);
+#endif
 void mp_store_attr(mp_obj_t base, qstr attr, mp_obj_t val);
 
 mp_obj_t mp_getiter(mp_obj_t o, mp_obj_iter_buf_t *iter_buf);
@@ -511,6 +511,39 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip) {
             mp_printf(print, "IMPORT_STAR");
             break;
 
+        #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+        case MP_BC_LAZY_LOAD:
+            mp_printf(print, "LAZY_LOAD");
+            break;
+        #endif
+
+        #if MICROPY_OPT_SUPERINSTRUCTIONS
+        case MP_BC_LOAD_FAST0_ATTR:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST0_ATTR %s", qstr_str(qst));
+            break;
+
+        case MP_BC_LOAD_FAST0_METHOD:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST0_METHOD %s", qstr_str(qst));
+            break;
+
+        case MP_BC_STORE_FAST0_ATTR:
+            DECODE_QSTR;
+            mp_printf(print, "STORE_FAST0_ATTR %s", qstr_str(qst));
+            break;
+
+        case MP_BC_LOAD_FAST_FAST:
+            mp_printf(print, "LOAD_FAST_FAST " UINT_FMT " " UINT_FMT, (mp_uint_t)*ip >> 4, (mp_uint_t)*ip & 0xf);
+            ip += 1;
+            break;
+
+        case MP_BC_ADD_FAST_SMALL_INT:
+            mp_printf(print, "ADD_FAST_SMALL_INT " UINT_FMT " " UINT_FMT "%s", (mp_uint_t)*ip >> 4, (mp_uint_t)*ip & 7, (*ip & 8) ? " inplace" : "");
+            ip += 1;
+            break;
+        #endif
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
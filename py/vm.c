@@ -32,9 +32,11 @@
 #include "py/emitglue.h"
 #include "py/objtype.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
 #include "py/bc0.h"
 #include "py/bc.h"
 #include "py/profile.h"
+#include "py/persistentcode.h"
 
 #include "supervisor/linker.h"
 #include "supervisor/shared/translate/translate.h"
@@ -175,6 +177,25 @@
     } \
 } while(0)
 
+#elif MICROPY_VM_TRACK_CODE_STATE
+
+// Only keep the chain of running code states up to date, without any tracing.
+#define FRAME_SETUP() do { \
+    MP_STATE_THREAD(current_code_state) = code_state; \
+} while(0)
+
+#define FRAME_ENTER() do { \
+    assert(code_state != MP_STATE_THREAD(current_code_state)); \
+    code_state->prev_state = MP_STATE_THREAD(current_code_state); \
+} while(0)
+
+#define FRAME_LEAVE() do { \
+    MP_STATE_THREAD(current_code_state) = code_state->prev_state; \
+} while(0)
+
+#define FRAME_UPDATE()
+#define TRACE_TICK(current_ip, current_sp, is_exception)
+
 #else // MICROPY_PY_SYS_SETTRACE
 #define FRAME_SETUP()
 #define FRAME_ENTER()
@@ -192,6 +213,117 @@ STATIC mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+#if MICROPY_OPT_VM_SMALL_INT_BINARY_OP
+// Fast path for a binary op on two small ints.  Returns MP_OBJ_NULL if the
+// result isn't a small int or bool, or the op may raise, in which case the
+// caller must fall back to mp_binary_op.  See mp_binary_op for the overflow
+// reasoning.
+static inline mp_obj_t vm_small_int_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+    mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+    switch (op) {
+        case MP_BINARY_OP_LESS:
+            return mp_obj_new_bool(lhs_val < rhs_val);
+        case MP_BINARY_OP_MORE:
+            return mp_obj_new_bool(lhs_val > rhs_val);
+        case MP_BINARY_OP_LESS_EQUAL:
+            return mp_obj_new_bool(lhs_val <= rhs_val);
+        case MP_BINARY_OP_MORE_EQUAL:
+            return mp_obj_new_bool(lhs_val >= rhs_val);
+        case MP_BINARY_OP_EQUAL:
+            return mp_obj_new_bool(lhs_val == rhs_val);
+        case MP_BINARY_OP_NOT_EQUAL:
+            return mp_obj_new_bool(lhs_val != rhs_val);
+        case MP_BINARY_OP_OR:
+        case MP_BINARY_OP_INPLACE_OR:
+            return MP_OBJ_NEW_SMALL_INT(lhs_val | rhs_val);
+        case MP_BINARY_OP_XOR:
+        case MP_BINARY_OP_INPLACE_XOR:
+            return MP_OBJ_NEW_SMALL_INT(lhs_val ^ rhs_val);
+        case MP_BINARY_OP_AND:
+        case MP_BINARY_OP_INPLACE_AND:
+            return MP_OBJ_NEW_SMALL_INT(lhs_val & rhs_val);
+        case MP_BINARY_OP_LSHIFT:
+        case MP_BINARY_OP_INPLACE_LSHIFT:
+            if (rhs_val < 0
+                || rhs_val >= (mp_int_t)(sizeof(lhs_val) * MP_BITS_PER_BYTE)
+                || lhs_val > (MP_SMALL_INT_MAX >> rhs_val)
+                || lhs_val < (MP_SMALL_INT_MIN >> rhs_val)) {
+                return MP_OBJ_NULL;
+            }
+            return MP_OBJ_NEW_SMALL_INT((mp_uint_t)lhs_val << rhs_val);
+        case MP_BINARY_OP_RSHIFT:
+        case MP_BINARY_OP_INPLACE_RSHIFT:
+            if (rhs_val < 0) {
+                return MP_OBJ_NULL;
+            }
+            if (rhs_val >= (mp_int_t)(sizeof(lhs_val) * MP_BITS_PER_BYTE)) {
+                rhs_val = sizeof(lhs_val) * MP_BITS_PER_BYTE - 1;
+            }
+            return MP_OBJ_NEW_SMALL_INT(lhs_val >> rhs_val);
+        case MP_BINARY_OP_ADD:
+        case MP_BINARY_OP_INPLACE_ADD:
+            lhs_val += rhs_val;
+            break;
+        case MP_BINARY_OP_SUBTRACT:
+        case MP_BINARY_OP_INPLACE_SUBTRACT:
+            lhs_val -= rhs_val;
+            break;
+        case MP_BINARY_OP_MULTIPLY:
+        case MP_BINARY_OP_INPLACE_MULTIPLY:
+            if (mp_small_int_mul_overflow(lhs_val, rhs_val)) {
+                return MP_OBJ_NULL;
+            }
+            return MP_OBJ_NEW_SMALL_INT(lhs_val * rhs_val);
+        case MP_BINARY_OP_FLOOR_DIVIDE:
+        case MP_BINARY_OP_INPLACE_FLOOR_DIVIDE:
+            if (rhs_val == 0) {
+                return MP_OBJ_NULL;
+            }
+            lhs_val = mp_small_int_floor_divide(lhs_val, rhs_val);
+            break;
+        case MP_BINARY_OP_MODULO:
+        case MP_BINARY_OP_INPLACE_MODULO:
+            if (rhs_val == 0) {
+                return MP_OBJ_NULL;
+            }
+            lhs_val = mp_small_int_modulo(lhs_val, rhs_val);
+            break;
+        case MP_BINARY_OP_POWER:
+        case MP_BINARY_OP_INPLACE_POWER: {
+            if (rhs_val < 0) {
+                return MP_OBJ_NULL;
+            }
+            mp_int_t ans = 1;
+            while (rhs_val > 0) {
+                if (rhs_val & 1) {
+                    if (mp_small_int_mul_overflow(ans, lhs_val)) {
+                        return MP_OBJ_NULL;
+                    }
+                    ans *= lhs_val;
+                }
+                if (rhs_val == 1) {
+                    break;
+                }
+                rhs_val /= 2;
+                if (mp_small_int_mul_overflow(lhs_val, lhs_val)) {
+                    return MP_OBJ_NULL;
+                }
+                lhs_val *= lhs_val;
+            }
+            lhs_val = ans;
+            break;
+        }
+        default:
+            return MP_OBJ_NULL;
+    }
+    if (!MP_SMALL_INT_FITS(lhs_val)) {
+        return MP_OBJ_NULL;
+    }
+    return MP_OBJ_NEW_SMALL_INT(lhs_val);
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -366,9 +498,47 @@ dispatch_loop:
                     goto load_check;
                 }
 
+                #if MICROPY_OPT_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_LOAD_FAST_FAST): {
+                    mp_uint_t locals = *ip++;
+                    obj_shared = fastn[-(mp_int_t)(locals >> 4)];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    obj_shared = fastn[-(mp_int_t)(locals & 0xf)];
+                    goto load_check;
+                }
+
+                ENTRY(MP_BC_ADD_FAST_SMALL_INT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_uint_t arg = *ip++;
+                    mp_obj_t *local = &fastn[-(mp_int_t)(arg >> 4)];
+                    if (*local == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    if (mp_obj_is_small_int(*local)) {
+                        mp_int_t val = MP_OBJ_SMALL_INT_VALUE(*local) + (arg & 7);
+                        if (MP_SMALL_INT_FITS(val)) {
+                            *local = MP_OBJ_NEW_SMALL_INT(val);
+                            DISPATCH();
+                        }
+                    }
+                    mp_binary_op_t op = (arg & 8) ? MP_BINARY_OP_INPLACE_ADD : MP_BINARY_OP_ADD;
+                    *local = mp_binary_op(op, *local, MP_OBJ_NEW_SMALL_INT(arg & 7));
+                    DISPATCH();
+                }
+                #endif
+
                 ENTRY(MP_BC_LOAD_NAME): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
+                    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+                    if (mp_locals_get() == mp_globals_get()) {
+                        PUSH(mp_load_global_cached(qst, ip));
+                        DISPATCH();
+                    }
+                    #endif
                     PUSH(mp_load_name(qst));
                     DISPATCH();
                 }
@@ -376,11 +546,30 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_GLOBAL): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
+                    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+                    PUSH(mp_load_global_cached(qst, ip));
+                    #else
                     PUSH(mp_load_global(qst));
+                    #endif
                     DISPATCH();
                 }
 
-                ENTRY(MP_BC_LOAD_ATTR): {
+                #if MICROPY_OPT_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_LOAD_FAST0_ATTR):
+                    obj_shared = fastn[0];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    // The rest is LOAD_ATTR, which has the same operand.
+                    goto load_attr;
+                #endif
+
+                ENTRY(MP_BC_LOAD_ATTR):
+                #if MICROPY_OPT_SUPERINSTRUCTIONS
+                load_attr:
+                #endif
+                {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
@@ -401,16 +590,38 @@ dispatch_loop:
                     } else
                     #endif
                     {
+                        #if MICROPY_OPT_LOAD_METHOD_CACHE
+                        obj = mp_load_attr_cached(top, qst, ip);
+                        #else
                         obj = mp_load_attr(top, qst);
+                        #endif
                     }
                     SET_TOP(obj);
                     DISPATCH();
                 }
 
-                ENTRY(MP_BC_LOAD_METHOD): {
+                #if MICROPY_OPT_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_LOAD_FAST0_METHOD):
+                    obj_shared = fastn[0];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    goto load_method;
+                #endif
+
+                ENTRY(MP_BC_LOAD_METHOD):
+                #if MICROPY_OPT_SUPERINSTRUCTIONS
+                load_method:
+                #endif
+                {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
+                    #if MICROPY_OPT_LOAD_METHOD_CACHE
+                    mp_load_method_cached(*sp, qst, sp, ip);
+                    #else
                     mp_load_method(*sp, qst, sp);
+                    #endif
                     sp += 1;
                     DISPATCH();
                 }
@@ -461,7 +672,21 @@ dispatch_loop:
                     DISPATCH();
                 }
 
-                ENTRY(MP_BC_STORE_ATTR): {
+                #if MICROPY_OPT_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_STORE_FAST0_ATTR):
+                    obj_shared = fastn[0];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    goto store_attr;
+                #endif
+
+                ENTRY(MP_BC_STORE_ATTR):
+                #if MICROPY_OPT_SUPERINSTRUCTIONS
+                store_attr:
+                #endif
+                {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
@@ -1246,6 +1471,14 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+                ENTRY(MP_BC_LAZY_LOAD):
+                    // Replace the stub with the function's code and run that
+                    MARK_EXC_IP_SELECTIVE();
+                    ip = mp_raw_code_load_lazy(code_state->fun_bc);
+                    DISPATCH();
+                #endif
+
 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS));
@@ -1268,6 +1501,15 @@ yield:
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
+                    #if MICROPY_OPT_VM_SMALL_INT_BINARY_OP
+                    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                        mp_obj_t res = vm_small_int_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs);
+                        if (res != MP_OBJ_NULL) {
+                            SET_TOP(res);
+                            DISPATCH();
+                        }
+                    }
+                    #endif
                     SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                     DISPATCH();
                 }
@@ -1291,6 +1533,15 @@ yield:
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
+                        #if MICROPY_OPT_VM_SMALL_INT_BINARY_OP
+                        if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                            mp_obj_t res = vm_small_int_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs);
+                            if (res != MP_OBJ_NULL) {
+                                SET_TOP(res);
+                                DISPATCH();
+                            }
+                        }
+                        #endif
                         SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                         DISPATCH();
                     } else
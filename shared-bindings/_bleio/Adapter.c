@@ -32,6 +32,7 @@
 #include "shared-bindings/_bleio/__init__.h"
 #include "shared-bindings/_bleio/Address.h"
 #include "shared-bindings/_bleio/Adapter.h"
+#include "shared-bindings/_bleio/UUID.h"
 
 #define ADV_INTERVAL_MIN (0.02f)
 #define ADV_INTERVAL_MIN_STRING "0.02"
@@ -282,7 +283,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|         interval: float = 0.1,
 //|         window: float = 0.1,
 //|         minimum_rssi: int = -80,
-//|         active: bool = True
+//|         active: bool = True,
+//|         services: Sequence[UUID] = (),
+//|         remove_duplicates: bool = False
 //|     ) -> Iterable[ScanEntry]:
 //|         """Starts a BLE scan and returns an iterator of results. Advertisements and scan responses are
 //|         filtered and returned separately.
@@ -299,11 +302,16 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|            window must be <= interval.
 //|         :param int minimum_rssi: the minimum rssi of entries to return.
 //|         :param bool active: retrieve scan responses for scannable advertisements.
+//|         :param Sequence[UUID] services: services to filter advertising packets with. A packet that
+//|             neither lists nor carries service data for one of the services is ignored. Packets
+//|             must also match ``prefixes`` when both are given.
+//|         :param bool remove_duplicates: ignore a packet that is the same as one of the last 16 kept,
+//|             from the same address with the same advertising data.
 //|         :returns: an iterable of `_bleio.ScanEntry` objects
 //|         :rtype: iterable"""
 //|         ...
 STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active };
+    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active, ARG_services, ARG_remove_duplicates };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_prefixes,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_buffer_size,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 512} },
@@ -313,6 +321,8 @@ STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         { MP_QSTR_window,   MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_minimum_rssi,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -80} },
         { MP_QSTR_active,  MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_services,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_empty_tuple} },
+        { MP_QSTR_remove_duplicates,  MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
 
     bleio_adapter_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -358,7 +368,30 @@ STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         }
     }
 
-    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool);
+    // Pack the services like prefixes: a byte for the length, then the UUID least significant byte first.
+    size_t services_count;
+    mp_obj_t *services_items;
+    mp_obj_get_array(args[ARG_services].u_obj, &services_count, &services_items);
+    size_t services_length = 0;
+    for (size_t i = 0; i < services_count; i++) {
+        bleio_uuid_obj_t *uuid = mp_arg_validate_type(services_items[i], &bleio_uuid_type, MP_QSTR_services);
+        services_length += 1 + common_hal_bleio_uuid_get_size(uuid) / 8;
+    }
+    uint8_t *services = NULL;
+    if (services_length > 0) {
+        services = m_new(uint8_t, services_length);
+        uint8_t *service = services;
+        for (size_t i = 0; i < services_count; i++) {
+            bleio_uuid_obj_t *uuid = MP_OBJ_TO_PTR(services_items[i]);
+            *service = common_hal_bleio_uuid_get_size(uuid) / 8;
+            common_hal_bleio_uuid_pack_into(uuid, service + 1);
+            service += 1 + *service;
+        }
+    }
+
+    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len,
+        services, services_length, args[ARG_remove_duplicates].u_bool,
+        args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(bleio_adapter_start_scan_obj, 1, bleio_adapter_start_scan);
 
@@ -69,7 +69,8 @@ extern void common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self
     mp_int_t tx_power, const bleio_address_obj_t *directed_to);
 extern void common_hal_bleio_adapter_stop_advertising(bleio_adapter_obj_t *self);
 
-extern mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t *prefixes, size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active);
+extern mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t *prefixes, size_t prefix_length,
+    uint8_t *services, size_t services_length, bool remove_duplicates, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active);
 extern void common_hal_bleio_adapter_stop_scan(bleio_adapter_obj_t *self);
 
 extern bool common_hal_bleio_adapter_get_connected(bleio_adapter_obj_t *self);
@@ -57,7 +57,34 @@ STATIC mp_obj_t scanresults_iternext(mp_obj_t self_in) {
 //|         active. Raises `StopIteration` if scanning is finished and no other results are available.
 //|         """
 //|         ...
+//|     def next_into(self, entry: ScanEntry) -> bool:
+//|         """Store the next result in the supplied entry and return ``True``. Blocks like
+//|         `__next__`. If scanning is finished and no other results are available, do not touch
+//|         ``entry`` and return ``False``.
 //|
+//|         The advantage of this method over iterating is that it does not allocate storage for
+//|         every result. Instead it reuses an entry returned earlier along with the entry's
+//|         `ScanEntry.address` and, when it is large enough, its advertisement bytes, so
+//|         copy those that need to be kept.
+//|
+//|         :return: ``True`` if a result was available and stored, ``False`` if not.
+//|         :rtype: bool
+//|         """
+//|         ...
+//|
+STATIC mp_obj_t scanresults_next_into(mp_obj_t self_in, mp_obj_t entry_in) {
+    bleio_scanresults_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    bleio_scanentry_obj_t *entry = MP_OBJ_TO_PTR(mp_arg_validate_type(entry_in, &bleio_scanentry_type, MP_QSTR_entry));
+
+    return mp_obj_new_bool(common_hal_bleio_scanresults_next_into(self, entry));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(scanresults_next_into_obj, scanresults_next_into);
+
+STATIC const mp_rom_map_elem_t scanresults_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_next_into), MP_ROM_PTR(&scanresults_next_into_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(scanresults_locals_dict, scanresults_locals_dict_table);
 
 const mp_obj_type_t bleio_scanresults_type = {
     { &mp_type_type },
@@ -67,4 +94,5 @@ const mp_obj_type_t bleio_scanresults_type = {
         .getiter = mp_identity_getiter,
         .iternext = scanresults_iternext,
         ),
+    .locals_dict = (mp_obj_dict_t *)&scanresults_locals_dict,
 };
@@ -30,10 +30,12 @@
 #define MICROPY_INCLUDED_SHARED_BINDINGS_BLEIO_SCANRESULTS_H
 
 #include "py/obj.h"
+#include "shared-bindings/_bleio/ScanEntry.h"
 #include "shared-module/_bleio/ScanResults.h"
 
 extern const mp_obj_type_t bleio_scanresults_type;
 
 mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self);
+bool common_hal_bleio_scanresults_next_into(bleio_scanresults_obj_t *self, bleio_scanentry_obj_t *entry);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BLEIO_SCANRESULTS_H
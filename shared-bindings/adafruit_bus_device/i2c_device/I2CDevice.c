@@ -42,13 +42,18 @@
 //| class I2CDevice:
 //|     """I2C Device Manager"""
 //|
-//|     def __init__(self, i2c: busio.I2C, device_address: int, probe: bool = True) -> None:
+//|     def __init__(
+//|         self, i2c: busio.I2C, device_address: int, probe: bool = True, *, register_cache: bool = False
+//|     ) -> None:
 //|         """Represents a single I2C device and manages locking the bus and the device
 //|         address.
 //|
 //|         :param ~busio.I2C i2c: The I2C bus the device is on
 //|         :param int device_address: The 7 bit device address
 //|         :param bool probe: Probe for the device upon object creation, default is true
+//|         :param bool register_cache: Remember the values `write_register` and `read_register`
+//|             have seen, so that ``read_register(..., cached=True)`` can return them without
+//|             using the bus. Useful for registers that can't be read back.
 //|
 //|         Example::
 //|
@@ -68,18 +73,19 @@
 STATIC mp_obj_t adafruit_bus_device_i2cdevice_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     adafruit_bus_device_i2cdevice_obj_t *self = m_new_obj(adafruit_bus_device_i2cdevice_obj_t);
     self->base.type = &adafruit_bus_device_i2cdevice_type;
-    enum { ARG_i2c, ARG_device_address, ARG_probe };
+    enum { ARG_i2c, ARG_device_address, ARG_probe, ARG_register_cache };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_i2c, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_device_address, MP_ARG_REQUIRED | MP_ARG_INT },
         { MP_QSTR_probe, MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_register_cache, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     mp_obj_t *i2c = args[ARG_i2c].u_obj;
 
-    common_hal_adafruit_bus_device_i2cdevice_construct(MP_OBJ_TO_PTR(self), i2c, args[ARG_device_address].u_int);
+    common_hal_adafruit_bus_device_i2cdevice_construct(MP_OBJ_TO_PTR(self), i2c, args[ARG_device_address].u_int, args[ARG_register_cache].u_bool);
     if (args[ARG_probe].u_bool == true) {
         common_hal_adafruit_bus_device_i2cdevice_probe_for_device(self);
     }
@@ -230,7 +236,6 @@ MP_DEFINE_CONST_FUN_OBJ_KW(adafruit_bus_device_i2cdevice_write_obj, 1, adafruit_
 //|         :param int in_end: end of ``in_buffer slice``; if not specified, use ``len(in_buffer)``
 //|         """
 //|         ...
-//|
 STATIC mp_obj_t adafruit_bus_device_i2cdevice_write_then_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_out_buffer, ARG_in_buffer, ARG_out_start, ARG_out_end, ARG_in_start, ARG_in_end };
     static const mp_arg_t allowed_args[] = {
@@ -275,12 +280,67 @@ STATIC mp_obj_t adafruit_bus_device_i2cdevice_write_then_readinto(size_t n_args,
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(adafruit_bus_device_i2cdevice_write_then_readinto_obj, 1, adafruit_bus_device_i2cdevice_write_then_readinto);
 
+//|     def read_register(self, register: int, buffer: WriteableBuffer, *, cached: bool = False) -> None:
+//|         """Read ``len(buffer)`` bytes starting at ``register``: lock the bus, write the register
+//|         address, read with a repeated start, and unlock the bus, all in one call. Do not use
+//|         it inside a ``with`` block, which already holds the lock.
+//|
+//|         :param int register: the 8 bit register address
+//|         :param WriteableBuffer buffer: read the register values into this buffer
+//|         :param bool cached: if the values are all in the register cache, return them without
+//|             using the bus
+//|         """
+//|         ...
+STATIC mp_obj_t adafruit_bus_device_i2cdevice_read_register(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_register, ARG_buffer, ARG_cached };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_register, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_buffer,   MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_cached,   MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    adafruit_bus_device_i2cdevice_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint8_t reg = (uint8_t)mp_arg_validate_int_range(args[ARG_register].u_int, 0, 0xff, MP_QSTR_register);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+
+    common_hal_adafruit_bus_device_i2cdevice_read_register(self, reg, bufinfo.buf, bufinfo.len, args[ARG_cached].u_bool);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(adafruit_bus_device_i2cdevice_read_register_obj, 1, adafruit_bus_device_i2cdevice_read_register);
+
+//|     def write_register(self, register: int, buffer: ReadableBuffer) -> None:
+//|         """Write the bytes from ``buffer`` to the registers starting at ``register``, in a single
+//|         write after the register address, locking and unlocking the bus around it. Do not use
+//|         it inside a ``with`` block, which already holds the lock.
+//|
+//|         :param int register: the 8 bit register address
+//|         :param ReadableBuffer buffer: write the register values from this buffer
+//|         """
+//|         ...
+//|
+STATIC mp_obj_t adafruit_bus_device_i2cdevice_write_register(mp_obj_t self_in, mp_obj_t register_in, mp_obj_t buffer_in) {
+    adafruit_bus_device_i2cdevice_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint8_t reg = (uint8_t)mp_arg_validate_int_range(mp_obj_get_int(register_in), 0, 0xff, MP_QSTR_register);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_READ);
+
+    common_hal_adafruit_bus_device_i2cdevice_write_register(self, reg, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(adafruit_bus_device_i2cdevice_write_register_obj, adafruit_bus_device_i2cdevice_write_register);
+
 STATIC const mp_rom_map_elem_t adafruit_bus_device_i2cdevice_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&adafruit_bus_device_i2cdevice___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&adafruit_bus_device_i2cdevice___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_then_readinto), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_write_then_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_register), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_read_register_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_register), MP_ROM_PTR(&adafruit_bus_device_i2cdevice_write_register_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(adafruit_bus_device_i2cdevice_locals_dict, adafruit_bus_device_i2cdevice_locals_dict_table);
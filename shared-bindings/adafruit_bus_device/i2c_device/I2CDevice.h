@@ -43,9 +43,12 @@
 extern const mp_obj_type_t adafruit_bus_device_i2cdevice_type;
 
 // Initializes the hardware peripheral.
-extern void common_hal_adafruit_bus_device_i2cdevice_construct(adafruit_bus_device_i2cdevice_obj_t *self, mp_obj_t *i2c, uint8_t device_address);
+extern void common_hal_adafruit_bus_device_i2cdevice_construct(adafruit_bus_device_i2cdevice_obj_t *self, mp_obj_t *i2c, uint8_t device_address, bool register_cache);
 extern void common_hal_adafruit_bus_device_i2cdevice_lock(adafruit_bus_device_i2cdevice_obj_t *self);
 extern void common_hal_adafruit_bus_device_i2cdevice_unlock(adafruit_bus_device_i2cdevice_obj_t *self);
 extern void common_hal_adafruit_bus_device_i2cdevice_probe_for_device(adafruit_bus_device_i2cdevice_obj_t *self);
+// Lock the bus, write the register address and read or write len bytes, and unlock it again.
+extern void common_hal_adafruit_bus_device_i2cdevice_read_register(adafruit_bus_device_i2cdevice_obj_t *self, uint8_t reg, uint8_t *buf, size_t len, bool cached);
+extern void common_hal_adafruit_bus_device_i2cdevice_write_register(adafruit_bus_device_i2cdevice_obj_t *self, uint8_t reg, const uint8_t *buf, size_t len);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BUSDEVICE_I2CDEVICE_H
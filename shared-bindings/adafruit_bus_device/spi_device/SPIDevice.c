@@ -49,7 +49,8 @@
 //|         baudrate: int = 100000,
 //|         polarity: int = 0,
 //|         phase: int = 0,
-//|         extra_clocks: int = 0
+//|         extra_clocks: int = 0,
+//|         register_cache: bool = False
 //|     ) -> None:
 //|         """
 //|         Represents a single SPI device and manages locking the bus and the device address.
@@ -58,6 +59,9 @@
 //|         :param ~digitalio.DigitalInOut chip_select: The chip select pin object that implements the DigitalInOut API. ``None`` if a chip select pin is not being used.
 //|         :param bool cs_active_value: Set to true if your device requires CS to be active high. Defaults to false.
 //|         :param int extra_clocks: The minimum number of clock cycles to cycle the bus after CS is high. (Used for SD cards.)
+//|         :param bool register_cache: Remember the values `write_register` and `read_register`
+//|             have seen, so that ``read_register(..., cached=True)`` can return them without
+//|             using the bus. Useful for registers that can't be read back.
 //|
 //|         Example::
 //|
@@ -81,7 +85,7 @@
 STATIC mp_obj_t adafruit_bus_device_spidevice_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     adafruit_bus_device_spidevice_obj_t *self = m_new_obj(adafruit_bus_device_spidevice_obj_t);
     self->base.type = &adafruit_bus_device_spidevice_type;
-    enum { ARG_spi, ARG_chip_select, ARG_cs_active_value, ARG_baudrate, ARG_polarity, ARG_phase, ARG_extra_clocks };
+    enum { ARG_spi, ARG_chip_select, ARG_cs_active_value, ARG_baudrate, ARG_polarity, ARG_phase, ARG_extra_clocks, ARG_register_cache };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_spi, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_chip_select, MP_ARG_OBJ, {.u_obj = mp_const_none} },
@@ -90,6 +94,7 @@ STATIC mp_obj_t adafruit_bus_device_spidevice_make_new(const mp_obj_type_t *type
         { MP_QSTR_polarity, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
         { MP_QSTR_phase, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
         { MP_QSTR_extra_clocks, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_register_cache, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -99,7 +104,7 @@ STATIC mp_obj_t adafruit_bus_device_spidevice_make_new(const mp_obj_type_t *type
     mp_arg_validate_type_or_none(args[ARG_chip_select].u_obj, &digitalio_digitalinout_type, MP_QSTR_chip_select);
 
     common_hal_adafruit_bus_device_spidevice_construct(MP_OBJ_TO_PTR(self), spi, args[ARG_chip_select].u_obj, args[ARG_cs_active_value].u_bool, args[ARG_baudrate].u_int, args[ARG_polarity].u_int,
-        args[ARG_phase].u_int, args[ARG_extra_clocks].u_int);
+        args[ARG_phase].u_int, args[ARG_extra_clocks].u_int, args[ARG_register_cache].u_bool);
 
     if (args[ARG_chip_select].u_obj != mp_const_none) {
         digitalinout_result_t result = common_hal_digitalio_digitalinout_switch_to_output(MP_OBJ_TO_PTR(args[ARG_chip_select].u_obj),
@@ -130,16 +135,70 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(adafruit_bus_device_spidevice___enter___obj, ad
 //|         """Ends a SPI transaction by deasserting chip select. See
 //|         :ref:`lifetime-and-contextmanagers` for more info."""
 //|         ...
-//|
 STATIC mp_obj_t adafruit_bus_device_spidevice_obj___exit__(size_t n_args, const mp_obj_t *args) {
     common_hal_adafruit_bus_device_spidevice_exit(MP_OBJ_TO_PTR(args[0]));
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(adafruit_bus_device_spidevice___exit___obj, 4, 4, adafruit_bus_device_spidevice_obj___exit__);
 
+//|     def read_register(self, register: int, buffer: WriteableBuffer, *, cached: bool = False) -> None:
+//|         """Read ``len(buffer)`` bytes starting at ``register`` in one transaction: configure
+//|         the bus and assert chip select, write the register byte, read into ``buffer`` and end
+//|         the transaction. The register byte is sent as given, so include any read bit the
+//|         device needs. Do not use it inside a ``with`` block, which already holds the lock.
+//|
+//|         :param int register: the 8 bit register byte
+//|         :param WriteableBuffer buffer: read the register values into this buffer
+//|         :param bool cached: if the values are all in the register cache, return them without
+//|             using the bus
+//|         """
+//|         ...
+STATIC mp_obj_t adafruit_bus_device_spidevice_read_register(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_register, ARG_buffer, ARG_cached };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_register, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_buffer,   MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_cached,   MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    adafruit_bus_device_spidevice_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint8_t reg = (uint8_t)mp_arg_validate_int_range(args[ARG_register].u_int, 0, 0xff, MP_QSTR_register);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+
+    common_hal_adafruit_bus_device_spidevice_read_register(self, reg, bufinfo.buf, bufinfo.len, args[ARG_cached].u_bool);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(adafruit_bus_device_spidevice_read_register_obj, 1, adafruit_bus_device_spidevice_read_register);
+
+//|     def write_register(self, register: int, buffer: ReadableBuffer) -> None:
+//|         """Write the register byte followed by the bytes from ``buffer`` in one transaction.
+//|         Do not use it inside a ``with`` block, which already holds the lock.
+//|
+//|         :param int register: the 8 bit register byte
+//|         :param ReadableBuffer buffer: write the register values from this buffer
+//|         """
+//|         ...
+//|
+STATIC mp_obj_t adafruit_bus_device_spidevice_write_register(mp_obj_t self_in, mp_obj_t register_in, mp_obj_t buffer_in) {
+    adafruit_bus_device_spidevice_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint8_t reg = (uint8_t)mp_arg_validate_int_range(mp_obj_get_int(register_in), 0, 0xff, MP_QSTR_register);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_READ);
+
+    common_hal_adafruit_bus_device_spidevice_write_register(self, reg, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(adafruit_bus_device_spidevice_write_register_obj, adafruit_bus_device_spidevice_write_register);
+
 STATIC const mp_rom_map_elem_t adafruit_bus_device_spidevice_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&adafruit_bus_device_spidevice___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&adafruit_bus_device_spidevice___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_register), MP_ROM_PTR(&adafruit_bus_device_spidevice_read_register_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_register), MP_ROM_PTR(&adafruit_bus_device_spidevice_write_register_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(adafruit_bus_device_spidevice_locals_dict, adafruit_bus_device_spidevice_locals_dict_table);
@@ -43,8 +43,11 @@ extern const mp_obj_type_t adafruit_bus_device_spidevice_type;
 
 // Initializes the hardware peripheral.
 extern void common_hal_adafruit_bus_device_spidevice_construct(adafruit_bus_device_spidevice_obj_t *self, busio_spi_obj_t *spi,  digitalio_digitalinout_obj_t *cs,
-    bool cs_active_value, uint32_t baudrate, uint8_t polarity, uint8_t phase, uint8_t extra_clocks);
+    bool cs_active_value, uint32_t baudrate, uint8_t polarity, uint8_t phase, uint8_t extra_clocks, bool register_cache);
 extern mp_obj_t common_hal_adafruit_bus_device_spidevice_enter(adafruit_bus_device_spidevice_obj_t *self);
 extern void common_hal_adafruit_bus_device_spidevice_exit(adafruit_bus_device_spidevice_obj_t *self);
+// Start a transaction, write the register byte and read or write len bytes, and end it again.
+extern void common_hal_adafruit_bus_device_spidevice_read_register(adafruit_bus_device_spidevice_obj_t *self, uint8_t reg, uint8_t *buf, size_t len, bool cached);
+extern void common_hal_adafruit_bus_device_spidevice_write_register(adafruit_bus_device_spidevice_obj_t *self, uint8_t reg, const uint8_t *buf, size_t len);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BUSDEVICE_SPIDEVICE_H
@@ -61,7 +61,8 @@ static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t
 //|         brightness: float = 0,
 //|         auto_write: bool = False,
 //|         header: ReadableBuffer = b"",
-//|         trailer: ReadableBuffer = b""
+//|         trailer: ReadableBuffer = b"",
+//|         preserve_colors: bool = True
 //|     ) -> None:
 //|         """Create a PixelBuf object of the specified size, byteorder, and bits per pixel.
 //|
@@ -73,16 +74,21 @@ static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t
 //|         brightness (0.0-1.0) and will enable a Dotstar compatible 1st byte for each
 //|         pixel.
 //|
+//|         Long strips can set ``preserve_colors`` to False to skip the second buffer. Brightness
+//|         is then applied as each pixel is set, so reading a pixel returns the dimmed value and a
+//|         change to `brightness` only affects pixels set after it.
+//|
 //|         :param int size: Number of pixels
 //|         :param str byteorder: Byte order string (such as "RGB", "RGBW" or "PBGR")
 //|         :param float brightness: Brightness (0 to 1.0, default 1.0)
 //|         :param bool auto_write: Whether to automatically write pixels (Default False)
 //|         :param ~circuitpython_typing.ReadableBuffer header: Sequence of bytes to always send before pixel values.
 //|         :param ~circuitpython_typing.ReadableBuffer trailer: Sequence of bytes to always send after pixel values.
+//|         :param bool preserve_colors: Whether to keep the colors from before brightness is applied (Default True)
 //|         """
 //|         ...
 STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_size, ARG_byteorder, ARG_brightness, ARG_auto_write, ARG_header, ARG_trailer };
+    enum { ARG_size, ARG_byteorder, ARG_brightness, ARG_auto_write, ARG_header, ARG_trailer, ARG_preserve_colors };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_INT },
         { MP_QSTR_byteorder, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = MP_OBJ_NEW_QSTR(MP_QSTR_BGR) } },
@@ -90,6 +96,7 @@ STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
         { MP_QSTR_auto_write, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
         { MP_QSTR_header, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
         { MP_QSTR_trailer, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+        { MP_QSTR_preserve_colors, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -124,7 +131,7 @@ STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
     self->base.type = &pixelbuf_pixelbuf_type;
     common_hal_adafruit_pixelbuf_pixelbuf_construct(self, args[ARG_size].u_int,
         &byteorder_details, brightness, args[ARG_auto_write].u_bool, header_bufinfo.buf,
-        header_bufinfo.len, trailer_bufinfo.buf, trailer_bufinfo.len);
+        header_bufinfo.len, trailer_bufinfo.buf, trailer_bufinfo.len, args[ARG_preserve_colors].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -179,7 +186,7 @@ MP_PROPERTY_GETTER(pixelbuf_pixelbuf_bpp_obj,
 //|     """Float value between 0 and 1.  Output brightness.
 //|
 //|     When brightness is less than 1.0, a second buffer will be used to store the color values
-//|     before they are adjusted for brightness."""
+//|     before they are adjusted for brightness, unless ``preserve_colors`` was False."""
 STATIC mp_obj_t pixelbuf_pixelbuf_obj_get_brightness(mp_obj_t self_in) {
     return mp_obj_new_float(common_hal_adafruit_pixelbuf_pixelbuf_get_brightness(self_in));
 }
@@ -276,7 +283,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_fill_obj, pixelbuf_pixelbuf_f
 //|         intensity from 0-1.0."""
 //|         ...
 //|     @overload
-//|     def __setitem__(self, index: slice, value: PixelSequence) -> None: ...
+//|     def __setitem__(self, index: slice, value: PixelSequence) -> None:
+//|         """Sets the pixels in the slice. A flat buffer of bytes, with `bpp` bytes per pixel in
+//|         RGB[W] order, is converted without creating objects for each pixel."""
+//|         ...
 //|     @overload
 //|     def __setitem__(self, index: int, value: PixelType) -> None:
 //|         """Sets the pixel value at the given index.  Value can either be a tuple or integer.  Tuples are
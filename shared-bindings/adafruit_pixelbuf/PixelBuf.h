@@ -41,7 +41,7 @@ typedef union {
 
 void common_hal_adafruit_pixelbuf_pixelbuf_construct(pixelbuf_pixelbuf_obj_t *self, size_t n,
     pixelbuf_byteorder_details_t *byteorder, mp_float_t brightness, bool auto_write, uint8_t *header,
-    size_t header_len, uint8_t *trailer, size_t trailer_len);
+    size_t header_len, uint8_t *trailer, size_t trailer_len, bool preserve_colors);
 
 // These take mp_obj_t because they are called on subclasses of PixelBuf.
 uint8_t common_hal_adafruit_pixelbuf_pixelbuf_get_bpp(mp_obj_t self);
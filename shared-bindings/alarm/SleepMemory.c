@@ -49,6 +49,21 @@
 //|        import alarm
 //|        alarm.sleep_memory[0] = True
 //|        alarm.sleep_memory[1] = 12
+//|
+//|     `alarm.sleep_memory` also supports the buffer protocol, so a record of typed
+//|     values can be kept in it with `struct.pack_into` and `struct.unpack_from`,
+//|     without copying it through a `bytearray`. Check a version number or
+//|     `alarm.wake_alarm` before trusting the contents::
+//|
+//|        import alarm
+//|        import struct
+//|
+//|        RECORD = "<HIf"  # version, count, last reading
+//|        version, count, last = struct.unpack_from(RECORD, alarm.sleep_memory)
+//|        if alarm.wake_alarm is None or version != 1:
+//|            count = 0
+//|        reading = measure()
+//|        struct.pack_into(RECORD, alarm.sleep_memory, 0, 1, count + 1, reading)
 //|     """
 //|
 
@@ -170,6 +185,18 @@ STATIC mp_obj_t alarm_sleep_memory_subscr(mp_obj_t self_in, mp_obj_t index_in, m
     }
 }
 
+STATIC mp_int_t alarm_sleep_memory_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    alarm_sleep_memory_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint8_t *buf = common_hal_alarm_sleep_memory_get_buffer(self);
+    if (buf == NULL) {
+        return 1;
+    }
+    bufinfo->buf = buf;
+    bufinfo->len = common_hal_alarm_sleep_memory_get_length(self);
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
 const mp_obj_type_t alarm_sleep_memory_type = {
     { &mp_type_type },
     .name = MP_QSTR_SleepMemory,
@@ -178,5 +205,6 @@ const mp_obj_type_t alarm_sleep_memory_type = {
     MP_TYPE_EXTENDED_FIELDS(
         .subscr = alarm_sleep_memory_subscr,
         .unary_op = alarm_sleep_memory_unary_op,
+        .buffer_p = { .get_buffer = alarm_sleep_memory_get_buffer },
         ),
 };
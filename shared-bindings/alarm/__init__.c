@@ -39,6 +39,7 @@
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/supervisor/Runtime.h"
 #include "shared-bindings/time/__init__.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/workflow.h"
 
 //| """Alarms and sleep
@@ -306,10 +307,8 @@ const mp_obj_module_t alarm_module = {
     .globals = (mp_obj_dict_t *)&alarm_module_globals,
 };
 
-extern void port_idle_until_interrupt(void);
-
 MP_WEAK void common_hal_alarm_pretending_deep_sleep(void) {
-    port_idle_until_interrupt();
+    supervisor_sleep_until_interrupt();
 }
 
 MP_REGISTER_MODULE(MP_QSTR_alarm, alarm_module, CIRCUITPY_ALARM);
@@ -128,6 +128,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(analogbufio_bufferedin___exit___obj,
 //|         The ADC most significant bits of the ADC are kept. (See
 //|         https://docs.circuitpython.org/en/latest/docs/library/array.html)
 //|
+//|         When sampling has been started with `start`, the samples continue on from the
+//|         previous call without a gap, and the call returns once the buffer is full.
+//|
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer: A buffer for samples"""
 //|         ...
 //|
@@ -153,12 +156,56 @@ STATIC mp_obj_t analogbufio_bufferedin_obj_readinto(mp_obj_t self_in, mp_obj_t b
 }
 MP_DEFINE_CONST_FUN_OBJ_2(analogbufio_bufferedin_readinto_obj, analogbufio_bufferedin_obj_readinto);
 
+//|     def start(self) -> None:
+//|         """Start sampling continuously in the background at ``sample_rate``. Each `readinto`
+//|         then returns the samples that follow the ones returned before it. The samples are
+//|         held in a small internal buffer, so `readinto` must be called often enough to keep
+//|         up. When it falls behind, the oldest samples are dropped."""
+//|         ...
+//|
+STATIC mp_obj_t analogbufio_bufferedin_start(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_analogbufio_bufferedin_start(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_start_obj, analogbufio_bufferedin_start);
+
+//|     def stop(self) -> None:
+//|         """Stop sampling started by `start`. `readinto` goes back to capturing one buffer
+//|         at a time."""
+//|         ...
+//|
+STATIC mp_obj_t analogbufio_bufferedin_stop(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_analogbufio_bufferedin_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_stop_obj, analogbufio_bufferedin_stop);
+
+//|     sampling: bool
+//|     """True while sampling continuously after `start`. (read-only)"""
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_get_sampling(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_analogbufio_bufferedin_get_sampling(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_sampling_obj, analogbufio_bufferedin_obj_get_sampling);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_sampling_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_sampling_obj);
+
 STATIC const mp_rom_map_elem_t analogbufio_bufferedin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___del__),    MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit),     MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__),  MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__),   MP_ROM_PTR(&analogbufio_bufferedin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto),       MP_ROM_PTR(&analogbufio_bufferedin_readinto_obj)},
+    { MP_ROM_QSTR(MP_QSTR_start),      MP_ROM_PTR(&analogbufio_bufferedin_start_obj)},
+    { MP_ROM_QSTR(MP_QSTR_stop),       MP_ROM_PTR(&analogbufio_bufferedin_stop_obj)},
+    { MP_ROM_QSTR(MP_QSTR_sampling),   MP_ROM_PTR(&analogbufio_bufferedin_sampling_obj)},
 
 };
 
@@ -0,0 +1,229 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/arrayops/RingBuffer.h"
+#include "supervisor/shared/translate/translate.h"
+
+//| class RingBuffer:
+//|     """A fixed-capacity double-ended queue of numbers
+//|
+//|     Values are stored in preallocated storage of a single typecode, as in
+//|     `array.array`, so adding and removing them at either end does not
+//|     allocate memory, apart from the float objects returned for typecodes
+//|     *f* and *d*.
+//|
+//|     The buffer protocol gives the values from left to right, so a ring
+//|     buffer can be passed to functions that take an array. The storage is
+//|     rearranged in place when the values wrap around its end, so get a new
+//|     `memoryview` after adding or removing values."""
+//|
+//|     def __init__(self, typecode: str, capacity: int, *, overwrite: bool = True) -> None:
+//|         """Create an empty ring buffer.
+//|
+//|         :param str typecode: the type of the values, one of *b*, *B*, *h*, *H*, *i*, *I*,
+//|           *l*, *L*, *q*, *Q*, *f* or *d*
+//|         :param int capacity: the maximum number of values held
+//|         :param bool overwrite: when the buffer is full, adding a value discards one
+//|           from the opposite end if True, or raises `IndexError` if False
+//|
+//|         For example, a moving window over the last 32 readings::
+//|
+//|             window = arrayops.RingBuffer("h", 32)
+//|             window.append(reading)
+//|             average = arrayops.sum(window) / len(window)
+//|         """
+//|         ...
+STATIC mp_obj_t arrayops_ringbuffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_typecode, ARG_capacity, ARG_overwrite };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_typecode, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_capacity, MP_ARG_INT | MP_ARG_REQUIRED },
+        { MP_QSTR_overwrite, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t typecode_len;
+    const char *typecode = mp_obj_str_get_data(args[ARG_typecode].u_obj, &typecode_len);
+    if (typecode_len != 1 || strchr("bBhHiIlLqQfd", *typecode) == NULL) {
+        mp_raise_ValueError(translate("bad typecode"));
+    }
+    mp_int_t capacity = mp_arg_validate_int_min(args[ARG_capacity].u_int, 0, MP_QSTR_capacity);
+
+    arrayops_ringbuffer_obj_t *self = m_new_obj(arrayops_ringbuffer_obj_t);
+    self->base.type = &arrayops_ringbuffer_type;
+    common_hal_arrayops_ringbuffer_construct(self, *typecode, capacity, args[ARG_overwrite].u_bool);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     capacity: int
+//|     """The maximum number of values held. (read-only)"""
+STATIC mp_obj_t arrayops_ringbuffer_get_capacity(mp_obj_t self_in) {
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_arrayops_ringbuffer_get_capacity(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(arrayops_ringbuffer_get_capacity_obj, arrayops_ringbuffer_get_capacity);
+
+MP_PROPERTY_GETTER(arrayops_ringbuffer_capacity_obj,
+    (mp_obj_t)&arrayops_ringbuffer_get_capacity_obj);
+
+//|     def append(self, value: Union[int, float]) -> None:
+//|         """Add *value* to the right end."""
+//|         ...
+STATIC mp_obj_t arrayops_ringbuffer_append(mp_obj_t self_in, mp_obj_t value) {
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_arrayops_ringbuffer_append(self, value);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(arrayops_ringbuffer_append_obj, arrayops_ringbuffer_append);
+
+//|     def appendleft(self, value: Union[int, float]) -> None:
+//|         """Add *value* to the left end."""
+//|         ...
+STATIC mp_obj_t arrayops_ringbuffer_appendleft(mp_obj_t self_in, mp_obj_t value) {
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_arrayops_ringbuffer_appendleft(self, value);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(arrayops_ringbuffer_appendleft_obj, arrayops_ringbuffer_appendleft);
+
+//|     def extend(self, values: Iterable[Union[int, float]]) -> None:
+//|         """Add each of *values* to the right end, in order."""
+//|         ...
+STATIC mp_obj_t arrayops_ringbuffer_extend(mp_obj_t self_in, mp_obj_t values) {
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(values, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        common_hal_arrayops_ringbuffer_append(self, item);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(arrayops_ringbuffer_extend_obj, arrayops_ringbuffer_extend);
+
+//|     def pop(self) -> Union[int, float]:
+//|         """Remove and return the value at the right end.
+//|         Raises `IndexError` if the buffer is empty."""
+//|         ...
+STATIC mp_obj_t arrayops_ringbuffer_pop(mp_obj_t self_in) {
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_arrayops_ringbuffer_pop(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(arrayops_ringbuffer_pop_obj, arrayops_ringbuffer_pop);
+
+//|     def popleft(self) -> Union[int, float]:
+//|         """Remove and return the value at the left end.
+//|         Raises `IndexError` if the buffer is empty."""
+//|         ...
+STATIC mp_obj_t arrayops_ringbuffer_popleft(mp_obj_t self_in) {
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_arrayops_ringbuffer_popleft(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(arrayops_ringbuffer_popleft_obj, arrayops_ringbuffer_popleft);
+
+//|     def clear(self) -> None:
+//|         """Remove all values."""
+//|         ...
+STATIC mp_obj_t arrayops_ringbuffer_clear(mp_obj_t self_in) {
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_arrayops_ringbuffer_clear(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(arrayops_ringbuffer_clear_obj, arrayops_ringbuffer_clear);
+
+//|     def __len__(self) -> int:
+//|         """Return the number of values held."""
+//|         ...
+STATIC mp_obj_t arrayops_ringbuffer_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t len = common_hal_arrayops_ringbuffer_get_len(self);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(len);
+        default:
+            return MP_OBJ_NULL; // op not supported
+    }
+}
+
+//|     def __getitem__(self, index: int) -> Union[int, float]:
+//|         """Return the value at *index*, counting from the left end. Negative
+//|         indices count from the right end."""
+//|         ...
+//|     def __setitem__(self, index: int, value: Union[int, float]) -> None:
+//|         """Replace the value at *index*."""
+//|         ...
+//|
+STATIC mp_obj_t arrayops_ringbuffer_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t value) {
+    if (value == MP_OBJ_NULL) {
+        // delete not supported
+        return MP_OBJ_NULL;
+    }
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t index = mp_get_index(self->base.type, common_hal_arrayops_ringbuffer_get_len(self), index_in, false);
+    if (value == MP_OBJ_SENTINEL) {
+        // load
+        return common_hal_arrayops_ringbuffer_get_item(self, index);
+    }
+    // store
+    common_hal_arrayops_ringbuffer_set_item(self, index, value);
+    return mp_const_none;
+}
+
+STATIC mp_int_t arrayops_ringbuffer_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    (void)flags;
+    arrayops_ringbuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_arrayops_ringbuffer_get_buffer(self, bufinfo);
+    return 0;
+}
+
+STATIC const mp_rom_map_elem_t arrayops_ringbuffer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_capacity), MP_ROM_PTR(&arrayops_ringbuffer_capacity_obj) },
+    { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&arrayops_ringbuffer_append_obj) },
+    { MP_ROM_QSTR(MP_QSTR_appendleft), MP_ROM_PTR(&arrayops_ringbuffer_appendleft_obj) },
+    { MP_ROM_QSTR(MP_QSTR_extend), MP_ROM_PTR(&arrayops_ringbuffer_extend_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pop), MP_ROM_PTR(&arrayops_ringbuffer_pop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_popleft), MP_ROM_PTR(&arrayops_ringbuffer_popleft_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&arrayops_ringbuffer_clear_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(arrayops_ringbuffer_locals_dict, arrayops_ringbuffer_locals_dict_table);
+
+const mp_obj_type_t arrayops_ringbuffer_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_RingBuffer,
+    .make_new = arrayops_ringbuffer_make_new,
+    .locals_dict = (mp_obj_dict_t *)&arrayops_ringbuffer_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .unary_op = arrayops_ringbuffer_unary_op,
+        .subscr = arrayops_ringbuffer_subscr,
+        .buffer_p = { .get_buffer = arrayops_ringbuffer_get_buffer },
+        ),
+};
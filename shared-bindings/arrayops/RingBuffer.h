@@ -0,0 +1,43 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-module/arrayops/RingBuffer.h"
+
+extern const mp_obj_type_t arrayops_ringbuffer_type;
+
+void common_hal_arrayops_ringbuffer_construct(arrayops_ringbuffer_obj_t *self, char typecode, size_t capacity, bool overwrite);
+size_t common_hal_arrayops_ringbuffer_get_capacity(arrayops_ringbuffer_obj_t *self);
+size_t common_hal_arrayops_ringbuffer_get_len(arrayops_ringbuffer_obj_t *self);
+void common_hal_arrayops_ringbuffer_append(arrayops_ringbuffer_obj_t *self, mp_obj_t value);
+void common_hal_arrayops_ringbuffer_appendleft(arrayops_ringbuffer_obj_t *self, mp_obj_t value);
+mp_obj_t common_hal_arrayops_ringbuffer_pop(arrayops_ringbuffer_obj_t *self);
+mp_obj_t common_hal_arrayops_ringbuffer_popleft(arrayops_ringbuffer_obj_t *self);
+void common_hal_arrayops_ringbuffer_clear(arrayops_ringbuffer_obj_t *self);
+mp_obj_t common_hal_arrayops_ringbuffer_get_item(arrayops_ringbuffer_obj_t *self, size_t index);
+void common_hal_arrayops_ringbuffer_set_item(arrayops_ringbuffer_obj_t *self, size_t index, mp_obj_t value);
+void common_hal_arrayops_ringbuffer_get_buffer(arrayops_ringbuffer_obj_t *self, mp_buffer_info_t *bufinfo);
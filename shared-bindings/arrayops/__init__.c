@@ -0,0 +1,205 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/binary.h"
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/arrayops/__init__.h"
+#include "shared-bindings/arrayops/RingBuffer.h"
+
+#include "supervisor/shared/translate/translate.h"
+
+//| """Bulk arithmetic on arrays
+//|
+//| The `arrayops` module works on whole `array.array`, `memoryview` or
+//| `bytearray` objects at once, without creating an object per element. It
+//| covers simple preprocessing of sensor and audio data on boards which do
+//| not have `ulab`.
+//|
+//| Supported typecodes are *b*, *B*, *h*, *H*, *i*, *I*, *f* and *d*, and
+//| *l* and *L* where they are 32 bits wide. A `bytearray` is treated as
+//| typecode *B*.
+//|
+//| Results stored into an integer array are rounded to the nearest integer
+//| and saturated to the range of the typecode, so for instance adding 100 to
+//| ``array.array('b', [100])`` gives 127 rather than wrapping.
+//|
+//| `RingBuffer` is a fixed-capacity queue of numbers which can be passed to
+//| these functions in place of an array."""
+//|
+
+STATIC void arrayops_get_array(mp_obj_t obj, arrayops_array_t *array, mp_uint_t flags) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, flags);
+    char typecode = bufinfo.typecode;
+    if (typecode == BYTEARRAY_TYPECODE) {
+        typecode = 'B';
+    }
+    size_t size = 0;
+    switch (typecode) {
+        case 'b':
+        case 'B':
+        case 'h':
+        case 'H':
+        case 'i':
+        case 'I':
+        case 'l':
+        case 'L':
+        case 'f':
+        case 'd':
+            size = mp_binary_get_size('@', typecode, NULL);
+            break;
+    }
+    if (size == 0 || (size > 4 && typecode != 'd')) {
+        mp_raise_ValueError(translate("bad typecode"));
+    }
+    array->items = bufinfo.buf;
+    array->len = bufinfo.len / size;
+    array->typecode = typecode;
+}
+
+STATIC void arrayops_get_same_length(mp_obj_t obj, const arrayops_array_t *like, arrayops_array_t *array, mp_uint_t flags, qstr arg_name) {
+    arrayops_get_array(obj, array, flags);
+    (void)mp_arg_validate_length(array->len, like->len, arg_name);
+}
+
+//| def add(dest: WriteableBuffer, other: Union[int, float, ReadableBuffer]) -> None:
+//|     """Add *other* to each element of *dest*, in place.
+//|
+//|     If *other* is a number it is added to every element. Otherwise it must
+//|     be an array of the same length as *dest*, and each of its elements is
+//|     added to the corresponding element of *dest*."""
+//|     ...
+//|
+STATIC mp_obj_t arrayops_add(mp_obj_t dest_in, mp_obj_t other_in) {
+    arrayops_array_t dest;
+    arrayops_get_array(dest_in, &dest, MP_BUFFER_WRITE);
+    if (mp_obj_is_int(other_in)) {
+        common_hal_arrayops_add_int(&dest, mp_obj_get_int(other_in));
+    } else if (mp_obj_is_float(other_in)) {
+        common_hal_arrayops_add_float(&dest, mp_obj_get_float(other_in));
+    } else {
+        arrayops_array_t other;
+        arrayops_get_same_length(other_in, &dest, &other, MP_BUFFER_READ, MP_QSTR_other);
+        common_hal_arrayops_add(&dest, &other);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(arrayops_add_obj, arrayops_add);
+
+//| def mul(dest: WriteableBuffer, factor: Union[int, float]) -> None:
+//|     """Multiply each element of *dest* by *factor*, in place."""
+//|     ...
+//|
+STATIC mp_obj_t arrayops_mul(mp_obj_t dest_in, mp_obj_t factor_in) {
+    arrayops_array_t dest;
+    arrayops_get_array(dest_in, &dest, MP_BUFFER_WRITE);
+    if (mp_obj_is_int(factor_in)) {
+        common_hal_arrayops_mul_int(&dest, mp_obj_get_int(factor_in));
+    } else {
+        common_hal_arrayops_mul_float(&dest, mp_obj_get_float(factor_in));
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(arrayops_mul_obj, arrayops_mul);
+
+//| def sum(array: ReadableBuffer) -> Union[int, float]:
+//|     """Return the sum of the elements of *array*. The result is a float for
+//|     arrays of floats and an int otherwise. An empty array sums to 0."""
+//|     ...
+//|
+STATIC mp_obj_t arrayops_sum(mp_obj_t array_in) {
+    arrayops_array_t array;
+    arrayops_get_array(array_in, &array, MP_BUFFER_READ);
+    return common_hal_arrayops_sum(&array);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(arrayops_sum_obj, arrayops_sum);
+
+STATIC mp_obj_t arrayops_extreme(mp_obj_t array_in, size_t (*arg_fn)(const arrayops_array_t *)) {
+    arrayops_array_t array;
+    arrayops_get_array(array_in, &array, MP_BUFFER_READ);
+    if (array.len == 0) {
+        mp_raise_ValueError(translate("arg is an empty sequence"));
+    }
+    return mp_binary_get_val_array(array.typecode, array.items, arg_fn(&array));
+}
+
+//| def min(array: ReadableBuffer) -> Union[int, float]:
+//|     """Return the smallest element of *array*, which must not be empty."""
+//|     ...
+//|
+STATIC mp_obj_t arrayops_min(mp_obj_t array_in) {
+    return arrayops_extreme(array_in, common_hal_arrayops_argmin);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(arrayops_min_obj, arrayops_min);
+
+//| def max(array: ReadableBuffer) -> Union[int, float]:
+//|     """Return the largest element of *array*, which must not be empty."""
+//|     ...
+//|
+STATIC mp_obj_t arrayops_max(mp_obj_t array_in) {
+    return arrayops_extreme(array_in, common_hal_arrayops_argmax);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(arrayops_max_obj, arrayops_max);
+
+//| def convert(src: ReadableBuffer, dest: WriteableBuffer) -> None:
+//|     """Copy the elements of *src* into *dest*, which must have the same length
+//|     but may have a different typecode. For example, this converts
+//|     ``array.array('f')`` samples in the range -32768 to 32767 into
+//|     ``array.array('h')``.
+//|
+//|     *src* and *dest* must not overlap unless they are the same buffer."""
+//|     ...
+//|
+STATIC mp_obj_t arrayops_convert(mp_obj_t src_in, mp_obj_t dest_in) {
+    arrayops_array_t src, dest;
+    arrayops_get_array(src_in, &src, MP_BUFFER_READ);
+    arrayops_get_same_length(dest_in, &src, &dest, MP_BUFFER_WRITE, MP_QSTR_dest);
+    common_hal_arrayops_convert(&src, &dest);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(arrayops_convert_obj, arrayops_convert);
+
+STATIC const mp_rom_map_elem_t arrayops_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_arrayops) },
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&arrayops_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mul), MP_ROM_PTR(&arrayops_mul_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&arrayops_sum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&arrayops_min_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&arrayops_max_obj) },
+    { MP_ROM_QSTR(MP_QSTR_convert), MP_ROM_PTR(&arrayops_convert_obj) },
+    { MP_ROM_QSTR(MP_QSTR_RingBuffer), MP_ROM_PTR(&arrayops_ringbuffer_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(arrayops_module_globals, arrayops_module_globals_table);
+
+const mp_obj_module_t arrayops_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&arrayops_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_arrayops, arrayops_module, CIRCUITPY_ARRAYOPS);
@@ -0,0 +1,39 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-module/arrayops/__init__.h"
+
+void common_hal_arrayops_add(arrayops_array_t *dest, const arrayops_array_t *other);
+void common_hal_arrayops_add_int(arrayops_array_t *dest, mp_int_t value);
+void common_hal_arrayops_add_float(arrayops_array_t *dest, mp_float_t value);
+void common_hal_arrayops_mul_int(arrayops_array_t *dest, mp_int_t value);
+void common_hal_arrayops_mul_float(arrayops_array_t *dest, mp_float_t value);
+mp_obj_t common_hal_arrayops_sum(const arrayops_array_t *array);
+size_t common_hal_arrayops_argmin(const arrayops_array_t *array);
+size_t common_hal_arrayops_argmax(const arrayops_array_t *array);
+void common_hal_arrayops_convert(const arrayops_array_t *src, arrayops_array_t *dest);
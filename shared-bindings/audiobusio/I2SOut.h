@@ -48,6 +48,13 @@ void common_hal_audiobusio_i2sout_pause(audiobusio_i2sout_obj_t *self);
 void common_hal_audiobusio_i2sout_resume(audiobusio_i2sout_obj_t *self);
 bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t *self);
 
+#if CIRCUITPY_AUDIO_BUFFER_RING
+void common_hal_audiobusio_i2sout_set_buffer_count(audiobusio_i2sout_obj_t *self, uint8_t buffer_count);
+uint8_t common_hal_audiobusio_i2sout_get_buffer_count(audiobusio_i2sout_obj_t *self);
+uint32_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self);
+uint32_t common_hal_audiobusio_i2sout_get_late_fills(audiobusio_i2sout_obj_t *self);
+#endif
+
 #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOBUSIO_I2SOUT_H
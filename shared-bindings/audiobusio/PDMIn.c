@@ -33,6 +33,9 @@
 #include "py/runtime.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/audiobusio/PDMIn.h"
+#if CIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND
+#include "shared-module/audiocore/__init__.h"
+#endif
 #include "shared-bindings/util.h"
 #include "supervisor/shared/translate/translate.h"
 
@@ -68,6 +71,8 @@
 //|          Must be in range 0.0-1.0 seconds.
 //|
 //|         **Limitations:** On SAMD and RP2040, supports only 8 or 16 bit mono input, with 64x oversampling.
+//|         On RP2040, sample rates down to about 2000 Hz are also supported: the microphone is
+//|         clocked at a multiple of `sample_rate` x ``oversample`` and the extra bits decimated.
 //|         On nRF52840, supports only 16 bit mono input at 16 kHz; oversampling is fixed at 64x. Not provided
 //|         on nRF52833 for space reasons. Not available on Espressif.
 //|
@@ -90,6 +95,22 @@
 //|           b = array.array("H", [0] * 200)
 //|           with audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000, bit_depth=16) as mic:
 //|               mic.record(b, len(b))
+//|
+//|         On RP2040, the microphone can also record continuously in the background
+//|         after `start()`. Successive calls to `record()` then return the audio
+//|         without gaps between them. A PDMIn is also an audio sample, so it can be
+//|         played, for example through an `audiomixer.Mixer`, which starts it
+//|         recording. Only one of these should take the audio at a time::
+//|
+//|           import audiobusio
+//|           import audiomixer
+//|           import board
+//|
+//|           mic = audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000, bit_depth=16)
+//|           i2s = audiobusio.I2SOut(board.GP0, board.GP1, board.GP2)
+//|           mixer = audiomixer.Mixer(sample_rate=mic.sample_rate, channel_count=1, bits_per_sample=16, samples_signed=False)
+//|           i2s.play(mixer)
+//|           mixer.voice[0].play(mic)
 //|         """
 //|     ...
 STATIC mp_obj_t audiobusio_pdmin_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
@@ -232,12 +253,73 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_sample_rate_obj, audiobusio_pdmin
 MP_PROPERTY_GETTER(audiobusio_pdmin_sample_rate_obj,
     (mp_obj_t)&audiobusio_pdmin_get_sample_rate_obj);
 
+#if CIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND
+//|     def start(self) -> None:
+//|         """Start recording continuously into a buffer in the background. `record()`
+//|         then takes the audio recorded since the last call, so that audio can be
+//|         streamed without gaps. Does nothing if already recording.
+//|
+//|         The background buffer holds only a few tens of milliseconds of audio. If
+//|         it is not emptied in time, `record()` returns fewer samples than asked for."""
+//|         ...
+STATIC mp_obj_t audiobusio_pdmin_obj_start(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiobusio_pdmin_start(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_start_obj, audiobusio_pdmin_obj_start);
+
+//|     def stop(self) -> None:
+//|         """Stop recording in the background. Anything playing the microphone stops too."""
+//|         ...
+STATIC mp_obj_t audiobusio_pdmin_obj_stop(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiobusio_pdmin_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_stop_obj, audiobusio_pdmin_obj_stop);
+
+//|     recording: bool
+//|     """True when recording in the background. (read-only)"""
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_get_recording(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_audiobusio_pdmin_get_recording(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_recording_obj, audiobusio_pdmin_obj_get_recording);
+
+MP_PROPERTY_GETTER(audiobusio_pdmin_recording_obj,
+    (mp_obj_t)&audiobusio_pdmin_get_recording_obj);
+
+STATIC uint8_t audiobusio_pdmin_get_channel_count(audiobusio_pdmin_obj_t *self) {
+    return 1;
+}
+
+STATIC const audiosample_p_t audiobusio_pdmin_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audiobusio_pdmin_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audiobusio_pdmin_get_bit_depth,
+    .channel_count = (audiosample_channel_count_fun)audiobusio_pdmin_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiobusio_pdmin_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiobusio_pdmin_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiobusio_pdmin_get_buffer_structure,
+};
+#endif
+
 STATIC const mp_rom_map_elem_t audiobusio_pdmin_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiobusio_pdmin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiobusio_pdmin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_record), MP_ROM_PTR(&audiobusio_pdmin_record_obj) },
+    #if CIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&audiobusio_pdmin_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&audiobusio_pdmin_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recording), MP_ROM_PTR(&audiobusio_pdmin_recording_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_pdmin_sample_rate_obj) }
 };
 STATIC MP_DEFINE_CONST_DICT(audiobusio_pdmin_locals_dict, audiobusio_pdmin_locals_dict_table);
@@ -250,4 +332,10 @@ const mp_obj_type_t audiobusio_pdmin_type = {
     #if CIRCUITPY_AUDIOBUSIO_PDMIN
     .locals_dict = (mp_obj_dict_t *)&audiobusio_pdmin_locals_dict,
     #endif
+    #if CIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    MP_TYPE_EXTENDED_FIELDS(
+        .protocol = &audiobusio_pdmin_proto,
+        ),
+    #endif
 };
@@ -43,6 +43,11 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
     uint16_t *buffer, uint32_t length);
 uint8_t common_hal_audiobusio_pdmin_get_bit_depth(audiobusio_pdmin_obj_t *self);
 uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t *self);
+#if CIRCUITPY_AUDIOBUSIO_PDMIN_BACKGROUND
+void common_hal_audiobusio_pdmin_start(audiobusio_pdmin_obj_t *self);
+void common_hal_audiobusio_pdmin_stop(audiobusio_pdmin_obj_t *self);
+bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t *self);
+#endif
 // TODO(tannewt): Add record to file
 #endif
 
@@ -130,6 +130,21 @@ STATIC mp_obj_t audioio_wavefile_obj___exit__(size_t n_args, const mp_obj_t *arg
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioio_wavefile___exit___obj, 4, 4, audioio_wavefile_obj___exit__);
 
+//|     def seek(self, frame: int) -> None:
+//|         """Continue playback from the given frame, counted from the start of the sample data.
+//|         A frame holds one sample for each channel. The seek takes effect at the next buffer
+//|         the output requests. A sample that is looped, or played again, restarts from frame 0."""
+//|         ...
+STATIC mp_obj_t audioio_wavefile_obj_seek(mp_obj_t self_in, mp_obj_t frame_in) {
+    audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t frame = mp_arg_validate_int_range(mp_obj_get_int(frame_in),
+        0, common_hal_audioio_wavefile_get_frame_count(self), MP_QSTR_frame);
+    common_hal_audioio_wavefile_seek(self, frame);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(audioio_wavefile_seek_obj, audioio_wavefile_obj_seek);
+
 //|     sample_rate: int
 //|     """32 bit value that dictates how quickly samples are loaded into the DAC
 //|     in Hertz (cycles per second). When the sample is looped, this can change
@@ -183,6 +198,7 @@ STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_wavefile_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_wavefile___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&audioio_wavefile_seek_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_wavefile_sample_rate_obj) },
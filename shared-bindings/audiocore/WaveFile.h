@@ -43,5 +43,7 @@ uint32_t common_hal_audioio_wavefile_get_sample_rate(audioio_wavefile_obj_t *sel
 void common_hal_audioio_wavefile_set_sample_rate(audioio_wavefile_obj_t *self, uint32_t sample_rate);
 uint8_t common_hal_audioio_wavefile_get_bits_per_sample(audioio_wavefile_obj_t *self);
 uint8_t common_hal_audioio_wavefile_get_channel_count(audioio_wavefile_obj_t *self);
+uint32_t common_hal_audioio_wavefile_get_frame_count(audioio_wavefile_obj_t *self);
+void common_hal_audioio_wavefile_seek(audioio_wavefile_obj_t *self, uint32_t frame);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOIO_WAVEFILE_H
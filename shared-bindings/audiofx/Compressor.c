@@ -0,0 +1,279 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared/runtime/context_manager_helpers.h"
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-bindings/audiofx/Compressor.h"
+#include "shared-bindings/util.h"
+#include "shared-module/audiofx/Compressor.h"
+
+//| class Compressor:
+//|     """A dynamic range compressor
+//|
+//|     When the level of the source rises above `threshold`, the amount over is
+//|     divided by `ratio`. The level follows the peaks of the source, rising with
+//|     the `attack` time and falling with the `release` time. The gain is updated
+//|     every 16 frames and ramps smoothly in between. Both channels of a stereo
+//|     source get the same gain."""
+//|
+//|     def __init__(
+//|         self,
+//|         source: circuitpython_typing.AudioSample,
+//|         *,
+//|         threshold: float = 0.5,
+//|         ratio: float = 4.0,
+//|         attack: float = 0.01,
+//|         release: float = 0.1,
+//|         gain: float = 1.0,
+//|     ) -> None:
+//|         """Create an effect that processes ``source``
+//|
+//|         The output has the sample rate and channel count of the source, and is always
+//|         16 bit signed. The source may be any audio sample, including another effect,
+//|         a `synthio.Synthesizer`, or an `audiomixer.Mixer`. When the source ends, the
+//|         output continues until the effect has died away.
+//|
+//|         :param ~circuitpython_typing.AudioSample source: The audio to process
+//|         :param float threshold: The level above which the source is compressed, from 0 to 1 of full scale
+//|         :param float ratio: How much the level above the threshold is reduced, from 1 (not at all) to 100
+//|         :param float attack: The time for the level to rise, in seconds
+//|         :param float release: The time for the level to fall, in seconds
+//|         :param float gain: The gain applied after compression, from 0 to 8
+//|         """
+STATIC mp_obj_t audiofx_compressor_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_source, ARG_threshold, ARG_ratio, ARG_attack, ARG_release, ARG_gain };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_threshold, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_ratio, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_attack, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_release, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_gain, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t threshold = audiofx_arg_float(args[ARG_threshold].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_threshold);
+    mp_float_t ratio = audiofx_arg_float(args[ARG_ratio].u_obj, MICROPY_FLOAT_CONST(4.0), 1, 100, MP_QSTR_ratio);
+    mp_float_t attack = audiofx_arg_float(args[ARG_attack].u_obj, MICROPY_FLOAT_CONST(0.01), 0, 10, MP_QSTR_attack);
+    mp_float_t release = audiofx_arg_float(args[ARG_release].u_obj, MICROPY_FLOAT_CONST(0.1), 0, 10, MP_QSTR_release);
+    mp_float_t gain = audiofx_arg_float(args[ARG_gain].u_obj, MICROPY_FLOAT_CONST(1.0), 0, 8, MP_QSTR_gain);
+
+    audiofx_compressor_obj_t *self = m_new_obj(audiofx_compressor_obj_t);
+    self->base.base.type = &audiofx_compressor_type;
+    common_hal_audiofx_compressor_construct(self, args[ARG_source].u_obj, threshold, ratio, attack, release, gain);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Compressor and releases all memory resources for reuse."""
+//|         ...
+STATIC mp_obj_t audiofx_compressor_deinit(mp_obj_t self_in) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofx_compressor_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiofx_compressor_deinit_obj, audiofx_compressor_deinit);
+
+STATIC void check_for_deinit(audiofx_compressor_obj_t *self) {
+    if (common_hal_audiofx_compressor_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> Compressor:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audiofx_compressor_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiofx_compressor_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofx_compressor___exit___obj, 4, 4, audiofx_compressor_obj___exit__);
+
+//|     source: circuitpython_typing.AudioSample
+//|     """The audio being processed (read-only)"""
+STATIC mp_obj_t audiofx_compressor_obj_get_source(mp_obj_t self_in) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return self->base.source;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_compressor_get_source_obj, audiofx_compressor_obj_get_source);
+
+MP_PROPERTY_GETTER(audiofx_compressor_source_obj,
+    (mp_obj_t)&audiofx_compressor_get_source_obj);
+
+//|     threshold: float
+//|     """The level above which the source is compressed, from 0 to 1 of full scale"""
+STATIC mp_obj_t audiofx_compressor_obj_get_threshold(mp_obj_t self_in) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_compressor_get_threshold(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_compressor_get_threshold_obj, audiofx_compressor_obj_get_threshold);
+
+STATIC mp_obj_t audiofx_compressor_obj_set_threshold(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_compressor_set_threshold(self, mp_arg_validate_obj_float_range(arg, 0, 1, MP_QSTR_threshold));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_compressor_set_threshold_obj, audiofx_compressor_obj_set_threshold);
+
+MP_PROPERTY_GETSET(audiofx_compressor_threshold_obj,
+    (mp_obj_t)&audiofx_compressor_get_threshold_obj,
+    (mp_obj_t)&audiofx_compressor_set_threshold_obj);
+
+//|     ratio: float
+//|     """How much the level above the threshold is reduced, from 1 (not at all) to 100"""
+STATIC mp_obj_t audiofx_compressor_obj_get_ratio(mp_obj_t self_in) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_compressor_get_ratio(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_compressor_get_ratio_obj, audiofx_compressor_obj_get_ratio);
+
+STATIC mp_obj_t audiofx_compressor_obj_set_ratio(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_compressor_set_ratio(self, mp_arg_validate_obj_float_range(arg, 1, 100, MP_QSTR_ratio));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_compressor_set_ratio_obj, audiofx_compressor_obj_set_ratio);
+
+MP_PROPERTY_GETSET(audiofx_compressor_ratio_obj,
+    (mp_obj_t)&audiofx_compressor_get_ratio_obj,
+    (mp_obj_t)&audiofx_compressor_set_ratio_obj);
+
+//|     attack: float
+//|     """The time for the level to rise, in seconds"""
+STATIC mp_obj_t audiofx_compressor_obj_get_attack(mp_obj_t self_in) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_compressor_get_attack(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_compressor_get_attack_obj, audiofx_compressor_obj_get_attack);
+
+STATIC mp_obj_t audiofx_compressor_obj_set_attack(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_compressor_set_attack(self, mp_arg_validate_obj_float_range(arg, 0, 10, MP_QSTR_attack));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_compressor_set_attack_obj, audiofx_compressor_obj_set_attack);
+
+MP_PROPERTY_GETSET(audiofx_compressor_attack_obj,
+    (mp_obj_t)&audiofx_compressor_get_attack_obj,
+    (mp_obj_t)&audiofx_compressor_set_attack_obj);
+
+//|     release: float
+//|     """The time for the level to fall, in seconds"""
+STATIC mp_obj_t audiofx_compressor_obj_get_release(mp_obj_t self_in) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_compressor_get_release(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_compressor_get_release_obj, audiofx_compressor_obj_get_release);
+
+STATIC mp_obj_t audiofx_compressor_obj_set_release(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_compressor_set_release(self, mp_arg_validate_obj_float_range(arg, 0, 10, MP_QSTR_release));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_compressor_set_release_obj, audiofx_compressor_obj_set_release);
+
+MP_PROPERTY_GETSET(audiofx_compressor_release_obj,
+    (mp_obj_t)&audiofx_compressor_get_release_obj,
+    (mp_obj_t)&audiofx_compressor_set_release_obj);
+
+//|     gain: float
+//|     """The gain applied after compression, from 0 to 8"""
+//|
+STATIC mp_obj_t audiofx_compressor_obj_get_gain(mp_obj_t self_in) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_compressor_get_gain(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_compressor_get_gain_obj, audiofx_compressor_obj_get_gain);
+
+STATIC mp_obj_t audiofx_compressor_obj_set_gain(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_compressor_set_gain(self, mp_arg_validate_obj_float_range(arg, 0, 8, MP_QSTR_gain));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_compressor_set_gain_obj, audiofx_compressor_obj_set_gain);
+
+MP_PROPERTY_GETSET(audiofx_compressor_gain_obj,
+    (mp_obj_t)&audiofx_compressor_get_gain_obj,
+    (mp_obj_t)&audiofx_compressor_set_gain_obj);
+
+STATIC const mp_rom_map_elem_t audiofx_compressor_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofx_compressor_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofx_compressor___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_source), MP_ROM_PTR(&audiofx_compressor_source_obj) },
+    { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&audiofx_compressor_threshold_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ratio), MP_ROM_PTR(&audiofx_compressor_ratio_obj) },
+    { MP_ROM_QSTR(MP_QSTR_attack), MP_ROM_PTR(&audiofx_compressor_attack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_release), MP_ROM_PTR(&audiofx_compressor_release_obj) },
+    { MP_ROM_QSTR(MP_QSTR_gain), MP_ROM_PTR(&audiofx_compressor_gain_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofx_compressor_locals_dict, audiofx_compressor_locals_dict_table);
+
+STATIC const audiosample_p_t audiofx_compressor_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)audiofx_base_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)audiofx_base_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)audiofx_base_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofx_compressor_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofx_compressor_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofx_base_get_buffer_structure,
+};
+
+const mp_obj_type_t audiofx_compressor_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Compressor,
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .make_new = audiofx_compressor_make_new,
+    .locals_dict = (mp_obj_dict_t *)&audiofx_compressor_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .protocol = &audiofx_compressor_proto,
+        ),
+};
@@ -0,0 +1,252 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared/runtime/context_manager_helpers.h"
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-bindings/audiofx/Delay.h"
+#include "shared-bindings/util.h"
+#include "shared-module/audiofx/Delay.h"
+
+//| class Delay:
+//|     """An echo effect
+//|
+//|     The source is mixed with a copy of itself from `delay` seconds before. With
+//|     `feedback`, each echo is fed back into the delay line, so it repeats and
+//|     fades away."""
+//|
+//|     def __init__(
+//|         self,
+//|         source: circuitpython_typing.AudioSample,
+//|         *,
+//|         delay: float = 0.25,
+//|         max_delay: Optional[float] = None,
+//|         feedback: float = 0.5,
+//|         mix: float = 0.5,
+//|     ) -> None:
+//|         """Create an effect that processes ``source``
+//|
+//|         The output has the sample rate and channel count of the source, and is always
+//|         16 bit signed. The source may be any audio sample, including another effect,
+//|         a `synthio.Synthesizer`, or an `audiomixer.Mixer`. When the source ends, the
+//|         output continues until the effect has died away.
+//|
+//|         :param ~circuitpython_typing.AudioSample source: The audio to process
+//|         :param float delay: The time between the source and its echo, in seconds
+//|         :param float max_delay: The longest `delay` that can be set later, in seconds. It sets the size of the delay line, which needs 2 bytes per channel per frame. It defaults to the initial `delay`.
+//|         :param float feedback: How much of each echo is fed back into the delay line, from 0 to 1
+//|         :param float mix: The balance of the output, from 0 (only the source) to 1 (only the echo)
+//|         """
+STATIC mp_obj_t audiofx_delay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_source, ARG_delay, ARG_max_delay, ARG_feedback, ARG_mix };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_delay, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_max_delay, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_feedback, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_mix, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t delay = audiofx_arg_float(args[ARG_delay].u_obj, MICROPY_FLOAT_CONST(0.25), 0, 10, MP_QSTR_delay);
+    mp_float_t max_delay = delay;
+    if (args[ARG_max_delay].u_obj != MP_OBJ_NULL && args[ARG_max_delay].u_obj != mp_const_none) {
+        max_delay = audiofx_arg_float(args[ARG_max_delay].u_obj, delay, 0, 10, MP_QSTR_max_delay);
+    }
+    if (delay > max_delay) {
+        mp_arg_error_invalid(MP_QSTR_delay);
+    }
+    mp_float_t feedback = audiofx_arg_float(args[ARG_feedback].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_feedback);
+    mp_float_t mix = audiofx_arg_float(args[ARG_mix].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_mix);
+
+    audiofx_delay_obj_t *self = m_new_obj(audiofx_delay_obj_t);
+    self->base.base.type = &audiofx_delay_type;
+    common_hal_audiofx_delay_construct(self, args[ARG_source].u_obj, delay, max_delay, feedback, mix);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Delay and releases all memory resources for reuse."""
+//|         ...
+STATIC mp_obj_t audiofx_delay_deinit(mp_obj_t self_in) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofx_delay_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_deinit_obj, audiofx_delay_deinit);
+
+STATIC void check_for_deinit(audiofx_delay_obj_t *self) {
+    if (common_hal_audiofx_delay_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> Delay:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audiofx_delay_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiofx_delay_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofx_delay___exit___obj, 4, 4, audiofx_delay_obj___exit__);
+
+//|     source: circuitpython_typing.AudioSample
+//|     """The audio being processed (read-only)"""
+STATIC mp_obj_t audiofx_delay_obj_get_source(mp_obj_t self_in) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return self->base.source;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_get_source_obj, audiofx_delay_obj_get_source);
+
+MP_PROPERTY_GETTER(audiofx_delay_source_obj,
+    (mp_obj_t)&audiofx_delay_get_source_obj);
+
+//|     delay: float
+//|     """The time between the source and its echo, in seconds"""
+STATIC mp_obj_t audiofx_delay_obj_get_delay(mp_obj_t self_in) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_delay_get_delay(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_get_delay_obj, audiofx_delay_obj_get_delay);
+
+STATIC mp_obj_t audiofx_delay_obj_set_delay(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_float_t delay = mp_arg_validate_obj_float_non_negative(arg, 0, MP_QSTR_delay);
+    if (delay > common_hal_audiofx_delay_get_max_delay(self)) {
+        mp_arg_error_invalid(MP_QSTR_delay);
+    }
+    common_hal_audiofx_delay_set_delay(self, delay);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_delay_set_delay_obj, audiofx_delay_obj_set_delay);
+
+MP_PROPERTY_GETSET(audiofx_delay_delay_obj,
+    (mp_obj_t)&audiofx_delay_get_delay_obj,
+    (mp_obj_t)&audiofx_delay_set_delay_obj);
+
+//|     max_delay: float
+//|     """The longest `delay` that can be set later, in seconds. It sets the size of the delay line, which needs 2 bytes per channel per frame. It defaults to the initial `delay`. (read-only)"""
+STATIC mp_obj_t audiofx_delay_obj_get_max_delay(mp_obj_t self_in) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_delay_get_max_delay(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_get_max_delay_obj, audiofx_delay_obj_get_max_delay);
+
+MP_PROPERTY_GETTER(audiofx_delay_max_delay_obj,
+    (mp_obj_t)&audiofx_delay_get_max_delay_obj);
+
+//|     feedback: float
+//|     """How much of each echo is fed back into the delay line, from 0 to 1"""
+STATIC mp_obj_t audiofx_delay_obj_get_feedback(mp_obj_t self_in) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_delay_get_feedback(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_get_feedback_obj, audiofx_delay_obj_get_feedback);
+
+STATIC mp_obj_t audiofx_delay_obj_set_feedback(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_delay_set_feedback(self, mp_arg_validate_obj_float_range(arg, 0, 1, MP_QSTR_feedback));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_delay_set_feedback_obj, audiofx_delay_obj_set_feedback);
+
+MP_PROPERTY_GETSET(audiofx_delay_feedback_obj,
+    (mp_obj_t)&audiofx_delay_get_feedback_obj,
+    (mp_obj_t)&audiofx_delay_set_feedback_obj);
+
+//|     mix: float
+//|     """The balance of the output, from 0 (only the source) to 1 (only the echo)"""
+//|
+STATIC mp_obj_t audiofx_delay_obj_get_mix(mp_obj_t self_in) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_delay_get_mix(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_get_mix_obj, audiofx_delay_obj_get_mix);
+
+STATIC mp_obj_t audiofx_delay_obj_set_mix(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_delay_set_mix(self, mp_arg_validate_obj_float_range(arg, 0, 1, MP_QSTR_mix));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_delay_set_mix_obj, audiofx_delay_obj_set_mix);
+
+MP_PROPERTY_GETSET(audiofx_delay_mix_obj,
+    (mp_obj_t)&audiofx_delay_get_mix_obj,
+    (mp_obj_t)&audiofx_delay_set_mix_obj);
+
+STATIC const mp_rom_map_elem_t audiofx_delay_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofx_delay_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofx_delay___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_source), MP_ROM_PTR(&audiofx_delay_source_obj) },
+    { MP_ROM_QSTR(MP_QSTR_delay), MP_ROM_PTR(&audiofx_delay_delay_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max_delay), MP_ROM_PTR(&audiofx_delay_max_delay_obj) },
+    { MP_ROM_QSTR(MP_QSTR_feedback), MP_ROM_PTR(&audiofx_delay_feedback_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audiofx_delay_mix_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofx_delay_locals_dict, audiofx_delay_locals_dict_table);
+
+STATIC const audiosample_p_t audiofx_delay_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)audiofx_base_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)audiofx_base_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)audiofx_base_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofx_delay_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofx_delay_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofx_base_get_buffer_structure,
+};
+
+const mp_obj_type_t audiofx_delay_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Delay,
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .make_new = audiofx_delay_make_new,
+    .locals_dict = (mp_obj_dict_t *)&audiofx_delay_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .protocol = &audiofx_delay_proto,
+        ),
+};
@@ -0,0 +1,279 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared/runtime/context_manager_helpers.h"
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-bindings/audiofx/EQ.h"
+#include "shared-bindings/util.h"
+#include "shared-module/audiofx/EQ.h"
+
+//| class EQ:
+//|     """A three band equalizer
+//|
+//|     The source is split into low, mid and high bands at two crossover
+//|     frequencies, and each band has its own gain. The crossovers are gentle
+//|     (6dB per octave), which suits tone controls more than removing a
+//|     particular frequency. With all three gains at 1 the output is exactly the
+//|     source."""
+//|
+//|     def __init__(
+//|         self,
+//|         source: circuitpython_typing.AudioSample,
+//|         *,
+//|         low_frequency: float = 250,
+//|         high_frequency: float = 4000,
+//|         low: float = 1.0,
+//|         mid: float = 1.0,
+//|         high: float = 1.0,
+//|     ) -> None:
+//|         """Create an effect that processes ``source``
+//|
+//|         The output has the sample rate and channel count of the source, and is always
+//|         16 bit signed. The source may be any audio sample, including another effect,
+//|         a `synthio.Synthesizer`, or an `audiomixer.Mixer`. When the source ends, the
+//|         output continues until the effect has died away.
+//|
+//|         :param ~circuitpython_typing.AudioSample source: The audio to process
+//|         :param float low_frequency: The crossover between the low and mid bands, in Hz
+//|         :param float high_frequency: The crossover between the mid and high bands, in Hz
+//|         :param float low: The gain of the low band, from 0 to 4
+//|         :param float mid: The gain of the mid band, from 0 to 4
+//|         :param float high: The gain of the high band, from 0 to 4
+//|         """
+STATIC mp_obj_t audiofx_eq_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_source, ARG_low_frequency, ARG_high_frequency, ARG_low, ARG_mid, ARG_high };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_low_frequency, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_high_frequency, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_low, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_mid, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_high, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t low_frequency = audiofx_arg_float(args[ARG_low_frequency].u_obj, MICROPY_FLOAT_CONST(250.), 1, audiosample_sample_rate(args[ARG_source].u_obj) / 2, MP_QSTR_low_frequency);
+    mp_float_t high_frequency = audiofx_arg_float(args[ARG_high_frequency].u_obj, MICROPY_FLOAT_CONST(4000.), 1, audiosample_sample_rate(args[ARG_source].u_obj) / 2, MP_QSTR_high_frequency);
+    mp_float_t low = audiofx_arg_float(args[ARG_low].u_obj, MICROPY_FLOAT_CONST(1.0), 0, 4, MP_QSTR_low);
+    mp_float_t mid = audiofx_arg_float(args[ARG_mid].u_obj, MICROPY_FLOAT_CONST(1.0), 0, 4, MP_QSTR_mid);
+    mp_float_t high = audiofx_arg_float(args[ARG_high].u_obj, MICROPY_FLOAT_CONST(1.0), 0, 4, MP_QSTR_high);
+
+    audiofx_eq_obj_t *self = m_new_obj(audiofx_eq_obj_t);
+    self->base.base.type = &audiofx_eq_type;
+    common_hal_audiofx_eq_construct(self, args[ARG_source].u_obj, low_frequency, high_frequency, low, mid, high);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the EQ and releases all memory resources for reuse."""
+//|         ...
+STATIC mp_obj_t audiofx_eq_deinit(mp_obj_t self_in) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofx_eq_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiofx_eq_deinit_obj, audiofx_eq_deinit);
+
+STATIC void check_for_deinit(audiofx_eq_obj_t *self) {
+    if (common_hal_audiofx_eq_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> EQ:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audiofx_eq_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiofx_eq_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofx_eq___exit___obj, 4, 4, audiofx_eq_obj___exit__);
+
+//|     source: circuitpython_typing.AudioSample
+//|     """The audio being processed (read-only)"""
+STATIC mp_obj_t audiofx_eq_obj_get_source(mp_obj_t self_in) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return self->base.source;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_eq_get_source_obj, audiofx_eq_obj_get_source);
+
+MP_PROPERTY_GETTER(audiofx_eq_source_obj,
+    (mp_obj_t)&audiofx_eq_get_source_obj);
+
+//|     low_frequency: float
+//|     """The crossover between the low and mid bands, in Hz"""
+STATIC mp_obj_t audiofx_eq_obj_get_low_frequency(mp_obj_t self_in) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_eq_get_low_frequency(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_eq_get_low_frequency_obj, audiofx_eq_obj_get_low_frequency);
+
+STATIC mp_obj_t audiofx_eq_obj_set_low_frequency(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_eq_set_low_frequency(self, mp_arg_validate_obj_float_range(arg, 1, self->base.sample_rate / 2, MP_QSTR_low_frequency));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_eq_set_low_frequency_obj, audiofx_eq_obj_set_low_frequency);
+
+MP_PROPERTY_GETSET(audiofx_eq_low_frequency_obj,
+    (mp_obj_t)&audiofx_eq_get_low_frequency_obj,
+    (mp_obj_t)&audiofx_eq_set_low_frequency_obj);
+
+//|     high_frequency: float
+//|     """The crossover between the mid and high bands, in Hz"""
+STATIC mp_obj_t audiofx_eq_obj_get_high_frequency(mp_obj_t self_in) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_eq_get_high_frequency(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_eq_get_high_frequency_obj, audiofx_eq_obj_get_high_frequency);
+
+STATIC mp_obj_t audiofx_eq_obj_set_high_frequency(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_eq_set_high_frequency(self, mp_arg_validate_obj_float_range(arg, 1, self->base.sample_rate / 2, MP_QSTR_high_frequency));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_eq_set_high_frequency_obj, audiofx_eq_obj_set_high_frequency);
+
+MP_PROPERTY_GETSET(audiofx_eq_high_frequency_obj,
+    (mp_obj_t)&audiofx_eq_get_high_frequency_obj,
+    (mp_obj_t)&audiofx_eq_set_high_frequency_obj);
+
+//|     low: float
+//|     """The gain of the low band, from 0 to 4"""
+STATIC mp_obj_t audiofx_eq_obj_get_low(mp_obj_t self_in) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_eq_get_low(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_eq_get_low_obj, audiofx_eq_obj_get_low);
+
+STATIC mp_obj_t audiofx_eq_obj_set_low(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_eq_set_low(self, mp_arg_validate_obj_float_range(arg, 0, 4, MP_QSTR_low));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_eq_set_low_obj, audiofx_eq_obj_set_low);
+
+MP_PROPERTY_GETSET(audiofx_eq_low_obj,
+    (mp_obj_t)&audiofx_eq_get_low_obj,
+    (mp_obj_t)&audiofx_eq_set_low_obj);
+
+//|     mid: float
+//|     """The gain of the mid band, from 0 to 4"""
+STATIC mp_obj_t audiofx_eq_obj_get_mid(mp_obj_t self_in) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_eq_get_mid(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_eq_get_mid_obj, audiofx_eq_obj_get_mid);
+
+STATIC mp_obj_t audiofx_eq_obj_set_mid(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_eq_set_mid(self, mp_arg_validate_obj_float_range(arg, 0, 4, MP_QSTR_mid));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_eq_set_mid_obj, audiofx_eq_obj_set_mid);
+
+MP_PROPERTY_GETSET(audiofx_eq_mid_obj,
+    (mp_obj_t)&audiofx_eq_get_mid_obj,
+    (mp_obj_t)&audiofx_eq_set_mid_obj);
+
+//|     high: float
+//|     """The gain of the high band, from 0 to 4"""
+//|
+STATIC mp_obj_t audiofx_eq_obj_get_high(mp_obj_t self_in) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_eq_get_high(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_eq_get_high_obj, audiofx_eq_obj_get_high);
+
+STATIC mp_obj_t audiofx_eq_obj_set_high(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_eq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_eq_set_high(self, mp_arg_validate_obj_float_range(arg, 0, 4, MP_QSTR_high));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_eq_set_high_obj, audiofx_eq_obj_set_high);
+
+MP_PROPERTY_GETSET(audiofx_eq_high_obj,
+    (mp_obj_t)&audiofx_eq_get_high_obj,
+    (mp_obj_t)&audiofx_eq_set_high_obj);
+
+STATIC const mp_rom_map_elem_t audiofx_eq_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofx_eq_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofx_eq___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_source), MP_ROM_PTR(&audiofx_eq_source_obj) },
+    { MP_ROM_QSTR(MP_QSTR_low_frequency), MP_ROM_PTR(&audiofx_eq_low_frequency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_high_frequency), MP_ROM_PTR(&audiofx_eq_high_frequency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_low), MP_ROM_PTR(&audiofx_eq_low_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mid), MP_ROM_PTR(&audiofx_eq_mid_obj) },
+    { MP_ROM_QSTR(MP_QSTR_high), MP_ROM_PTR(&audiofx_eq_high_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofx_eq_locals_dict, audiofx_eq_locals_dict_table);
+
+STATIC const audiosample_p_t audiofx_eq_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)audiofx_base_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)audiofx_base_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)audiofx_base_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofx_eq_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofx_eq_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofx_base_get_buffer_structure,
+};
+
+const mp_obj_type_t audiofx_eq_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_EQ,
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .make_new = audiofx_eq_make_new,
+    .locals_dict = (mp_obj_dict_t *)&audiofx_eq_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .protocol = &audiofx_eq_proto,
+        ),
+};
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct audiofx_eq_obj audiofx_eq_obj_t;
+extern const mp_obj_type_t audiofx_eq_type;
+
+void common_hal_audiofx_eq_construct(audiofx_eq_obj_t *self, mp_obj_t source,
+    mp_float_t low_frequency, mp_float_t high_frequency, mp_float_t low, mp_float_t mid, mp_float_t high);
+void common_hal_audiofx_eq_deinit(audiofx_eq_obj_t *self);
+bool common_hal_audiofx_eq_deinited(audiofx_eq_obj_t *self);
+
+mp_float_t common_hal_audiofx_eq_get_low_frequency(audiofx_eq_obj_t *self);
+void common_hal_audiofx_eq_set_low_frequency(audiofx_eq_obj_t *self, mp_float_t arg);
+
+mp_float_t common_hal_audiofx_eq_get_high_frequency(audiofx_eq_obj_t *self);
+void common_hal_audiofx_eq_set_high_frequency(audiofx_eq_obj_t *self, mp_float_t arg);
+
+mp_float_t common_hal_audiofx_eq_get_low(audiofx_eq_obj_t *self);
+void common_hal_audiofx_eq_set_low(audiofx_eq_obj_t *self, mp_float_t arg);
+
+mp_float_t common_hal_audiofx_eq_get_mid(audiofx_eq_obj_t *self);
+void common_hal_audiofx_eq_set_mid(audiofx_eq_obj_t *self, mp_float_t arg);
+
+mp_float_t common_hal_audiofx_eq_get_high(audiofx_eq_obj_t *self);
+void common_hal_audiofx_eq_set_high(audiofx_eq_obj_t *self, mp_float_t arg);
@@ -0,0 +1,227 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared/runtime/context_manager_helpers.h"
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-bindings/audiofx/Reverb.h"
+#include "shared-bindings/util.h"
+#include "shared-module/audiofx/Reverb.h"
+
+//| class Reverb:
+//|     """A room reverberation effect
+//|
+//|     A Schroeder reverberator of four parallel feedback comb filters followed by
+//|     two allpass filters, tuned after Jezar's Freeverb. The reverberation is
+//|     mono and mixed equally into each channel of the source. Its delay lines
+//|     need about 12kB at 44.1kHz, and proportionally less at lower sample
+//|     rates."""
+//|
+//|     def __init__(
+//|         self,
+//|         source: circuitpython_typing.AudioSample,
+//|         *,
+//|         room_size: float = 0.5,
+//|         damping: float = 0.5,
+//|         mix: float = 0.3,
+//|     ) -> None:
+//|         """Create an effect that processes ``source``
+//|
+//|         The output has the sample rate and channel count of the source, and is always
+//|         16 bit signed. The source may be any audio sample, including another effect,
+//|         a `synthio.Synthesizer`, or an `audiomixer.Mixer`. When the source ends, the
+//|         output continues until the effect has died away.
+//|
+//|         :param ~circuitpython_typing.AudioSample source: The audio to process
+//|         :param float room_size: How long the reverberation takes to die away, from 0 to 1
+//|         :param float damping: How quickly high frequencies die away compared to low ones, from 0 to 1
+//|         :param float mix: The balance of the output, from 0 (only the source) to 1 (only the reverberation)
+//|         """
+STATIC mp_obj_t audiofx_reverb_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_source, ARG_room_size, ARG_damping, ARG_mix };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_room_size, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_damping, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_mix, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t room_size = audiofx_arg_float(args[ARG_room_size].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_room_size);
+    mp_float_t damping = audiofx_arg_float(args[ARG_damping].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_damping);
+    mp_float_t mix = audiofx_arg_float(args[ARG_mix].u_obj, MICROPY_FLOAT_CONST(0.3), 0, 1, MP_QSTR_mix);
+
+    audiofx_reverb_obj_t *self = m_new_obj(audiofx_reverb_obj_t);
+    self->base.base.type = &audiofx_reverb_type;
+    common_hal_audiofx_reverb_construct(self, args[ARG_source].u_obj, room_size, damping, mix);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Reverb and releases all memory resources for reuse."""
+//|         ...
+STATIC mp_obj_t audiofx_reverb_deinit(mp_obj_t self_in) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofx_reverb_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_deinit_obj, audiofx_reverb_deinit);
+
+STATIC void check_for_deinit(audiofx_reverb_obj_t *self) {
+    if (common_hal_audiofx_reverb_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> Reverb:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audiofx_reverb_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiofx_reverb_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofx_reverb___exit___obj, 4, 4, audiofx_reverb_obj___exit__);
+
+//|     source: circuitpython_typing.AudioSample
+//|     """The audio being processed (read-only)"""
+STATIC mp_obj_t audiofx_reverb_obj_get_source(mp_obj_t self_in) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return self->base.source;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_get_source_obj, audiofx_reverb_obj_get_source);
+
+MP_PROPERTY_GETTER(audiofx_reverb_source_obj,
+    (mp_obj_t)&audiofx_reverb_get_source_obj);
+
+//|     room_size: float
+//|     """How long the reverberation takes to die away, from 0 to 1"""
+STATIC mp_obj_t audiofx_reverb_obj_get_room_size(mp_obj_t self_in) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_reverb_get_room_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_get_room_size_obj, audiofx_reverb_obj_get_room_size);
+
+STATIC mp_obj_t audiofx_reverb_obj_set_room_size(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_reverb_set_room_size(self, mp_arg_validate_obj_float_range(arg, 0, 1, MP_QSTR_room_size));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_reverb_set_room_size_obj, audiofx_reverb_obj_set_room_size);
+
+MP_PROPERTY_GETSET(audiofx_reverb_room_size_obj,
+    (mp_obj_t)&audiofx_reverb_get_room_size_obj,
+    (mp_obj_t)&audiofx_reverb_set_room_size_obj);
+
+//|     damping: float
+//|     """How quickly high frequencies die away compared to low ones, from 0 to 1"""
+STATIC mp_obj_t audiofx_reverb_obj_get_damping(mp_obj_t self_in) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_reverb_get_damping(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_get_damping_obj, audiofx_reverb_obj_get_damping);
+
+STATIC mp_obj_t audiofx_reverb_obj_set_damping(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_reverb_set_damping(self, mp_arg_validate_obj_float_range(arg, 0, 1, MP_QSTR_damping));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_reverb_set_damping_obj, audiofx_reverb_obj_set_damping);
+
+MP_PROPERTY_GETSET(audiofx_reverb_damping_obj,
+    (mp_obj_t)&audiofx_reverb_get_damping_obj,
+    (mp_obj_t)&audiofx_reverb_set_damping_obj);
+
+//|     mix: float
+//|     """The balance of the output, from 0 (only the source) to 1 (only the reverberation)"""
+//|
+STATIC mp_obj_t audiofx_reverb_obj_get_mix(mp_obj_t self_in) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiofx_reverb_get_mix(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_get_mix_obj, audiofx_reverb_obj_get_mix);
+
+STATIC mp_obj_t audiofx_reverb_obj_set_mix(mp_obj_t self_in, mp_obj_t arg) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiofx_reverb_set_mix(self, mp_arg_validate_obj_float_range(arg, 0, 1, MP_QSTR_mix));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_reverb_set_mix_obj, audiofx_reverb_obj_set_mix);
+
+MP_PROPERTY_GETSET(audiofx_reverb_mix_obj,
+    (mp_obj_t)&audiofx_reverb_get_mix_obj,
+    (mp_obj_t)&audiofx_reverb_set_mix_obj);
+
+STATIC const mp_rom_map_elem_t audiofx_reverb_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofx_reverb_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofx_reverb___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_source), MP_ROM_PTR(&audiofx_reverb_source_obj) },
+    { MP_ROM_QSTR(MP_QSTR_room_size), MP_ROM_PTR(&audiofx_reverb_room_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_damping), MP_ROM_PTR(&audiofx_reverb_damping_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audiofx_reverb_mix_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofx_reverb_locals_dict, audiofx_reverb_locals_dict_table);
+
+STATIC const audiosample_p_t audiofx_reverb_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)audiofx_base_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)audiofx_base_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)audiofx_base_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofx_reverb_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofx_reverb_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofx_base_get_buffer_structure,
+};
+
+const mp_obj_type_t audiofx_reverb_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Reverb,
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .make_new = audiofx_reverb_make_new,
+    .locals_dict = (mp_obj_dict_t *)&audiofx_reverb_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .protocol = &audiofx_reverb_proto,
+        ),
+};
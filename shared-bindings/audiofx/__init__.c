@@ -0,0 +1,78 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-bindings/audiofx/Compressor.h"
+#include "shared-bindings/audiofx/Delay.h"
+#include "shared-bindings/audiofx/EQ.h"
+#include "shared-bindings/audiofx/Reverb.h"
+
+//| """Audio effects
+//|
+//| Each effect wraps another audio sample and is an audio sample itself, so
+//| effects can be chained, and the last one played like any other sample::
+//|
+//|   import audiocore
+//|   import audiofx
+//|   import audiopwmio
+//|   import board
+//|
+//|   wave = audiocore.WaveFile(open("guitar.wav", "rb"))
+//|   echo = audiofx.Delay(wave, delay=0.3, feedback=0.4)
+//|   room = audiofx.Reverb(echo, room_size=0.8)
+//|   audio = audiopwmio.PWMAudioOut(board.A0)
+//|   audio.play(room)
+//|
+//| All processing is in fixed point on whole buffers of 256 frames, and the
+//| settings can be changed while the effect plays."""
+//|
+
+mp_float_t audiofx_arg_float(mp_obj_t arg, mp_float_t default_for_null, mp_int_t min, mp_int_t max, qstr arg_name) {
+    if (arg == MP_OBJ_NULL) {
+        return default_for_null;
+    }
+    return mp_arg_validate_obj_float_range(arg, min, max, arg_name);
+}
+
+STATIC const mp_rom_map_elem_t audiofx_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiofx) },
+    { MP_ROM_QSTR(MP_QSTR_Compressor), MP_ROM_PTR(&audiofx_compressor_type) },
+    { MP_ROM_QSTR(MP_QSTR_Delay), MP_ROM_PTR(&audiofx_delay_type) },
+    { MP_ROM_QSTR(MP_QSTR_EQ), MP_ROM_PTR(&audiofx_eq_type) },
+    { MP_ROM_QSTR(MP_QSTR_Reverb), MP_ROM_PTR(&audiofx_reverb_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(audiofx_module_globals, audiofx_module_globals_table);
+
+const mp_obj_module_t audiofx_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&audiofx_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_audiofx, audiofx_module, CIRCUITPY_AUDIOFX);
@@ -48,15 +48,15 @@
 //|         samples_signed: bool = True,
 //|         sample_rate: int = 8000,
 //|     ) -> None:
-//|         """Create a Mixer object that can mix multiple channels with the same sample rate.
+//|         """Create a Mixer object that can mix multiple channels together.
 //|         Samples are accessed and controlled with the mixer's `audiomixer.MixerVoice` objects.
 //|
 //|         :param int voice_count: The maximum number of voices to mix
 //|         :param int buffer_size: The total size in bytes of the buffers to mix into
-//|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
-//|         :param int bits_per_sample: The bits per sample of the samples being played
+//|         :param int channel_count: The number of channels of the mixed output. 1 = mono; 2 = stereo.
+//|         :param int bits_per_sample: The bits per sample of the mixed output
 //|         :param bool samples_signed: Samples are signed (True) or unsigned (False)
-//|         :param int sample_rate: The sample rate to be used for all samples
+//|         :param int sample_rate: The sample rate of the mixed output
 //|
 //|         Playing a wave file from flash::
 //|
@@ -197,7 +197,9 @@ MP_PROPERTY_GETTER(audiomixer_mixer_voice_obj,
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
-//|         The sample must match the Mixer's encoding settings given in the constructor."""
+//|         Samples with a different sample rate, channel count, bits per sample or signedness
+//|         than the Mixer's are converted as they are played. Samples with more than two
+//|         channels are not supported. Matching samples are mixed fastest."""
 //|         ...
 STATIC mp_obj_t audiomixer_mixer_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_sample, ARG_voice, ARG_loop };
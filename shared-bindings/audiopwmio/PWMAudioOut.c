@@ -244,7 +244,6 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_resume_obj, audiopwmio_pwmaudio
 
 //|     paused: bool
 //|     """True when playback is paused. (read-only)"""
-//|
 STATIC mp_obj_t audiopwmio_pwmaudioout_obj_get_paused(mp_obj_t self_in) {
     audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -255,6 +254,59 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_paused_obj, audiopwmio_pwma
 MP_PROPERTY_GETTER(audiopwmio_pwmaudioout_paused_obj,
     (mp_obj_t)&audiopwmio_pwmaudioout_get_paused_obj);
 
+#if CIRCUITPY_AUDIO_BUFFER_RING
+//|     buffer_count: int
+//|     """The number of buffers filled ahead of the output, from 2 to 8. More buffers let
+//|     playback carry on through longer pauses, such as garbage collections and display
+//|     refreshes, at the cost of memory and latency. Takes effect the next time `play` is called."""
+STATIC mp_obj_t audiopwmio_pwmaudioout_obj_get_buffer_count(mp_obj_t self_in) {
+    audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiopwmio_pwmaudioout_get_buffer_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_buffer_count_obj, audiopwmio_pwmaudioout_obj_get_buffer_count);
+
+STATIC mp_obj_t audiopwmio_pwmaudioout_obj_set_buffer_count(mp_obj_t self_in, mp_obj_t buffer_count) {
+    audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiopwmio_pwmaudioout_set_buffer_count(self,
+        mp_arg_validate_int_range(mp_obj_get_int(buffer_count), 2, 8, MP_QSTR_buffer_count));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiopwmio_pwmaudioout_set_buffer_count_obj, audiopwmio_pwmaudioout_obj_set_buffer_count);
+
+MP_PROPERTY_GETSET(audiopwmio_pwmaudioout_buffer_count_obj,
+    (mp_obj_t)&audiopwmio_pwmaudioout_get_buffer_count_obj,
+    (mp_obj_t)&audiopwmio_pwmaudioout_set_buffer_count_obj);
+
+//|     underruns: int
+//|     """The number of times since `play` was called that the next buffer wasn't ready in time,
+//|     so the previous one was played again. (read-only)"""
+STATIC mp_obj_t audiopwmio_pwmaudioout_obj_get_underruns(mp_obj_t self_in) {
+    audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiopwmio_pwmaudioout_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_underruns_obj, audiopwmio_pwmaudioout_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audiopwmio_pwmaudioout_underruns_obj,
+    (mp_obj_t)&audiopwmio_pwmaudioout_get_underruns_obj);
+
+//|     late_fills: int
+//|     """The number of times since `play` was called that a buffer was filled with no other
+//|     buffer queued behind the one playing, one buffer away from an underrun. (read-only)"""
+//|
+STATIC mp_obj_t audiopwmio_pwmaudioout_obj_get_late_fills(mp_obj_t self_in) {
+    audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiopwmio_pwmaudioout_get_late_fills(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_late_fills_obj, audiopwmio_pwmaudioout_obj_get_late_fills);
+
+MP_PROPERTY_GETTER(audiopwmio_pwmaudioout_late_fills_obj,
+    (mp_obj_t)&audiopwmio_pwmaudioout_get_late_fills_obj);
+#endif // CIRCUITPY_AUDIO_BUFFER_RING
+
 STATIC const mp_rom_map_elem_t audiopwmio_pwmaudioout_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiopwmio_pwmaudioout_deinit_obj) },
@@ -269,6 +321,11 @@ STATIC const mp_rom_map_elem_t audiopwmio_pwmaudioout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiopwmio_pwmaudioout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audiopwmio_pwmaudioout_paused_obj) },
+    #if CIRCUITPY_AUDIO_BUFFER_RING
+    { MP_ROM_QSTR(MP_QSTR_buffer_count), MP_ROM_PTR(&audiopwmio_pwmaudioout_buffer_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audiopwmio_pwmaudioout_underruns_obj) },
+    { MP_ROM_QSTR(MP_QSTR_late_fills), MP_ROM_PTR(&audiopwmio_pwmaudioout_late_fills_obj) },
+    #endif
 };
 STATIC MP_DEFINE_CONST_DICT(audiopwmio_pwmaudioout_locals_dict, audiopwmio_pwmaudioout_locals_dict_table);
 
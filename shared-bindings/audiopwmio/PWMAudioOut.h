@@ -46,4 +46,11 @@ void common_hal_audiopwmio_pwmaudioout_pause(audiopwmio_pwmaudioout_obj_t *self)
 void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t *self);
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t *self);
 
+#if CIRCUITPY_AUDIO_BUFFER_RING
+void common_hal_audiopwmio_pwmaudioout_set_buffer_count(audiopwmio_pwmaudioout_obj_t *self, uint8_t buffer_count);
+uint8_t common_hal_audiopwmio_pwmaudioout_get_buffer_count(audiopwmio_pwmaudioout_obj_t *self);
+uint32_t common_hal_audiopwmio_pwmaudioout_get_underruns(audiopwmio_pwmaudioout_obj_t *self);
+uint32_t common_hal_audiopwmio_pwmaudioout_get_late_fills(audiopwmio_pwmaudioout_obj_t *self);
+#endif
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOPWMIO_AUDIOOUT_H
@@ -0,0 +1,129 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/benchmark/__init__.h"
+#include "shared-bindings/benchmark/Timer.h"
+
+//| class Timer:
+//|     """Measures the cycles spent between `start()` and `stop()`.
+//|
+//|     Wraps of the 32-bit counter are corrected using the millisecond tick, so
+//|     a `Timer` can measure intervals of any length."""
+//|
+//|     def __init__(self) -> None:
+//|         """Create a stopped timer which reads zero."""
+//|         ...
+STATIC mp_obj_t benchmark_timer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    benchmark_timer_obj_t *self = m_new_obj(benchmark_timer_obj_t);
+    self->base.type = &benchmark_timer_type;
+    common_hal_benchmark_timer_construct(self);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def start(self) -> None:
+//|         """Reset the timer and start counting."""
+//|         ...
+STATIC mp_obj_t benchmark_timer_start(mp_obj_t self_in) {
+    benchmark_timer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_benchmark_timer_start(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(benchmark_timer_start_obj, benchmark_timer_start);
+
+//|     def stop(self) -> int:
+//|         """Stop counting and return the elapsed `cycles`. Does nothing more if
+//|         the timer is already stopped."""
+//|         ...
+STATIC mp_obj_t benchmark_timer_stop(mp_obj_t self_in) {
+    benchmark_timer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_ull(common_hal_benchmark_timer_stop(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(benchmark_timer_stop_obj, benchmark_timer_stop);
+
+//|     def __enter__(self) -> Timer:
+//|         """Starts the timer when entering a ``with`` block."""
+//|         ...
+STATIC mp_obj_t benchmark_timer___enter__(mp_obj_t self_in) {
+    benchmark_timer_start(self_in);
+    return self_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(benchmark_timer___enter___obj, benchmark_timer___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Stops the timer when leaving a ``with`` block. See :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t benchmark_timer___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_benchmark_timer_stop(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(benchmark_timer___exit___obj, 4, 4, benchmark_timer___exit__);
+
+//|     cycles: int
+//|     """The cycles counted so far, or in total once stopped. (read-only)"""
+STATIC mp_obj_t benchmark_timer_get_cycles(mp_obj_t self_in) {
+    benchmark_timer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_ull(common_hal_benchmark_timer_get_cycles(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(benchmark_timer_get_cycles_obj, benchmark_timer_get_cycles);
+
+MP_PROPERTY_GETTER(benchmark_timer_cycles_obj,
+    (mp_obj_t)&benchmark_timer_get_cycles_obj);
+
+//|     seconds: float
+//|     """`cycles` divided by `cycles_per_second()`. (read-only)"""
+//|
+STATIC mp_obj_t benchmark_timer_get_seconds(mp_obj_t self_in) {
+    benchmark_timer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_float_t cycles = (mp_float_t)common_hal_benchmark_timer_get_cycles(self);
+    return mp_obj_new_float(cycles / common_hal_benchmark_cycles_per_second());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(benchmark_timer_get_seconds_obj, benchmark_timer_get_seconds);
+
+MP_PROPERTY_GETTER(benchmark_timer_seconds_obj,
+    (mp_obj_t)&benchmark_timer_get_seconds_obj);
+
+STATIC const mp_rom_map_elem_t benchmark_timer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&benchmark_timer_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&benchmark_timer_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&benchmark_timer___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&benchmark_timer___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_cycles), MP_ROM_PTR(&benchmark_timer_cycles_obj) },
+    { MP_ROM_QSTR(MP_QSTR_seconds), MP_ROM_PTR(&benchmark_timer_seconds_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(benchmark_timer_locals_dict, benchmark_timer_locals_dict_table);
+
+const mp_obj_type_t benchmark_timer_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Timer,
+    .make_new = benchmark_timer_make_new,
+    .locals_dict = (mp_obj_dict_t *)&benchmark_timer_locals_dict,
+};
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/benchmark/__init__.h"
+#include "shared-bindings/benchmark/Timer.h"
+
+//| """Cycle-accurate timing for benchmarks
+//|
+//| The `benchmark` module reads the free running counter the firmware uses
+//| for its own tracing. On ARMv7-M and Xtensa cores this counts CPU cycles.
+//| The RP2040 has no cycle counter, so its 1MHz system timer is used instead,
+//| and other ports fall back to the 32768Hz tick. Always divide by
+//| `cycles_per_second()` rather than assuming the CPU frequency.
+//|
+//| Use a `Timer` to measure a block of code without worrying about the
+//| counter wrapping::
+//|
+//|     import benchmark
+//|
+//|     with benchmark.Timer() as timer:
+//|         do_work()
+//|     print(timer.cycles, timer.seconds)
+//| """
+//|
+
+//| def cycles() -> int:
+//|     """Return the raw 32-bit counter. It wraps around, so subtract two readings
+//|     modulo ``2**32`` and keep intervals much shorter than a wrap."""
+//|     ...
+//|
+STATIC mp_obj_t benchmark_cycles(void) {
+    return mp_obj_new_int_from_uint(common_hal_benchmark_cycles());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(benchmark_cycles_obj, benchmark_cycles);
+
+//| def cycles_per_second() -> int:
+//|     """Return the rate at which `cycles()` counts, in Hz."""
+//|     ...
+//|
+STATIC mp_obj_t benchmark_cycles_per_second(void) {
+    return mp_obj_new_int_from_uint(common_hal_benchmark_cycles_per_second());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(benchmark_cycles_per_second_obj, benchmark_cycles_per_second);
+
+STATIC const mp_rom_map_elem_t benchmark_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_benchmark) },
+    { MP_ROM_QSTR(MP_QSTR_cycles), MP_ROM_PTR(&benchmark_cycles_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cycles_per_second), MP_ROM_PTR(&benchmark_cycles_per_second_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Timer), MP_ROM_PTR(&benchmark_timer_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(benchmark_module_globals, benchmark_module_globals_table);
+
+const mp_obj_module_t benchmark_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&benchmark_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_benchmark, benchmark_module, CIRCUITPY_BENCHMARK);
@@ -140,7 +140,8 @@ STATIC void validate_clip_region(displayio_bitmap_t *bitmap, mp_obj_t clip0_tupl
 //|     source_clip1: Tuple[int, int],
 //|     angle: float,
 //|     scale: float,
-//|     skip_index: int
+//|     skip_index: int,
+//|     bilinear: bool = False
 //| ) -> None:
 //|     """Inserts the source bitmap region into the destination bitmap with rotation
 //|     (angle), scale and clipping (both on source and destination bitmaps).
@@ -172,14 +173,17 @@ STATIC void validate_clip_region(displayio_bitmap_t *bitmap, mp_obj_t clip0_tupl
 //|     :param float scale: Scaling factor. Defaults to None which gets treated as 1.0 or same
 //|            as original source size.
 //|     :param int skip_index: Bitmap palette index in the source that will not be copied,
-//|            set to None to copy all pixels"""
+//|            set to None to copy all pixels
+//|     :param bool bilinear: Blend the four nearest source pixels for smoother scaling.
+//|            Only used when both bitmaps have 16 bits per value, which are taken as RGB565
+//|            colors."""
 //|     ...
 //|
 STATIC mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum {ARG_dest_bitmap, ARG_source_bitmap,
           ARG_ox, ARG_oy, ARG_dest_clip0, ARG_dest_clip1,
           ARG_px, ARG_py, ARG_source_clip0, ARG_source_clip1,
-          ARG_angle, ARG_scale, ARG_skip_index};
+          ARG_angle, ARG_scale, ARG_skip_index, ARG_bilinear};
 
     static const mp_arg_t allowed_args[] = {
         {MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL}},
@@ -198,6 +202,7 @@ STATIC mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         {MP_QSTR_angle, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to 0.0
         {MP_QSTR_scale, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to 1.0
         {MP_QSTR_skip_index, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        {MP_QSTR_bilinear, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -267,7 +272,7 @@ STATIC mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         source_clip1_x, source_clip1_y,
         angle,
         scale,
-        skip_index, skip_index_none);
+        skip_index, skip_index_none, args[ARG_bilinear].u_bool);
 
     return mp_const_none;
 }
@@ -358,6 +363,119 @@ STATIC mp_obj_t bitmaptools_alphablend(size_t n_args, const mp_obj_t *pos_args,
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_alphablend_obj, 0, bitmaptools_alphablend);
 
+//| def blit(
+//|     dest_bitmap: displayio.Bitmap,
+//|     source_bitmap: displayio.Bitmap,
+//|     x: int,
+//|     y: int,
+//|     *,
+//|     x1: int = 0,
+//|     y1: int = 0,
+//|     x2: int | None = None,
+//|     y2: int | None = None,
+//|     skip_source_index: int | None = None,
+//|     skip_dest_index: int | None = None,
+//|     source_palette: displayio.Palette | None = None,
+//| ) -> None:
+//|     """Inserts the source_bitmap region defined by rectangular boundaries
+//|     (x1,y1) and (x2,y2) into the dest_bitmap at the specified (x,y) location.
+//|
+//|     Rows are copied whole when no index is skipped and both bitmaps have the
+//|     same ``bits_per_value``, so this is the fastest way to move sprites and tiles.
+//|
+//|     :param bitmap dest_bitmap: Destination bitmap that the area will be copied into
+//|     :param bitmap source_bitmap: Source bitmap that contains the graphical region to be copied
+//|     :param int x: Horizontal pixel location in dest_bitmap where source_bitmap upper-left
+//|                   corner will be placed
+//|     :param int y: Vertical pixel location in dest_bitmap where source_bitmap upper-left
+//|                   corner will be placed
+//|     :param int x1: Minimum x-value for rectangular bounding box to be copied from the source bitmap
+//|     :param int y1: Minimum y-value for rectangular bounding box to be copied from the source bitmap
+//|     :param int x2: Maximum x-value (exclusive) for rectangular bounding box to be copied from the source bitmap
+//|     :param int y2: Maximum y-value (exclusive) for rectangular bounding box to be copied from the source bitmap
+//|     :param int skip_source_index: bitmap palette index in the source that will not be copied,
+//|                                   set to None to copy all pixels
+//|     :param int skip_dest_index: bitmap palette index in the destination bitmap that will not get overwritten
+//|                                 by the pixels from the source
+//|     :param Palette source_palette: source pixels whose index (below 256) is transparent in this palette
+//|                                    will not be copied"""
+//|     ...
+//|
+STATIC mp_obj_t bitmaptools_obj_blit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum {ARG_destination, ARG_source, ARG_x, ARG_y, ARG_x1, ARG_y1, ARG_x2, ARG_y2, ARG_skip_source_index, ARG_skip_dest_index, ARG_source_palette};
+    static const mp_arg_t allowed_args[] = {
+        {MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        {MP_QSTR_source_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        {MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT, {.u_obj = MP_OBJ_NULL} },
+        {MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT, {.u_obj = MP_OBJ_NULL} },
+        {MP_QSTR_x1, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        {MP_QSTR_y1, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        {MP_QSTR_x2, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to source->width
+        {MP_QSTR_y2, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to source->height
+        {MP_QSTR_skip_source_index, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        {MP_QSTR_skip_dest_index, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        {MP_QSTR_source_palette, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *destination = mp_arg_validate_type(args[ARG_destination].u_obj, &displayio_bitmap_type, MP_QSTR_dest_bitmap);
+    displayio_bitmap_t *source = mp_arg_validate_type(args[ARG_source].u_obj, &displayio_bitmap_type, MP_QSTR_source_bitmap);
+
+    // Check x,y are within the destination bitmap boundary
+    int16_t x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, MAX(0, destination->width - 1), MP_QSTR_x);
+    int16_t y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, MAX(0, destination->height - 1), MP_QSTR_y);
+
+    // ensure that the destination bitmap has at least as many `bits_per_value` as the source
+    if (destination->bits_per_value < source->bits_per_value) {
+        mp_raise_ValueError(translate("source palette too large"));
+    }
+
+    // Check x1,y1,x2,y2 are within source bitmap boundary
+    int16_t x1 = mp_arg_validate_int_range(args[ARG_x1].u_int, 0, MAX(0, source->width - 1), MP_QSTR_x1);
+    int16_t y1 = mp_arg_validate_int_range(args[ARG_y1].u_int, 0, MAX(0, source->height - 1), MP_QSTR_y1);
+    int16_t x2, y2;
+    // if x2 or y2 is None, then set as the maximum size of the source bitmap
+    if (args[ARG_x2].u_obj == mp_const_none) {
+        x2 = source->width;
+    } else {
+        x2 = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_x2].u_obj), 0, source->width, MP_QSTR_x2);
+    }
+    if (args[ARG_y2].u_obj == mp_const_none) {
+        y2 = source->height;
+    } else {
+        y2 = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_y2].u_obj), 0, source->height, MP_QSTR_y2);
+    }
+
+    // Ensure x1 < x2 and y1 < y2
+    if (x1 > x2) {
+        int16_t temp = x2;
+        x2 = x1;
+        x1 = temp;
+    }
+    if (y1 > y2) {
+        int16_t temp = y2;
+        y2 = y1;
+        y1 = temp;
+    }
+
+    bool skip_source_index_none = args[ARG_skip_source_index].u_obj == mp_const_none;
+    uint32_t skip_source_index = skip_source_index_none ? 0 : mp_obj_get_int(args[ARG_skip_source_index].u_obj);
+    bool skip_dest_index_none = args[ARG_skip_dest_index].u_obj == mp_const_none;
+    uint32_t skip_dest_index = skip_dest_index_none ? 0 : mp_obj_get_int(args[ARG_skip_dest_index].u_obj);
+
+    displayio_palette_t *source_palette = NULL;
+    if (args[ARG_source_palette].u_obj != mp_const_none) {
+        source_palette = mp_arg_validate_type(args[ARG_source_palette].u_obj, &displayio_palette_type, MP_QSTR_source_palette);
+    }
+
+    common_hal_bitmaptools_blit(destination, source, x, y, x1, y1, x2, y2, source_palette,
+        skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_blit_obj, 0, bitmaptools_obj_blit);
+
 //| def fill_region(
 //|     dest_bitmap: displayio.Bitmap, x1: int, y1: int, x2: int, y2: int, value: int
 //| ) -> None:
@@ -954,6 +1072,7 @@ STATIC const mp_rom_map_elem_t bitmaptools_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&bitmaptools_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotozoom), MP_ROM_PTR(&bitmaptools_rotozoom_obj) },
     { MP_ROM_QSTR(MP_QSTR_arrayblit), MP_ROM_PTR(&bitmaptools_arrayblit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&bitmaptools_blit_obj) },
     { MP_ROM_QSTR(MP_QSTR_alphablend), MP_ROM_PTR(&bitmaptools_alphablend_obj) },
     { MP_ROM_QSTR(MP_QSTR_fill_region), MP_ROM_PTR(&bitmaptools_fill_region_obj) },
     { MP_ROM_QSTR(MP_QSTR_boundary_fill), MP_ROM_PTR(&bitmaptools_boundary_fill_obj) },
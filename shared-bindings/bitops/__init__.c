@@ -41,8 +41,11 @@
 //|     stream of bytes suitable for sending via a parallel conversion method.
 //|
 //|     The number of bytes in the input buffer must be a multiple of the width,
-//|     and the width can be any value from 2 to 8.  If the width is fewer than 8,
-//|     then the remaining (less significant) bits of the output are set to zero.
+//|     and the width can be any value from 2 to 8, 16 or 32.  If the width is fewer than 8,
+//|     then the remaining (more significant) bits of the output are set to zero.
+//|     A width of 16 or 32 makes each output unit 2 or 4 bytes long, little-endian,
+//|     with the bit from ``input[0]`` in the least significant bit. This suits
+//|     16- or 32-pin parallel output such as `rp2pio.StateMachine.background_write`.
 //|
 //|     Let ``stride = len(input)//width``.  Then the first byte is made out of the
 //|     most significant bits of ``[input[0], input[stride], input[2*stride], ...]``.
@@ -50,7 +53,11 @@
 //|     byte which is made of the first bits of ``input[1], input[1+stride,
 //|     input[2*stride], ...]``.
 //|
-//|     The required output buffer size is ``len(input) * 8  // width``.
+//|     The required output buffer size is ``len(input) * 8  // width``, or ``len(input)``
+//|     for widths of 16 and 32.
+//|
+//|     ``output`` may be a `memoryview` slice, for instance to fill one half of a
+//|     buffer that is being written in the background, and need not be aligned.
 //|
 //|     Returns the output buffer."""
 //|     ...
@@ -66,7 +73,10 @@ STATIC mp_obj_t bit_transpose(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    mp_int_t width = mp_arg_validate_int_range(args[ARG_width].u_int, 2, 8, MP_QSTR_width);
+    mp_int_t width = args[ARG_width].u_int;
+    if (width != 16 && width != 32) {
+        mp_arg_validate_int_range(width, 2, 8, MP_QSTR_width);
+    }
 
     mp_buffer_info_t input_bufinfo;
     mp_get_buffer_raise(args[ARG_input].u_obj, &input_bufinfo, MP_BUFFER_READ);
@@ -78,7 +88,7 @@ STATIC mp_obj_t bit_transpose(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     mp_buffer_info_t output_bufinfo;
     mp_get_buffer_raise(args[ARG_output].u_obj, &output_bufinfo, MP_BUFFER_WRITE);
     int avail = output_bufinfo.len;
-    int outlen = 8 * (inlen / width);
+    int outlen = width > 8 ? inlen : 8 * (inlen / width);
 
     mp_arg_validate_length_min(avail, outlen, MP_QSTR_output);
 
@@ -27,6 +27,8 @@
 // This file contains all of the Python API definitions for the
 // busio.I2C class.
 
+#include <string.h>
+
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/busio/I2C.h"
 #include "shared-bindings/util.h"
@@ -374,6 +376,85 @@ STATIC mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *p
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_then_readfrom_obj, 1, busio_i2c_writeto_then_readfrom);
 
+//|     def transact(
+//|         self,
+//|         transactions: Sequence[
+//|             Tuple[int, Optional[ReadableBuffer]]
+//|             | Tuple[int, Optional[ReadableBuffer], Optional[WriteableBuffer]]
+//|         ],
+//|     ) -> None:
+//|         """Run a batch of transactions, possibly with several devices, in one call. Each
+//|         transaction is ``(address, out_buffer)`` or ``(address, out_buffer, in_buffer)``.
+//|         ``out_buffer`` is written to the device at ``address`` and then, if given, ``in_buffer``
+//|         is filled from it after a repeated start, as in `writeto_then_readfrom`. Either buffer
+//|         may be ``None`` to only read or only write. Every buffer is used in full.
+//|
+//|         All of the transactions are checked before any of them run, and they then run back to
+//|         back without returning to Python. Polling several sensors this way costs one call
+//|         rather than one per register read.
+//|
+//|         The I2C object must be locked.
+//|
+//|         :param ~Sequence transactions: The transactions to run in order
+//|         :raises OSError: for the first transaction that fails. The ones after it do not run.
+//|         """
+//|         ...
+//|
+
+STATIC void busio_i2c_get_transaction(mp_obj_t transaction, mp_int_t *address,
+    mp_buffer_info_t *out_bufinfo, mp_buffer_info_t *in_bufinfo) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_get_array(transaction, &len, &items);
+    mp_arg_validate_length_range(len, 2, 3, MP_QSTR_transactions);
+
+    *address = mp_obj_get_int(items[0]);
+    memset(out_bufinfo, 0, sizeof(*out_bufinfo));
+    memset(in_bufinfo, 0, sizeof(*in_bufinfo));
+    if (items[1] != mp_const_none) {
+        mp_get_buffer_raise(items[1], out_bufinfo, MP_BUFFER_READ);
+    }
+    if (len == 3 && items[2] != mp_const_none) {
+        mp_get_buffer_raise(items[2], in_bufinfo, MP_BUFFER_WRITE);
+    }
+}
+
+STATIC mp_obj_t busio_i2c_transact(mp_obj_t self_in, mp_obj_t transactions_in) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    check_lock(self);
+
+    size_t count;
+    mp_obj_t *transactions;
+    mp_obj_get_array(transactions_in, &count, &transactions);
+
+    mp_int_t address;
+    mp_buffer_info_t out_bufinfo;
+    mp_buffer_info_t in_bufinfo;
+    // Check everything first so that a bad entry doesn't leave the batch half done.
+    for (size_t i = 0; i < count; i++) {
+        busio_i2c_get_transaction(transactions[i], &address, &out_bufinfo, &in_bufinfo);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        busio_i2c_get_transaction(transactions[i], &address, &out_bufinfo, &in_bufinfo);
+        uint8_t status;
+        if (in_bufinfo.len == 0) {
+            status = common_hal_busio_i2c_write(self, address, out_bufinfo.buf, out_bufinfo.len);
+        } else if (out_bufinfo.len == 0) {
+            status = common_hal_busio_i2c_read(self, address, in_bufinfo.buf, in_bufinfo.len);
+        } else {
+            status = common_hal_busio_i2c_write_read(self, address,
+                out_bufinfo.buf, out_bufinfo.len, in_bufinfo.buf, in_bufinfo.len);
+        }
+        if (status != 0) {
+            mp_raise_OSError(status);
+        }
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busio_i2c_transact_obj, busio_i2c_transact);
+
 STATIC const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&busio_i2c_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
@@ -386,6 +467,7 @@ STATIC const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readfrom_into), MP_ROM_PTR(&busio_i2c_readfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto), MP_ROM_PTR(&busio_i2c_writeto_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transact), MP_ROM_PTR(&busio_i2c_transact_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(busio_i2c_locals_dict, busio_i2c_locals_dict_table);
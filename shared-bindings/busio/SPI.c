@@ -39,6 +39,7 @@
 #include "py/mperrno.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "supervisor/shared/translate/translate.h"
 
 
@@ -122,8 +123,23 @@ STATIC mp_obj_t busio_spi_make_new(const mp_obj_type_t *type, size_t n_args, siz
 //|     def deinit(self) -> None:
 //|         """Turn off the SPI bus."""
 //|         ...
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+void busio_spi_finish_background_write(busio_spi_obj_t *self) {
+    common_hal_busio_spi_finish_write(self);
+    // Any SPIWrite for this bus is now done.
+    self->background_write_buffer = MP_OBJ_NULL;
+}
+#endif
+
+STATIC void finish_background_write(busio_spi_obj_t *self) {
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+    busio_spi_finish_background_write(self);
+    #endif
+}
+
 STATIC mp_obj_t busio_spi_obj_deinit(mp_obj_t self_in) {
     busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    finish_background_write(self);
     common_hal_busio_spi_deinit(self);
     return mp_const_none;
 }
@@ -140,6 +156,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_deinit_obj, busio_spi_obj_deinit);
 //|         ...
 STATIC mp_obj_t busio_spi_obj___exit__(size_t n_args, const mp_obj_t *args) {
     (void)n_args;
+    finish_background_write(MP_OBJ_TO_PTR(args[0]));
     common_hal_busio_spi_deinit(MP_OBJ_TO_PTR(args[0]));
     return mp_const_none;
 }
@@ -194,6 +211,7 @@ STATIC mp_obj_t busio_spi_configure(size_t n_args, const mp_obj_t *pos_args, mp_
     busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     check_for_deinit(self);
     check_lock(self);
+    finish_background_write(self);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
@@ -229,6 +247,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_try_lock_obj, busio_spi_obj_try_lock);
 STATIC mp_obj_t busio_spi_obj_unlock(mp_obj_t self_in) {
     busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
+    finish_background_write(self);
     common_hal_busio_spi_unlock(self);
     return mp_const_none;
 }
@@ -259,6 +278,7 @@ STATIC mp_obj_t busio_spi_write(size_t n_args, const mp_obj_t *pos_args, mp_map_
     busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     check_for_deinit(self);
     check_lock(self);
+    finish_background_write(self);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
@@ -286,6 +306,80 @@ STATIC mp_obj_t busio_spi_write(size_t n_args, const mp_obj_t *pos_args, mp_map_
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_obj, 1, busio_spi_write);
 
+//|     import sys
+//|     def write_async(
+//|         self, buffer: ReadableBuffer, *, start: int = 0, end: int = sys.maxsize
+//|     ) -> SPIWrite:
+//|         """Start writing the data contained in ``buffer`` and return without waiting for it
+//|         to be sent, so that Python code can run while the bytes go out. The SPI object must be
+//|         locked. ``start`` and ``end`` slice ``buffer`` as in `write`.
+//|
+//|         The returned `SPIWrite` reports when the write is done. ``buffer`` must not be changed
+//|         until then. Any other use of the SPI object, including `unlock`, first waits for
+//|         the write to finish. When used with ``adafruit_bus_device.SPIDevice``, leaving the
+//|         ``with`` block waits for the write before deselecting the device.
+//|
+//|         Writes that can't be done in the background, because they are too short or the port
+//|         doesn't support it, are done before this returns.
+//|
+//|         :param ReadableBuffer buffer: write out bytes from this buffer
+//|         :param int start: beginning of buffer slice
+//|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``
+//|         """
+//|         ...
+
+STATIC mp_obj_t busio_spi_write_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    finish_background_write(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    // Compute bounds in terms of elements, not bytes.
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    int32_t start = args[ARG_start].u_int;
+    size_t length = bufinfo.len / stride_in_bytes;
+    normalize_buffer_bounds(&start, args[ARG_end].u_int, &length);
+
+    // Treat start and length in terms of bytes from now on.
+    start *= stride_in_bytes;
+    length *= stride_in_bytes;
+
+    busio_spi_write_obj_t *write = m_new_obj(busio_spi_write_obj_t);
+    write->base.type = &busio_spi_write_type;
+    write->spi = self;
+    write->done = true;
+
+    if (length == 0) {
+        return MP_OBJ_FROM_PTR(write);
+    }
+
+    const uint8_t *data = ((uint8_t *)bufinfo.buf) + start;
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+    if (common_hal_busio_spi_start_write(self, data, length)) {
+        // The bus holds the buffer until the write is finished because the handle may be dropped.
+        self->background_write_buffer = args[ARG_buffer].u_obj;
+        write->sequence = ++self->background_write_sequence;
+        write->done = false;
+        return MP_OBJ_FROM_PTR(write);
+    }
+    #endif
+    if (!common_hal_busio_spi_write(self, data, length)) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return MP_OBJ_FROM_PTR(write);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_async_obj, 1, busio_spi_write_async);
+
 
 //|     import sys
 //|     def readinto(
@@ -324,6 +418,7 @@ STATIC mp_obj_t busio_spi_readinto(size_t n_args, const mp_obj_t *pos_args, mp_m
     busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     check_for_deinit(self);
     check_lock(self);
+    finish_background_write(self);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
@@ -399,6 +494,7 @@ STATIC mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args
     busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     check_for_deinit(self);
     check_lock(self);
+    finish_background_write(self);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
@@ -470,6 +566,7 @@ STATIC const mp_rom_map_elem_t busio_spi_locals_dict_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_spi_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_spi_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_async), MP_ROM_PTR(&busio_spi_write_async_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&busio_spi_write_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&busio_spi_frequency_obj) }
     #endif // CIRCUITPY_BUSIO_SPI
@@ -483,6 +580,122 @@ const mp_obj_type_t busio_spi_type = {
     .locals_dict = (mp_obj_dict_t *)&busio_spi_locals_dict,
 };
 
+#if CIRCUITPY_BUSIO_SPI
+//| class SPIWrite:
+//|     """A write started by `SPI.write_async`. It can be polled with `done`, waited for with
+//|     `wait`, registered with ``select.poll`` (it becomes readable and writable when done),
+//|     or awaited in an ``asyncio`` task."""
+//|
+//|     def __init__(self) -> None:
+//|         """You cannot create an instance of `busio.SPIWrite`. Use `SPI.write_async`."""
+//|         ...
+
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+// True while this write is the bus's background write and hasn't been finished.
+STATIC bool busio_spi_write_in_progress(busio_spi_write_obj_t *self) {
+    return self->spi->background_write_buffer != MP_OBJ_NULL &&
+           self->spi->background_write_sequence == self->sequence;
+}
+#endif
+
+// Returns true once the write is done, releasing the bus's background write if it was.
+STATIC bool busio_spi_write_poll(busio_spi_write_obj_t *self) {
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+    if (!self->done) {
+        if (!busio_spi_write_in_progress(self)) {
+            // Finished by a later write or another use of the bus.
+            self->done = true;
+        } else if (common_hal_busio_spi_write_done(self->spi)) {
+            busio_spi_finish_background_write(self->spi);
+            self->done = true;
+        }
+    }
+    #endif
+    return self->done;
+}
+
+//|     def wait(self) -> None:
+//|         """Wait for the write to finish."""
+//|         ...
+STATIC mp_obj_t busio_spi_write_wait(mp_obj_t self_in) {
+    busio_spi_write_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+    if (!self->done && busio_spi_write_in_progress(self)) {
+        busio_spi_finish_background_write(self->spi);
+    }
+    #endif
+    self->done = true;
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_write_wait_obj, busio_spi_write_wait);
+
+//|     done: bool
+//|     """True once all of the data has been sent. (read-only)"""
+//|
+STATIC mp_obj_t busio_spi_write_get_done(mp_obj_t self_in) {
+    return mp_obj_new_bool(busio_spi_write_poll(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_write_get_done_obj, busio_spi_write_get_done);
+
+MP_PROPERTY_GETTER(busio_spi_write_done_obj,
+    (mp_obj_t)&busio_spi_write_get_done_obj);
+
+// `await write` iterates this until it stops.
+STATIC mp_obj_t busio_spi_write_iternext(mp_obj_t self_in) {
+    if (busio_spi_write_poll(MP_OBJ_TO_PTR(self_in))) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    // Have asyncio wake this task when its poller sees the write as readable, like a stream.
+    mp_obj_t asyncio = mp_import_name(MP_QSTR_asyncio, mp_const_none, MP_OBJ_NEW_SMALL_INT(0));
+    mp_obj_t io_queue = mp_load_attr(mp_load_attr(asyncio, MP_QSTR_core), MP_QSTR__io_queue);
+    mp_obj_t dest[3];
+    mp_load_method(io_queue, MP_QSTR_queue_read, dest);
+    dest[2] = self_in;
+    mp_call_method_n_kw(1, 0, dest);
+    return mp_const_none;
+}
+
+STATIC mp_obj_t busio_spi_write___await__(mp_obj_t self_in) {
+    return self_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_write___await___obj, busio_spi_write___await__);
+
+STATIC mp_uint_t busio_spi_write_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    if (request != MP_STREAM_POLL) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+    if (!busio_spi_write_poll(MP_OBJ_TO_PTR(self_in))) {
+        return 0;
+    }
+    return arg & (MP_STREAM_POLL_RD | MP_STREAM_POLL_WR);
+}
+
+STATIC const mp_rom_map_elem_t busio_spi_write_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&busio_spi_write_wait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_done), MP_ROM_PTR(&busio_spi_write_done_obj) },
+    { MP_ROM_QSTR(MP_QSTR___await__), MP_ROM_PTR(&busio_spi_write___await___obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(busio_spi_write_locals_dict, busio_spi_write_locals_dict_table);
+
+STATIC const mp_stream_p_t busio_spi_write_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .ioctl = busio_spi_write_ioctl,
+};
+
+const mp_obj_type_t busio_spi_write_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_SPIWrite,
+    .locals_dict = (mp_obj_dict_t *)&busio_spi_write_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .getiter = mp_identity_getiter,
+        .iternext = busio_spi_write_iternext,
+        .protocol = &busio_spi_write_stream_p,
+        ),
+};
+#endif // CIRCUITPY_BUSIO_SPI
+
 busio_spi_obj_t *validate_obj_is_spi_bus(mp_obj_t obj, qstr arg_name) {
     return mp_arg_validate_type(obj, &busio_spi_type, arg_name);
 }
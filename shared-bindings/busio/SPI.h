@@ -35,6 +35,17 @@
 // Type object used in Python. Should be shared between ports.
 extern const mp_obj_type_t busio_spi_type;
 
+// The handle returned by SPI.write_async().
+typedef struct {
+    mp_obj_base_t base;
+    busio_spi_obj_t *spi;
+    // The spi's background_write_sequence when this write started.
+    uint32_t sequence;
+    bool done;
+} busio_spi_write_obj_t;
+
+extern const mp_obj_type_t busio_spi_write_type;
+
 // Construct an underlying SPI object.
 extern void common_hal_busio_spi_construct(busio_spi_obj_t *self,
     const mcu_pin_obj_t *clock, const mcu_pin_obj_t *mosi,
@@ -58,6 +69,26 @@ extern bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size
 // Reads and write len bytes simultaneously.
 extern bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, const uint8_t *data_out, uint8_t *data_in, size_t len);
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+// Starts writing out the given data and returns before the write is done. data must stay valid
+// until common_hal_busio_spi_finish_write() returns. Returns false without sending anything if the
+// write can't be done in the background, in which case the caller should use
+// common_hal_busio_spi_write() instead.
+extern bool common_hal_busio_spi_start_write(busio_spi_obj_t *self, const uint8_t *data, size_t len);
+
+// Waits for the write started by common_hal_busio_spi_start_write() to complete.
+extern void common_hal_busio_spi_finish_write(busio_spi_obj_t *self);
+
+// Returns true if no write started by common_hal_busio_spi_start_write() is still sending. Doesn't
+// wait. common_hal_busio_spi_finish_write() must still be called to release the write.
+extern bool common_hal_busio_spi_write_done(busio_spi_obj_t *self);
+
+// Ports with background writes also keep `mp_obj_t background_write_buffer` and
+// `uint32_t background_write_sequence` in busio_spi_obj_t for SPI.write_async(). The buffer is
+// set and cleared by shared-bindings around the port's start_write and finish_write.
+void busio_spi_finish_background_write(busio_spi_obj_t *self);
+#endif
+
 // Return actual SPI bus frequency.
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t *self);
 
@@ -196,7 +196,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(canio_can_restart_obj, canio_can_restart);
 //|         Platform specific notes:
 //|
 //|         SAM E5x supports two Listeners.  Filter blocks are shared between the two
-//|         listeners.  There are 4 standard filter blocks and 4 extended filter blocks.
+//|         listeners.  There are 8 standard filter blocks and 8 extended filter blocks.
 //|         Each block can either match 2 single addresses or a mask of addresses.
 //|         The number of filter blocks can be increased, up to a hardware maximum, by
 //|         rebuilding CircuitPython, but this decreases the CircuitPython free
@@ -206,8 +206,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(canio_can_restart_obj, canio_can_restart);
 //|         There are 14 filter blocks.  Each block can match 2 standard addresses with
 //|         mask or 1 extended address with mask.
 //|
-//|         ESP32S2 supports one Listener.  There is a single filter block, which can either match a
-//|         standard address with mask or an extended address with mask.
+//|         ESP32S2 supports one Listener.  There is a single filter block.  With more
+//|         than one match it is set to accept the id bits all matches have in common,
+//|         and other messages are discarded before they reach `Listener.receive`.
 //|         """
 //|         ...
 STATIC mp_obj_t canio_can_listen(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -28,6 +28,8 @@
 #include "shared-bindings/canio/Message.h"
 #include "common-hal/canio/Listener.h"
 
+#include <string.h>
+
 #include "py/runtime.h"
 #include "py/objproperty.h"
 
@@ -40,7 +42,8 @@
 //|     In addition to using the `receive` method to retrieve a message or
 //|     the `in_waiting` method to check for an available message, a
 //|     listener can be used as an iterable, yielding messages until no
-//|     message arrives within ``self.timeout`` seconds."""
+//|     message arrives within ``self.timeout`` seconds. `readinto` stores
+//|     several messages in a buffer without allocating memory."""
 //|
 
 //|     def receive(self) -> Optional[Union[RemoteTransmissionRequest, Message]]:
@@ -53,16 +56,75 @@ STATIC mp_obj_t canio_listener_receive(mp_obj_t self_in) {
     canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
     common_hal_canio_listener_check_for_deinit(self);
 
-    mp_obj_t message = common_hal_canio_listener_receive(self);
+    canio_message_obj_t message;
     // note: receive fills out the type field of the message
-
-    if (message) {
-        return message;
+    if (!common_hal_canio_listener_receive_into(self, &message, true)) {
+        return mp_const_none;
     }
-    return mp_const_none;
+    canio_message_obj_t *result = m_new_obj(canio_message_obj_t);
+    *result = message;
+    return result;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(canio_listener_receive_obj, canio_listener_receive);
 
+#define CANIO_RECORD_SIZE (16)
+#define CANIO_RECORD_FLAG_EXTENDED (1 << 0)
+#define CANIO_RECORD_FLAG_RTR (1 << 1)
+
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Reads messages into ``buffer`` without allocating memory, after
+//|         waiting up to ``self.timeout`` seconds for the first one
+//|
+//|         Each message takes a 16 byte record, which can be unpacked with
+//|         ``struct.unpack_from("<IBBxx8s", buffer, 16 * i)``:
+//|
+//|         * bytes 0-3: the id, little endian
+//|         * byte 4: flags, bit 0 set for an extended id and bit 1 set for a
+//|           `RemoteTransmissionRequest`
+//|         * byte 5: the length of the data (or the requested length of a
+//|           `RemoteTransmissionRequest`)
+//|         * bytes 6-7: zero
+//|         * bytes 8-15: the data, padded with zeros
+//|
+//|         As many messages as are waiting and fit in ``buffer`` are stored.
+//|         Use this instead of `receive` on busy buses, so that the garbage
+//|         collector doesn't delay reading while the receive queue fills up.
+//|
+//|         :return: The number of messages stored, 0 if none arrived in time."""
+//|         ...
+STATIC mp_obj_t canio_listener_readinto(mp_obj_t self_in, mp_obj_t buffer_in) {
+    canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_canio_listener_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t max_messages = mp_arg_validate_length_min(bufinfo.len, CANIO_RECORD_SIZE, MP_QSTR_buffer) / CANIO_RECORD_SIZE;
+
+    uint8_t *record = bufinfo.buf;
+    size_t count = 0;
+    canio_message_obj_t message;
+    // Only wait for the first message.
+    while (count < max_messages && common_hal_canio_listener_receive_into(self, &message, count == 0)) {
+        uint32_t id = message.id;
+        record[0] = id;
+        record[1] = id >> 8;
+        record[2] = id >> 16;
+        record[3] = id >> 24;
+        record[4] = (message.extended ? CANIO_RECORD_FLAG_EXTENDED : 0) |
+            (message.base.type == &canio_remote_transmission_request_type ? CANIO_RECORD_FLAG_RTR : 0);
+        record[5] = message.size;
+        record[6] = record[7] = 0;
+        memset(record + 8, 0, 8);
+        if (message.base.type == &canio_message_type) {
+            memcpy(record + 8, message.data, message.size);
+        }
+        record += CANIO_RECORD_SIZE;
+        count++;
+    }
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(canio_listener_readinto_obj, canio_listener_readinto);
+
 //|     def in_waiting(self) -> int:
 //|         """Returns the number of messages (including remote
 //|         transmission requests) waiting"""
@@ -154,6 +216,21 @@ MP_PROPERTY_GETSET(canio_listener_timeout_obj,
     (mp_obj_t)&canio_listener_timeout_get_obj,
     (mp_obj_t)&canio_listener_timeout_set_obj);
 
+//|     overflow_count: int
+//|     """The number of messages that were lost because the receive queue was
+//|     full, since the listener was created. On STM32 this counts the times that
+//|     one or more messages were lost, as found when checking for messages. (read-only)"""
+//|
+STATIC mp_obj_t canio_listener_overflow_count_get(mp_obj_t self_in) {
+    canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_canio_listener_check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_canio_listener_get_overflow_count(self));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(canio_listener_overflow_count_get_obj, canio_listener_overflow_count_get);
+
+MP_PROPERTY_GETTER(canio_listener_overflow_count_obj,
+    (mp_obj_t)&canio_listener_overflow_count_get_obj);
+
 
 
 STATIC const mp_rom_map_elem_t canio_listener_locals_dict_table[] = {
@@ -161,6 +238,8 @@ STATIC const mp_rom_map_elem_t canio_listener_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&canio_listener_exit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&canio_listener_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&canio_listener_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overflow_count), MP_ROM_PTR(&canio_listener_overflow_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&canio_listener_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_receive), MP_ROM_PTR(&canio_listener_receive_obj) },
     { MP_ROM_QSTR(MP_QSTR_timeout), MP_ROM_PTR(&canio_listener_timeout_obj) },
 };
@@ -29,6 +29,7 @@
 #include "py/obj.h"
 #include "shared-bindings/canio/CAN.h"
 #include "shared-bindings/canio/Match.h"
+#include "shared-module/canio/Message.h"
 
 extern const mp_obj_type_t canio_listener_type;
 
@@ -37,7 +38,10 @@ typedef struct canio_listener_obj canio_listener_obj_t;
 void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_obj_t *can, size_t nmatch, canio_match_obj_t **matches, float timeout);
 void common_hal_canio_listener_check_for_deinit(canio_listener_obj_t *self);
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self);
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self);
+// Fill in message, including its type, without allocating. When wait is
+// true, wait up to the timeout for a message to arrive.
+bool common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_message_obj_t *message, bool wait);
 int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self);
 float common_hal_canio_listener_get_timeout(canio_listener_obj_t *self);
 void common_hal_canio_listener_set_timeout(canio_listener_obj_t *self, float timeout);
+uint32_t common_hal_canio_listener_get_overflow_count(canio_listener_obj_t *self);
@@ -79,7 +79,8 @@
 //|         auto_refresh: bool = True,
 //|         native_frames_per_second: int = 60,
 //|         backlight_on_high: bool = True,
-//|         SH1107_addressing: bool = False
+//|         SH1107_addressing: bool = False,
+//|         refresh_buffer_size: int = 0
 //|     ) -> None:
 //|         r"""Create a Display object on the given display bus (`FourWire`, `ParallelBus` or `I2CDisplay`).
 //|
@@ -137,6 +138,9 @@
 //|         :param bool SH1107_addressing: Special quirk for SH1107, use upper/lower column set and page set
 //|         :param int set_vertical_scroll: This parameter is accepted but ignored for backwards compatibility. It will be removed in a future release.
 //|         :param int backlight_pwm_frequency: The frequency to use to drive the PWM for backlight brightness control. Default is 50000.
+//|         :param int refresh_buffer_size: Number of bytes of pixel data to composite at once during a refresh.
+//|             Larger buffers split dirty areas into fewer pieces, which reduces command overhead. When 0, a
+//|             small buffer on the stack is used.
 //|         """
 //|         ...
 STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_args,
@@ -148,7 +152,7 @@ STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_a
            ARG_set_vertical_scroll, ARG_backlight_pin, ARG_brightness_command,
            ARG_brightness, ARG_single_byte_bounds, ARG_data_as_commands,
            ARG_auto_refresh, ARG_native_frames_per_second, ARG_backlight_on_high,
-           ARG_SH1107_addressing, ARG_backlight_pwm_frequency };
+           ARG_SH1107_addressing, ARG_backlight_pwm_frequency, ARG_refresh_buffer_size };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_init_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -176,7 +180,8 @@ STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_a
         { MP_QSTR_native_frames_per_second, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 60} },
         { MP_QSTR_backlight_on_high, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
         { MP_QSTR_SH1107_addressing, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
-        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} }
+        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} },
+        { MP_QSTR_refresh_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -202,6 +207,8 @@ STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_a
         mp_raise_ValueError_varg(translate("%q must be 1 when %q is True"), MP_QSTR_color_depth, MP_QSTR_SH1107_addressing);
     }
 
+    mp_int_t refresh_buffer_size = mp_arg_validate_int_min(args[ARG_refresh_buffer_size].u_int, 0, MP_QSTR_refresh_buffer_size);
+
     primary_display_t *disp = allocate_display_or_raise();
     displayio_display_obj_t *self = &disp->display;
 
@@ -229,6 +236,12 @@ STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_a
         args[ARG_backlight_pwm_frequency].u_int
         );
 
+    if (refresh_buffer_size > 0) {
+        // Two buffers let the next subrectangle be composited while one is sent in the background.
+        displayio_display_core_set_refresh_buffer_size(&self->core, refresh_buffer_size,
+            self->core.start_send != NULL || CIRCUITPY_DISPLAYIO_CORE1 ? 2 : 1);
+    }
+
     return self;
 }
 
@@ -270,8 +283,9 @@ MP_DEFINE_CONST_FUN_OBJ_2(displayio_display_show_obj, displayio_display_obj_show
 //|         self,
 //|         *,
 //|         target_frames_per_second: Optional[int] = None,
-//|         minimum_frames_per_second: int = 0
-//|     ) -> bool:
+//|         minimum_frames_per_second: int = 0,
+//|         blocking: bool = True
+//|     ) -> Union[bool, float]:
 //|         """When auto_refresh is off, and :py:attr:`target_frames_per_second` is not `None` this waits
 //|         for the target frame rate and then refreshes the display,
 //|         returning `True`. If the call has taken too long since the last refresh call for the given
@@ -290,13 +304,18 @@ MP_DEFINE_CONST_FUN_OBJ_2(displayio_display_show_obj, displayio_display_obj_show
 //|         :param Optional[int] target_frames_per_second: The target frame rate that :py:func:`refresh` should try to
 //|             achieve. Set to `None` for immediate refresh.
 //|         :param int minimum_frames_per_second: The minimum number of times the screen should be updated per second.
+//|         :param bool blocking: When `False`, only start the refresh and let it finish in the background
+//|             while other code runs. Instead of `True` or `False`, the fraction of the refresh that is
+//|             done, from 0.0 to 1.0, is returned. Calling again before it is done reports progress
+//|             without starting another refresh.
 //|         """
 //|         ...
 STATIC mp_obj_t displayio_display_obj_refresh(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_target_frames_per_second, ARG_minimum_frames_per_second };
+    enum { ARG_target_frames_per_second, ARG_minimum_frames_per_second, ARG_blocking };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_target_frames_per_second, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
         { MP_QSTR_minimum_frames_per_second, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_blocking, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -316,7 +335,12 @@ STATIC mp_obj_t displayio_display_obj_refresh(size_t n_args, const mp_obj_t *pos
         target_ms_per_frame = 1000 / mp_obj_get_int(args[ARG_target_frames_per_second].u_obj);
     }
 
-    return mp_obj_new_bool(common_hal_displayio_display_refresh(self, target_ms_per_frame, maximum_ms_per_real_frame));
+    bool blocking = args[ARG_blocking].u_bool;
+    bool refreshed = common_hal_displayio_display_refresh(self, target_ms_per_frame, maximum_ms_per_real_frame, blocking);
+    if (!blocking) {
+        return mp_obj_new_float(common_hal_displayio_display_get_refresh_progress(self));
+    }
+    return mp_obj_new_bool(refreshed);
 }
 
 MP_DEFINE_CONST_FUN_OBJ_KW(displayio_display_refresh_obj, 1, displayio_display_obj_refresh);
@@ -413,6 +437,18 @@ MP_PROPERTY_GETSET(displayio_display_rotation_obj,
     (mp_obj_t)&displayio_display_get_rotation_obj,
     (mp_obj_t)&displayio_display_set_rotation_obj);
 
+//|     last_refresh_duration: int
+//|     """The number of milliseconds the most recent refresh took, from the start of compositing
+//|     until the last pixel was sent. (read only)"""
+STATIC mp_obj_t displayio_display_obj_get_last_refresh_duration(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_display_get_last_refresh_duration(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_last_refresh_duration_obj, displayio_display_obj_get_last_refresh_duration);
+
+MP_PROPERTY_GETTER(displayio_display_last_refresh_duration_obj,
+    (mp_obj_t)&displayio_display_get_last_refresh_duration_obj);
+
 //|     bus: _DisplayBus
 //|     """The bus being used by the display"""
 STATIC mp_obj_t displayio_display_obj_get_bus(mp_obj_t self_in) {
@@ -523,6 +559,7 @@ STATIC const mp_rom_map_elem_t displayio_display_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_display_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_display_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotation), MP_ROM_PTR(&displayio_display_rotation_obj) },
+    { MP_ROM_QSTR(MP_QSTR_last_refresh_duration), MP_ROM_PTR(&displayio_display_last_refresh_duration_obj) },
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&displayio_display_bus_obj) },
     { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&displayio_display_root_group_obj) },
 };
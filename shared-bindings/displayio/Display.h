@@ -49,7 +49,8 @@ void common_hal_displayio_display_construct(displayio_display_obj_t *self,
 bool common_hal_displayio_display_show(displayio_display_obj_t *self,
     displayio_group_t *root_group);
 
-bool common_hal_displayio_display_refresh(displayio_display_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame);
+bool common_hal_displayio_display_refresh(displayio_display_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame, bool blocking);
+mp_float_t common_hal_displayio_display_get_refresh_progress(displayio_display_obj_t *self);
 
 bool common_hal_displayio_display_get_auto_refresh(displayio_display_obj_t *self);
 void common_hal_displayio_display_set_auto_refresh(displayio_display_obj_t *self, bool auto_refresh);
@@ -58,6 +59,7 @@ uint16_t common_hal_displayio_display_get_width(displayio_display_obj_t *self);
 uint16_t common_hal_displayio_display_get_height(displayio_display_obj_t *self);
 uint16_t common_hal_displayio_display_get_rotation(displayio_display_obj_t *self);
 void common_hal_displayio_display_set_rotation(displayio_display_obj_t *self, int rotation);
+uint32_t common_hal_displayio_display_get_last_refresh_duration(displayio_display_obj_t *self);
 
 bool common_hal_displayio_display_get_dither(displayio_display_obj_t *self);
 void common_hal_displayio_display_set_dither(displayio_display_obj_t *self, bool dither);
@@ -81,7 +81,12 @@
 //|         advanced_color_epaper: bool = False,
 //|         two_byte_sequence_length: bool = False,
 //|         start_up_time: float = 0,
-//|         address_little_endian: bool = False
+//|         address_little_endian: bool = False,
+//|         refresh_buffer_size: int = 0,
+//|         partial_refresh_sequence: Optional[ReadableBuffer] = None,
+//|         partial_refresh_time: float = 1,
+//|         partial_seconds_per_frame: float = 1,
+//|         max_partial_refreshes: int = 10
 //|     ) -> None:
 //|         """Create a EPaperDisplay object on the given display bus (`displayio.FourWire` or `paralleldisplay.ParallelBus`).
 //|
@@ -124,6 +129,14 @@
 //|         :param bool two_byte_sequence_length: When true, use two bytes to define sequence length
 //|         :param float start_up_time: Time to wait after reset before sending commands
 //|         :param bool address_little_endian: Send the least significant byte (not bit) of multi-byte addresses first. Ignored when ram is addressed with one byte
+//|         :param int refresh_buffer_size: Number of bytes of pixel data to composite at once during a refresh. When 0, a small buffer on the stack is used.
+//|         :param ~circuitpython_typing.ReadableBuffer partial_refresh_sequence: Byte-packed command sequence
+//|           run instead of ``refresh_display_command`` to update only the changed areas, for controllers
+//|           with a partial update mode (such as a fast LUT). Requires ``set_row_window_command``.
+//|         :param float partial_refresh_time: Like ``refresh_time`` but for a partial refresh
+//|         :param float partial_seconds_per_frame: Minimum number of seconds before a partial refresh
+//|         :param int max_partial_refreshes: Number of partial refreshes between full refreshes, which clear
+//|           the ghosting that partial refreshes leave behind
 //|         """
 //|         ...
 STATIC mp_obj_t displayio_epaperdisplay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
@@ -134,7 +147,8 @@ STATIC mp_obj_t displayio_epaperdisplay_make_new(const mp_obj_type_t *type, size
            ARG_write_color_ram_command, ARG_color_bits_inverted, ARG_highlight_color,
            ARG_refresh_display_command,  ARG_refresh_time, ARG_busy_pin, ARG_busy_state,
            ARG_seconds_per_frame, ARG_always_toggle_chip_select, ARG_grayscale, ARG_advanced_color_epaper,
-           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian };
+           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian, ARG_refresh_buffer_size,
+           ARG_partial_refresh_sequence, ARG_partial_refresh_time, ARG_partial_seconds_per_frame, ARG_max_partial_refreshes };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_start_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -166,6 +180,11 @@ STATIC mp_obj_t displayio_epaperdisplay_make_new(const mp_obj_type_t *type, size
         { MP_QSTR_two_byte_sequence_length, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
         { MP_QSTR_start_up_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
         { MP_QSTR_address_little_endian, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_refresh_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_partial_refresh_sequence, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_partial_refresh_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(1)} },
+        { MP_QSTR_partial_seconds_per_frame, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(1)} },
+        { MP_QSTR_max_partial_refreshes, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 10} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -185,12 +204,22 @@ STATIC mp_obj_t displayio_epaperdisplay_make_new(const mp_obj_type_t *type, size
         mp_raise_ValueError(translate("Display rotation must be in 90 degree increments"));
     }
 
+    mp_int_t refresh_buffer_size = mp_arg_validate_int_min(args[ARG_refresh_buffer_size].u_int, 0, MP_QSTR_refresh_buffer_size);
+
+    mp_buffer_info_t partial_bufinfo = { .buf = NULL, .len = 0 };
+    if (args[ARG_partial_refresh_sequence].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_partial_refresh_sequence].u_obj, &partial_bufinfo, MP_BUFFER_READ);
+    }
+    mp_int_t max_partial_refreshes = mp_arg_validate_int_range(args[ARG_max_partial_refreshes].u_int, 0, 0xffff, MP_QSTR_max_partial_refreshes);
+
     primary_display_t *disp = allocate_display_or_raise();
     displayio_epaperdisplay_obj_t *self = &disp->epaper_display;
 
     mp_float_t refresh_time = mp_obj_get_float(args[ARG_refresh_time].u_obj);
     mp_float_t seconds_per_frame = mp_obj_get_float(args[ARG_seconds_per_frame].u_obj);
     mp_float_t start_up_time = mp_obj_get_float(args[ARG_start_up_time].u_obj);
+    mp_float_t partial_refresh_time = mp_obj_get_float(args[ARG_partial_refresh_time].u_obj);
+    mp_float_t partial_seconds_per_frame = mp_obj_get_float(args[ARG_partial_seconds_per_frame].u_obj);
 
     mp_int_t write_color_ram_command = NO_COMMAND;
     mp_int_t highlight_color = args[ARG_highlight_color].u_int;
@@ -235,6 +264,15 @@ STATIC mp_obj_t displayio_epaperdisplay_make_new(const mp_obj_type_t *type, size
         two_byte_sequence_length, args[ARG_address_little_endian].u_bool
         );
 
+    if (refresh_buffer_size > 0) {
+        displayio_display_core_set_refresh_buffer_size(&self->core, refresh_buffer_size, 1);
+    }
+
+    if (partial_bufinfo.buf != NULL) {
+        common_hal_displayio_epaperdisplay_set_partial_refresh(self, partial_bufinfo.buf, partial_bufinfo.len,
+            partial_refresh_time, partial_seconds_per_frame, max_partial_refreshes);
+    }
+
     return self;
 }
 
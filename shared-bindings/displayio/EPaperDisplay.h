@@ -50,6 +50,10 @@ void common_hal_displayio_epaperdisplay_construct(displayio_epaperdisplay_obj_t
     bool always_toggle_chip_select, bool grayscale, bool acep, bool two_byte_sequence_length,
     bool address_little_endian);
 
+void common_hal_displayio_epaperdisplay_set_partial_refresh(displayio_epaperdisplay_obj_t *self,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len,
+    mp_float_t partial_refresh_time, mp_float_t partial_seconds_per_frame, uint16_t max_partial_refreshes);
+
 bool common_hal_displayio_epaperdisplay_refresh(displayio_epaperdisplay_obj_t *self);
 
 bool common_hal_displayio_epaperdisplay_show(displayio_epaperdisplay_obj_t *self, displayio_group_t *root_group);
@@ -53,4 +53,11 @@ void common_hal_displayio_fourwire_send(mp_obj_t self, display_byte_type_t byte_
 
 void common_hal_displayio_fourwire_end_transaction(mp_obj_t self);
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+bool common_hal_displayio_fourwire_start_send(mp_obj_t self, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length);
+
+void common_hal_displayio_fourwire_finish_send(mp_obj_t self);
+#endif
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYBUSIO_FOURWIRE_H
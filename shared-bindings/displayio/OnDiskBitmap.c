@@ -67,10 +67,13 @@
 //|       while True:
 //|           pass"""
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO]) -> None:
+//|     def __init__(self, file: Union[str, typing.BinaryIO], *, cache_rows: int = 1) -> None:
 //|         """Create an OnDiskBitmap object with the given file.
 //|
 //|         :param file file: The name of the bitmap file.  For backwards compatibility, a file opened in binary mode may also be passed.
+//|         :param int cache_rows: Number of whole rows of the file to read and keep in RAM at once.
+//|           Larger values trade memory for fewer, larger reads during refresh. 0 disables the cache
+//|           and reads each pixel from the file individually.
 //|
 //|         Older versions of CircuitPython required a file opened in binary
 //|         mode. CircuitPython 7.0 modified OnDiskBitmap so that it takes a
@@ -79,19 +82,29 @@
 //|         """
 //|         ...
 STATIC mp_obj_t displayio_ondiskbitmap_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    mp_arg_check_num(n_args, n_kw, 1, 1, false);
-    mp_obj_t arg = all_args[0];
+    enum { ARG_file, ARG_cache_rows };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_cache_rows, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t arg = args[ARG_file].u_obj;
+    uint16_t cache_rows = mp_arg_validate_int_range(args[ARG_cache_rows].u_int, 0, 32767, MP_QSTR_cache_rows);
 
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
     }
-    if (!mp_obj_is_type(arg, &mp_type_fileio)) {
+    // The bitmap is read with FatFs, so on ports where the default file type
+    // is something else (unix) only files on a FAT filesystem are accepted.
+    if (!mp_obj_is_type(arg, &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(translate("file must be a file opened in byte mode"));
     }
 
     displayio_ondiskbitmap_t *self = m_new_obj(displayio_ondiskbitmap_t);
     self->base.type = &displayio_ondiskbitmap_type;
-    common_hal_displayio_ondiskbitmap_construct(self, MP_OBJ_TO_PTR(arg));
+    common_hal_displayio_ondiskbitmap_construct(self, MP_OBJ_TO_PTR(arg), cache_rows);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -66,6 +66,9 @@ uint16_t common_hal_displayio_tilegrid_get_tile_height(displayio_tilegrid_t *sel
 
 uint8_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y);
 void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index);
+// Set count consecutive tiles of row y starting at x, clipped to the row.
+void common_hal_displayio_tilegrid_set_tile_run(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint8_t *tile_indices, uint16_t count);
+void common_hal_displayio_tilegrid_fill_tile_run(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index, uint16_t count);
 
 // Private API for scrolling the TileGrid.
 void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint16_t x, uint16_t y);
@@ -59,6 +59,16 @@ typedef bool (*display_bus_begin_transaction)(mp_obj_t bus);
 typedef void (*display_bus_send)(mp_obj_t bus, display_byte_type_t byte_type,
     display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length);
 typedef void (*display_bus_end_transaction)(mp_obj_t bus);
+// Optional. Starts sending data and returns before it is done. Returns false if nothing was sent
+// because the bus can't send in the background right now.
+typedef bool (*display_bus_start_send)(mp_obj_t bus, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length);
+// Waits for the data passed to a successful display_bus_start_send to finish sending.
+typedef void (*display_bus_finish_send)(mp_obj_t bus);
+// Optional. Sends the pattern_length bytes of pattern count times in a row without them being
+// copied out first. Returns false if the bus can't repeat this pattern itself.
+typedef bool (*display_bus_send_fill)(mp_obj_t bus, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *pattern, uint32_t pattern_length, uint32_t count);
 
 void common_hal_displayio_release_displays(void);
 
@@ -0,0 +1,182 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/dualbank/__init__.h"
+#include "shared-bindings/dualbank/Updater.h"
+#include "supervisor/shared/translate/translate.h"
+
+//| class Updater:
+//|     def __init__(self, *, size: int = 0, sha256: Optional[ReadableBuffer] = None) -> None:
+//|         """Writes a firmware image to the next-update partition as it arrives.
+//|
+//|         Data is collected into one erase block and written when the block is
+//|         full, so only that much RAM is used however big the image is. A SHA-256
+//|         of the image is computed as it goes.
+//|
+//|         If the transfer is interrupted, call `readfrom()` or `write()` again with
+//|         the rest of the image, starting at `offset`. For HTTP that means a new
+//|         request with a ``Range`` header.
+//|
+//|         To download a compressed image, wrap the socket in a `zlib.DecompIO`
+//|         and pass that to `readfrom()`.
+//|
+//|         :param int size: The size of the image, if known. More data than this is
+//|             not accepted and `finish()` fails if less arrived.
+//|         :param ReadableBuffer sha256: The expected SHA-256 of the image. `finish()`
+//|             fails if it does not match.
+//|
+//|         Update from a web server::
+//|
+//|           import dualbank
+//|
+//|           updater = dualbank.Updater(size=image_size, sha256=image_sha256)
+//|           while updater.offset < image_size:
+//|               with requests.get(url, headers={"Range": f"bytes={updater.offset}-"}) as response:
+//|                   try:
+//|                       updater.readfrom(response.socket)
+//|                   except OSError:
+//|                       pass
+//|           updater.finish()
+//|           dualbank.switch()
+//|         """
+//|         ...
+STATIC mp_obj_t dualbank_updater_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_size, ARG_sha256 };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_sha256, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+
+    #if CIRCUITPY_STORAGE_EXTEND
+    dualbank_raise_error_if_storage_extended();
+    #endif
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const mp_int_t size = mp_arg_validate_int_min(args[ARG_size].u_int, 0, MP_QSTR_size);
+
+    const uint8_t *sha256 = NULL;
+    if (args[ARG_sha256].u_obj != mp_const_none) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(args[ARG_sha256].u_obj, &bufinfo, MP_BUFFER_READ);
+        mp_arg_validate_length(bufinfo.len, DUALBANK_UPDATER_DIGEST_SIZE, MP_QSTR_sha256);
+        sha256 = bufinfo.buf;
+    }
+
+    dualbank_updater_obj_t *self = m_new_obj(dualbank_updater_obj_t);
+    self->base.type = &dualbank_updater_type;
+    common_hal_dualbank_updater_construct(self, size, sha256);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def write(self, buffer: ReadableBuffer) -> None:
+//|         """Adds the next part of the image."""
+//|         ...
+STATIC mp_obj_t dualbank_updater_write(mp_obj_t self_in, mp_obj_t buffer_in) {
+    dualbank_updater_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_READ);
+    common_hal_dualbank_updater_write(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(dualbank_updater_write_obj, dualbank_updater_write);
+
+//|     def readfrom(self, stream: object, nbytes: int = -1) -> int:
+//|         """Reads the next part of the image from ``stream``, such as a socket, until it
+//|         ends, ``nbytes`` have been read or the image is ``size`` bytes long.
+//|
+//|         A non-blocking stream with no data ready also stops the read. Any other
+//|         error is raised after keeping what was read before it.
+//|
+//|         :return: The number of bytes read.
+//|         """
+//|         ...
+STATIC mp_obj_t dualbank_updater_readfrom(size_t n_args, const mp_obj_t *args) {
+    dualbank_updater_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    size_t nbytes = SIZE_MAX;
+    if (n_args > 2) {
+        mp_int_t n = mp_obj_get_int(args[2]);
+        if (n >= 0) {
+            nbytes = n;
+        }
+    }
+    return mp_obj_new_int_from_uint(common_hal_dualbank_updater_readfrom(self, args[1], nbytes));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(dualbank_updater_readfrom_obj, 2, 3, dualbank_updater_readfrom);
+
+//|     def finish(self) -> None:
+//|         """Writes what is left of the image and checks its size and SHA-256.
+//|
+//|         Call `dualbank.switch()` afterwards to boot the new image."""
+//|         ...
+STATIC mp_obj_t dualbank_updater_finish(mp_obj_t self_in) {
+    dualbank_updater_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_dualbank_updater_finish(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(dualbank_updater_finish_obj, dualbank_updater_finish);
+
+//|     def digest(self) -> bytes:
+//|         """Returns the SHA-256 of the image so far."""
+//|         ...
+STATIC mp_obj_t dualbank_updater_digest(mp_obj_t self_in) {
+    dualbank_updater_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    byte digest[DUALBANK_UPDATER_DIGEST_SIZE];
+    common_hal_dualbank_updater_get_digest(self, digest);
+    return mp_obj_new_bytes(digest, sizeof(digest));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(dualbank_updater_digest_obj, dualbank_updater_digest);
+
+//|     offset: int
+//|     """The number of bytes of the image received so far. (read-only)"""
+//|
+STATIC mp_obj_t dualbank_updater_get_offset(mp_obj_t self_in) {
+    dualbank_updater_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_dualbank_updater_get_offset(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(dualbank_updater_get_offset_obj, dualbank_updater_get_offset);
+
+MP_PROPERTY_GETTER(dualbank_updater_offset_obj,
+    (mp_obj_t)&dualbank_updater_get_offset_obj);
+
+STATIC const mp_rom_map_elem_t dualbank_updater_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_digest), MP_ROM_PTR(&dualbank_updater_digest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_finish), MP_ROM_PTR(&dualbank_updater_finish_obj) },
+    { MP_ROM_QSTR(MP_QSTR_offset), MP_ROM_PTR(&dualbank_updater_offset_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readfrom), MP_ROM_PTR(&dualbank_updater_readfrom_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&dualbank_updater_write_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(dualbank_updater_locals_dict, dualbank_updater_locals_dict_table);
+
+const mp_obj_type_t dualbank_updater_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Updater,
+    .make_new = dualbank_updater_make_new,
+    .locals_dict = (mp_obj_dict_t *)&dualbank_updater_locals_dict,
+};
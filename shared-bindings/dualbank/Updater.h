@@ -0,0 +1,41 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_DUALBANK_UPDATER_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_DUALBANK_UPDATER_H
+
+#include "shared-module/dualbank/Updater.h"
+
+extern const mp_obj_type_t dualbank_updater_type;
+
+extern void common_hal_dualbank_updater_construct(dualbank_updater_obj_t *self, size_t size, const uint8_t *sha256);
+extern void common_hal_dualbank_updater_write(dualbank_updater_obj_t *self, const uint8_t *buf, size_t len);
+extern size_t common_hal_dualbank_updater_readfrom(dualbank_updater_obj_t *self, mp_obj_t stream, size_t nbytes);
+extern void common_hal_dualbank_updater_finish(dualbank_updater_obj_t *self);
+extern size_t common_hal_dualbank_updater_get_offset(dualbank_updater_obj_t *self);
+extern void common_hal_dualbank_updater_get_digest(dualbank_updater_obj_t *self, uint8_t *digest);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_DUALBANK_UPDATER_H
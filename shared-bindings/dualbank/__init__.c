@@ -25,6 +25,7 @@
  */
 
 #include "shared-bindings/dualbank/__init__.h"
+#include "shared-bindings/dualbank/Updater.h"
 
 #if CIRCUITPY_STORAGE_EXTEND
 #include "supervisor/flash.h"
@@ -63,12 +64,14 @@
 //|
 //|     dualbank.flash(buffer, offset)
 //|     dualbank.switch()
+//|
+//| To download and write an image without holding it in RAM, use `dualbank.Updater`.
 //| """
 //| ...
 //|
 
 #if CIRCUITPY_STORAGE_EXTEND
-STATIC void raise_error_if_storage_extended(void) {
+void dualbank_raise_error_if_storage_extended(void) {
     if (supervisor_flash_get_extended()) {
         mp_raise_msg_varg(&mp_type_RuntimeError, translate("%q is %q"), MP_QSTR_storage, MP_QSTR_extended);
     }
@@ -93,7 +96,7 @@ STATIC mp_obj_t dualbank_flash(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     };
 
     #if CIRCUITPY_STORAGE_EXTEND
-    raise_error_if_storage_extended();
+    dualbank_raise_error_if_storage_extended();
     #endif
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -120,7 +123,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_KW(dualbank_flash_obj, 0, dualbank_flash);
 //|
 STATIC mp_obj_t dualbank_switch(void) {
     #if CIRCUITPY_STORAGE_EXTEND
-    raise_error_if_storage_extended();
+    dualbank_raise_error_if_storage_extended();
     #endif
     common_hal_dualbank_switch();
     return mp_const_none;
@@ -133,6 +136,8 @@ STATIC const mp_rom_map_elem_t dualbank_module_globals_table[] = {
     // module functions
     { MP_ROM_QSTR(MP_QSTR_flash), MP_ROM_PTR(&dualbank_flash_obj) },
     { MP_ROM_QSTR(MP_QSTR_switch), MP_ROM_PTR(&dualbank_switch_obj) },
+    // module classes
+    { MP_ROM_QSTR(MP_QSTR_Updater), MP_ROM_PTR(&dualbank_updater_type) },
 };
 STATIC MP_DEFINE_CONST_DICT(dualbank_module_globals, dualbank_module_globals_table);
 
@@ -32,4 +32,8 @@
 extern void common_hal_dualbank_switch(void);
 extern void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset);
 
+#if CIRCUITPY_STORAGE_EXTEND
+extern void dualbank_raise_error_if_storage_extended(void);
+#endif
+
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_DUALBANK___INIT___H
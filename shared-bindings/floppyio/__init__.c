@@ -40,9 +40,9 @@
 //|     """Read flux transition information into the buffer.
 //|
 //|     The function returns when the buffer has filled, or when the index input
-//|     indicates that one full revolution of data has been recorded.  Due to
-//|     technical limitations, this process may not be interruptible by
-//|     KeyboardInterrupt.
+//|     indicates that one full revolution of data has been recorded.  Except on
+//|     RP2040, which times the flux with PIO, this process may not be interruptible
+//|     by KeyboardInterrupt.
 //|
 //|     :param buffer: Read data into this buffer.  Each element represents the time between successive zero-to-one transitions.
 //|     :param data: Pin on which the flux data appears
@@ -78,8 +78,9 @@ MP_DEFINE_CONST_FUN_OBJ_KW(floppyio_flux_readinto_obj, 0, floppyio_flux_readinto
 //|     The track is assumed to consist of 512-byte sectors.
 //|
 //|     The function returns when all sectors have been successfully read, or
-//|     a number of index pulses have occurred.  Due to technical limitations, this
-//|     process may not be interruptible by KeyboardInterrupt.
+//|     a number of index pulses have occurred.  Except on RP2040, which decodes
+//|     the track while PIO captures it, this process may not be interruptible by
+//|     KeyboardInterrupt.
 //|
 //|     :param buffer: Read data into this buffer.  Must be a multiple of 512.
 //|     :param data: Pin on which the mfm data appears
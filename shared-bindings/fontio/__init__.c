@@ -29,6 +29,7 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 
+#include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/fontio/__init__.h"
 #include "shared-bindings/fontio/BuiltinFont.h"
 #include "shared-bindings/fontio/Glyph.h"
@@ -42,11 +43,58 @@
 //|     `this Learn guide <https://learn.adafruit.com/custom-fonts-for-pyportal-circuitpython-display>`_
 //|
 //| """
+//|
+//| def render_text(
+//|     font: FontProtocol,
+//|     text: str,
+//|     bitmap: displayio.Bitmap,
+//|     x: int,
+//|     y: int,
+//|     palette_index: int = 1,
+//| ) -> int:
+//|     """Draws ``text`` into ``bitmap`` with its baseline at ``y`` and its first glyph at ``x``.
+//|
+//|     Each set pixel of a glyph is written as ``palette_index``. Glyph pixels that are zero
+//|     are left unchanged, so the text background is whatever the bitmap already holds.
+//|     Characters the font has no glyph for are skipped, and glyphs are clipped to the bitmap.
+//|     Only the area covered by the text is marked dirty.
+//|
+//|     ``font`` is a `BuiltinFont` or any `FontProtocol` whose glyphs use a `displayio.Bitmap`,
+//|     such as the fonts loaded by ``adafruit_bitmap_font``. Repeated characters in ``text`` look up their
+//|     glyph once.
+//|
+//|     Returns the x position after the last glyph, so text can be drawn in several calls."""
+//|     ...
+//|
+STATIC mp_obj_t fontio_render_text(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum {ARG_font, ARG_text, ARG_bitmap, ARG_x, ARG_y, ARG_palette_index};
+    static const mp_arg_t allowed_args[] = {
+        {MP_QSTR_font, MP_ARG_REQUIRED | MP_ARG_OBJ},
+        {MP_QSTR_text, MP_ARG_REQUIRED | MP_ARG_OBJ},
+        {MP_QSTR_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ},
+        {MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT},
+        {MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT},
+        {MP_QSTR_palette_index, MP_ARG_INT, {.u_int = 1}},
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t len;
+    const char *text = mp_obj_str_get_data(args[ARG_text].u_obj, &len);
+    displayio_bitmap_t *bitmap = mp_arg_validate_type(args[ARG_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_bitmap);
+    uint32_t palette_index = mp_arg_validate_int_range(args[ARG_palette_index].u_int, 0, bitmap->bitmask, MP_QSTR_palette_index);
+
+    mp_int_t x = common_hal_fontio_render_text(args[ARG_font].u_obj, (const byte *)text, len,
+        bitmap, args[ARG_x].u_int, args[ARG_y].u_int, palette_index);
+    return mp_obj_new_int(x);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(fontio_render_text_obj, 5, fontio_render_text);
 
 STATIC const mp_rom_map_elem_t fontio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_fontio) },
     { MP_ROM_QSTR(MP_QSTR_BuiltinFont), MP_ROM_PTR(&fontio_builtinfont_type) },
     { MP_ROM_QSTR(MP_QSTR_Glyph), MP_ROM_PTR(&fontio_glyph_type) },
+    { MP_ROM_QSTR(MP_QSTR_render_text), MP_ROM_PTR(&fontio_render_text_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(fontio_module_globals, fontio_module_globals_table);
@@ -27,5 +27,10 @@
 #ifndef MICROPY_INCLUDED_SHARED_BINDINGS_FONTIO___INIT___H
 #define MICROPY_INCLUDED_SHARED_BINDINGS_FONTIO___INIT___H
 
+#include "py/obj.h"
+#include "shared-module/displayio/Bitmap.h"
+
+mp_int_t common_hal_fontio_render_text(mp_obj_t font, const byte *text, size_t len,
+    displayio_bitmap_t *bitmap, mp_int_t x, mp_int_t y, uint32_t palette_index);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_FONTIO___INIT___H
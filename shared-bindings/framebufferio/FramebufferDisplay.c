@@ -52,21 +52,24 @@
 //|         framebuffer: circuitpython_typing.FrameBuffer,
 //|         *,
 //|         rotation: int = 0,
-//|         auto_refresh: bool = True
+//|         auto_refresh: bool = True,
+//|         refresh_buffer_size: int = 0
 //|     ) -> None:
 //|         """Create a Display object with the given framebuffer (a buffer, array, ulab.array, etc)
 //|
 //|         :param ~circuitpython_typing.FrameBuffer framebuffer: The framebuffer that the display is connected to
 //|         :param bool auto_refresh: Automatically refresh the screen
 //|         :param int rotation: The rotation of the display in degrees clockwise. Must be in 90 degree increments (0, 90, 180, 270)
+//|         :param int refresh_buffer_size: Number of bytes of pixel data to composite at once during a refresh. When 0, a small buffer on the stack is used.
 //|         """
 //|         ...
 STATIC mp_obj_t framebufferio_framebufferdisplay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_framebuffer, ARG_rotation, ARG_auto_refresh, NUM_ARGS };
+    enum { ARG_framebuffer, ARG_rotation, ARG_auto_refresh, ARG_refresh_buffer_size, NUM_ARGS };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_framebuffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_rotation, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
         { MP_QSTR_auto_refresh, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
+        { MP_QSTR_refresh_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
     };
     MP_STATIC_ASSERT(MP_ARRAY_SIZE(allowed_args) == NUM_ARGS);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -79,6 +82,8 @@ STATIC mp_obj_t framebufferio_framebufferdisplay_make_new(const mp_obj_type_t *t
         mp_raise_ValueError(translate("Display rotation must be in 90 degree increments"));
     }
 
+    mp_int_t refresh_buffer_size = mp_arg_validate_int_min(args[ARG_refresh_buffer_size].u_int, 0, MP_QSTR_refresh_buffer_size);
+
     primary_display_t *disp = allocate_display_or_raise();
     framebufferio_framebufferdisplay_obj_t *self = &disp->framebuffer_display;
     self->base.type = &framebufferio_framebufferdisplay_type;
@@ -89,6 +94,11 @@ STATIC mp_obj_t framebufferio_framebufferdisplay_make_new(const mp_obj_type_t *t
         args[ARG_auto_refresh].u_bool
         );
 
+    if (refresh_buffer_size > 0) {
+        displayio_display_core_set_refresh_buffer_size(&self->core, refresh_buffer_size,
+            CIRCUITPY_DISPLAYIO_CORE1 ? 2 : 1);
+    }
+
     return self;
 }
 
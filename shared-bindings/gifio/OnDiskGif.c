@@ -99,6 +99,12 @@
 //|           display_bus.send(43, struct.pack(">hh", 0, odg.bitmap.height - 1))
 //|           display_bus.send(44, odg.bitmap)
 //|
+//|     When displayio is used, only the `frame_area` covered by each new frame is
+//|     marked dirty in the bitmap, so animations that change a small part of the
+//|     image refresh only that part of the display. `decode_time` reports how long
+//|     the last `next_frame` call took, which can be used in place of measuring the
+//|     overhead with `time.monotonic`.
+//|
 //|       # The following optional code will free the OnDiskGif and allocated resources
 //|       # after use. This may be required before loading a new GIF in situations
 //|       # where RAM is limited and the first GIF took most of the RAM.
@@ -276,7 +282,6 @@ MP_PROPERTY_GETTER(gifio_ondiskgif_min_delay_obj,
 
 //|     max_delay: float
 //|     """The maximum delay found between frames. (read only)"""
-//|
 STATIC mp_obj_t gifio_ondiskgif_obj_get_max_delay(mp_obj_t self_in) {
     gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -289,6 +294,43 @@ MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_max_delay_obj, gifio_ondiskgif_obj
 MP_PROPERTY_GETTER(gifio_ondiskgif_max_delay_obj,
     (mp_obj_t)&gifio_ondiskgif_get_max_delay_obj);
 
+//|     frame_area: Tuple[int, int, int, int]
+//|     """The area of the bitmap updated by the last call to `next_frame`, as
+//|     ``(x1, y1, x2, y2)`` with ``x2`` and ``y2`` exclusive. (read only)"""
+STATIC mp_obj_t gifio_ondiskgif_obj_get_frame_area(mp_obj_t self_in) {
+    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
+
+    check_for_deinit(self);
+    const displayio_area_t *area = common_hal_gifio_ondiskgif_get_frame_area(self);
+    mp_obj_t items[] = {
+        MP_OBJ_NEW_SMALL_INT(area->x1),
+        MP_OBJ_NEW_SMALL_INT(area->y1),
+        MP_OBJ_NEW_SMALL_INT(area->x2),
+        MP_OBJ_NEW_SMALL_INT(area->y2),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_frame_area_obj, gifio_ondiskgif_obj_get_frame_area);
+
+MP_PROPERTY_GETTER(gifio_ondiskgif_frame_area_obj,
+    (mp_obj_t)&gifio_ondiskgif_get_frame_area_obj);
+
+//|     decode_time: float
+//|     """The time in seconds the last call to `next_frame` spent decoding. (read only)"""
+//|
+STATIC mp_obj_t gifio_ondiskgif_obj_get_decode_time(mp_obj_t self_in) {
+    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
+
+    check_for_deinit(self);
+    return mp_obj_new_float((mp_float_t)common_hal_gifio_ondiskgif_get_decode_time(self) / 1000000000);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_decode_time_obj, gifio_ondiskgif_obj_get_decode_time);
+
+MP_PROPERTY_GETTER(gifio_ondiskgif_decode_time_obj,
+    (mp_obj_t)&gifio_ondiskgif_get_decode_time_obj);
+
 //|     def deinit(self) -> None:
 //|         """Release resources allocated by OnDiskGif."""
 //|         ...
@@ -313,6 +355,8 @@ STATIC const mp_rom_map_elem_t gifio_ondiskgif_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_frame_count), MP_ROM_PTR(&gifio_ondiskgif_frame_count_obj) },
     { MP_ROM_QSTR(MP_QSTR_min_delay), MP_ROM_PTR(&gifio_ondiskgif_min_delay_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_delay), MP_ROM_PTR(&gifio_ondiskgif_max_delay_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frame_area), MP_ROM_PTR(&gifio_ondiskgif_frame_area_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decode_time), MP_ROM_PTR(&gifio_ondiskgif_decode_time_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(gifio_ondiskgif_locals_dict, gifio_ondiskgif_locals_dict_table);
 
@@ -46,6 +46,8 @@ int32_t common_hal_gifio_ondiskgif_get_duration(gifio_ondiskgif_t *self);
 int32_t common_hal_gifio_ondiskgif_get_frame_count(gifio_ondiskgif_t *self);
 int32_t common_hal_gifio_ondiskgif_get_min_delay(gifio_ondiskgif_t *self);
 int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self);
+const displayio_area_t *common_hal_gifio_ondiskgif_get_frame_area(gifio_ondiskgif_t *self);
+uint32_t common_hal_gifio_ondiskgif_get_decode_time(gifio_ondiskgif_t *self);
 void common_hal_gifio_ondiskgif_deinit(gifio_ondiskgif_t *self);
 bool common_hal_gifio_ondiskgif_deinited(gifio_ondiskgif_t *self);
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_ONDISKGIF_H
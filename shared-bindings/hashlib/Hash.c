@@ -47,7 +47,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(hashlib_hash_digest_size_get_obj, hashlib_hash_digest_
 MP_PROPERTY_GETTER(hashlib_hash_digest_size_obj, (mp_obj_t)&hashlib_hash_digest_size_get_obj);
 
 //|     def update(self, data: ReadableBuffer) -> None:
-//|         """Update the hash with the given bytes.
+//|         """Update the hash with the given bytes. The data is hashed where it is, so a
+//|         `memoryview` slice of a large buffer can be passed without copying it.
 //|
 //|         :param ~circuitpython_typing.ReadableBuffer data: Update the hash from data in this buffer
 //|         """
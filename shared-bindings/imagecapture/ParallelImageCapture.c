@@ -34,6 +34,23 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "common-hal/imagecapture/ParallelImageCapture.h"
 
+#if CIRCUITPY_DISPLAYIO
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-module/displayio/Bitmap.h"
+#endif
+
+// A frame captured straight into a Bitmap needs a full refresh once it is handed out.
+STATIC mp_obj_t imagecapture_frame_ready(mp_obj_t frame) {
+    #if CIRCUITPY_DISPLAYIO
+    if (mp_obj_is_type(frame, &displayio_bitmap_type)) {
+        displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(frame);
+        displayio_area_t area = {0, 0, bitmap->width, bitmap->height, NULL};
+        displayio_bitmap_set_dirty_area(bitmap, &area);
+    }
+    #endif
+    return frame;
+}
+
 //| class ParallelImageCapture:
 //|     """Capture image frames from a camera with parallel data interface"""
 //|
@@ -87,13 +104,16 @@ STATIC mp_obj_t imagecapture_parallelimagecapture_make_new(const mp_obj_type_t *
 //|     def capture(self, buffer: WriteableBuffer) -> WriteableBuffer:
 //|         """Capture a single frame into the given buffer.
 //|
-//|         This will stop a continuous-mode capture, if one is in progress."""
+//|         This will stop a continuous-mode capture, if one is in progress.
+//|
+//|         ``buffer`` may be a `displayio.Bitmap`, so the frame can be shown
+//|         without copying it. The whole bitmap is marked as changed."""
 //|         ...
 STATIC mp_obj_t imagecapture_parallelimagecapture_capture(mp_obj_t self_in, mp_obj_t buffer) {
     imagecapture_parallelimagecapture_obj_t *self = (imagecapture_parallelimagecapture_obj_t *)self_in;
     common_hal_imagecapture_parallelimagecapture_singleshot_capture(self, buffer);
 
-    return buffer;
+    return imagecapture_frame_ready(buffer);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(imagecapture_parallelimagecapture_capture_obj, imagecapture_parallelimagecapture_capture);
 
@@ -105,6 +125,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(imagecapture_parallelimagecapture_capture_obj,
 //|         Call `continuous_capture_get_frame` to get the next available
 //|         frame, and `continuous_capture_stop` to stop capturing.
 //|
+//|         The buffers may be `displayio.Bitmap` objects of the same size, so
+//|         frames are captured straight into something a display can show.
+//|
 //|         Until `continuous_capture_stop` (or `deinit`) is called, the
 //|         `ParallelImageCapture` object keeps references to ``buffer1`` and
 //|         ``buffer2``, so the objects will not be garbage collected."""
@@ -118,11 +141,14 @@ STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_start(mp_ob
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(imagecapture_parallelimagecapture_continuous_capture_start_obj, imagecapture_parallelimagecapture_continuous_capture_start);
 
 //|     def continuous_capture_get_frame(self) -> WriteableBuffer:
-//|         """Return the next available frame, one of the two buffers passed to `continuous_capture_start`"""
+//|         """Return the next available frame, one of the two buffers passed to `continuous_capture_start`
+//|
+//|         The returned buffer is not written to until the next call, so it can be
+//|         shown or processed while the other buffer is filled."""
 //|         ...
 STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_get_frame(mp_obj_t self_in) {
     imagecapture_parallelimagecapture_obj_t *self = (imagecapture_parallelimagecapture_obj_t *)self_in;
-    return common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(self);
+    return imagecapture_frame_ready(common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(self));
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(imagecapture_parallelimagecapture_continuous_capture_get_frame_obj, imagecapture_parallelimagecapture_continuous_capture_get_frame);
 
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/builtin.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/jpegio/JpegDecoder.h"
+#include "supervisor/shared/translate/translate.h"
+
+//| class JpegDecoder:
+//|     """Decode baseline JPEG images into a `displayio.Bitmap`
+//|
+//|     The image is decoded a block at a time directly into the bitmap, so only
+//|     a few hundred bytes of input and pixels are held in memory at once. The
+//|     image may also be reduced by 2, 4 or 8 while it is being decoded, which
+//|     is quicker and needs a smaller bitmap.
+//|
+//|     Progressive and arithmetic coded JPEGs are not supported.
+//|
+//|     Example::
+//|
+//|         import displayio
+//|         import jpegio
+//|
+//|         decoder = jpegio.JpegDecoder()
+//|         width, height = decoder.open("/sample.jpg")
+//|         bitmap = displayio.Bitmap(width, height, 65535)
+//|         decoder.decode(bitmap)
+//|     """
+//|
+//|     def __init__(self) -> None:
+//|         """Create a JpegDecoder"""
+//|         ...
+STATIC mp_obj_t jpegio_jpegdecoder_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+
+    jpegio_jpegdecoder_obj_t *self = m_new_obj(jpegio_jpegdecoder_obj_t);
+    self->base.type = &jpegio_jpegdecoder_type;
+    common_hal_jpegio_jpegdecoder_construct(self);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def open(self, data_or_file: ReadableBuffer | typing.BinaryIO | str) -> Tuple[int, int]:
+//|         """Read the headers of a JPEG image and get ready to decode it
+//|
+//|         The image can be given as a buffer, as a file or other stream opened
+//|         in binary mode, or as the name of a file.
+//|
+//|         :return: the width and height of the image
+//|         :rtype: Tuple[int, int]"""
+//|         ...
+STATIC mp_obj_t jpegio_jpegdecoder_open(mp_obj_t self_in, mp_obj_t source) {
+    jpegio_jpegdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    if (mp_obj_is_str(source)) {
+        source = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), source, MP_ROM_QSTR(MP_QSTR_rb));
+    }
+
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(source, &bufinfo, MP_BUFFER_READ)) {
+        common_hal_jpegio_jpegdecoder_open(self, source, bufinfo.buf, bufinfo.len);
+    } else {
+        mp_get_stream_raise(source, MP_STREAM_OP_READ);
+        common_hal_jpegio_jpegdecoder_open(self, source, NULL, 0);
+    }
+
+    mp_obj_t size[] = { MP_OBJ_NEW_SMALL_INT(self->width), MP_OBJ_NEW_SMALL_INT(self->height) };
+    return mp_obj_new_tuple(2, size);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
+
+//|     def decode(self, bitmap: displayio.Bitmap, scale: int = 0, x: int = 0, y: int = 0) -> None:
+//|         """Decode the image opened by `open` into a bitmap
+//|
+//|         Pixels are stored as RGB565 colors. The parts of the image that fall
+//|         outside the bitmap are skipped. Each opened image can only be decoded
+//|         once, because it may be coming from a stream.
+//|
+//|         :param displayio.Bitmap bitmap: A writable bitmap with 16 bits per value
+//|         :param int scale: Reduce the image by ``2 ** scale``, from 0 (full size) to 3 (one eighth)
+//|         :param int x: Horizontal position in the bitmap of the upper-left corner of the image
+//|         :param int y: Vertical position in the bitmap of the upper-left corner of the image"""
+//|         ...
+//|
+STATIC mp_obj_t jpegio_jpegdecoder_decode(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_bitmap, ARG_scale, ARG_x, ARG_y };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_scale, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_x, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    jpegio_jpegdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    displayio_bitmap_t *bitmap = mp_arg_validate_type(args[ARG_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_bitmap);
+    if (common_hal_displayio_bitmap_get_bits_per_value(bitmap) != 16) {
+        mp_raise_ValueError(translate("Invalid bits per value"));
+    }
+    int scale = mp_arg_validate_int_range(args[ARG_scale].u_int, 0, 3, MP_QSTR_scale);
+    int16_t x = mp_arg_validate_int_range(args[ARG_x].u_int, -32768, 32767, MP_QSTR_x);
+    int16_t y = mp_arg_validate_int_range(args[ARG_y].u_int, -32768, 32767, MP_QSTR_y);
+
+    common_hal_jpegio_jpegdecoder_decode(self, bitmap, scale, x, y);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(jpegio_jpegdecoder_decode_obj, 1, jpegio_jpegdecoder_decode);
+
+STATIC const mp_rom_map_elem_t jpegio_jpegdecoder_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&jpegio_jpegdecoder_open_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&jpegio_jpegdecoder_decode_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(jpegio_jpegdecoder_locals_dict, jpegio_jpegdecoder_locals_dict_table);
+
+const mp_obj_type_t jpegio_jpegdecoder_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_JpegDecoder,
+    .make_new = jpegio_jpegdecoder_make_new,
+    .locals_dict = (mp_obj_dict_t *)&jpegio_jpegdecoder_locals_dict,
+};
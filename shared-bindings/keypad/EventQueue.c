@@ -37,6 +37,22 @@
 //|
 //|     You cannot create an instance of `EventQueue` directly. Each scanner creates an
 //|     instance when it is created.
+//|
+//|     An `EventQueue` can be registered with `select.poll` for ``POLLIN``. Polling
+//|     sleeps until the scanner queues an event instead of looping in Python, so events
+//|     are handled no later than one scanner ``interval`` after they happen. The
+//|     scanner's ``max_events`` sets how many events can wait to be handled::
+//|
+//|         import select
+//|
+//|         poller = select.poll()
+//|         poller.register(keys.events, select.POLLIN)
+//|         while True:
+//|             poller.poll()
+//|             event = keys.events.get()
+//|             while event:
+//|                 handle(event)
+//|                 event = keys.events.get()
 //|     """
 //|
 //|     ...
@@ -139,6 +139,12 @@ MP_PROPERTY_GETSET(mdns_server_instance_name_obj,
 //|         This doesn't allow for direct hostname lookup. To do that, use
 //|         `socketpool.SocketPool.getaddrinfo()`.
 //|
+//|         On the Raspberry Pi Pico W, services found are remembered until their time-to-live
+//|         runs out, and the search keeps running after `find` returns, even across reloads.
+//|         ``timeout`` is then counted from when the search for ``service_type`` first started,
+//|         so repeated calls return right away, and ``timeout=0`` returns the services known so far
+//|         without waiting.
+//|
 //|         :param str service_type: The service type such as "_http"
 //|         :param str protocol: The service protocol such as "_tcp"
 //|         :param float/int timeout: Time to wait for responses"""
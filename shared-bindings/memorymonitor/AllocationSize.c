@@ -61,7 +61,7 @@
 //|
 //|         """
 //|         ...
-STATIC mp_obj_t memorymonitor_allocationsize_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *all_args, mp_map_t *kw_args) {
+STATIC mp_obj_t memorymonitor_allocationsize_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     memorymonitor_allocationsize_obj_t *self = m_new_obj(memorymonitor_allocationsize_obj_t);
     self->base.type = &memorymonitor_allocationsize_type;
 
@@ -167,10 +167,13 @@ STATIC MP_DEFINE_CONST_DICT(memorymonitor_allocationsize_locals_dict, memorymoni
 
 const mp_obj_type_t memorymonitor_allocationsize_type = {
     { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
     .name = MP_QSTR_AllocationSize,
     .make_new = memorymonitor_allocationsize_make_new,
-    .subscr = memorymonitor_allocationsize_subscr,
-    .unary_op = memorymonitor_allocationsize_unary_op,
-    .getiter = mp_obj_new_generic_iterator,
     .locals_dict = (mp_obj_dict_t *)&memorymonitor_allocationsize_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .subscr = memorymonitor_allocationsize_subscr,
+        .unary_op = memorymonitor_allocationsize_unary_op,
+        .getiter = mp_obj_new_generic_iterator,
+        ),
 };
@@ -24,6 +24,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdarg.h>
 #include <stdint.h>
 
 #include "py/obj.h"
@@ -31,6 +32,7 @@
 
 #include "shared-bindings/memorymonitor/__init__.h"
 #include "shared-bindings/memorymonitor/AllocationAlarm.h"
+#include "shared-bindings/memorymonitor/AllocationSites.h"
 #include "shared-bindings/memorymonitor/AllocationSize.h"
 
 //| """Memory monitoring helpers"""
@@ -54,6 +56,7 @@ NORETURN void mp_raise_memorymonitor_AllocationError(const compressed_string_t *
 STATIC const mp_rom_map_elem_t memorymonitor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_memorymonitor) },
     { MP_ROM_QSTR(MP_QSTR_AllocationAlarm), MP_ROM_PTR(&memorymonitor_allocationalarm_type) },
+    { MP_ROM_QSTR(MP_QSTR_AllocationSites), MP_ROM_PTR(&memorymonitor_allocationsites_type) },
     { MP_ROM_QSTR(MP_QSTR_AllocationSize), MP_ROM_PTR(&memorymonitor_allocationsize_type) },
 
     // Errors
@@ -124,28 +124,38 @@ MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_pack_obj, 0, mod_msgpack_pack);
 
 
 //| def unpack(
-//|     stream: circuitpython_typing.ByteStream,
+//|     stream: Union[circuitpython_typing.ByteStream, ReadableBuffer],
 //|     *,
 //|     ext_hook: Union[Callable[[int, bytes], object], None] = None,
-//|     use_list: bool = True
+//|     use_list: bool = True,
+//|     bin_as_memoryview: bool = False
 //| ) -> object:
 //|     """Unpack and return one object from stream.
 //|
-//|     :param ~circuitpython_typing.ByteStream stream: stream to read from
+//|     *stream* may also be a bytes-like object, which is unpacked without
+//|     copying it. Seekable streams, such as files, are read ahead in chunks
+//|     and repositioned just after the object once it has been unpacked; if
+//|     an error occurs, the position of the stream is undefined.
+//|
+//|     :param ~circuitpython_typing.ByteStream stream: stream or buffer to read from
 //|     :param Optional[~circuitpython_typing.Callable[[int, bytes], object]] ext_hook: function called for objects in
 //|            msgpack ext format.
 //|     :param Optional[bool] use_list: return array as list or tuple (use_list=False).
+//|     :param bool bin_as_memoryview: when unpacking a bytes-like object, return
+//|            msgpack bin data as read-only `memoryview` slices of it instead of copies.
+//|            Ignored when unpacking from a stream.
 //|
 //|     :return object: object read from stream.
 //|     """
 //|     ...
 //|
 STATIC mp_obj_t mod_msgpack_unpack(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_buffer, ARG_ext_hook, ARG_use_list };
+    enum { ARG_buffer, ARG_ext_hook, ARG_use_list, ARG_bin_as_memoryview };
     STATIC const mp_arg_t allowed_args[] = {
         { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, },
         { MP_QSTR_ext_hook, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
         { MP_QSTR_use_list, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = true } },
+        { MP_QSTR_bin_as_memoryview, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = false } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -155,7 +165,7 @@ STATIC mp_obj_t mod_msgpack_unpack(size_t n_args, const mp_obj_t *pos_args, mp_m
         mp_raise_ValueError(translate("ext_hook is not a function"));
     }
 
-    return common_hal_msgpack_unpack(args[ARG_buffer].u_obj, hook, args[ARG_use_list].u_bool);
+    return common_hal_msgpack_unpack(args[ARG_buffer].u_obj, hook, args[ARG_use_list].u_bool, args[ARG_bin_as_memoryview].u_bool);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_unpack_obj, 0, mod_msgpack_unpack);
 
@@ -33,5 +33,8 @@
 #include "common-hal/digitalio/DigitalInOut.h"
 
 extern void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
+#if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+extern void common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
+#endif
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_NEOPIXEL_WRITE_H
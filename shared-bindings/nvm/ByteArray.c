@@ -35,8 +35,9 @@
 //|     r"""Presents a stretch of non-volatile memory as a bytearray.
 //|
 //|     Non-volatile memory is available as a byte array that persists over reloads
-//|     and power cycles. Each assignment causes an erase and write cycle so its recommended to assign
-//|     all values to change at once.
+//|     and power cycles. On most ports each assignment causes an erase and write cycle so its
+//|     recommended to assign all values to change at once. See `flush` for ports that collect
+//|     changes first.
 //|
 //|     Usage::
 //|
@@ -65,7 +66,28 @@ STATIC mp_obj_t nvm_bytearray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     }
 }
 
+//|     def flush(self) -> None:
+//|         """Write any changes that are still being held in RAM to the non-volatile memory now.
+//|
+//|         Some ports collect changes in RAM and write them together once no change has been made
+//|         for about a second, or before a reload or reset. Call `flush` when a change must not
+//|         be lost to a power cut. On other ports every change is written immediately and this
+//|         does nothing."""
+//|         ...
+STATIC mp_obj_t nvm_bytearray_flush(mp_obj_t self_in) {
+    nvm_bytearray_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_nvm_bytearray_flush(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nvm_bytearray_flush_obj, nvm_bytearray_flush);
+
+// Ports that write changes through immediately have nothing to flush.
+MP_WEAK void common_hal_nvm_bytearray_flush(const nvm_bytearray_obj_t *self) {
+    (void)self;
+}
+
 STATIC const mp_rom_map_elem_t nvm_bytearray_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&nvm_bytearray_flush_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(nvm_bytearray_locals_dict, nvm_bytearray_locals_dict_table);
@@ -39,5 +39,7 @@ bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
 // also leverage the compiler to validate uses are expected.
 void common_hal_nvm_bytearray_get_bytes(const nvm_bytearray_obj_t *self,
     uint32_t start_index, uint32_t len, uint8_t *values);
+// Writes out any changes held in RAM. Does nothing where changes are written immediately.
+void common_hal_nvm_bytearray_flush(const nvm_bytearray_obj_t *self);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_NVM_BYTEARRAY_H
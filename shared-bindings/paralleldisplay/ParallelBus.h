@@ -53,3 +53,6 @@ void common_hal_paralleldisplay_parallelbus_send(mp_obj_t self, display_byte_typ
     display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length);
 
 void common_hal_paralleldisplay_parallelbus_end_transaction(mp_obj_t self);
+
+bool common_hal_paralleldisplay_parallelbus_send_fill(mp_obj_t self, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *pattern, uint32_t pattern_length, uint32_t count);
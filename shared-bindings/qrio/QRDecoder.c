@@ -33,30 +33,57 @@
 #include "py/enum.h"
 
 //| class QRDecoder:
-//|     def __init__(self, width: int, height: int) -> None:
+//|     def __init__(self, width: int, height: int, *, scale: int = 1, track: bool = False) -> None:
 //|         """Construct a QRDecoder object
 //|
 //|         :param int width: The pixel width of the image to decode
 //|         :param int height: The pixel height of the image to decode
+//|         :param int scale: Search an image this many times smaller in each direction, keeping one
+//|             pixel out of each ``scale``×``scale`` block. Decoding is much faster, as long as the
+//|             code's modules stay at least a few pixels wide after scaling.
+//|         :param bool track: After a code is found, search only the region around it on the next
+//|             decode, falling back to the whole image when it is lost. This suits scanning
+//|             successive frames from a camera.
 //|         """
 //|         ...
 
 STATIC mp_obj_t qrio_qrdecoder_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args_in) {
-    enum { ARG_width, ARG_height };
+    enum { ARG_width, ARG_height, ARG_scale, ARG_track };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_height, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_scale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_track, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, args_in, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    int scale = mp_arg_validate_int_min(args[ARG_scale].u_int, 1, MP_QSTR_scale);
+
     qrio_qrdecoder_obj_t *self = m_new_obj(qrio_qrdecoder_obj_t);
     self->base.type = &qrio_qrdecoder_type_obj;
-    shared_module_qrio_qrdecoder_construct(self, args[ARG_width].u_int, args[ARG_height].u_int);
+    shared_module_qrio_qrdecoder_construct(self, args[ARG_width].u_int, args[ARG_height].u_int, scale, args[ARG_track].u_bool);
 
     return self;
 }
 
+// Check that the buffer holds a whole image in the given pixel policy.
+STATIC qrio_pixel_policy_t qrio_qrdecoder_get_image(qrio_qrdecoder_obj_t *self, mp_obj_t buffer, mp_obj_t pixel_policy, mp_buffer_info_t *bufinfo) {
+    mp_get_buffer_raise(buffer, bufinfo, MP_BUFFER_READ);
+
+    int width = shared_module_qrio_qrdecoder_get_width(self);
+    int height = shared_module_qrio_qrdecoder_get_height(self);
+
+    // verify that the buffer is big enough
+    int sz = width * height;
+    qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, pixel_policy, MP_QSTR_pixel_policy);
+    if (policy != QRIO_EVERY_BYTE) {
+        sz *= 2;
+    }
+    mp_get_index(mp_obj_get_type(buffer), bufinfo->len, MP_OBJ_NEW_SMALL_INT(sz - 1), false);
+    return policy;
+}
+
 //|     def decode(
 //|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
 //|     ) -> List[QRInfo]:
@@ -73,23 +100,48 @@ STATIC mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, m
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
-
-    int width = shared_module_qrio_qrdecoder_get_width(self);
-    int height = shared_module_qrio_qrdecoder_get_height(self);
-
-    // verify that the buffer is big enough
-    int sz = width * height;
-    qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
-    if (policy != QRIO_EVERY_BYTE) {
-        sz *= 2;
-    }
-    mp_get_index(mp_obj_get_type(args[ARG_buffer].u_obj), bufinfo.len, MP_OBJ_NEW_SMALL_INT(sz - 1), false);
+    qrio_pixel_policy_t policy = qrio_qrdecoder_get_image(self, args[ARG_buffer].u_obj, args[ARG_pixel_policy].u_obj, &bufinfo);
 
     return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_decode_obj, 1, qrio_qrdecoder_decode);
 
+//|     def decode_into(
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         payload: WriteableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|     ) -> Optional[int]:
+//|         """Decode the first QR code found in the given image, storing its content in ``payload``.
+//|         The image is the same as for `decode`.
+//|
+//|         Unlike `decode`, this does not allocate, so it suits scanning every frame from a camera.
+//|
+//|         :return: The length of the payload, or ``None`` if no code was found.
+//|         :rtype: Optional[int]
+//|         """
+STATIC mp_obj_t qrio_qrdecoder_decode_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    enum { ARG_buffer, ARG_payload, ARG_pixel_policy };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_payload, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    qrio_pixel_policy_t policy = qrio_qrdecoder_get_image(self, args[ARG_buffer].u_obj, args[ARG_pixel_policy].u_obj, &bufinfo);
+
+    mp_buffer_info_t payload;
+    mp_get_buffer_raise(args[ARG_payload].u_obj, &payload, MP_BUFFER_WRITE);
+
+    return shared_module_qrio_qrdecoder_decode_into(self, &bufinfo, policy, &payload);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_decode_into_obj, 1, qrio_qrdecoder_decode_into);
+
 //|     width: int
 //|     """The width of image the decoder expects"""
 STATIC mp_obj_t qrio_qrdecoder_get_width(mp_obj_t self_in) {
@@ -136,6 +188,7 @@ STATIC const mp_rom_map_elem_t qrio_qrdecoder_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&qrio_qrdecoder_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&qrio_qrdecoder_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&qrio_qrdecoder_decode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decode_into), MP_ROM_PTR(&qrio_qrdecoder_decode_into_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(qrio_qrdecoder_locals, qrio_qrdecoder_locals_table);
@@ -361,8 +361,15 @@ STATIC void rgbmatrix_rgbmatrix_get_bufinfo(mp_obj_t self_in, mp_buffer_info_t *
 // These version exists so that the prototype matches the protocol,
 // avoiding a type cast that can hide errors
 STATIC void rgbmatrix_rgbmatrix_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmap) {
-    (void)dirty_row_bitmap;
-    common_hal_rgbmatrix_rgbmatrix_refresh(self_in);
+    // Converting to bit-planes is a full frame pass, so skip it when the
+    // refresh did not touch any rows (e.g. every area was clipped away).
+    int height = common_hal_rgbmatrix_rgbmatrix_get_height(self_in);
+    for (int i = 0; i < (height + 7) / 8; i++) {
+        if (dirty_row_bitmap[i]) {
+            common_hal_rgbmatrix_rgbmatrix_refresh(self_in);
+            return;
+        }
+    }
 }
 
 STATIC void rgbmatrix_rgbmatrix_deinit_proto(mp_obj_t self_in) {
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/socketpool/ConnectionPool.h"
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+//| class ConnectionPool:
+//|     """Keeps connected sockets that are idle between requests, such as HTTP keep-alive
+//|     connections, so that later requests to the same host and port can reuse them instead
+//|     of connecting, and doing a TLS handshake, again.
+//|
+//|     Both `socketpool.Socket` and `ssl.SSLSocket` objects may be pooled. A socket that has
+//|     anything to read while idle, including the peer closing the connection, is closed
+//|     rather than handed out again.
+//|
+//|     Usage::
+//|
+//|         sock = pool.get("example.com", 443)
+//|         if sock is None:
+//|             sock = context.wrap_socket(socket_pool.socket(), server_hostname="example.com")
+//|             sock.connect(("example.com", 443))
+//|         # ... send a request and read the whole response ...
+//|         pool.put(sock, "example.com", 443)
+//|     """
+//|
+//|     def __init__(self, max_idle: int = 2) -> None:
+//|         """Create a pool that keeps up to max_idle idle sockets for each host and port.
+//|
+//|         :param int max_idle: how many idle sockets to keep per host and port. When another is
+//|           returned, the one that has been idle longest is closed."""
+//|         ...
+STATIC mp_obj_t socketpool_connectionpool_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_max_idle };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_max_idle, MP_ARG_INT, {.u_int = 2} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t max_idle = mp_arg_validate_int_min(args[ARG_max_idle].u_int, 1, MP_QSTR_max_idle);
+
+    socketpool_connectionpool_obj_t *self = m_new_obj(socketpool_connectionpool_obj_t);
+    self->base.type = &socketpool_connectionpool_type;
+
+    common_hal_socketpool_connectionpool_construct(self, max_idle);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def get(self, host: str, port: int) -> Optional[Union[socketpool.Socket, ssl.SSLSocket]]:
+//|         """Take an idle socket connected to host and port out of the pool.
+//|
+//|         :return: the socket, or None if there is no usable one.
+//|         """
+//|         ...
+STATIC mp_obj_t socketpool_connectionpool_get(mp_obj_t self_in, mp_obj_t host, mp_obj_t port) {
+    socketpool_connectionpool_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_obj_t sock = common_hal_socketpool_connectionpool_get(self,
+        mp_arg_validate_type(host, &mp_type_str, MP_QSTR_host), mp_obj_get_int(port));
+    return sock == MP_OBJ_NULL ? mp_const_none : sock;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(socketpool_connectionpool_get_obj, socketpool_connectionpool_get);
+
+//|     def put(self, sock: Union[socketpool.Socket, ssl.SSLSocket], host: str, port: int) -> None:
+//|         """Return a socket connected to host and port to the pool once a request on it
+//|         is complete, and its response has been read in full. It is closed instead if it is
+//|         no longer usable."""
+//|         ...
+STATIC mp_obj_t socketpool_connectionpool_put(size_t n_args, const mp_obj_t *args) {
+    socketpool_connectionpool_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_obj_t sock = args[1];
+    // Liveness is checked by polling, so only streams can be pooled.
+    mp_get_stream_raise(sock, MP_STREAM_OP_IOCTL);
+
+    common_hal_socketpool_connectionpool_put(self, sock,
+        mp_arg_validate_type(args[2], &mp_type_str, MP_QSTR_host), mp_obj_get_int(args[3]));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socketpool_connectionpool_put_obj, 4, 4, socketpool_connectionpool_put);
+
+//|     def clear(self) -> None:
+//|         """Close all of the idle sockets."""
+//|         ...
+STATIC mp_obj_t socketpool_connectionpool_clear(mp_obj_t self_in) {
+    socketpool_connectionpool_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    common_hal_socketpool_connectionpool_clear(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(socketpool_connectionpool_clear_obj, socketpool_connectionpool_clear);
+
+//|     idle: int
+//|     """The number of idle sockets in the pool, for all hosts. (read-only)"""
+//|
+STATIC mp_obj_t socketpool_connectionpool_get_idle(mp_obj_t self_in) {
+    socketpool_connectionpool_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_socketpool_connectionpool_get_idle(self));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(socketpool_connectionpool_get_idle_obj, socketpool_connectionpool_get_idle);
+
+MP_PROPERTY_GETTER(socketpool_connectionpool_idle_obj,
+    (mp_obj_t)&socketpool_connectionpool_get_idle_obj);
+
+STATIC const mp_rom_map_elem_t socketpool_connectionpool_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_get), MP_ROM_PTR(&socketpool_connectionpool_get_obj) },
+    { MP_ROM_QSTR(MP_QSTR_put), MP_ROM_PTR(&socketpool_connectionpool_put_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&socketpool_connectionpool_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR_idle), MP_ROM_PTR(&socketpool_connectionpool_idle_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(socketpool_connectionpool_locals_dict, socketpool_connectionpool_locals_dict_table);
+
+const mp_obj_type_t socketpool_connectionpool_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_ConnectionPool,
+    .make_new = socketpool_connectionpool_make_new,
+    .locals_dict = (mp_obj_dict_t *)&socketpool_connectionpool_locals_dict,
+};
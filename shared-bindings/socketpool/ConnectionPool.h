@@ -0,0 +1,41 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_SOCKETPOOL_CONNECTIONPOOL_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_SOCKETPOOL_CONNECTIONPOOL_H
+
+#include "shared-module/socketpool/ConnectionPool.h"
+
+extern const mp_obj_type_t socketpool_connectionpool_type;
+
+void common_hal_socketpool_connectionpool_construct(socketpool_connectionpool_obj_t *self, mp_uint_t max_idle);
+void common_hal_socketpool_connectionpool_clear(socketpool_connectionpool_obj_t *self);
+// Returns MP_OBJ_NULL when no live idle socket is connected to host and port.
+mp_obj_t common_hal_socketpool_connectionpool_get(socketpool_connectionpool_obj_t *self, mp_obj_t host, mp_int_t port);
+void common_hal_socketpool_connectionpool_put(socketpool_connectionpool_obj_t *self, mp_obj_t sock, mp_obj_t host, mp_int_t port);
+mp_uint_t common_hal_socketpool_connectionpool_get_idle(socketpool_connectionpool_obj_t *self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_SOCKETPOOL_CONNECTIONPOOL_H
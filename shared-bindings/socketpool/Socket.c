@@ -187,6 +187,53 @@ STATIC mp_obj_t socketpool_socket_recvfrom_into(mp_obj_t self_in, mp_obj_t data_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvfrom_into_obj, socketpool_socket_recvfrom_into);
 
+// Get the array of datagram ends for recvfrom_many_into() and sendto_many().
+STATIC size_t socketpool_socket_get_ends(mp_obj_t ends_in, mp_buffer_info_t *ends, mp_uint_t flags) {
+    mp_get_buffer_raise(ends_in, ends, flags);
+    if (ends->typecode != 'H') {
+        mp_raise_ValueError_varg(translate("%q must be array of type 'H'"), MP_QSTR_ends);
+    }
+    return mp_arg_validate_length_min(ends->len / sizeof(uint16_t), 1, MP_QSTR_ends);
+}
+
+//|     def recvfrom_many_into(
+//|         self, buffer: WriteableBuffer, ends: WriteableBuffer
+//|     ) -> Tuple[int, Tuple[str, int]]:
+//|         """Reads several datagrams from one remote address in a single call.
+//|
+//|         Waits, like `recvfrom_into()`, for the first datagram and then also takes any others
+//|         that have already arrived from the same address, as long as they fit whole in the rest
+//|         of ``buffer``. The datagrams are stored one after another and ``ends[i]`` is set to the
+//|         index in ``buffer`` just past datagram ``i``.
+//|
+//|         Returns a tuple containing
+//|         * the number of datagrams received, at most ``len(ends)``
+//|         * a remote_address, which is a tuple of ip address and port number
+//|
+//|         Suits sockets of type SOCK_DGRAM
+//|
+//|         :param object buffer: buffer to read into
+//|         :param ~array.array ends: array of type ``'H'`` to store where each datagram ends"""
+//|         ...
+STATIC mp_obj_t socketpool_socket_recvfrom_many_into(mp_obj_t self_in, mp_obj_t data_in, mp_obj_t ends_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_WRITE);
+    mp_buffer_info_t ends;
+    size_t count = socketpool_socket_get_ends(ends_in, &ends, MP_BUFFER_WRITE);
+
+    byte ip[4];
+    uint32_t port;
+    // Ends past 0xffff couldn't be stored.
+    mp_int_t ret = common_hal_socketpool_socket_recvfrom_many_into(self,
+        (byte *)bufinfo.buf, MIN(bufinfo.len, 0xffff), (uint16_t *)ends.buf, count, ip, &port);
+    mp_obj_t tuple_contents[2];
+    tuple_contents[0] = mp_obj_new_int_from_uint(ret);
+    tuple_contents[1] = netutils_format_inet_addr(ip, port, NETUTILS_BIG);
+    return mp_obj_new_tuple(2, tuple_contents);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(socketpool_socket_recvfrom_many_into_obj, socketpool_socket_recvfrom_many_into);
+
 //|     def recv_into(self, buffer: WriteableBuffer, bufsize: int) -> int:
 //|         """Reads some bytes from the connected remote address, writing
 //|         into the provided buffer. If bufsize <= len(buffer) is given,
@@ -265,6 +312,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_send_obj, _socketpool_socket_
 //|         occurs. If an error occurs, it's impossible to tell how much data
 //|         has been sent.
 //|
+//|         Where the port supports it, the contents of a `bytes` object are sent
+//|         without copying them into the network stack, since they can't change.
+//|
 //|         :param ~bytes bytes: some bytes to send"""
 //|         ...
 STATIC mp_obj_t _socketpool_socket_sendall(mp_obj_t self_in, mp_obj_t buf_in) {
@@ -278,8 +328,9 @@ STATIC mp_obj_t _socketpool_socket_sendall(mp_obj_t self_in, mp_obj_t buf_in) {
     }
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    mp_obj_t owner = mp_obj_is_type(buf_in, &mp_type_bytes) ? buf_in : MP_OBJ_NULL;
     while (bufinfo.len > 0) {
-        mp_int_t ret = common_hal_socketpool_socket_send(self, bufinfo.buf, bufinfo.len);
+        mp_int_t ret = common_hal_socketpool_socket_sendall_part(self, owner, bufinfo.buf, bufinfo.len);
         if (ret == -1) {
             mp_raise_BrokenPipeError();
         }
@@ -327,6 +378,52 @@ STATIC mp_obj_t socketpool_socket_sendto(mp_obj_t self_in, mp_obj_t data_in, mp_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(socketpool_socket_sendto_obj, socketpool_socket_sendto);
 
+//|     def sendto_many(
+//|         self, bytes: ReadableBuffer, ends: ReadableBuffer, address: Tuple[str, int]
+//|     ) -> int:
+//|         """Send several datagrams to a specific address in a single call.
+//|         Datagram ``i`` is ``bytes[ends[i - 1]:ends[i]]``, with the first starting at 0.
+//|         Suits sockets of type SOCK_DGRAM
+//|
+//|         Returns the number of datagrams sent. This is less than ``len(ends)`` when the
+//|         network stack stops accepting them part way, in which case the rest can be sent again.
+//|
+//|         :param ~bytes bytes: the datagrams, one after another
+//|         :param ~array.array ends: array of type ``'H'`` giving where each datagram ends
+//|         :param ~tuple address: tuple of (remote_address, remote_port)"""
+//|         ...
+STATIC mp_obj_t socketpool_socket_sendto_many(size_t n_args, const mp_obj_t *args) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+
+    // get the data
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t ends;
+    size_t count = socketpool_socket_get_ends(args[2], &ends, MP_BUFFER_READ);
+    const uint16_t *ends_items = ends.buf;
+    for (size_t i = 0; i < count; i++) {
+        if (ends_items[i] > bufinfo.len || (i > 0 && ends_items[i] < ends_items[i - 1])) {
+            mp_arg_error_invalid(MP_QSTR_ends);
+        }
+    }
+
+    mp_obj_t *addr_items;
+    mp_obj_get_array_fixed_n(args[3], 2, &addr_items);
+
+    size_t hostlen;
+    const char *host = mp_obj_str_get_data(addr_items[0], &hostlen);
+    mp_int_t port = mp_obj_get_int(addr_items[1]);
+    if (port < 0) {
+        mp_raise_ValueError(translate("port must be >= 0"));
+    }
+
+    mp_int_t ret = common_hal_socketpool_socket_sendto_many(self, host, hostlen, (uint32_t)port,
+        bufinfo.buf, ends_items, count);
+
+    return mp_obj_new_int_from_uint(ret);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socketpool_socket_sendto_many_obj, 4, 4, socketpool_socket_sendto_many);
+
 //|     def setblocking(self, flag: bool) -> Optional[int]:
 //|         """Set the blocking behaviour of this socket.
 //|
@@ -411,10 +508,12 @@ STATIC const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&socketpool_socket_connect_obj) },
     { MP_ROM_QSTR(MP_QSTR_listen), MP_ROM_PTR(&socketpool_socket_listen_obj) },
     { MP_ROM_QSTR(MP_QSTR_recvfrom_into), MP_ROM_PTR(&socketpool_socket_recvfrom_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvfrom_many_into), MP_ROM_PTR(&socketpool_socket_recvfrom_many_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv_into), MP_ROM_PTR(&socketpool_socket_recv_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&socketpool_socket_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendall), MP_ROM_PTR(&socketpool_socket_sendall_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendto), MP_ROM_PTR(&socketpool_socket_sendto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendto_many), MP_ROM_PTR(&socketpool_socket_sendto_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socketpool_socket_setblocking_obj) },
     { MP_ROM_QSTR(MP_QSTR_setsockopt), MP_ROM_PTR(&socketpool_socket_setsockopt_obj) },
     { MP_ROM_QSTR(MP_QSTR_settimeout), MP_ROM_PTR(&socketpool_socket_settimeout_obj) },
@@ -427,6 +526,9 @@ STATIC mp_uint_t socket_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg
     mp_uint_t ret;
     if (request == MP_STREAM_POLL) {
         mp_uint_t flags = arg;
+        if (common_hal_socketpool_socket_get_closed(self)) {
+            return MP_STREAM_POLL_NVAL;
+        }
         ret = 0;
         if ((flags & MP_STREAM_POLL_RD) && common_hal_socketpool_readable(self) > 0) {
             ret |= MP_STREAM_POLL_RD;
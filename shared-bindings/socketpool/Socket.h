@@ -43,8 +43,22 @@ mp_uint_t common_hal_socketpool_socket_recvfrom_into(socketpool_socket_obj_t *se
     uint8_t *buf, uint32_t len, uint8_t *ip, uint32_t *port);
 mp_uint_t common_hal_socketpool_socket_recv_into(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len);
 mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len);
+// Sends part of the data of a sendall(), like common_hal_socketpool_socket_send(). owner, when
+// not MP_OBJ_NULL, is an immutable object holding buf that the port may keep referring to,
+// instead of copying buf, until the data has been delivered.
+mp_uint_t common_hal_socketpool_socket_sendall_part(socketpool_socket_obj_t *self, mp_obj_t owner, const uint8_t *buf, uint32_t len);
 mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len);
+// Sends count datagrams from buf to one address. Datagram i is buf[ends[i - 1]:ends[i]], taking
+// ends[-1] as 0. Returns how many were sent, which is fewer than count if the socket stopped
+// accepting them after the first.
+mp_uint_t common_hal_socketpool_socket_sendto_many(socketpool_socket_obj_t *self,
+    const char *host, size_t hostlen, uint32_t port, const uint8_t *buf,
+    const uint16_t *ends, size_t count);
+// Receives up to count datagrams from one source into buf, one after another, storing where each
+// ends in ends. Only waits for the first. Returns how many were received.
+mp_uint_t common_hal_socketpool_socket_recvfrom_many_into(socketpool_socket_obj_t *self,
+    uint8_t *buf, uint32_t len, uint16_t *ends, size_t count, uint8_t *ip, uint32_t *port);
 void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms);
 int common_hal_socketpool_socket_setsockopt(socketpool_socket_obj_t *self, int level, int optname, const void *value, size_t optlen);
 bool common_hal_socketpool_readable(socketpool_socket_obj_t *self);
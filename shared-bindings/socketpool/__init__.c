@@ -29,6 +29,7 @@
 #include "py/parsenum.h"
 #include "py/runtime.h"
 #include "shared-bindings/socketpool/__init__.h"
+#include "shared-bindings/socketpool/ConnectionPool.h"
 #include "shared-bindings/socketpool/Socket.h"
 #include "shared-bindings/socketpool/SocketPool.h"
 
@@ -45,6 +46,7 @@ STATIC const mp_rom_map_elem_t socketpool_globals_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_SocketPool), MP_ROM_PTR(&socketpool_socketpool_type) },
     { MP_ROM_QSTR(MP_QSTR_Socket), MP_ROM_PTR(&socketpool_socket_type) },
+    { MP_ROM_QSTR(MP_QSTR_ConnectionPool), MP_ROM_PTR(&socketpool_connectionpool_type) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(socketpool_globals, socketpool_globals_table);
@@ -45,7 +45,7 @@
 STATIC mp_obj_t ssl_sslcontext_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_arg_check_num(n_args, n_kw, 0, 1, false);
 
-    ssl_sslcontext_obj_t *s = m_new_obj(ssl_sslcontext_obj_t);
+    ssl_sslcontext_obj_t *s = m_new_obj_with_finaliser(ssl_sslcontext_obj_t);
     s->base.type = &ssl_sslcontext_type;
 
     common_hal_ssl_sslcontext_construct(s);
@@ -53,6 +53,15 @@ STATIC mp_obj_t ssl_sslcontext_make_new(const mp_obj_type_t *type, size_t n_args
     return MP_OBJ_FROM_PTR(s);
 }
 
+// Frees the cached TLS sessions.
+STATIC mp_obj_t ssl_sslcontext___del__(mp_obj_t self_in) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    common_hal_ssl_sslcontext_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ssl_sslcontext___del___obj, ssl_sslcontext___del__);
+
 //|     def load_cert_chain(self, certfile: str, keyfile: str) -> None:
 //|         """Load a private key and the corresponding certificate.
 //|
@@ -148,6 +157,33 @@ MP_PROPERTY_GETSET(ssl_sslcontext_check_hostname_obj,
     (mp_obj_t)&ssl_sslcontext_get_check_hostname_obj,
     (mp_obj_t)&ssl_sslcontext_set_check_hostname_obj);
 
+//|     session_hits: int
+//|     """The number of client connections that resumed a session cached from an earlier
+//|     connection to the same ``server_hostname``, saving a full handshake. (read-only)"""
+
+STATIC mp_obj_t ssl_sslcontext_get_session_hits(mp_obj_t self_in) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(common_hal_ssl_sslcontext_get_session_hits(self));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ssl_sslcontext_get_session_hits_obj, ssl_sslcontext_get_session_hits);
+
+MP_PROPERTY_GETTER(ssl_sslcontext_session_hits_obj,
+    (mp_obj_t)&ssl_sslcontext_get_session_hits_obj);
+
+//|     session_misses: int
+//|     """The number of client connections that needed a full handshake. (read-only)"""
+
+STATIC mp_obj_t ssl_sslcontext_get_session_misses(mp_obj_t self_in) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(common_hal_ssl_sslcontext_get_session_misses(self));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ssl_sslcontext_get_session_misses_obj, ssl_sslcontext_get_session_misses);
+
+MP_PROPERTY_GETTER(ssl_sslcontext_session_misses_obj,
+    (mp_obj_t)&ssl_sslcontext_get_session_misses_obj);
+
 //|     def wrap_socket(
 //|         self,
 //|         sock: socketpool.Socket,
@@ -156,7 +192,11 @@ MP_PROPERTY_GETSET(ssl_sslcontext_check_hostname_obj,
 //|         server_hostname: Optional[str] = None
 //|     ) -> ssl.SSLSocket:
 //|         """Wraps the socket into a socket-compatible class that handles SSL negotiation.
-//|         The socket must be of type SOCK_STREAM."""
+//|         The socket must be of type SOCK_STREAM.
+//|
+//|         Client sockets with a ``server_hostname`` offer the server the session from the
+//|         last connection to that hostname, when it is still cached, so that the handshake
+//|         can be abbreviated."""
 //|
 
 STATIC mp_obj_t ssl_sslcontext_wrap_socket(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -187,11 +227,14 @@ STATIC mp_obj_t ssl_sslcontext_wrap_socket(size_t n_args, const mp_obj_t *pos_ar
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(ssl_sslcontext_wrap_socket_obj, 1, ssl_sslcontext_wrap_socket);
 
 STATIC const mp_rom_map_elem_t ssl_sslcontext_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&ssl_sslcontext___del___obj) },
     { MP_ROM_QSTR(MP_QSTR_wrap_socket), MP_ROM_PTR(&ssl_sslcontext_wrap_socket_obj) },
     { MP_ROM_QSTR(MP_QSTR_load_cert_chain), MP_ROM_PTR(&ssl_sslcontext_load_cert_chain_obj) },
     { MP_ROM_QSTR(MP_QSTR_load_verify_locations), MP_ROM_PTR(&ssl_sslcontext_load_verify_locations_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_default_verify_paths), MP_ROM_PTR(&ssl_sslcontext_set_default_verify_paths_obj) },
     { MP_ROM_QSTR(MP_QSTR_check_hostname), MP_ROM_PTR(&ssl_sslcontext_check_hostname_obj) },
+    { MP_ROM_QSTR(MP_QSTR_session_hits), MP_ROM_PTR(&ssl_sslcontext_session_hits_obj) },
+    { MP_ROM_QSTR(MP_QSTR_session_misses), MP_ROM_PTR(&ssl_sslcontext_session_misses_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(ssl_sslcontext_locals_dict, ssl_sslcontext_locals_dict_table);
@@ -34,6 +34,7 @@
 #include "py/objlist.h"
 #include "py/runtime.h"
 #include "py/mperrno.h"
+#include "py/stream.h"
 
 #include "shared/netutils/netutils.h"
 
@@ -297,6 +298,34 @@ STATIC const mp_rom_map_elem_t ssl_sslsocket_locals_dict_table[] = {
 
 STATIC MP_DEFINE_CONST_DICT(ssl_sslsocket_locals_dict, ssl_sslsocket_locals_dict_table);
 
+STATIC mp_uint_t ssl_sslsocket_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    ssl_sslsocket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t ret;
+    if (request == MP_STREAM_POLL) {
+        mp_uint_t flags = arg;
+        if (common_hal_ssl_sslsocket_get_closed(self)) {
+            return MP_STREAM_POLL_NVAL;
+        }
+        ret = 0;
+        if ((flags & MP_STREAM_POLL_RD) && common_hal_ssl_sslsocket_readable(self)) {
+            ret |= MP_STREAM_POLL_RD;
+        }
+        if ((flags & MP_STREAM_POLL_WR) && common_hal_ssl_sslsocket_writable(self)) {
+            ret |= MP_STREAM_POLL_WR;
+        }
+    } else {
+        *errcode = MP_EINVAL;
+        ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
+STATIC const mp_stream_p_t ssl_sslsocket_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .ioctl = ssl_sslsocket_ioctl,
+    .is_text = false,
+};
+
 const mp_obj_type_t ssl_sslsocket_type = {
     { &mp_type_type },
     .flags = MP_TYPE_FLAG_EXTENDED,
@@ -304,5 +333,6 @@ const mp_obj_type_t ssl_sslsocket_type = {
     .locals_dict = (mp_obj_dict_t *)&ssl_sslsocket_locals_dict,
     MP_TYPE_EXTENDED_FIELDS(
         .unary_op = mp_generic_unary_op,
+        .protocol = &ssl_sslsocket_stream_p,
         )
 };
@@ -37,6 +37,9 @@ void common_hal_ssl_sslsocket_close(ssl_sslsocket_obj_t *self);
 void common_hal_ssl_sslsocket_connect(ssl_sslsocket_obj_t *self, const char *host, size_t hostlen, uint32_t port);
 bool common_hal_ssl_sslsocket_get_closed(ssl_sslsocket_obj_t *self);
 bool common_hal_ssl_sslsocket_get_connected(ssl_sslsocket_obj_t *self);
+// Whether data, or the peer closing the connection, is waiting to be read.
+bool common_hal_ssl_sslsocket_readable(ssl_sslsocket_obj_t *self);
+bool common_hal_ssl_sslsocket_writable(ssl_sslsocket_obj_t *self);
 bool common_hal_ssl_sslsocket_listen(ssl_sslsocket_obj_t *self, int backlog);
 mp_uint_t common_hal_ssl_sslsocket_recv_into(ssl_sslsocket_obj_t *self, uint8_t *buf, uint32_t len);
 mp_uint_t common_hal_ssl_sslsocket_send(ssl_sslsocket_obj_t *self, const uint8_t *buf, uint32_t len);
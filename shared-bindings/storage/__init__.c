@@ -29,6 +29,9 @@
 #include <string.h>
 
 #include "extmod/vfs_fat.h"
+#if MICROPY_VFS_LFS2
+#include "extmod/vfs_lfs.h"
+#endif
 #include "py/obj.h"
 #include "py/objnamedtuple.h"
 #include "py/runtime.h"
@@ -197,6 +200,77 @@ STATIC mp_obj_t storage_erase_filesystem(size_t n_args, const mp_obj_t *pos_args
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(storage_erase_filesystem_obj, 0, storage_erase_filesystem);
 
+#if CIRCUITPY_STORAGE_MMAP
+//| def mmap(path: str, *, defragment: bool = False) -> memoryview:
+//|     """Return a read-only `memoryview` of a file on ``CIRCUITPY``, read straight from
+//|     flash rather than copied into RAM. This suits large static data such as lookup
+//|     tables, fonts and images.
+//|
+//|     The file must occupy one contiguous run of clusters. Files copied onto an almost
+//|     empty drive usually do, but the drive fragments as files are changed and deleted.
+//|     Changing or deleting the file while the `memoryview` is in use leaves it showing
+//|     whatever is then at that place in flash.
+//|
+//|     :param str path: The file to map.
+//|     :param bool defragment: If the file is fragmented, rewrite it contiguously first.
+//|       This needs ``CIRCUITPY`` to be writable by CircuitPython and enough contiguous
+//|       free space for a copy of the file.
+//|
+//|     Raises `OSError` if the file is fragmented and ``defragment`` is False, or if
+//|     the file is not on flash that can be read directly.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t storage_mmap(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_path, ARG_defragment };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_path, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_defragment, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return common_hal_storage_mmap(mp_obj_str_get_str(args[ARG_path].u_obj), args[ARG_defragment].u_bool);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(storage_mmap_obj, 0, storage_mmap);
+#endif
+
+#if CIRCUITPY_STORAGE_STATS
+//| def stats(*, reset: bool = False) -> Dict[str, Tuple[int, int, int, int, Tuple[int, ...]]]:
+//|     """Return counts and timings of block operations since start up or the last reset.
+//|
+//|     The result maps each operation to
+//|     ``(count, blocks, total_us, max_us, histogram)``. ``histogram[0]`` counts
+//|     operations that took under 1 microsecond; ``histogram[i]`` counts those that
+//|     took from ``2**(i-1)`` to ``2**i - 1`` microseconds. The last bucket also
+//|     holds anything slower. The operations are:
+//|
+//|     * ``fs_read``, ``fs_write``, ``fs_sync``: block reads, writes and syncs by any
+//|       FAT filesystem, from Python or over USB.
+//|     * ``flash_read``, ``flash_write``, ``flash_flush``: the ``CIRCUITPY`` flash
+//|       underneath. Writes are usually absorbed by a cache, and a flush writes it back.
+//|
+//|     Timings have the resolution of the port's tick, typically about 30 microseconds.
+//|
+//|     :param bool reset: Zero the counters after reading them.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t storage_stats(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_reset, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return common_hal_storage_stats(args[ARG_reset].u_bool);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(storage_stats_obj, 0, storage_stats);
+#endif
+
 //| def disable_usb_drive() -> None:
 //|     """Disable presenting ``CIRCUITPY`` as a USB mass storage device.
 //|     By default, the device is enabled and ``CIRCUITPY`` is visible.
@@ -248,6 +322,12 @@ STATIC const mp_rom_map_elem_t storage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_remount),           MP_ROM_PTR(&storage_remount_obj) },
     { MP_ROM_QSTR(MP_QSTR_getmount),          MP_ROM_PTR(&storage_getmount_obj) },
     { MP_ROM_QSTR(MP_QSTR_erase_filesystem),  MP_ROM_PTR(&storage_erase_filesystem_obj) },
+    #if CIRCUITPY_STORAGE_MMAP
+    { MP_ROM_QSTR(MP_QSTR_mmap),              MP_ROM_PTR(&storage_mmap_obj) },
+    #endif
+    #if CIRCUITPY_STORAGE_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats),             MP_ROM_PTR(&storage_stats_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_disable_usb_drive), MP_ROM_PTR(&storage_disable_usb_drive_obj) },
     { MP_ROM_QSTR(MP_QSTR_enable_usb_drive),  MP_ROM_PTR(&storage_enable_usb_drive_obj) },
 
@@ -305,6 +385,59 @@ STATIC const mp_rom_map_elem_t storage_module_globals_table[] = {
 //|         ...
 //|
     { MP_ROM_QSTR(MP_QSTR_VfsFat), MP_ROM_PTR(&mp_fat_vfs_type) },
+
+    #if MICROPY_VFS_LFS2
+//| class VfsLfs:
+//|     """A LittleFS filesystem. It is only available on builds with ``CIRCUITPY_STORAGE_LFS``.
+//|
+//|     LittleFS copies changed data to new blocks before updating metadata, so a
+//|     filesystem interrupted by power loss mounts again with either the old or the new
+//|     contents of each file. It is used for extra block devices such as SD cards; the
+//|     CIRCUITPY drive is always `VfsFat`."""
+//|
+//|     def __init__(
+//|         self,
+//|         block_device: BlockDevice,
+//|         *,
+//|         readsize: int = 32,
+//|         progsize: int = 32,
+//|         lookahead: int = 32,
+//|         cachesize: int = 0,
+//|         mtime: bool = True
+//|     ) -> None:
+//|         """Create a new VfsLfs filesystem around the given block device.
+//|
+//|         :param block_device: Block device the the filesystem lives on
+//|         :param int readsize: Smallest read the filesystem makes, in bytes
+//|         :param int progsize: Smallest write the filesystem makes, in bytes
+//|         :param int lookahead: Size of the block allocation bitmap, in bytes
+//|         :param int cachesize: Size of each read, program and file cache, in bytes.
+//|           It must be a multiple of ``readsize`` and ``progsize`` and divide the block
+//|           size. Larger caches mean fewer, larger block device accesses at the cost of RAM.
+//|           0 picks four times the larger of ``readsize`` and ``progsize``.
+//|         :param bool mtime: Store a modification time with each file"""
+//|         ...
+//|
+//|     @staticmethod
+//|     def mkfs(
+//|         block_device: BlockDevice,
+//|         *,
+//|         readsize: int = 32,
+//|         progsize: int = 32,
+//|         lookahead: int = 32,
+//|         cachesize: int = 0
+//|     ) -> None:
+//|         """Format the block device as LittleFS, deleting any data that may have been there."""
+//|         ...
+//|     def mount(self, readonly: bool, mkfs: VfsLfs) -> None:
+//|         """Don't call this directly, call `storage.mount`."""
+//|         ...
+//|     def umount(self) -> None:
+//|         """Don't call this directly, call `storage.umount`."""
+//|         ...
+//|
+    { MP_ROM_QSTR(MP_QSTR_VfsLfs), MP_ROM_PTR(&mp_type_vfs_lfs2) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(storage_module_globals, storage_module_globals_table);
@@ -0,0 +1,280 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+#include "supervisor/shared/translate/translate.h"
+
+//| class Struct:
+//|     """A compiled struct format
+//|
+//|     The format string is parsed once, when the object is created, so
+//|     repeated packing and unpacking with the same format is faster than
+//|     calling the module-level functions."""
+//|
+//|     def __init__(self, format: str) -> None:
+//|         """Compile *format*, which uses the same codes as `struct.pack`."""
+//|         ...
+STATIC mp_obj_t struct_struct_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_format };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_format, MP_ARG_OBJ | MP_ARG_REQUIRED },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    struct_struct_obj_t *self = m_new_obj(struct_struct_obj_t);
+    self->base.type = &struct_struct_type;
+    common_hal_struct_struct_construct(self, args[ARG_format].u_obj);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Return a pointer to a whole record at offset, which may be negative to
+// count from the end of the buffer.
+STATIC byte *struct_struct_get_record(struct_struct_obj_t *self, mp_buffer_info_t *bufinfo, mp_int_t offset) {
+    if (offset < 0) {
+        offset = (mp_int_t)bufinfo->len + offset;
+    }
+    if (offset < 0 || (mp_uint_t)offset + common_hal_struct_struct_get_size(self) > bufinfo->len) {
+        mp_raise_RuntimeError(translate("buffer too small"));
+    }
+    return (byte *)bufinfo->buf + offset;
+}
+
+//|     format: str
+//|     """The format string used to create this object. (read-only)"""
+STATIC mp_obj_t struct_struct_get_format(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_struct_struct_get_format(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_format_obj, struct_struct_get_format);
+
+MP_PROPERTY_GETTER(struct_struct_format_obj,
+    (mp_obj_t)&struct_struct_get_format_obj);
+
+//|     size: int
+//|     """The number of bytes in one packed record, as returned by `struct.calcsize`. (read-only)"""
+STATIC mp_obj_t struct_struct_get_size(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_struct_struct_get_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_size_obj, struct_struct_get_size);
+
+MP_PROPERTY_GETTER(struct_struct_size_obj,
+    (mp_obj_t)&struct_struct_get_size_obj);
+
+//|     def pack(self, *values: Any) -> bytes:
+//|         """Pack the values according to the format.
+//|         The return value is a bytes object encoding the values."""
+//|         ...
+STATIC mp_obj_t struct_struct_pack(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_uint_t size = common_hal_struct_struct_get_size(self);
+    vstr_t vstr;
+    vstr_init_len(&vstr, size);
+    memset(vstr.buf, 0, size);
+    common_hal_struct_struct_pack_into(self, (byte *)vstr.buf, n_args - 1, &args[1]);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack);
+
+//|     def pack_into(self, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
+//|         """Pack the values according to the format into a buffer
+//|         starting at offset. offset may be negative to count from the end of buffer."""
+//|         ...
+STATIC mp_obj_t struct_struct_pack_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+    byte *p = struct_struct_get_record(self, &bufinfo, mp_obj_get_int(args[2]));
+    common_hal_struct_struct_pack_into(self, p, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack_into);
+
+//|     def unpack(self, data: ReadableBuffer) -> Tuple[Any, ...]:
+//|         """Unpack from the data according to the format. The return value
+//|         is a tuple of the unpacked values. The buffer size must match `size`."""
+//|         ...
+STATIC mp_obj_t struct_struct_unpack(mp_obj_t self_in, mp_obj_t data_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len != common_hal_struct_struct_get_size(self)) {
+        mp_raise_RuntimeError(translate("buffer size must match format"));
+    }
+    return common_hal_struct_struct_unpack(self, bufinfo.buf);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_unpack_obj, struct_struct_unpack);
+
+//|     def unpack_from(self, data: ReadableBuffer, offset: int = 0) -> Tuple[Any, ...]:
+//|         """Unpack from the data starting at offset according to the format.
+//|         offset may be negative to count from the end of buffer. The buffer
+//|         must hold at least `size` bytes after offset."""
+//|         ...
+STATIC mp_obj_t struct_struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    byte *p = struct_struct_get_record(self, &bufinfo, args[ARG_offset].u_int);
+    return common_hal_struct_struct_unpack(self, p);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_from_obj, 1, struct_struct_unpack_from);
+
+typedef struct {
+    mp_obj_base_t base;
+    struct_struct_obj_t *s;
+    mp_obj_t buffer;
+    size_t offset;
+} struct_iter_unpack_obj_t;
+
+STATIC mp_obj_t struct_iter_unpack_iternext(mp_obj_t self_in) {
+    struct_iter_unpack_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Look the buffer up again each time in case it was resized.
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->buffer, &bufinfo, MP_BUFFER_READ);
+    mp_uint_t size = common_hal_struct_struct_get_size(self->s);
+    if (self->offset + size > bufinfo.len) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    mp_obj_t result = common_hal_struct_struct_unpack(self->s, (byte *)bufinfo.buf + self->offset);
+    self->offset += size;
+    return result;
+}
+
+STATIC const mp_obj_type_t struct_iter_unpack_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_iterator,
+    MP_TYPE_EXTENDED_FIELDS(
+        .getiter = mp_identity_getiter,
+        .iternext = struct_iter_unpack_iternext,
+        ),
+};
+
+mp_obj_t struct_struct_iter_unpack(struct_struct_obj_t *self, mp_obj_t buffer) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    mp_uint_t size = common_hal_struct_struct_get_size(self);
+    if (size == 0 || bufinfo.len % size != 0) {
+        mp_raise_RuntimeError(translate("buffer size must match format"));
+    }
+    struct_iter_unpack_obj_t *iter = m_new_obj(struct_iter_unpack_obj_t);
+    iter->base.type = &struct_iter_unpack_type;
+    iter->s = self;
+    iter->buffer = buffer;
+    iter->offset = 0;
+    return MP_OBJ_FROM_PTR(iter);
+}
+
+//|     def iter_unpack(self, data: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|         """Return an iterator which unpacks one record of `size` bytes at a time
+//|         from data. The buffer size must be a multiple of `size`."""
+//|         ...
+STATIC mp_obj_t struct_struct_iter_unpack_meth(mp_obj_t self_in, mp_obj_t data_in) {
+    return struct_struct_iter_unpack(MP_OBJ_TO_PTR(self_in), data_in);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_iter_unpack_obj, struct_struct_iter_unpack_meth);
+
+#if MICROPY_PY_ARRAY
+//|     def unpack_from_array(self, data: ReadableBuffer, offset: int = 0, count: int = -1) -> Tuple[array.array, ...]:
+//|         """Unpack *count* consecutive records starting at offset, returning one
+//|         `array.array` per field. Each array has the typecode of its field, so
+//|         the values are stored without creating an object per field.
+//|
+//|         If *count* is negative, unpack as many whole records as the buffer
+//|         holds. The format may not contain ``s`` fields.
+//|
+//|         For example, ``Struct("<hh").unpack_from_array(samples)`` splits
+//|         interleaved stereo samples into a left and a right array."""
+//|         ...
+//|
+STATIC mp_obj_t struct_struct_unpack_from_array(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset, ARG_count };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_count, MP_ARG_INT, {.u_int = -1} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+
+    mp_int_t offset = args[ARG_offset].u_int;
+    if (offset < 0) {
+        offset = (mp_int_t)bufinfo.len + offset;
+    }
+    if (offset < 0 || (size_t)offset > bufinfo.len) {
+        mp_raise_RuntimeError(translate("buffer too small"));
+    }
+    size_t avail = bufinfo.len - offset;
+    mp_uint_t size = common_hal_struct_struct_get_size(self);
+    mp_int_t count = args[ARG_count].u_int;
+    if (count < 0) {
+        count = size ? avail / size : 0;
+    } else if (size && (size_t)count > avail / size) {
+        mp_raise_RuntimeError(translate("buffer too small"));
+    }
+    return common_hal_struct_struct_unpack_from_array(self, (byte *)bufinfo.buf + offset, count);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_from_array_obj, 1, struct_struct_unpack_from_array);
+#endif
+
+STATIC const mp_rom_map_elem_t struct_struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_struct_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_struct_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_struct_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_struct_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_struct_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_struct_iter_unpack_obj) },
+    #if MICROPY_PY_ARRAY
+    { MP_ROM_QSTR(MP_QSTR_unpack_from_array), MP_ROM_PTR(&struct_struct_unpack_from_array_obj) },
+    #endif
+};
+STATIC MP_DEFINE_CONST_DICT(struct_struct_locals_dict, struct_struct_locals_dict_table);
+
+const mp_obj_type_t struct_struct_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Struct,
+    .make_new = struct_struct_make_new,
+    .locals_dict = (mp_obj_dict_t *)&struct_struct_locals_dict,
+};
@@ -0,0 +1,42 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-module/struct/Struct.h"
+
+extern const mp_obj_type_t struct_struct_type;
+
+void common_hal_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t fmt_in);
+mp_obj_t common_hal_struct_struct_get_format(struct_struct_obj_t *self);
+mp_uint_t common_hal_struct_struct_get_size(struct_struct_obj_t *self);
+void common_hal_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args);
+void common_hal_struct_struct_unpack_into(struct_struct_obj_t *self, byte *p, mp_obj_t *items);
+mp_obj_t common_hal_struct_struct_unpack(struct_struct_obj_t *self, byte *p);
+mp_obj_t common_hal_struct_struct_unpack_from_array(struct_struct_obj_t *self, const byte *p, size_t count);
+
+// Used by struct.iter_unpack() as well as Struct.iter_unpack().
+mp_obj_t struct_struct_iter_unpack(struct_struct_obj_t *self, mp_obj_t buffer);
@@ -35,6 +35,7 @@
 #include "py/binary.h"
 #include "py/parsenum.h"
 #include "shared-bindings/struct/__init__.h"
+#include "shared-bindings/struct/Struct.h"
 #include "shared-module/struct/__init__.h"
 #include "supervisor/shared/translate/translate.h"
 
@@ -162,6 +163,21 @@ STATIC mp_obj_t struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_m
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(struct_unpack_from_obj, 0, struct_unpack_from);
 
+//| def iter_unpack(fmt: str, data: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|     """Return an iterator which unpacks one record at a time from data
+//|     according to the format string fmt. The buffer size must be a multiple
+//|     of the size required by the format."""
+//|     ...
+//|
+
+STATIC mp_obj_t struct_iter_unpack(mp_obj_t fmt_in, mp_obj_t data_in) {
+    struct_struct_obj_t *s = m_new_obj(struct_struct_obj_t);
+    s->base.type = &struct_struct_type;
+    common_hal_struct_struct_construct(s, fmt_in);
+    return struct_struct_iter_unpack(s, data_in);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_iter_unpack_obj, struct_iter_unpack);
+
 STATIC const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_struct) },
     { MP_ROM_QSTR(MP_QSTR_calcsize), MP_ROM_PTR(&struct_calcsize_obj) },
@@ -169,6 +185,8 @@ STATIC const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_pack_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_unpack_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_iter_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Struct), MP_ROM_PTR(&struct_struct_type) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_struct_globals, mp_module_struct_globals_table);
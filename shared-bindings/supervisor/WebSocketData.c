@@ -0,0 +1,180 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/supervisor/WebSocketData.h"
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#if CIRCUITPY_WEB_WORKFLOW
+#include "supervisor/shared/web_workflow/websocket.h"
+
+//| class WebSocketData:
+//|     """Binary data exchanged with the web workflow's serial websocket, separate
+//|     from the text console. A browser sends and receives this data as binary
+//|     websocket messages on the same ``/cp/serial/`` connection. Reads never wait;
+//|     they return only the bytes that have already arrived."""
+//|
+//|     def __init__(self) -> None:
+//|         """You cannot create an instance of `supervisor.WebSocketData`.
+//|         Use `supervisor.websocket_data` to access the sole instance available."""
+//|         ...
+//|     def read(self, size: int = -1) -> bytes:
+//|         """Read at most ``size`` bytes that have already arrived.
+//|
+//|         :return: Data read
+//|         :rtype: bytes"""
+//|         ...
+//|     def readinto(self, buf: WriteableBuffer) -> int:
+//|         """Read at most ``len(buf)`` bytes that have already arrived into ``buf``.
+//|
+//|         :return: number of bytes read and stored into ``buf``
+//|         :rtype: int"""
+//|         ...
+//|     def readline(self, size: int = -1) -> Optional[bytes]:
+//|         r"""Read a line ending in a newline character ("\\n"), including the newline.
+//|         Return everything available if there is no newline yet.
+//|
+//|         :return: the line read
+//|         :rtype: bytes or None"""
+//|         ...
+//|     def write(self, buf: ReadableBuffer) -> int:
+//|         """Send ``buf`` to the browser as one binary message. Nothing is sent when
+//|         no browser is connected.
+//|
+//|         :return: the number of bytes written
+//|         :rtype: int"""
+//|         ...
+STATIC mp_uint_t supervisor_websocket_data_read_stream(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
+    // make sure we want at least 1 char
+    if (size == 0) {
+        return 0;
+    }
+    return websocket_data_read(buf_in, size);
+}
+
+STATIC mp_uint_t supervisor_websocket_data_write_stream(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
+    // The caller's buffer goes straight to the socket.
+    websocket_data_write(buf_in, size);
+    return size;
+}
+
+STATIC mp_uint_t supervisor_websocket_data_ioctl_stream(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    mp_uint_t ret = 0;
+    switch (request) {
+        case MP_STREAM_POLL: {
+            mp_uint_t flags = arg;
+            ret = 0;
+            if ((flags & MP_STREAM_POLL_RD) && websocket_data_available() > 0) {
+                ret |= MP_STREAM_POLL_RD;
+            }
+            if (flags & MP_STREAM_POLL_WR) {
+                ret |= MP_STREAM_POLL_WR;
+            }
+            break;
+        }
+
+        case MP_STREAM_FLUSH:
+            break;
+
+        default:
+            *errcode = MP_EINVAL;
+            ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
+//|     connected: bool
+//|     """True if a browser is connected to the serial websocket. (read-only)"""
+STATIC mp_obj_t supervisor_websocket_data_get_connected(mp_obj_t self_in) {
+    return mp_obj_new_bool(websocket_connected());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_websocket_data_get_connected_obj, supervisor_websocket_data_get_connected);
+
+MP_PROPERTY_GETTER(supervisor_websocket_data_connected_obj,
+    (mp_obj_t)&supervisor_websocket_data_get_connected_obj);
+
+//|     in_waiting: int
+//|     """Returns the number of bytes waiting to be read. (read-only)"""
+STATIC mp_obj_t supervisor_websocket_data_get_in_waiting(mp_obj_t self_in) {
+    return mp_obj_new_int(websocket_data_available());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_websocket_data_get_in_waiting_obj, supervisor_websocket_data_get_in_waiting);
+
+MP_PROPERTY_GETTER(supervisor_websocket_data_in_waiting_obj,
+    (mp_obj_t)&supervisor_websocket_data_get_in_waiting_obj);
+
+//|     def reset_input_buffer(self) -> None:
+//|         """Clears any unread bytes."""
+//|         ...
+//|
+STATIC mp_obj_t supervisor_websocket_data_reset_input_buffer(mp_obj_t self_in) {
+    websocket_data_clear();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_websocket_data_reset_input_buffer_obj, supervisor_websocket_data_reset_input_buffer);
+
+STATIC const mp_rom_map_elem_t supervisor_websocket_data_locals_dict_table[] = {
+    // Standard stream methods.
+    { MP_ROM_QSTR(MP_QSTR_flush),        MP_ROM_PTR(&mp_stream_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read),         MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto),     MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readline),     MP_ROM_PTR(&mp_stream_unbuffered_readline_obj)},
+    { MP_ROM_QSTR(MP_QSTR_write),        MP_ROM_PTR(&mp_stream_write_obj) },
+
+    // Other pyserial-inspired attributes.
+    { MP_ROM_QSTR(MP_QSTR_connected),           MP_ROM_PTR(&supervisor_websocket_data_connected_obj) },
+    { MP_ROM_QSTR(MP_QSTR_in_waiting),          MP_ROM_PTR(&supervisor_websocket_data_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset_input_buffer),  MP_ROM_PTR(&supervisor_websocket_data_reset_input_buffer_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(supervisor_websocket_data_locals_dict, supervisor_websocket_data_locals_dict_table);
+
+STATIC const mp_stream_p_t supervisor_websocket_data_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .read = supervisor_websocket_data_read_stream,
+    .write = supervisor_websocket_data_write_stream,
+    .ioctl = supervisor_websocket_data_ioctl_stream,
+    .is_text = false,
+    .pyserial_read_compatibility = true,
+    .pyserial_readinto_compatibility = true,
+    .pyserial_dont_return_none_compatibility = true,
+};
+
+const mp_obj_type_t supervisor_websocket_data_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_WebSocketData,
+    .locals_dict = (mp_obj_dict_t *)&supervisor_websocket_data_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .protocol = &supervisor_websocket_data_stream_p,
+        ),
+};
+
+const mp_obj_base_t supervisor_websocket_data_obj = {
+    .type = &supervisor_websocket_data_type,
+};
+#endif
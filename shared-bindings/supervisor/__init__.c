@@ -28,13 +28,20 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 #include "py/objstr.h"
+#include "py/stream.h"
 
 #include "shared/runtime/interrupt_char.h"
+#include "supervisor/background_callback.h"
+#include "supervisor/memory.h"
+#include "supervisor/shared/cpu.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/reload.h"
 #include "supervisor/shared/traceback.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate/translate.h"
 #include "supervisor/shared/workflow.h"
+#include "supervisor/profile.h"
+#include "supervisor/trace.h"
 
 #if CIRCUITPY_USB_IDENTIFICATION
 #include "supervisor/usb.h"
@@ -45,6 +52,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-bindings/supervisor/Runtime.h"
 #include "shared-bindings/supervisor/StatusBar.h"
+#include "shared-bindings/supervisor/WebSocketData.h"
 
 //| """Supervisor settings"""
 
@@ -59,6 +67,11 @@
 //| The status bar reports the current IP or BLE connection, what file is running,
 //| the last exception name and location, and firmware version information.
 //| This object is the sole instance of `supervisor.StatusBar`."""
+
+//| websocket_data: WebSocketData
+//| """Binary data exchanged with a browser over the web workflow's serial websocket.
+//| Only available when the web workflow is enabled.
+//| This object is the sole instance of `supervisor.WebSocketData`."""
 //|
 
 //| def reload() -> None:
@@ -331,6 +344,214 @@ STATIC mp_obj_t supervisor_set_usb_identification(size_t n_args, const mp_obj_t
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_set_usb_identification_obj, 0, supervisor_set_usb_identification);
 
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+//| def background_callback_stats(*, reset: bool = False) -> Tuple[Tuple[int, int, int, int], ...]:
+//|     """Return how long each background callback function has run since start up
+//|     or the last reset, as ``(function_address, count, total_us, max_us)`` tuples.
+//|
+//|     Look the address up in the firmware's map file to find the function.
+//|     There are usually 16 entries at most. The last one also counts any
+//|     functions that did not get their own.
+//|
+//|     :param bool reset: Zero the counters after reading them.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t supervisor_background_callback_stats(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_reset, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return background_callback_stats(args[ARG_reset].u_bool);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_background_callback_stats_obj, 0, supervisor_background_callback_stats);
+#endif
+
+#if CIRCUITPY_CPU_GOVERNOR
+//| def cpu_residency(*, reset: bool = False) -> Tuple[int, int]:
+//|     """Return how the time since start up or the last reset was split
+//|     between CPU speeds, as ``(low_ms, high_ms)``.
+//|
+//|     The CPU runs slow while the supervisor waits for an interrupt and no
+//|     display refresh or network handshake is in progress. It runs at full
+//|     speed the rest of the time. On ports that cannot change speed safely,
+//|     ``low_ms`` is the time that could have been spent slow.
+//|
+//|     :param bool reset: Zero the counters after reading them.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t supervisor_cpu_residency(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_reset, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return cpu_governor_stats_get(args[ARG_reset].u_bool);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_cpu_residency_obj, 0, supervisor_cpu_residency);
+#endif
+
+#if CIRCUITPY_POWER_STATS
+//| def power_stats(*, reset: bool = False) -> Tuple[int, int, int]:
+//|     """Return how the time since start up or the last reset was spent, as
+//|     ``(active_ms, idle_ms, sleep_ms)``.
+//|
+//|     ``idle_ms`` is time the VM spent waiting in `time.sleep()` or `select`.
+//|     ``sleep_ms`` is time spent waiting with no code running, such as after
+//|     ``code.py`` finishes or while pretending to deep sleep. Both wait for an
+//|     interrupt in the port's low power idle state. ``active_ms`` is the rest.
+//|
+//|     :param bool reset: Zero the counters after reading them.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t supervisor_power_stats(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_reset, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return supervisor_power_stats_get(args[ARG_reset].u_bool);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_power_stats_obj, 0, supervisor_power_stats);
+#endif
+
+#if CIRCUITPY_SUPERVISOR_MEMORY_INFO
+//| def memory_info() -> Tuple[int, int]:
+//|     """Return ``(free_bytes, largest_free)`` for the memory the supervisor keeps
+//|     outside the VM heap for displays, USB descriptors and similar buffers.
+//|
+//|     ``largest_free`` is the biggest buffer that would fit now. While code is
+//|     running, the free bytes are left over from buffers that were freed, so
+//|     ``1 - largest_free / free_bytes`` shows how fragmented they are. Movable
+//|     buffers are compacted after each reload.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t supervisor_memory_info_fun(void) {
+    size_t free_bytes, largest_free;
+    supervisor_memory_info(&free_bytes, &largest_free);
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(free_bytes),
+        mp_obj_new_int_from_uint(largest_free),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_memory_info_obj, supervisor_memory_info_fun);
+#endif
+
+#if CIRCUITPY_PROFILE
+//| def profile_start(*, max_stacks: int = 128) -> None:
+//|     """Start sampling which Python code is running, about 1000 times a second.
+//|
+//|     Each sample records the running functions, innermost first and usually up
+//|     to eight deep, and the line being run in the innermost one. Samples of the
+//|     same stack are counted together. The time is wall clock time, so time spent
+//|     in `time.sleep()` or waiting on hardware is charged to the line that waited.
+//|
+//|     Any previous results are discarded. Profiling stops when the VM exits.
+//|
+//|     :param int max_stacks: How many different stacks to count. Samples of new
+//|       stacks are counted as ``[dropped]`` once this many have been seen. Each
+//|       takes about 44 bytes of the heap.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t supervisor_profile_start_fun(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_max_stacks };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_max_stacks, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 128} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    supervisor_profile_start(mp_arg_validate_int_min(args[ARG_max_stacks].u_int, 1, MP_QSTR_max_stacks));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_profile_start_obj, 0, supervisor_profile_start_fun);
+
+//| def profile_stop(file: Optional[typing.TextIO] = None) -> None:
+//|     """Stop sampling and write the results as folded stacks.
+//|
+//|     Each line lists the functions of one stack, outermost first and separated
+//|     by ``;``, followed by a space and the number of samples, as in
+//|     ``<module> (code.py);loop (code.py:12) 87``. Samples taken while no Python
+//|     code was running are counted as ``[idle]``. Pass the output to
+//|     ``flamegraph.pl`` or open it in https://www.speedscope.app.
+//|
+//|     The results are kept until the next `profile_start()`, so they can be
+//|     written more than once.
+//|
+//|     :param file: Where to write the results, such as a file opened with ``open(..., "w")``.
+//|       The default is the serial console.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t supervisor_profile_stop_fun(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0 || args[0] == mp_const_none) {
+        supervisor_profile_stop(&mp_plat_print);
+    } else {
+        mp_get_stream_raise(args[0], MP_STREAM_OP_WRITE);
+        mp_print_t print = {MP_OBJ_TO_PTR(args[0]), mp_stream_write_adaptor};
+        supervisor_profile_stop(&print);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(supervisor_profile_stop_obj, 0, 1, supervisor_profile_stop_fun);
+#endif
+
+#if CIRCUITPY_TRACE
+//| def trace(file: Optional[typing.TextIO] = None, *, reset: bool = True) -> None:
+//|     """Write the recent background task events in Chrome trace event format.
+//|
+//|     The trace covers ``port_background_task()``, the USB and web workflow
+//|     background work and each background callback, which is identified by its
+//|     function address. It also marks each time the VM went more than a
+//|     millisecond without checking for background tasks. Open the output in
+//|     ``chrome://tracing`` or https://ui.perfetto.dev.
+//|
+//|     Only the most recent events are kept, usually 256.
+//|
+//|     :param file: Where to write the JSON, such as a file opened with ``open(..., "w")``.
+//|       The default is the serial console.
+//|     :param bool reset: Discard the events after writing them.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t supervisor_trace(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_reset, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (args[ARG_file].u_obj == mp_const_none) {
+        supervisor_trace_dump(&mp_plat_print, args[ARG_reset].u_bool);
+    } else {
+        mp_get_stream_raise(args[ARG_file].u_obj, MP_STREAM_OP_WRITE);
+        mp_print_t print = {MP_OBJ_TO_PTR(args[ARG_file].u_obj), mp_stream_write_adaptor};
+        supervisor_trace_dump(&print, args[ARG_reset].u_bool);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_trace_obj, 0, supervisor_trace);
+#endif
+
 STATIC const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_supervisor) },
     { MP_ROM_QSTR(MP_QSTR_runtime),  MP_ROM_PTR(&common_hal_supervisor_runtime_obj) },
@@ -347,6 +568,28 @@ STATIC const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_reset_terminal),  MP_ROM_PTR(&supervisor_reset_terminal_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_usb_identification),  MP_ROM_PTR(&supervisor_set_usb_identification_obj) },
     { MP_ROM_QSTR(MP_QSTR_status_bar),  MP_ROM_PTR(&shared_module_supervisor_status_bar_obj) },
+    #if CIRCUITPY_WEB_WORKFLOW
+    { MP_ROM_QSTR(MP_QSTR_websocket_data),  MP_ROM_PTR(&supervisor_websocket_data_obj) },
+    #endif
+    #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+    { MP_ROM_QSTR(MP_QSTR_background_callback_stats),  MP_ROM_PTR(&supervisor_background_callback_stats_obj) },
+    #endif
+    #if CIRCUITPY_CPU_GOVERNOR
+    { MP_ROM_QSTR(MP_QSTR_cpu_residency),  MP_ROM_PTR(&supervisor_cpu_residency_obj) },
+    #endif
+    #if CIRCUITPY_POWER_STATS
+    { MP_ROM_QSTR(MP_QSTR_power_stats),  MP_ROM_PTR(&supervisor_power_stats_obj) },
+    #endif
+    #if CIRCUITPY_SUPERVISOR_MEMORY_INFO
+    { MP_ROM_QSTR(MP_QSTR_memory_info),  MP_ROM_PTR(&supervisor_memory_info_obj) },
+    #endif
+    #if CIRCUITPY_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_profile_start),  MP_ROM_PTR(&supervisor_profile_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_stop),  MP_ROM_PTR(&supervisor_profile_stop_obj) },
+    #endif
+    #if CIRCUITPY_TRACE
+    { MP_ROM_QSTR(MP_QSTR_trace),  MP_ROM_PTR(&supervisor_trace_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(supervisor_module_globals, supervisor_module_globals_table);
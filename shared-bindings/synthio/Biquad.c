@@ -0,0 +1,188 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/enum.h"
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/synthio/Biquad.h"
+#include "shared-module/synthio/Biquad.h"
+
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, LOW_PASS, SYNTHIO_LOW_PASS);
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, HIGH_PASS, SYNTHIO_HIGH_PASS);
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, BAND_PASS, SYNTHIO_BAND_PASS);
+
+//| class FilterMode:
+//|     """The type of response of a `Biquad` filter"""
+//|
+//|     LOW_PASS: FilterMode
+//|     """Passes frequencies below the cutoff frequency, and attenuates those above it"""
+//|
+//|     HIGH_PASS: FilterMode
+//|     """Passes frequencies above the cutoff frequency, and attenuates those below it"""
+//|
+//|     BAND_PASS: FilterMode
+//|     """Passes frequencies near the center frequency, and attenuates those further from it. The peak gain is 0dB."""
+//|
+MAKE_ENUM_MAP(synthio_filter_mode) {
+    MAKE_ENUM_MAP_ENTRY(filter_mode, LOW_PASS),
+    MAKE_ENUM_MAP_ENTRY(filter_mode, HIGH_PASS),
+    MAKE_ENUM_MAP_ENTRY(filter_mode, BAND_PASS),
+};
+
+STATIC MP_DEFINE_CONST_DICT(synthio_filter_mode_locals_dict, synthio_filter_mode_locals_table);
+
+MAKE_PRINTER(synthio, synthio_filter_mode);
+
+MAKE_ENUM_TYPE(synthio, FilterMode, synthio_filter_mode);
+
+//| class Biquad:
+//|     """A second order IIR ("biquad") filter for a single `Note`
+//|
+//|     Assign a Biquad to `Note.filter` to filter that note on its own,
+//|     instead of with the synthesizer's FIR filter. Each note that uses
+//|     the Biquad keeps its own filter state, so one Biquad can be shared by
+//|     any number of notes.
+//|
+//|     The frequency and Q may be `LFO` or `Math` blocks. The filter
+//|     coefficients are recalculated once every 256 samples, and only when
+//|     the frequency or Q has changed, so a resonant sweep costs little more
+//|     than a fixed filter. This should be considered an implementation
+//|     detail.
+//|     """
+//|
+//|     def __init__(
+//|         self,
+//|         mode: FilterMode,
+//|         frequency: BlockInput,
+//|         Q: BlockInput = 0.7071067811865475,
+//|     ):
+//|         """Construct a Biquad filter
+//|
+//|         :param FilterMode mode: The type of filter
+//|         :param BlockInput frequency: The cutoff (or center) frequency in Hz. It is limited to be below the Nyquist frequency.
+//|         :param BlockInput Q: The quality factor. Higher values give a sharper, more resonant response. It is limited to the range 0.05 to 40.
+//|         """
+static const mp_arg_t biquad_properties[] = {
+    { MP_QSTR_mode, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = NULL } },
+    { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = NULL } },
+    { MP_QSTR_Q, MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL } },
+};
+
+STATIC mp_obj_t synthio_biquad_make_new(const mp_obj_type_t *type_in, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_mode, ARG_frequency, ARG_Q };
+    mp_arg_val_t args[MP_ARRAY_SIZE(biquad_properties)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(biquad_properties), biquad_properties, args);
+
+    if (args[ARG_Q].u_obj == MP_OBJ_NULL) {
+        // Butterworth response
+        args[ARG_Q].u_obj = mp_obj_new_float(MICROPY_FLOAT_CONST(0.7071067811865475));
+    }
+
+    synthio_biquad_obj_t *self = m_new_obj(synthio_biquad_obj_t);
+    self->base.type = &synthio_biquad_type;
+
+    mp_obj_t result = MP_OBJ_FROM_PTR(self);
+    properties_construct_helper(result, biquad_properties, args, MP_ARRAY_SIZE(biquad_properties));
+
+    return result;
+};
+
+//|     mode: FilterMode
+//|     """The type of filter"""
+STATIC mp_obj_t synthio_biquad_get_mode(mp_obj_t self_in) {
+    synthio_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return cp_enum_find(&synthio_filter_mode_type, common_hal_synthio_biquad_get_mode(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_biquad_get_mode_obj, synthio_biquad_get_mode);
+
+STATIC mp_obj_t synthio_biquad_set_mode(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_biquad_set_mode(self, cp_enum_value(&synthio_filter_mode_type, arg, MP_QSTR_mode));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_biquad_set_mode_obj, synthio_biquad_set_mode);
+MP_PROPERTY_GETSET(synthio_biquad_mode_obj,
+    (mp_obj_t)&synthio_biquad_get_mode_obj,
+    (mp_obj_t)&synthio_biquad_set_mode_obj);
+
+//|     frequency: BlockInput
+//|     """The cutoff (or center) frequency in Hz"""
+STATIC mp_obj_t synthio_biquad_get_frequency(mp_obj_t self_in) {
+    synthio_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_biquad_get_frequency(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_biquad_get_frequency_obj, synthio_biquad_get_frequency);
+
+STATIC mp_obj_t synthio_biquad_set_frequency(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_biquad_set_frequency(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_biquad_set_frequency_obj, synthio_biquad_set_frequency);
+MP_PROPERTY_GETSET(synthio_biquad_frequency_obj,
+    (mp_obj_t)&synthio_biquad_get_frequency_obj,
+    (mp_obj_t)&synthio_biquad_set_frequency_obj);
+
+//|     Q: BlockInput
+//|     """The quality factor of the filter"""
+//|
+STATIC mp_obj_t synthio_biquad_get_Q(mp_obj_t self_in) {
+    synthio_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_biquad_get_Q(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_biquad_get_Q_obj, synthio_biquad_get_Q);
+
+STATIC mp_obj_t synthio_biquad_set_Q(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_biquad_set_Q(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_biquad_set_Q_obj, synthio_biquad_set_Q);
+MP_PROPERTY_GETSET(synthio_biquad_Q_obj,
+    (mp_obj_t)&synthio_biquad_get_Q_obj,
+    (mp_obj_t)&synthio_biquad_set_Q_obj);
+
+static void biquad_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    properties_print_helper(print, self_in, biquad_properties, MP_ARRAY_SIZE(biquad_properties));
+}
+
+STATIC const mp_rom_map_elem_t synthio_biquad_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_mode), MP_ROM_PTR(&synthio_biquad_mode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&synthio_biquad_frequency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Q), MP_ROM_PTR(&synthio_biquad_Q_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(synthio_biquad_locals_dict, synthio_biquad_locals_dict_table);
+
+const mp_obj_type_t synthio_biquad_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Biquad,
+    .make_new = synthio_biquad_make_new,
+    .locals_dict = (mp_obj_dict_t *)&synthio_biquad_locals_dict,
+    .print = biquad_print,
+};
@@ -0,0 +1,48 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef enum {
+    SYNTHIO_LOW_PASS,
+    SYNTHIO_HIGH_PASS,
+    SYNTHIO_BAND_PASS
+} synthio_filter_mode_t;
+
+typedef struct synthio_biquad_obj synthio_biquad_obj_t;
+extern const mp_obj_type_t synthio_biquad_type;
+extern const mp_obj_type_t synthio_filter_mode_type;
+
+synthio_filter_mode_t common_hal_synthio_biquad_get_mode(synthio_biquad_obj_t *self);
+void common_hal_synthio_biquad_set_mode(synthio_biquad_obj_t *self, synthio_filter_mode_t arg);
+
+mp_obj_t common_hal_synthio_biquad_get_frequency(synthio_biquad_obj_t *self);
+void common_hal_synthio_biquad_set_frequency(synthio_biquad_obj_t *self, mp_obj_t arg);
+
+mp_obj_t common_hal_synthio_biquad_get_Q(synthio_biquad_obj_t *self);
+void common_hal_synthio_biquad_set_Q(synthio_biquad_obj_t *self, mp_obj_t arg);
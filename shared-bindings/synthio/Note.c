@@ -45,6 +45,10 @@ static const mp_arg_t note_properties[] = {
     { MP_QSTR_ring_frequency, MP_ARG_OBJ, {.u_obj = MP_ROM_INT(0) } },
     { MP_QSTR_ring_bend, MP_ARG_OBJ, {.u_obj = MP_ROM_INT(0) } },
     { MP_QSTR_ring_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
+    { MP_QSTR_waveform_loop_start, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
+    { MP_QSTR_waveform_loop_end, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(SYNTHIO_WAVEFORM_MAX_LENGTH) } },
+    { MP_QSTR_waveform_frames, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(1) } },
+    { MP_QSTR_morph, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
 };
 //| class Note:
 //|     def __init__(
@@ -59,11 +63,21 @@ static const mp_arg_t note_properties[] = {
 //|         ring_frequency: float = 0.0,
 //|         ring_bend: float = 0.0,
 //|         ring_waveform: Optional[ReadableBuffer] = 0.0,
+//|         waveform_loop_start: int = 0,
+//|         waveform_loop_end: int = 16384,
+//|         waveform_frames: int = 1,
+//|         morph: BlockInput = 0.0,
 //|     ) -> None:
 //|         """Construct a Note object, with a frequency in Hz, and optional panning, waveform, envelope, tremolo (volume change) and bend (frequency change).
 //|
 //|         If waveform or envelope are `None` the synthesizer object's default waveform or envelope are used.
 //|
+//|         A waveform can also be a recorded sample: the note plays it from the
+//|         beginning once, and then repeats the part between ``waveform_loop_start``
+//|         and ``waveform_loop_end`` for as long as it sounds. It can also be a
+//|         wavetable of ``waveform_frames`` equal length waveforms, which ``morph``
+//|         blends between.
+//|
 //|         If the same Note object is played on multiple Synthesizer objects, the result is undefined.
 //|         """
 STATIC mp_obj_t synthio_note_make_new(const mp_obj_type_t *type_in, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
@@ -97,17 +111,17 @@ MP_PROPERTY_GETSET(synthio_note_frequency_obj,
     (mp_obj_t)&synthio_note_get_frequency_obj,
     (mp_obj_t)&synthio_note_set_frequency_obj);
 
-//|     filter: bool
-//|     """True if the note should be processed via the synthesizer's FIR filter."""
+//|     filter: Union[bool, Biquad]
+//|     """True if the note should be processed via the synthesizer's FIR filter, or a `Biquad` to filter this note on its own instead."""
 STATIC mp_obj_t synthio_note_get_filter(mp_obj_t self_in) {
     synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    return mp_obj_new_bool(common_hal_synthio_note_get_filter(self));
+    return common_hal_synthio_note_get_filter(self);
 }
 MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_filter_obj, synthio_note_get_filter);
 
 STATIC mp_obj_t synthio_note_set_filter(mp_obj_t self_in, mp_obj_t arg) {
     synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    common_hal_synthio_note_set_filter(self, mp_obj_is_true(arg));
+    common_hal_synthio_note_set_filter(self, arg);
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_filter_obj, synthio_note_set_filter);
@@ -294,6 +308,93 @@ MP_PROPERTY_GETSET(synthio_note_ring_waveform_obj,
 
 
 
+//|     waveform_loop_start: int
+//|     """The index in the waveform where the repeating part of the note starts, default 0.
+//|
+//|     The part of the waveform before this index plays just once, when the note starts.
+//|     When `waveform_frames` is more than 1, the index is within each frame."""
+STATIC mp_obj_t synthio_note_get_waveform_loop_start(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_note_get_waveform_loop_start(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_waveform_loop_start_obj, synthio_note_get_waveform_loop_start);
+
+STATIC mp_obj_t synthio_note_set_waveform_loop_start(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_waveform_loop_start(self, mp_obj_get_int(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_waveform_loop_start_obj, synthio_note_set_waveform_loop_start);
+MP_PROPERTY_GETSET(synthio_note_waveform_loop_start_obj,
+    (mp_obj_t)&synthio_note_get_waveform_loop_start_obj,
+    (mp_obj_t)&synthio_note_set_waveform_loop_start_obj);
+
+//|     waveform_loop_end: int
+//|     """The index in the waveform just past the end of the repeating part of the note.
+//|
+//|     Values past the end of the waveform (including the default) mean the end of the waveform.
+//|
+//|     The note's `frequency` is the rate at which the repeating part plays. To play a
+//|     recording at its original pitch, set the frequency to its sample rate
+//|     divided by ``waveform_loop_end - waveform_loop_start``."""
+STATIC mp_obj_t synthio_note_get_waveform_loop_end(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_note_get_waveform_loop_end(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_waveform_loop_end_obj, synthio_note_get_waveform_loop_end);
+
+STATIC mp_obj_t synthio_note_set_waveform_loop_end(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_waveform_loop_end(self, mp_obj_get_int(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_waveform_loop_end_obj, synthio_note_set_waveform_loop_end);
+MP_PROPERTY_GETSET(synthio_note_waveform_loop_end_obj,
+    (mp_obj_t)&synthio_note_get_waveform_loop_end_obj,
+    (mp_obj_t)&synthio_note_set_waveform_loop_end_obj);
+
+//|     waveform_frames: int
+//|     """The number of equal length waveforms stored one after another in `waveform`, default 1.
+//|
+//|     When it is more than 1, the waveform is a wavetable and `morph` selects the point within it."""
+STATIC mp_obj_t synthio_note_get_waveform_frames(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_note_get_waveform_frames(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_waveform_frames_obj, synthio_note_get_waveform_frames);
+
+STATIC mp_obj_t synthio_note_set_waveform_frames(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_waveform_frames(self, mp_obj_get_int(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_waveform_frames_obj, synthio_note_set_waveform_frames);
+MP_PROPERTY_GETSET(synthio_note_waveform_frames_obj,
+    (mp_obj_t)&synthio_note_get_waveform_frames_obj,
+    (mp_obj_t)&synthio_note_set_waveform_frames_obj);
+
+//|     morph: BlockInput
+//|     """The position within a wavetable, from 0 to ``waveform_frames - 1``
+//|
+//|     Whole numbers play a single frame of the wavetable, and other values blend the
+//|     two nearest frames. To sweep through the wavetable, attach an LFO here."""
+//|
+STATIC mp_obj_t synthio_note_get_morph(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_note_get_morph(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_morph_obj, synthio_note_get_morph);
+
+STATIC mp_obj_t synthio_note_set_morph(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_morph(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_morph_obj, synthio_note_set_morph);
+MP_PROPERTY_GETSET(synthio_note_morph_obj,
+    (mp_obj_t)&synthio_note_get_morph_obj,
+    (mp_obj_t)&synthio_note_set_morph_obj);
+
 static void note_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
     properties_print_helper(print, self_in, note_properties, MP_ARRAY_SIZE(note_properties));
@@ -310,6 +411,10 @@ STATIC const mp_rom_map_elem_t synthio_note_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_ring_frequency), MP_ROM_PTR(&synthio_note_ring_frequency_obj) },
     { MP_ROM_QSTR(MP_QSTR_ring_bend), MP_ROM_PTR(&synthio_note_ring_bend_obj) },
     { MP_ROM_QSTR(MP_QSTR_ring_waveform), MP_ROM_PTR(&synthio_note_ring_waveform_obj) },
+    { MP_ROM_QSTR(MP_QSTR_waveform_loop_start), MP_ROM_PTR(&synthio_note_waveform_loop_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_waveform_loop_end), MP_ROM_PTR(&synthio_note_waveform_loop_end_obj) },
+    { MP_ROM_QSTR(MP_QSTR_waveform_frames), MP_ROM_PTR(&synthio_note_waveform_frames_obj) },
+    { MP_ROM_QSTR(MP_QSTR_morph), MP_ROM_PTR(&synthio_note_morph_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(synthio_note_locals_dict, synthio_note_locals_dict_table);
 
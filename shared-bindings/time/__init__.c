@@ -32,6 +32,7 @@
 #include "py/objnamedtuple.h"
 #include "py/runtime.h"
 #include "shared/timeutils/timeutils.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/rtc/__init__.h"
 #include "shared-bindings/time/__init__.h"
 #include "supervisor/shared/translate/translate.h"
@@ -72,6 +73,9 @@ MP_DEFINE_CONST_FUN_OBJ_0(time_monotonic_obj, time_monotonic);
 //| def sleep(seconds: float) -> None:
 //|     """Sleep for a given number of seconds.
 //|
+//|     Sleeps shorter than one second are accurate to about a microsecond. The part
+//|     shorter than a millisecond is a busy wait, so background tasks do not run during it.
+//|
 //|     :param float seconds: the time to sleep in fractional seconds"""
 //|     ...
 //|
@@ -86,6 +90,22 @@ STATIC mp_obj_t time_sleep(mp_obj_t seconds_o) {
     if (seconds < 0) {
         mp_raise_ValueError(translate("sleep length must be non-negative"));
     }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    // The supervisor tick is 1/1024 s, so sleeps under a second keep their
+    // sub-millisecond part as a busy wait. Longer ones round to milliseconds.
+    if (seconds < 1) {
+        mp_float_t exact_msecs = 1000.0f * seconds;
+        uint32_t whole_msecs = (uint32_t)exact_msecs;
+        uint32_t usecs = (uint32_t)((exact_msecs - whole_msecs) * 1000.0f + 0.5f);
+        if (whole_msecs > 0) {
+            common_hal_time_delay_ms(whole_msecs);
+        }
+        if (usecs > 0) {
+            common_hal_mcu_delay_us(usecs);
+        }
+        return mp_const_none;
+    }
+    #endif
     common_hal_time_delay_ms(msecs);
     return mp_const_none;
 }
@@ -38,7 +38,6 @@
 //|     """Prints memory debugging info for the given object and returns the
 //|     estimated size."""
 //|     ...
-//|
 STATIC mp_obj_t uheap_info(mp_obj_t obj) {
     uint32_t size = shared_module_uheap_info(obj);
 
@@ -46,9 +45,41 @@ STATIC mp_obj_t uheap_info(mp_obj_t obj) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(uheap_info_obj, uheap_info);
 
+#if MICROPY_GC_CENSUS
+//| def census() -> Tuple[Dict[Optional[type], Tuple[int, int]], Dict[str, int]]:
+//|     """Collects garbage and then accounts for everything left on the heap.
+//|
+//|     Returns two dictionaries. The first maps each type to the number of its instances on
+//|     the heap and the bytes they use, including the storage that strs, bytes, lists, dicts,
+//|     arrays and class instances keep in a separate allocation. Allocations that aren't
+//|     objects of a known type, such as bytecode and other internal buffers, are counted
+//|     under ``None``.
+//|
+//|     The second maps the name of each module in `sys.modules`, and ``"__main__"``, to the
+//|     bytes it retains: everything reachable from it, stopping at other modules. What more
+//|     than one module reaches is counted for the module that comes first in `sys.modules`.
+//|
+//|     Comparing censuses taken some time apart shows which types and modules are growing::
+//|
+//|         import uheap
+//|
+//|         types, modules = uheap.census()
+//|         for name, size in sorted(modules.items(), key=lambda item: -item[1]):
+//|             print(name, size)"""
+//|     ...
+//|
+STATIC mp_obj_t uheap_census(void) {
+    return shared_module_uheap_census();
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uheap_census_obj, uheap_census);
+#endif
+
 STATIC const mp_rom_map_elem_t uheap_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uheap) },
     { MP_ROM_QSTR(MP_QSTR_info), MP_ROM_PTR(&uheap_info_obj) },
+    #if MICROPY_GC_CENSUS
+    { MP_ROM_QSTR(MP_QSTR_census), MP_ROM_PTR(&uheap_census_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(uheap_module_globals, uheap_module_globals_table);
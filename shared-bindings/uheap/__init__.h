@@ -30,5 +30,8 @@
 #include "py/obj.h"
 
 extern uint32_t shared_module_uheap_info(mp_obj_t obj);
+#if MICROPY_GC_CENSUS
+extern mp_obj_t shared_module_uheap_census(void);
+#endif
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_UHEAP___INIT___H
@@ -34,7 +34,7 @@
 extern const mp_obj_type_t usb_hid_device_type;
 
 void common_hal_usb_hid_device_construct(usb_hid_device_obj_t *self, mp_obj_t report_descriptor, uint16_t usage_page, uint16_t usage, size_t report_ids_count,uint8_t *report_ids, uint8_t *in_report_lengths, uint8_t *out_report_lengths);
-void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id);
+void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id, bool coalesce);
 mp_obj_t common_hal_usb_hid_device_get_last_received_report(usb_hid_device_obj_t *self, uint8_t report_id);
 uint16_t common_hal_usb_hid_device_get_usage_page(usb_hid_device_obj_t *self);
 uint16_t common_hal_usb_hid_device_get_usage(usb_hid_device_obj_t *self);
@@ -66,7 +66,9 @@ STATIC mp_obj_t usb_hid_disable(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 
-//| def enable(devices: Optional[Sequence[Device]], boot_device: int = 0) -> None:
+//| def enable(
+//|     devices: Optional[Sequence[Device]], boot_device: int = 0, poll_interval: int = 8
+//| ) -> None:
 //|     """Specify which USB HID devices that will be available.
 //|     Can be called in ``boot.py``, before USB is connected.
 //|
@@ -79,6 +81,10 @@ MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 //|       If ``boot_device=1``, a boot keyboard is available.
 //|       If ``boot_device=2``, a boot mouse is available. No other values are allowed.
 //|       See below.
+//|     :param int poll_interval: How often the host polls the HID endpoints, as ``bInterval``:
+//|       in milliseconds at full speed, and as 2**(poll_interval-1) 125 microsecond microframes at high speed.
+//|       Reports are queued by `Device.send_report()` until the host polls, so a smaller
+//|       interval lowers input latency. Must be 1-255.
 //|
 //|     If you enable too many devices at once, you will run out of USB endpoints.
 //|     The number of available endpoints varies by microcontroller.
@@ -111,10 +117,11 @@ MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 //|     ...
 //|
 STATIC mp_obj_t usb_hid_enable(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_devices, ARG_boot_device };
+    enum { ARG_devices, ARG_boot_device, ARG_poll_interval };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_devices, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_boot_device, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_poll_interval, MP_ARG_INT, {.u_int = USB_HID_DEFAULT_POLL_INTERVAL} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -130,7 +137,10 @@ STATIC mp_obj_t usb_hid_enable(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     uint8_t boot_device =
         (uint8_t)mp_arg_validate_int_range(args[ARG_boot_device].u_int, 0, 2, MP_QSTR_boot_device);
 
-    if (!common_hal_usb_hid_enable(devices, boot_device)) {
+    uint8_t poll_interval =
+        (uint8_t)mp_arg_validate_int_range(args[ARG_poll_interval].u_int, 1, 255, MP_QSTR_poll_interval);
+
+    if (!common_hal_usb_hid_enable(devices, boot_device, poll_interval)) {
         mp_raise_RuntimeError(translate("Cannot change USB devices now"));
     }
 
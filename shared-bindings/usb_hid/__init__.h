@@ -36,7 +36,7 @@ extern mp_obj_tuple_t common_hal_usb_hid_devices;
 void usb_hid_set_devices(mp_obj_t devices);
 
 bool common_hal_usb_hid_disable(void);
-bool common_hal_usb_hid_enable(const mp_obj_t devices_seq, uint8_t boot_device);
+bool common_hal_usb_hid_enable(const mp_obj_t devices_seq, uint8_t boot_device, uint8_t poll_interval);
 uint8_t common_hal_usb_hid_get_boot_device(void);
 
 #endif // SHARED_BINDINGS_USB_HID_H
@@ -0,0 +1,214 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "shared-bindings/usb/core/Device.h"
+#include "shared-bindings/usb_host/MassStorage.h"
+#include "shared-bindings/util.h"
+
+//| class MassStorage:
+//|     """Block device for a USB mass storage device, such as a USB flash drive,
+//|     attached to a host `Port`. Blocks are read and written with as few SCSI
+//|     commands as possible so that large reads approach the bus's data rate.
+//|     Usually a MassStorage object is used with ``storage.VfsFat`` to allow file
+//|     I/O to the drive."""
+//|
+//|     def __init__(self, device: usb.core.Device, *, lun: int = 0) -> None:
+//|         """Use a mass storage device found with `usb.core.find`.
+//|
+//|         :param usb.core.Device device: The attached mass storage device
+//|         :param int lun: The logical unit of the device to use
+//|
+//|         Only devices with 512-byte blocks are supported.
+//|
+//|         Example usage:
+//|
+//|         .. code-block:: python
+//|
+//|             import os
+//|
+//|             import storage
+//|             import usb.core
+//|             import usb_host
+//|
+//|             for device in usb.core.find(find_all=True):
+//|                 try:
+//|                     drive = usb_host.MassStorage(device)
+//|                     break
+//|                 except OSError:
+//|                     pass
+//|             vfs = storage.VfsFat(drive)
+//|             storage.mount(vfs, '/usb')
+//|             os.listdir('/usb')"""
+//|         ...
+STATIC mp_obj_t usb_host_massstorage_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_device, ARG_lun };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_device, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_lun, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    usb_core_device_obj_t *device = MP_OBJ_TO_PTR(mp_arg_validate_type(args[ARG_device].u_obj, &usb_core_device_type, MP_QSTR_device));
+
+    usb_host_massstorage_obj_t *self = m_new_obj(usb_host_massstorage_obj_t);
+    self->base.type = &usb_host_massstorage_type;
+    common_hal_usb_host_massstorage_construct(self, device->device_number, args[ARG_lun].u_int);
+
+    return (mp_obj_t)self;
+}
+
+STATIC void check_for_deinit(usb_host_massstorage_obj_t *self) {
+    if (common_hal_usb_host_massstorage_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def count(self) -> int:
+//|         """Returns the total number of blocks
+//|
+//|         :return: The number of 512-byte blocks, as a number"""
+STATIC mp_obj_t usb_host_massstorage_count(mp_obj_t self_in) {
+    usb_host_massstorage_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_usb_host_massstorage_get_blockcount(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_host_massstorage_count_obj, usb_host_massstorage_count);
+
+//|     def deinit(self) -> None:
+//|         """Stop using the device. It stays attached to the port."""
+//|         ...
+STATIC mp_obj_t usb_host_massstorage_deinit(mp_obj_t self_in) {
+    usb_host_massstorage_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_usb_host_massstorage_deinit(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_host_massstorage_deinit_obj, usb_host_massstorage_deinit);
+
+//|     def __enter__(self) -> MassStorage:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t usb_host_massstorage_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_usb_host_massstorage_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(usb_host_massstorage_obj___exit___obj, 4, 4, usb_host_massstorage_obj___exit__);
+
+STATIC void get_block_buffer(mp_obj_t buf_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    mp_get_buffer_raise(buf_in, bufinfo, flags);
+    if (bufinfo->len % 512 != 0) {
+        mp_raise_ValueError(translate("Buffer length must be a multiple of 512"));
+    }
+}
+
+//|     def readblocks(self, start_block: int, buf: WriteableBuffer) -> None:
+//|         """Read one or more blocks from the device
+//|
+//|         :param int start_block: The block to start reading from
+//|         :param ~circuitpython_typing.WriteableBuffer buf: The buffer to write into.  Length must be multiple of 512.
+//|
+//|         :return: None"""
+STATIC mp_obj_t usb_host_massstorage_readblocks(mp_obj_t self_in, mp_obj_t start_block_in, mp_obj_t buf_in) {
+    usb_host_massstorage_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint32_t start_block = mp_obj_get_int(start_block_in);
+    mp_buffer_info_t bufinfo;
+    get_block_buffer(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    int result = common_hal_usb_host_massstorage_readblocks(self, start_block, bufinfo.buf, bufinfo.len);
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(usb_host_massstorage_readblocks_obj, usb_host_massstorage_readblocks);
+
+//|     def sync(self) -> None:
+//|         """Ensure all blocks written are actually committed to the device
+//|
+//|         :return: None"""
+//|         ...
+STATIC mp_obj_t usb_host_massstorage_sync(mp_obj_t self_in) {
+    usb_host_massstorage_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    int result = common_hal_usb_host_massstorage_sync(self);
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_host_massstorage_sync_obj, usb_host_massstorage_sync);
+
+//|     def writeblocks(self, start_block: int, buf: ReadableBuffer) -> None:
+//|         """Write one or more blocks to the device
+//|
+//|         :param int start_block: The block to start writing from
+//|         :param ~circuitpython_typing.ReadableBuffer buf: The buffer to read from.  Length must be multiple of 512.
+//|
+//|         :return: None"""
+//|
+STATIC mp_obj_t usb_host_massstorage_writeblocks(mp_obj_t self_in, mp_obj_t start_block_in, mp_obj_t buf_in) {
+    usb_host_massstorage_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint32_t start_block = mp_obj_get_int(start_block_in);
+    mp_buffer_info_t bufinfo;
+    get_block_buffer(buf_in, &bufinfo, MP_BUFFER_READ);
+    int result = common_hal_usb_host_massstorage_writeblocks(self, start_block, bufinfo.buf, bufinfo.len);
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(usb_host_massstorage_writeblocks_obj, usb_host_massstorage_writeblocks);
+
+STATIC const mp_rom_map_elem_t usb_host_massstorage_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_count),              MP_ROM_PTR(&usb_host_massstorage_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit),             MP_ROM_PTR(&usb_host_massstorage_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__),          MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__),           MP_ROM_PTR(&usb_host_massstorage_obj___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_readblocks),         MP_ROM_PTR(&usb_host_massstorage_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sync),               MP_ROM_PTR(&usb_host_massstorage_sync_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks),        MP_ROM_PTR(&usb_host_massstorage_writeblocks_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(usb_host_massstorage_locals_dict, usb_host_massstorage_locals_dict_table);
+
+const mp_obj_type_t usb_host_massstorage_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_MassStorage,
+    .make_new = usb_host_massstorage_make_new,
+    .locals_dict = (mp_obj_t)&usb_host_massstorage_locals_dict,
+};
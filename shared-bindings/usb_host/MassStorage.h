@@ -0,0 +1,43 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_USB_HOST_MASSSTORAGE_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_USB_HOST_MASSSTORAGE_H
+
+#include "shared-module/usb_host/MassStorage.h"
+
+extern const mp_obj_type_t usb_host_massstorage_type;
+
+void common_hal_usb_host_massstorage_construct(usb_host_massstorage_obj_t *self, uint8_t device_number, mp_int_t lun);
+void common_hal_usb_host_massstorage_deinit(usb_host_massstorage_obj_t *self);
+bool common_hal_usb_host_massstorage_deinited(usb_host_massstorage_obj_t *self);
+uint32_t common_hal_usb_host_massstorage_get_blockcount(usb_host_massstorage_obj_t *self);
+// These return 0 on success and a negative errno on failure. len must be a multiple of 512.
+int common_hal_usb_host_massstorage_readblocks(usb_host_massstorage_obj_t *self, uint32_t start_block, uint8_t *buf, size_t len);
+int common_hal_usb_host_massstorage_writeblocks(usb_host_massstorage_obj_t *self, uint32_t start_block, const uint8_t *buf, size_t len);
+int common_hal_usb_host_massstorage_sync(usb_host_massstorage_obj_t *self);
+
+#endif  // MICROPY_INCLUDED_SHARED_BINDINGS_USB_HOST_MASSSTORAGE_H
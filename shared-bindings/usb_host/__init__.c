@@ -29,16 +29,19 @@
 #include "py/runtime.h"
 
 #include "shared-bindings/usb_host/__init__.h"
+#include "shared-bindings/usb_host/MassStorage.h"
 #include "shared-bindings/usb_host/Port.h"
 
 //| """USB Host
 //|
 //| The `usb_host` module allows you to manage USB host ports. To communicate
 //| with devices use the `usb` module that is a subset of PyUSB's API.
+//| Attached USB flash drives can be used as storage through `MassStorage`.
 //| """
 
 STATIC mp_map_elem_t usb_host_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__),        MP_OBJ_NEW_QSTR(MP_QSTR_usb_host) },
+    { MP_ROM_QSTR(MP_QSTR_MassStorage),   MP_OBJ_FROM_PTR(&usb_host_massstorage_type) },
     { MP_ROM_QSTR(MP_QSTR_Port),          MP_OBJ_FROM_PTR(&usb_host_port_type) },
 };
 
@@ -63,7 +63,74 @@
 //|         :return: number of bytes read and stored into ``buf``
 //|         :rtype: bytes or None"""
 //|         ...
+
+//|     def readinto_packets(
+//|         self, packets: WriteableBuffer, timestamps: Optional[WriteableBuffer] = None
+//|     ) -> int:
+//|         """Read whole USB-MIDI event packets, 4 bytes each: the cable number and Code Index Number,
+//|         followed by up to 3 MIDI bytes. Running status has already been expanded by the sender,
+//|         so each packet is a complete message (or part of a SysEx). This never waits.
+//|
+//|         If ``timestamps`` is given, it receives the `supervisor.ticks_ms` value at which each
+//|         packet arrived, so an ``array.array("L")`` with one item per packet works well.
+//|
+//|         Don't mix this with `read` or `readinto`: a message that they have partly read is dropped.
 //|
+//|         :return: number of packets read
+//|         :rtype: int"""
+//|         ...
+STATIC mp_obj_t usb_midi_portin_readinto_packets(size_t n_args, const mp_obj_t *args) {
+    usb_midi_portin_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t packets;
+    mp_get_buffer_raise(args[1], &packets, MP_BUFFER_WRITE);
+    size_t len = packets.len / 4;
+
+    uint32_t *timestamps = NULL;
+    if (n_args > 2 && args[2] != mp_const_none) {
+        mp_buffer_info_t timestamps_info;
+        mp_get_buffer_raise(args[2], &timestamps_info, MP_BUFFER_WRITE);
+        timestamps = timestamps_info.buf;
+        len = MIN(len, timestamps_info.len / sizeof(uint32_t));
+    }
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_midi_portin_readinto_packets(self, packets.buf, timestamps, len));
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(usb_midi_portin_readinto_packets_obj, 2, 3, usb_midi_portin_readinto_packets);
+
+#if CIRCUITPY_SYNTHIO
+//|     def play_notes(self, synthesizer: synthio.Synthesizer, *, channel: Optional[int] = None) -> int:
+//|         """Press and release notes on ``synthesizer`` for all the Note On and Note Off messages
+//|         waiting, without creating any Python objects. Other messages are discarded.
+//|
+//|         :param synthio.Synthesizer synthesizer: The synthesizer to play
+//|         :param int channel: Only play notes on this MIDI channel, 0 to 15. By default, play notes on all channels.
+//|         :return: number of notes pressed or released
+//|         :rtype: int"""
+//|         ...
+STATIC mp_obj_t usb_midi_portin_play_notes(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    usb_midi_portin_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    enum { ARG_synthesizer, ARG_channel };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_synthesizer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_channel, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    synthio_synthesizer_obj_t *synthesizer =
+        MP_OBJ_TO_PTR(mp_arg_validate_type(args[ARG_synthesizer].u_obj, &synthio_synthesizer_type, MP_QSTR_synthesizer));
+    if (common_hal_synthio_synthesizer_deinited(synthesizer)) {
+        raise_deinited_error();
+    }
+    mp_int_t channel = -1;
+    if (args[ARG_channel].u_obj != mp_const_none) {
+        channel = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_channel].u_obj), 0, 15, MP_QSTR_channel);
+    }
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_midi_portin_play_notes(self, synthesizer, channel));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(usb_midi_portin_play_notes_obj, 1, usb_midi_portin_play_notes);
+#endif
 
 // These three methods are used by the shared stream methods.
 STATIC mp_uint_t usb_midi_portin_read(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
@@ -98,6 +165,11 @@ STATIC const mp_rom_map_elem_t usb_midi_portin_locals_dict_table[] = {
     // Standard stream methods.
     { MP_OBJ_NEW_QSTR(MP_QSTR_read),     MP_ROM_PTR(&mp_stream_read_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+
+    { MP_OBJ_NEW_QSTR(MP_QSTR_readinto_packets), MP_ROM_PTR(&usb_midi_portin_readinto_packets_obj) },
+    #if CIRCUITPY_SYNTHIO
+    { MP_OBJ_NEW_QSTR(MP_QSTR_play_notes), MP_ROM_PTR(&usb_midi_portin_play_notes_obj) },
+    #endif
 };
 STATIC MP_DEFINE_CONST_DICT(usb_midi_portin_locals_dict, usb_midi_portin_locals_dict_table);
 
@@ -38,4 +38,15 @@ extern size_t common_hal_usb_midi_portin_read(usb_midi_portin_obj_t *self,
 extern uint32_t common_hal_usb_midi_portin_bytes_available(usb_midi_portin_obj_t *self);
 extern void common_hal_usb_midi_portin_clear_buffer(usb_midi_portin_obj_t *self);
 
+// Read whole USB-MIDI event packets, 4 bytes each, with the tick each one arrived at.
+extern size_t common_hal_usb_midi_portin_readinto_packets(usb_midi_portin_obj_t *self,
+    uint8_t *packets, uint32_t *timestamps, size_t len);
+
+#if CIRCUITPY_SYNTHIO
+#include "shared-bindings/synthio/Synthesizer.h"
+
+extern size_t common_hal_usb_midi_portin_play_notes(usb_midi_portin_obj_t *self,
+    synthio_synthesizer_obj_t *synthesizer, mp_int_t channel);
+#endif
+
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_USB_MIDI_PORTIN_H
@@ -52,7 +52,6 @@
 //|         :return: the number of bytes written
 //|         :rtype: int or None"""
 //|         ...
-//|
 
 STATIC mp_uint_t usb_midi_portout_write(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
     usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -61,6 +60,23 @@ STATIC mp_uint_t usb_midi_portout_write(mp_obj_t self_in, const void *buf_in, mp
     return common_hal_usb_midi_portout_write(self, buf, size, errcode);
 }
 
+//|     def write_packets(self, packets: ReadableBuffer) -> int:
+//|         """Write USB-MIDI event packets, 4 bytes each: the cable number and Code Index Number,
+//|         followed by up to 3 MIDI bytes. This skips the parsing that `write` does, and never waits.
+//|         Any bytes after the last whole packet are ignored.
+//|
+//|         :return: the number of packets written, which is less than given if the USB buffer filled up
+//|         :rtype: int"""
+//|         ...
+//|
+STATIC mp_obj_t usb_midi_portout_write_packets(mp_obj_t self_in, mp_obj_t packets) {
+    usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(packets, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_midi_portout_write_packets(self, bufinfo.buf, bufinfo.len / 4));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_midi_portout_write_packets_obj, usb_midi_portout_write_packets);
+
 STATIC mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
     usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_uint_t ret;
@@ -80,6 +96,7 @@ STATIC mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_
 STATIC const mp_rom_map_elem_t usb_midi_portout_locals_dict_table[] = {
     // Standard stream methods.
     { MP_OBJ_NEW_QSTR(MP_QSTR_write),    MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_write_packets), MP_ROM_PTR(&usb_midi_portout_write_packets_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(usb_midi_portout_locals_dict, usb_midi_portout_locals_dict_table);
 
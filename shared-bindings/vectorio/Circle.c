@@ -17,6 +17,7 @@
 //|         radius: int,
 //|         x: int,
 //|         y: int,
+//|         antialias: bool = False,
 //|     ) -> None:
 //|         """Circle is positioned on screen by its center point.
 //|
@@ -25,15 +26,19 @@
 //|         :param int x: Initial x position of the axis.
 //|         :param int y: Initial y position of the axis.
 //|         :param int color_index: Initial color_index to use when selecting color from the palette.
+//|         :param bool antialias: Blend the edges of the circle with what is below it. Edges
+//|             are blended on 16 bit color and grayscale displays. On other displays, edge
+//|             pixels are drawn if they are at least half covered.
 //|         """
 static mp_obj_t vectorio_circle_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_pixel_shader, ARG_radius, ARG_x, ARG_y, ARG_color_index };
+    enum { ARG_pixel_shader, ARG_radius, ARG_x, ARG_y, ARG_color_index, ARG_antialias };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_pixel_shader, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
         { MP_QSTR_radius, MP_ARG_REQUIRED | MP_ARG_INT },
         { MP_QSTR_x, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
         { MP_QSTR_y, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
         { MP_QSTR_color_index, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_antialias, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -52,6 +57,9 @@ static mp_obj_t vectorio_circle_make_new(const mp_obj_type_t *type, size_t n_arg
     int32_t y = args[ARG_y].u_int;
     mp_obj_t vector_shape = vectorio_vector_shape_make_new(self, pixel_shader, x, y);
     self->draw_protocol_instance = vector_shape;
+    if (args[ARG_antialias].u_bool) {
+        common_hal_vectorio_vector_shape_set_antialias(MP_OBJ_TO_PTR(vector_shape), true);
+    }
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -119,6 +127,9 @@ MP_PROPERTY_GETSET(vectorio_circle_color_index_obj,
 //|     pixel_shader: Union[displayio.ColorConverter, displayio.Palette]
 //|     """The pixel shader of the circle."""
 //|
+//|     antialias: bool
+//|     """Blend the edges of the circle with what is below it."""
+//|
 
 STATIC const mp_rom_map_elem_t vectorio_circle_locals_dict_table[] = {
     // Functions
@@ -131,6 +142,7 @@ STATIC const mp_rom_map_elem_t vectorio_circle_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_color_index), MP_ROM_PTR(&vectorio_circle_color_index_obj) },
     { MP_ROM_QSTR(MP_QSTR_location), MP_ROM_PTR(&vectorio_vector_shape_location_obj) },
     { MP_ROM_QSTR(MP_QSTR_pixel_shader), MP_ROM_PTR(&vectorio_vector_shape_pixel_shader_obj) },
+    { MP_ROM_QSTR(MP_QSTR_antialias), MP_ROM_PTR(&vectorio_vector_shape_antialias_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(vectorio_circle_locals_dict, vectorio_circle_locals_dict_table);
 
@@ -12,6 +12,8 @@ void common_hal_vectorio_circle_construct(vectorio_circle_t *self, uint16_t radi
 void common_hal_vectorio_circle_set_on_dirty(vectorio_circle_t *self, vectorio_event_t notification);
 
 uint32_t common_hal_vectorio_circle_get_pixel(void *circle, int16_t x, int16_t y);
+uint32_t common_hal_vectorio_circle_get_span(void *circle, int16_t x, int16_t y, bool vertical, int32_t *out_start, int32_t *out_end);
+uint32_t common_hal_vectorio_circle_get_subpixel_span(void *circle, int32_t x, int32_t y, bool vertical, int32_t *out_start, int32_t *out_end);
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area);
 
@@ -23,6 +23,7 @@
 //|         points: List[Tuple[int, int]],
 //|         x: int,
 //|         y: int,
+//|         antialias: bool = False,
 //|     ) -> None:
 //|         """Represents a closed shape by ordered vertices. The path will be treated as
 //|         'closed', the last point will connect to the first point.
@@ -33,15 +34,19 @@
 //|         :param int x: Initial screen x position of the 0,0 origin in the points list.
 //|         :param int y: Initial screen y position of the 0,0 origin in the points list.
 //|         :param int color_index: Initial color_index to use when selecting color from the palette.
+//|         :param bool antialias: Blend the edges of the polygon with what is below it. Edges
+//|             are blended on 16 bit color and grayscale displays. On other displays, edge
+//|             pixels are drawn if they are at least half covered.
 //|         """
 static mp_obj_t vectorio_polygon_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_pixel_shader, ARG_points_list, ARG_x, ARG_y, ARG_color_index };
+    enum { ARG_pixel_shader, ARG_points_list, ARG_x, ARG_y, ARG_color_index, ARG_antialias };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_pixel_shader, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
         { MP_QSTR_points, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_x, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
         { MP_QSTR_y, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
         { MP_QSTR_color_index, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_antialias, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -60,6 +65,9 @@ static mp_obj_t vectorio_polygon_make_new(const mp_obj_type_t *type, size_t n_ar
     int32_t y = args[ARG_y].u_int;
     mp_obj_t vector_shape = vectorio_vector_shape_make_new(self, pixel_shader, x, y);
     self->draw_protocol_instance = vector_shape;
+    if (args[ARG_antialias].u_bool) {
+        common_hal_vectorio_vector_shape_set_antialias(MP_OBJ_TO_PTR(vector_shape), true);
+    }
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -128,6 +136,9 @@ MP_PROPERTY_GETSET(vectorio_polygon_color_index_obj,
 //|     pixel_shader: Union[displayio.ColorConverter, displayio.Palette]
 //|     """The pixel shader of the polygon."""
 //|
+//|     antialias: bool
+//|     """Blend the edges of the polygon with what is below it."""
+//|
 
 STATIC const mp_rom_map_elem_t vectorio_polygon_locals_dict_table[] = {
     // Functions
@@ -140,6 +151,7 @@ STATIC const mp_rom_map_elem_t vectorio_polygon_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_color_index), MP_ROM_PTR(&vectorio_polygon_color_index_obj) },
     { MP_ROM_QSTR(MP_QSTR_location), MP_ROM_PTR(&vectorio_vector_shape_location_obj) },
     { MP_ROM_QSTR(MP_QSTR_pixel_shader), MP_ROM_PTR(&vectorio_vector_shape_pixel_shader_obj) },
+    { MP_ROM_QSTR(MP_QSTR_antialias), MP_ROM_PTR(&vectorio_vector_shape_antialias_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(vectorio_polygon_locals_dict, vectorio_polygon_locals_dict_table);
 
@@ -12,6 +12,8 @@ void common_hal_vectorio_polygon_set_on_dirty(vectorio_polygon_t *self, vectorio
 
 
 uint32_t common_hal_vectorio_polygon_get_pixel(void *polygon, int16_t x, int16_t y);
+uint32_t common_hal_vectorio_polygon_get_span(void *polygon, int16_t x, int16_t y, bool vertical, int32_t *out_start, int32_t *out_end);
+uint32_t common_hal_vectorio_polygon_get_subpixel_span(void *polygon, int32_t x, int32_t y, bool vertical, int32_t *out_start, int32_t *out_end);
 
 void common_hal_vectorio_polygon_get_area(void *polygon, displayio_area_t *out_area);
 
@@ -35,14 +35,20 @@ mp_obj_t vectorio_vector_shape_make_new(const mp_obj_t shape, const mp_obj_t pix
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_polygon_get_area;
         ishape.get_pixel = &common_hal_vectorio_polygon_get_pixel;
+        ishape.get_span = &common_hal_vectorio_polygon_get_span;
+        ishape.get_subpixel_span = &common_hal_vectorio_polygon_get_subpixel_span;
     } else if (mp_obj_is_type(shape, &vectorio_rectangle_type)) {
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_rectangle_get_area;
         ishape.get_pixel = &common_hal_vectorio_rectangle_get_pixel;
+        ishape.get_span = &common_hal_vectorio_rectangle_get_span;
+        ishape.get_subpixel_span = NULL;
     } else if (mp_obj_is_type(shape, &vectorio_circle_type)) {
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_circle_get_area;
         ishape.get_pixel = &common_hal_vectorio_circle_get_pixel;
+        ishape.get_span = &common_hal_vectorio_circle_get_span;
+        ishape.get_subpixel_span = &common_hal_vectorio_circle_get_subpixel_span;
     } else {
         mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_shape);
     }
@@ -79,6 +85,7 @@ vectorio_draw_protocol_impl_t vectorio_vector_shape_draw_protocol_impl = {
     .draw_finish_refresh = (draw_finish_refresh_fun)vectorio_vector_shape_finish_refresh,
     .draw_get_refresh_areas = (draw_get_refresh_areas_fun)vectorio_vector_shape_get_refresh_areas,
     .draw_set_dirty = (draw_set_dirty_fun)common_hal_vectorio_vector_shape_set_dirty,
+    .draw_get_area_fill = (draw_get_area_fill_fun)vectorio_vector_shape_get_area_fill,
 };
 
 // Stub checker does not approve of these shared properties.
@@ -208,6 +215,32 @@ MP_PROPERTY_GETSET(vectorio_vector_shape_hidden_obj,
     (mp_obj_t)&vectorio_vector_shape_set_hidden_obj);
 
 
+//     antialias: bool
+//     """Blend the edges of the shape with what is below it."""
+//
+STATIC mp_obj_t vectorio_vector_shape_obj_get_antialias(mp_obj_t wrapper_shape) {
+    // Relies on the fact that only vector_shape impl gets matched with a VectorShape.
+    const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, wrapper_shape);
+    vectorio_vector_shape_t *self = MP_OBJ_TO_PTR(draw_protocol->draw_get_protocol_self(wrapper_shape));
+    return mp_obj_new_bool(common_hal_vectorio_vector_shape_get_antialias(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(vectorio_vector_shape_get_antialias_obj, vectorio_vector_shape_obj_get_antialias);
+
+STATIC mp_obj_t vectorio_vector_shape_obj_set_antialias(mp_obj_t wrapper_shape, mp_obj_t antialias_obj) {
+    // Relies on the fact that only vector_shape impl gets matched with a VectorShape.
+    const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, wrapper_shape);
+    vectorio_vector_shape_t *self = MP_OBJ_TO_PTR(draw_protocol->draw_get_protocol_self(wrapper_shape));
+
+    common_hal_vectorio_vector_shape_set_antialias(self, mp_obj_is_true(antialias_obj));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(vectorio_vector_shape_set_antialias_obj, vectorio_vector_shape_obj_set_antialias);
+
+MP_PROPERTY_GETSET(vectorio_vector_shape_antialias_obj,
+    (mp_obj_t)&vectorio_vector_shape_get_antialias_obj,
+    (mp_obj_t)&vectorio_vector_shape_set_antialias_obj);
+
+
 //     pixel_shader: Union[ColorConverter, Palette]
 //     """The pixel shader of the shape."""
 //
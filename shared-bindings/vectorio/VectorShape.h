@@ -34,6 +34,9 @@ void common_hal_vectorio_vector_shape_set_y(vectorio_vector_shape_t *self, mp_in
 mp_int_t common_hal_vectorio_vector_shape_get_hidden(vectorio_vector_shape_t *self);
 void common_hal_vectorio_vector_shape_set_hidden(vectorio_vector_shape_t *self, bool hidden);
 
+bool common_hal_vectorio_vector_shape_get_antialias(vectorio_vector_shape_t *self);
+void common_hal_vectorio_vector_shape_set_antialias(vectorio_vector_shape_t *self, bool antialias);
+
 mp_obj_t common_hal_vectorio_vector_shape_get_pixel_shader(vectorio_vector_shape_t *self);
 void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *self, mp_obj_t pixel_shader);
 
@@ -44,6 +47,7 @@ extern vectorio_draw_protocol_impl_t vectorio_vector_shape_draw_protocol_impl;
 extern const mp_obj_property_getset_t vectorio_vector_shape_x_obj;
 extern const mp_obj_property_getset_t vectorio_vector_shape_y_obj;
 extern const mp_obj_property_getset_t vectorio_vector_shape_hidden_obj;
+extern const mp_obj_property_getset_t vectorio_vector_shape_antialias_obj;
 extern const mp_obj_property_getset_t vectorio_vector_shape_location_obj;
 extern const mp_obj_property_getset_t vectorio_vector_shape_pixel_shader_obj;
 extern const mp_obj_fun_builtin_fixed_t vectorio_vector_shape_contains_obj;
@@ -19,6 +19,7 @@ typedef void (*draw_update_transform_fun)(mp_obj_t draw_protocol_self, displayio
 typedef void (*draw_finish_refresh_fun)(mp_obj_t draw_protocol_self);
 typedef void (*draw_set_dirty_fun)(mp_obj_t draw_protocol_self);
 typedef displayio_area_t *(*draw_get_refresh_areas_fun)(mp_obj_t draw_protocol_self, displayio_area_t *tail);
+typedef displayio_area_fill_t (*draw_get_area_fill_fun)(mp_obj_t draw_protocol_self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *color);
 
 typedef struct _vectorio_draw_protocol_impl_t {
     draw_fill_area_fun draw_fill_area;
@@ -27,6 +28,7 @@ typedef struct _vectorio_draw_protocol_impl_t {
     draw_finish_refresh_fun draw_finish_refresh;
     draw_get_refresh_areas_fun draw_get_refresh_areas;
     draw_set_dirty_fun draw_set_dirty;
+    draw_get_area_fill_fun draw_get_area_fill;
 } vectorio_draw_protocol_impl_t;
 
 // Draw protocol
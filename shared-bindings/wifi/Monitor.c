@@ -36,19 +36,45 @@
 //|     """For monitoring WiFi packets."""
 //|
 
-//|     def __init__(self, channel: Optional[int] = 1, queue: Optional[int] = 128) -> None:
+//|     def __init__(
+//|         self,
+//|         channel: Optional[int] = 1,
+//|         queue: Optional[int] = 128,
+//|         *,
+//|         buffer_size: int = 16384,
+//|         snaplen: int = 0,
+//|         frame_type: Optional[int] = 0,
+//|         frame_subtype: Optional[int] = None,
+//|         mac: Optional[ReadableBuffer] = None
+//|     ) -> None:
 //|         """Initialize `wifi.Monitor` singleton.
 //|
+//|         Packets are filtered and copied into a ring of ``buffer_size`` bytes as they arrive,
+//|         without allocating. Packets that don't fit in the ring are counted by `lost`.
+//|
 //|         :param int channel: The WiFi channel to scan.
-//|         :param int queue: The queue size for buffering the packet.
+//|         :param int queue: The most packets to hold at once.
+//|         :param int buffer_size: The size in bytes of the ring packets are held in.
+//|         :param int snaplen: Keep at most this many bytes of each frame, or all of it if 0.
+//|             24 keeps just the MAC header of most frames.
+//|         :param int frame_type: Keep only frames of this type: 0 for management, 1 for control
+//|             and 2 for data. ``None`` keeps all three.
+//|         :param int frame_subtype: Keep only frames of this subtype, or any if ``None``.
+//|         :param ~circuitpython_typing.ReadableBuffer mac: Keep only frames with this 6-byte
+//|             address as one of their first three addresses.
 //|
 //|         """
 //|         ...
 STATIC mp_obj_t wifi_monitor_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_channel, ARG_queue };
+    enum { ARG_channel, ARG_queue, ARG_buffer_size, ARG_snaplen, ARG_frame_type, ARG_frame_subtype, ARG_mac };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_channel, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_queue, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 128} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16384} },
+        { MP_QSTR_snaplen, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_frame_type, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
+        { MP_QSTR_frame_subtype, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_mac, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -56,12 +82,30 @@ STATIC mp_obj_t wifi_monitor_make_new(const mp_obj_type_t *type, size_t n_args,
 
     mp_int_t channel = mp_arg_validate_int_range(args[ARG_channel].u_int, 1, 13, MP_QSTR_channel);
     mp_int_t queue = mp_arg_validate_int_min(args[ARG_queue].u_int, 0, MP_QSTR_queue);
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 1, MP_QSTR_buffer_size);
+    mp_int_t snaplen = mp_arg_validate_int_range(args[ARG_snaplen].u_int, 0, 0xffff, MP_QSTR_snaplen);
+
+    mp_int_t frame_type = -1;
+    if (args[ARG_frame_type].u_obj != mp_const_none) {
+        frame_type = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_frame_type].u_obj), 0, 2, MP_QSTR_frame_type);
+    }
+    mp_int_t frame_subtype = -1;
+    if (args[ARG_frame_subtype].u_obj != mp_const_none) {
+        frame_subtype = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_frame_subtype].u_obj), 0, 15, MP_QSTR_frame_subtype);
+    }
+    const uint8_t *mac = NULL;
+    if (args[ARG_mac].u_obj != mp_const_none) {
+        mp_buffer_info_t mac_bufinfo;
+        mp_get_buffer_raise(args[ARG_mac].u_obj, &mac_bufinfo, MP_BUFFER_READ);
+        mp_arg_validate_length(mac_bufinfo.len, 6, MP_QSTR_mac);
+        mac = mac_bufinfo.buf;
+    }
 
     wifi_monitor_obj_t *self = MP_STATE_VM(wifi_monitor_singleton);
     if (common_hal_wifi_monitor_deinited()) {
         self = m_new_obj(wifi_monitor_obj_t);
         self->base.type = &wifi_monitor_type;
-        common_hal_wifi_monitor_construct(self, channel, queue);
+        common_hal_wifi_monitor_construct(self, channel, queue, buffer_size, snaplen, frame_type, frame_subtype, mac);
         MP_STATE_VM(wifi_monitor_singleton) = self;
     }
 
@@ -130,7 +174,6 @@ MP_DEFINE_CONST_FUN_OBJ_1(wifi_monitor_queued_obj, wifi_monitor_obj_get_queued);
 //|     def packet(self) -> dict:
 //|         """Returns the monitor packet."""
 //|         ...
-//|
 STATIC mp_obj_t wifi_monitor_obj_get_packet(mp_obj_t self_in) {
     if (common_hal_wifi_monitor_deinited()) {
         raise_deinited_error();
@@ -139,6 +182,28 @@ STATIC mp_obj_t wifi_monitor_obj_get_packet(mp_obj_t self_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(wifi_monitor_packet_obj, wifi_monitor_obj_get_packet);
 
+//|     def readinto(self, buf: WriteableBuffer) -> int:
+//|         """Move as many whole queued packets as fit into ``buf``, and return the number of
+//|         bytes stored. Unlike `packet`, this does not allocate.
+//|
+//|         Each packet is a 10-byte header followed by the frame bytes it counts. The header has
+//|         ``struct`` format ``"<HHBbI"``: the number of frame bytes, the frame's length before
+//|         ``snaplen`` cut it, the channel, the RSSI and a receive timestamp in microseconds.
+//|         Slices of a ``memoryview`` of ``buf`` can be used to step through the packets.
+//|         ``buf`` should have room for the header and ``snaplen`` bytes, or for a whole frame
+//|         if ``snaplen`` is 0, or packets that don't fit stay queued."""
+//|         ...
+//|
+STATIC mp_obj_t wifi_monitor_obj_readinto(mp_obj_t self_in, mp_obj_t buf_in) {
+    if (common_hal_wifi_monitor_deinited()) {
+        raise_deinited_error();
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    return mp_obj_new_int_from_uint(common_hal_wifi_monitor_readinto(self_in, bufinfo.buf, bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(wifi_monitor_readinto_obj, wifi_monitor_obj_readinto);
+
 STATIC const mp_rom_map_elem_t wifi_monitor_locals_dict_table[] = {
     // properties
     { MP_ROM_QSTR(MP_QSTR_channel), MP_ROM_PTR(&wifi_monitor_channel_obj) },
@@ -149,6 +214,7 @@ STATIC const mp_rom_map_elem_t wifi_monitor_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_lost),    MP_ROM_PTR(&wifi_monitor_lost_obj) },
     { MP_ROM_QSTR(MP_QSTR_queued),  MP_ROM_PTR(&wifi_monitor_queued_obj) },
     { MP_ROM_QSTR(MP_QSTR_packet),  MP_ROM_PTR(&wifi_monitor_packet_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&wifi_monitor_readinto_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(wifi_monitor_locals_dict, wifi_monitor_locals_dict_table);
 
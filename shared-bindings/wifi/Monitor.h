@@ -32,7 +32,8 @@
 extern const mp_obj_type_t wifi_monitor_type;
 
 void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self,
-    uint8_t channel, size_t queue);
+    uint8_t channel, size_t queue, size_t buffer_size, uint16_t snaplen,
+    int8_t frame_type, int8_t frame_subtype, const uint8_t *mac);
 void common_hal_wifi_monitor_deinit(wifi_monitor_obj_t *self);
 bool common_hal_wifi_monitor_deinited(void);
 
@@ -46,5 +47,6 @@ mp_obj_t common_hal_wifi_monitor_get_lost(wifi_monitor_obj_t *self);
 mp_obj_t common_hal_wifi_monitor_get_queued(wifi_monitor_obj_t *self);
 
 mp_obj_t common_hal_wifi_monitor_get_packet(wifi_monitor_obj_t *self);
+size_t common_hal_wifi_monitor_readinto(wifi_monitor_obj_t *self, uint8_t *buf, size_t len);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_WIFI_MONITOR_H
@@ -0,0 +1,66 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/enum.h"
+
+#include "shared-bindings/wifi/PowerManagement.h"
+
+MAKE_ENUM_VALUE(wifi_power_management_type, power_management, NONE, POWER_MANAGEMENT_NONE);
+MAKE_ENUM_VALUE(wifi_power_management_type, power_management, MIN, POWER_MANAGEMENT_MIN);
+MAKE_ENUM_VALUE(wifi_power_management_type, power_management, MAX, POWER_MANAGEMENT_MAX);
+MAKE_ENUM_VALUE(wifi_power_management_type, power_management, UNKNOWN, POWER_MANAGEMENT_UNKNOWN);
+
+//| class PowerManagement:
+//|     """Power-saving options for wifi
+//|
+//|     .. note:: On boards using the CYW43 radio module, the choices below are mapped to the
+//|       corresponding ``cyw43.PM_*`` values."""
+//|
+//|     NONE: PowerManagement
+//|     """The radio stays awake all the time. Lowest latency, highest power use."""
+//|
+//|     MIN: PowerManagement
+//|     """The radio sleeps between beacons and wakes for every DTIM beacon, so queued packets are
+//|     received within one DTIM interval."""
+//|
+//|     MAX: PowerManagement
+//|     """The radio sleeps for `wifi.Radio.listen_interval` beacons at a time. Lowest power use, but
+//|     incoming packets can wait that long."""
+//|
+//|     UNKNOWN: PowerManagement
+//|     """Power management was set some other way, such as with `cyw43.set_power_management()`."""
+//|
+MAKE_ENUM_MAP(wifi_power_management) {
+    MAKE_ENUM_MAP_ENTRY(power_management, NONE),
+    MAKE_ENUM_MAP_ENTRY(power_management, MIN),
+    MAKE_ENUM_MAP_ENTRY(power_management, MAX),
+    MAKE_ENUM_MAP_ENTRY(power_management, UNKNOWN),
+};
+STATIC MP_DEFINE_CONST_DICT(wifi_power_management_locals_dict, wifi_power_management_locals_table);
+
+MAKE_PRINTER(wifi, wifi_power_management);
+
+MAKE_ENUM_TYPE(wifi, PowerManagement, wifi_power_management);
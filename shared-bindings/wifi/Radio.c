@@ -206,6 +206,86 @@ MP_PROPERTY_GETSET(wifi_radio_tx_power_obj,
     (mp_obj_t)&wifi_radio_get_tx_power_obj,
     (mp_obj_t)&wifi_radio_set_tx_power_obj);
 
+//|     power_management: PowerManagement
+//|     """Wifi power management setting. See `wifi.PowerManagement`. The radio stays associated
+//|     through `alarm.light_sleep_until_alarms()`, so this setting decides how much it draws
+//|     while the device waits there.
+//|
+//|     **Limitations:** `wifi.PowerManagement.UNKNOWN` can be read but not set."""
+STATIC mp_obj_t wifi_radio_get_power_management(mp_obj_t self_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return cp_enum_find(&wifi_power_management_type, common_hal_wifi_radio_get_power_management(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_power_management_obj, wifi_radio_get_power_management);
+
+STATIC mp_obj_t wifi_radio_set_power_management(mp_obj_t self_in, mp_obj_t power_management_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    wifi_power_management_t power_management =
+        cp_enum_value(&wifi_power_management_type, power_management_in, MP_QSTR_power_management);
+    if (power_management == POWER_MANAGEMENT_UNKNOWN) {
+        mp_arg_error_invalid(MP_QSTR_power_management);
+    }
+    common_hal_wifi_radio_set_power_management(self, power_management);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(wifi_radio_set_power_management_obj, wifi_radio_set_power_management);
+
+MP_PROPERTY_GETSET(wifi_radio_power_management_obj,
+    (mp_obj_t)&wifi_radio_get_power_management_obj,
+    (mp_obj_t)&wifi_radio_set_power_management_obj);
+
+//|     listen_interval: int
+//|     """Number of beacon intervals the radio may sleep for at a time under
+//|     `wifi.PowerManagement.MAX`. The access point is told this value when the station
+//|     connects, so a change takes effect at the next `connect()`.
+//|
+//|     **Limitations:** On boards using the CYW43 radio module, the value must be in 1-15."""
+STATIC mp_obj_t wifi_radio_get_listen_interval(mp_obj_t self_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_wifi_radio_get_listen_interval(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_listen_interval_obj, wifi_radio_get_listen_interval);
+
+STATIC mp_obj_t wifi_radio_set_listen_interval(mp_obj_t self_in, mp_obj_t listen_interval_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_wifi_radio_set_listen_interval(self, mp_obj_get_int(listen_interval_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(wifi_radio_set_listen_interval_obj, wifi_radio_set_listen_interval);
+
+MP_PROPERTY_GETSET(wifi_radio_listen_interval_obj,
+    (mp_obj_t)&wifi_radio_get_listen_interval_obj,
+    (mp_obj_t)&wifi_radio_set_listen_interval_obj);
+
+//|     pbuf_pool_exhausted: int
+//|     """Number of times the network stack ran out of packet buffers since startup. If this
+//|        keeps growing, incoming packets are being dropped.
+//|
+//|     **Limitations:** Raises `NotImplementedError` on boards where the network stack
+//|     is built without statistics."""
+STATIC mp_obj_t wifi_radio_get_pbuf_pool_exhausted(mp_obj_t self_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(common_hal_wifi_radio_get_pbuf_pool_exhausted(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_pbuf_pool_exhausted_obj, wifi_radio_get_pbuf_pool_exhausted);
+
+MP_PROPERTY_GETTER(wifi_radio_pbuf_pool_exhausted_obj,
+    (mp_obj_t)&wifi_radio_get_pbuf_pool_exhausted_obj);
+
+//|     tcp_retransmits: int
+//|     """Number of TCP segments retransmitted since startup.
+//|
+//|     **Limitations:** Raises `NotImplementedError` on boards where the network stack
+//|     is built without statistics."""
+STATIC mp_obj_t wifi_radio_get_tcp_retransmits(mp_obj_t self_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(common_hal_wifi_radio_get_tcp_retransmits(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_tcp_retransmits_obj, wifi_radio_get_tcp_retransmits);
+
+MP_PROPERTY_GETTER(wifi_radio_tcp_retransmits_obj,
+    (mp_obj_t)&wifi_radio_get_tcp_retransmits_obj);
+
 //|     mac_address_ap: ReadableBuffer
 //|     """MAC address for the AP. When the address is altered after interface is started
 //|        the changes would only be reflected once the interface restarts.
@@ -725,6 +805,10 @@ STATIC const mp_rom_map_elem_t wifi_radio_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_mac_address_ap), MP_ROM_PTR(&wifi_radio_mac_address_ap_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_tx_power), MP_ROM_PTR(&wifi_radio_tx_power_obj) },
+    { MP_ROM_QSTR(MP_QSTR_power_management), MP_ROM_PTR(&wifi_radio_power_management_obj) },
+    { MP_ROM_QSTR(MP_QSTR_listen_interval), MP_ROM_PTR(&wifi_radio_listen_interval_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pbuf_pool_exhausted), MP_ROM_PTR(&wifi_radio_pbuf_pool_exhausted_obj) },
+    { MP_ROM_QSTR(MP_QSTR_tcp_retransmits), MP_ROM_PTR(&wifi_radio_tcp_retransmits_obj) },
     { MP_ROM_QSTR(MP_QSTR_start_scanning_networks),    MP_ROM_PTR(&wifi_radio_start_scanning_networks_obj) },
     { MP_ROM_QSTR(MP_QSTR_stop_scanning_networks),    MP_ROM_PTR(&wifi_radio_stop_scanning_networks_obj) },
 
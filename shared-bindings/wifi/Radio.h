@@ -30,6 +30,7 @@
 #include <stdint.h>
 
 #include "common-hal/wifi/Radio.h"
+#include "shared-bindings/wifi/PowerManagement.h"
 
 #include "py/objstr.h"
 
@@ -87,6 +88,14 @@ extern void common_hal_wifi_radio_set_mac_address_ap(wifi_radio_obj_t *self, con
 extern mp_float_t common_hal_wifi_radio_get_tx_power(wifi_radio_obj_t *self);
 extern void common_hal_wifi_radio_set_tx_power(wifi_radio_obj_t *self, const mp_float_t power);
 
+extern wifi_power_management_t common_hal_wifi_radio_get_power_management(wifi_radio_obj_t *self);
+extern void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_power_management_t power_management);
+extern mp_int_t common_hal_wifi_radio_get_listen_interval(wifi_radio_obj_t *self);
+extern void common_hal_wifi_radio_set_listen_interval(wifi_radio_obj_t *self, mp_int_t listen_interval);
+
+extern mp_int_t common_hal_wifi_radio_get_pbuf_pool_exhausted(wifi_radio_obj_t *self);
+extern mp_int_t common_hal_wifi_radio_get_tcp_retransmits(wifi_radio_obj_t *self);
+
 extern mp_obj_t common_hal_wifi_radio_start_scanning_networks(wifi_radio_obj_t *self, uint8_t start_channel, uint8_t stop_channel);
 extern void common_hal_wifi_radio_stop_scanning_networks(wifi_radio_obj_t *self);
 
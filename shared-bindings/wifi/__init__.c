@@ -29,6 +29,7 @@
 #include "shared-bindings/wifi/Network.h"
 #include "shared-bindings/wifi/Monitor.h"
 #include "shared-bindings/wifi/Packet.h"
+#include "shared-bindings/wifi/PowerManagement.h"
 #include "shared-bindings/wifi/Radio.h"
 
 //| """
@@ -58,6 +59,7 @@ STATIC const mp_rom_map_elem_t wifi_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_Monitor),     MP_ROM_PTR(&wifi_monitor_type) },
     { MP_ROM_QSTR(MP_QSTR_Network),     MP_ROM_PTR(&wifi_network_type) },
     { MP_ROM_QSTR(MP_QSTR_Packet),      MP_ROM_PTR(&wifi_packet_type) },
+    { MP_ROM_QSTR(MP_QSTR_PowerManagement), MP_ROM_PTR(&wifi_power_management_type) },
     { MP_ROM_QSTR(MP_QSTR_Radio),       MP_ROM_PTR(&wifi_radio_type) },
 
     // Properties
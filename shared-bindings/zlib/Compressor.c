@@ -0,0 +1,122 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+
+#include "shared-bindings/util.h"
+#include "shared-bindings/zlib/Compressor.h"
+
+//| class Compressor:
+//|     """Incrementally compress data"""
+//|
+//|     def __init__(self, level: int = -1, wbits: int = 15) -> None:
+//|         """Create a compressor producing a DEFLATE stream in pieces, for
+//|         data that is produced gradually or is too large to hold in memory
+//|         at once.
+//|
+//|         *level* trades speed for compression, from 1 (fastest) to 9 (best);
+//|         -1 is the default of 6, and 0 disables matching so that only
+//|         Huffman coding is done.
+//|
+//|         *wbits* chooses the format as for `zlib.decompress`: 9 to 15 for a
+//|         zlib stream, 25 to 31 for a gzip stream, or -9 to -15 for a raw
+//|         DEFLATE stream. To limit memory use, the history window may be
+//|         smaller than requested; the compressor needs about 7kB of RAM.
+//|
+//|         :param int level: compression level, see above
+//|         :param int wbits: output format and window size, see above"""
+//|         ...
+STATIC mp_obj_t zlib_compressor_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_level, ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_level, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 15} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    zlib_compressor_obj_t *self = m_new_obj(zlib_compressor_obj_t);
+    self->base.type = &zlib_compressor_type;
+    common_hal_zlib_compressor_construct(self, args[ARG_level].u_int, args[ARG_wbits].u_int);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC zlib_compressor_obj_t *native_compressor(mp_obj_t self_in) {
+    zlib_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_zlib_compressor_deinited(self)) {
+        raise_deinited_error();
+    }
+    return self;
+}
+
+//|     def compress(self, data: ReadableBuffer) -> bytes:
+//|         """Compress *data*, returning whatever compressed output is ready.
+//|         Some input may be held back until a later call to `compress` or `flush`.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer data: data to compress
+//|         :return: the next part of the compressed stream, possibly empty"""
+//|         ...
+STATIC mp_obj_t zlib_compressor_compress(mp_obj_t self_in, mp_obj_t data) {
+    zlib_compressor_obj_t *self = native_compressor(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+
+    vstr_t vstr;
+    vstr_init(&vstr, bufinfo.len / 2 + 16);
+    common_hal_zlib_compressor_compress(self, bufinfo.buf, bufinfo.len, &vstr);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(zlib_compressor_compress_obj, zlib_compressor_compress);
+
+//|     def flush(self) -> bytes:
+//|         """Finish the stream, returning the remaining compressed output.
+//|         The compressor cannot be used afterwards.
+//|
+//|         :return: the end of the compressed stream"""
+//|         ...
+//|
+STATIC mp_obj_t zlib_compressor_flush(mp_obj_t self_in) {
+    zlib_compressor_obj_t *self = native_compressor(self_in);
+
+    vstr_t vstr;
+    vstr_init(&vstr, 2 * self->window_size);
+    common_hal_zlib_compressor_flush(self, &vstr);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(zlib_compressor_flush_obj, zlib_compressor_flush);
+
+STATIC const mp_rom_map_elem_t zlib_compressor_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&zlib_compressor_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&zlib_compressor_flush_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(zlib_compressor_locals_dict, zlib_compressor_locals_dict_table);
+
+const mp_obj_type_t zlib_compressor_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Compressor,
+    .make_new = zlib_compressor_make_new,
+    .locals_dict = (mp_obj_dict_t *)&zlib_compressor_locals_dict,
+};
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared-bindings/zlib/DecompIO.h"
+#include "supervisor/shared/translate/translate.h"
+
+//| class DecompIO:
+//|     """Incrementally decompress data read from a stream"""
+//|
+//|     def __init__(self, stream: typing.BinaryIO, wbits: int = 0) -> None:
+//|         """Create a stream wrapper which allows transparent decompression of
+//|         compressed data in another *stream*. This allows processing compressed
+//|         streams with data larger than available heap size. Only a window of
+//|         ``2**(wbits & 15)`` bytes (at most 32kB) is kept in memory, in addition
+//|         to the caller's buffer and a small input buffer.
+//|
+//|         *wbits* chooses the format and window size as for `zlib.decompress`:
+//|
+//|         * 0 to read a zlib header and use the window size it specifies
+//|         * 8 to 15 to read a zlib header
+//|         * 24 to 31 to read a gzip header, with a window of ``2**(wbits - 16)`` bytes
+//|         * -8 to -15 for a raw DEFLATE stream with a window of ``2**(-wbits)`` bytes
+//|
+//|         Input is read from *stream* in small chunks, so a few bytes after the
+//|         end of the compressed data may be consumed from *stream*.
+//|
+//|         :param typing.BinaryIO stream: stream providing the compressed data
+//|         :param int wbits: window size and header format, see above"""
+//|         ...
+STATIC mp_obj_t zlib_decompio_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_stream, ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_stream, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_get_stream_raise(args[ARG_stream].u_obj, MP_STREAM_OP_READ);
+
+    zlib_decompio_obj_t *self = m_new_obj(zlib_decompio_obj_t);
+    self->base.type = &zlib_decompio_type;
+    common_hal_zlib_decompio_construct(self, args[ARG_stream].u_obj, args[ARG_wbits].u_int);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// These are standard stream methods. Code is in py/stream.c.
+//
+//|     def read(self, nbytes: Optional[int] = None) -> Optional[bytes]:
+//|         """Read and decompress up to *nbytes* bytes. If *nbytes* is not
+//|         given, decompress until the end of the compressed data.
+//|
+//|         :return: Data read
+//|         :rtype: bytes"""
+//|         ...
+//|     def readinto(self, buf: WriteableBuffer, nbytes: Optional[int] = None) -> Optional[int]:
+//|         """Decompress into ``buf``.  If ``nbytes`` is specified then read at most
+//|         that many bytes.  Otherwise, read at most ``len(buf)`` bytes.
+//|
+//|         :return: number of bytes read and stored into ``buf``; 0 at the end of the data
+//|         :rtype: int"""
+//|         ...
+//|     def readline(self) -> bytes:
+//|         """Decompress a line, up to and including the newline.
+//|
+//|         :return: the line read
+//|         :rtype: bytes"""
+//|         ...
+//|
+
+STATIC mp_uint_t zlib_decompio_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
+    zlib_decompio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_zlib_decompio_readinto(self, buf, size, errcode);
+}
+
+STATIC const mp_rom_map_elem_t zlib_decompio_locals_dict_table[] = {
+    // Standard stream methods.
+    { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(zlib_decompio_locals_dict, zlib_decompio_locals_dict_table);
+
+STATIC const mp_stream_p_t zlib_decompio_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .read = zlib_decompio_read,
+    .is_text = false,
+};
+
+const mp_obj_type_t zlib_decompio_type = {
+    { &mp_type_type },
+    .flags = MP_TYPE_FLAG_EXTENDED,
+    .name = MP_QSTR_DecompIO,
+    .make_new = zlib_decompio_make_new,
+    .locals_dict = (mp_obj_dict_t *)&zlib_decompio_locals_dict,
+    MP_TYPE_EXTENDED_FIELDS(
+        .protocol = &zlib_decompio_stream_p,
+        ),
+};
@@ -38,14 +38,16 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/Compressor.h"
+#include "shared-bindings/zlib/DecompIO.h"
 
 #include "supervisor/shared/translate/translate.h"
 
-//| """zlib decompression functionality
+//| """zlib compression and decompression functionality
 //|
 //| The `zlib` module allows limited functionality similar to the CPython zlib library.
-//| This module allows to decompress binary data compressed with DEFLATE algorithm
-//| (commonly used in zlib library and gzip archiver). Compression is not yet implemented."""
+//| This module allows to compress binary data with the DEFLATE algorithm
+//| (commonly used in zlib library and gzip archiver), and to decompress it."""
 //|
 
 //| def zlib_decompress(
@@ -68,23 +70,51 @@
 //|
 //|     :param bytes data: data to be decompressed
 //|     :param int wbits: DEFLATE dictionary window size used during compression. See above.
-//|     :param int bufsize: ignored for compatibility with CPython only
+//|     :param int bufsize: initial size of the output buffer. If the decompressed
+//|         size is known in advance, passing it avoids growing the buffer while
+//|         decompressing. The buffer still grows as needed if it is too small.
 //|     """
 //|     ...
 //|
 STATIC mp_obj_t zlib_decompress(size_t n_args, const mp_obj_t *args) {
-    bool is_zlib = true;
-    if (n_args > 1 && MP_OBJ_SMALL_INT_VALUE(args[1]) < 0) {
-        is_zlib = false;
-    }
+    mp_int_t wbits = n_args > 1 ? mp_obj_get_int(args[1]) : 0;
+    mp_int_t bufsize = n_args > 2 ? mp_obj_get_int(args[2]) : 0;
 
-    return common_hal_zlib_decompress(args[0], is_zlib);
+    return common_hal_zlib_decompress(args[0], wbits, bufsize);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj, 1, 3, zlib_decompress);
 
+//| def compress(data: ReadableBuffer, level: int = -1, wbits: int = 15) -> bytes:
+//|     """Return *data* compressed with the DEFLATE algorithm. *level* and *wbits*
+//|     are as for `Compressor`: the default produces a zlib stream, 31 a gzip
+//|     stream and -15 a raw DEFLATE stream.
+//|
+//|     :param ~circuitpython_typing.ReadableBuffer data: data to be compressed
+//|     :param int level: compression level, from 0 to 9, or -1 for the default
+//|     :param int wbits: output format and window size
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t zlib_compress(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_level, ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_level, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 15} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return common_hal_zlib_compress(args[ARG_data].u_obj, args[ARG_level].u_int, args[ARG_wbits].u_int);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(zlib_compress_obj, 1, zlib_compress);
+
 STATIC const mp_rom_map_elem_t zlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_zlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&zlib_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Compressor), MP_ROM_PTR(&zlib_compressor_type) },
+    { MP_ROM_QSTR(MP_QSTR_DecompIO), MP_ROM_PTR(&zlib_decompio_type) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(zlib_globals, zlib_globals_table);
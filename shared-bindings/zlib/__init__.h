@@ -27,6 +27,7 @@
 #ifndef MICROPY_INCLUDED_SHARED_BINDINGS_ZLIB___INIT___H
 #define MICROPY_INCLUDED_SHARED_BINDINGS_ZLIB___INIT___H
 
-mp_obj_t common_hal_zlib_decompress(mp_obj_t data, bool is_zlib);
+mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits, mp_int_t bufsize);
+mp_obj_t common_hal_zlib_compress(mp_obj_t data, mp_int_t level, mp_int_t wbits);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_ZLIB___INIT___H
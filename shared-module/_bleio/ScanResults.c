@@ -29,30 +29,38 @@
 #include <string.h>
 
 #include "shared/runtime/interrupt_char.h"
+#include "py/gc.h"
 #include "py/objstr.h"
 #include "py/runtime.h"
 #include "shared-bindings/_bleio/ScanEntry.h"
 #include "shared-bindings/_bleio/ScanResults.h"
 
-bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi) {
+bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len,
+    uint8_t *services, size_t services_length, bool remove_duplicates, mp_int_t minimum_rssi) {
     bleio_scanresults_obj_t *self = m_new_obj(bleio_scanresults_obj_t);
     self->base.type = &bleio_scanresults_type;
     ringbuf_alloc(&self->buf, buffer_size, false);
     self->prefixes = prefixes;
     self->prefix_length = prefixes_len;
+    self->services = services;
+    self->services_length = services_length;
+    self->remove_duplicates = remove_duplicates;
+    memset(self->recent, 0, sizeof(self->recent));
+    self->recent_index = 0;
     self->minimum_rssi = minimum_rssi;
     return self;
 }
 
-mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
+// Wait for the next packet and fill entry in from it, reusing the entry's address
+// and data when they can hold it. Returns false if there are no more packets.
+STATIC bool scanresults_get(bleio_scanresults_obj_t *self, bleio_scanentry_obj_t *entry) {
     while (ringbuf_num_filled(&self->buf) == 0 && !self->done && !mp_hal_is_interrupted()) {
         RUN_BACKGROUND_TASKS;
     }
     if (ringbuf_num_filled(&self->buf) == 0 || mp_hal_is_interrupted()) {
-        return mp_const_none;
+        return false;
     }
 
-    // Create a ScanEntry out of the data on the buffer.
     uint8_t type = ringbuf_get(&self->buf);
     bool connectable = (type & (1 << 0)) != 0;
     bool scan_response = (type & (1 << 1)) != 0;
@@ -65,26 +73,118 @@ mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     uint16_t len;
     ringbuf_get_n(&self->buf, (uint8_t *)&len, sizeof(len));
 
-    mp_obj_str_t *o = MP_OBJ_TO_PTR(mp_obj_new_bytes_of_zeros(len));
+    mp_obj_str_t *o = entry->data;
+    if (o != NULL && gc_nbytes(o->data) > len) {
+        o->len = len;
+    } else {
+        o = MP_OBJ_TO_PTR(mp_obj_new_bytes_of_zeros(len));
+    }
     ringbuf_get_n(&self->buf, (uint8_t *)o->data, len);
+    // bytes objects are NUL terminated, and a reused one may be longer than len
+    ((byte *)o->data)[len] = '\0';
+    o->hash = qstr_compute_hash(o->data, len);
 
-    bleio_scanentry_obj_t *entry = m_new_obj(bleio_scanentry_obj_t);
-    entry->base.type = &bleio_scanentry_type;
-    entry->rssi = rssi;
-
-    bleio_address_obj_t *address = m_new_obj(bleio_address_obj_t);
-    address->base.type = &bleio_address_type;
-    common_hal_bleio_address_construct(MP_OBJ_TO_PTR(address), peer_addr, addr_type);
-    entry->address = address;
+    if (entry->address == NULL) {
+        bleio_address_obj_t *address = m_new_obj(bleio_address_obj_t);
+        address->base.type = &bleio_address_type;
+        common_hal_bleio_address_construct(address, peer_addr, addr_type);
+        entry->address = address;
+    } else {
+        // Overwrite the address in place instead of allocating new bytes for it.
+        mp_obj_str_t *address_bytes = MP_OBJ_TO_PTR(entry->address->bytes);
+        memcpy((uint8_t *)address_bytes->data, peer_addr, NUM_BLEIO_ADDRESS_BYTES);
+        address_bytes->hash = qstr_compute_hash(address_bytes->data, NUM_BLEIO_ADDRESS_BYTES);
+        entry->address->type = addr_type;
+    }
 
+    entry->rssi = rssi;
     entry->data = o;
     entry->time_received = ticks_ms;
     entry->connectable = connectable;
     entry->scan_response = scan_response;
+    return true;
+}
 
+mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
+    // Create a ScanEntry out of the data on the buffer.
+    bleio_scanentry_obj_t *entry = m_new_obj(bleio_scanentry_obj_t);
+    entry->base.type = &bleio_scanentry_type;
+    entry->address = NULL;
+    entry->data = NULL;
+    if (!scanresults_get(self, entry)) {
+        m_del_obj(bleio_scanentry_obj_t, entry);
+        return mp_const_none;
+    }
     return MP_OBJ_FROM_PTR(entry);
 }
 
+bool common_hal_bleio_scanresults_next_into(bleio_scanresults_obj_t *self, bleio_scanentry_obj_t *entry) {
+    return scanresults_get(self, entry);
+}
+
+// Whether an advertising structure lists or carries data for one of the services.
+STATIC bool data_has_service(const uint8_t *data, size_t len, const uint8_t *services, size_t services_length) {
+    if (services_length == 0) {
+        return true;
+    }
+    size_t i = 0;
+    while (i + 1 < len) {
+        uint8_t structure_length = data[i];
+        if (structure_length == 0 || i + 1 + structure_length > len) {
+            return false;
+        }
+        const uint8_t *structure_end = data + i + 1 + structure_length;
+        const uint8_t *uuid = data + i + 2;
+        size_t uuid_size = 0;
+        bool list = true;
+        switch (data[i + 1]) {
+            case 0x02: // Incomplete list of 16-bit service UUIDs
+            case 0x03: // Complete list of 16-bit service UUIDs
+                uuid_size = 2;
+                break;
+            case 0x06: // Incomplete list of 128-bit service UUIDs
+            case 0x07: // Complete list of 128-bit service UUIDs
+                uuid_size = 16;
+                break;
+            case 0x16: // Service data with a 16-bit UUID
+                uuid_size = 2;
+                list = false;
+                break;
+            case 0x21: // Service data with a 128-bit UUID
+                uuid_size = 16;
+                list = false;
+                break;
+        }
+        for (; uuid_size > 0 && uuid + uuid_size <= structure_end; uuid += uuid_size) {
+            for (size_t j = 0; j < services_length; j += 1 + services[j]) {
+                if (services[j] == uuid_size && memcmp(services + j + 1, uuid, uuid_size) == 0) {
+                    return true;
+                }
+            }
+            if (!list) {
+                break;
+            }
+        }
+        i += 1 + structure_length;
+    }
+    return false;
+}
+
+// FNV-1a, over what makes an advertisement the same as one already kept.
+STATIC uint32_t advertisement_hash(bool scan_response, const uint8_t *peer_addr, uint8_t addr_type,
+    const uint8_t *data, uint16_t len) {
+    uint32_t hash = 2166136261u;
+    hash = (hash ^ scan_response) * 16777619u;
+    hash = (hash ^ addr_type) * 16777619u;
+    for (size_t i = 0; i < NUM_BLEIO_ADDRESS_BYTES; i++) {
+        hash = (hash ^ peer_addr[i]) * 16777619u;
+    }
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    // Zero marks an unused slot.
+    return hash | 1;
+}
 
 void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
     uint64_t ticks_ms,
@@ -95,6 +195,21 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
     uint8_t addr_type,
     const uint8_t *data,
     uint16_t len) {
+    // Filter the packet before anything is stored.
+    if (rssi < self->minimum_rssi) {
+        return;
+    }
+
+    // If any prefixes are provided, then only include packets that include at least one of them.
+    if (!bleio_scanentry_data_matches(data, len, self->prefixes, self->prefix_length, true)) {
+        return;
+    }
+
+    // Likewise for services.
+    if (!data_has_service(data, len, self->services, self->services_length)) {
+        return;
+    }
+
     int32_t packet_size = sizeof(uint8_t) + sizeof(ticks_ms) + sizeof(rssi) + NUM_BLEIO_ADDRESS_BYTES +
         sizeof(addr_type) + sizeof(len) + len;
     int32_t empty_space = self->buf.size - ringbuf_num_filled(&self->buf);
@@ -102,15 +217,18 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
         // We can't fit the packet so skip it.
         return;
     }
-    // Filter the packet.
-    if (rssi < self->minimum_rssi) {
-        return;
-    }
 
-    // If any prefixes are provided, then only include packets that include at least one of them.
-    if (!bleio_scanentry_data_matches(data, len, self->prefixes, self->prefix_length, true)) {
-        return;
+    if (self->remove_duplicates) {
+        uint32_t hash = advertisement_hash(scan_response, peer_addr, addr_type, data, len);
+        for (size_t i = 0; i < BLEIO_SCANRESULTS_RECENT; i++) {
+            if (self->recent[i] == hash) {
+                return;
+            }
+        }
+        self->recent[self->recent_index] = hash;
+        self->recent_index = (self->recent_index + 1) % BLEIO_SCANRESULTS_RECENT;
     }
+
     uint8_t type = 0;
     if (connectable) {
         type |= 1 << 0;
@@ -33,6 +33,9 @@
 #include "py/obj.h"
 #include "py/ringbuf.h"
 
+// How many recent advertisements duplicates are looked for among.
+#define BLEIO_SCANRESULTS_RECENT (16)
+
 typedef struct {
     mp_obj_base_t base;
     // Pointers that needs to live until the scan is done.
@@ -41,12 +44,20 @@ typedef struct {
     // Prefixes is a length encoded array of prefixes.
     uint8_t *prefixes;
     size_t prefix_length;
+    // Services is a length encoded array of service UUIDs, least significant byte first.
+    uint8_t *services;
+    size_t services_length;
     mp_int_t minimum_rssi;
+    // Hashes of the most recently kept advertisements, when duplicates are removed.
+    uint32_t recent[BLEIO_SCANRESULTS_RECENT];
+    uint8_t recent_index;
+    bool remove_duplicates;
     bool active;
     bool done;
 } bleio_scanresults_obj_t;
 
-bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi);
+bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len,
+    uint8_t *services, size_t services_length, bool remove_duplicates, mp_int_t minimum_rssi);
 
 bool shared_module_bleio_scanresults_get_done(bleio_scanresults_obj_t *self);
 void shared_module_bleio_scanresults_set_done(bleio_scanresults_obj_t *self, bool done);
@@ -31,6 +31,27 @@
 #include "shared-bindings/_stage/Text.h"
 
 
+// Get the rows and columns covered by a layer or text, or return false
+// if it isn't one.
+STATIC bool get_bounds(mp_obj_t obj_in, int32_t *left, int32_t *top, int32_t *right, int32_t *bottom) {
+    layer_obj_t *obj = MP_OBJ_TO_PTR(obj_in);
+    if (obj->base.type == &mp_type_layer) {
+        *left = obj->x;
+        *top = obj->y;
+        *right = obj->x + (obj->width << 4);
+        *bottom = obj->y + (obj->height << 4);
+    } else if (obj->base.type == &mp_type_text) {
+        text_obj_t *text = (text_obj_t *)obj;
+        *left = text->x;
+        *top = text->y;
+        *right = text->x + (text->width << 3);
+        *bottom = text->y + (text->height << 3);
+    } else {
+        return false;
+    }
+    return true;
+}
+
 void render_stage(
     uint16_t x0, uint16_t y0,
     uint16_t x1, uint16_t y1,
@@ -54,13 +75,42 @@ void render_stage(
     display->core.send(display->core.bus, DISPLAY_COMMAND,
         CHIP_SELECT_TOGGLE_EVERY_BYTE,
         &display->write_ram_command, 1);
+
+    // Only the layers that overlap the fragment are looked at, and of those
+    // only the ones that overlap the current row, keeping their order.
+    mp_obj_t visible[layers_size + 1];
+    int32_t visible_top[layers_size + 1];
+    int32_t visible_bottom[layers_size + 1];
+    size_t visible_size = 0;
+    for (size_t layer = 0; layer < layers_size; ++layer) {
+        int32_t left, top, right, bottom;
+        if (!get_bounds(layers[layer], &left, &top, &right, &bottom)) {
+            continue;
+        }
+        if (right <= x0 + vx || left >= x1 + vx || bottom <= y0 + vy || top >= y1 + vy) {
+            continue;
+        }
+        visible[visible_size] = layers[layer];
+        visible_top[visible_size] = top;
+        visible_bottom[visible_size] = bottom;
+        visible_size += 1;
+    }
+    mp_obj_t row_layers[visible_size + 1];
+
     size_t index = 0;
     for (int16_t y = y0 + vy; y < y1 + vy; ++y) {
+        size_t row_layers_size = 0;
+        for (size_t layer = 0; layer < visible_size; ++layer) {
+            if (visible_top[layer] <= y && y < visible_bottom[layer]) {
+                row_layers[row_layers_size] = visible[layer];
+                row_layers_size += 1;
+            }
+        }
         for (uint8_t yscale = 0; yscale < scale; ++yscale) {
             for (int16_t x = x0 + vx; x < x1 + vx; ++x) {
                 uint16_t c = TRANSPARENT;
-                for (size_t layer = 0; layer < layers_size; ++layer) {
-                    layer_obj_t *obj = MP_OBJ_TO_PTR(layers[layer]);
+                for (size_t layer = 0; layer < row_layers_size; ++layer) {
+                    layer_obj_t *obj = MP_OBJ_TO_PTR(row_layers[layer]);
                     if (obj->base.type == &mp_type_layer) {
                         c = get_layer_pixel(obj, x, y);
                     } else if (obj->base.type == &mp_type_text) {
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/misc.h"
+#include "shared-module/adafruit_bus_device/__init__.h"
+
+void busdevice_register_cache_init(busdevice_register_cache_t *self, bool enabled) {
+    self->values = enabled ? m_new(uint8_t, BUSDEVICE_REGISTER_COUNT) : NULL;
+    memset(self->valid, 0, sizeof(self->valid));
+}
+
+static bool register_cached(busdevice_register_cache_t *self, size_t reg) {
+    return (self->valid[reg / 32] & (1u << (reg % 32))) != 0;
+}
+
+bool busdevice_register_cache_get(busdevice_register_cache_t *self, uint8_t reg, uint8_t *buf, size_t len) {
+    if (self->values == NULL || reg + len > BUSDEVICE_REGISTER_COUNT) {
+        return false;
+    }
+    for (size_t i = reg; i < reg + len; i++) {
+        if (!register_cached(self, i)) {
+            return false;
+        }
+    }
+    memcpy(buf, self->values + reg, len);
+    return true;
+}
+
+void busdevice_register_cache_put(busdevice_register_cache_t *self, uint8_t reg, const uint8_t *buf, size_t len) {
+    if (self->values == NULL || reg + len > BUSDEVICE_REGISTER_COUNT) {
+        return;
+    }
+    memcpy(self->values + reg, buf, len);
+    for (size_t i = reg; i < reg + len; i++) {
+        self->valid[i / 32] |= 1u << (i % 32);
+    }
+}
@@ -0,0 +1,49 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_BUSDEVICE___INIT___H
+#define MICROPY_INCLUDED_SHARED_MODULE_BUSDEVICE___INIT___H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BUSDEVICE_REGISTER_COUNT (256)
+
+// Shadow copies of a device's 8-bit addressed registers, as last written or read,
+// so that registers that can't be read back can still be read-modify-written.
+typedef struct {
+    uint8_t *values; // BUSDEVICE_REGISTER_COUNT bytes, or NULL if registers aren't cached.
+    uint32_t valid[BUSDEVICE_REGISTER_COUNT / 32];
+} busdevice_register_cache_t;
+
+void busdevice_register_cache_init(busdevice_register_cache_t *self, bool enabled);
+// Copy the cached values of len registers starting at reg into buf. Returns false,
+// without touching buf, unless all of them are cached.
+bool busdevice_register_cache_get(busdevice_register_cache_t *self, uint8_t reg, uint8_t *buf, size_t len);
+void busdevice_register_cache_put(busdevice_register_cache_t *self, uint8_t reg, const uint8_t *buf, size_t len);
+
+#endif  // MICROPY_INCLUDED_SHARED_MODULE_BUSDEVICE___INIT___H
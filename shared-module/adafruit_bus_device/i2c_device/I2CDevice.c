@@ -24,19 +24,50 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-bindings/adafruit_bus_device/i2c_device/I2CDevice.h"
 #include "shared-bindings/busio/I2C.h"
+#include "shared-bindings/util.h"
 #include "py/mperrno.h"
 #include "py/nlr.h"
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 
-void common_hal_adafruit_bus_device_i2cdevice_construct(adafruit_bus_device_i2cdevice_obj_t *self, mp_obj_t *i2c, uint8_t device_address) {
+void common_hal_adafruit_bus_device_i2cdevice_construct(adafruit_bus_device_i2cdevice_obj_t *self, mp_obj_t *i2c, uint8_t device_address, bool register_cache) {
     self->i2c = i2c;
     self->device_address = device_address;
+    busdevice_register_cache_init(&self->register_cache, register_cache);
+}
+
+#if CIRCUITPY_BUSIO
+// A busio.I2C is used directly, without looking up its methods.
+STATIC busio_i2c_obj_t *native_i2c(adafruit_bus_device_i2cdevice_obj_t *self) {
+    if (!mp_obj_is_type(MP_OBJ_FROM_PTR(self->i2c), &busio_i2c_type)) {
+        return NULL;
+    }
+    busio_i2c_obj_t *i2c = MP_OBJ_TO_PTR(self->i2c);
+    if (common_hal_busio_i2c_deinited(i2c)) {
+        raise_deinited_error();
+    }
+    return i2c;
 }
+#endif
 
 void common_hal_adafruit_bus_device_i2cdevice_lock(adafruit_bus_device_i2cdevice_obj_t *self) {
+    #if CIRCUITPY_BUSIO
+    busio_i2c_obj_t *i2c = native_i2c(self);
+    if (i2c != NULL) {
+        while (!common_hal_busio_i2c_try_lock(i2c)) {
+            RUN_BACKGROUND_TASKS;
+            if (mp_hal_is_interrupted()) {
+                break;
+            }
+        }
+        return;
+    }
+    #endif
+
     mp_obj_t dest[2];
     mp_load_method(self->i2c, MP_QSTR_try_lock, dest);
 
@@ -53,6 +84,14 @@ void common_hal_adafruit_bus_device_i2cdevice_lock(adafruit_bus_device_i2cdevice
 }
 
 void common_hal_adafruit_bus_device_i2cdevice_unlock(adafruit_bus_device_i2cdevice_obj_t *self) {
+    #if CIRCUITPY_BUSIO
+    busio_i2c_obj_t *i2c = native_i2c(self);
+    if (i2c != NULL) {
+        common_hal_busio_i2c_unlock(i2c);
+        return;
+    }
+    #endif
+
     mp_obj_t dest[2];
     mp_load_method(self->i2c, MP_QSTR_unlock, dest);
     mp_call_method_n_kw(0, 0, dest);
@@ -88,3 +127,61 @@ void common_hal_adafruit_bus_device_i2cdevice_probe_for_device(adafruit_bus_devi
 
     common_hal_adafruit_bus_device_i2cdevice_unlock(self);
 }
+
+// Write out_len bytes and then, if in_len isn't 0, read in_len bytes after a repeated start.
+STATIC void i2cdevice_transfer(adafruit_bus_device_i2cdevice_obj_t *self,
+    uint8_t *out, size_t out_len, uint8_t *in, size_t in_len) {
+    common_hal_adafruit_bus_device_i2cdevice_lock(self);
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        #if CIRCUITPY_BUSIO
+        busio_i2c_obj_t *i2c = native_i2c(self);
+        if (i2c != NULL) {
+            uint8_t status = in_len > 0 ?
+                common_hal_busio_i2c_write_read(i2c, self->device_address, out, out_len, in, in_len) :
+                common_hal_busio_i2c_write(i2c, self->device_address, out, out_len);
+            if (status != 0) {
+                mp_raise_OSError(status);
+            }
+        } else
+        #endif
+        {
+            mp_obj_t dest[5];
+            mp_load_method(self->i2c, in_len > 0 ? MP_QSTR_writeto_then_readfrom : MP_QSTR_writeto, dest);
+            dest[2] = MP_OBJ_NEW_SMALL_INT(self->device_address);
+            dest[3] = mp_obj_new_bytearray_by_ref(out_len, out);
+            if (in_len > 0) {
+                dest[4] = mp_obj_new_bytearray_by_ref(in_len, in);
+            }
+            mp_call_method_n_kw(in_len > 0 ? 3 : 2, 0, dest);
+        }
+        nlr_pop();
+    } else {
+        common_hal_adafruit_bus_device_i2cdevice_unlock(self);
+        nlr_jump(nlr.ret_val);
+    }
+
+    common_hal_adafruit_bus_device_i2cdevice_unlock(self);
+}
+
+void common_hal_adafruit_bus_device_i2cdevice_read_register(adafruit_bus_device_i2cdevice_obj_t *self, uint8_t reg, uint8_t *buf, size_t len, bool cached) {
+    if (cached && busdevice_register_cache_get(&self->register_cache, reg, buf, len)) {
+        return;
+    }
+    i2cdevice_transfer(self, &reg, 1, buf, len);
+    busdevice_register_cache_put(&self->register_cache, reg, buf, len);
+}
+
+void common_hal_adafruit_bus_device_i2cdevice_write_register(adafruit_bus_device_i2cdevice_obj_t *self, uint8_t reg, const uint8_t *buf, size_t len) {
+    // The register address and the data go out in one write.
+    uint8_t short_data[16];
+    uint8_t *data = len < sizeof(short_data) ? short_data : m_new(uint8_t, len + 1);
+    data[0] = reg;
+    memcpy(data + 1, buf, len);
+    i2cdevice_transfer(self, data, len + 1, NULL, 0);
+    if (data != short_data) {
+        m_del(uint8_t, data, len + 1);
+    }
+    busdevice_register_cache_put(&self->register_cache, reg, buf, len);
+}
@@ -29,11 +29,13 @@
 
 #include "py/obj.h"
 #include "common-hal/busio/I2C.h"
+#include "shared-module/adafruit_bus_device/__init__.h"
 
 typedef struct {
     mp_obj_base_t base;
     mp_obj_t *i2c;
     uint8_t device_address;
+    busdevice_register_cache_t register_cache;
 } adafruit_bus_device_i2cdevice_obj_t;
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_SHARED_MODULE_BUSDEVICE_I2CDEVICE_H
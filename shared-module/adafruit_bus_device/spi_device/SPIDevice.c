@@ -27,12 +27,13 @@
 #include "shared-bindings/adafruit_bus_device/spi_device/SPIDevice.h"
 #include "shared-bindings/busio/SPI.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-bindings/util.h"
 #include "py/mperrno.h"
 #include "py/nlr.h"
 #include "py/runtime.h"
 
 void common_hal_adafruit_bus_device_spidevice_construct(adafruit_bus_device_spidevice_obj_t *self, busio_spi_obj_t *spi,  digitalio_digitalinout_obj_t *cs,
-    bool cs_active_value, uint32_t baudrate, uint8_t polarity, uint8_t phase, uint8_t extra_clocks) {
+    bool cs_active_value, uint32_t baudrate, uint8_t polarity, uint8_t phase, uint8_t extra_clocks, bool register_cache) {
     self->spi = spi;
     self->baudrate = baudrate;
     self->polarity = polarity;
@@ -41,9 +42,35 @@ void common_hal_adafruit_bus_device_spidevice_construct(adafruit_bus_device_spid
     // May be mp_const_none if CS not used.
     self->chip_select = cs;
     self->cs_active_value = cs_active_value;
+    busdevice_register_cache_init(&self->register_cache, register_cache);
 }
 
+#if CIRCUITPY_BUSIO_SPI
+// A busio.SPI is used directly, without looking up its methods.
+STATIC busio_spi_obj_t *native_spi(adafruit_bus_device_spidevice_obj_t *self) {
+    if (!mp_obj_is_type(MP_OBJ_FROM_PTR(self->spi), &busio_spi_type)) {
+        return NULL;
+    }
+    if (common_hal_busio_spi_deinited(self->spi)) {
+        raise_deinited_error();
+    }
+    return self->spi;
+}
+#endif
+
 mp_obj_t common_hal_adafruit_bus_device_spidevice_enter(adafruit_bus_device_spidevice_obj_t *self) {
+    #if CIRCUITPY_BUSIO_SPI
+    busio_spi_obj_t *spi = native_spi(self);
+    if (spi != NULL) {
+        while (!common_hal_busio_spi_try_lock(spi)) {
+            mp_handle_pending(true);
+        }
+        if (!common_hal_busio_spi_configure(spi, self->baudrate, self->polarity, self->phase, 8)) {
+            common_hal_busio_spi_unlock(spi);
+            mp_raise_OSError(MP_EIO);
+        }
+    } else
+    #endif
     {
         mp_obj_t dest[2];
         mp_load_method(self->spi, MP_QSTR_try_lock, dest);
@@ -53,6 +80,9 @@ mp_obj_t common_hal_adafruit_bus_device_spidevice_enter(adafruit_bus_device_spid
         }
     }
 
+    #if CIRCUITPY_BUSIO_SPI
+    if (spi == NULL)
+    #endif
     {
         mp_obj_t dest[10];
         mp_load_method(self->spi, MP_QSTR_configure, dest);
@@ -74,6 +104,13 @@ mp_obj_t common_hal_adafruit_bus_device_spidevice_enter(adafruit_bus_device_spid
 }
 
 void common_hal_adafruit_bus_device_spidevice_exit(adafruit_bus_device_spidevice_obj_t *self) {
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+    // Finish any SPI.write_async() before deselecting the device.
+    if (mp_obj_is_type(MP_OBJ_FROM_PTR(self->spi), &busio_spi_type)) {
+        busio_spi_finish_background_write(self->spi);
+    }
+    #endif
+
     if (self->chip_select != mp_const_none) {
         common_hal_digitalio_digitalinout_set_value(MP_OBJ_TO_PTR(self->chip_select), !(self->cs_active_value));
     }
@@ -97,7 +134,65 @@ void common_hal_adafruit_bus_device_spidevice_exit(adafruit_bus_device_spidevice
         }
     }
 
+    #if CIRCUITPY_BUSIO_SPI
+    busio_spi_obj_t *spi = native_spi(self);
+    if (spi != NULL) {
+        common_hal_busio_spi_unlock(spi);
+        return;
+    }
+    #endif
+
     mp_obj_t dest[2];
     mp_load_method(self->spi, MP_QSTR_unlock, dest);
     mp_call_method_n_kw(0, 0, dest);
 }
+
+// Send the register byte and then either write or read len bytes, selecting the device around it.
+STATIC void spidevice_transfer(adafruit_bus_device_spidevice_obj_t *self, uint8_t reg,
+    const uint8_t *out, uint8_t *in, size_t len) {
+    common_hal_adafruit_bus_device_spidevice_enter(self);
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        #if CIRCUITPY_BUSIO_SPI
+        busio_spi_obj_t *spi = native_spi(self);
+        if (spi != NULL) {
+            bool ok = common_hal_busio_spi_write(spi, &reg, 1);
+            if (ok && len > 0) {
+                ok = in != NULL ? common_hal_busio_spi_read(spi, in, len, 0) : common_hal_busio_spi_write(spi, out, len);
+            }
+            if (!ok) {
+                mp_raise_OSError(MP_EIO);
+            }
+        } else
+        #endif
+        {
+            mp_obj_t dest[3];
+            mp_load_method(self->spi, MP_QSTR_write, dest);
+            dest[2] = mp_obj_new_bytearray_by_ref(1, &reg);
+            mp_call_method_n_kw(1, 0, dest);
+            mp_load_method(self->spi, in != NULL ? MP_QSTR_readinto : MP_QSTR_write, dest);
+            dest[2] = mp_obj_new_bytearray_by_ref(len, in != NULL ? in : (uint8_t *)out);
+            mp_call_method_n_kw(1, 0, dest);
+        }
+        nlr_pop();
+    } else {
+        common_hal_adafruit_bus_device_spidevice_exit(self);
+        nlr_jump(nlr.ret_val);
+    }
+
+    common_hal_adafruit_bus_device_spidevice_exit(self);
+}
+
+void common_hal_adafruit_bus_device_spidevice_read_register(adafruit_bus_device_spidevice_obj_t *self, uint8_t reg, uint8_t *buf, size_t len, bool cached) {
+    if (cached && busdevice_register_cache_get(&self->register_cache, reg, buf, len)) {
+        return;
+    }
+    spidevice_transfer(self, reg, NULL, buf, len);
+    busdevice_register_cache_put(&self->register_cache, reg, buf, len);
+}
+
+void common_hal_adafruit_bus_device_spidevice_write_register(adafruit_bus_device_spidevice_obj_t *self, uint8_t reg, const uint8_t *buf, size_t len) {
+    spidevice_transfer(self, reg, buf, NULL, len);
+    busdevice_register_cache_put(&self->register_cache, reg, buf, len);
+}
@@ -30,6 +30,7 @@
 #include "py/obj.h"
 #include "common-hal/busio/SPI.h"
 #include "common-hal/digitalio/DigitalInOut.h"
+#include "shared-module/adafruit_bus_device/__init__.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -40,6 +41,7 @@ typedef struct {
     uint8_t extra_clocks;
     digitalio_digitalinout_obj_t *chip_select;
     bool cs_active_value;
+    busdevice_register_cache_t register_cache;
 } adafruit_bus_device_spidevice_obj_t;
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_SHARED_MODULE_BUSDEVICE_SPIDEVICE_H
@@ -26,6 +26,8 @@
 
 
 #include "py/obj.h"
+#include "py/binary.h"
+#include "py/misc.h"
 #include "py/objstr.h"
 #include "py/objtype.h"
 #include "py/runtime.h"
@@ -42,9 +44,10 @@ static pixelbuf_pixelbuf_obj_t *native_pixelbuf(mp_obj_t pixelbuf_obj) {
 
 void common_hal_adafruit_pixelbuf_pixelbuf_construct(pixelbuf_pixelbuf_obj_t *self, size_t n,
     pixelbuf_byteorder_details_t *byteorder, mp_float_t brightness, bool auto_write,
-    uint8_t *header, size_t header_len, uint8_t *trailer, size_t trailer_len) {
+    uint8_t *header, size_t header_len, uint8_t *trailer, size_t trailer_len, bool preserve_colors) {
 
     self->pixel_count = n;
+    self->preserve_colors = preserve_colors;
     self->byteorder = *byteorder;  // Copied because we modify for dotstar
     self->bytes_per_pixel = byteorder->is_dotstar ? 4 : byteorder->bpp;
     self->auto_write = false;
@@ -118,6 +121,10 @@ void common_hal_adafruit_pixelbuf_pixelbuf_set_brightness(mp_obj_t self_in, mp_f
         return;
     }
     self->scaled_brightness = new_scaled_brightness;
+    if (!self->preserve_colors) {
+        // Without the original colors only pixels set from now on can use the new value.
+        return;
+    }
     size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
     if (self->scaled_brightness == 0x100 && !self->pre_brightness_buffer) {
         return;
@@ -202,43 +209,35 @@ void common_hal_adafruit_pixelbuf_pixelbuf_parse_color(mp_obj_t self_in, mp_obj_
     pixelbuf_parse_color(self, color, r, g, b, w);
 }
 
+static void pixelbuf_write_pixel(pixelbuf_pixelbuf_obj_t *self, uint8_t *buffer, uint8_t r, uint8_t g, uint8_t b, uint8_t w, uint16_t scale) {
+    pixelbuf_rgbw_t *rgbw_order = &self->byteorder.byteorder;
+    if (self->bytes_per_pixel == 4) {
+        // Don't adjust per-pixel luminance bytes in dotstar mode
+        if (!self->byteorder.is_dotstar) {
+            w = (w * scale) / 256;
+        }
+        buffer[rgbw_order->w] = w;
+    }
+    buffer[rgbw_order->r] = (r * scale) / 256;
+    buffer[rgbw_order->g] = (g * scale) / 256;
+    buffer[rgbw_order->b] = (b * scale) / 256;
+}
+
 static void pixelbuf_set_pixel_color(pixelbuf_pixelbuf_obj_t *self, size_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
     // DotStars don't have white, instead they have 5 bit brightness so pack it into w. Shift right
     // by three to leave the top five bits.
     if (self->bytes_per_pixel == 4 && self->byteorder.is_dotstar) {
         w = DOTSTAR_LED_START | w >> 3;
     }
-    pixelbuf_rgbw_t *rgbw_order = &self->byteorder.byteorder;
     size_t offset = index * self->bytes_per_pixel;
-    uint8_t *scaled_buffer, *unscaled_buffer;
     if (self->pre_brightness_buffer) {
-        scaled_buffer = self->post_brightness_buffer + offset;
-        unscaled_buffer = self->pre_brightness_buffer + offset;
-    } else {
-        scaled_buffer = NULL;
-        unscaled_buffer = self->post_brightness_buffer + offset;
-    }
-
-    if (self->bytes_per_pixel == 4) {
-        unscaled_buffer[rgbw_order->w] = w;
-    }
-
-    unscaled_buffer[rgbw_order->r] = r;
-    unscaled_buffer[rgbw_order->g] = g;
-    unscaled_buffer[rgbw_order->b] = b;
-
-    if (scaled_buffer) {
-        if (self->bytes_per_pixel == 4) {
-            if (!self->byteorder.is_dotstar) {
-                w = (w * self->scaled_brightness) / 256;
-            }
-            scaled_buffer[rgbw_order->w] = w;
-        }
-        scaled_buffer[rgbw_order->r] = (r * self->scaled_brightness) / 256;
-        scaled_buffer[rgbw_order->g] = (g * self->scaled_brightness) / 256;
-        scaled_buffer[rgbw_order->b] = (b * self->scaled_brightness) / 256;
+        pixelbuf_write_pixel(self, self->pre_brightness_buffer + offset, r, g, b, w, 0x100);
     }
+    // A scale of 0x100 leaves the values unchanged.
+    uint16_t scale = self->pre_brightness_buffer || !self->preserve_colors ? self->scaled_brightness : 0x100;
+    pixelbuf_write_pixel(self, self->post_brightness_buffer + offset, r, g, b, w, scale);
 }
+
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel_color(mp_obj_t self_in, size_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
     pixelbuf_set_pixel_color(self, index, r, g, b, w);
@@ -256,6 +255,25 @@ STATIC void _pixelbuf_set_pixel(pixelbuf_pixelbuf_obj_t *self, size_t index, mp_
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels(mp_obj_t self_in, size_t start, mp_int_t step, size_t slice_len, mp_obj_t *values,
     mp_obj_tuple_t *flatten_to) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    mp_buffer_info_t bufinfo;
+    if (flatten_to != mp_const_none && mp_get_buffer(values, &bufinfo, MP_BUFFER_READ) &&
+        (bufinfo.typecode == 'B' || bufinfo.typecode == BYTEARRAY_TYPECODE)) {
+        // Packed R, G, B[, W] bytes convert straight to the output order without making
+        // an object per pixel. This matches what parsing the flattened tuples would do.
+        const uint8_t *color = bufinfo.buf;
+        uint8_t bpp = self->bytes_per_pixel;
+        uint8_t default_w = self->byteorder.is_dotstar ? 255 : 0;
+        for (size_t i = 0; i < slice_len; i++) {
+            pixelbuf_set_pixel_color(self, start, color[PIXEL_R], color[PIXEL_G], color[PIXEL_B],
+                bpp > 3 ? color[PIXEL_W] : default_w);
+            color += bpp;
+            start += step;
+        }
+        if (self->auto_write) {
+            common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+        }
+        return;
+    }
     mp_obj_iter_buf_t iter_buf;
     mp_obj_t iterable = mp_getiter(values, &iter_buf);
     mp_obj_t item;
@@ -335,8 +353,17 @@ void common_hal_adafruit_pixelbuf_pixelbuf_fill(mp_obj_t self_in, mp_obj_t fill_
     uint8_t w;
     common_hal_adafruit_pixelbuf_pixelbuf_parse_color(self, fill_color, &r, &g, &b, &w);
 
-    for (size_t i = 0; i < self->pixel_count; i++) {
-        common_hal_adafruit_pixelbuf_pixelbuf_set_pixel_color(self, i, r, g, b, w);
+    // Set the first pixel and then copy its bytes over the rest, doubling each time.
+    size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
+    if (pixel_len > 0) {
+        pixelbuf_set_pixel_color(self, 0, r, g, b, w);
+        for (size_t filled = self->bytes_per_pixel; filled < pixel_len; filled *= 2) {
+            size_t count = MIN(filled, pixel_len - filled);
+            memcpy(self->post_brightness_buffer + filled, self->post_brightness_buffer, count);
+            if (self->pre_brightness_buffer) {
+                memcpy(self->pre_brightness_buffer + filled, self->pre_brightness_buffer, count);
+            }
+        }
     }
     if (self->auto_write) {
         common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
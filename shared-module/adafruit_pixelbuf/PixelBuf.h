@@ -57,6 +57,7 @@ typedef struct {
     uint8_t *post_brightness_buffer;
     uint8_t *pre_brightness_buffer;
     bool auto_write;
+    bool preserve_colors;
 } pixelbuf_pixelbuf_obj_t;
 
 #define PIXEL_R 0
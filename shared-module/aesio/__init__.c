@@ -15,20 +15,59 @@ void common_hal_aesio_aes_construct(aesio_aes_obj_t *self, const uint8_t *key,
 
 void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self, const uint8_t *key,
     uint32_t key_length, const uint8_t *iv) {
+    #if CIRCUITPY_AESIO_MBEDTLS
+    mbedtls_aes_init(&self->encrypt_ctx);
+    mbedtls_aes_init(&self->decrypt_ctx);
+    mbedtls_aes_setkey_enc(&self->encrypt_ctx, key, key_length * 8);
+    mbedtls_aes_setkey_dec(&self->decrypt_ctx, key, key_length * 8);
+    if (iv != NULL) {
+        memcpy(self->iv, iv, sizeof(self->iv));
+    } else {
+        memset(self->iv, 0, sizeof(self->iv));
+    }
+    #else
     memset(&self->ctx, 0, sizeof(self->ctx));
     if (iv != NULL) {
         AES_init_ctx_iv(&self->ctx, key, key_length, iv);
     } else {
         AES_init_ctx(&self->ctx, key, key_length);
     }
+    #endif
 }
 
 void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self, int mode) {
     self->mode = mode;
 }
 
+#if CIRCUITPY_AESIO_MBEDTLS
+// Process the whole buffer in one call so that the AES engine can stream it.
+STATIC void aesio_aes_crypt(aesio_aes_obj_t *self, int direction, uint8_t *buffer, size_t length) {
+    switch (self->mode) {
+        case AES_MODE_ECB:
+            mbedtls_aes_crypt_ecb(direction == MBEDTLS_AES_ENCRYPT ? &self->encrypt_ctx : &self->decrypt_ctx,
+                direction, buffer, buffer);
+            break;
+        case AES_MODE_CBC:
+            mbedtls_aes_crypt_cbc(direction == MBEDTLS_AES_ENCRYPT ? &self->encrypt_ctx : &self->decrypt_ctx,
+                direction, length, self->iv, buffer, buffer);
+            break;
+        case AES_MODE_CTR: {
+            // Like the table implementation, each call starts on a fresh counter block and
+            // discards any keystream left over from a partial block.
+            size_t offset = 0;
+            uint8_t stream_block[16];
+            mbedtls_aes_crypt_ctr(&self->encrypt_ctx, length, &offset, self->iv, stream_block, buffer, buffer);
+            break;
+        }
+    }
+}
+#endif
+
 void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
     size_t length) {
+    #if CIRCUITPY_AESIO_MBEDTLS
+    aesio_aes_crypt(self, MBEDTLS_AES_ENCRYPT, buffer, length);
+    #else
     switch (self->mode) {
         case AES_MODE_ECB:
             AES_ECB_encrypt(&self->ctx, buffer);
@@ -40,10 +79,14 @@ void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
             AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
             break;
     }
+    #endif
 }
 
 void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
     size_t length) {
+    #if CIRCUITPY_AESIO_MBEDTLS
+    aesio_aes_crypt(self, MBEDTLS_AES_DECRYPT, buffer, length);
+    #else
     switch (self->mode) {
         case AES_MODE_ECB:
             AES_ECB_decrypt(&self->ctx, buffer);
@@ -55,4 +98,5 @@ void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
             AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
             break;
     }
+    #endif
 }
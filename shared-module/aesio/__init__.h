@@ -33,7 +33,11 @@
 #include "py/obj.h"
 #include "py/proto.h"
 
+#if CIRCUITPY_AESIO_MBEDTLS
+#include "mbedtls/aes.h"
+#else
 #include "shared-module/aesio/aes.h"
+#endif
 
 // These values were chosen to correspond with the values
 // present in pycrypto.
@@ -46,8 +50,16 @@ enum AES_MODE {
 typedef struct {
     mp_obj_base_t base;
 
+    #if CIRCUITPY_AESIO_MBEDTLS
+    // mbedtls keeps separate key schedules for encrypting and decrypting.
+    mbedtls_aes_context encrypt_ctx;
+    mbedtls_aes_context decrypt_ctx;
+    // The chaining value in CBC mode, or the counter block in CTR mode
+    uint8_t iv[16];
+    #else
     // The tinyaes context
     struct AES_ctx ctx;
+    #endif
 
     // Which AES mode this instance of the object is configured to use
     enum AES_MODE mode;
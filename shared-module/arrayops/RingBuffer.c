@@ -0,0 +1,156 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/binary.h"
+#include "py/runtime.h"
+#include "shared-bindings/arrayops/RingBuffer.h"
+#include "supervisor/shared/translate/translate.h"
+
+void common_hal_arrayops_ringbuffer_construct(arrayops_ringbuffer_obj_t *self, char typecode, size_t capacity, bool overwrite) {
+    self->item_size = mp_binary_get_size('@', typecode, NULL);
+    self->items = m_new(uint8_t, capacity * self->item_size);
+    self->capacity = capacity;
+    self->start = 0;
+    self->len = 0;
+    self->typecode = typecode;
+    self->overwrite = overwrite;
+}
+
+size_t common_hal_arrayops_ringbuffer_get_capacity(arrayops_ringbuffer_obj_t *self) {
+    return self->capacity;
+}
+
+size_t common_hal_arrayops_ringbuffer_get_len(arrayops_ringbuffer_obj_t *self) {
+    return self->len;
+}
+
+// Storage index of element index, which must be at most the capacity.
+static inline size_t ringbuffer_slot(arrayops_ringbuffer_obj_t *self, size_t index) {
+    size_t slot = self->start + index;
+    return slot >= self->capacity ? slot - self->capacity : slot;
+}
+
+// Check there's room for one more element. When the buffer is full and
+// overwriting is allowed, the new element goes in the slot of the one it
+// replaces, so the value is stored before anything is dropped.
+STATIC bool ringbuffer_check_room(arrayops_ringbuffer_obj_t *self) {
+    if (self->len < self->capacity) {
+        return true;
+    }
+    if (self->capacity == 0) {
+        return false;
+    }
+    if (!self->overwrite) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("full"));
+    }
+    return true;
+}
+
+void common_hal_arrayops_ringbuffer_append(arrayops_ringbuffer_obj_t *self, mp_obj_t value) {
+    if (!ringbuffer_check_room(self)) {
+        return;
+    }
+    mp_binary_set_val_array(self->typecode, self->items, ringbuffer_slot(self, self->len), value);
+    if (self->len == self->capacity) {
+        // dropped the first element
+        self->start = ringbuffer_slot(self, 1);
+    } else {
+        self->len++;
+    }
+}
+
+void common_hal_arrayops_ringbuffer_appendleft(arrayops_ringbuffer_obj_t *self, mp_obj_t value) {
+    if (!ringbuffer_check_room(self)) {
+        return;
+    }
+    size_t slot = self->start == 0 ? self->capacity - 1 : self->start - 1;
+    mp_binary_set_val_array(self->typecode, self->items, slot, value);
+    self->start = slot;
+    if (self->len < self->capacity) {
+        self->len++;
+    }
+}
+
+mp_obj_t common_hal_arrayops_ringbuffer_pop(arrayops_ringbuffer_obj_t *self) {
+    if (self->len == 0) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty"));
+    }
+    self->len--;
+    return mp_binary_get_val_array(self->typecode, self->items, ringbuffer_slot(self, self->len));
+}
+
+mp_obj_t common_hal_arrayops_ringbuffer_popleft(arrayops_ringbuffer_obj_t *self) {
+    if (self->len == 0) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty"));
+    }
+    mp_obj_t value = mp_binary_get_val_array(self->typecode, self->items, self->start);
+    self->start = ringbuffer_slot(self, 1);
+    self->len--;
+    return value;
+}
+
+void common_hal_arrayops_ringbuffer_clear(arrayops_ringbuffer_obj_t *self) {
+    self->start = 0;
+    self->len = 0;
+}
+
+mp_obj_t common_hal_arrayops_ringbuffer_get_item(arrayops_ringbuffer_obj_t *self, size_t index) {
+    return mp_binary_get_val_array(self->typecode, self->items, ringbuffer_slot(self, index));
+}
+
+void common_hal_arrayops_ringbuffer_set_item(arrayops_ringbuffer_obj_t *self, size_t index, mp_obj_t value) {
+    mp_binary_set_val_array(self->typecode, self->items, ringbuffer_slot(self, index), value);
+}
+
+STATIC void ringbuffer_reverse(arrayops_ringbuffer_obj_t *self, size_t lo, size_t hi) {
+    size_t sz = self->item_size;
+    while (lo + 1 < hi) {
+        hi--;
+        uint8_t *a = self->items + lo * sz;
+        uint8_t *b = self->items + hi * sz;
+        for (size_t j = 0; j < sz; j++) {
+            uint8_t t = a[j];
+            a[j] = b[j];
+            b[j] = t;
+        }
+        lo++;
+    }
+}
+
+void common_hal_arrayops_ringbuffer_get_buffer(arrayops_ringbuffer_obj_t *self, mp_buffer_info_t *bufinfo) {
+    if (self->start != 0) {
+        // Rotate the storage in place so that the elements start at index 0.
+        ringbuffer_reverse(self, 0, self->start);
+        ringbuffer_reverse(self, self->start, self->capacity);
+        ringbuffer_reverse(self, 0, self->capacity);
+        self->start = 0;
+    }
+    bufinfo->buf = self->items;
+    bufinfo->len = self->len * self->item_size;
+    bufinfo->typecode = self->typecode;
+}
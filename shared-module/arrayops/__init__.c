@@ -0,0 +1,231 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "shared-bindings/arrayops/__init__.h"
+
+// Integer elements are widened to 64 bits so that no operation on them can
+// overflow before the result is saturated to the element type.
+
+// Scalars are clamped to these ranges first, so the result still saturates
+// to the same value. Elements are at most 32 bits.
+#define ADD_LIMIT (INT64_C(1) << 33)
+#define MUL_LIMIT (INT64_C(1) << 31)
+// Beyond the range of every integer element type, and exact in a float.
+#define FLOAT_LIMIT ((mp_float_t)(INT64_C(1) << 40))
+
+static inline bool arrayops_is_float(const arrayops_array_t *a) {
+    return a->typecode == 'f' || a->typecode == 'd';
+}
+
+static inline int64_t clamp64(int64_t v, int64_t lo, int64_t hi) {
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+STATIC int64_t arrayops_get_int(const arrayops_array_t *a, size_t i) {
+    switch (a->typecode) {
+        case 'b':
+            return ((int8_t *)a->items)[i];
+        case 'B':
+            return ((uint8_t *)a->items)[i];
+        case 'h':
+            return ((int16_t *)a->items)[i];
+        case 'H':
+            return ((uint16_t *)a->items)[i];
+        case 'i':
+        case 'l':
+            return ((int32_t *)a->items)[i];
+        default:
+            return ((uint32_t *)a->items)[i];
+    }
+}
+
+STATIC mp_float_t arrayops_get_float(const arrayops_array_t *a, size_t i) {
+    switch (a->typecode) {
+        case 'f':
+            return ((float *)a->items)[i];
+        case 'd':
+            return ((double *)a->items)[i];
+        default:
+            return (mp_float_t)arrayops_get_int(a, i);
+    }
+}
+
+STATIC void arrayops_set_int(arrayops_array_t *a, size_t i, int64_t v) {
+    switch (a->typecode) {
+        case 'b':
+            ((int8_t *)a->items)[i] = clamp64(v, INT8_MIN, INT8_MAX);
+            break;
+        case 'B':
+            ((uint8_t *)a->items)[i] = clamp64(v, 0, UINT8_MAX);
+            break;
+        case 'h':
+            ((int16_t *)a->items)[i] = clamp64(v, INT16_MIN, INT16_MAX);
+            break;
+        case 'H':
+            ((uint16_t *)a->items)[i] = clamp64(v, 0, UINT16_MAX);
+            break;
+        case 'i':
+        case 'l':
+            ((int32_t *)a->items)[i] = clamp64(v, INT32_MIN, INT32_MAX);
+            break;
+        case 'f':
+            ((float *)a->items)[i] = (float)v;
+            break;
+        case 'd':
+            ((double *)a->items)[i] = (double)v;
+            break;
+        default:
+            ((uint32_t *)a->items)[i] = clamp64(v, 0, UINT32_MAX);
+            break;
+    }
+}
+
+STATIC void arrayops_set_float(arrayops_array_t *a, size_t i, mp_float_t v) {
+    if (a->typecode == 'f') {
+        ((float *)a->items)[i] = (float)v;
+    } else if (a->typecode == 'd') {
+        ((double *)a->items)[i] = (double)v;
+    } else {
+        // Round to nearest, away from zero on a tie. NaN becomes 0.
+        int64_t iv = 0;
+        if (v >= FLOAT_LIMIT) {
+            iv = INT64_C(1) << 40;
+        } else if (v <= -FLOAT_LIMIT) {
+            iv = -(INT64_C(1) << 40);
+        } else if (v == v) {
+            iv = (int64_t)(v < 0 ? v - MICROPY_FLOAT_CONST(0.5) : v + MICROPY_FLOAT_CONST(0.5));
+        }
+        arrayops_set_int(a, i, iv);
+    }
+}
+
+void common_hal_arrayops_add(arrayops_array_t *dest, const arrayops_array_t *other) {
+    if (arrayops_is_float(dest) || arrayops_is_float(other)) {
+        for (size_t i = 0; i < dest->len; i++) {
+            arrayops_set_float(dest, i, arrayops_get_float(dest, i) + arrayops_get_float(other, i));
+        }
+    } else {
+        for (size_t i = 0; i < dest->len; i++) {
+            arrayops_set_int(dest, i, arrayops_get_int(dest, i) + arrayops_get_int(other, i));
+        }
+    }
+}
+
+void common_hal_arrayops_add_int(arrayops_array_t *dest, mp_int_t value) {
+    if (arrayops_is_float(dest)) {
+        common_hal_arrayops_add_float(dest, (mp_float_t)value);
+        return;
+    }
+    int64_t k = clamp64(value, -ADD_LIMIT, ADD_LIMIT);
+    for (size_t i = 0; i < dest->len; i++) {
+        arrayops_set_int(dest, i, arrayops_get_int(dest, i) + k);
+    }
+}
+
+void common_hal_arrayops_add_float(arrayops_array_t *dest, mp_float_t value) {
+    for (size_t i = 0; i < dest->len; i++) {
+        arrayops_set_float(dest, i, arrayops_get_float(dest, i) + value);
+    }
+}
+
+void common_hal_arrayops_mul_int(arrayops_array_t *dest, mp_int_t value) {
+    if (arrayops_is_float(dest)) {
+        common_hal_arrayops_mul_float(dest, (mp_float_t)value);
+        return;
+    }
+    int64_t k = clamp64(value, -MUL_LIMIT, MUL_LIMIT);
+    for (size_t i = 0; i < dest->len; i++) {
+        arrayops_set_int(dest, i, arrayops_get_int(dest, i) * k);
+    }
+}
+
+void common_hal_arrayops_mul_float(arrayops_array_t *dest, mp_float_t value) {
+    for (size_t i = 0; i < dest->len; i++) {
+        arrayops_set_float(dest, i, arrayops_get_float(dest, i) * value);
+    }
+}
+
+mp_obj_t common_hal_arrayops_sum(const arrayops_array_t *array) {
+    if (arrayops_is_float(array)) {
+        mp_float_t total = 0;
+        for (size_t i = 0; i < array->len; i++) {
+            total += arrayops_get_float(array, i);
+        }
+        return mp_obj_new_float(total);
+    }
+    int64_t total = 0;
+    for (size_t i = 0; i < array->len; i++) {
+        total += arrayops_get_int(array, i);
+    }
+    return mp_obj_new_int_from_ll(total);
+}
+
+// Return the index of the first smallest (sign < 0) or largest (sign > 0)
+// element. The array must not be empty.
+STATIC size_t arrayops_argextreme(const arrayops_array_t *array, int sign) {
+    size_t best = 0;
+    if (arrayops_is_float(array)) {
+        mp_float_t best_value = arrayops_get_float(array, 0);
+        for (size_t i = 1; i < array->len; i++) {
+            mp_float_t v = arrayops_get_float(array, i);
+            if (sign < 0 ? v < best_value : v > best_value) {
+                best = i;
+                best_value = v;
+            }
+        }
+    } else {
+        int64_t best_value = arrayops_get_int(array, 0);
+        for (size_t i = 1; i < array->len; i++) {
+            int64_t v = arrayops_get_int(array, i);
+            if (sign < 0 ? v < best_value : v > best_value) {
+                best = i;
+                best_value = v;
+            }
+        }
+    }
+    return best;
+}
+
+size_t common_hal_arrayops_argmin(const arrayops_array_t *array) {
+    return arrayops_argextreme(array, -1);
+}
+
+size_t common_hal_arrayops_argmax(const arrayops_array_t *array) {
+    return arrayops_argextreme(array, 1);
+}
+
+void common_hal_arrayops_convert(const arrayops_array_t *src, arrayops_array_t *dest) {
+    if (arrayops_is_float(src) || arrayops_is_float(dest)) {
+        for (size_t i = 0; i < dest->len; i++) {
+            arrayops_set_float(dest, i, arrayops_get_float(src, i));
+        }
+    } else {
+        for (size_t i = 0; i < dest->len; i++) {
+            arrayops_set_int(dest, i, arrayops_get_int(src, i));
+        }
+    }
+}
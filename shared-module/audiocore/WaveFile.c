@@ -45,6 +45,67 @@ struct wave_format_chunk {
     uint16_t extra_params; // Assumed to be zero below.
 };
 
+#if CIRCUITPY_AUDIOCORE_READAHEAD
+// Read at most one sector per background pass so other tasks stay responsive.
+#define READAHEAD_CHUNK (512)
+
+STATIC void wavefile_readahead_reset(audioio_wavefile_obj_t *self, uint32_t file_remaining) {
+    self->readahead_read = 0;
+    self->readahead_count = 0;
+    self->file_remaining = file_remaining;
+}
+
+STATIC void wavefile_readahead_cb(void *self_in) {
+    audioio_wavefile_obj_t *self = self_in;
+    if (self->readahead == NULL) {
+        return;
+    }
+    uint32_t write = (self->readahead_read + self->readahead_count) % CIRCUITPY_AUDIOCORE_READAHEAD;
+    // Stop at sector boundaries so each read maps onto whole sectors.
+    UINT to_read = READAHEAD_CHUNK - self->file->fp.fptr % READAHEAD_CHUNK;
+    to_read = MIN(to_read, CIRCUITPY_AUDIOCORE_READAHEAD - MAX(write, self->readahead_count));
+    to_read = MIN(to_read, self->file_remaining);
+    if (to_read == 0) {
+        return;
+    }
+    UINT bytes_read;
+    if (f_read(&self->file->fp, self->readahead + write, to_read, &bytes_read) != FR_OK || bytes_read == 0) {
+        // Leave the error for get_buffer's own read to report.
+        return;
+    }
+    self->readahead_count += bytes_read;
+    self->file_remaining -= bytes_read;
+    if (self->file_remaining && self->readahead_count < CIRCUITPY_AUDIOCORE_READAHEAD) {
+        background_callback_add(&self->readahead_cb, wavefile_readahead_cb, self);
+    }
+}
+#endif
+
+// Read sample data, taking it from the read-ahead ring before the file.
+STATIC bool wavefile_read(audioio_wavefile_obj_t *self, uint8_t *buf, uint32_t len) {
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    while (len && self->readahead_count) {
+        uint32_t n = MIN(len, MIN(self->readahead_count, CIRCUITPY_AUDIOCORE_READAHEAD - self->readahead_read));
+        memcpy(buf, self->readahead + self->readahead_read, n);
+        self->readahead_read = (self->readahead_read + n) % CIRCUITPY_AUDIOCORE_READAHEAD;
+        self->readahead_count -= n;
+        buf += n;
+        len -= n;
+    }
+    if (len == 0) {
+        return true;
+    }
+    #endif
+    UINT length_read;
+    if (f_read(&self->file->fp, buf, len, &length_read) != FR_OK || length_read != len) {
+        return false;
+    }
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    self->file_remaining -= len;
+    #endif
+    return true;
+}
+
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
@@ -110,6 +171,10 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->file_length = data_length;
     self->data_start = self->file->fp.fptr;
 
+    // Build the file's cluster link map up front so that looping and seeking
+    // from the background don't walk the FAT or allocate.
+    fat_file_build_linkmap(self->file);
+
     // Try to allocate two buffers, one will be loaded from file and the other
     // DMAed to DAC.
     if (buffer_size) {
@@ -130,9 +195,22 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
             m_malloc_fail(self->len);
         }
     }
+
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    self->readahead = m_malloc(CIRCUITPY_AUDIOCORE_READAHEAD, false);
+    if (self->readahead == NULL) {
+        common_hal_audioio_wavefile_deinit(self);
+        m_malloc_fail(CIRCUITPY_AUDIOCORE_READAHEAD);
+    }
+    wavefile_readahead_reset(self, 0);
+    #endif
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    // A pending read-ahead callback sees this and does nothing.
+    self->readahead = NULL;
+    #endif
     self->buffer = NULL;
     self->second_buffer = NULL;
 }
@@ -158,6 +236,31 @@ uint8_t common_hal_audioio_wavefile_get_channel_count(audioio_wavefile_obj_t *se
     return self->channel_count;
 }
 
+uint32_t common_hal_audioio_wavefile_get_frame_count(audioio_wavefile_obj_t *self) {
+    return self->file_length / (self->channel_count * self->bits_per_sample / 8);
+}
+
+void common_hal_audioio_wavefile_seek(audioio_wavefile_obj_t *self, uint32_t frame) {
+    uint32_t offset = frame * (self->channel_count * self->bits_per_sample / 8);
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    background_callback_begin_critical_section();
+    #endif
+    FRESULT result = fat_file_lseek(self->file, self->data_start + offset);
+    // Stop both channels at the current buffer so the next load comes from
+    // the new position.
+    self->left_read_count = self->read_count;
+    self->right_read_count = self->read_count;
+    self->bytes_remaining = self->file_length - offset;
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    wavefile_readahead_reset(self, self->bytes_remaining);
+    background_callback_add(&self->readahead_cb, wavefile_readahead_cb, self);
+    background_callback_end_critical_section();
+    #endif
+    if (result != FR_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
@@ -166,11 +269,19 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     }
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    background_callback_begin_critical_section();
+    #endif
     self->bytes_remaining = self->file_length;
-    f_lseek(&self->file->fp, self->data_start);
+    fat_file_lseek(self->file, self->data_start);
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    wavefile_readahead_reset(self, self->file_length);
+    background_callback_add(&self->readahead_cb, wavefile_readahead_cb, self);
+    background_callback_end_critical_section();
+    #endif
 }
 
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *self,
@@ -200,16 +311,21 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         if (num_bytes_to_load > self->bytes_remaining) {
             num_bytes_to_load = self->bytes_remaining;
         }
-        UINT length_read;
+        uint32_t length_read = num_bytes_to_load;
         if (self->buffer_index % 2 == 1) {
             *buffer = self->second_buffer;
         } else {
             *buffer = self->buffer;
         }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        if (!wavefile_read(self, *buffer, num_bytes_to_load)) {
             return GET_BUFFER_ERROR;
         }
         self->bytes_remaining -= length_read;
+        #if CIRCUITPY_AUDIOCORE_READAHEAD
+        if (self->file_remaining) {
+            background_callback_add(&self->readahead_cb, wavefile_readahead_cb, self);
+        }
+        #endif
         // Pad the last buffer to word align it.
         if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
             uint32_t pad = length_read % sizeof(uint32_t);
@@ -32,6 +32,15 @@
 
 #include "shared-module/audiocore/__init__.h"
 
+// Ports without background tasks read the file only when playback needs it
+#ifndef CIRCUITPY_AUDIOCORE_READAHEAD
+#define CIRCUITPY_AUDIOCORE_READAHEAD (0)
+#endif
+
+#if CIRCUITPY_AUDIOCORE_READAHEAD
+#include "supervisor/background_callback.h"
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     uint8_t *buffer;
@@ -53,6 +62,16 @@ typedef struct {
     uint32_t read_count;
     uint32_t left_read_count;
     uint32_t right_read_count;
+
+    #if CIRCUITPY_AUDIOCORE_READAHEAD
+    // Ring of sample data read ahead of playback by readahead_cb
+    background_callback_t readahead_cb;
+    uint8_t *readahead;
+    uint32_t readahead_read;
+    uint32_t readahead_count;
+    // Sample data not yet read from the file, into the ring or otherwise
+    uint32_t file_remaining;
+    #endif
 } audioio_wavefile_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
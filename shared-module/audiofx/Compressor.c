@@ -0,0 +1,165 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/audiofx/Compressor.h"
+#include "shared-module/audiofx/Compressor.h"
+
+// The envelope and gain are updated once per block of this many frames, and
+// the gain ramps linearly across each block.
+#define COMPRESSOR_BLOCK (16)
+
+// The one pole smoothing coefficient for a time constant, per block.
+STATIC int32_t time_to_q15(mp_float_t seconds, uint32_t sample_rate) {
+    if (seconds <= 0) {
+        return 32768;
+    }
+    mp_float_t blocks = seconds * sample_rate / COMPRESSOR_BLOCK;
+    return audiofx_float_to_q15(1 - MICROPY_FLOAT_C_FUN(exp)(-1 / blocks));
+}
+
+void common_hal_audiofx_compressor_construct(audiofx_compressor_obj_t *self, mp_obj_t source,
+    mp_float_t threshold, mp_float_t ratio, mp_float_t attack, mp_float_t release, mp_float_t gain) {
+    audiofx_base_init(&self->base, source);
+    common_hal_audiofx_compressor_set_threshold(self, threshold);
+    common_hal_audiofx_compressor_set_ratio(self, ratio);
+    common_hal_audiofx_compressor_set_attack(self, attack);
+    common_hal_audiofx_compressor_set_release(self, release);
+    common_hal_audiofx_compressor_set_gain(self, gain);
+    self->last_gain = self->gain_q12;
+}
+
+void common_hal_audiofx_compressor_deinit(audiofx_compressor_obj_t *self) {
+    audiofx_base_deinit(&self->base);
+}
+
+bool common_hal_audiofx_compressor_deinited(audiofx_compressor_obj_t *self) {
+    return audiofx_base_deinited(&self->base);
+}
+
+mp_float_t common_hal_audiofx_compressor_get_threshold(audiofx_compressor_obj_t *self) {
+    return self->threshold;
+}
+
+void common_hal_audiofx_compressor_set_threshold(audiofx_compressor_obj_t *self, mp_float_t arg) {
+    self->threshold = arg;
+    self->threshold_q15 = MAX(1, audiofx_float_to_q15(arg));
+}
+
+mp_float_t common_hal_audiofx_compressor_get_ratio(audiofx_compressor_obj_t *self) {
+    return self->ratio;
+}
+
+void common_hal_audiofx_compressor_set_ratio(audiofx_compressor_obj_t *self, mp_float_t arg) {
+    self->ratio = arg;
+    self->inverse_ratio_q15 = audiofx_float_to_q15(1 / arg);
+}
+
+mp_float_t common_hal_audiofx_compressor_get_attack(audiofx_compressor_obj_t *self) {
+    return self->attack;
+}
+
+void common_hal_audiofx_compressor_set_attack(audiofx_compressor_obj_t *self, mp_float_t arg) {
+    self->attack = arg;
+    self->attack_q15 = time_to_q15(arg, self->base.sample_rate);
+}
+
+mp_float_t common_hal_audiofx_compressor_get_release(audiofx_compressor_obj_t *self) {
+    return self->release;
+}
+
+void common_hal_audiofx_compressor_set_release(audiofx_compressor_obj_t *self, mp_float_t arg) {
+    self->release = arg;
+    self->release_q15 = time_to_q15(arg, self->base.sample_rate);
+}
+
+mp_float_t common_hal_audiofx_compressor_get_gain(audiofx_compressor_obj_t *self) {
+    return self->gain;
+}
+
+void common_hal_audiofx_compressor_set_gain(audiofx_compressor_obj_t *self, mp_float_t arg) {
+    self->gain = arg;
+    self->gain_q12 = (int32_t)MICROPY_FLOAT_C_FUN(round)(arg * 4096);
+}
+
+void audiofx_compressor_reset_buffer(audiofx_compressor_obj_t *self,
+    bool single_channel_output, uint8_t channel) {
+    if (!audiofx_base_reset_buffer(&self->base, single_channel_output, channel)) {
+        return;
+    }
+    self->envelope = 0;
+    self->last_gain = self->gain_q12;
+}
+
+// The gain, in Q12, that brings an envelope level down to the threshold
+// plus the overshoot divided by the ratio.
+STATIC int32_t compressor_gain(audiofx_compressor_obj_t *self, int32_t envelope) {
+    int32_t threshold = self->threshold_q15;
+    if (envelope <= threshold) {
+        return self->gain_q12;
+    }
+    int32_t target = threshold + (((envelope - threshold) * self->inverse_ratio_q15) >> 15);
+    int32_t reduction_q15 = (target << 15) / envelope;
+    return (reduction_q15 * self->gain_q12) >> 15;
+}
+
+STATIC void compressor_process(audiofx_base_t *base, int16_t *buffer, uint32_t n_frames) {
+    audiofx_compressor_obj_t *self = (audiofx_compressor_obj_t *)base;
+    int channel_count = base->channel_count;
+    int32_t envelope = self->envelope, gain = self->last_gain;
+
+    for (uint32_t start = 0; start < n_frames; start += COMPRESSOR_BLOCK) {
+        uint32_t n_samples = MIN(COMPRESSOR_BLOCK, n_frames - start) * channel_count;
+        int16_t *block = buffer + start * channel_count;
+
+        // Channels are linked: the loudest one sets the gain for all.
+        int32_t peak = 0;
+        for (uint32_t i = 0; i < n_samples; i++) {
+            peak = MAX(peak, block[i] < 0 ? -block[i] : block[i]);
+        }
+        int32_t coeff = peak > envelope ? self->attack_q15 : self->release_q15;
+        envelope += ((peak - envelope) * coeff) >> 15;
+
+        int32_t next_gain = compressor_gain(self, envelope);
+        int32_t step = (next_gain - gain) * channel_count / (int32_t)n_samples;
+        for (uint32_t i = 0; i < n_samples; i += channel_count) {
+            gain += step;
+            for (int c = 0; c < channel_count; c++) {
+                block[i + c] = audiofx_sat16((block[i + c] * gain) >> 12);
+            }
+        }
+        gain = next_gain;
+    }
+    self->envelope = envelope;
+    self->last_gain = gain;
+}
+
+audioio_get_buffer_result_t audiofx_compressor_get_buffer(audiofx_compressor_obj_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length) {
+    return audiofx_base_get_buffer(&self->base, single_channel_output, channel, buffer, buffer_length, compressor_process);
+}
@@ -0,0 +1,128 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/audiofx/Delay.h"
+#include "shared-module/audiofx/Delay.h"
+
+void common_hal_audiofx_delay_construct(audiofx_delay_obj_t *self, mp_obj_t source,
+    mp_float_t delay, mp_float_t max_delay, mp_float_t feedback, mp_float_t mix) {
+    audiofx_base_init(&self->base, source);
+    self->max_delay = max_delay;
+    self->max_frames = MAX(1, (uint32_t)(max_delay * self->base.sample_rate));
+    self->line = m_malloc(self->max_frames * self->base.channel_count * sizeof(int16_t), false);
+    memset(self->line, 0, self->max_frames * self->base.channel_count * sizeof(int16_t));
+    common_hal_audiofx_delay_set_delay(self, delay);
+    common_hal_audiofx_delay_set_feedback(self, feedback);
+    common_hal_audiofx_delay_set_mix(self, mix);
+}
+
+void common_hal_audiofx_delay_deinit(audiofx_delay_obj_t *self) {
+    audiofx_base_deinit(&self->base);
+    self->line = NULL;
+}
+
+bool common_hal_audiofx_delay_deinited(audiofx_delay_obj_t *self) {
+    return audiofx_base_deinited(&self->base);
+}
+
+mp_float_t common_hal_audiofx_delay_get_delay(audiofx_delay_obj_t *self) {
+    return self->delay;
+}
+
+void common_hal_audiofx_delay_set_delay(audiofx_delay_obj_t *self, mp_float_t arg) {
+    self->delay = arg;
+    self->delay_frames = MIN(self->max_frames, MAX(1, (uint32_t)(arg * self->base.sample_rate)));
+    // Echoes keep coming for a whole delay after the input is quiet.
+    self->base.tail_frames = self->delay_frames + AUDIOFX_BUFFER_FRAMES;
+}
+
+mp_float_t common_hal_audiofx_delay_get_max_delay(audiofx_delay_obj_t *self) {
+    return self->max_delay;
+}
+
+mp_float_t common_hal_audiofx_delay_get_feedback(audiofx_delay_obj_t *self) {
+    return self->feedback;
+}
+
+void common_hal_audiofx_delay_set_feedback(audiofx_delay_obj_t *self, mp_float_t arg) {
+    self->feedback = arg;
+    self->feedback_q15 = audiofx_float_to_q15(arg);
+}
+
+mp_float_t common_hal_audiofx_delay_get_mix(audiofx_delay_obj_t *self) {
+    return self->mix;
+}
+
+void common_hal_audiofx_delay_set_mix(audiofx_delay_obj_t *self, mp_float_t arg) {
+    self->mix = arg;
+    self->mix_q15 = audiofx_float_to_q15(arg);
+}
+
+void audiofx_delay_reset_buffer(audiofx_delay_obj_t *self,
+    bool single_channel_output, uint8_t channel) {
+    if (!audiofx_base_reset_buffer(&self->base, single_channel_output, channel)) {
+        return;
+    }
+    memset(self->line, 0, self->max_frames * self->base.channel_count * sizeof(int16_t));
+    self->pos = 0;
+}
+
+STATIC void delay_process(audiofx_base_t *base, int16_t *buffer, uint32_t n_frames) {
+    audiofx_delay_obj_t *self = (audiofx_delay_obj_t *)base;
+    int32_t feedback = self->feedback_q15;
+    int32_t wet = self->mix_q15, dry = 32768 - wet;
+    uint32_t max_frames = self->max_frames;
+    int channel_count = base->channel_count;
+    int16_t *line = self->line;
+    uint32_t pos = self->pos;
+    // The line is read delay_frames behind where it is written.
+    uint32_t tap = pos >= self->delay_frames ? pos - self->delay_frames : pos + max_frames - self->delay_frames;
+
+    for (uint32_t i = 0; i < n_frames; i++) {
+        for (int c = 0; c < channel_count; c++) {
+            int32_t x = buffer[c];
+            int32_t d = line[tap * channel_count + c];
+            line[pos * channel_count + c] = audiofx_sat16(x + ((d * feedback) >> 15));
+            buffer[c] = audiofx_sat16((x * dry + d * wet) >> 15);
+        }
+        buffer += channel_count;
+        if (++pos == max_frames) {
+            pos = 0;
+        }
+        if (++tap == max_frames) {
+            tap = 0;
+        }
+    }
+    self->pos = pos;
+}
+
+audioio_get_buffer_result_t audiofx_delay_get_buffer(audiofx_delay_obj_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length) {
+    return audiofx_base_get_buffer(&self->base, single_channel_output, channel, buffer, buffer_length, delay_process);
+}
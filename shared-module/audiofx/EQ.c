@@ -0,0 +1,146 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/audiofx/EQ.h"
+#include "shared-module/audiofx/EQ.h"
+
+// Three bands split by two one pole lowpasses: low is under the low
+// crossover, high is over the high crossover, and mid is what's left. At
+// unity gain the bands add back up to exactly the input.
+
+STATIC int32_t crossover_to_q16(mp_float_t frequency, uint32_t sample_rate) {
+    mp_float_t w = MICROPY_FLOAT_CONST(6.283185307179586) * frequency / sample_rate;
+    return (int32_t)MICROPY_FLOAT_C_FUN(round)((1 - MICROPY_FLOAT_C_FUN(exp)(-w)) * 65536);
+}
+
+STATIC int32_t gain_to_q10(mp_float_t gain) {
+    return (int32_t)MICROPY_FLOAT_C_FUN(round)(gain * 1024);
+}
+
+void common_hal_audiofx_eq_construct(audiofx_eq_obj_t *self, mp_obj_t source,
+    mp_float_t low_frequency, mp_float_t high_frequency, mp_float_t low, mp_float_t mid, mp_float_t high) {
+    audiofx_base_init(&self->base, source);
+    common_hal_audiofx_eq_set_low_frequency(self, low_frequency);
+    common_hal_audiofx_eq_set_high_frequency(self, high_frequency);
+    common_hal_audiofx_eq_set_low(self, low);
+    common_hal_audiofx_eq_set_mid(self, mid);
+    common_hal_audiofx_eq_set_high(self, high);
+}
+
+void common_hal_audiofx_eq_deinit(audiofx_eq_obj_t *self) {
+    audiofx_base_deinit(&self->base);
+}
+
+bool common_hal_audiofx_eq_deinited(audiofx_eq_obj_t *self) {
+    return audiofx_base_deinited(&self->base);
+}
+
+mp_float_t common_hal_audiofx_eq_get_low_frequency(audiofx_eq_obj_t *self) {
+    return self->low_frequency;
+}
+
+void common_hal_audiofx_eq_set_low_frequency(audiofx_eq_obj_t *self, mp_float_t arg) {
+    self->low_frequency = arg;
+    self->low_coeff_q16 = crossover_to_q16(arg, self->base.sample_rate);
+}
+
+mp_float_t common_hal_audiofx_eq_get_high_frequency(audiofx_eq_obj_t *self) {
+    return self->high_frequency;
+}
+
+void common_hal_audiofx_eq_set_high_frequency(audiofx_eq_obj_t *self, mp_float_t arg) {
+    self->high_frequency = arg;
+    self->high_coeff_q16 = crossover_to_q16(arg, self->base.sample_rate);
+}
+
+mp_float_t common_hal_audiofx_eq_get_low(audiofx_eq_obj_t *self) {
+    return self->low;
+}
+
+void common_hal_audiofx_eq_set_low(audiofx_eq_obj_t *self, mp_float_t arg) {
+    self->low = arg;
+    self->low_q10 = gain_to_q10(arg);
+}
+
+mp_float_t common_hal_audiofx_eq_get_mid(audiofx_eq_obj_t *self) {
+    return self->mid;
+}
+
+void common_hal_audiofx_eq_set_mid(audiofx_eq_obj_t *self, mp_float_t arg) {
+    self->mid = arg;
+    self->mid_q10 = gain_to_q10(arg);
+}
+
+mp_float_t common_hal_audiofx_eq_get_high(audiofx_eq_obj_t *self) {
+    return self->high;
+}
+
+void common_hal_audiofx_eq_set_high(audiofx_eq_obj_t *self, mp_float_t arg) {
+    self->high = arg;
+    self->high_q10 = gain_to_q10(arg);
+}
+
+void audiofx_eq_reset_buffer(audiofx_eq_obj_t *self,
+    bool single_channel_output, uint8_t channel) {
+    if (!audiofx_base_reset_buffer(&self->base, single_channel_output, channel)) {
+        return;
+    }
+    memset(self->lp_low, 0, sizeof(self->lp_low));
+    memset(self->lp_high, 0, sizeof(self->lp_high));
+}
+
+STATIC void eq_process(audiofx_base_t *base, int16_t *buffer, uint32_t n_frames) {
+    audiofx_eq_obj_t *self = (audiofx_eq_obj_t *)base;
+    int channel_count = base->channel_count;
+    int32_t a_low = self->low_coeff_q16, a_high = self->high_coeff_q16;
+    int32_t g_low = self->low_q10, g_mid = self->mid_q10, g_high = self->high_q10;
+
+    for (int c = 0; c < channel_count; c++) {
+        int32_t lp_low = self->lp_low[c], lp_high = self->lp_high[c];
+        int16_t *s = buffer + c;
+        for (uint32_t i = 0; i < n_frames; i++, s += channel_count) {
+            int32_t x = *s;
+            // The difference times the coefficient needs more than 32 bits.
+            lp_low += (int32_t)(((int64_t)((x << 8) - lp_low) * a_low) >> 16);
+            lp_high += (int32_t)(((int64_t)((x << 8) - lp_high) * a_high) >> 16);
+            int32_t low = lp_low >> 8;
+            int32_t high_cut = lp_high >> 8;
+            int32_t y = low * g_low + (high_cut - low) * g_mid + (x - high_cut) * g_high;
+            *s = audiofx_sat16(y >> 10);
+        }
+        self->lp_low[c] = lp_low;
+        self->lp_high[c] = lp_high;
+    }
+}
+
+audioio_get_buffer_result_t audiofx_eq_get_buffer(audiofx_eq_obj_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length) {
+    return audiofx_base_get_buffer(&self->base, single_channel_output, channel, buffer, buffer_length, eq_process);
+}
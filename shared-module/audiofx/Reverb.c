@@ -0,0 +1,197 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/audiofx/Reverb.h"
+#include "shared-module/audiofx/Reverb.h"
+
+// A Schroeder reverberator: parallel lowpass feedback combs into series
+// allpasses, with the tunings of Jezar's public domain "Freeverb". The
+// lengths are in frames at 44.1kHz and scale with the sample rate. The
+// reverb is mono, and mixed equally into each output channel.
+STATIC const uint16_t comb_tuning[AUDIOFX_REVERB_COMBS] = { 1116, 1188, 1277, 1356 };
+STATIC const uint16_t allpass_tuning[AUDIOFX_REVERB_ALLPASSES] = { 556, 441 };
+
+STATIC void line_init(audiofx_reverb_line_t *line, uint32_t tuning, uint32_t sample_rate) {
+    line->length = MAX(1, tuning * sample_rate / 44100);
+    line->buffer = m_malloc(line->length * sizeof(int16_t), false);
+}
+
+STATIC void line_reset(audiofx_reverb_line_t *line) {
+    memset(line->buffer, 0, line->length * sizeof(int16_t));
+    line->pos = 0;
+    line->store = 0;
+}
+
+void common_hal_audiofx_reverb_construct(audiofx_reverb_obj_t *self, mp_obj_t source,
+    mp_float_t room_size, mp_float_t damping, mp_float_t mix) {
+    audiofx_base_init(&self->base, source);
+    uint32_t tail = 0;
+    for (size_t i = 0; i < AUDIOFX_REVERB_COMBS; i++) {
+        line_init(&self->comb[i], comb_tuning[i], self->base.sample_rate);
+        line_reset(&self->comb[i]);
+        tail = MAX(tail, self->comb[i].length);
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_ALLPASSES; i++) {
+        line_init(&self->allpass[i], allpass_tuning[i], self->base.sample_rate);
+        line_reset(&self->allpass[i]);
+        tail += self->allpass[i].length;
+    }
+    self->base.tail_frames = tail + AUDIOFX_BUFFER_FRAMES;
+    common_hal_audiofx_reverb_set_room_size(self, room_size);
+    common_hal_audiofx_reverb_set_damping(self, damping);
+    common_hal_audiofx_reverb_set_mix(self, mix);
+}
+
+void common_hal_audiofx_reverb_deinit(audiofx_reverb_obj_t *self) {
+    audiofx_base_deinit(&self->base);
+    for (size_t i = 0; i < AUDIOFX_REVERB_COMBS; i++) {
+        self->comb[i].buffer = NULL;
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_ALLPASSES; i++) {
+        self->allpass[i].buffer = NULL;
+    }
+}
+
+bool common_hal_audiofx_reverb_deinited(audiofx_reverb_obj_t *self) {
+    return audiofx_base_deinited(&self->base);
+}
+
+mp_float_t common_hal_audiofx_reverb_get_room_size(audiofx_reverb_obj_t *self) {
+    return self->room_size;
+}
+
+void common_hal_audiofx_reverb_set_room_size(audiofx_reverb_obj_t *self, mp_float_t arg) {
+    self->room_size = arg;
+    self->feedback_q15 = audiofx_float_to_q15(MICROPY_FLOAT_CONST(0.7) + arg * MICROPY_FLOAT_CONST(0.28));
+}
+
+mp_float_t common_hal_audiofx_reverb_get_damping(audiofx_reverb_obj_t *self) {
+    return self->damping;
+}
+
+void common_hal_audiofx_reverb_set_damping(audiofx_reverb_obj_t *self, mp_float_t arg) {
+    self->damping = arg;
+    self->damping_q15 = audiofx_float_to_q15(arg * MICROPY_FLOAT_CONST(0.4));
+}
+
+mp_float_t common_hal_audiofx_reverb_get_mix(audiofx_reverb_obj_t *self) {
+    return self->mix;
+}
+
+void common_hal_audiofx_reverb_set_mix(audiofx_reverb_obj_t *self, mp_float_t arg) {
+    self->mix = arg;
+    self->mix_q15 = audiofx_float_to_q15(arg);
+}
+
+void audiofx_reverb_reset_buffer(audiofx_reverb_obj_t *self,
+    bool single_channel_output, uint8_t channel) {
+    if (!audiofx_base_reset_buffer(&self->base, single_channel_output, channel)) {
+        return;
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_COMBS; i++) {
+        line_reset(&self->comb[i]);
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_ALLPASSES; i++) {
+        line_reset(&self->allpass[i]);
+    }
+}
+
+// Runs one comb over n samples of input, adding its output to acc.
+STATIC void comb_process(audiofx_reverb_line_t *comb, int32_t feedback, int32_t damping,
+    const int16_t *in, int32_t *acc, uint32_t n) {
+    int16_t *buffer = comb->buffer;
+    uint32_t pos = comb->pos, length = comb->length;
+    int32_t store = comb->store, undamped = 32768 - damping;
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t out = buffer[pos];
+        store = (out * undamped + store * damping) >> 15;
+        buffer[pos] = audiofx_sat16(in[i] + ((store * feedback) >> 15));
+        acc[i] += out;
+        if (++pos == length) {
+            pos = 0;
+        }
+    }
+    comb->pos = pos;
+    comb->store = store;
+}
+
+STATIC void allpass_process(audiofx_reverb_line_t *allpass, int16_t *io, uint32_t n) {
+    int16_t *buffer = allpass->buffer;
+    uint32_t pos = allpass->pos, length = allpass->length;
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t in = io[i];
+        int32_t delayed = buffer[pos];
+        buffer[pos] = audiofx_sat16(in + (delayed >> 1));
+        io[i] = audiofx_sat16(delayed - in);
+        if (++pos == length) {
+            pos = 0;
+        }
+    }
+    allpass->pos = pos;
+}
+
+STATIC void reverb_process(audiofx_base_t *base, int16_t *buffer, uint32_t n_frames) {
+    audiofx_reverb_obj_t *self = (audiofx_reverb_obj_t *)base;
+    int channel_count = base->channel_count;
+    int16_t in[n_frames];
+    int32_t acc[n_frames];
+
+    // Each comb has a gain of about 1/(1-feedback) at low frequencies, so
+    // the input is scaled down to leave headroom.
+    for (uint32_t i = 0; i < n_frames; i++) {
+        int32_t x = buffer[i * channel_count];
+        if (channel_count == 2) {
+            x = (x + buffer[i * channel_count + 1]) >> 1;
+        }
+        in[i] = x >> 3;
+        acc[i] = 0;
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_COMBS; i++) {
+        comb_process(&self->comb[i], self->feedback_q15, self->damping_q15, in, acc, n_frames);
+    }
+    for (uint32_t i = 0; i < n_frames; i++) {
+        in[i] = audiofx_sat16(acc[i] / AUDIOFX_REVERB_COMBS);
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_ALLPASSES; i++) {
+        allpass_process(&self->allpass[i], in, n_frames);
+    }
+
+    int32_t wet = self->mix_q15, dry = 32768 - wet;
+    for (uint32_t i = 0; i < n_frames; i++) {
+        for (int c = 0; c < channel_count; c++) {
+            int16_t *s = &buffer[i * channel_count + c];
+            *s = audiofx_sat16((*s * dry + in[i] * wet) >> 15);
+        }
+    }
+}
+
+audioio_get_buffer_result_t audiofx_reverb_get_buffer(audiofx_reverb_obj_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length) {
+    return audiofx_base_get_buffer(&self->base, single_channel_output, channel, buffer, buffer_length, reverb_process);
+}
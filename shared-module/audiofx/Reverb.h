@@ -0,0 +1,51 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-module/audiofx/__init__.h"
+
+#define AUDIOFX_REVERB_COMBS (4)
+#define AUDIOFX_REVERB_ALLPASSES (2)
+
+typedef struct {
+    int16_t *buffer;
+    uint32_t length, pos;
+    int32_t store; // the comb's damping lowpass
+} audiofx_reverb_line_t;
+
+typedef struct audiofx_reverb_obj {
+    audiofx_base_t base;
+    mp_float_t room_size, damping, mix;
+    int32_t feedback_q15, damping_q15, mix_q15;
+    audiofx_reverb_line_t comb[AUDIOFX_REVERB_COMBS];
+    audiofx_reverb_line_t allpass[AUDIOFX_REVERB_ALLPASSES];
+} audiofx_reverb_obj_t;
+
+void audiofx_reverb_reset_buffer(audiofx_reverb_obj_t *self,
+    bool single_channel_output, uint8_t channel);
+audioio_get_buffer_result_t audiofx_reverb_get_buffer(audiofx_reverb_obj_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length);
@@ -0,0 +1,228 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-module/audiofx/__init__.h"
+#include "supervisor/shared/translate/translate.h"
+
+// Output is also stopped at a sample this close to zero, so that a rounding
+// residue left circulating in a feedback path doesn't play forever.
+#define AUDIOFX_QUIET_LEVEL (4)
+
+void audiofx_base_init(audiofx_base_t *self, mp_obj_t source) {
+    uint8_t channel_count = audiosample_channel_count(source);
+    uint8_t bits_per_sample = audiosample_bits_per_sample(source);
+    mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(translate("bits_per_sample must be 8 or 16"));
+    }
+    bool single_buffer, samples_signed;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(source, false, &single_buffer, &samples_signed, &max_buffer_length, &spacing);
+
+    self->source = source;
+    self->sample_rate = audiosample_sample_rate(source);
+    self->channel_count = channel_count;
+    self->src_bits_per_sample = bits_per_sample;
+    self->src_signed = samples_signed;
+    self->other_channel = -1;
+    self->src_more_data = true;
+
+    size_t buffer_length = AUDIOFX_BUFFER_FRAMES * channel_count * sizeof(int16_t);
+    self->buffers[0] = m_malloc(buffer_length, false);
+    self->buffers[1] = m_malloc(buffer_length, false);
+}
+
+void audiofx_base_deinit(audiofx_base_t *self) {
+    self->buffers[0] = NULL;
+    self->buffers[1] = NULL;
+    self->source = MP_OBJ_NULL;
+}
+
+bool audiofx_base_deinited(audiofx_base_t *self) {
+    return self->buffers[0] == NULL;
+}
+
+void audiofx_base_check_for_deinit(audiofx_base_t *self) {
+    if (audiofx_base_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+int32_t audiofx_float_to_q15(mp_float_t value) {
+    return (int32_t)MICROPY_FLOAT_C_FUN(round)(value * 32768);
+}
+
+uint32_t audiofx_base_get_sample_rate(audiofx_base_t *self) {
+    return self->sample_rate;
+}
+
+uint8_t audiofx_base_get_bits_per_sample(audiofx_base_t *self) {
+    return 16;
+}
+
+uint8_t audiofx_base_get_channel_count(audiofx_base_t *self) {
+    return self->channel_count;
+}
+
+bool audiofx_base_reset_buffer(audiofx_base_t *self, bool single_channel_output, uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return false;
+    }
+    audiosample_reset_buffer(self->source, false, 0);
+    self->src_buffer = NULL;
+    self->src_length = 0;
+    self->src_more_data = true;
+    self->src_ended = false;
+    self->quiet_frames = 0;
+    self->other_channel = -1;
+    return true;
+}
+
+// Converts n source samples to signed 16 bit.
+STATIC void convert_samples(audiofx_base_t *self, int16_t *out, const uint8_t *src, uint32_t n) {
+    if (self->src_bits_per_sample == 16) {
+        const uint16_t *src16 = (const uint16_t *)src;
+        uint16_t flip = self->src_signed ? 0 : 0x8000;
+        for (uint32_t i = 0; i < n; i++) {
+            out[i] = (int16_t)(src16[i] ^ flip);
+        }
+    } else {
+        uint8_t flip = self->src_signed ? 0 : 0x80;
+        for (uint32_t i = 0; i < n; i++) {
+            out[i] = (int16_t)((int8_t)(src[i] ^ flip) << 8);
+        }
+    }
+}
+
+// Fills the buffer with source frames, padding with silence once the source
+// has ended. Returns false on a source error.
+STATIC bool read_source(audiofx_base_t *self, int16_t *out, uint32_t n_frames) {
+    uint32_t frame_bytes = self->src_bits_per_sample / 8 * self->channel_count;
+    uint32_t done = 0;
+    while (done < n_frames && !self->src_ended) {
+        if (self->src_length < frame_bytes) {
+            if (!self->src_more_data) {
+                self->src_ended = true;
+                break;
+            }
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->source, false, 0, &self->src_buffer, &self->src_length);
+            if (result == GET_BUFFER_ERROR) {
+                return false;
+            }
+            self->src_more_data = result == GET_BUFFER_MORE_DATA;
+            if (self->src_length < frame_bytes && self->src_more_data) {
+                // Nothing available yet; play silence rather than spin.
+                break;
+            }
+            continue;
+        }
+        uint32_t n = MIN(n_frames - done, self->src_length / frame_bytes);
+        convert_samples(self, out + done * self->channel_count, self->src_buffer, n * self->channel_count);
+        self->src_buffer += n * frame_bytes;
+        self->src_length -= n * frame_bytes;
+        done += n;
+    }
+    if (self->src_length < frame_bytes && !self->src_more_data) {
+        self->src_ended = true;
+    }
+    memset(out + done * self->channel_count, 0, (n_frames - done) * self->channel_count * sizeof(int16_t));
+    return true;
+}
+
+STATIC bool buffer_is_quiet(const int16_t *buffer, uint32_t n_samples) {
+    for (uint32_t i = 0; i < n_samples; i++) {
+        if (buffer[i] > AUDIOFX_QUIET_LEVEL || buffer[i] < -AUDIOFX_QUIET_LEVEL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+audioio_get_buffer_result_t audiofx_base_get_buffer(audiofx_base_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length,
+    audiofx_process_fun process) {
+    if (audiofx_base_deinited(self)) {
+        *buffer_length = 0;
+        return GET_BUFFER_ERROR;
+    }
+    if (!single_channel_output) {
+        channel = 0;
+    }
+    uint32_t length = AUDIOFX_BUFFER_FRAMES * self->channel_count * sizeof(int16_t);
+
+    // The second channel of a single channel output gets the same frames.
+    if (channel == self->other_channel) {
+        *buffer_length = length;
+        *buffer = (uint8_t *)(self->buffers[self->other_buffer_index] + channel);
+        return self->last_result;
+    }
+
+    self->buffer_index = !self->buffer_index;
+    self->other_channel = 1 - channel;
+    self->other_buffer_index = self->buffer_index;
+
+    int16_t *out = self->buffers[self->buffer_index];
+    if (!read_source(self, out, AUDIOFX_BUFFER_FRAMES)) {
+        *buffer_length = 0;
+        return GET_BUFFER_ERROR;
+    }
+    process(self, out, AUDIOFX_BUFFER_FRAMES);
+
+    audioio_get_buffer_result_t result = GET_BUFFER_MORE_DATA;
+    if (self->src_ended) {
+        if (buffer_is_quiet(out, AUDIOFX_BUFFER_FRAMES * self->channel_count)) {
+            self->quiet_frames += AUDIOFX_BUFFER_FRAMES;
+        } else {
+            self->quiet_frames = 0;
+        }
+        if (self->quiet_frames >= self->tail_frames) {
+            result = GET_BUFFER_DONE;
+        }
+    }
+    self->last_result = result;
+
+    *buffer_length = length;
+    *buffer = (uint8_t *)(out + channel);
+    return result;
+}
+
+void audiofx_base_get_buffer_structure(audiofx_base_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed, uint32_t *max_buffer_length, uint8_t *spacing) {
+    *single_buffer = false;
+    *samples_signed = true;
+    *max_buffer_length = AUDIOFX_BUFFER_FRAMES * self->channel_count * sizeof(int16_t);
+    if (single_channel_output) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
+
+// Frames in each buffer an effect hands to its output.
+#define AUDIOFX_BUFFER_FRAMES (256)
+
+// The common part of every effect: the source it wraps, the source buffer
+// being consumed, and the pair of buffers handed on to the output. Every
+// effect object starts with one of these.
+typedef struct audiofx_base {
+    mp_obj_base_t base;
+    mp_obj_t source;
+    uint32_t sample_rate;
+    uint8_t channel_count;
+    uint8_t src_bits_per_sample;
+    bool src_signed;
+    bool src_more_data, src_ended;
+    uint8_t *src_buffer;
+    uint32_t src_length;
+    // How long the effect can keep sounding once its input has fallen
+    // silent. Output stops after this many consecutive quiet frames.
+    uint32_t tail_frames, quiet_frames;
+    int16_t *buffers[2];
+    uint8_t buffer_index, other_buffer_index;
+    int8_t other_channel;
+    audioio_get_buffer_result_t last_result;
+} audiofx_base_t;
+
+// Processes one buffer of interleaved signed 16 bit frames in place.
+typedef void (*audiofx_process_fun)(audiofx_base_t *self, int16_t *buffer, uint32_t n_frames);
+
+void audiofx_base_init(audiofx_base_t *self, mp_obj_t source);
+void audiofx_base_deinit(audiofx_base_t *self);
+bool audiofx_base_deinited(audiofx_base_t *self);
+void audiofx_base_check_for_deinit(audiofx_base_t *self);
+
+// Saturate a value to the range of a signed 16 bit sample.
+static inline int16_t audiofx_sat16(int32_t v) {
+    return MIN(32767, MAX(-32768, v));
+}
+
+// A float from 0 to 1 as Q15 fixed point.
+int32_t audiofx_float_to_q15(mp_float_t value);
+
+uint32_t audiofx_base_get_sample_rate(audiofx_base_t *self);
+uint8_t audiofx_base_get_bits_per_sample(audiofx_base_t *self);
+uint8_t audiofx_base_get_channel_count(audiofx_base_t *self);
+
+// Restarts the source. Effects clear their own state after calling this.
+// Returns false if the call is for the second channel of the same reset.
+bool audiofx_base_reset_buffer(audiofx_base_t *self, bool single_channel_output, uint8_t channel);
+audioio_get_buffer_result_t audiofx_base_get_buffer(audiofx_base_t *self,
+    bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length,
+    audiofx_process_fun process);
+void audiofx_base_get_buffer_structure(audiofx_base_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed, uint32_t *max_buffer_length, uint8_t *spacing);
@@ -38,6 +38,14 @@
 #include "cmsis_compiler.h"
 #endif
 
+// The packed 16 bit instructions are in the DSP extension of Cortex-M4, M7
+// and M33.
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define MIXER_ARM_DSP (1)
+#else
+#define MIXER_ARM_DSP (0)
+#endif
+
 void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint8_t voice_count,
     uint32_t buffer_size,
@@ -106,7 +114,7 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
 
 __attribute__((always_inline))
 static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_ARM_DSP
     return __QADD16(a, b);
     #else
     uint32_t result = 0;
@@ -127,7 +135,7 @@ static inline uint32_t add16signed(uint32_t a, uint32_t b) {
 
 __attribute__((always_inline))
 static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_ARM_DSP
     mul <<= 16;
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
@@ -157,7 +165,7 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
 }
 
 static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_ARM_DSP
     return __UADD8(val, 0x80808080);
     #else
     return val ^ 0x80808080;
@@ -165,7 +173,7 @@ static inline uint32_t tounsigned8(uint32_t val) {
 }
 
 static inline uint32_t tounsigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_ARM_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -173,7 +181,7 @@ static inline uint32_t tounsigned16(uint32_t val) {
 }
 
 static inline uint32_t tosigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_ARM_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -188,10 +196,212 @@ static inline uint32_t pack8(uint32_t val) {
     return ((val & 0xff000000) >> 16) | ((val & 0xff00) >> 8);
 }
 
+// Mixes one word of samples into dest, or returns it when first is set.
+// Everything but the samples is a constant once inlined into the kernels
+// below, so each kernel has no checks left in its loop.
+__attribute__((always_inline))
+static inline uint32_t mix_word16(uint32_t word, uint32_t dest, bool first, bool to_signed,
+    bool full_level, uint16_t level) {
+    if (to_signed) {
+        word = tosigned16(word);
+    }
+    if (!full_level) {
+        word = mult16signed(word, level);
+    }
+    return first ? word : add16signed(word, dest);
+}
+
+__attribute__((always_inline))
+static inline void mix_kernel16(uint32_t *word_buffer, const uint32_t *src, uint32_t n,
+    bool first, bool to_signed, bool full_level, uint16_t level) {
+    uint32_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        uint32_t a = src[i];
+        uint32_t b = src[i + 1];
+        word_buffer[i] = mix_word16(a, word_buffer[i], first, to_signed, full_level, level);
+        word_buffer[i + 1] = mix_word16(b, word_buffer[i + 1], first, to_signed, full_level, level);
+    }
+    if (i < n) {
+        word_buffer[i] = mix_word16(src[i], word_buffer[i], first, to_signed, full_level, level);
+    }
+}
+
+__attribute__((always_inline))
+static inline void mix_kernel8(uint32_t *word_buffer, const uint32_t *src, uint32_t n,
+    bool first, bool to_signed, bool full_level, uint16_t level) {
+    uint16_t *hword_buffer = (uint16_t *)word_buffer;
+    const uint16_t *hsrc = (const uint16_t *)src;
+    for (uint32_t i = 0; i < n * 2; i++) {
+        uint32_t word = mix_word16(unpack8(hsrc[i]), unpack8(hword_buffer[i]),
+            first, to_signed, full_level, level);
+        hword_buffer[i] = pack8(word);
+    }
+}
+
+// A voice at full level is mixed without multiplying.
+#define MIX_KERNELS(kernel) \
+    static void kernel##_first(uint32_t *d, const uint32_t *s, uint32_t n, uint16_t l) { \
+        kernel(d, s, n, true, false, false, l); \
+    } \
+    static void kernel##_first_unsigned(uint32_t *d, const uint32_t *s, uint32_t n, uint16_t l) { \
+        kernel(d, s, n, true, true, false, l); \
+    } \
+    static void kernel##_first_full(uint32_t *d, const uint32_t *s, uint32_t n, uint16_t l) { \
+        kernel(d, s, n, true, false, true, l); \
+    } \
+    static void kernel##_first_unsigned_full(uint32_t *d, const uint32_t *s, uint32_t n, uint16_t l) { \
+        kernel(d, s, n, true, true, true, l); \
+    } \
+    static void kernel##_add(uint32_t *d, const uint32_t *s, uint32_t n, uint16_t l) { \
+        kernel(d, s, n, false, false, false, l); \
+    } \
+    static void kernel##_add_unsigned(uint32_t *d, const uint32_t *s, uint32_t n, uint16_t l) { \
+        kernel(d, s, n, false, true, false, l); \
+    } \
+    static void kernel##_add_full(uint32_t *d, const uint32_t *s, uint32_t n, uint16_t l) { \
+        kernel(d, s, n, false, false, true, l); \
+    } \
+    static void kernel##_add_unsigned_full(uint32_t *d, const uint32_t *s, uint32_t n, uint16_t l) { \
+        kernel(d, s, n, false, true, true, l); \
+    } \
+    static void (*const kernel##_table[8])(uint32_t *, const uint32_t *, uint32_t, uint16_t) = { \
+        kernel##_first, kernel##_first_full, kernel##_first_unsigned, kernel##_first_unsigned_full, \
+        kernel##_add, kernel##_add_full, kernel##_add_unsigned, kernel##_add_unsigned_full, \
+    };
+
+MIX_KERNELS(mix_kernel16)
+MIX_KERNELS(mix_kernel8)
+
+static void mix_words(audiomixer_mixer_obj_t *self, bool voices_active, bool samples_signed,
+    uint16_t level, uint32_t *word_buffer, uint32_t *src, uint32_t n) {
+    // First active voice gets copied over verbatim.
+    size_t kernel = (voices_active ? 4 : 0) | (samples_signed ? 0 : 2) | (level == (1 << 15) ? 1 : 0);
+    if (MP_LIKELY(self->bits_per_sample == 16)) {
+        mix_kernel16_table[kernel](word_buffer, src, n, level);
+    } else {
+        mix_kernel8_table[kernel](word_buffer, src, n, level);
+    }
+}
+
+// Loads the next buffer of a converted voice. Returns false when the sample
+// has ended.
+static bool load_source_buffer(audiomixer_mixervoice_obj_t *voice) {
+    if (!voice->more_data) {
+        if (!voice->loop) {
+            return false;
+        }
+        audiosample_reset_buffer(voice->sample, false, 0);
+    }
+    audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, (uint8_t **)&voice->remaining_buffer, &voice->buffer_length);
+    voice->more_data = result == GET_BUFFER_MORE_DATA;
+    return result != GET_BUFFER_ERROR;
+}
+
+// Reads the next source frame of a converted voice into next_frame as signed
+// 16 bit left and right values. Returns false when the sample has ended.
+static bool read_source_frame(audiomixer_mixervoice_obj_t *voice) {
+    uint32_t frame_bytes = voice->src_bits_per_sample / 8 * voice->src_channel_count;
+    // A sample that is looping but gives back nothing after a reset has ended too.
+    for (uint8_t tries = 0; voice->buffer_length < frame_bytes; tries++) {
+        if (tries == 2 || !load_source_buffer(voice)) {
+            return false;
+        }
+    }
+    uint8_t *src = (uint8_t *)voice->remaining_buffer;
+    for (uint8_t c = 0; c < voice->src_channel_count; c++) {
+        if (voice->src_bits_per_sample == 16) {
+            uint16_t v = ((uint16_t *)src)[c];
+            if (!voice->src_signed) {
+                v ^= 0x8000;
+            }
+            voice->next_frame[c] = (int16_t)v;
+        } else {
+            uint8_t v = src[c];
+            if (!voice->src_signed) {
+                v ^= 0x80;
+            }
+            voice->next_frame[c] = (int16_t)(v << 8);
+        }
+    }
+    if (voice->src_channel_count == 1) {
+        voice->next_frame[1] = voice->next_frame[0];
+    }
+    voice->remaining_buffer = (uint32_t *)(src + frame_bytes);
+    voice->buffer_length -= frame_bytes;
+    return true;
+}
+
+// Fills up to n words with the voice's sample converted to the mixer's
+// format, resampling by linear interpolation. The words are always signed.
+// Returns the number of words filled, which is less than n once the sample
+// has ended.
+static uint32_t convert_voice(audiomixer_mixer_obj_t *self, audiomixer_mixervoice_obj_t *voice,
+    uint32_t *words, uint32_t n) {
+    uint32_t samples_per_word = self->bits_per_sample == 16 ? 2 : 4;
+    uint32_t frames = n * samples_per_word / self->channel_count;
+    int16_t *out16 = (int16_t *)words;
+    int8_t *out8 = (int8_t *)words;
+    uint32_t out = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        while (voice->phase >= (1 << 16)) {
+            voice->phase -= 1 << 16;
+            if (voice->src_ended) {
+                voice->sample = NULL;
+                // Pad out the last word with silence.
+                uint32_t filled = (out + samples_per_word - 1) / samples_per_word;
+                for (; out < filled * samples_per_word; out++) {
+                    if (self->bits_per_sample == 16) {
+                        out16[out] = 0;
+                    } else {
+                        out8[out] = 0;
+                    }
+                }
+                return filled;
+            }
+            voice->frame[0] = voice->next_frame[0];
+            voice->frame[1] = voice->next_frame[1];
+            // At the end next_frame is left as it is, so the last frame is
+            // still played.
+            voice->src_ended = !read_source_frame(voice);
+        }
+        int32_t frac = voice->phase >> 1;
+        int32_t left = voice->frame[0] + (((voice->next_frame[0] - voice->frame[0]) * frac) >> 15);
+        int32_t right = voice->frame[1] + (((voice->next_frame[1] - voice->frame[1]) * frac) >> 15);
+        voice->phase += voice->step;
+        if (self->channel_count == 1) {
+            left = (left + right) >> 1;
+        }
+        if (self->bits_per_sample == 16) {
+            out16[out++] = left;
+            if (self->channel_count == 2) {
+                out16[out++] = right;
+            }
+        } else {
+            out8[out++] = left >> 8;
+            if (self->channel_count == 2) {
+                out8[out++] = right >> 8;
+            }
+        }
+    }
+    return n;
+}
+
+// Words of converted samples mixed at a time.
+#define CONVERT_CHUNK_WORDS (32)
+
 static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
     audiomixer_mixervoice_obj_t *voice, bool voices_active,
     uint32_t *word_buffer, uint32_t length) {
-    while (length != 0) {
+    if (voice->convert) {
+        uint32_t converted[CONVERT_CHUNK_WORDS];
+        while (length != 0 && voice->sample != NULL) {
+            uint32_t n = convert_voice(self, voice, converted, MIN(length, CONVERT_CHUNK_WORDS));
+            mix_words(self, voices_active, true, voice->level, word_buffer, converted, n);
+            length -= n;
+            word_buffer += n;
+        }
+    }
+    while (length != 0 && !voice->convert) {
         if (voice->buffer_length == 0) {
             if (!voice->more_data) {
                 if (voice->loop) {
@@ -211,64 +421,7 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
         }
 
         uint32_t n = MIN(voice->buffer_length, length);
-        uint32_t *src = voice->remaining_buffer;
-        uint16_t level = voice->level;
-
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        v = tosigned16(v);
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    hword_buffer[i] = pack8(word);
-                }
-            }
-        } else {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word = tosigned16(word);
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    word = add16signed(word, unpack8(hword_buffer[i]));
-                    hword_buffer[i] = pack8(word);
-                }
-            }
-        }
+        mix_words(self, voices_active, self->samples_signed, voice->level, word_buffer, voice->remaining_buffer, n);
         length -= n;
         word_buffer += n;
         voice->remaining_buffer += n;
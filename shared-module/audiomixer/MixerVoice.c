@@ -51,14 +51,15 @@ void common_hal_audiomixer_mixervoice_set_level(audiomixer_mixervoice_obj_t *sel
 }
 
 void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp_obj_t sample, bool loop) {
-    if (audiosample_sample_rate(sample) != self->parent->sample_rate) {
-        mp_raise_ValueError(translate("The sample's sample rate does not match the mixer's"));
+    audiomixer_mixer_obj_t *parent = self->parent;
+    uint32_t sample_rate = audiosample_sample_rate(sample);
+    uint8_t channel_count = audiosample_channel_count(sample);
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample);
+    if (channel_count > 2) {
+        mp_raise_ValueError(translate("Too many channels in sample"));
     }
-    if (audiosample_channel_count(sample) != self->parent->channel_count) {
-        mp_raise_ValueError(translate("The sample's channel count does not match the mixer's"));
-    }
-    if (audiosample_bits_per_sample(sample) != self->parent->bits_per_sample) {
-        mp_raise_ValueError(translate("The sample's bits_per_sample does not match the mixer's"));
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(translate("bits_per_sample must be 8 or 16"));
     }
     bool single_buffer;
     bool samples_signed;
@@ -66,16 +67,32 @@ void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp
     uint8_t spacing;
     audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed,
         &max_buffer_length, &spacing);
-    if (samples_signed != self->parent->samples_signed) {
-        mp_raise_ValueError(translate("The sample's signedness does not match the mixer's"));
-    }
+
+    // Samples that don't match the mixer are converted a frame at a time as
+    // they are mixed.
+    self->convert = sample_rate != parent->sample_rate ||
+        channel_count != parent->channel_count ||
+        bits_per_sample != parent->bits_per_sample ||
+        samples_signed != parent->samples_signed;
+    self->src_signed = samples_signed;
+    self->src_ended = false;
+    self->src_bits_per_sample = bits_per_sample;
+    self->src_channel_count = channel_count;
+    self->step = ((uint64_t)sample_rate << 16) / parent->sample_rate;
+    // Start two frames back so the first two source frames get loaded.
+    self->phase = 2 << 16;
+    self->next_frame[0] = 0;
+    self->next_frame[1] = 0;
+
     self->sample = sample;
     self->loop = loop;
 
     audiosample_reset_buffer(sample, false, 0);
     audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->buffer_length);
-    // Track length in terms of words.
-    self->buffer_length /= sizeof(uint32_t);
+    // Track length in terms of words, or bytes when converting.
+    if (!self->convert) {
+        self->buffer_length /= sizeof(uint32_t);
+    }
     self->more_data = result == GET_BUFFER_MORE_DATA;
 }
 
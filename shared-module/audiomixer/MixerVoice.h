@@ -38,8 +38,19 @@ typedef struct {
     bool loop;
     bool more_data;
     uint32_t *remaining_buffer;
-    uint32_t buffer_length;
+    uint32_t buffer_length; // in words, or in bytes when converting
     uint16_t level;
+
+    // Used when the sample's format doesn't match the mixer's.
+    bool convert;
+    bool src_signed;
+    bool src_ended;
+    uint8_t src_bits_per_sample;
+    uint8_t src_channel_count;
+    uint32_t step; // source frames per mixer frame, 16.16 fixed point
+    uint32_t phase; // position between frame and next_frame, 16.16 fixed point
+    int16_t frame[2];
+    int16_t next_frame[2];
 } audiomixer_mixervoice_obj_t;
 
 
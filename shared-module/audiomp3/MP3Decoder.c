@@ -41,6 +41,105 @@
 
 #define MAX_BUFFER_LEN (MAX_NSAMP * MAX_NGRAN * MAX_NCHAN * sizeof(int16_t))
 
+#if CIRCUITPY_AUDIOMP3_READAHEAD
+// Each run of the read-ahead callback reads at most this much, so that it
+// doesn't hold up other background tasks for long
+#define READAHEAD_CHUNK (512)
+
+/** Read the next part of the file into the free space of the read-ahead ring.
+ *
+ * Sets self->file_eof when the end of the file is reached. A failing f_read
+ * also sets it, as there is nobody to raise an error to when this runs in
+ * the background; the track then ends once the ring drains.
+ */
+STATIC void mp3file_readahead_fill(audiomp3_mp3file_obj_t *self, uint32_t max_bytes) {
+    while (max_bytes && !self->file_eof && self->readahead_count < CIRCUITPY_AUDIOMP3_READAHEAD) {
+        uint32_t write = (self->readahead_read + self->readahead_count) % CIRCUITPY_AUDIOMP3_READAHEAD;
+        UINT to_read = MIN(max_bytes, CIRCUITPY_AUDIOMP3_READAHEAD - MAX(write, self->readahead_count));
+        UINT bytes_read = 0;
+        if (f_read(&self->file->fp, self->readahead + write, to_read, &bytes_read) != FR_OK || bytes_read == 0) {
+            self->file_eof = true;
+            break;
+        }
+        self->readahead_count += bytes_read;
+        max_bytes -= bytes_read;
+    }
+}
+
+STATIC void mp3file_readahead_cb(void *self_in) {
+    audiomp3_mp3file_obj_t *self = self_in;
+    // The decoder may have been deinited since this was scheduled
+    if (self->readahead == NULL || self->file == NULL) {
+        return;
+    }
+    mp3file_readahead_fill(self, READAHEAD_CHUNK);
+    if (!self->file_eof && self->readahead_count < CIRCUITPY_AUDIOMP3_READAHEAD) {
+        // Come back for more after the other background tasks have had a turn
+        background_callback_add(&self->inbuf_fill_cb, mp3file_readahead_cb, self);
+    }
+}
+
+/** Empty the read-ahead ring, after the file position is changed. */
+STATIC void mp3file_readahead_reset(audiomp3_mp3file_obj_t *self) {
+    self->readahead_read = 0;
+    self->readahead_count = 0;
+    self->file_eof = false;
+}
+#endif
+
+/** Read up to len bytes of the file, taking them from the read-ahead ring if it has them.
+ *
+ * Only if the ring runs dry is the file read directly, so that decoding can
+ * continue.
+ *
+ * Raises OSError if f_read fails.
+ */
+STATIC UINT mp3file_read(audiomp3_mp3file_obj_t *self, uint8_t *buf, UINT len) {
+    UINT total = 0;
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    while (len && self->readahead_count) {
+        UINT n = MIN(len, MIN(self->readahead_count, CIRCUITPY_AUDIOMP3_READAHEAD - self->readahead_read));
+        memcpy(buf, self->readahead + self->readahead_read, n);
+        self->readahead_read = (self->readahead_read + n) % CIRCUITPY_AUDIOMP3_READAHEAD;
+        self->readahead_count -= n;
+        buf += n;
+        len -= n;
+        total += n;
+    }
+    if (self->file_eof) {
+        return total;
+    }
+    #endif
+    if (len) {
+        UINT bytes_read = 0;
+        if (f_read(&self->file->fp, buf, len, &bytes_read) != FR_OK) {
+            self->eof = true;
+            mp_raise_OSError(MP_EIO);
+        }
+        #if CIRCUITPY_AUDIOMP3_READAHEAD
+        if (bytes_read < len) {
+            self->file_eof = true;
+        }
+        #endif
+        total += bytes_read;
+    }
+    return total;
+}
+
+/** Skip over size bytes of the file, past what is in the input buffer. */
+STATIC void mp3file_skip(audiomp3_mp3file_obj_t *self, uint32_t size) {
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    uint32_t n = MIN(size, self->readahead_count);
+    self->readahead_read = (self->readahead_read + n) % CIRCUITPY_AUDIOMP3_READAHEAD;
+    self->readahead_count -= n;
+    size -= n;
+    if (size == 0) {
+        return;
+    }
+    #endif
+    f_lseek(&self->file->fp, f_tell(&self->file->fp) + size);
+}
+
 /** Fill the input buffer unconditionally.
  *
  * Returns true if the input buffer contains any useful data,
@@ -63,12 +162,8 @@ STATIC bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self) {
         self->inbuf_offset = 0;
 
         UINT to_read = end_of_buffer - new_end_of_data;
-        UINT bytes_read = 0;
         memset(new_end_of_data, 0, to_read);
-        if (f_read(&self->file->fp, new_end_of_data, to_read, &bytes_read) != FR_OK) {
-            self->eof = true;
-            mp_raise_OSError(MP_EIO);
-        }
+        UINT bytes_read = mp3file_read(self, new_end_of_data, to_read);
 
         if (bytes_read == 0) {
             self->eof = true;
@@ -85,6 +180,7 @@ STATIC bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self) {
     return self->inbuf_offset < self->inbuf_length;
 }
 
+#if !CIRCUITPY_AUDIOMP3_READAHEAD
 /** Update the inbuf from a background callback.
  *
  * This variant is introduced so that at the site of the
@@ -93,6 +189,7 @@ STATIC bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self) {
 STATIC void mp3file_update_inbuf_cb(void *self) {
     mp3file_update_inbuf_always(self);
 }
+#endif
 
 /** Fill the input buffer if it is less than half full.
  *
@@ -139,8 +236,8 @@ STATIC void mp3file_skip_id3v2(audiomp3_mp3file_obj_t *self) {
     CONSUME(self, to_consume);
     size -= to_consume;
 
-    // Next, seek in the file after the header
-    f_lseek(&self->file->fp, f_tell(&self->file->fp) + size);
+    // Next, skip the rest of the header in the file
+    mp3file_skip(self, size);
     return;
 }
 
@@ -195,6 +292,13 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
         common_hal_audiomp3_mp3file_deinit(self);
         m_malloc_fail(self->inbuf_length);
     }
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    self->readahead = m_malloc(CIRCUITPY_AUDIOMP3_READAHEAD, false);
+    if (self->readahead == NULL) {
+        common_hal_audiomp3_mp3file_deinit(self);
+        m_malloc_fail(CIRCUITPY_AUDIOMP3_READAHEAD);
+    }
+    #endif
     self->decoder = MP3InitDecoder();
     if (self->decoder == NULL) {
         common_hal_audiomp3_mp3file_deinit(self);
@@ -231,6 +335,9 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, pyb_file
 
     self->file = file;
     f_lseek(&self->file->fp, 0);
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    mp3file_readahead_reset(self);
+    #endif
     self->inbuf_offset = self->inbuf_length;
     self->eof = 0;
     self->other_channel = -1;
@@ -245,6 +352,9 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, pyb_file
     memset(self->buffers[1], 0, MAX_BUFFER_LEN);
     MP3FrameInfo fi;
     bool result = mp3file_get_next_frame_info(self, &fi);
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    background_callback_add(&self->inbuf_fill_cb, mp3file_readahead_cb, self);
+    #endif
     background_callback_end_critical_section();
     if (!result) {
         mp_raise_msg(&mp_type_RuntimeError,
@@ -262,6 +372,9 @@ void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
     MP3FreeDecoder(self->decoder);
     self->decoder = NULL;
     self->inbuf = NULL;
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    self->readahead = NULL;
+    #endif
     self->buffers[0] = NULL;
     self->buffers[1] = NULL;
     self->file = NULL;
@@ -299,6 +412,9 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     // loads
     background_callback_begin_critical_section();
     f_lseek(&self->file->fp, 0);
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    mp3file_readahead_reset(self);
+    #endif
     self->inbuf_offset = self->inbuf_length;
     self->eof = 0;
     self->samples_decoded = 0;
@@ -306,6 +422,9 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     mp3file_update_inbuf_half(self);
     mp3file_skip_id3v2(self);
     mp3file_find_sync_word(self);
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    background_callback_add(&self->inbuf_fill_cb, mp3file_readahead_cb, self);
+    #endif
     background_callback_end_critical_section();
 }
 
@@ -358,12 +477,19 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     mp3file_skip_id3v2(self);
     int result = mp3file_find_sync_word(self) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
 
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    // Decoding only ever copies from the ring; the file is read in the background
+    if (!self->file_eof) {
+        background_callback_add(&self->inbuf_fill_cb, mp3file_readahead_cb, self);
+    }
+    #else
     if (self->inbuf_offset >= 512) {
         background_callback_add(
             &self->inbuf_fill_cb,
             mp3file_update_inbuf_cb,
             self);
     }
+    #endif
 
     return result;
 }
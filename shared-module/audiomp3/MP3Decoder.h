@@ -41,6 +41,14 @@ typedef struct {
     uint8_t *inbuf;
     uint32_t inbuf_length;
     uint32_t inbuf_offset;
+    #if CIRCUITPY_AUDIOMP3_READAHEAD
+    // Ring of file data read ahead of the decoder by inbuf_fill_cb
+    uint8_t *readahead;
+    uint32_t readahead_read;
+    uint32_t readahead_count;
+    // All of the file has been read into the ring (which may still hold some of it)
+    bool file_eof;
+    #endif
     int16_t *buffers[2];
     uint32_t len;
     uint32_t frame_buffer_size;
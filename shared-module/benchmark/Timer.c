@@ -0,0 +1,59 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/benchmark/Timer.h"
+#include "shared-module/benchmark/__init__.h"
+#include "supervisor/cycle_count.h"
+#include "supervisor/shared/tick.h"
+
+void common_hal_benchmark_timer_construct(benchmark_timer_obj_t *self) {
+    self->start_ms = 0;
+    self->start_cycles = 0;
+    self->cycles = 0;
+    self->running = false;
+}
+
+void common_hal_benchmark_timer_start(benchmark_timer_obj_t *self) {
+    self->running = true;
+    self->cycles = 0;
+    self->start_ms = supervisor_ticks_ms64();
+    self->start_cycles = port_get_cycle_count();
+}
+
+uint64_t common_hal_benchmark_timer_stop(benchmark_timer_obj_t *self) {
+    if (self->running) {
+        self->cycles = shared_module_benchmark_elapsed(self->start_cycles, self->start_ms);
+        self->running = false;
+    }
+    return self->cycles;
+}
+
+uint64_t common_hal_benchmark_timer_get_cycles(benchmark_timer_obj_t *self) {
+    if (self->running) {
+        return shared_module_benchmark_elapsed(self->start_cycles, self->start_ms);
+    }
+    return self->cycles;
+}
@@ -0,0 +1,50 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/benchmark/__init__.h"
+#include "shared-module/benchmark/__init__.h"
+#include "supervisor/cycle_count.h"
+#include "supervisor/shared/tick.h"
+
+uint32_t common_hal_benchmark_cycles(void) {
+    return port_get_cycle_count();
+}
+
+uint32_t common_hal_benchmark_cycles_per_second(void) {
+    return port_get_cycle_frequency();
+}
+
+uint64_t shared_module_benchmark_elapsed(uint32_t start_cycles, uint64_t start_ms) {
+    uint32_t diff = port_get_cycle_count() - start_cycles;
+    uint64_t elapsed_ms = supervisor_ticks_ms64() - start_ms;
+    uint64_t expected = elapsed_ms * port_get_cycle_frequency() / 1000;
+    if (expected <= diff) {
+        return diff;
+    }
+    // Pick the number of wraps which lands closest to the tick's estimate.
+    uint64_t wraps = (expected - diff + (1ull << 31)) >> 32;
+    return diff + (wraps << 32);
+}
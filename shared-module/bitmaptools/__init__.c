@@ -43,6 +43,79 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+static int64_t rotozoom_fixed(mp_float_t value) {
+    return (int64_t)MICROPY_FLOAT_C_FUN(floor)(value * 65536 + MICROPY_FLOAT_CONST(0.5));
+}
+
+static int64_t rotozoom_floor_div(int64_t n, int64_t d) {
+    // d must be positive
+    int64_t q = n / d;
+    if (n % d != 0 && n < 0) {
+        q--;
+    }
+    return q;
+}
+
+// Narrows [*first, *last] to the steps k where lo <= start + k * step <= hi.
+static void rotozoom_clip_steps(int64_t start, int64_t step, int64_t lo, int64_t hi, int32_t *first, int32_t *last) {
+    int64_t k0, k1;
+    if (step > 0) {
+        k0 = -rotozoom_floor_div(start - lo, step);
+        k1 = rotozoom_floor_div(hi - start, step);
+    } else if (step < 0) {
+        k0 = -rotozoom_floor_div(hi - start, -step);
+        k1 = rotozoom_floor_div(start - lo, -step);
+    } else if (start < lo || start > hi) {
+        *last = *first - 1;
+        return;
+    } else {
+        return;
+    }
+    if (k0 > *first) {
+        *first = MIN(k0, *last + 1);
+    }
+    if (k1 < *last) {
+        *last = MAX(k1, *first - 1);
+    }
+}
+
+static inline uint32_t rgb565_spread(uint32_t c) {
+    // Leaves each channel room to be scaled by up to 32: -----gggggg-----rrrrr------bbbbb
+    return (c | (c << 16)) & 0x07e0f81f;
+}
+
+static inline uint32_t rgb565_lerp(uint32_t a, uint32_t b, uint32_t weight) {
+    return ((a * (32 - weight) + b * weight) >> 5) & 0x07e0f81f;
+}
+
+// Blends the four RGB565 pixels around the 16.16 source position (u, v), which is
+// measured from the pixel corners, so pixel centres are half a pixel in.
+static uint32_t rotozoom_bilinear(displayio_bitmap_t *source, uint32_t u, uint32_t v,
+    int16_t clip0_x, int16_t clip0_y, int16_t clip1_x, int16_t clip1_y,
+    uint32_t nearest, uint32_t skip_index, bool skip_index_none) {
+    int32_t fu = (int32_t)u - 0x8000;
+    int32_t fv = (int32_t)v - 0x8000;
+    int32_t x0 = MAX(fu >> 16, clip0_x);
+    int32_t y0 = MAX(fv >> 16, clip0_y);
+    int32_t x1 = MIN((fu >> 16) + 1, clip1_x - 1);
+    int32_t y1 = MIN((fv >> 16) + 1, clip1_y - 1);
+    uint32_t wx = (fu & 0xffff) >> 11;
+    uint32_t wy = (fv & 0xffff) >> 11;
+
+    const uint16_t *row0 = (const uint16_t *)displayio_bitmap_get_row(source, y0);
+    const uint16_t *row1 = (const uint16_t *)displayio_bitmap_get_row(source, y1);
+    uint32_t c00 = row0[x0], c01 = row0[x1], c10 = row1[x0], c11 = row1[x1];
+    if (!skip_index_none && (c00 == skip_index || c01 == skip_index || c10 == skip_index || c11 == skip_index)) {
+        // Don't blend the transparent color into its neighbours.
+        return nearest;
+    }
+
+    uint32_t top = rgb565_lerp(rgb565_spread(c00), rgb565_spread(c01), wx);
+    uint32_t bottom = rgb565_lerp(rgb565_spread(c10), rgb565_spread(c11), wx);
+    uint32_t c = rgb565_lerp(top, bottom, wy);
+    return (c | (c >> 16)) & 0xffff;
+}
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -51,7 +124,7 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     int16_t source_clip1_x, int16_t source_clip1_y,
     mp_float_t angle,
     mp_float_t scale,
-    uint32_t skip_index, bool skip_index_none) {
+    uint32_t skip_index, bool skip_index_none, bool bilinear) {
 
     // Copies region from source to the destination bitmap, including rotation,
     // scaling and clipping of either the source or destination regions
@@ -71,6 +144,7 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     // skip_index: color index that should be ignored (and not copied over)
     // skip_index_none: if skip_index_none is True, then all color indexes should be copied
     //                                                     (that is, no color indexes should be skipped)
+    // bilinear: blend neighbouring source pixels, for RGB565 source and destination bitmaps
 
 
     // Copy complete "source" bitmap into "self" bitmap at location x,y in the "self"
@@ -200,28 +274,99 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     mp_float_t startu = px - (ox * dvCol + oy * duCol);
     mp_float_t startv = py - (ox * dvRow + oy * duRow);
 
-    mp_float_t rowu = startu + miny * duCol;
-    mp_float_t rowv = startv + miny * dvCol;
-
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
+    if (minx > maxx || source_clip0_x >= source_clip1_x || source_clip0_y >= source_clip1_y) {
+        return;
+    }
+
+    // The source position is stepped in 16.16 fixed point. Each position is an exact
+    // integer function of x and y, so the run of destination pixels that lands inside
+    // the source clip window can be worked out once per row.
+    int64_t u_start = rotozoom_fixed(startu);
+    int64_t v_start = rotozoom_fixed(startv);
+    int64_t du_row = rotozoom_fixed(duRow);
+    int64_t dv_row = rotozoom_fixed(dvRow);
+    int64_t du_col = rotozoom_fixed(duCol);
+    int64_t dv_col = rotozoom_fixed(dvCol);
+
+    int64_t u_min = (int64_t)source_clip0_x << 16;
+    int64_t u_max = ((int64_t)source_clip1_x << 16) - 1;
+    int64_t v_min = (int64_t)source_clip0_y << 16;
+    int64_t v_max = ((int64_t)source_clip1_y << 16) - 1;
+
+    // Filtering only makes sense when both bitmaps hold RGB565 colors.
+    bilinear = bilinear && source->bits_per_value == 16 && self->bits_per_value == 16;
+
+    // The clip windows lie within both bitmaps, so rows can be addressed directly.
     for (y = miny; y <= maxy; y++) {
-        mp_float_t u = rowu + minx * duRow;
-        mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
-                if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
+        int64_t u0 = u_start + minx * du_row + y * du_col;
+        int64_t v0 = v_start + minx * dv_row + y * dv_col;
+
+        int32_t first = 0;
+        int32_t last = maxx - minx;
+        rotozoom_clip_steps(u0, du_row, u_min, u_max, &first, &last);
+        rotozoom_clip_steps(v0, dv_row, v_min, v_max, &first, &last);
+        if (first > last) {
+            continue;
+        }
+        if (first < last && (du_row > INT32_MAX || du_row < INT32_MIN || dv_row > INT32_MAX || dv_row < INT32_MIN)) {
+            // A step this large leaves the 32-bit range; only one sample can be taken.
+            last = first;
+        }
+
+        uint32_t *dest_row = displayio_bitmap_get_row(self, y);
+        uint32_t u = (uint32_t)(u0 + first * du_row);
+        uint32_t v = (uint32_t)(v0 + first * dv_row);
+        int32_t u_step = (int32_t)du_row;
+        int32_t v_step = (int32_t)dv_row;
+        for (x = minx + first; x <= minx + last; x++) {
+            uint32_t c = displayio_bitmap_row_get_value(source, displayio_bitmap_get_row(source, v >> 16), u >> 16);
+            if ((skip_index_none) || (c != skip_index)) {
+                if (bilinear) {
+                    c = rotozoom_bilinear(source, u, v, source_clip0_x, source_clip0_y,
+                        source_clip1_x, source_clip1_y, c, skip_index, skip_index_none);
                 }
+                displayio_bitmap_row_set_value(self, dest_row, x, c);
+            }
+            u += u_step;
+            v += v_step;
+        }
+    }
+}
+
+void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source,
+    int16_t x, int16_t y, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+    displayio_palette_t *source_palette,
+    uint32_t skip_source_index, bool skip_source_index_none,
+    uint32_t skip_dest_index, bool skip_dest_index_none) {
+    // input checks should ensure that x1 < x2 and y1 < y2 are within the source bitmap
+    // and that x, y are within the destination bitmap
+
+    displayio_area_t area = { x, y, x + (x2 - x1), y + (y2 - y1), NULL };
+    displayio_area_t bitmap_area = { 0, 0, destination->width, destination->height, NULL };
+    if (!displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        return;
+    }
+    displayio_bitmap_set_dirty_area(destination, &area);
+
+    // Look up transparency once per index rather than once per pixel.
+    uint32_t skip_source[256 / 32];
+    const uint32_t *skip_lookup = NULL;
+    if (source_palette != NULL) {
+        memset(skip_source, 0, sizeof(skip_source));
+        uint32_t count = MIN(common_hal_displayio_palette_get_len(source_palette), 256);
+        for (uint32_t i = 0; i < count; i++) {
+            if (common_hal_displayio_palette_is_transparent(source_palette, i)) {
+                skip_source[i / 32] |= 1u << (i % 32);
             }
-            u += duRow;
-            v += dvRow;
         }
-        rowu += duCol;
-        rowv += dvCol;
+        skip_lookup = skip_source;
     }
+
+    displayio_bitmap_blit_rows(destination, x, y, source, x1, y1, x2, y2, skip_lookup,
+        skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none);
 }
 
 void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
@@ -552,6 +697,7 @@ void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int
     uint32_t mask = (1 << common_hal_displayio_bitmap_get_bits_per_value(self)) - 1;
 
     for (int y = y1; y < y2; y++) {
+        uint32_t *row = displayio_bitmap_get_row(self, y);
         for (int x = x1; x < x2; x++) {
             uint32_t value;
             switch (element_size) {
@@ -570,7 +716,7 @@ void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int
                     break;
             }
             if (!skip_specified || value != skip_value) {
-                displayio_bitmap_write_pixel(self, x, y, value & mask);
+                displayio_bitmap_row_set_value(self, row, x, value & mask);
             }
         }
     }
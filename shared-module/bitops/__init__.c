@@ -154,8 +154,71 @@ static void bit_transpose_var(uint32_t *result, const uint8_t *src, size_t src_s
     }
 }
 
+static void store_word(uint8_t *dest, uint32_t word) {
+    // The output may be an unaligned slice of a bigger buffer.
+    memcpy(dest, &word, sizeof(word));
+}
+
+// Each group of 8 lanes is transposed on its own, then the byte for each
+// group is gathered into one output unit, lane 0 in the lowest bit.
+static void bit_transpose_16(uint8_t *result, const uint8_t *src, size_t src_stride, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint32_t lo[2], hi[2];
+        transpose_8(lo, src, src_stride);
+        transpose_8(hi, src + 8 * src_stride, src_stride);
+        for (int j = 0; j < 2; j++) {
+            uint32_t a = lo[j], b = hi[j], t;
+            // Swap bytes 1 and 3 of a with bytes 0 and 2 of b.
+            t = ((a >> 8) ^ b) & 0x00FF00FF;
+            b ^= t;
+            a ^= t << 8;
+            store_word(result, (a & 0x0000FFFF) | (b << 16));
+            store_word(result + 4, (a >> 16) | (b & 0xFFFF0000));
+            result += 8;
+        }
+        src += 1;
+    }
+}
+
+static void bit_transpose_32(uint8_t *result, const uint8_t *src, size_t src_stride, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint32_t g0[2], g1[2], g2[2], g3[2];
+        transpose_8(g0, src, src_stride);
+        transpose_8(g1, src + 8 * src_stride, src_stride);
+        transpose_8(g2, src + 16 * src_stride, src_stride);
+        transpose_8(g3, src + 24 * src_stride, src_stride);
+        for (int j = 0; j < 2; j++) {
+            uint32_t a = g0[j], b = g1[j], c = g2[j], d = g3[j], t;
+            // Transpose the 4x4 matrix of bytes: first the 2x2 blocks of
+            // bytes, then the 2x2 matrix of halfwords.
+            t = ((a >> 8) ^ b) & 0x00FF00FF;
+            b ^= t;
+            a ^= t << 8;
+            t = ((c >> 8) ^ d) & 0x00FF00FF;
+            d ^= t;
+            c ^= t << 8;
+            t = ((a >> 16) ^ c) & 0x0000FFFF;
+            c ^= t;
+            a ^= t << 16;
+            t = ((b >> 16) ^ d) & 0x0000FFFF;
+            d ^= t;
+            b ^= t << 16;
+            store_word(result, a);
+            store_word(result + 4, b);
+            store_word(result + 8, c);
+            store_word(result + 12, d);
+            result += 16;
+        }
+        src += 1;
+    }
+}
+
 void common_hal_bitops_bit_transpose(uint8_t *result, const uint8_t *src, size_t inlen, size_t num_strands) {
-    if (num_strands == 8) {
+    if (num_strands == 32) {
+        bit_transpose_32(result, src, inlen / 32, inlen / 32);
+    } else if (num_strands == 16) {
+        bit_transpose_16(result, src, inlen / 16, inlen / 16);
+    } else if (num_strands == 8) {
         bit_transpose_8((uint32_t *)(void *)result, src, inlen / 8, inlen / 8);
     } else {
         bit_transpose_var((uint32_t *)(void *)result, src, inlen / num_strands, inlen / num_strands, num_strands);
@@ -29,6 +29,7 @@
 #include "shared-module/board/__init__.h"
 #include "supervisor/shared/translate/translate.h"
 #include "mpconfigboard.h"
+#include "py/gc.h"
 #include "py/runtime.h"
 
 #if CIRCUITPY_BUSIO
@@ -138,6 +139,15 @@ mp_obj_t common_hal_board_create_spi(const mp_int_t instance) {
 }
 #endif
 
+void board_gc_collect(void) {
+    #if CIRCUITPY_BOARD_SPI && CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+    // The static SPI objects aren't on the heap so keep the buffers of their background writes.
+    for (uint8_t instance = 0; instance < CIRCUITPY_BOARD_SPI; instance++) {
+        gc_collect_ptr(spi_obj[instance].background_write_buffer);
+    }
+    #endif
+}
+
 #if CIRCUITPY_BOARD_UART
 
 typedef struct {
@@ -225,6 +235,10 @@ void reset_board_buses(void) {
         }
         #endif
         if (spi_obj_created[instance]) {
+            #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+            // The buffer of an SPI.write_async() is on the heap that is about to go away.
+            busio_spi_finish_background_write(&spi_obj[instance]);
+            #endif
             // make sure SPI lock is not held over a soft reset
             common_hal_busio_spi_unlock(&spi_obj[instance]);
             if (!display_using_spi) {
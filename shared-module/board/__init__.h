@@ -28,5 +28,6 @@
 #define MICROPY_INCLUDED_SHARED_MODULE_BOARD__INIT__H
 
 void reset_board_buses(void);
+void board_gc_collect(void);
 
 #endif  // MICROPY_INCLUDED_SHARED_MODULE_BOARD__INIT__H
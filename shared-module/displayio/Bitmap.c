@@ -174,6 +174,92 @@ void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y
     }
 }
 
+// Copies the bits of one row between the same pixel offsets within a word, for values
+// smaller than a byte. Edge words are read before the middle moves so that overlapping rows
+// of the same bitmap come out right.
+static void copy_packed_row(displayio_bitmap_t *self, uint32_t *dest_row, int16_t x,
+    const uint32_t *source_row, int16_t x1, int16_t width) {
+    uint32_t first = x >> self->x_shift;
+    uint32_t last = (x + width - 1) >> self->x_shift;
+    uint32_t source_first = x1 >> self->x_shift;
+    uint32_t head_bits = (x & self->x_mask) * self->bits_per_value;
+    uint32_t tail_bits = (((x + width - 1) & self->x_mask) + 1) * self->bits_per_value;
+    uint32_t head_mask = 0xffffffff >> head_bits;
+    uint32_t tail_mask = tail_bits == 32 ? 0xffffffff : ~(0xffffffff >> tail_bits);
+
+    if (first == last) {
+        uint32_t mask = head_mask & tail_mask;
+        dest_row[first] = (dest_row[first] & ~mask) | (source_row[source_first] & mask);
+        return;
+    }
+    uint32_t head = (dest_row[first] & ~head_mask) | (source_row[source_first] & head_mask);
+    uint32_t tail = (dest_row[last] & ~tail_mask) | (source_row[source_first + last - first] & tail_mask);
+    memmove(dest_row + first + 1, source_row + source_first + 1, (last - first - 1) * sizeof(uint32_t));
+    dest_row[first] = head;
+    dest_row[last] = tail;
+}
+
+void displayio_bitmap_blit_rows(displayio_bitmap_t *self, int16_t x, int16_t y, displayio_bitmap_t *source,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, const uint32_t *skip_source,
+    uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index, bool skip_dest_index_none) {
+    // Clip the copy to the destination.
+    if (x < 0) {
+        x1 -= x;
+        x = 0;
+    }
+    if (y < 0) {
+        y1 -= y;
+        y = 0;
+    }
+    int16_t width = MIN(x2 - x1, self->width - x);
+    int16_t height = MIN(y2 - y1, self->height - y);
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    // Walk backwards when moving a region of a bitmap forwards within itself.
+    bool y_reverse = y > y1;
+    bool x_reverse = x > x1;
+
+    bool copy_all = skip_source == NULL && skip_source_index_none && skip_dest_index_none;
+    bool whole_bytes = self->bits_per_value >= 8;
+    bool same_depth = self->bits_per_value == source->bits_per_value;
+    bool same_offset = whole_bytes || ((x & self->x_mask) == (x1 & self->x_mask));
+
+    for (int16_t j = 0; j < height; j++) {
+        int16_t row = y_reverse ? height - j - 1 : j;
+        uint32_t *dest_row = displayio_bitmap_get_row(self, y + row);
+        const uint32_t *source_row = displayio_bitmap_get_row(source, y1 + row);
+
+        if (copy_all && same_depth && same_offset) {
+            if (whole_bytes) {
+                uint32_t bytes_per_value = self->bits_per_value / 8;
+                memmove((uint8_t *)dest_row + x * bytes_per_value, (const uint8_t *)source_row + x1 * bytes_per_value,
+                    width * bytes_per_value);
+            } else {
+                copy_packed_row(self, dest_row, x, source_row, x1, width);
+            }
+            continue;
+        }
+
+        for (int16_t i = 0; i < width; i++) {
+            int16_t column = x_reverse ? width - i - 1 : i;
+            uint32_t value = displayio_bitmap_row_get_value(source, source_row, x1 + column);
+            if (skip_source != NULL && value < 256 && (skip_source[value / 32] & (1u << (value % 32)))) {
+                continue;
+            }
+            if (!skip_source_index_none && value == skip_source_index) {
+                continue;
+            }
+            if (!skip_dest_index_none &&
+                displayio_bitmap_row_get_value(self, dest_row, x + column) == skip_dest_index) {
+                continue;
+            }
+            displayio_bitmap_row_set_value(self, dest_row, x + column, value);
+        }
+    }
+}
+
 void common_hal_displayio_bitmap_blit(displayio_bitmap_t *self, int16_t x, int16_t y, displayio_bitmap_t *source,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_index, bool skip_index_none) {
     if (self->read_only) {
@@ -197,38 +283,7 @@ void common_hal_displayio_bitmap_blit(displayio_bitmap_t *self, int16_t x, int16
     displayio_area_t a = { x, y, dirty_x_max, dirty_y_max, NULL};
     displayio_bitmap_set_dirty_area(self, &a);
 
-    bool x_reverse = false;
-    bool y_reverse = false;
-
-    // Add reverse direction option to protect blitting of self bitmap back into self bitmap
-    if (x > x1) {
-        x_reverse = true;
-    }
-    if (y > y1) {
-        y_reverse = true;
-    }
-
-    // simplest version - use internal functions for get/set pixels
-    for (int16_t i = 0; i < (x2 - x1); i++) {
-
-        const int xs_index = x_reverse ? ((x2) - i - 1) : x1 + i; // x-index into the source bitmap
-        const int xd_index = x_reverse ? ((x + (x2 - x1)) - i - 1) : x + i; // x-index into the destination bitmap
-
-        if ((xd_index >= 0) && (xd_index < self->width)) {
-            for (int16_t j = 0; j < (y2 - y1); j++) {
-
-                const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
-                const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
-
-                if ((yd_index >= 0) && (yd_index < self->height)) {
-                    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
-                    if ((skip_index_none) || (value != skip_index)) {   // write if skip_value_none is True
-                        displayio_bitmap_write_pixel(self, xd_index, yd_index, value);
-                    }
-                }
-            }
-        }
-    }
+    displayio_bitmap_blit_rows(self, x, y, source, x1, y1, x2, y2, NULL, skip_index, skip_index_none, 0, true);
 }
 
 void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
@@ -53,4 +53,48 @@ displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, d
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *area);
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value);
 
+// Copies source values to self without checks or dirty marking. skip_source has a bit set for
+// each source value below 256 to leave out, or is NULL to copy them all.
+void displayio_bitmap_blit_rows(displayio_bitmap_t *self, int16_t x, int16_t y, displayio_bitmap_t *source,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, const uint32_t *skip_source,
+    uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index, bool skip_dest_index_none);
+
+// Row access for loops that have already checked their coordinates.
+static inline uint32_t *displayio_bitmap_get_row(const displayio_bitmap_t *self, int16_t y) {
+    return self->data + y * self->stride;
+}
+
+static inline uint32_t displayio_bitmap_row_get_value(const displayio_bitmap_t *self, const uint32_t *row, int16_t x) {
+    switch (self->bits_per_value) {
+        case 8:
+            return ((const uint8_t *)row)[x];
+        case 16:
+            return ((const uint16_t *)row)[x];
+        case 32:
+            return row[x];
+        default:
+            return (row[x >> self->x_shift] >> (32 - ((x & self->x_mask) + 1) * self->bits_per_value)) & self->bitmask;
+    }
+}
+
+static inline void displayio_bitmap_row_set_value(displayio_bitmap_t *self, uint32_t *row, int16_t x, uint32_t value) {
+    switch (self->bits_per_value) {
+        case 8:
+            ((uint8_t *)row)[x] = value;
+            break;
+        case 16:
+            ((uint16_t *)row)[x] = value;
+            break;
+        case 32:
+            row[x] = value;
+            break;
+        default: {
+            uint32_t bit_position = 32 - ((x & self->x_mask) + 1) * self->bits_per_value;
+            uint32_t *word = &row[x >> self->x_shift];
+            *word = (*word & ~(self->bitmask << bit_position)) | ((value & self->bitmask) << bit_position);
+            break;
+        }
+    }
+}
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_BITMAP_H
@@ -31,6 +31,14 @@
 
 #define NO_TRANSPARENT_COLOR (0x1000000)
 
+enum {
+    LUT_NONE,
+    // Table entries are ORed together into the output color.
+    LUT_PACKED,
+    // Table entries are weighted channels that sum to 255 times the luma.
+    LUT_LUMA,
+};
+
 uint32_t displayio_colorconverter_dither_noise_1(uint32_t n) {
     n = (n >> 13) ^ n;
     int nn = (n * (n * n * 60493 + 19990303) + 1376312589) & 0x7fffffff;
@@ -46,6 +54,8 @@ void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *s
     self->transparent_color = NO_TRANSPARENT_COLOR;
     self->input_colorspace = input_colorspace;
     self->output_colorspace.depth = 16;
+    self->lut_colorspace = NULL;
+    self->lut_mode = LUT_NONE;
 }
 
 uint16_t displayio_colorconverter_compute_rgb565(uint32_t color_rgb888) {
@@ -335,6 +345,117 @@ void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dit
     output_color->opaque = false;
 }
 
+// Fills one channel's table with that channel's share of the output color. Only packed outputs
+// whose channels land on separate bits and luma, a weighted sum, can be split up this way.
+STATIC void _fill_lut(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace,
+    displayio_colorspace_t input_colorspace, uint16_t *lut, uint8_t length, uint8_t shift) {
+    for (uint32_t i = 0; i < length; i++) {
+        uint32_t rgb888 = displayio_colorconverter_convert_pixel(input_colorspace, i << shift);
+        if (self->lut_mode == LUT_LUMA) {
+            lut[i] = (rgb888 >> 16) * 19 + ((rgb888 >> 8) & 0xff) * 182 + (rgb888 & 0xff) * 54;
+        } else if (colorspace->depth == 16) {
+            lut[i] = displayio_colorconverter_compute_rgb565(rgb888);
+        } else {
+            lut[i] = displayio_colorconverter_compute_rgb332(rgb888);
+        }
+    }
+}
+
+// Returns true when 16 bit input colors can be converted to colorspace with the lookup tables,
+// building them if needed. They are never used while dithering.
+STATIC bool _prepare_lut(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->lut_colorspace == colorspace) {
+        return self->lut_mode != LUT_NONE;
+    }
+    self->lut_colorspace = colorspace;
+    self->lut_mode = LUT_NONE;
+
+    // Swapped colorspaces have the same channels once their bytes are swapped.
+    displayio_colorspace_t input_colorspace;
+    switch (self->input_colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565:
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+            input_colorspace = DISPLAYIO_COLORSPACE_RGB565;
+            break;
+        case DISPLAYIO_COLORSPACE_RGB555:
+        case DISPLAYIO_COLORSPACE_RGB555_SWAPPED:
+            input_colorspace = DISPLAYIO_COLORSPACE_RGB555;
+            break;
+        case DISPLAYIO_COLORSPACE_BGR565:
+        case DISPLAYIO_COLORSPACE_BGR565_SWAPPED:
+            input_colorspace = DISPLAYIO_COLORSPACE_BGR565;
+            break;
+        case DISPLAYIO_COLORSPACE_BGR555:
+        case DISPLAYIO_COLORSPACE_BGR555_SWAPPED:
+            input_colorspace = DISPLAYIO_COLORSPACE_BGR555;
+            break;
+        default:
+            return false;
+    }
+    self->lut_swapped = input_colorspace != self->input_colorspace;
+    self->lut_five_bit_middle = input_colorspace == DISPLAYIO_COLORSPACE_RGB555 ||
+        input_colorspace == DISPLAYIO_COLORSPACE_BGR555;
+
+    // Mirrors the output checks in displayio_convert_color.
+    if (colorspace->depth == 16) {
+        self->lut_mode = LUT_PACKED;
+    } else if (colorspace->tricolor) {
+        return false;
+    } else if (colorspace->grayscale && colorspace->depth <= 8) {
+        self->lut_mode = LUT_LUMA;
+    } else if (colorspace->depth == 8) {
+        self->lut_mode = LUT_PACKED;
+    } else {
+        return false;
+    }
+
+    if (self->lut_five_bit_middle) {
+        _fill_lut(self, colorspace, input_colorspace, self->lut_high, 32, 10);
+        _fill_lut(self, colorspace, input_colorspace, self->lut_middle, 32, 5);
+    } else {
+        _fill_lut(self, colorspace, input_colorspace, self->lut_high, 32, 11);
+        _fill_lut(self, colorspace, input_colorspace, self->lut_middle, 64, 5);
+    }
+    _fill_lut(self, colorspace, input_colorspace, self->lut_low, 32, 0);
+    return true;
+}
+
+static inline uint32_t _lut_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, uint32_t pixel) {
+    if (self->lut_swapped) {
+        pixel = __builtin_bswap16(pixel);
+    }
+    uint32_t color;
+    if (self->lut_five_bit_middle) {
+        color = self->lut_high[(pixel >> 10) & 0x1f] + self->lut_middle[(pixel >> 5) & 0x1f];
+    } else {
+        color = self->lut_high[(pixel >> 11) & 0x1f] + self->lut_middle[(pixel >> 5) & 0x3f];
+    }
+    color += self->lut_low[pixel & 0x1f];
+
+    if (self->lut_mode == LUT_LUMA) {
+        uint8_t luma = color / 255;
+        return (luma >> colorspace->grayscale_bit) & ((1 << colorspace->depth) - 1);
+    }
+    if (colorspace->depth == 16 && colorspace->reverse_bytes_in_word) {
+        return __builtin_bswap16(color);
+    }
+    return color;
+}
+
+// Whether a whole row of 16 bit input pixels can be converted at once. Transparency and
+// dithering both need each pixel to be looked at on its own.
+bool displayio_colorconverter_can_convert_rows(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    return !self->dither && self->transparent_color == NO_TRANSPARENT_COLOR &&
+           colorspace->depth == 16 && _prepare_lut(self, colorspace);
+}
+
+// Only call this after displayio_colorconverter_can_convert_rows returns true.
+void displayio_colorconverter_convert_row_16(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const uint16_t *input, uint16_t *output, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        output[i] = _lut_convert(self, colorspace, input[i]);
+    }
+}
+
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t pixel = input_pixel->pixel;
 
@@ -348,6 +469,12 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
         return;
     }
 
+    if (!self->dither && _prepare_lut(self, colorspace)) {
+        output_color->pixel = _lut_convert(self, colorspace, pixel);
+        output_color->opaque = true;
+        return;
+    }
+
     displayio_input_pixel_t rgb888_pixel = *input_pixel;
     rgb888_pixel.pixel = displayio_colorconverter_convert_pixel(self->input_colorspace, input_pixel->pixel);
     displayio_convert_color(colorspace, self->dither, &rgb888_pixel, output_color);
@@ -362,6 +489,12 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
 
 
 // Currently no refresh logic is needed for a ColorConverter.
+// Opaque here means no input color is transparent. Output colorspaces that can't be converted
+// still report transparent pixels so callers must check each output pixel.
+bool displayio_colorconverter_is_opaque(displayio_colorconverter_t *self) {
+    return self->transparent_color == NO_TRANSPARENT_COLOR;
+}
+
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
     return false;
 }
@@ -44,11 +44,24 @@ typedef struct displayio_colorconverter {
     const _displayio_colorspace_t *cached_colorspace;
     uint32_t cached_input_pixel;
     uint32_t cached_output_color;
+
+    // Per channel lookup tables for 16 bit input colorspaces. They are built for lut_colorspace
+    // the first time it is converted to without dithering.
+    const _displayio_colorspace_t *lut_colorspace;
+    uint8_t lut_mode;
+    bool lut_swapped;
+    bool lut_five_bit_middle;
+    uint16_t lut_high[32];
+    uint16_t lut_middle[64];
+    uint16_t lut_low[32];
 } displayio_colorconverter_t;
 
+bool displayio_colorconverter_is_opaque(displayio_colorconverter_t *self);
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
+bool displayio_colorconverter_can_convert_rows(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace);
+void displayio_colorconverter_convert_row_16(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const uint16_t *input, uint16_t *output, uint32_t count);
 
 uint32_t displayio_colorconverter_dither_noise_1(uint32_t n);
 uint32_t displayio_colorconverter_dither_noise_2(uint32_t x, uint32_t y);
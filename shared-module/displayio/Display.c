@@ -38,13 +38,15 @@
 #include "shared-module/displayio/display_core.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
-#include "supervisor/usb.h"
 
 #include <stdint.h>
 #include <string.h>
 
 #define DELAY 0x80
 
+// Longest a refresh draws before letting other background tasks run.
+#define REFRESH_STEP_MS (4)
+
 void common_hal_displayio_display_construct(displayio_display_obj_t *self,
     mp_obj_t bus, uint16_t width, uint16_t height, int16_t colstart, int16_t rowstart,
     uint16_t rotation, uint16_t color_depth, bool grayscale, bool pixels_in_byte_share_row,
@@ -72,6 +74,8 @@ void common_hal_displayio_display_construct(displayio_display_obj_t *self,
     self->brightness_command = brightness_command;
     self->first_manual_refresh = !auto_refresh;
     self->backlight_on_high = backlight_on_high;
+    self->refresh_area = NULL;
+    self->refresh_stepping = false;
 
     self->native_frames_per_second = native_frames_per_second;
     self->native_ms_per_frame = 1000 / native_frames_per_second;
@@ -225,24 +229,92 @@ STATIC const displayio_area_t *_get_refresh_areas(displayio_display_obj_t *self)
     return NULL;
 }
 
-STATIC void _send_pixels(displayio_display_obj_t *self, uint8_t *pixels, uint32_t length) {
+// Returns true when the pixels are still being sent in the background. In that case the bus's
+// finish_send must be called before pixels is reused or the transaction is ended.
+STATIC bool _send_pixels(displayio_display_obj_t *self, uint8_t *pixels, uint32_t length) {
     if (!self->core.data_as_commands) {
         self->core.send(self->core.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &self->write_ram_command, 1);
     }
+    if (self->core.start_send != NULL &&
+        self->core.start_send(self->core.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length)) {
+        return true;
+    }
     self->core.send(self->core.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
+    return false;
+}
+
+STATIC void _finish_send_pixels(displayio_display_obj_t *self) {
+    self->core.finish_send(self->core.bus);
+    displayio_display_core_end_transaction(&self->core);
+}
+
+STATIC void _get_subrectangle(const displayio_area_t *clipped, uint16_t rows_per_buffer, uint16_t j, displayio_area_t *subrectangle) {
+    subrectangle->x1 = clipped->x1;
+    subrectangle->y1 = clipped->y1 + rows_per_buffer * j;
+    subrectangle->x2 = clipped->x2;
+    subrectangle->y2 = clipped->y1 + rows_per_buffer * (j + 1);
+    if (subrectangle->y2 > clipped->y2) {
+        subrectangle->y2 = clipped->y2;
+    }
+}
+
+// Sends clipped as a single repeated color when nothing but one solid color covers it. Sets
+// *done and returns true when the area was handled here. Returns false if the bus is busy.
+STATIC bool _refresh_solid_area(displayio_display_obj_t *self, displayio_area_t *clipped, bool *done) {
+    *done = false;
+    if (self->core.SH1107_addressing || self->core.colorspace.depth < 8) {
+        return true;
+    }
+    uint32_t color = 0;
+    if (displayio_display_core_get_area_fill(&self->core, clipped, &color) == DISPLAYIO_AREA_FILL_MIXED) {
+        return true;
+    }
+    if (!displayio_display_core_bus_free(&self->core)) {
+        return false;
+    }
+    displayio_display_core_set_region_to_update(&self->core, clipped);
+
+    displayio_display_core_begin_transaction(&self->core);
+    if (!self->core.data_as_commands) {
+        self->core.send(self->core.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &self->write_ram_command, 1);
+    }
+    // Pixels are stored little end first in the fill buffer so the pattern is too.
+    uint8_t pattern[sizeof(uint32_t)];
+    memcpy(pattern, &color, sizeof(pattern));
+    displayio_display_core_send_fill(&self->core, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED,
+        pattern, self->core.colorspace.depth / 8, displayio_area_size(clipped));
+    displayio_display_core_end_transaction(&self->core);
+
+    self->refreshed_pixels += displayio_area_size(clipped);
+    *done = true;
+    return true;
 }
 
-STATIC bool _refresh_area(displayio_display_obj_t *self, const displayio_area_t *area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+// Draws the subrectangles of area starting at self->refresh_subrectangle until the area is done
+// or the deadline passes. refresh_subrectangle is left at the next one to draw, or zero once the
+// whole area is drawn. Returns false when the bus is busy.
+STATIC bool _refresh_area(displayio_display_obj_t *self, const displayio_area_t *area, uint64_t deadline) {
+    // In uint32_ts
+    uint32_t buffer_size = self->core.refresh_buffer != NULL ? self->core.refresh_buffer_size : 128;
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
     if (!displayio_display_core_clip_area(&self->core, area, &clipped)) {
+        self->refresh_subrectangle = 0;
         return true;
     }
+    if (self->refresh_subrectangle == 0) {
+        bool done;
+        if (!_refresh_solid_area(self, &clipped, &done)) {
+            return false;
+        }
+        if (done) {
+            return true;
+        }
+    }
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
-    uint16_t pixels_per_buffer = displayio_area_size(&clipped);
+    uint32_t pixels_per_buffer = displayio_area_size(&clipped);
 
     uint16_t subrectangles = 1;
     // for SH1107 and other boundary constrained controllers
@@ -274,67 +346,179 @@ STATIC bool _refresh_area(displayio_display_obj_t *self, const displayio_area_t
     }
 
     // Allocated and shared as a uint32_t array so the compiler knows the
-    // alignment everywhere.
-    uint32_t buffer[buffer_size];
+    // alignment everywhere. When the display's refresh buffer holds two
+    // subrectangles we alternate between them so that the next subrectangle is
+    // composited while the previous one is sent in the background or the
+    // second core composites. Otherwise a single buffer is used from the stack.
+    uint8_t buffer_count = 1;
+    if (self->core.refresh_buffer != NULL && buffer_size <= self->core.refresh_buffer_size &&
+        self->core.refresh_buffer_count >= 2) {
+        buffer_count = 2;
+    }
+    bool use_stack = self->core.refresh_buffer == NULL || buffer_size > self->core.refresh_buffer_size;
+    bool offload = CIRCUITPY_DISPLAYIO_CORE1 && subrectangles > 1 && buffer_count == 2;
+    // Layers that read the filesystem may need the bus (an SD card sharing it) so
+    // the previous send must finish before they are composited.
+    bool overlap_send = buffer_count == 2 && self->core.start_send != NULL &&
+        (self->core.current_group == NULL || !displayio_group_reads_files(self->core.current_group));
     uint32_t mask_length = (pixels_per_buffer / 32) + 1;
-    uint32_t mask[mask_length];
-    uint16_t remaining_rows = displayio_area_height(&clipped);
-
-    for (uint16_t j = 0; j < subrectangles; j++) {
-        displayio_area_t subrectangle = {
-            .x1 = clipped.x1,
-            .y1 = clipped.y1 + rows_per_buffer * j,
-            .x2 = clipped.x2,
-            .y2 = clipped.y1 + rows_per_buffer * (j + 1)
-        };
-        if (remaining_rows < rows_per_buffer) {
-            subrectangle.y2 = subrectangle.y1 + remaining_rows;
-        }
-        remaining_rows -= rows_per_buffer;
-
-        displayio_display_core_set_region_to_update(&self->core, &subrectangle);
-
-        uint16_t subrectangle_size_bytes;
+    uint32_t stack_buffer[use_stack ? buffer_size : 1];
+    uint32_t stack_mask[use_stack ? mask_length : 1];
+    uint32_t *buffers = use_stack ? stack_buffer : self->core.refresh_buffer;
+    uint32_t *mask = use_stack ? stack_mask : self->core.refresh_mask;
+    bool sending = false;
+    // True when the second core is compositing the current subrectangle.
+    bool offloaded = false;
+
+    uint16_t j = self->refresh_subrectangle;
+    for (; j < subrectangles; j++) {
+        uint32_t *buffer = buffers + (j % buffer_count) * buffer_size;
+        displayio_area_t subrectangle;
+        _get_subrectangle(&clipped, rows_per_buffer, j, &subrectangle);
+
+        uint32_t subrectangle_size_bytes;
         if (self->core.colorspace.depth >= 8) {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) * (self->core.colorspace.depth / 8);
         } else {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
         }
 
-        memset(mask, 0, mask_length * sizeof(mask[0]));
-        memset(buffer, 0, buffer_size * sizeof(buffer[0]));
+        if (offloaded) {
+            displayio_display_core_finish_fill_area(&self->core);
+            offloaded = false;
+        } else {
+            if (sending && !overlap_send) {
+                // Ends the transaction so compositing can use the bus.
+                _finish_send_pixels(self);
+                sending = false;
+            }
+            memset(mask, 0, mask_length * sizeof(mask[0]));
+            memset(buffer, 0, buffer_size * sizeof(buffer[0]));
 
-        displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+            displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+        }
+
+        // The previous subrectangle must be fully sent before we change the region.
+        if (sending) {
+            _finish_send_pixels(self);
+            sending = false;
+        }
 
-        // Can't acquire display bus; skip the rest of the data.
+        // Can't acquire display bus; try this subrectangle again later.
         if (!displayio_display_core_bus_free(&self->core)) {
+            self->refresh_subrectangle = j;
             return false;
         }
 
+        displayio_display_core_set_region_to_update(&self->core, &subrectangle);
+
+        // Yield to other background tasks once our time is up.
+        bool more = j + 1 < subrectangles && supervisor_ticks_ms64() < deadline;
+
+        // Composite the next subrectangle on the other core while this one is sent. Its buffer
+        // was sent before the previous subrectangle so it is free.
+        if (offload && more) {
+            uint32_t *next_buffer = buffers + ((j + 1) % buffer_count) * buffer_size;
+            displayio_area_t next;
+            _get_subrectangle(&clipped, rows_per_buffer, j + 1, &next);
+            memset(mask, 0, mask_length * sizeof(mask[0]));
+            memset(next_buffer, 0, buffer_size * sizeof(next_buffer[0]));
+            offloaded = displayio_display_core_start_fill_area(&self->core, &next, mask, next_buffer);
+        }
+
         displayio_display_core_begin_transaction(&self->core);
-        _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
-        displayio_display_core_end_transaction(&self->core);
+        sending = _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
+        if (!sending) {
+            displayio_display_core_end_transaction(&self->core);
+        }
+        self->refreshed_pixels += displayio_area_size(&subrectangle);
 
-        // TODO(tannewt): Make refresh displays faster so we don't starve other
-        // background tasks.
-        #if CIRCUITPY_USB
-        usb_background();
-        #endif
+        if (!more) {
+            j++;
+            break;
+        }
     }
+    if (sending) {
+        _finish_send_pixels(self);
+    }
+    self->refresh_subrectangle = j < subrectangles ? j : 0;
     return true;
 }
 
-STATIC void _refresh_display(displayio_display_obj_t *self) {
-    if (!displayio_display_core_start_refresh(&self->core)) {
-        // A refresh on this bus is already in progress.  Try next display.
-        return;
+STATIC void _finish_refresh(displayio_display_obj_t *self) {
+    self->refresh_area = NULL;
+    displayio_display_core_end_refresh(&self->core);
+    supervisor_disable_tick();
+}
+
+// Starts a refresh if one isn't in progress and then draws until it is done or budget_ms has
+// passed. The tick stays enabled while a refresh is in progress so that the rest is drawn by
+// displayio_display_background(). Returns true when no refresh remains in progress.
+STATIC bool _refresh_display_step(displayio_display_obj_t *self, uint32_t budget_ms) {
+    if (self->refresh_stepping) {
+        // A background task ran while the bus was finishing a send.
+        return false;
     }
-    const displayio_area_t *current_area = _get_refresh_areas(self);
-    while (current_area != NULL) {
-        _refresh_area(self, current_area);
-        current_area = current_area->next;
+    if (self->refresh_area == NULL) {
+        if (!displayio_display_core_start_refresh(&self->core)) {
+            // A refresh on this bus is already in progress.  Try next display.
+            return true;
+        }
+        // Setting the region costs about as much as sending this many pixels.
+        self->refresh_area = displayio_area_coalesce(_get_refresh_areas(self),
+            self->refresh_areas, DISPLAYIO_MAX_REFRESH_AREAS, 32);
+        // The areas are copied so changes made while we draw will be picked up by the next refresh.
+        displayio_display_core_finish_group_refresh(&self->core);
+        if (self->refresh_area == NULL) {
+            displayio_display_core_end_refresh(&self->core);
+            return true;
+        }
+        self->refresh_pixels = 0;
+        self->refreshed_pixels = 0;
+        self->refresh_subrectangle = 0;
+        for (const displayio_area_t *area = self->refresh_area; area != NULL; area = area->next) {
+            displayio_area_t clipped;
+            if (displayio_display_core_clip_area(&self->core, area, &clipped)) {
+                self->refresh_pixels += displayio_area_size(&clipped);
+            }
+        }
+        supervisor_enable_tick();
+    }
+
+    self->refresh_stepping = true;
+    uint64_t deadline = supervisor_ticks_ms64() + budget_ms;
+    while (self->refresh_area != NULL &&
+           _refresh_area(self, self->refresh_area, deadline) &&
+           self->refresh_subrectangle == 0) {
+        self->refresh_area = self->refresh_area->next;
+        if (supervisor_ticks_ms64() >= deadline) {
+            break;
+        }
+    }
+    self->refresh_stepping = false;
+
+    if (self->refresh_area == NULL) {
+        _finish_refresh(self);
+        return true;
+    }
+    return false;
+}
+
+// Refreshes the whole display and runs other background tasks between steps.
+STATIC void _refresh_display(displayio_display_obj_t *self) {
+    while (true) {
+        const displayio_area_t *area = self->refresh_area;
+        uint32_t refreshed_pixels = self->refreshed_pixels;
+        if (_refresh_display_step(self, REFRESH_STEP_MS)) {
+            return;
+        }
+        if (area != NULL && area == self->refresh_area && refreshed_pixels == self->refreshed_pixels) {
+            // Nothing was drawn so the bus is busy. Skip the rest of the data.
+            _finish_refresh(self);
+            return;
+        }
+        RUN_BACKGROUND_TASKS;
     }
-    displayio_display_core_finish_refresh(&self->core);
 }
 
 void common_hal_displayio_display_set_rotation(displayio_display_obj_t *self, int rotation) {
@@ -359,8 +543,16 @@ uint16_t common_hal_displayio_display_get_rotation(displayio_display_obj_t *self
     return self->core.rotation;
 }
 
+uint32_t common_hal_displayio_display_get_last_refresh_duration(displayio_display_obj_t *self) {
+    return self->core.last_refresh_duration;
+}
+
 
-bool common_hal_displayio_display_refresh(displayio_display_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame) {
+bool common_hal_displayio_display_refresh(displayio_display_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame, bool blocking) {
+    if (!blocking && self->refresh_area != NULL) {
+        // The refresh that's already in progress will finish in the background.
+        return true;
+    }
     if (!self->auto_refresh && !self->first_manual_refresh && (target_ms_per_frame != 0xffffffff)) {
         uint64_t current_time = supervisor_ticks_ms64();
         uint32_t current_ms_since_real_refresh = current_time - self->core.last_refresh;
@@ -381,10 +573,21 @@ bool common_hal_displayio_display_refresh(displayio_display_obj_t *self, uint32_
         }
     }
     self->first_manual_refresh = false;
-    _refresh_display(self);
+    if (blocking) {
+        _refresh_display(self);
+    } else {
+        _refresh_display_step(self, REFRESH_STEP_MS);
+    }
     return true;
 }
 
+mp_float_t common_hal_displayio_display_get_refresh_progress(displayio_display_obj_t *self) {
+    if (self->refresh_area == NULL || self->refresh_pixels == 0) {
+        return (mp_float_t)1.0;
+    }
+    return (mp_float_t)self->refreshed_pixels / self->refresh_pixels;
+}
+
 bool common_hal_displayio_display_get_auto_refresh(displayio_display_obj_t *self) {
     return self->auto_refresh;
 }
@@ -411,12 +614,16 @@ mp_obj_t common_hal_displayio_display_set_root_group(displayio_display_obj_t *se
 }
 
 void displayio_display_background(displayio_display_obj_t *self) {
-    if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
-        _refresh_display(self);
+    if (self->refresh_area != NULL ||
+        (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame)) {
+        _refresh_display_step(self, REFRESH_STEP_MS);
     }
 }
 
 void release_display(displayio_display_obj_t *self) {
+    if (self->refresh_area != NULL) {
+        _finish_refresh(self);
+    }
     common_hal_displayio_display_set_auto_refresh(self, false);
     release_display_core(&self->core);
     #if (CIRCUITPY_PWMIO)
@@ -431,6 +638,9 @@ void release_display(displayio_display_obj_t *self) {
 }
 
 void reset_display(displayio_display_obj_t *self) {
+    if (self->refresh_area != NULL) {
+        _finish_refresh(self);
+    }
     common_hal_displayio_display_set_auto_refresh(self, true);
     circuitpython_splash.x = 0; // reset position in case someone moved it.
     circuitpython_splash.y = 0;
@@ -45,15 +45,21 @@ typedef struct {
         pwmio_pwmout_obj_t backlight_pwm;
         #endif
     };
+    displayio_area_t refresh_areas[DISPLAYIO_MAX_REFRESH_AREAS];
+    const displayio_area_t *refresh_area; // Next area to draw. NULL when no refresh is in progress.
+    uint32_t refresh_pixels; // Pixels in the refresh in progress.
+    uint32_t refreshed_pixels; // Pixels drawn so far.
     uint64_t last_refresh_call;
     mp_float_t current_brightness;
     uint16_t brightness_command;
     uint16_t native_frames_per_second;
     uint16_t native_ms_per_frame;
+    uint16_t refresh_subrectangle; // Next subrectangle of refresh_area to draw.
     uint8_t write_ram_command;
     bool auto_refresh;
     bool first_manual_refresh;
     bool backlight_on_high;
+    bool refresh_stepping; // Guards against background tasks reentering a refresh step.
 } displayio_display_obj_t;
 
 void displayio_display_background(displayio_display_obj_t *self);
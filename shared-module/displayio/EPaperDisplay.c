@@ -101,6 +101,11 @@ void common_hal_displayio_epaperdisplay_construct(displayio_epaperdisplay_obj_t
     self->refresh_sequence = refresh_sequence;
     self->refresh_sequence_len = refresh_sequence_len;
 
+    self->partial_refresh_sequence = NULL;
+    self->partial_refresh_sequence_len = 0;
+    self->partial_refresh_count = 0;
+    self->partial_refreshing = false;
+
     self->busy.base.type = &mp_type_NoneType;
     self->two_byte_sequence_length = two_byte_sequence_length;
     if (busy_pin != NULL) {
@@ -119,6 +124,17 @@ void common_hal_displayio_epaperdisplay_construct(displayio_epaperdisplay_obj_t
     common_hal_displayio_epaperdisplay_show(self, &circuitpython_splash);
 }
 
+void common_hal_displayio_epaperdisplay_set_partial_refresh(displayio_epaperdisplay_obj_t *self,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len,
+    mp_float_t partial_refresh_time, mp_float_t partial_seconds_per_frame, uint16_t max_partial_refreshes) {
+    self->partial_refresh_sequence = partial_refresh_sequence;
+    self->partial_refresh_sequence_len = partial_refresh_sequence_len;
+    self->partial_refresh_time = partial_refresh_time * 1000;
+    self->partial_milliseconds_per_frame = partial_seconds_per_frame * 1000;
+    self->max_partial_refreshes = max_partial_refreshes;
+    self->partial_refresh_count = 0;
+}
+
 bool common_hal_displayio_epaperdisplay_show(displayio_epaperdisplay_obj_t *self, displayio_group_t *root_group) {
     if (root_group == NULL) {
         root_group = &circuitpython_splash;
@@ -130,6 +146,17 @@ bool common_hal_displayio_epaperdisplay_set_root_group(displayio_epaperdisplay_o
     return displayio_display_core_set_root_group(&self->core, root_group);
 }
 
+// Whether the next refresh only updates the changed areas with the partial refresh sequence.
+// The first refresh of a group and every max_partial_refreshes + 1th refresh are full ones
+// to clear the ghosting that partial updates leave behind.
+STATIC bool displayio_epaperdisplay_next_refresh_is_partial(displayio_epaperdisplay_obj_t *self) {
+    return self->partial_refresh_sequence != NULL &&
+           !self->acep &&
+           !self->core.full_refresh &&
+           self->core.row_command != NO_COMMAND &&
+           self->partial_refresh_count < self->max_partial_refreshes;
+}
+
 STATIC const displayio_area_t *displayio_epaperdisplay_get_refresh_areas(displayio_epaperdisplay_obj_t *self) {
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
@@ -222,19 +249,30 @@ uint32_t common_hal_displayio_epaperdisplay_get_time_to_refresh(displayio_epaper
         return 0;
     }
     // Refresh at seconds per frame rate.
+    uint32_t milliseconds_per_frame = self->milliseconds_per_frame;
+    if (displayio_epaperdisplay_next_refresh_is_partial(self)) {
+        milliseconds_per_frame = self->partial_milliseconds_per_frame;
+    }
     uint32_t elapsed_time = supervisor_ticks_ms64() - self->core.last_refresh;
-    if (elapsed_time > self->milliseconds_per_frame) {
+    if (elapsed_time > milliseconds_per_frame) {
         return 0;
     }
-    return self->milliseconds_per_frame - elapsed_time;
+    return milliseconds_per_frame - elapsed_time;
 }
 
-STATIC void displayio_epaperdisplay_finish_refresh(displayio_epaperdisplay_obj_t *self) {
+STATIC void displayio_epaperdisplay_finish_refresh(displayio_epaperdisplay_obj_t *self, bool partial) {
     // Actually refresh the display now that all pixel RAM has been updated.
-    send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+    if (partial) {
+        send_command_sequence(self, false, self->partial_refresh_sequence, self->partial_refresh_sequence_len);
+        self->partial_refresh_count++;
+    } else {
+        send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+        self->partial_refresh_count = 0;
+    }
 
     supervisor_enable_tick();
     self->refreshing = true;
+    self->partial_refreshing = partial;
 
     displayio_display_core_finish_refresh(&self->core);
 }
@@ -273,7 +311,8 @@ mp_obj_t common_hal_displayio_epaperdisplay_get_root_group(displayio_epaperdispl
 }
 
 STATIC bool displayio_epaperdisplay_refresh_area(displayio_epaperdisplay_obj_t *self, const displayio_area_t *area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+    // In uint32_ts
+    uint32_t buffer_size = self->core.refresh_buffer != NULL ? self->core.refresh_buffer_size : 128;
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
@@ -283,7 +322,7 @@ STATIC bool displayio_epaperdisplay_refresh_area(displayio_epaperdisplay_obj_t *
     uint16_t subrectangles = 1;
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
-    uint16_t pixels_per_buffer = displayio_area_size(&clipped);
+    uint32_t pixels_per_buffer = displayio_area_size(&clipped);
     if (displayio_area_size(&clipped) > buffer_size * pixels_per_word) {
         rows_per_buffer = buffer_size * pixels_per_word / displayio_area_width(&clipped);
         if (rows_per_buffer == 0) {
@@ -301,10 +340,14 @@ STATIC bool displayio_epaperdisplay_refresh_area(displayio_epaperdisplay_obj_t *
     }
 
     // Allocated and shared as a uint32_t array so the compiler knows the
-    // alignment everywhere.
-    uint32_t buffer[buffer_size];
+    // alignment everywhere. The display's refresh buffer is used instead of
+    // the stack when the subrectangles fit in it.
     volatile uint32_t mask_length = (pixels_per_buffer / 32) + 1;
-    uint32_t mask[mask_length];
+    bool use_stack = self->core.refresh_buffer == NULL || buffer_size > self->core.refresh_buffer_size;
+    uint32_t stack_buffer[use_stack ? buffer_size : 1];
+    uint32_t stack_mask[use_stack ? mask_length : 1];
+    uint32_t *buffer = use_stack ? stack_buffer : self->core.refresh_buffer;
+    uint32_t *mask = use_stack ? stack_mask : self->core.refresh_mask;
 
     uint8_t passes = 1;
     if (self->write_color_ram_command != NO_COMMAND) {
@@ -338,7 +381,7 @@ STATIC bool displayio_epaperdisplay_refresh_area(displayio_epaperdisplay_obj_t *
             remaining_rows -= rows_per_buffer;
 
 
-            uint16_t subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
+            uint32_t subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
 
             memset(mask, 0, mask_length * sizeof(mask[0]));
             memset(buffer, 0, buffer_size * sizeof(buffer[0]));
@@ -364,7 +407,7 @@ STATIC bool displayio_epaperdisplay_refresh_area(displayio_epaperdisplay_obj_t *
             // Invert it all.
             if ((pass == 1 && self->color_bits_inverted) ||
                 (pass == 0 && self->black_bits_inverted)) {
-                for (uint16_t k = 0; k < buffer_size; k++) {
+                for (uint32_t k = 0; k < buffer_size; k++) {
                     buffer[k] = ~buffer[k];
                 }
             }
@@ -440,14 +483,22 @@ bool common_hal_displayio_epaperdisplay_refresh(displayio_epaperdisplay_obj_t *s
         // Can't acquire display bus; skip updating this display. Try next display.
         return false;
     }
-    const displayio_area_t *current_area = displayio_epaperdisplay_get_refresh_areas(self);
+    bool partial = displayio_epaperdisplay_next_refresh_is_partial(self);
+    if (!partial && self->partial_refresh_sequence != NULL) {
+        // A full refresh after partial ones redraws everything so the whole panel is cleaned.
+        self->core.full_refresh = true;
+    }
+    // Every area sets the RAM window before sending its pixels.
+    displayio_area_t merged[DISPLAYIO_MAX_REFRESH_AREAS];
+    const displayio_area_t *current_area = displayio_area_coalesce(displayio_epaperdisplay_get_refresh_areas(self),
+        merged, DISPLAYIO_MAX_REFRESH_AREAS, 32);
     if (current_area == NULL) {
         return true;
     }
     if (self->acep) {
         displayio_epaperdisplay_start_refresh(self);
         _clean_area(self);
-        displayio_epaperdisplay_finish_refresh(self);
+        displayio_epaperdisplay_finish_refresh(self, false);
         while (self->refreshing && !mp_hal_is_interrupted()) {
             RUN_BACKGROUND_TASKS;
         }
@@ -461,7 +512,7 @@ bool common_hal_displayio_epaperdisplay_refresh(displayio_epaperdisplay_obj_t *s
         displayio_epaperdisplay_refresh_area(self, current_area);
         current_area = current_area->next;
     }
-    displayio_epaperdisplay_finish_refresh(self);
+    displayio_epaperdisplay_finish_refresh(self, partial);
     return true;
 }
 
@@ -472,7 +523,8 @@ void displayio_epaperdisplay_background(displayio_epaperdisplay_obj_t *self) {
             bool busy = common_hal_digitalio_digitalinout_get_value(&self->busy);
             refresh_done = busy != self->busy_state;
         } else {
-            refresh_done = supervisor_ticks_ms64() - self->core.last_refresh > self->refresh_time;
+            uint16_t refresh_time = self->partial_refreshing ? self->partial_refresh_time : self->refresh_time;
+            refresh_done = supervisor_ticks_ms64() - self->core.last_refresh > refresh_time;
         }
         if (refresh_done) {
             supervisor_disable_tick();
@@ -507,6 +559,7 @@ void displayio_epaperdisplay_collect_ptrs(displayio_epaperdisplay_obj_t *self) {
     displayio_display_core_collect_ptrs(&self->core);
     gc_collect_ptr((void *)self->start_sequence);
     gc_collect_ptr((void *)self->stop_sequence);
+    gc_collect_ptr((void *)self->partial_refresh_sequence);
 }
 
 size_t maybe_refresh_epaperdisplay(void) {
@@ -38,14 +38,20 @@ typedef struct {
     displayio_display_core_t core;
     digitalio_digitalinout_obj_t busy;
     uint32_t milliseconds_per_frame;
+    uint32_t partial_milliseconds_per_frame;
     const uint8_t *start_sequence;
     const uint8_t *stop_sequence;
     const uint8_t *refresh_sequence;
+    const uint8_t *partial_refresh_sequence;
     uint16_t start_sequence_len;
     uint16_t stop_sequence_len;
     uint16_t refresh_sequence_len;
+    uint16_t partial_refresh_sequence_len;
     uint16_t start_up_time_ms;
     uint16_t refresh_time;
+    uint16_t partial_refresh_time;
+    uint16_t max_partial_refreshes;
+    uint16_t partial_refresh_count;
     uint16_t write_black_ram_command;
     uint16_t write_color_ram_command;
     uint8_t hue;
@@ -53,6 +59,7 @@ typedef struct {
     bool black_bits_inverted;
     bool color_bits_inverted;
     bool refreshing;
+    bool partial_refreshing;
     bool grayscale;
     bool acep;
     bool two_byte_sequence_length;
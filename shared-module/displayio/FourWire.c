@@ -172,6 +172,24 @@ void common_hal_displayio_fourwire_send(mp_obj_t obj, display_byte_type_t data_t
     }
 }
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+bool common_hal_displayio_fourwire_start_send(mp_obj_t obj, display_byte_type_t data_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length) {
+    displayio_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    // 9-bit mode and per-byte chip select toggling have to be done byte by byte.
+    if (self->command.base.type == &mp_type_NoneType || chip_select == CHIP_SELECT_TOGGLE_EVERY_BYTE) {
+        return false;
+    }
+    common_hal_digitalio_digitalinout_set_value(&self->command, data_type == DISPLAY_DATA);
+    return common_hal_busio_spi_start_write(self->bus, data, data_length);
+}
+
+void common_hal_displayio_fourwire_finish_send(mp_obj_t obj) {
+    displayio_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    common_hal_busio_spi_finish_write(self->bus);
+}
+#endif
+
 void common_hal_displayio_fourwire_end_transaction(mp_obj_t obj) {
     displayio_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
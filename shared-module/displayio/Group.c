@@ -28,6 +28,7 @@
 
 #include "py/runtime.h"
 #include "py/objlist.h"
+#include "shared-bindings/displayio/OnDiskBitmap.h"
 #include "shared-bindings/displayio/TileGrid.h"
 
 #if CIRCUITPY_VECTORIO
@@ -410,6 +411,70 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
     return false;
 }
 
+// Finds what the topmost layer drawing into area draws there. This lets a display send a solid
+// color without compositing it first.
+displayio_area_fill_t displayio_group_get_area_fill(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *color) {
+    if (self->hidden) {
+        return DISPLAYIO_AREA_FILL_EMPTY;
+    }
+    for (int32_t i = self->members->len - 1; i >= 0; i--) {
+        mp_obj_t layer;
+        displayio_area_fill_t fill;
+        #if CIRCUITPY_VECTORIO
+        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
+        if (draw_protocol != NULL) {
+            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
+            fill = draw_protocol->draw_protocol_impl->draw_get_area_fill(layer, colorspace, area, color);
+            if (fill != DISPLAYIO_AREA_FILL_EMPTY) {
+                return fill;
+            }
+            continue;
+        }
+        #endif
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            fill = displayio_tilegrid_get_area_fill(layer, colorspace, area, color);
+            if (fill != DISPLAYIO_AREA_FILL_EMPTY) {
+                return fill;
+            }
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL) {
+            fill = displayio_group_get_area_fill(layer, colorspace, area, color);
+            if (fill != DISPLAYIO_AREA_FILL_EMPTY) {
+                return fill;
+            }
+            continue;
+        }
+    }
+    return DISPLAYIO_AREA_FILL_EMPTY;
+}
+
+// OnDiskBitmaps read the filesystem while they are drawn so they must be drawn on the core that
+// owns it.
+bool displayio_group_reads_files(displayio_group_t *self) {
+    for (size_t i = 0; i < self->members->len; i++) {
+        mp_obj_t layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_tilegrid_t *tilegrid = layer;
+            if (mp_obj_is_type(tilegrid->bitmap, &displayio_ondiskbitmap_type)) {
+                return true;
+            }
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL && displayio_group_reads_files(layer)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void displayio_group_finish_refresh(displayio_group_t *self) {
     self->item_removed = false;
     for (int32_t i = self->members->len - 1; i >= 0; i--) {
@@ -39,7 +39,7 @@ static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
 
-void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file) {
+void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file, uint16_t cache_rows) {
     // Load the wave
     self->file = file;
     uint16_t bmp_header[69];
@@ -111,7 +111,7 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
             for (uint16_t i = 0; i < number_of_colors; i++) {
                 common_hal_displayio_palette_set_color(palette, i, palette_data[i]);
             }
-            m_free(palette_data);
+            m_del(uint32_t, palette_data, number_of_colors);
         } else {
             common_hal_displayio_palette_set_color(palette, 0, 0x0);
             common_hal_displayio_palette_set_color(palette, 1, 0xffffff);
@@ -142,28 +142,72 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    // Pixels are fetched by seeking during refresh, which may run in the
+    // background where allocating isn't allowed, so map the file now.
+    fat_file_build_linkmap(self->file);
+
+    self->row_cache = NULL;
+    self->cache_rows = MIN(cache_rows, self->height);
+    self->cache_first_row = 0;
+    self->cache_valid_rows = 0;
+    if (self->cache_rows > 0) {
+        self->row_cache = m_malloc(self->cache_rows * self->stride, false);
+    }
 }
 
 
+// Loads the stripe of rows ending at file_row into the row cache. Rows are stored bottom up in the
+// file so a stripe ending at file_row covers the rows that follow it on the display.
+STATIC bool _load_row_cache(displayio_ondiskbitmap_t *self, int32_t file_row) {
+    int32_t first_row = file_row - (self->cache_rows - 1);
+    if (first_row < 0) {
+        first_row = 0;
+    }
+    self->cache_valid_rows = 0;
+    f_lseek(&self->file->fp, self->data_offset + first_row * self->stride);
+    UINT bytes_read;
+    if (f_read(&self->file->fp, self->row_cache, (file_row - first_row + 1) * self->stride, &bytes_read) != FR_OK) {
+        return false;
+    }
+    self->cache_first_row = first_row;
+    self->cache_valid_rows = bytes_read / self->stride;
+    return file_row < first_row + self->cache_valid_rows;
+}
+
 uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self,
     int16_t x, int16_t y) {
     if (x < 0 || x >= self->width || y < 0 || y >= self->height) {
         return 0;
     }
 
-    uint32_t location;
+    uint32_t offset_in_row;
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
     if (pixels_per_byte == 0) {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x * bytes_per_pixel;
+        offset_in_row = x * bytes_per_pixel;
     } else {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
+        offset_in_row = x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
+    int32_t file_row = self->height - y - 1;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    uint32_t result;
+    if (self->row_cache != NULL) {
+        if (file_row < self->cache_first_row ||
+            file_row >= self->cache_first_row + self->cache_valid_rows) {
+            if (!_load_row_cache(self, file_row)) {
+                return 0;
+            }
+        }
+        memcpy(&pixel_data,
+            self->row_cache + (file_row - self->cache_first_row) * self->stride + offset_in_row,
+            bytes_per_pixel);
+        result = FR_OK;
+    } else {
+        // Without a row cache we rely on the underlying FS caching sectors.
+        f_lseek(&self->file->fp, self->data_offset + file_row * self->stride + offset_in_row);
+        UINT bytes_read;
+        result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    }
     if (result == FR_OK) {
         uint32_t tmp = 0;
         uint8_t red;
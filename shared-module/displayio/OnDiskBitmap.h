@@ -44,6 +44,11 @@ typedef struct {
     uint32_t g_bitmask;
     uint32_t b_bitmask;
     pyb_file_obj_t *file;
+    // Whole rows, in file order, read at once so that fill_area doesn't seek for every pixel.
+    uint8_t *row_cache;
+    uint16_t cache_rows;
+    uint16_t cache_first_row;
+    uint16_t cache_valid_rows;
     union {
         mp_obj_base_t *pixel_shader_base;
         struct displayio_palette *palette;
@@ -74,6 +74,7 @@ typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
     uint32_t color_count;
+    uint32_t transparent_count; // Number of transparent colors. Zero means the palette is opaque.
     bool needs_refresh;
     bool dither;
 } displayio_palette_t;
@@ -81,6 +82,7 @@ typedef struct displayio_palette {
 
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
 ;
+bool displayio_palette_is_opaque(displayio_palette_t *self);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
 
@@ -26,6 +26,8 @@
 
 #include "shared-bindings/displayio/TileGrid.h"
 
+#include <string.h>
+
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
@@ -257,18 +259,9 @@ uint8_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint1
     return tiles[y * self->width_in_tiles + x];
 }
 
-void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
-    if (tile_index >= self->tiles_in_bitmap) {
-        mp_raise_ValueError(translate("Tile index out of bounds"));
-    }
-    uint8_t *tiles = self->tiles;
-    if (self->inline_tiles) {
-        tiles = (uint8_t *)&self->tiles;
-    }
-    if (tiles == NULL) {
-        return;
-    }
-    tiles[y * self->width_in_tiles + x] = tile_index;
+// Marks tiles [x, x + count) of row y as changed with a single area. Runs that
+// wrap around the scroll offset mark the whole row.
+STATIC void _mark_tile_run_dirty(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t count) {
     displayio_area_t temp_area;
     displayio_area_t *tile_area;
     if (!self->partial_change) {
@@ -280,8 +273,12 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     if (tx < 0) {
         tx += self->width_in_tiles;
     }
+    if (tx + count > self->width_in_tiles) {
+        tx = 0;
+        count = self->width_in_tiles;
+    }
     tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
+    tile_area->x2 = tile_area->x1 + count * self->tile_width;
     int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
     if (ty < 0) {
         ty += self->height_in_tiles;
@@ -296,6 +293,55 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     self->partial_change = true;
 }
 
+void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
+    if (tile_index >= self->tiles_in_bitmap) {
+        mp_raise_ValueError(translate("Tile index out of bounds"));
+    }
+    uint8_t *tiles = self->tiles;
+    if (self->inline_tiles) {
+        tiles = (uint8_t *)&self->tiles;
+    }
+    if (tiles == NULL) {
+        return;
+    }
+    tiles[y * self->width_in_tiles + x] = tile_index;
+    _mark_tile_run_dirty(self, x, y, 1);
+}
+
+void common_hal_displayio_tilegrid_set_tile_run(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint8_t *tile_indices, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) {
+        if (tile_indices[i] >= self->tiles_in_bitmap) {
+            mp_raise_ValueError(translate("Tile index out of bounds"));
+        }
+    }
+    uint8_t *tiles = self->tiles;
+    if (self->inline_tiles) {
+        tiles = (uint8_t *)&self->tiles;
+    }
+    if (tiles == NULL || count == 0) {
+        return;
+    }
+    count = MIN(count, self->width_in_tiles - x);
+    memcpy(tiles + y * self->width_in_tiles + x, tile_indices, count);
+    _mark_tile_run_dirty(self, x, y, count);
+}
+
+void common_hal_displayio_tilegrid_fill_tile_run(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index, uint16_t count) {
+    if (tile_index >= self->tiles_in_bitmap) {
+        mp_raise_ValueError(translate("Tile index out of bounds"));
+    }
+    uint8_t *tiles = self->tiles;
+    if (self->inline_tiles) {
+        tiles = (uint8_t *)&self->tiles;
+    }
+    if (tiles == NULL || count == 0) {
+        return;
+    }
+    count = MIN(count, self->width_in_tiles - x);
+    memset(tiles + y * self->width_in_tiles + x, tile_index, count);
+    _mark_tile_run_dirty(self, x, y, count);
+}
+
 void common_hal_displayio_tilegrid_set_all_tiles(displayio_tilegrid_t *self, uint8_t tile_index) {
     if (tile_index >= self->tiles_in_bitmap) {
         mp_raise_ValueError(translate("Tile index out of bounds"));
@@ -376,6 +422,124 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Returns true when no mask bits in [first, end) are set.
+STATIC bool _mask_range_clear(const uint32_t *mask, uint32_t first, uint32_t end) {
+    while (first < end && first % 32 != 0) {
+        if ((mask[first / 32] & (1 << (first % 32))) != 0) {
+            return false;
+        }
+        first++;
+    }
+    while (first + 32 <= end) {
+        if (mask[first / 32] != 0) {
+            return false;
+        }
+        first += 32;
+    }
+    while (first < end) {
+        if ((mask[first / 32] & (1 << (first % 32))) != 0) {
+            return false;
+        }
+        first++;
+    }
+    return true;
+}
+
+STATIC void _mask_set_range(uint32_t *mask, uint32_t first, uint32_t end) {
+    while (first < end && first % 32 != 0) {
+        mask[first / 32] |= 1 << (first % 32);
+        first++;
+    }
+    while (first + 32 <= end) {
+        mask[first / 32] = 0xffffffff;
+        first += 32;
+    }
+    while (first < end) {
+        mask[first / 32] |= 1 << (first % 32);
+        first++;
+    }
+}
+
+// Shades one unscaled row of an 8 or 16 bit Bitmap through a Palette into a 16 bit buffer,
+// walking each tile's pixels contiguously. The destination of pixel x is offset + x - start_x.
+// Returns false if any of the pixels were transparent.
+STATIC bool _blit_palette_row_16(displayio_tilegrid_t *self, const uint8_t *tiles,
+    const _displayio_colorspace_t *colorspace, int16_t y, int16_t start_x, int16_t end_x,
+    uint32_t *mask, bool check_mask, uint16_t *buffer, uint32_t offset) {
+    displayio_bitmap_t *bitmap = self->bitmap;
+    displayio_palette_t *palette = self->pixel_shader;
+    bool sixteen_bit = bitmap->bits_per_value == 16;
+    bool opaque = true;
+
+    displayio_input_pixel_t input_pixel;
+    displayio_output_pixel_t output_pixel;
+    input_pixel.y = y;
+
+    uint16_t tile_row = ((y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+    uint16_t y_in_tile = y % self->tile_height;
+    input_pixel.x = start_x;
+    while (input_pixel.x < end_x) {
+        uint16_t x_in_tile = input_pixel.x % self->tile_width;
+        uint16_t run = MIN(self->tile_width - x_in_tile, end_x - input_pixel.x);
+        input_pixel.tile = tiles[tile_row + (input_pixel.x / self->tile_width + self->top_left_x) % self->width_in_tiles];
+        input_pixel.tile_x = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width + x_in_tile;
+        input_pixel.tile_y = (input_pixel.tile / self->bitmap_width_in_tiles) * self->tile_height + y_in_tile;
+        const uint32_t *row = bitmap->data + input_pixel.tile_y * bitmap->stride;
+        const uint8_t *row8 = ((const uint8_t *)row) + input_pixel.tile_x;
+        const uint16_t *row16 = ((const uint16_t *)row) + input_pixel.tile_x;
+
+        for (uint16_t i = 0; i < run; i++) {
+            if (check_mask && (mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                input_pixel.x++;
+                input_pixel.tile_x++;
+                offset++;
+                continue;
+            }
+            input_pixel.pixel = sixteen_bit ? row16[i] : row8[i];
+            output_pixel.opaque = true;
+            displayio_palette_get_color(palette, colorspace, &input_pixel, &output_pixel);
+            if (!output_pixel.opaque) {
+                opaque = false;
+                if (!check_mask) {
+                    mask[offset / 32] &= ~(1 << (offset % 32));
+                }
+            } else {
+                if (check_mask) {
+                    mask[offset / 32] |= 1 << (offset % 32);
+                }
+                buffer[offset] = output_pixel.pixel;
+            }
+            input_pixel.x++;
+            input_pixel.tile_x++;
+            offset++;
+        }
+    }
+    return opaque;
+}
+
+// Converts one unscaled row of a 16 bit Bitmap through a ColorConverter into a 16 bit buffer a
+// tile's run of pixels at a time. Only for rows whose mask was filled beforehand because every
+// pixel is written.
+STATIC void _blit_colorconverter_row_16(displayio_tilegrid_t *self, const uint8_t *tiles,
+    const _displayio_colorspace_t *colorspace, int16_t y, int16_t start_x, int16_t end_x,
+    uint16_t *buffer, uint32_t offset) {
+    displayio_bitmap_t *bitmap = self->bitmap;
+    uint16_t tile_row = ((y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+    uint16_t y_in_tile = y % self->tile_height;
+    int16_t x = start_x;
+    while (x < end_x) {
+        uint16_t x_in_tile = x % self->tile_width;
+        uint16_t run = MIN(self->tile_width - x_in_tile, end_x - x);
+        uint16_t tile = tiles[tile_row + (x / self->tile_width + self->top_left_x) % self->width_in_tiles];
+        uint16_t tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + x_in_tile;
+        uint16_t tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + y_in_tile;
+        const uint16_t *row16 = ((const uint16_t *)(bitmap->data + tile_y * bitmap->stride)) + tile_x;
+        displayio_colorconverter_convert_row_16(self->pixel_shader, colorspace, row16, buffer + offset, run);
+        x += run;
+        offset += run;
+    }
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -410,7 +574,7 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     }
 
     // How many pixels are outside of our area between us and the start of the row.
-    uint16_t start = 0;
+    int32_t start = 0;
     if ((self->absolute_transform->dx < 0) != flip_x) {
         start += (area->x2 - area->x1 - 1) * x_stride;
         x_stride *= -1;
@@ -424,11 +588,14 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
-    // set and our palette is all opaque.
+    // A shader without transparent colors covers every pixel it draws. Rows of such a layer that
+    // don't overlap anything drawn already can set their mask bits in bulk.
+    bool opaque = self->pixel_shader == mp_const_none ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+            displayio_palette_is_opaque(self->pixel_shader)) ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+            displayio_colorconverter_is_opaque(self->pixel_shader));
 
-    // TODO(tannewt): Check to see if the pixel_shader has any transparency. If it doesn't then we
-    // can either return full coverage or bulk update the mask.
     displayio_area_t transformed;
     displayio_area_transform_within(flip_x != (self->absolute_transform->dx < 0), flip_y != (self->absolute_transform->dy < 0), self->transpose_xy != self->absolute_transform->transpose_xy,
         &overlap,
@@ -465,15 +632,56 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
 
     uint8_t pixels_per_byte = 8 / colorspace->depth;
 
+    // Bitmap rows are only contiguous in the mask when they aren't transposed.
+    bool bulk_mask = opaque && (x_stride == 1 || x_stride == -1);
+
+    // Unscaled and unmirrored 8 or 16 bit bitmaps shaded by a Palette into 16 bit pixels are the
+    // most common case so they get their own row blitter.
+    bool row_blit = x_stride == 1 && self->absolute_transform->scale == 1 && colorspace->depth == 16 &&
+        mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+        mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+        (((displayio_bitmap_t *)self->bitmap)->bits_per_value == 8 ||
+            ((displayio_bitmap_t *)self->bitmap)->bits_per_value == 16);
+    // 16 bit Bitmaps shaded by a ColorConverter, such as loaded images, convert whole rows
+    // through its lookup tables.
+    bool converter_row_blit = bulk_mask && x_stride == 1 && self->absolute_transform->scale == 1 &&
+        mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+        mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+        ((displayio_bitmap_t *)self->bitmap)->bits_per_value == 16 &&
+        displayio_colorconverter_can_convert_rows(self->pixel_shader, colorspace);
+
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
     for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
-        int16_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
+        int32_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
         int16_t local_y = input_pixel.y / self->absolute_transform->scale;
+        bool check_mask = true;
+        if (bulk_mask) {
+            int32_t first = row_start + x_shift * x_stride;
+            int32_t last = row_start + (end_x - start_x - 1 + x_shift) * x_stride;
+            uint32_t row_first = MIN(first, last);
+            uint32_t row_end = MAX(first, last) + 1;
+            if (_mask_range_clear(mask, row_first, row_end)) {
+                _mask_set_range(mask, row_first, row_end);
+                check_mask = false;
+            }
+        }
+        if (row_blit) {
+            if (!_blit_palette_row_16(self, tiles, colorspace, local_y, start_x, end_x,
+                mask, check_mask, (uint16_t *)buffer, row_start + x_shift)) {
+                full_coverage = false;
+            }
+            continue;
+        }
+        if (converter_row_blit && !check_mask) {
+            _blit_colorconverter_row_16(self, tiles, colorspace, local_y, start_x, end_x,
+                (uint16_t *)buffer, row_start + x_shift);
+            continue;
+        }
         for (input_pixel.x = start_x; input_pixel.x < end_x; ++input_pixel.x) {
             // Compute the destination pixel in the buffer and mask based on the transformations.
-            int16_t offset = row_start + (input_pixel.x - start_x + x_shift) * x_stride; // in pixels
+            int32_t offset = row_start + (input_pixel.x - start_x + x_shift) * x_stride; // in pixels
 
             // This is super useful for debugging out of range accesses. Uncomment to use.
             // if (offset < 0 || offset >= (int32_t) displayio_area_size(area)) {
@@ -481,7 +689,7 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
             // }
 
             // Check the mask first to see if the pixel has already been set.
-            if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+            if (check_mask && (mask[offset / 32] & (1 << (offset % 32))) != 0) {
                 continue;
             }
             int16_t local_x = input_pixel.x / self->absolute_transform->scale;
@@ -514,8 +722,14 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
             if (!output_pixel.opaque) {
                 // A pixel is transparent so we haven't fully covered the area ourselves.
                 full_coverage = false;
+                if (!check_mask) {
+                    // Out of range indices and unsupported colorspaces are still transparent.
+                    mask[offset / 32] &= ~(1 << (offset % 32));
+                }
             } else {
-                mask[offset / 32] |= 1 << (offset % 32);
+                if (check_mask) {
+                    mask[offset / 32] |= 1 << (offset % 32);
+                }
                 if (colorspace->depth == 16) {
                     *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
                 } else if (colorspace->depth == 32) {
@@ -526,7 +740,7 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
                     // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
                     if (!colorspace->pixels_in_byte_share_row) {
                         uint16_t width = displayio_area_width(area);
-                        uint16_t row = offset / width;
+                        uint32_t row = offset / width;
                         uint16_t col = offset % width;
                         // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
                         offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
@@ -548,6 +762,16 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     return full_coverage;
 }
 
+// Bitmaps can hold any mix of values so we only know when the TileGrid stays out of the area.
+displayio_area_fill_t displayio_tilegrid_get_area_fill(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *color) {
+    displayio_area_t overlap;
+    if (self->hidden || self->hidden_by_parent ||
+        !displayio_area_compute_overlap(area, &self->current_area, &overlap)) {
+        return DISPLAYIO_AREA_FILL_EMPTY;
+    }
+    return DISPLAYIO_AREA_FILL_MIXED;
+}
+
 void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
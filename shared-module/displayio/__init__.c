@@ -36,6 +36,7 @@
 #include "shared-bindings/displayio/Group.h"
 #include "shared-bindings/displayio/Palette.h"
 #include "shared-module/displayio/area.h"
+#include "supervisor/shared/cpu.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/reload.h"
 #include "supervisor/memory.h"
@@ -88,6 +89,9 @@ void displayio_background(void) {
         return;
     }
 
+    #if CIRCUITPY_CPU_GOVERNOR
+    cpu_governor_busy(CPU_BUSY_DISPLAY, true);
+    #endif
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
         mp_const_obj_t display_type = displays[i].display.base.type;
         if (display_type == NULL || display_type == &mp_type_NoneType) {
@@ -104,7 +108,9 @@ void displayio_background(void) {
             displayio_epaperdisplay_background(&displays[i].epaper_display);
         }
     }
-
+    #if CIRCUITPY_CPU_GOVERNOR
+    cpu_governor_busy(CPU_BUSY_DISPLAY, false);
+    #endif
 }
 
 void common_hal_displayio_release_displays(void) {
@@ -159,3 +159,74 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
         transformed->x1 = whole->x1 + (y1 - whole->y1);
     }
 }
+
+// Merges stored areas whose union costs no more to refresh than both separately and returns the
+// new count.
+STATIC size_t _coalesce_stored(displayio_area_t *merged, size_t count, uint32_t overhead_pixels) {
+    displayio_area_t u;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < count; i++) {
+            for (size_t j = i + 1; j < count; j++) {
+                displayio_area_union(&merged[i], &merged[j], &u);
+                if (displayio_area_size(&u) > displayio_area_size(&merged[i]) + displayio_area_size(&merged[j]) + overhead_pixels) {
+                    continue;
+                }
+                displayio_area_copy(&u, &merged[i]);
+                count--;
+                displayio_area_copy(&merged[count], &merged[j]);
+                // Recheck everything against the larger area.
+                j = i;
+                changed = true;
+            }
+        }
+    }
+    return count;
+}
+
+// Merges the linked list of areas starting at first into at most max_count areas stored in merged
+// and returns the head of the new list. Each refreshed area costs its pixels plus overhead_pixels
+// for the commands that start it, so two areas are merged whenever refreshing their union costs no
+// more than refreshing both. When there are still too many areas, extra ones are merged into
+// whichever stored area grows the least.
+const displayio_area_t *displayio_area_coalesce(const displayio_area_t *first,
+    displayio_area_t *merged, size_t max_count, uint32_t overhead_pixels) {
+    size_t count = 0;
+    displayio_area_t u;
+    for (const displayio_area_t *area = first; area != NULL; area = area->next) {
+        if (displayio_area_empty(area)) {
+            continue;
+        }
+        if (count == max_count) {
+            count = _coalesce_stored(merged, count, overhead_pixels);
+        }
+        if (count < max_count) {
+            displayio_area_copy(area, &merged[count]);
+            count++;
+            continue;
+        }
+        size_t best = 0;
+        uint32_t best_growth = UINT32_MAX;
+        for (size_t i = 0; i < count; i++) {
+            displayio_area_union(&merged[i], area, &u);
+            uint32_t growth = displayio_area_size(&u) - displayio_area_size(&merged[i]);
+            if (growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        displayio_area_union(&merged[best], area, &u);
+        displayio_area_copy(&u, &merged[best]);
+    }
+    count = _coalesce_stored(merged, count, overhead_pixels);
+
+    if (count == 0) {
+        return NULL;
+    }
+    for (size_t i = 0; i < count - 1; i++) {
+        merged[i].next = &merged[i + 1];
+    }
+    merged[count - 1].next = NULL;
+    return merged;
+}
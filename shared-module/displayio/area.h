@@ -27,6 +27,7 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
 #define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -56,6 +57,13 @@ typedef struct {
 
 extern displayio_buffer_transform_t null_transform;
 
+// What a layer draws within an area.
+typedef enum {
+    DISPLAYIO_AREA_FILL_EMPTY, // Nothing is drawn so lower layers show through.
+    DISPLAYIO_AREA_FILL_SOLID, // One opaque color covers the whole area.
+    DISPLAYIO_AREA_FILL_MIXED, // Anything else. The area must be composited.
+} displayio_area_fill_t;
+
 bool displayio_area_empty(const displayio_area_t *a);
 void displayio_area_copy_coords(const displayio_area_t *src, displayio_area_t *dest);
 void displayio_area_canon(displayio_area_t *a);
@@ -76,5 +84,7 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
     const displayio_area_t *original,
     const displayio_area_t *whole,
     displayio_area_t *transformed);
+const displayio_area_t *displayio_area_coalesce(const displayio_area_t *first,
+    displayio_area_t *merged, size_t max_count, uint32_t overhead_pixels);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
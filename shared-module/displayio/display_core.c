@@ -36,8 +36,12 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "supervisor/memory.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
+#if CIRCUITPY_VECTORIO
+#include "shared-module/vectorio/__init__.h"
+#endif
 
 #include <stdint.h>
 #include <string.h>
@@ -62,6 +66,7 @@ void displayio_display_core_construct(displayio_display_core_t *self,
     self->colstart = colstart;
     self->rowstart = rowstart;
     self->last_refresh = 0;
+    self->last_refresh_duration = 0;
 
     self->column_command = column_command;
     self->row_command = row_command;
@@ -72,6 +77,14 @@ void displayio_display_core_construct(displayio_display_core_t *self,
     self->SH1107_addressing = SH1107_addressing;
     self->address_little_endian = address_little_endian;
 
+    self->start_send = NULL;
+    self->finish_send = NULL;
+    self->send_fill = NULL;
+    self->refresh_buffer = NULL;
+    self->refresh_mask = NULL;
+    self->refresh_buffer_size = 0;
+    self->refresh_buffer_count = 0;
+
     // (framebufferdisplay already validated its 'bus' is a buffer-protocol object)
     if (bus) {
         #if CIRCUITPY_PARALLELDISPLAY
@@ -81,6 +94,7 @@ void displayio_display_core_construct(displayio_display_core_t *self,
             self->begin_transaction = common_hal_paralleldisplay_parallelbus_begin_transaction;
             self->send = common_hal_paralleldisplay_parallelbus_send;
             self->end_transaction = common_hal_paralleldisplay_parallelbus_end_transaction;
+            self->send_fill = common_hal_paralleldisplay_parallelbus_send_fill;
         } else
         #endif
         if (mp_obj_is_type(bus, &displayio_fourwire_type)) {
@@ -89,6 +103,10 @@ void displayio_display_core_construct(displayio_display_core_t *self,
             self->begin_transaction = common_hal_displayio_fourwire_begin_transaction;
             self->send = common_hal_displayio_fourwire_send;
             self->end_transaction = common_hal_displayio_fourwire_end_transaction;
+            #if CIRCUITPY_BUSIO_SPI_BACKGROUND_WRITE
+            self->start_send = common_hal_displayio_fourwire_start_send;
+            self->finish_send = common_hal_displayio_fourwire_finish_send;
+            #endif
         } else if (mp_obj_is_type(bus, &displayio_i2cdisplay_type)) {
             self->bus_reset = common_hal_displayio_i2cdisplay_reset;
             self->bus_free = common_hal_displayio_i2cdisplay_bus_free;
@@ -357,19 +375,74 @@ bool displayio_display_core_start_refresh(displayio_display_core_t *self) {
 }
 
 void displayio_display_core_finish_refresh(displayio_display_core_t *self) {
+    displayio_display_core_finish_group_refresh(self);
+    displayio_display_core_end_refresh(self);
+}
+
+// Marks the group's changes as drawn. Changes made after this are drawn by the next refresh.
+void displayio_display_core_finish_group_refresh(displayio_display_core_t *self) {
     if (self->current_group != NULL) {
         DISPLAYIO_CORE_DEBUG("displayiocore group_finish_refresh\n");
         displayio_group_finish_refresh(self->current_group);
     }
     self->full_refresh = false;
+}
+
+void displayio_display_core_end_refresh(displayio_display_core_t *self) {
     self->refresh_in_progress = false;
-    self->last_refresh = supervisor_ticks_ms64();
+    uint64_t now = supervisor_ticks_ms64();
+    // last_refresh was set when this refresh started.
+    self->last_refresh_duration = now - self->last_refresh;
+    self->last_refresh = now;
 }
 
 void release_display_core(displayio_display_core_t *self) {
     if (self->current_group != NULL) {
         self->current_group->in_group = false;
     }
+    displayio_display_core_set_refresh_buffer_size(self, 0, 0);
+}
+
+void displayio_display_core_set_refresh_buffer_size(displayio_display_core_t *self, uint32_t size_in_bytes, uint8_t buffer_count) {
+    free_memory(allocation_from_ptr(self->refresh_buffer));
+    self->refresh_buffer = NULL;
+    self->refresh_mask = NULL;
+    self->refresh_buffer_size = 0;
+    self->refresh_buffer_count = 0;
+    if (size_in_bytes == 0) {
+        return;
+    }
+    uint32_t buffer_size = align32_size(size_in_bytes) / sizeof(uint32_t);
+    uint32_t pixels_per_buffer = buffer_size * ((sizeof(uint32_t) * 8) / self->colorspace.depth);
+    uint32_t mask_length = (pixels_per_buffer / 32) + 1;
+    uint32_t length = (buffer_count * buffer_size + mask_length) * sizeof(uint32_t);
+    supervisor_allocation *allocation = allocate_memory(length, false, true);
+    if (allocation == NULL) {
+        m_malloc_fail(length);
+    }
+    self->refresh_buffer = allocation->ptr;
+    self->refresh_buffer_size = buffer_size;
+    self->refresh_buffer_count = buffer_count;
+    self->refresh_mask = self->refresh_buffer + buffer_count * buffer_size;
+}
+
+uint32_t displayio_display_core_get_refresh_buffer_size(displayio_display_core_t *self) {
+    return self->refresh_buffer_size * sizeof(uint32_t);
+}
+
+void displayio_display_core_move_refresh_buffer(displayio_display_core_t *self) {
+    if (self->refresh_buffer == NULL) {
+        return;
+    }
+    // Look up the allocation by the old pointer and get the new pointer from it.
+    supervisor_allocation *allocation = allocation_from_ptr(self->refresh_buffer);
+    self->refresh_buffer = allocation ? allocation->ptr : NULL;
+    if (self->refresh_buffer == NULL) {
+        self->refresh_mask = NULL;
+        self->refresh_buffer_size = 0;
+        return;
+    }
+    self->refresh_mask = self->refresh_buffer + self->refresh_buffer_count * self->refresh_buffer_size;
 }
 
 void displayio_display_core_collect_ptrs(displayio_display_core_t *self) {
@@ -378,11 +451,60 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self) {
 
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     if (self->current_group != NULL) {
-        return displayio_group_fill_area(self->current_group,&self->colorspace, area, mask, buffer);
+        bool full_coverage = displayio_group_fill_area(self->current_group,&self->colorspace, area, mask, buffer);
+        #if CIRCUITPY_VECTORIO
+        vectorio_finish_fill_area(&self->colorspace, buffer);
+        #endif
+        return full_coverage;
+    }
+    return false;
+}
+
+// Hands area to the second core to composite while this core sends pixels. Returns false when
+// the caller must composite it itself. Until displayio_display_core_finish_fill_area is called,
+// mask and buffer belong to the second core and the group must not change.
+bool displayio_display_core_start_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
+    #if CIRCUITPY_DISPLAYIO_CORE1
+    if (self->current_group != NULL && !displayio_group_reads_files(self->current_group)) {
+        return displayio_core1_start_fill_area(self, area, mask, buffer);
     }
+    #endif
     return false;
 }
 
+void displayio_display_core_finish_fill_area(displayio_display_core_t *self) {
+    #if CIRCUITPY_DISPLAYIO_CORE1
+    displayio_core1_finish_fill_area();
+    #endif
+}
+
+displayio_area_fill_t displayio_display_core_get_area_fill(displayio_display_core_t *self, const displayio_area_t *area, uint32_t *color) {
+    if (self->current_group != NULL) {
+        return displayio_group_get_area_fill(self->current_group, &self->colorspace, area, color);
+    }
+    return DISPLAYIO_AREA_FILL_EMPTY;
+}
+
+void displayio_display_core_send_fill(displayio_display_core_t *self, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *pattern, uint32_t pattern_length, uint32_t count) {
+    if (self->send_fill != NULL &&
+        self->send_fill(self->bus, byte_type, chip_select, pattern, pattern_length, count)) {
+        return;
+    }
+    // Repeat the pattern through a small buffer instead.
+    uint32_t buffer[32];
+    uint8_t *bytes = (uint8_t *)buffer;
+    uint32_t patterns_per_buffer = sizeof(buffer) / pattern_length;
+    for (uint32_t i = 0; i < patterns_per_buffer; i++) {
+        memcpy(bytes + i * pattern_length, pattern, pattern_length);
+    }
+    while (count > 0) {
+        uint32_t n = MIN(count, patterns_per_buffer);
+        self->send(self->bus, byte_type, chip_select, bytes, n * pattern_length);
+        count -= n;
+    }
+}
+
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped) {
     bool overlaps = displayio_area_compute_overlap(&self->area, area, clipped);
     if (!overlaps) {
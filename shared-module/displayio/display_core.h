@@ -34,15 +34,22 @@
 
 #define NO_COMMAND 0x100
 
+// Maximum number of areas redrawn per refresh after overlapping and adjacent ones are merged.
+#define DISPLAYIO_MAX_REFRESH_AREAS (16)
+
 typedef struct {
     mp_obj_t bus;
     displayio_group_t *current_group;
     uint64_t last_refresh;
+    uint32_t last_refresh_duration; // In milliseconds.
     display_bus_bus_reset bus_reset;
     display_bus_bus_free bus_free;
     display_bus_begin_transaction begin_transaction;
     display_bus_send send;
     display_bus_end_transaction end_transaction;
+    display_bus_start_send start_send;
+    display_bus_finish_send finish_send;
+    display_bus_send_fill send_fill;
     displayio_buffer_transform_t transform;
     displayio_area_t area;
     uint16_t width;
@@ -64,6 +71,13 @@ typedef struct {
     bool SH1107_addressing;
     bool address_little_endian;
 
+    // Optional supervisor allocated space used instead of the stack to composite refresh areas. It
+    // holds refresh_buffer_count pixel buffers of refresh_buffer_size words each and then the mask.
+    uint32_t *refresh_buffer;
+    uint32_t *refresh_mask;
+    uint32_t refresh_buffer_size; // In uint32_ts
+    uint8_t refresh_buffer_count;
+
     bool full_refresh; // New group means we need to refresh the whole display.
     bool refresh_in_progress;
 } displayio_display_core_t;
@@ -92,13 +106,34 @@ void displayio_display_core_set_region_to_update(displayio_display_core_t *self,
 
 void release_display_core(displayio_display_core_t *self);
 
+// Allocates buffer_count buffers of size_in_bytes (and a matching mask) that refreshes composite
+// into instead of a small stack buffer. 0 frees them.
+void displayio_display_core_set_refresh_buffer_size(displayio_display_core_t *self, uint32_t size_in_bytes, uint8_t buffer_count);
+uint32_t displayio_display_core_get_refresh_buffer_size(displayio_display_core_t *self);
+// Called after supervisor_move_memory() to update the pointers to the refresh buffer.
+void displayio_display_core_move_refresh_buffer(displayio_display_core_t *self);
+
 bool displayio_display_core_start_refresh(displayio_display_core_t *self);
 void displayio_display_core_finish_refresh(displayio_display_core_t *self);
+void displayio_display_core_finish_group_refresh(displayio_display_core_t *self);
+void displayio_display_core_end_refresh(displayio_display_core_t *self);
 
 void displayio_display_core_collect_ptrs(displayio_display_core_t *self);
 
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
+bool displayio_display_core_start_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
+void displayio_display_core_finish_fill_area(displayio_display_core_t *self);
+displayio_area_fill_t displayio_display_core_get_area_fill(displayio_display_core_t *self, const displayio_area_t *area, uint32_t *color);
+void displayio_display_core_send_fill(displayio_display_core_t *self, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *pattern, uint32_t pattern_length, uint32_t count);
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped);
 
+#if CIRCUITPY_DISPLAYIO_CORE1
+// Implemented by the port. Returns false when the second core can't take the job now.
+bool displayio_core1_start_fill_area(displayio_display_core_t *core, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
+// Waits for the second core to finish any area it is compositing.
+void displayio_core1_finish_fill_area(void);
+#endif
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_DISPLAY_CORE_H
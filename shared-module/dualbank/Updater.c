@@ -0,0 +1,151 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-bindings/dualbank/__init__.h"
+#include "shared-bindings/dualbank/Updater.h"
+#include "shared-bindings/hashlib/__init__.h"
+#include "supervisor/shared/translate/translate.h"
+
+void common_hal_dualbank_updater_construct(dualbank_updater_obj_t *self, size_t size, const uint8_t *sha256) {
+    common_hal_hashlib_new(&self->hash, "sha256");
+    self->size = size;
+    self->offset = 0;
+    self->fill = 0;
+    self->finished = false;
+    self->verify = sha256 != NULL;
+    if (self->verify) {
+        memcpy(self->expected, sha256, DUALBANK_UPDATER_DIGEST_SIZE);
+    }
+}
+
+STATIC void check_not_finished(dualbank_updater_obj_t *self) {
+    if (self->finished) {
+        mp_raise_ValueError(translate("I/O operation on closed file"));
+    }
+}
+
+STATIC void flush_chunk(dualbank_updater_obj_t *self) {
+    if (self->fill == 0) {
+        return;
+    }
+    common_hal_dualbank_flash(self->chunk, self->fill, self->offset - self->fill);
+    self->fill = 0;
+}
+
+// Limits len to what still fits in the chunk and the expected image.
+STATIC size_t room_for(dualbank_updater_obj_t *self, size_t len) {
+    len = MIN(len, DUALBANK_UPDATER_CHUNK_SIZE - self->fill);
+    if (self->size != 0) {
+        len = MIN(len, self->size - self->offset);
+    }
+    return len;
+}
+
+// Accounts for len new bytes that are already at the end of the chunk.
+STATIC void accept(dualbank_updater_obj_t *self, size_t len) {
+    common_hal_hashlib_hash_update(&self->hash, self->chunk + self->fill, len);
+    self->fill += len;
+    self->offset += len;
+    if (self->fill == DUALBANK_UPDATER_CHUNK_SIZE) {
+        flush_chunk(self);
+    }
+}
+
+STATIC void check_size(dualbank_updater_obj_t *self, size_t remaining) {
+    if (self->size != 0 && remaining > self->size - self->offset) {
+        mp_raise_RuntimeError(translate("Firmware is too big"));
+    }
+}
+
+void common_hal_dualbank_updater_write(dualbank_updater_obj_t *self, const uint8_t *buf, size_t len) {
+    check_not_finished(self);
+    check_size(self, len);
+    while (len > 0) {
+        size_t n = room_for(self, len);
+        memcpy(self->chunk + self->fill, buf, n);
+        accept(self, n);
+        buf += n;
+        len -= n;
+    }
+}
+
+size_t common_hal_dualbank_updater_readfrom(dualbank_updater_obj_t *self, mp_obj_t stream, size_t nbytes) {
+    check_not_finished(self);
+    const mp_stream_p_t *stream_p = mp_get_stream_raise(stream, MP_STREAM_OP_READ);
+    size_t total = 0;
+    while (total < nbytes) {
+        size_t want = room_for(self, nbytes - total);
+        if (want == 0) {
+            break;
+        }
+        // Read straight into the chunk so no other buffer is needed.
+        int errcode;
+        mp_uint_t got = stream_p->read(stream, self->chunk + self->fill, want, &errcode);
+        if (got == MP_STREAM_ERROR) {
+            // Everything before the error is kept, so the caller can pick up
+            // at offset with a new stream.
+            if (mp_is_nonblocking_error(errcode)) {
+                break;
+            }
+            mp_raise_OSError(errcode);
+        }
+        if (got == 0) {
+            break;
+        }
+        accept(self, got);
+        total += got;
+    }
+    return total;
+}
+
+void common_hal_dualbank_updater_finish(dualbank_updater_obj_t *self) {
+    check_not_finished(self);
+    flush_chunk(self);
+    self->finished = true;
+    if (self->size != 0 && self->offset != self->size) {
+        mp_raise_RuntimeError(translate("Firmware is invalid"));
+    }
+    if (self->verify) {
+        uint8_t digest[DUALBANK_UPDATER_DIGEST_SIZE];
+        common_hal_hashlib_hash_digest(&self->hash, digest, sizeof(digest));
+        if (memcmp(digest, self->expected, sizeof(digest)) != 0) {
+            mp_raise_RuntimeError(translate("Firmware is invalid"));
+        }
+    }
+}
+
+size_t common_hal_dualbank_updater_get_offset(dualbank_updater_obj_t *self) {
+    return self->offset;
+}
+
+void common_hal_dualbank_updater_get_digest(dualbank_updater_obj_t *self, uint8_t *digest) {
+    common_hal_hashlib_hash_digest(&self->hash, digest, DUALBANK_UPDATER_DIGEST_SIZE);
+}
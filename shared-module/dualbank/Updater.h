@@ -0,0 +1,59 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_DUALBANK_UPDATER_H
+#define MICROPY_INCLUDED_SHARED_MODULE_DUALBANK_UPDATER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "shared-bindings/hashlib/Hash.h"
+
+// Data is handed to common_hal_dualbank_flash() in chunks of this size so that
+// every write but the last starts and ends on an erase block.
+#ifndef DUALBANK_UPDATER_CHUNK_SIZE
+#define DUALBANK_UPDATER_CHUNK_SIZE (4096)
+#endif
+
+#define DUALBANK_UPDATER_DIGEST_SIZE (32)
+
+typedef struct {
+    mp_obj_base_t base;
+    // SHA-256 of everything accepted so far, including what is still buffered.
+    hashlib_hash_obj_t hash;
+    // Expected image size, or 0 when unknown.
+    size_t size;
+    // Bytes accepted so far. All but the last fill of them are in flash.
+    size_t offset;
+    size_t fill;
+    bool verify;
+    bool finished;
+    uint8_t expected[DUALBANK_UPDATER_DIGEST_SIZE];
+    uint8_t chunk[DUALBANK_UPDATER_CHUNK_SIZE];
+} dualbank_updater_obj_t;
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_DUALBANK_UPDATER_H
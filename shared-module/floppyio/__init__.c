@@ -31,16 +31,264 @@
 #include "common-hal/floppyio/__init__.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 
+#ifndef FLOPPYIO_FLUX_CAPTURE
+#define FLOPPYIO_FLUX_CAPTURE (0)
+#endif
+
 #ifndef T2_5
 #define T2_5 (FLOPPYIO_SAMPLERATE * 5 / 2 / 1000000)
 #endif
 #ifndef T3_5
 #define T3_5 (FLOPPYIO_SAMPLERATE * 7 / 2 / 1000000)
 #endif
+#ifndef T4_5
+#define T4_5 (FLOPPYIO_SAMPLERATE * 9 / 2 / 1000000)
+#endif
 
+#if FLOPPYIO_FLUX_CAPTURE
+#include "shared/runtime/interrupt_char.h"
+#else
 #define MFM_IO_MMIO (1)
 #include "lib/adafruit_floppy/src/mfm_impl.h"
+#endif
+
+#if FLOPPYIO_FLUX_CAPTURE
+// mfm_readinto decodes while the track is captured into a ring this big.
+#define MFM_RING_BITS (11)
+#define MFM_RING_SIZE (1 << MFM_RING_BITS)
+// Give up when sectors are still missing after this many revolutions.
+#define MFM_MAX_REVOLUTIONS (5)
+
+#define MFM_SYNC (0x4489)
+#define MFM_ID_MARK (0xfe)
+#define MFM_DATA_MARK (0xfb)
+#define MFM_SECTOR_SIZE (512)
+
+enum {
+    MFM_HUNT,
+    MFM_SYNCED,
+    MFM_ID,
+    MFM_DATA,
+};
+
+typedef struct {
+    uint8_t *buf;
+    uint8_t *validity;
+    size_t n_sectors;
+    size_t n_valid;
+    // Cells per flux count, 0 for counts too long to be MFM.
+    uint8_t cells[256];
+    uint32_t raw;
+    uint8_t state;
+    uint8_t n_sync;
+    uint8_t raw_bits;
+    uint16_t crc;
+    size_t pos;
+    uint8_t id[6];
+    // Sector named by the last good ID field, or -1.
+    int sector;
+} mfm_decoder_t;
+
+STATIC uint16_t crc16_update(uint16_t crc, uint8_t byte) {
+    crc ^= byte << 8;
+    for (int i = 0; i < 8; i++) {
+        crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
 
+// Data bits are the odd cells of the 16 recorded for each byte.
+STATIC uint8_t mfm_data_bits(uint32_t raw) {
+    raw &= 0x5555;
+    raw = (raw | (raw >> 1)) & 0x3333;
+    raw = (raw | (raw >> 2)) & 0x0f0f;
+    return raw | (raw >> 4);
+}
+
+STATIC void mfm_decoder_init(mfm_decoder_t *self, uint8_t *buf, uint8_t *validity, size_t n_sectors) {
+    self->buf = buf;
+    self->validity = validity;
+    self->n_sectors = n_sectors;
+    self->n_valid = 0;
+    memset(validity, 0, n_sectors);
+    for (int i = 0; i < 256; i++) {
+        self->cells[i] = i < T2_5 ? 2 : i < T3_5 ? 3 : i < T4_5 ? 4 : 0;
+    }
+    self->raw = 0;
+    self->state = MFM_HUNT;
+    self->sector = -1;
+}
+
+STATIC void mfm_decoder_byte(mfm_decoder_t *self, uint8_t byte) {
+    self->crc = crc16_update(self->crc, byte);
+    switch (self->state) {
+        case MFM_SYNCED:
+            self->pos = 0;
+            if (byte == MFM_ID_MARK) {
+                self->state = MFM_ID;
+            } else if (byte == MFM_DATA_MARK && self->sector >= 0 && !self->validity[self->sector]) {
+                self->state = MFM_DATA;
+            } else {
+                self->state = MFM_HUNT;
+            }
+            return;
+        case MFM_ID:
+            self->id[self->pos++] = byte;
+            if (self->pos < sizeof(self->id)) {
+                return;
+            }
+            // Cylinder, head, sector from 1 and size code 2 for 512 bytes.
+            self->sector = -1;
+            if (self->crc == 0 && self->id[3] == 2 && self->id[2] >= 1 && self->id[2] <= (int)self->n_sectors) {
+                self->sector = self->id[2] - 1;
+            }
+            break;
+        case MFM_DATA:
+            if (self->pos < MFM_SECTOR_SIZE) {
+                self->buf[self->sector * MFM_SECTOR_SIZE + self->pos] = byte;
+            }
+            if (++self->pos < MFM_SECTOR_SIZE + 2) {
+                return;
+            }
+            if (self->crc == 0) {
+                self->validity[self->sector] = 1;
+                self->n_valid++;
+            }
+            self->sector = -1;
+            break;
+    }
+    self->state = MFM_HUNT;
+}
+
+STATIC void mfm_decoder_count(mfm_decoder_t *self, uint8_t count) {
+    uint8_t cells = self->cells[count];
+    if (cells == 0) {
+        self->state = MFM_HUNT;
+        return;
+    }
+    self->raw = (self->raw << cells) | 1;
+    if (self->state == MFM_HUNT) {
+        // A sync word always ends on a transition.
+        if ((self->raw & 0xffff) == MFM_SYNC) {
+            self->state = MFM_SYNCED;
+            self->n_sync = 1;
+            self->raw_bits = 0;
+        }
+        return;
+    }
+    self->raw_bits += cells;
+    while (self->raw_bits >= 16 && self->state != MFM_HUNT) {
+        self->raw_bits -= 16;
+        uint16_t word = self->raw >> self->raw_bits;
+        if (self->state == MFM_SYNCED && word == MFM_SYNC) {
+            self->n_sync++;
+            continue;
+        }
+        if (self->state == MFM_SYNCED) {
+            if (self->n_sync < 3) {
+                self->state = MFM_HUNT;
+                return;
+            }
+            // The CRC covers the three sync bytes.
+            self->crc = 0xffff;
+            for (int i = 0; i < 3; i++) {
+                self->crc = crc16_update(self->crc, 0xa1);
+            }
+        }
+        mfm_decoder_byte(self, mfm_data_bits(word));
+    }
+}
+
+// Returns when the index line goes low, or false if interrupted.
+STATIC bool wait_index_low(volatile uint32_t *index_port, uint32_t index_mask) {
+    while (*index_port & index_mask) {
+        if (mp_hal_is_interrupted()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
+    uint32_t index_mask;
+    volatile uint32_t *index_port = common_hal_digitalio_digitalinout_get_reg(index, DIGITALINOUT_REG_READ, &index_mask);
+
+    memset(buf, 0, len);
+
+    if (!wait_index_low(index_port, index_mask)) {
+        return 0;
+    }
+
+    floppyio_capture_t capture;
+    if (!floppyio_capture_start(&capture, buf, len, 0, data)) {
+        mp_raise_RuntimeError(translate("All state machines in use"));
+    }
+
+    // Stop at the start of the next index pulse.
+    bool index_high = false;
+    size_t count;
+    while ((count = floppyio_capture_count(&capture)) < len) {
+        bool high = *index_port & index_mask;
+        if (index_high && !high) {
+            break;
+        }
+        index_high = high;
+        if (mp_hal_is_interrupted()) {
+            break;
+        }
+    }
+    floppyio_capture_stop(&capture);
+
+    return count;
+}
+
+int common_hal_floppyio_mfm_readinto(void *buf, size_t n_sectors, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
+    uint32_t index_mask;
+    volatile uint32_t *index_port = common_hal_digitalio_digitalinout_get_reg(index, DIGITALINOUT_REG_READ, &index_mask);
+
+    // The DMA ring has to be aligned to its size.
+    uint8_t *ring_alloc = m_malloc(2 * MFM_RING_SIZE, false);
+    uint8_t *ring = (uint8_t *)(((uintptr_t)ring_alloc + MFM_RING_SIZE - 1) & ~(uintptr_t)(MFM_RING_SIZE - 1));
+    uint8_t validity[n_sectors];
+    mfm_decoder_t decoder;
+    mfm_decoder_init(&decoder, buf, validity, n_sectors);
+
+    floppyio_capture_t capture;
+    if (!floppyio_capture_start(&capture, ring, MFM_RING_SIZE, MFM_RING_BITS, data)) {
+        m_del(uint8_t, ring_alloc, 2 * MFM_RING_SIZE);
+        mp_raise_RuntimeError(translate("All state machines in use"));
+    }
+
+    size_t done = 0;
+    int revolutions = 0;
+    bool index_high = true;
+    while (decoder.n_valid < n_sectors && revolutions < MFM_MAX_REVOLUTIONS) {
+        size_t count = floppyio_capture_count(&capture);
+        if (count - done > MFM_RING_SIZE) {
+            // Fell a whole ring behind: drop what was lost and resynchronize.
+            decoder.state = MFM_HUNT;
+            decoder.sector = -1;
+            done = count - MFM_RING_SIZE / 2;
+        }
+        while (done != count) {
+            mfm_decoder_count(&decoder, ring[done++ % MFM_RING_SIZE]);
+        }
+
+        bool high = *index_port & index_mask;
+        if (index_high && !high) {
+            revolutions++;
+        }
+        index_high = high;
+        if (mp_hal_is_interrupted()) {
+            break;
+        }
+    }
+    floppyio_capture_stop(&capture);
+    m_del(uint8_t, ring_alloc, 2 * MFM_RING_SIZE);
+
+    return decoder.n_valid;
+}
+#else
 __attribute__((optimize("O3")))
 int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
     uint32_t index_mask;
@@ -108,3 +356,4 @@ int common_hal_floppyio_mfm_readinto(void *buf, size_t n_sectors, digitalio_digi
 
     return result;
 }
+#endif
@@ -24,4 +24,140 @@
  * THE SOFTWARE.
  */
 
-// Nothing now.
+
+#include "shared-bindings/fontio/__init__.h"
+
+#include "py/runtime.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/fontio/BuiltinFont.h"
+
+// Glyphs looked up during one render_text call are kept in a small direct-mapped
+// cache so repeated characters only call the font's get_glyph once.
+#define GLYPH_CACHE_SIZE (16)
+
+typedef struct {
+    mp_uint_t codepoint;
+    const displayio_bitmap_t *bitmap; // NULL when the font has no glyph
+    uint16_t tile_x;
+    uint16_t tile_y;
+    uint16_t width;
+    uint16_t height;
+    int16_t dx;
+    int16_t dy;
+    int16_t shift_x;
+    bool valid;
+} glyph_cache_entry_t;
+
+STATIC void lookup_builtin_glyph(const fontio_builtinfont_t *font, glyph_cache_entry_t *entry) {
+    uint8_t glyph_index = fontio_builtinfont_get_glyph_index(font, entry->codepoint);
+    if (glyph_index == 0xff) {
+        return;
+    }
+    uint16_t tiles_per_row = font->bitmap->width / font->width;
+    entry->bitmap = font->bitmap;
+    entry->tile_x = (glyph_index % tiles_per_row) * font->width;
+    entry->tile_y = (glyph_index / tiles_per_row) * font->height;
+    entry->width = font->width;
+    entry->height = font->height;
+    entry->shift_x = font->width;
+}
+
+STATIC void lookup_glyph(mp_obj_t font, mp_obj_t get_glyph[3], glyph_cache_entry_t *entry) {
+    get_glyph[2] = MP_OBJ_NEW_SMALL_INT(entry->codepoint);
+    mp_obj_t glyph = mp_call_method_n_kw(1, 0, get_glyph);
+    if (glyph == mp_const_none) {
+        return;
+    }
+    mp_obj_t *fields;
+    mp_obj_get_array_fixed_n(glyph, 8, &fields);
+    const displayio_bitmap_t *bitmap = mp_arg_validate_type(fields[0], &displayio_bitmap_type, MP_QSTR_bitmap);
+    mp_int_t tile_index = mp_obj_get_int(fields[1]);
+    mp_int_t width = mp_obj_get_int(fields[2]);
+    mp_int_t height = mp_obj_get_int(fields[3]);
+    entry->dx = mp_obj_get_int(fields[4]);
+    entry->dy = mp_obj_get_int(fields[5]);
+    entry->shift_x = mp_obj_get_int(fields[6]);
+    if (width <= 0 || height <= 0 || width > bitmap->width) {
+        // Nothing to draw, but the glyph still advances the cursor.
+        return;
+    }
+    mp_int_t tiles_per_row = bitmap->width / width;
+    mp_int_t tile_x = (tile_index % tiles_per_row) * width;
+    mp_int_t tile_y = (tile_index / tiles_per_row) * height;
+    if (tile_index < 0 || tile_y + height > bitmap->height) {
+        mp_arg_error_invalid(MP_QSTR_tile_index);
+    }
+    entry->bitmap = bitmap;
+    entry->tile_x = tile_x;
+    entry->tile_y = tile_y;
+    entry->width = width;
+    entry->height = height;
+}
+
+mp_int_t common_hal_fontio_render_text(mp_obj_t font, const byte *text, size_t len,
+    displayio_bitmap_t *bitmap, mp_int_t x, mp_int_t y, uint32_t palette_index) {
+    if (bitmap->read_only) {
+        mp_raise_RuntimeError(translate("Read-only"));
+    }
+
+    bool builtin = mp_obj_is_type(font, &fontio_builtinfont_type);
+    mp_obj_t get_glyph[3];
+    if (!builtin) {
+        mp_load_method(font, MP_QSTR_get_glyph, get_glyph);
+    }
+
+    glyph_cache_entry_t cache[GLYPH_CACHE_SIZE];
+    for (size_t i = 0; i < GLYPH_CACHE_SIZE; i++) {
+        cache[i].valid = false;
+    }
+
+    displayio_area_t dirty = {0};
+    const byte *end = text + len;
+    while (text < end) {
+        mp_uint_t codepoint = utf8_get_char(text);
+        text = utf8_next_char(text);
+
+        glyph_cache_entry_t *entry = &cache[codepoint % GLYPH_CACHE_SIZE];
+        if (!entry->valid || entry->codepoint != codepoint) {
+            *entry = (glyph_cache_entry_t) {
+                .codepoint = codepoint,
+                .valid = true,
+            };
+            if (builtin) {
+                lookup_builtin_glyph(MP_OBJ_TO_PTR(font), entry);
+            } else {
+                lookup_glyph(font, get_glyph, entry);
+            }
+        }
+
+        if (entry->bitmap != NULL) {
+            // y is the baseline, so the glyph's bottom edge sits dy above it.
+            mp_int_t left = x + entry->dx;
+            mp_int_t top = y - entry->height - entry->dy;
+            mp_int_t x1 = MAX(left, 0);
+            mp_int_t y1 = MAX(top, 0);
+            mp_int_t x2 = MIN(left + entry->width, bitmap->width);
+            mp_int_t y2 = MIN(top + entry->height, bitmap->height);
+            const displayio_bitmap_t *source = entry->bitmap;
+            for (mp_int_t dest_y = y1; dest_y < y2; dest_y++) {
+                const uint32_t *source_row = displayio_bitmap_get_row(source, entry->tile_y + dest_y - top);
+                uint32_t *dest_row = displayio_bitmap_get_row(bitmap, dest_y);
+                for (mp_int_t dest_x = x1; dest_x < x2; dest_x++) {
+                    if (displayio_bitmap_row_get_value(source, source_row, entry->tile_x + dest_x - left) != 0) {
+                        displayio_bitmap_row_set_value(bitmap, dest_row, dest_x, palette_index);
+                    }
+                }
+            }
+            if (x1 < x2 && y1 < y2) {
+                displayio_area_t glyph_area = {x1, y1, x2, y2, NULL};
+                displayio_area_union(&dirty, &glyph_area, &dirty);
+            }
+        }
+        x += entry->shift_x;
+    }
+
+    if (!displayio_area_empty(&dirty)) {
+        displayio_bitmap_set_dirty_area(bitmap, &dirty);
+    }
+    return x;
+}
@@ -151,7 +151,9 @@ STATIC const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdispl
 
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
 STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask) {
-    uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
+    // In uint32_ts
+    uint32_t buffer_size = self->core.refresh_buffer != NULL ?
+        self->core.refresh_buffer_size : CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t);
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
@@ -169,7 +171,7 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
 
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
-    uint16_t pixels_per_buffer = displayio_area_size(&clipped);
+    uint32_t pixels_per_buffer = displayio_area_size(&clipped);
     if (displayio_area_size(&clipped) > buffer_size * pixels_per_word) {
         rows_per_buffer = buffer_size * pixels_per_word / displayio_area_width(&clipped);
         if (rows_per_buffer == 0) {
@@ -194,13 +196,23 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
     }
 
     // Allocated and shared as a uint32_t array so the compiler knows the
-    // alignment everywhere.
-    uint32_t buffer[buffer_size];
+    // alignment everywhere. When the display's refresh buffer holds two
+    // subrectangles the second core composites the next one into it while the
+    // previous one is copied. Otherwise a single buffer is used from the stack.
+    bool use_stack = self->core.refresh_buffer == NULL || buffer_size > self->core.refresh_buffer_size;
+    uint8_t buffer_count = !use_stack && self->core.refresh_buffer_count >= 2 ? 2 : 1;
+    bool offload = CIRCUITPY_DISPLAYIO_CORE1 && subrectangles > 1 && buffer_count == 2;
     uint32_t mask_length = (pixels_per_buffer / 32) + 1;
-    uint32_t mask[mask_length];
+    uint32_t stack_buffer[use_stack ? buffer_size : 1];
+    uint32_t stack_mask[use_stack ? mask_length : 1];
+    uint32_t *buffers = use_stack ? stack_buffer : self->core.refresh_buffer;
+    uint32_t *mask = use_stack ? stack_mask : self->core.refresh_mask;
     uint16_t remaining_rows = displayio_area_height(&clipped);
+    // True when the second core is compositing the current subrectangle.
+    bool offloaded = false;
 
     for (uint16_t j = 0; j < subrectangles; j++) {
+        uint32_t *buffer = buffers + (j % buffer_count) * buffer_size;
         displayio_area_t subrectangle = {
             .x1 = clipped.x1,
             .y1 = clipped.y1 + rows_per_buffer * j,
@@ -213,10 +225,29 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         }
         remaining_rows -= rows_per_buffer;
 
-        memset(mask, 0, mask_length * sizeof(mask[0]));
-        memset(buffer, 0, buffer_size * sizeof(buffer[0]));
+        if (offloaded) {
+            displayio_display_core_finish_fill_area(&self->core);
+            offloaded = false;
+        } else {
+            memset(mask, 0, mask_length * sizeof(mask[0]));
+            memset(buffer, 0, buffer_size * sizeof(buffer[0]));
+
+            displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+        }
 
-        displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+        // Composite the next subrectangle on the other core while this one is copied.
+        if (offload && j + 1 < subrectangles) {
+            uint32_t *next_buffer = buffers + ((j + 1) % buffer_count) * buffer_size;
+            displayio_area_t next = {
+                .x1 = clipped.x1,
+                .y1 = subrectangle.y2,
+                .x2 = clipped.x2,
+                .y2 = MIN(subrectangle.y2 + rows_per_buffer, clipped.y2)
+            };
+            memset(mask, 0, mask_length * sizeof(mask[0]));
+            memset(next_buffer, 0, buffer_size * sizeof(next_buffer[0]));
+            offloaded = displayio_display_core_start_fill_area(&self->core, &next, mask, next_buffer);
+        }
 
         uint8_t *buf = (uint8_t *)self->bufinfo.buf, *endbuf = buf + self->bufinfo.len;
         (void)endbuf; // Hint to compiler that endbuf is "used" even if NDEBUG
@@ -250,7 +281,10 @@ STATIC void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
         return;
     }
     displayio_display_core_start_refresh(&self->core);
-    const displayio_area_t *current_area = _get_refresh_areas(self);
+    // Framebuffer writes have no command overhead so only merge areas that don't add pixels.
+    displayio_area_t merged[DISPLAYIO_MAX_REFRESH_AREAS];
+    const displayio_area_t *current_area = displayio_area_coalesce(_get_refresh_areas(self),
+        merged, DISPLAYIO_MAX_REFRESH_AREAS, 0);
     if (current_area) {
         uint8_t dirty_row_bitmask[(self->core.height + 7) / 8];
         memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
@@ -260,6 +294,8 @@ STATIC void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
             current_area = current_area->next;
         }
         self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+    } else if (self->framebuffer_protocol->idle) {
+        self->framebuffer_protocol->idle(self->framebuffer);
     }
     displayio_display_core_finish_refresh(&self->core);
 }
@@ -76,6 +76,7 @@ typedef mp_float_t (*framebuffer_get_brightness_fun)(mp_obj_t);
 typedef void (*framebuffer_deinit_fun)(mp_obj_t);
 typedef void (*framebuffer_get_bufinfo_fun)(mp_obj_t, mp_buffer_info_t *bufinfo);
 typedef void (*framebuffer_swapbuffers_fun)(mp_obj_t, uint8_t *dirty_row_bitmask);
+typedef void (*framebuffer_idle_fun)(mp_obj_t);
 
 typedef struct _framebuffer_p_t {
     MP_PROTOCOL_HEAD // MP_QSTR_protocol_framebuffer
@@ -102,6 +103,9 @@ typedef struct _framebuffer_p_t {
     framebuffer_get_brightness_fun get_brightness;
     framebuffer_set_brightness_fun set_brightness;
 
+    // Optional -- called instead of swapbuffers by a refresh with nothing to draw
+    framebuffer_idle_fun idle;
+
 } framebuffer_p_t;
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_FRAMEBUFFERDISPLAY_H
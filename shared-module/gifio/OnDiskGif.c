@@ -27,6 +27,7 @@
 #include "shared-bindings/gifio/OnDiskGif.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/time/__init__.h"
 
 #include <string.h>
 
@@ -57,7 +58,7 @@ static int32_t GIFReadFile(GIFFILE *pFile, uint8_t *pBuf, int32_t iLen) {
 static int32_t GIFSeekFile(GIFFILE *pFile, int32_t iPosition) {
     pyb_file_obj_t *f = pFile->fHandle;
 
-    f_lseek(&f->fp, iPosition);
+    fat_file_lseek(f, iPosition);
     pFile->iPos = f->fp.fptr;
     return pFile->iPos;
 } /* GIFSeekFile() */
@@ -72,8 +73,18 @@ static void GIFDraw(GIFDRAW *pDraw) {
     displayio_bitmap_t *bitmap = ondiskgif->bitmap;
     displayio_palette_t *palette = ondiskgif->palette;
 
+    // The palette and frame rectangle are the same for every line of a frame,
+    // so only handle them once at the top of the frame.
+    if (pDraw->y == 0) {
+        displayio_area_t *frame_area = &ondiskgif->frame_area;
+        frame_area->x1 = MIN(pDraw->iX, bitmap->width);
+        frame_area->y1 = MIN(pDraw->iY, bitmap->height);
+        frame_area->x2 = MIN(pDraw->iX + pDraw->iWidth, bitmap->width);
+        frame_area->y2 = MIN(pDraw->iY + pDraw->iHeight, bitmap->height);
+    }
+
     // Update the palette if we have one in RGB888
-    if (palette != NULL) {
+    if (palette != NULL && pDraw->y == 0) {
         uint8_t *pPal = pDraw->pPalette24;
         for (int p = 0; p < 256; p++) {
             uint8_t r = *pPal++;
@@ -245,18 +256,24 @@ int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self) {
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
     int nextDelay = 0;
     int result = 0;
-    result = GIF_playFrame(&self->gif, &nextDelay, self);
 
-    if ((result >= 0) && (setDirty)) {
-        displayio_area_t dirty_area = {
-            .x1 = 0,
-            .y1 = 0,
-            .x2 = self->bitmap->width,
-            .y2 = self->bitmap->height,
-        };
+    // Only the rectangle covered by the new frame changes in the bitmap.
+    self->frame_area = (displayio_area_t) {0};
+    uint64_t start = common_hal_time_monotonic_ns();
+    result = GIF_playFrame(&self->gif, &nextDelay, self);
+    self->decode_time_ns = (uint32_t)(common_hal_time_monotonic_ns() - start);
 
-        displayio_bitmap_set_dirty_area(self->bitmap, &dirty_area);
+    if ((result >= 0) && (setDirty) && !displayio_area_empty(&self->frame_area)) {
+        displayio_bitmap_set_dirty_area(self->bitmap, &self->frame_area);
     }
 
     return nextDelay;
 }
+
+const displayio_area_t *common_hal_gifio_ondiskgif_get_frame_area(gifio_ondiskgif_t *self) {
+    return &self->frame_area;
+}
+
+uint32_t common_hal_gifio_ondiskgif_get_decode_time(gifio_ondiskgif_t *self) {
+    return self->decode_time_ns;
+}
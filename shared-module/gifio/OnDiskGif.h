@@ -48,6 +48,9 @@ typedef struct {
     int32_t frame_count;
     int32_t min_delay;
     int32_t max_delay;
+    // Area of the bitmap updated by the most recent frame.
+    displayio_area_t frame_area;
+    uint32_t decode_time_ns;
 } gifio_ondiskgif_t;
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_ONDISKGIF_H
@@ -71,6 +71,11 @@ void common_hal_is31fl3741_FrameBuffer_construct(is31fl3741_FrameBuffer_obj_t *s
         self->mapping[i] = (uint16_t)value;
     }
 
+    self->pwm = common_hal_is31fl3741_allocator_impl(IS31FL3741_LED_COUNT);
+    if (self->pwm == NULL) {
+        m_malloc_fail(IS31FL3741_LED_COUNT);
+    }
+
     common_hal_is31fl3741_FrameBuffer_reconstruct(self, framebuffer);
 }
 
@@ -102,9 +107,14 @@ void common_hal_is31fl3741_FrameBuffer_reconstruct(is31fl3741_FrameBuffer_obj_t
     common_hal_is31fl3741_set_current(self->is31fl3741, 0xFE);
 
     // set scale (brightness) to max for all LEDs
-    for (int i = 0; i < 351; i++) {
-        common_hal_is31fl3741_set_led(self->is31fl3741, i, 0xFF, 2);
-    }
+    uint8_t scale[IS31FL3741_LEDS_PER_PAGE];
+    memset(scale, 0xFF, sizeof(scale));
+    common_hal_is31fl3741_set_leds(self->is31fl3741, 0, scale, IS31FL3741_LEDS_PER_PAGE, 2);
+    common_hal_is31fl3741_set_leds(self->is31fl3741, IS31FL3741_LEDS_PER_PAGE, scale,
+        IS31FL3741_LED_COUNT - IS31FL3741_LEDS_PER_PAGE, 2);
+
+    // the reset cleared every PWM register
+    memset(self->pwm, 0, IS31FL3741_LED_COUNT);
 
     common_hal_is31fl3741_send_enable(self->is31fl3741);
     common_hal_is31fl3741_end_transaction(self->is31fl3741);
@@ -122,6 +132,11 @@ void common_hal_is31fl3741_FrameBuffer_deinit(is31fl3741_FrameBuffer_obj_t *self
         self->mapping = 0;
     }
 
+    if (self->pwm != NULL) {
+        common_hal_is31fl3741_free_impl(self->pwm);
+        self->pwm = NULL;
+    }
+
     self->base.type = NULL;
 
     // If a framebuffer was passed in to the constructor, NULL the reference
@@ -137,10 +152,57 @@ bool common_hal_is31fl3741_FrameBuffer_get_paused(is31fl3741_FrameBuffer_obj_t *
     return self->paused;
 }
 
+// Unchanged registers between two changed ones are sent anyway when the gap is
+// this short, because that is cheaper than starting another I2C write.
+#define IS31FL3741_MAX_RUN_GAP (3)
+
+STATIC void is31fl3741_FrameBuffer_stage_led(is31fl3741_FrameBuffer_obj_t *self, uint8_t *changed, uint16_t led, uint8_t level) {
+    if (led >= IS31FL3741_LED_COUNT || self->pwm[led] == level) {
+        return;
+    }
+    self->pwm[led] = level;
+    changed[led / 8] |= 1 << (led & 7);
+}
+
+STATIC void is31fl3741_FrameBuffer_stage_pixel(is31fl3741_FrameBuffer_obj_t *self, uint8_t *changed, int16_t x, int16_t y, uint32_t color) {
+    int16_t x1 = (x * self->scale_height + y) * 3;
+    uint16_t ridx = self->mapping[x1 + 2];
+    if (ridx != 65535) {
+        is31fl3741_FrameBuffer_stage_led(self, changed, ridx, color >> 16 & 0xFF);
+        is31fl3741_FrameBuffer_stage_led(self, changed, self->mapping[x1 + 1], color >> 8 & 0xFF);
+        is31fl3741_FrameBuffer_stage_led(self, changed, self->mapping[x1 + 0], color & 0xFF);
+    }
+}
+
+// Send the changed PWM registers, coalescing nearby ones into runs. A run
+// never crosses from one register page to the other.
+STATIC void is31fl3741_FrameBuffer_send_changed(is31fl3741_FrameBuffer_obj_t *self, const uint8_t *changed) {
+    uint16_t led = 0;
+    while (led < IS31FL3741_LED_COUNT) {
+        if (!(changed[led / 8] & (1 << (led & 7)))) {
+            led++;
+            continue;
+        }
+        uint16_t page_end = led < IS31FL3741_LEDS_PER_PAGE ? IS31FL3741_LEDS_PER_PAGE : IS31FL3741_LED_COUNT;
+        uint16_t first = led;
+        uint16_t last = led;
+        for (led++; led < page_end && led - last <= IS31FL3741_MAX_RUN_GAP; led++) {
+            if (changed[led / 8] & (1 << (led & 7))) {
+                last = led;
+            }
+        }
+        common_hal_is31fl3741_set_leds(self->is31fl3741, first, self->pwm + first, last - first + 1, 0);
+        led = last + 1;
+    }
+}
+
 void common_hal_is31fl3741_FrameBuffer_refresh(is31fl3741_FrameBuffer_obj_t *self, uint8_t *dirtyrows) {
     if (!self->paused) {
         common_hal_is31fl3741_begin_transaction(self->is31fl3741);
 
+        uint8_t changed[(IS31FL3741_LED_COUNT + 7) / 8];
+        memset(changed, 0, sizeof(changed));
+
         uint8_t dirty_row_flags = 0xFF;
         if (self->scale) {
             // Based on the Arduino IS31FL3741 driver code
@@ -172,7 +234,7 @@ void common_hal_is31fl3741_FrameBuffer_refresh(is31fl3741_FrameBuffer_obj_t *sel
                     } else {
                         color = (rsum << 16) + (gsum << 8) + bsum;
                     }
-                    common_hal_is31fl3741_draw_pixel(self->is31fl3741, x, y, color, self->mapping, self->scale_height);
+                    is31fl3741_FrameBuffer_stage_pixel(self, changed, x, y, color);
                 }
             }
         } else {
@@ -193,7 +255,7 @@ void common_hal_is31fl3741_FrameBuffer_refresh(is31fl3741_FrameBuffer_obj_t *sel
                             color = *buffer;
                         }
 
-                        common_hal_is31fl3741_draw_pixel(self->is31fl3741, x, y, color, self->mapping, self->scale_height);
+                        is31fl3741_FrameBuffer_stage_pixel(self, changed, x, y, color);
                         buffer++;
                     }
                 } else {
@@ -201,6 +263,7 @@ void common_hal_is31fl3741_FrameBuffer_refresh(is31fl3741_FrameBuffer_obj_t *sel
                 }
             }
         }
+        is31fl3741_FrameBuffer_send_changed(self, changed);
         common_hal_is31fl3741_end_transaction(self->is31fl3741);
     }
 }
@@ -225,4 +288,5 @@ void common_hal_is31fl3741_free_impl(void *ptr_in) {
 void is31fl3741_FrameBuffer_collect_ptrs(is31fl3741_FrameBuffer_obj_t *self) {
     gc_collect_ptr(self->framebuffer);
     gc_collect_ptr(self->mapping);
+    gc_collect_ptr(self->pwm);
 }
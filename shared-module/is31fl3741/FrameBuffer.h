@@ -39,6 +39,8 @@ typedef struct {
     mp_buffer_info_t bufinfo;
     uint16_t bufsize, width, height, scale_width, scale_height;
     uint16_t *mapping;
+    // The PWM value last sent for each LED, so a refresh only sends changes
+    uint8_t *pwm;
     uint8_t bit_depth;
     bool paused;
     bool scale;
@@ -135,12 +135,12 @@ uint8_t common_hal_is31fl3741_get_current(is31fl3741_IS31FL3741_obj_t *self) {
 void common_hal_is31fl3741_set_led(is31fl3741_IS31FL3741_obj_t *self, uint16_t led, uint8_t level, uint8_t page) {
     uint8_t cmd[2] = { 0x00, 0x00 };
 
-    if (led < 180) {
+    if (led < IS31FL3741_LEDS_PER_PAGE) {
         common_hal_is31fl3741_set_page(self, page);
         cmd[0] = (uint8_t)led;
     } else {
         common_hal_is31fl3741_set_page(self, page + 1);
-        cmd[0] = (uint8_t)(led - 180);
+        cmd[0] = (uint8_t)(led - IS31FL3741_LEDS_PER_PAGE);
     }
 
     cmd[1] = level;
@@ -148,6 +148,31 @@ void common_hal_is31fl3741_set_led(is31fl3741_IS31FL3741_obj_t *self, uint16_t l
     common_hal_busio_i2c_write(self->i2c, self->device_address, cmd, 2);
 }
 
+// Sets consecutive LEDs starting at led, using the register auto-increment to
+// send each page's part in a single I2C write.
+void common_hal_is31fl3741_set_leds(is31fl3741_IS31FL3741_obj_t *self, uint16_t led, const uint8_t *levels, size_t len, uint8_t page) {
+    uint8_t cmd[IS31FL3741_LEDS_PER_PAGE + 1];
+
+    while (len > 0) {
+        size_t n = MIN(len, IS31FL3741_LEDS_PER_PAGE);
+        if (led < IS31FL3741_LEDS_PER_PAGE) {
+            common_hal_is31fl3741_set_page(self, page);
+            cmd[0] = (uint8_t)led;
+            n = MIN(n, (size_t)(IS31FL3741_LEDS_PER_PAGE - led));
+        } else {
+            common_hal_is31fl3741_set_page(self, page + 1);
+            cmd[0] = (uint8_t)(led - IS31FL3741_LEDS_PER_PAGE);
+        }
+        memcpy(cmd + 1, levels, n);
+
+        common_hal_busio_i2c_write(self->i2c, self->device_address, cmd, n + 1);
+
+        led += n;
+        levels += n;
+        len -= n;
+    }
+}
+
 void common_hal_is31fl3741_draw_pixel(is31fl3741_IS31FL3741_obj_t *self, int16_t x, int16_t y, uint32_t color, uint16_t *mapping, uint8_t display_height) {
     uint8_t r = color >> 16 & 0xFF;
     uint8_t g = color >> 8 & 0xFF;
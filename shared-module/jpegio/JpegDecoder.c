@@ -0,0 +1,681 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "shared/runtime/interrupt_char.h"
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "supervisor/shared/translate/translate.h"
+
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/jpegio/JpegDecoder.h"
+
+// Baseline (sequential, Huffman coded) JPEG decoding. A minimum coded unit (MCU) is
+// decoded at a time and written straight into the bitmap, so apart from the decoder
+// object itself only a few pixel blocks are held in memory.
+
+enum {
+    MARKER_SOF0 = 0xc0,
+    MARKER_SOF1 = 0xc1,
+    MARKER_SOF15 = 0xcf,
+    MARKER_DHT = 0xc4,
+    MARKER_JPG = 0xc8,
+    MARKER_DAC = 0xcc,
+    MARKER_RST0 = 0xd0,
+    MARKER_RST7 = 0xd7,
+    MARKER_SOI = 0xd8,
+    MARKER_EOI = 0xd9,
+    MARKER_SOS = 0xda,
+    MARKER_DQT = 0xdb,
+    MARKER_DRI = 0xdd,
+};
+
+// At most 10 blocks make up a baseline MCU.
+#define MAX_BLOCKS_PER_MCU (10)
+
+STATIC const uint8_t zigzag[64] = {
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+STATIC NORETURN void raise_invalid(void) {
+    mp_raise_ValueError(translate("Invalid format"));
+}
+
+STATIC NORETURN void raise_unsupported(void) {
+    mp_raise_ValueError(translate("Unsupported format"));
+}
+
+STATIC void refill(jpegio_jpegdecoder_obj_t *self) {
+    if (self->source == MP_OBJ_NULL || self->in_memory) {
+        mp_raise_type(&mp_type_EOFError);
+    }
+    const mp_stream_p_t *stream = mp_get_stream_raise(self->source, MP_STREAM_OP_READ);
+    int err;
+    mp_uint_t out_sz = stream->read(self->source, self->inbuf, sizeof(self->inbuf), &err);
+    if (out_sz == MP_STREAM_ERROR) {
+        mp_raise_OSError(err);
+    }
+    if (out_sz == 0) {
+        mp_raise_type(&mp_type_EOFError);
+    }
+    self->read_ptr = self->inbuf;
+    self->read_end = self->inbuf + out_sz;
+}
+
+static inline uint8_t read_byte(jpegio_jpegdecoder_obj_t *self) {
+    if (self->read_ptr == self->read_end) {
+        refill(self);
+    }
+    return *self->read_ptr++;
+}
+
+STATIC uint16_t read_u16(jpegio_jpegdecoder_obj_t *self) {
+    uint16_t value = read_byte(self) << 8;
+    return value | read_byte(self);
+}
+
+STATIC void skip_bytes(jpegio_jpegdecoder_obj_t *self, size_t count) {
+    while (count) {
+        if (self->read_ptr == self->read_end) {
+            refill(self);
+        }
+        size_t n = MIN(count, (size_t)(self->read_end - self->read_ptr));
+        self->read_ptr += n;
+        count -= n;
+    }
+}
+
+// Returns the next marker code, skipping any fill bytes.
+STATIC uint8_t read_marker(jpegio_jpegdecoder_obj_t *self) {
+    if (read_byte(self) != 0xff) {
+        raise_invalid();
+    }
+    uint8_t marker;
+    do {
+        marker = read_byte(self);
+    } while (marker == 0xff);
+    return marker;
+}
+
+STATIC void read_quant_tables(jpegio_jpegdecoder_obj_t *self, int length) {
+    while (length > 0) {
+        uint8_t pq_tq = read_byte(self);
+        uint8_t precision = pq_tq >> 4;
+        uint8_t table = pq_tq & 0xf;
+        if (table > 3 || precision > 1) {
+            raise_invalid();
+        }
+        for (int i = 0; i < 64; i++) {
+            self->quant[table][i] = precision ? read_u16(self) : read_byte(self);
+        }
+        length -= 1 + 64 * (precision + 1);
+    }
+    if (length != 0) {
+        raise_invalid();
+    }
+}
+
+STATIC void read_huffman_tables(jpegio_jpegdecoder_obj_t *self, int length) {
+    while (length > 0) {
+        uint8_t tc_th = read_byte(self);
+        uint8_t table_class = tc_th >> 4;
+        uint8_t table = tc_th & 0xf;
+        if (table_class > 1 || table > 3) {
+            raise_invalid();
+        }
+        if (table > 1) {
+            // Baseline images only use tables 0 and 1.
+            raise_unsupported();
+        }
+        jpegio_huffman_t *h = &self->huffman[table_class][table];
+
+        uint8_t counts[17];
+        size_t total = 0;
+        for (int i = 1; i <= 16; i++) {
+            counts[i] = read_byte(self);
+            total += counts[i];
+        }
+        if (total > sizeof(h->values)) {
+            raise_invalid();
+        }
+        for (size_t i = 0; i < total; i++) {
+            h->values[i] = read_byte(self);
+        }
+        length -= 17 + total;
+
+        // Canonical codes: each length continues counting on from the previous one.
+        memset(h->lookup_length, 0, sizeof(h->lookup_length));
+        uint32_t code = 0;
+        size_t k = 0;
+        for (int len = 1; len <= 16; len++) {
+            h->valptr[len] = k;
+            h->mincode[len] = code;
+            for (int i = 0; i < counts[len]; i++, k++, code++) {
+                if (len <= JPEGIO_HUFFMAN_LOOKUP_BITS) {
+                    int shift = JPEGIO_HUFFMAN_LOOKUP_BITS - len;
+                    for (uint32_t j = code << shift; j < (code + 1) << shift; j++) {
+                        h->lookup_length[j] = len;
+                        h->lookup_value[j] = h->values[k];
+                    }
+                }
+            }
+            if (code > (1u << len)) {
+                raise_invalid();
+            }
+            h->maxcode[len] = counts[len] ? (int32_t)code - 1 : -1;
+            code <<= 1;
+        }
+    }
+    if (length != 0) {
+        raise_invalid();
+    }
+}
+
+STATIC void read_frame(jpegio_jpegdecoder_obj_t *self, int length) {
+    uint8_t precision = read_byte(self);
+    self->height = read_u16(self);
+    self->width = read_u16(self);
+    self->component_count = read_byte(self);
+    if (precision != 8 || (self->component_count != 1 && self->component_count != 3)) {
+        raise_unsupported();
+    }
+    if (self->width == 0 || self->height == 0 || length != 6 + 3 * self->component_count) {
+        // A height of 0 would have to be given later by a DNL marker.
+        raise_invalid();
+    }
+    self->max_h = 1;
+    self->max_v = 1;
+    for (int i = 0; i < self->component_count; i++) {
+        jpegio_component_t *c = &self->components[i];
+        c->id = read_byte(self);
+        uint8_t sampling = read_byte(self);
+        c->h = sampling >> 4;
+        c->v = sampling & 0xf;
+        c->quant = read_byte(self);
+        if (c->h < 1 || c->h > 4 || c->v < 1 || c->v > 4 || c->quant > 3) {
+            raise_invalid();
+        }
+        self->max_h = MAX(self->max_h, c->h);
+        self->max_v = MAX(self->max_v, c->v);
+    }
+    int blocks = 0;
+    for (int i = 0; i < self->component_count; i++) {
+        jpegio_component_t *c = &self->components[i];
+        // Only sampling factors that divide evenly into each other are handled.
+        int h_ratio = self->max_h / c->h;
+        int v_ratio = self->max_v / c->v;
+        if (h_ratio * c->h != self->max_h || v_ratio * c->v != self->max_v ||
+            (h_ratio & (h_ratio - 1)) || (v_ratio & (v_ratio - 1))) {
+            raise_unsupported();
+        }
+        c->x_shift = h_ratio == 4 ? 2 : h_ratio - 1;
+        c->y_shift = v_ratio == 4 ? 2 : v_ratio - 1;
+        blocks += c->h * c->v;
+    }
+    if (blocks > MAX_BLOCKS_PER_MCU) {
+        raise_invalid();
+    }
+}
+
+STATIC void read_scan_header(jpegio_jpegdecoder_obj_t *self, int length) {
+    uint8_t count = read_byte(self);
+    if (count != self->component_count) {
+        // Each component in a scan of its own is valid, but rare enough not to support.
+        raise_unsupported();
+    }
+    if (length != 4 + 2 * count) {
+        raise_invalid();
+    }
+    for (int i = 0; i < count; i++) {
+        uint8_t id = read_byte(self);
+        uint8_t tables = read_byte(self);
+        jpegio_component_t *c = &self->components[i];
+        if (c->id != id) {
+            raise_unsupported();
+        }
+        c->dc_table = tables >> 4;
+        c->ac_table = tables & 0xf;
+        if (c->dc_table > 1 || c->ac_table > 1) {
+            raise_invalid();
+        }
+    }
+    // Spectral selection and successive approximation are fixed for baseline images.
+    skip_bytes(self, 3);
+}
+
+void common_hal_jpegio_jpegdecoder_construct(jpegio_jpegdecoder_obj_t *self) {
+    self->source = MP_OBJ_NULL;
+    self->in_memory = false;
+    self->read_ptr = self->read_end = NULL;
+    self->ready = false;
+    self->width = 0;
+    self->height = 0;
+}
+
+void common_hal_jpegio_jpegdecoder_open(jpegio_jpegdecoder_obj_t *self, mp_obj_t source, const uint8_t *data, size_t len) {
+    self->ready = false;
+    self->width = 0;
+    self->height = 0;
+    self->source = source;
+    self->in_memory = data != NULL;
+    if (data) {
+        self->read_ptr = data;
+        self->read_end = data + len;
+    } else {
+        self->read_ptr = self->read_end = NULL;
+    }
+
+    if (read_marker(self) != MARKER_SOI) {
+        raise_invalid();
+    }
+    self->restart_interval = 0;
+    self->component_count = 0;
+    for (;;) {
+        uint8_t marker = read_marker(self);
+        if (marker == MARKER_EOI || (marker >= MARKER_RST0 && marker <= MARKER_RST7)) {
+            raise_invalid();
+        }
+        int length = read_u16(self) - 2;
+        if (length < 0) {
+            raise_invalid();
+        }
+        switch (marker) {
+            case MARKER_SOF0:
+            case MARKER_SOF1:
+                read_frame(self, length);
+                break;
+            case MARKER_DHT:
+                read_huffman_tables(self, length);
+                break;
+            case MARKER_DQT:
+                read_quant_tables(self, length);
+                break;
+            case MARKER_DRI:
+                if (length != 2) {
+                    raise_invalid();
+                }
+                self->restart_interval = read_u16(self);
+                break;
+            case MARKER_SOS:
+                if (self->component_count == 0) {
+                    raise_invalid();
+                }
+                read_scan_header(self, length);
+                self->ready = true;
+                return;
+            default:
+                if (marker >= MARKER_SOF0 && marker <= MARKER_SOF15 && marker != MARKER_JPG && marker != MARKER_DAC) {
+                    // Progressive, lossless and arithmetic coded frames
+                    raise_unsupported();
+                }
+                // Application data and comments
+                skip_bytes(self, length);
+                break;
+        }
+    }
+}
+
+// Keeps at least 25 bits in the bit buffer. Once a marker is reached, zeros are fed in.
+STATIC void fill_bits(jpegio_jpegdecoder_obj_t *self) {
+    while (self->bit_count <= 24) {
+        uint32_t value = 0;
+        if (!self->marker) {
+            value = read_byte(self);
+            if (value == 0xff) {
+                uint8_t next = read_byte(self);
+                while (next == 0xff) {
+                    next = read_byte(self);
+                }
+                if (next != 0) {
+                    self->marker = next;
+                    value = 0;
+                }
+            }
+        }
+        self->bit_buffer |= value << (24 - self->bit_count);
+        self->bit_count += 8;
+    }
+}
+
+static inline void consume_bits(jpegio_jpegdecoder_obj_t *self, int count) {
+    self->bit_buffer <<= count;
+    self->bit_count -= count;
+}
+
+STATIC uint8_t decode_huffman(jpegio_jpegdecoder_obj_t *self, const jpegio_huffman_t *h) {
+    fill_bits(self);
+    uint32_t peek = self->bit_buffer >> (32 - JPEGIO_HUFFMAN_LOOKUP_BITS);
+    uint8_t length = h->lookup_length[peek];
+    if (length) {
+        consume_bits(self, length);
+        return h->lookup_value[peek];
+    }
+    for (int len = JPEGIO_HUFFMAN_LOOKUP_BITS + 1; len <= 16; len++) {
+        int32_t code = self->bit_buffer >> (32 - len);
+        if (code <= h->maxcode[len]) {
+            consume_bits(self, len);
+            return h->values[h->valptr[len] + code - h->mincode[len]];
+        }
+    }
+    raise_invalid();
+}
+
+// Reads a magnitude category's worth of bits as a signed value.
+STATIC int32_t receive_extend(jpegio_jpegdecoder_obj_t *self, int size) {
+    if (size == 0) {
+        return 0;
+    }
+    fill_bits(self);
+    int32_t value = self->bit_buffer >> (32 - size);
+    consume_bits(self, size);
+    if (value < (1 << (size - 1))) {
+        value -= (1 << size) - 1;
+    }
+    return value;
+}
+
+// Decodes one block of dequantized coefficients in natural order. With dc_only
+// only the DC term is stored, though the whole block still has to be read.
+STATIC void decode_block(jpegio_jpegdecoder_obj_t *self, jpegio_component_t *c, int32_t *coef, bool dc_only) {
+    const uint16_t *quant = self->quant[c->quant];
+    const jpegio_huffman_t *ac = &self->huffman[1][c->ac_table];
+
+    int size = decode_huffman(self, &self->huffman[0][c->dc_table]);
+    if (size > 11) {
+        raise_invalid();
+    }
+    c->dc_pred += receive_extend(self, size);
+    coef[0] = c->dc_pred * quant[0];
+
+    for (int k = 1; k < 64;) {
+        uint8_t rs = decode_huffman(self, ac);
+        int run = rs >> 4;
+        size = rs & 0xf;
+        if (size == 0) {
+            if (run != 15) {
+                // End of block
+                break;
+            }
+            k += 16;
+            continue;
+        }
+        k += run;
+        if (k > 63) {
+            raise_invalid();
+        }
+        int32_t value = receive_extend(self, size);
+        if (!dc_only) {
+            coef[zigzag[k]] = value * quant[k];
+        }
+        k++;
+    }
+}
+
+static inline uint8_t clamp_sample(int32_t value) {
+    return value < 0 ? 0 : value > 255 ? 255 : value;
+}
+
+// Fixed point constants for the inverse DCT, scaled by 4096.
+#define IDCT_F(x) ((int32_t)((x) * 4096 + 0.5))
+
+// One dimension of the inverse DCT, after Loeffler, Ligtenberg and Moschytz, which
+// uses 12 multiplications. The outputs are scaled up by 8 * 4096.
+STATIC void idct_1d(const int32_t *in, int stride, int32_t *out) {
+    int32_t s0 = in[0], s1 = in[stride], s2 = in[2 * stride], s3 = in[3 * stride];
+    int32_t s4 = in[4 * stride], s5 = in[5 * stride], s6 = in[6 * stride], s7 = in[7 * stride];
+
+    // Even part
+    int32_t p1 = (s2 + s6) * IDCT_F(0.5411961);
+    int32_t t2 = p1 + s6 * IDCT_F(-1.847759065);
+    int32_t t3 = p1 + s2 * IDCT_F(0.765366865);
+    int32_t t0 = (s0 + s4) * 4096;
+    int32_t t1 = (s0 - s4) * 4096;
+    int32_t x0 = t0 + t3;
+    int32_t x3 = t0 - t3;
+    int32_t x1 = t1 + t2;
+    int32_t x2 = t1 - t2;
+
+    // Odd part
+    int32_t p3 = s7 + s3;
+    int32_t p4 = s5 + s1;
+    p1 = s7 + s1;
+    int32_t p2 = s5 + s3;
+    int32_t p5 = (p3 + p4) * IDCT_F(1.175875602);
+    t0 = s7 * IDCT_F(0.298631336);
+    t1 = s5 * IDCT_F(2.053119869);
+    t2 = s3 * IDCT_F(3.072711026);
+    t3 = s1 * IDCT_F(1.501321110);
+    p1 = p5 + p1 * IDCT_F(-0.899976223);
+    p2 = p5 + p2 * IDCT_F(-2.562915447);
+    p3 = p3 * IDCT_F(-1.961570560);
+    p4 = p4 * IDCT_F(-0.390180644);
+    t3 += p1 + p4;
+    t2 += p2 + p3;
+    t1 += p2 + p4;
+    t0 += p1 + p3;
+
+    out[0] = x0 + t3;
+    out[7] = x0 - t3;
+    out[1] = x1 + t2;
+    out[6] = x1 - t2;
+    out[2] = x2 + t1;
+    out[5] = x2 - t1;
+    out[3] = x3 + t0;
+    out[4] = x3 - t0;
+}
+
+// Turns dequantized coefficients into samples, averaging each rectangle of
+// (1 << x_scale) by (1 << y_scale) samples into one.
+STATIC void idct_block(int32_t *coef, uint8_t *samples, int x_scale, int y_scale) {
+    if (x_scale == 3 && y_scale == 3) {
+        samples[0] = clamp_sample(((coef[0] + 4) >> 3) + 128);
+        return;
+    }
+
+    int32_t out[8];
+    // Columns, keeping two extra bits of precision
+    for (int i = 0; i < 8; i++) {
+        if (!(coef[i + 8] | coef[i + 16] | coef[i + 24] | coef[i + 32] | coef[i + 40] | coef[i + 48] | coef[i + 56])) {
+            int32_t dc = coef[i] * 4;
+            for (int j = 0; j < 8; j++) {
+                coef[i + 8 * j] = dc;
+            }
+            continue;
+        }
+        idct_1d(coef + i, 8, out);
+        for (int j = 0; j < 8; j++) {
+            coef[i + 8 * j] = (out[j] + 512) >> 10;
+        }
+    }
+    // Rows, removing the remaining scaling and the level shift
+    uint8_t pixels[64];
+    for (int j = 0; j < 8; j++) {
+        idct_1d(coef + 8 * j, 1, out);
+        for (int i = 0; i < 8; i++) {
+            pixels[8 * j + i] = clamp_sample((out[i] + 65536 + (128 << 17)) >> 17);
+        }
+    }
+
+    if (x_scale == 0 && y_scale == 0) {
+        memcpy(samples, pixels, sizeof(pixels));
+        return;
+    }
+    int width = 8 >> x_scale;
+    int height = 8 >> y_scale;
+    int nx = 1 << x_scale;
+    int ny = 1 << y_scale;
+    int shift = x_scale + y_scale;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint32_t sum = 0;
+            for (int j = 0; j < ny; j++) {
+                for (int i = 0; i < nx; i++) {
+                    sum += pixels[(y * ny + j) * 8 + x * nx + i];
+                }
+            }
+            samples[y * width + x] = (sum + (1 << (shift - 1))) >> shift;
+        }
+    }
+}
+
+static inline uint16_t ycbcr_to_rgb565(int32_t y, int32_t cb, int32_t cr) {
+    // ITU-R BT.601 full range, as used by JFIF, in 16.16 fixed point
+    cb -= 128;
+    cr -= 128;
+    y = (y << 16) + 32768;
+    uint8_t r = clamp_sample((y + 91881 * cr) >> 16);
+    uint8_t g = clamp_sample((y - 22554 * cb - 46802 * cr) >> 16);
+    uint8_t b = clamp_sample((y + 116130 * cb) >> 16);
+    return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+}
+
+// Finds the sample for MCU pixel (mx, my) among the blocks of component c, which start at first.
+static inline uint8_t component_sample(uint8_t (*samples)[64], const jpegio_component_t *c, int first, int mx, int my) {
+    int cx = mx >> c->pixel_x_shift;
+    int cy = my >> c->pixel_y_shift;
+    int block = first + (cy >> c->block_y_shift) * c->h + (cx >> c->block_x_shift);
+    int index = ((cy & ((1 << c->block_y_shift) - 1)) << c->block_x_shift) + (cx & ((1 << c->block_x_shift) - 1));
+    return samples[block][index];
+}
+
+// Moves past a restart marker and resets the state it covers.
+STATIC void restart(jpegio_jpegdecoder_obj_t *self) {
+    if (!self->marker) {
+        // Discard the padding bits, then look for the marker.
+        self->bit_buffer = 0;
+        self->bit_count = 0;
+        self->marker = read_marker(self);
+    }
+    if (self->marker < MARKER_RST0 || self->marker > MARKER_RST7) {
+        raise_invalid();
+    }
+    self->marker = 0;
+    self->bit_buffer = 0;
+    self->bit_count = 0;
+    for (int i = 0; i < self->component_count; i++) {
+        self->components[i].dc_pred = 0;
+    }
+}
+
+void common_hal_jpegio_jpegdecoder_decode(jpegio_jpegdecoder_obj_t *self, displayio_bitmap_t *bitmap, int scale, int16_t x, int16_t y) {
+    if (!self->ready) {
+        mp_raise_RuntimeError(translate("Invalid state"));
+    }
+    // The scan can only be read once.
+    self->ready = false;
+
+    int out_width = (self->width + (1 << scale) - 1) >> scale;
+    int out_height = (self->height + (1 << scale) - 1) >> scale;
+    displayio_area_t area = { x, y, x + out_width, y + out_height, NULL };
+    displayio_area_t bitmap_area = { 0, 0, bitmap->width, bitmap->height, NULL };
+    bool visible = displayio_area_compute_overlap(&area, &bitmap_area, &area);
+    if (visible) {
+        displayio_bitmap_set_dirty_area(bitmap, &area);
+    }
+
+    self->bit_buffer = 0;
+    self->bit_count = 0;
+    self->marker = 0;
+    for (int i = 0; i < self->component_count; i++) {
+        jpegio_component_t *c = &self->components[i];
+        c->dc_pred = 0;
+        // Subsampled components lose less of their resolution when the image is reduced.
+        int x_scale = MAX(scale - c->x_shift, 0);
+        int y_scale = MAX(scale - c->y_shift, 0);
+        c->pixel_x_shift = MAX(c->x_shift - scale, 0);
+        c->pixel_y_shift = MAX(c->y_shift - scale, 0);
+        c->block_x_shift = 3 - x_scale;
+        c->block_y_shift = 3 - y_scale;
+    }
+
+    int mcu_width = (8 >> scale) * self->max_h;
+    int mcu_height = (8 >> scale) * self->max_v;
+    int mcus_x = (self->width + 8 * self->max_h - 1) / (8 * self->max_h);
+    int mcus_y = (self->height + 8 * self->max_v - 1) / (8 * self->max_v);
+
+    int32_t coef[64];
+    uint8_t samples[MAX_BLOCKS_PER_MCU][64];
+    int restarts_left = self->restart_interval;
+
+    for (int mcu_y = 0; mcu_y < mcus_y; mcu_y++) {
+        for (int mcu_x = 0; mcu_x < mcus_x; mcu_x++) {
+            if (self->restart_interval) {
+                if (restarts_left == 0) {
+                    restart(self);
+                    restarts_left = self->restart_interval;
+                }
+                restarts_left--;
+            }
+
+            int block = 0;
+            for (int i = 0; i < self->component_count; i++) {
+                jpegio_component_t *c = &self->components[i];
+                bool dc_only = c->block_x_shift == 0 && c->block_y_shift == 0;
+                for (int b = 0; b < c->h * c->v; b++) {
+                    memset(coef, 0, sizeof(coef));
+                    decode_block(self, c, coef, dc_only);
+                    idct_block(coef, samples[block++], 3 - c->block_x_shift, 3 - c->block_y_shift);
+                }
+            }
+
+            if (!visible) {
+                continue;
+            }
+            // Convert the MCU's pixels that land in the bitmap.
+            int left = x + mcu_x * mcu_width;
+            int top = y + mcu_y * mcu_height;
+            int x_start = MAX(area.x1, left), x_end = MIN(area.x2, left + mcu_width);
+            int y_start = MAX(area.y1, top), y_end = MIN(area.y2, top + mcu_height);
+            const jpegio_component_t *c = self->components;
+            int cb_first = c[0].h * c[0].v;
+            int cr_first = self->component_count == 3 ? cb_first + c[1].h * c[1].v : 0;
+            for (int py = y_start; py < y_end; py++) {
+                uint16_t *row = (uint16_t *)displayio_bitmap_get_row(bitmap, py);
+                int my = py - top;
+                for (int px = x_start; px < x_end; px++) {
+                    int mx = px - left;
+                    uint8_t luma = component_sample(samples, &c[0], 0, mx, my);
+                    if (self->component_count == 1) {
+                        row[px] = ((luma & 0xf8) << 8) | ((luma & 0xfc) << 3) | (luma >> 3);
+                    } else {
+                        row[px] = ycbcr_to_rgb565(luma,
+                            component_sample(samples, &c[1], cb_first, mx, my),
+                            component_sample(samples, &c[2], cr_first, mx, my));
+                    }
+                }
+            }
+        }
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/displayio/Bitmap.h"
+
+#ifndef JPEGIO_INBUF_SIZE
+#define JPEGIO_INBUF_SIZE (256)
+#endif
+
+// Codes up to this many bits long are decoded with a single table lookup.
+#define JPEGIO_HUFFMAN_LOOKUP_BITS (8)
+
+typedef struct {
+    uint8_t lookup_length[1 << JPEGIO_HUFFMAN_LOOKUP_BITS];
+    uint8_t lookup_value[1 << JPEGIO_HUFFMAN_LOOKUP_BITS];
+    int32_t maxcode[17];
+    uint16_t mincode[17];
+    uint8_t valptr[17];
+    uint8_t values[256];
+} jpegio_huffman_t;
+
+typedef struct {
+    uint8_t id;
+    uint8_t h;
+    uint8_t v;
+    uint8_t quant;
+    uint8_t dc_table;
+    uint8_t ac_table;
+    uint8_t x_shift; // log2(max_h / h)
+    uint8_t y_shift; // log2(max_v / v)
+    // Set for each decode: how far samples are spread over output pixels, and the
+    // log2 size of the sample block each 8x8 block is reduced to.
+    uint8_t pixel_x_shift;
+    uint8_t pixel_y_shift;
+    uint8_t block_x_shift;
+    uint8_t block_y_shift;
+    int32_t dc_pred;
+} jpegio_component_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t source; // stream, or object whose buffer is being read
+    bool in_memory;
+    const uint8_t *read_ptr;
+    const uint8_t *read_end;
+    uint32_t bit_buffer;
+    int8_t bit_count;
+    uint8_t marker; // marker met inside entropy coded data, or 0
+    bool ready; // headers have been read and the scan is next
+    uint16_t width;
+    uint16_t height;
+    uint16_t restart_interval;
+    uint8_t component_count;
+    uint8_t max_h;
+    uint8_t max_v;
+    jpegio_component_t components[3];
+    uint16_t quant[4][64]; // in zigzag order
+    jpegio_huffman_t huffman[2][2]; // [DC/AC][table]
+    uint8_t inbuf[JPEGIO_INBUF_SIZE];
+} jpegio_jpegdecoder_obj_t;
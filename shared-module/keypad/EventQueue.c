@@ -33,9 +33,12 @@
 #define EVENT_PRESSED (1 << 15)
 #define EVENT_KEY_NUM_MASK ((1 << 15) - 1)
 
+// Each event is a 16-bit encoded key and a 32-bit timestamp. Objects are only made
+// when an event is fetched.
+#define EVENT_SIZE (sizeof(uint16_t) + sizeof(uint32_t))
+
 void common_hal_keypad_eventqueue_construct(keypad_eventqueue_obj_t *self, size_t max_events) {
-    // Event queue is 16-bit values.
-    ringbuf_alloc(&self->encoded_events, max_events * (sizeof(uint16_t) + sizeof(mp_obj_t)), false);
+    ringbuf_alloc(&self->encoded_events, max_events * EVENT_SIZE, false);
     self->overflowed = false;
 }
 
@@ -45,10 +48,10 @@ bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad
         return false;
     }
 
-    mp_obj_t ticks;
+    uint32_t ticks;
     ringbuf_get_n(&self->encoded_events, (uint8_t *)&ticks, sizeof(ticks));
     // "Construct" using the existing event.
-    common_hal_keypad_event_construct(event, encoded_event & EVENT_KEY_NUM_MASK, encoded_event & EVENT_PRESSED, ticks);
+    common_hal_keypad_event_construct(event, encoded_event & EVENT_KEY_NUM_MASK, encoded_event & EVENT_PRESSED, mp_obj_new_int_from_uint(ticks));
     return true;
 }
 
@@ -77,11 +80,11 @@ void common_hal_keypad_eventqueue_clear(keypad_eventqueue_obj_t *self) {
 }
 
 size_t common_hal_keypad_eventqueue_get_length(keypad_eventqueue_obj_t *self) {
-    return ringbuf_num_filled(&self->encoded_events);
+    return ringbuf_num_filled(&self->encoded_events) / EVENT_SIZE;
 }
 
-bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, mp_obj_t timestamp) {
-    if (ringbuf_num_empty(&self->encoded_events) == 0) {
+bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, uint32_t timestamp) {
+    if (ringbuf_num_empty(&self->encoded_events) < EVENT_SIZE) {
         // Queue is full. Set the overflow flag. The caller will decide what else to do.
         common_hal_keypad_eventqueue_set_overflowed(self, true);
         return false;
@@ -92,7 +95,7 @@ bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_numbe
         encoded_event |= EVENT_PRESSED;
     }
     ringbuf_put16(&self->encoded_events, encoded_event);
-    ringbuf_put_n(&self->encoded_events, (uint8_t *)&timestamp, sizeof(mp_obj_t));
+    ringbuf_put_n(&self->encoded_events, (uint8_t *)&timestamp, sizeof(timestamp));
 
     return true;
 }
@@ -37,7 +37,7 @@
 #include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
 
-static void keymatrix_scan_now(void *self_in, mp_obj_t timestamp);
+static void keymatrix_scan_now(void *self_in, uint32_t timestamp);
 static size_t keymatrix_get_key_count(void *self_in);
 
 static keypad_scanner_funcs_t keymatrix_funcs = {
@@ -123,7 +123,7 @@ static size_t keymatrix_get_key_count(void *self_in) {
     return common_hal_keypad_keymatrix_get_column_count(self) * common_hal_keypad_keymatrix_get_row_count(self);
 }
 
-static void keymatrix_scan_now(void *self_in, mp_obj_t timestamp) {
+static void keymatrix_scan_now(void *self_in, uint32_t timestamp) {
     keypad_keymatrix_obj_t *self = self_in;
 
     // On entry, all pins are set to inputs with a pull-up or pull-down,
@@ -36,7 +36,7 @@
 #include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
 
-static void keypad_keys_scan_now(void *self_in, mp_obj_t timestamp);
+static void keypad_keys_scan_now(void *self_in, uint32_t timestamp);
 static size_t keys_get_key_count(void *self_in);
 
 static keypad_scanner_funcs_t keys_funcs = {
@@ -88,7 +88,7 @@ size_t keys_get_key_count(void *self_in) {
     return self->digitalinouts->len;
 }
 
-static void keypad_keys_scan_now(void *self_in, mp_obj_t timestamp) {
+static void keypad_keys_scan_now(void *self_in, uint32_t timestamp) {
     keypad_keys_obj_t *self = self_in;
     size_t key_count = keys_get_key_count(self);
 
@@ -36,7 +36,7 @@
 #include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
 
-static void shiftregisterkeys_scan_now(void *self, mp_obj_t timestamp);
+static void shiftregisterkeys_scan_now(void *self, uint32_t timestamp);
 static size_t shiftregisterkeys_get_key_count(void *self);
 
 static keypad_scanner_funcs_t shiftregisterkeys_funcs = {
@@ -99,7 +99,7 @@ size_t shiftregisterkeys_get_key_count(void *self_in) {
     return self->key_count;
 }
 
-static void shiftregisterkeys_scan_now(void *self_in, mp_obj_t timestamp) {
+static void shiftregisterkeys_scan_now(void *self_in, uint32_t timestamp) {
     keypad_shiftregisterkeys_obj_t *self = self_in;
 
     // Latch (freeze) the current state of the input pins.
@@ -118,7 +118,9 @@ void keypad_construct_common(keypad_scanner_obj_t *self, mp_float_t interval, si
 
 static void keypad_scan_now(keypad_scanner_obj_t *self, uint64_t now) {
     self->next_scan_ticks = now + self->interval_ticks;
-    self->funcs->scan_now(self, supervisor_ticks_ms());
+    // Same as supervisor.ticks_ms(), but without making an object on every scan.
+    uint32_t timestamp = ((now * 1000 / 1024) + 0x1fff0000) % (1 << 29);
+    self->funcs->scan_now(self, timestamp);
 }
 
 static void keypad_scan_maybe(keypad_scanner_obj_t *self, uint64_t now) {
@@ -31,7 +31,8 @@
 #include "supervisor/shared/lock.h"
 
 typedef struct _keypad_scanner_funcs_t {
-    void (*scan_now)(void *self_in, mp_obj_t timestamp);
+    // timestamp is in the form returned by supervisor.ticks_ms().
+    void (*scan_now)(void *self_in, uint32_t timestamp);
     size_t (*get_key_count)(void *self_in);
 } keypad_scanner_funcs_t;
 
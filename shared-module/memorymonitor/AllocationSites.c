@@ -0,0 +1,156 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "shared-bindings/memorymonitor/AllocationSites.h"
+
+#include "py/bc.h"
+#include "py/gc.h"
+#include "py/mpstate.h"
+#include "py/objfun.h"
+#include "py/runtime.h"
+
+void common_hal_memorymonitor_allocationsites_construct(memorymonitor_allocationsites_obj_t *self, uint16_t max_sites) {
+    self->sites = m_new(memorymonitor_allocationsite_t, max_sites);
+    self->slots = m_new(uint16_t, 2 * max_sites);
+    self->max_sites = max_sites;
+    common_hal_memorymonitor_allocationsites_clear(self);
+    self->next = NULL;
+    self->previous = NULL;
+}
+
+void common_hal_memorymonitor_allocationsites_pause(memorymonitor_allocationsites_obj_t *self) {
+    *self->previous = self->next;
+    self->next = NULL;
+    self->previous = NULL;
+}
+
+void common_hal_memorymonitor_allocationsites_resume(memorymonitor_allocationsites_obj_t *self) {
+    if (self->previous != NULL) {
+        mp_raise_RuntimeError(translate("Already running"));
+    }
+    self->next = MP_STATE_VM(active_allocationsites);
+    self->previous = (memorymonitor_allocationsites_obj_t **)&MP_STATE_VM(active_allocationsites);
+    if (self->next != NULL) {
+        self->next->previous = &self->next;
+    }
+    MP_STATE_VM(active_allocationsites) = self;
+}
+
+void common_hal_memorymonitor_allocationsites_clear(memorymonitor_allocationsites_obj_t *self) {
+    memset(self->slots, 0, 2 * self->max_sites * sizeof(uint16_t));
+    self->len = 0;
+    self->dropped = 0;
+}
+
+uint16_t common_hal_memorymonitor_allocationsites_get_len(memorymonitor_allocationsites_obj_t *self) {
+    return self->len;
+}
+
+const memorymonitor_allocationsite_t *common_hal_memorymonitor_allocationsites_get_item(memorymonitor_allocationsites_obj_t *self, uint16_t index) {
+    return &self->sites[index];
+}
+
+uint32_t common_hal_memorymonitor_allocationsites_get_dropped(memorymonitor_allocationsites_obj_t *self) {
+    return self->dropped;
+}
+
+// Fill in the function and line of the innermost running Python code, in
+// the same way as the VM does for tracebacks.
+STATIC void get_current_site(memorymonitor_allocationsite_t *site) {
+    site->source_file = MP_QSTRnull;
+    site->block_name = MP_QSTRnull;
+    site->line = 0;
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        return;
+    }
+    const byte *ip = code_state->fun_bc->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *bytecode_start = ip + n_info + n_cell;
+    #if !MICROPY_PERSISTENT_CODE
+    // so bytecode is aligned
+    bytecode_start = MP_ALIGN(bytecode_start, sizeof(mp_uint_t));
+    #endif
+    size_t bc = code_state->ip - bytecode_start;
+    #if MICROPY_PERSISTENT_CODE
+    site->block_name = ip[0] | (ip[1] << 8);
+    site->source_file = ip[2] | (ip[3] << 8);
+    ip += 4;
+    #else
+    site->block_name = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip);
+    site->source_file = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip);
+    #endif
+    site->line = mp_bytecode_get_source_line(ip, bc);
+}
+
+STATIC void record(memorymonitor_allocationsites_obj_t *self, const memorymonitor_allocationsite_t *site, size_t hash, uint32_t bytes) {
+    size_t slot_count = 2 * self->max_sites;
+    size_t slot = hash % slot_count;
+    // There are always free slots, so the search ends.
+    while (self->slots[slot] != 0) {
+        memorymonitor_allocationsite_t *existing = &self->sites[self->slots[slot] - 1];
+        if (existing->line == site->line &&
+            existing->block_name == site->block_name &&
+            existing->source_file == site->source_file) {
+            existing->count++;
+            existing->bytes += bytes;
+            return;
+        }
+        slot = (slot + 1) % slot_count;
+    }
+    if (self->len == self->max_sites) {
+        self->dropped++;
+        return;
+    }
+    memorymonitor_allocationsite_t *new_site = &self->sites[self->len++];
+    *new_site = *site;
+    new_site->count = 1;
+    new_site->bytes = bytes;
+    self->slots[slot] = self->len;
+}
+
+void memorymonitor_allocationsites_track_allocation(size_t block_count) {
+    memorymonitor_allocationsites_obj_t *as = MP_OBJ_TO_PTR(MP_STATE_VM(active_allocationsites));
+    if (as == NULL) {
+        return;
+    }
+    memorymonitor_allocationsite_t site;
+    get_current_site(&site);
+    size_t hash = (site.source_file * 31 + site.block_name) * 31 + site.line;
+    while (as != NULL) {
+        record(as, &site, hash, block_count * BYTES_PER_BLOCK);
+        as = as->next;
+    }
+}
+
+void memorymonitor_allocationsites_reset(void) {
+    MP_STATE_VM(active_allocationsites) = NULL;
+}
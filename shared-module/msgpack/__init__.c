@@ -26,6 +26,7 @@
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/binary.h"
@@ -44,26 +45,119 @@
 ////////////////////////////////////////////////////////////////
 // stream management
 
+// Number of recently unpacked map keys remembered, so that records repeating
+// the same keys share one str object for each instead of allocating a new one.
+#define MSGPACK_KEY_CACHE_SIZE (16)
+
+// Seekable streams are read this many bytes at a time rather than one field
+// at a time; whatever is left over is seeked back over after unpacking.
+#define MSGPACK_READ_AHEAD_SIZE (64)
+
 typedef struct _msgpack_stream_t {
     mp_obj_t stream_obj;
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     mp_uint_t (*write)(mp_obj_t obj, const void *buf, mp_uint_t size, int *errcode);
+    mp_uint_t (*ioctl)(mp_obj_t obj, mp_uint_t request, uintptr_t arg, int *errcode);
     int errcode;
+    // When buffered, input is taken from data: either the whole of a
+    // bytes-like object being unpacked, or the read_ahead buffer.
+    bool buffered;
+    const byte *data;
+    size_t data_len;
+    size_t data_pos;
+    byte *read_ahead;
+    // For bin_as_memoryview, the start of the memory holding data, and the
+    // offset of data from it.
+    void *view_items;
+    size_t view_offset;
+    bool bin_as_memoryview;
+    mp_obj_t key_cache[MSGPACK_KEY_CACHE_SIZE];
 } msgpack_stream_t;
 
 STATIC msgpack_stream_t get_stream(mp_obj_t stream_obj, int flags) {
     const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, flags);
-    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0};
+    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, stream_p->ioctl, 0};
     return s;
 }
 
+STATIC bool stream_seek(msgpack_stream_t *s, mp_off_t offset) {
+    struct mp_stream_seek_t seek = { .offset = offset, .whence = MP_SEEK_CUR };
+    int errcode;
+    return s->ioctl(s->stream_obj, MP_STREAM_SEEK, (uintptr_t)&seek, &errcode) != MP_STREAM_ERROR;
+}
+
+// Read ahead only from streams that can seek back over unused data, so that
+// unpacking never consumes bytes after the object from a socket or UART.
+STATIC void enable_read_ahead(msgpack_stream_t *s, byte *read_ahead) {
+    if (s->ioctl == NULL) {
+        return;
+    }
+    // Streams implemented in Python may raise rather than report an error.
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        bool seekable = stream_seek(s, 0);
+        nlr_pop();
+        if (!seekable) {
+            return;
+        }
+    } else {
+        return;
+    }
+    s->buffered = true;
+    s->read_ahead = read_ahead;
+    s->data = read_ahead;
+    s->data_len = 0;
+    s->data_pos = 0;
+}
+
 ////////////////////////////////////////////////////////////////
 // readers
 
+STATIC void read_buffered(msgpack_stream_t *s, byte *dest, mp_uint_t size) {
+    mp_uint_t copied = 0;
+    while (copied < size) {
+        if (s->data_pos == s->data_len) {
+            mp_uint_t ret = 0;
+            if (s->read_ahead != NULL) {
+                // Large reads go straight to their destination.
+                bool direct = size - copied >= MSGPACK_READ_AHEAD_SIZE;
+                ret = s->read(s->stream_obj, direct ? dest + copied : s->read_ahead,
+                    direct ? size - copied : MSGPACK_READ_AHEAD_SIZE, &s->errcode);
+                if (ret == MP_STREAM_ERROR) {
+                    mp_raise_OSError(s->errcode);
+                }
+                if (direct) {
+                    copied += ret;
+                    if (ret > 0) {
+                        continue;
+                    }
+                } else {
+                    s->data_len = ret;
+                    s->data_pos = 0;
+                }
+            }
+            if (ret == 0) {
+                if (copied == 0) {
+                    mp_raise_msg(&mp_type_EOFError, NULL);
+                }
+                mp_raise_ValueError(translate("short read"));
+            }
+        }
+        size_t n = MIN(size - copied, s->data_len - s->data_pos);
+        memcpy(dest + copied, s->data + s->data_pos, n);
+        s->data_pos += n;
+        copied += n;
+    }
+}
+
 STATIC void read(msgpack_stream_t *s, void *buf, mp_uint_t size) {
     if (size == 0) {
         return;
     }
+    if (s->buffered) {
+        read_buffered(s, buf, size);
+        return;
+    }
     mp_uint_t ret = s->read(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -346,6 +440,7 @@ STATIC void pack(mp_obj_t obj, msgpack_stream_t *s, mp_obj_t default_handler) {
 // unpacker
 
 STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list);
+STATIC mp_obj_t unpack_key(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list);
 
 STATIC mp_obj_t unpack_array_elements(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook, bool use_list) {
     if (use_list) {
@@ -379,6 +474,18 @@ STATIC mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size) {
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 
+// A read-only view of the next size bytes of a bytes-like object being
+// unpacked, instead of a copy.
+STATIC mp_obj_t unpack_memoryview(msgpack_stream_t *s, size_t size) {
+    if (size > s->data_len - s->data_pos) {
+        mp_raise_ValueError(translate("short read"));
+    }
+    mp_obj_array_t *view = m_new_obj(mp_obj_array_t);
+    mp_obj_memoryview_init(view, 'B', s->view_offset + s->data_pos, size, s->view_items);
+    s->data_pos += size;
+    return MP_OBJ_FROM_PTR(view);
+}
+
 STATIC mp_obj_t unpack_ext(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook) {
     int8_t code = read1(s);
     mp_obj_t data = unpack_bytes(s, size);
@@ -393,8 +500,7 @@ STATIC mp_obj_t unpack_ext(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook)
     }
 }
 
-STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
-    uint8_t code = read1(s);
+STATIC mp_obj_t unpack_code(msgpack_stream_t *s, uint8_t code, mp_obj_t ext_hook, bool use_list) {
     if (((code & 0b10000000) == 0) || ((code & 0b11100000) == 0b11100000)) {
         // int
         return MP_OBJ_NEW_SMALL_INT((int8_t)code);
@@ -416,7 +522,8 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         size_t len = code & 0b1111;
         mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
         for (size_t i = 0; i < len; i++) {
-            mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+            mp_obj_t key = unpack_key(s, ext_hook, use_list);
+            mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
         }
         return MP_OBJ_FROM_PTR(d);
     }
@@ -431,7 +538,11 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         case 0xc5:
         case 0xc6: {
             // bin 8, 16, 32
-            return unpack_bytes(s, read_size(s, code - 0xc4));
+            size_t size = read_size(s, code - 0xc4);
+            if (s->bin_as_memoryview) {
+                return unpack_memoryview(s, size);
+            }
+            return unpack_bytes(s, size);
         }
         case 0xcc: // uint8
             return MP_OBJ_NEW_SMALL_INT((uint8_t)read1(s));
@@ -484,7 +595,8 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
             size_t len = read_size(s, code - 0xde + 1);
             mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
             for (size_t i = 0; i < len; i++) {
-                mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+                mp_obj_t key = unpack_key(s, ext_hook, use_list);
+            mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
             }
             return MP_OBJ_FROM_PTR(d);
         }
@@ -515,12 +627,61 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
     }
 }
 
+STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
+    return unpack_code(s, read1(s), ext_hook, use_list);
+}
+
+// Map keys that are short strings are read into a stack buffer and looked up
+// in the key cache before creating a str.
+STATIC mp_obj_t unpack_key(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
+    uint8_t code = read1(s);
+    if ((code & 0b11100000) != 0b10100000) {
+        return unpack_code(s, code, ext_hook, use_list);
+    }
+    size_t len = code & 0b11111;
+    char str[len];
+    read(s, &str, len);
+    mp_obj_t *entry = &s->key_cache[qstr_compute_hash((const byte *)str, len) % MSGPACK_KEY_CACHE_SIZE];
+    if (*entry != MP_OBJ_NULL) {
+        size_t cached_len;
+        const char *cached = mp_obj_str_get_data(*entry, &cached_len);
+        if (cached_len == len && memcmp(cached, str, len) == 0) {
+            return *entry;
+        }
+    }
+    *entry = mp_obj_new_str(str, len);
+    return *entry;
+}
+
 void common_hal_msgpack_pack(mp_obj_t obj, mp_obj_t stream_obj, mp_obj_t default_handler) {
     msgpack_stream_t stream = get_stream(stream_obj, MP_STREAM_OP_WRITE);
     pack(obj, &stream, default_handler);
 }
 
-mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool use_list) {
+mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool use_list, bool bin_as_memoryview) {
+    mp_buffer_info_t bufinfo;
+    if (mp_proto_get(MP_QSTR_protocol_stream, stream_obj) == NULL
+        && mp_get_buffer(stream_obj, &bufinfo, MP_BUFFER_READ)) {
+        // Parse directly from memory.
+        msgpack_stream_t s = { .buffered = true, .data = bufinfo.buf, .data_len = bufinfo.len };
+        s.view_items = bufinfo.buf;
+        if (mp_obj_is_type(stream_obj, &mp_type_memoryview)) {
+            // Refer to the start of the memory the memoryview itself refers
+            // to, which is what keeps it alive.
+            mp_obj_array_t *parent = MP_OBJ_TO_PTR(stream_obj);
+            s.view_items = parent->items;
+        }
+        s.view_offset = (byte *)bufinfo.buf - (byte *)s.view_items;
+        s.bin_as_memoryview = bin_as_memoryview;
+        return unpack(&s, ext_hook, use_list);
+    }
+
     msgpack_stream_t stream = get_stream(stream_obj, MP_STREAM_OP_READ);
-    return unpack(&stream, ext_hook, use_list);
+    byte read_ahead[MSGPACK_READ_AHEAD_SIZE];
+    enable_read_ahead(&stream, read_ahead);
+    mp_obj_t result = unpack(&stream, ext_hook, use_list);
+    if (stream.buffered && stream.data_pos < stream.data_len) {
+        stream_seek(&stream, -(mp_off_t)(stream.data_len - stream.data_pos));
+    }
+    return result;
 }
@@ -46,3 +46,7 @@ os_getenv_err_t common_hal_os_getenv_str(const char *key, char *value, size_t va
 // If any error code is returned, value is guaranteed not modified
 // An error that is not 'open' or 'not found' is printed on the repl.
 os_getenv_err_t common_hal_os_getenv_int(const char *key, mp_int_t *value);
+
+// Forget what is known about the contents of /settings.toml, because it may
+// have been written.
+void os_getenv_cache_invalidate(void);
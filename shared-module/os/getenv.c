@@ -46,6 +46,11 @@
 
 #define GETENV_PATH "/settings.toml"
 
+// Number of slots in the index of keys in GETENV_PATH; 0 disables the index.
+#ifndef CIRCUITPY_OS_GETENV_INDEX_SIZE
+#define CIRCUITPY_OS_GETENV_INDEX_SIZE (32)
+#endif
+
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
 typedef FIL file_arg;
@@ -282,6 +287,126 @@ STATIC mp_int_t read_value(file_arg *active_file, vstr_t *buf, bool *quoted) {
     }
 }
 
+#if CIRCUITPY_OS_GETENV_INDEX_SIZE > 0
+// An index of where each key's line starts in GETENV_PATH, so that a lookup
+// seeks straight to its line instead of scanning the file from the start.
+// It is built by one pass over the file on the first lookup, and rebuilt
+// when the file is written or its size, start cluster or timestamp change.
+typedef struct {
+    uint32_t hash; // 0 marks an empty slot
+    uint32_t offset;
+} getenv_index_entry_t;
+
+STATIC struct {
+    bool valid;
+    bool complete; // false if there were more keys than would fit
+    FSIZE_t size;
+    DWORD sclust;
+    WORD fdate;
+    WORD ftime;
+    getenv_index_entry_t entries[CIRCUITPY_OS_GETENV_INDEX_SIZE];
+} getenv_index;
+
+// FNV-1a, never returning 0.
+#define GETENV_HASH_INIT (2166136261u)
+#define GETENV_HASH_ADD(hash, b) (((hash) ^ (b)) * 16777619u)
+
+STATIC uint32_t getenv_hash(const char *key) {
+    uint32_t hash = GETENV_HASH_INIT;
+    while (*key) {
+        hash = GETENV_HASH_ADD(hash, (byte)*key++);
+    }
+    return hash == 0 ? 1 : hash;
+}
+
+STATIC void getenv_index_build(file_arg *active_file) {
+    memset(getenv_index.entries, 0, sizeof(getenv_index.entries));
+    getenv_index.complete = true;
+    size_t used = 0;
+    f_lseek(active_file, 0);
+    while (!is_eof(active_file)) {
+        uint32_t offset = f_tell(active_file);
+        uint8_t character = consume_whitespace(active_file);
+        if (character == '[' || character == 0) {
+            // the rest of the file is in sections, which key_matches() never reaches
+            break;
+        }
+        uint32_t hash = GETENV_HASH_INIT;
+        while (character != 0 && character != '=' && !unichar_isspace(character)) {
+            hash = GETENV_HASH_ADD(hash, character);
+            character = get_next_byte(active_file);
+        }
+        if (character != '\n' && unichar_isspace(character)) {
+            character = consume_whitespace(active_file);
+        }
+        if (character == '=') {
+            // keep a quarter of the slots empty so probes stay short and always end
+            if (used < CIRCUITPY_OS_GETENV_INDEX_SIZE * 3 / 4) {
+                if (hash == 0) {
+                    hash = 1;
+                }
+                // later copies of a key go after earlier ones, so the first one wins
+                size_t i = hash % CIRCUITPY_OS_GETENV_INDEX_SIZE;
+                while (getenv_index.entries[i].hash != 0) {
+                    i = (i + 1) % CIRCUITPY_OS_GETENV_INDEX_SIZE;
+                }
+                getenv_index.entries[i].hash = hash;
+                getenv_index.entries[i].offset = offset;
+                used++;
+            } else {
+                getenv_index.complete = false;
+            }
+        }
+        if (character != '\n') {
+            next_line(active_file);
+        }
+    }
+}
+
+// Make sure the index matches the open file; it may be left invalid if the file can't be stat'd.
+STATIC void getenv_index_update(file_arg *active_file, const char *path) {
+    FILINFO fno;
+    if (f_stat(active_file->obj.fs, path, &fno) != FR_OK) {
+        getenv_index.valid = false;
+        return;
+    }
+    if (getenv_index.valid
+        && getenv_index.size == fno.fsize
+        && getenv_index.sclust == active_file->obj.sclust
+        && getenv_index.fdate == fno.fdate
+        && getenv_index.ftime == fno.ftime) {
+        return;
+    }
+    getenv_index.size = fno.fsize;
+    getenv_index.sclust = active_file->obj.sclust;
+    getenv_index.fdate = fno.fdate;
+    getenv_index.ftime = fno.ftime;
+    // Mark it valid before building it, so a write during the build invalidates it again.
+    getenv_index.valid = true;
+    getenv_index_build(active_file);
+}
+
+STATIC os_getenv_err_t getenv_index_lookup(file_arg *active_file, const char *key, vstr_t *buf, bool *quoted) {
+    uint32_t hash = getenv_hash(key);
+    for (size_t i = hash % CIRCUITPY_OS_GETENV_INDEX_SIZE; getenv_index.entries[i].hash != 0;
+         i = (i + 1) % CIRCUITPY_OS_GETENV_INDEX_SIZE) {
+        if (getenv_index.entries[i].hash == hash) {
+            f_lseek(active_file, getenv_index.entries[i].offset);
+            if (key_matches(active_file, key)) {
+                return read_value(active_file, buf, quoted);
+            }
+        }
+    }
+    return GETENV_ERR_NOT_FOUND;
+}
+#endif
+
+void os_getenv_cache_invalidate(void) {
+    #if CIRCUITPY_OS_GETENV_INDEX_SIZE > 0
+    getenv_index.valid = false;
+    #endif
+}
+
 STATIC os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t *buf, bool *quoted) {
     file_arg active_file;
     if (!open_file(path, &active_file)) {
@@ -289,10 +414,27 @@ STATIC os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t
     }
 
     os_getenv_err_t result = GETENV_ERR_NOT_FOUND;
-    while (!is_eof(&active_file)) {
-        if (key_matches(&active_file, key)) {
-            result = read_value(&active_file, buf, quoted);
-            break;
+    #if CIRCUITPY_OS_GETENV_INDEX_SIZE > 0
+    bool scan = true;
+    if (strcmp(path, GETENV_PATH) == 0) {
+        getenv_index_update(&active_file, path);
+        if (getenv_index.valid) {
+            result = getenv_index_lookup(&active_file, key, buf, quoted);
+            // only keys that didn't fit in the index need a scan
+            scan = result == GETENV_ERR_NOT_FOUND && !getenv_index.complete;
+            if (scan) {
+                f_lseek(&active_file, 0);
+            }
+        }
+    }
+    if (scan)
+    #endif
+    {
+        while (!is_eof(&active_file)) {
+            if (key_matches(&active_file, key)) {
+                result = read_value(&active_file, buf, quoted);
+                break;
+            }
         }
     }
     close_file(&active_file);
@@ -35,3 +35,10 @@ void common_hal_paralleldisplay_parallelbus_construct_nonsequential(paralleldisp
     const mcu_pin_obj_t *write, const mcu_pin_obj_t *read, const mcu_pin_obj_t *reset, uint32_t frequency) {
     mp_raise_NotImplementedError(translate("This microcontroller only supports data0=, not data_pins=, because it requires contiguous pins."));
 }
+
+// Ports that can repeat a pattern in hardware override this. Otherwise displayio repeats it.
+__attribute__((weak))
+bool common_hal_paralleldisplay_parallelbus_send_fill(mp_obj_t self, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *pattern, uint32_t pattern_length, uint32_t count) {
+    return false;
+}
@@ -24,41 +24,59 @@
  * THE SOFTWARE.
  */
 
+#include <limits.h>
 #include <string.h>
 
 #include "py/gc.h"
+#include "py/misc.h"
+#include "py/runtime.h"
 #include "py/objnamedtuple.h"
 #include "shared-bindings/qrio/__init__.h"
 #include "shared-bindings/qrio/QRInfo.h"
 #include "shared-module/qrio/QRDecoder.h"
 
-void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height) {
+#include "lib/quirc/lib/quirc_internal.h"
+
+// Search the whole image on the next decode.
+STATIC void qrdecoder_reset_roi(qrdecoder_qrdecoder_obj_t *self) {
+    self->roi_x = 0;
+    self->roi_y = 0;
+    self->roi_width = self->width;
+    self->roi_height = self->height;
+}
+
+STATIC void qrdecoder_resize(qrdecoder_qrdecoder_obj_t *self) {
+    quirc_resize(self->quirc, self->width / self->scale, self->height / self->scale);
+    qrdecoder_reset_roi(self);
+}
+
+void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height, int scale, bool track) {
     self->quirc = quirc_new();
-    quirc_resize(self->quirc, width, height);
+    self->width = width;
+    self->height = height;
+    self->scale = scale;
+    self->track = track;
+    qrdecoder_resize(self);
 }
 
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *self) {
-    int height;
-    quirc_begin(self->quirc, NULL, &height);
-    return height;
+    return self->height;
 }
 
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *self) {
-    int width;
-    quirc_begin(self->quirc, &width, NULL);
-    return width;
+    return self->width;
 }
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *self, int height) {
-    if (height != shared_module_qrio_qrdecoder_get_height(self)) {
-        int width = shared_module_qrio_qrdecoder_get_width(self);
-        quirc_resize(self->quirc, width, height);
+    if (height != self->height) {
+        self->height = height;
+        qrdecoder_resize(self);
     }
 }
 
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *self, int width) {
-    if (width != shared_module_qrio_qrdecoder_get_width(self)) {
-        int height = shared_module_qrio_qrdecoder_get_height(self);
-        quirc_resize(self->quirc, width, height);
+    if (width != self->width) {
+        self->width = width;
+        qrdecoder_resize(self);
     }
 }
 
@@ -98,49 +116,120 @@ STATIC mp_obj_t data_type(int type) {
     return mp_obj_new_int(type);
 }
 
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    int width, height;
-    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
-    uint8_t *src = bufinfo->buf;
-
-    switch (policy) {
-        case QRIO_RGB565: {
-            uint16_t *src16 = bufinfo->buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (src16[i] >> 3) & 0xfc;
+// Convert the region of interest to grayscale, keeping one pixel out of each
+// scale x scale block, straight into quirc's image.
+STATIC void qrdecoder_convert(qrdecoder_qrdecoder_obj_t *self, uint8_t *framebuffer, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
+    int scale = self->scale;
+    int width = self->roi_width / scale;
+    int height = self->roi_height / scale;
+
+    for (int y = 0; y < height; y++) {
+        int start = (self->roi_y + y * scale) * self->width + self->roi_x;
+        uint8_t *dest = framebuffer + y * width;
+        switch (policy) {
+            case QRIO_RGB565: {
+                const uint16_t *src16 = (const uint16_t *)bufinfo->buf + start;
+                for (int x = 0; x < width; x++) {
+                    dest[x] = (src16[x * scale] >> 3) & 0xfc;
+                }
+                break;
             }
-            break;
-        }
-        case QRIO_RGB565_SWAPPED: {
-            uint16_t *src16 = bufinfo->buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
+            case QRIO_RGB565_SWAPPED: {
+                const uint16_t *src16 = (const uint16_t *)bufinfo->buf + start;
+                for (int x = 0; x < width; x++) {
+                    dest[x] = (__builtin_bswap16(src16[x * scale]) >> 3) & 0xfc;
+                }
+                break;
+            }
+            case QRIO_EVERY_BYTE: {
+                const uint8_t *src = (const uint8_t *)bufinfo->buf + start;
+                if (scale == 1) {
+                    memcpy(dest, src, width);
+                } else {
+                    for (int x = 0; x < width; x++) {
+                        dest[x] = src[x * scale];
+                    }
+                }
+                break;
+            }
+            case QRIO_ODD_BYTES:
+            case QRIO_EVEN_BYTES: {
+                const uint8_t *src = (const uint8_t *)bufinfo->buf + 2 * start + (policy == QRIO_ODD_BYTES);
+                for (int x = 0; x < width; x++) {
+                    dest[x] = src[2 * x * scale];
+                }
+                break;
             }
-            break;
         }
-        case QRIO_EVERY_BYTE:
-            memcpy(framebuffer, src, width * height);
-            break;
+    }
+}
 
-        case QRIO_ODD_BYTES:
-            src++;
-            MP_FALLTHROUGH;
+// Convert the image and locate the codes in it, returning how many were found.
+STATIC int qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
+    // quirc's buffers are sized for the whole image. Shrinking its idea of the
+    // image size to the region of interest avoids reallocating them every frame.
+    self->quirc->w = self->roi_width / self->scale;
+    self->quirc->h = self->roi_height / self->scale;
 
-        case QRIO_EVEN_BYTES:
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = src[2 * i];
-            }
-            break;
-    }
+    uint8_t *framebuffer = quirc_begin(self->quirc, NULL, NULL);
+    qrdecoder_convert(self, framebuffer, bufinfo, policy);
     quirc_end(self->quirc);
 
-    int count = quirc_count(self->quirc);
+    return quirc_count(self->quirc);
+}
+
+STATIC bool qrdecoder_extract(qrdecoder_qrdecoder_obj_t *self, int index) {
+    quirc_extract(self->quirc, index, &self->code);
+    return quirc_decode(&self->code, &self->data) == QUIRC_SUCCESS;
+}
+
+// Search around the code in self->code on the next decode: the code itself plus
+// its own size on each side, so it can move a fair way between frames.
+STATIC void qrdecoder_track_code(qrdecoder_qrdecoder_obj_t *self) {
+    if (!self->track) {
+        return;
+    }
+    int x1 = INT_MAX, y1 = INT_MAX, x2 = INT_MIN, y2 = INT_MIN;
+    for (int i = 0; i < 4; i++) {
+        x1 = MIN(x1, self->code.corners[i].x);
+        y1 = MIN(y1, self->code.corners[i].y);
+        x2 = MAX(x2, self->code.corners[i].x);
+        y2 = MAX(y2, self->code.corners[i].y);
+    }
+    int scale = self->scale;
+    int margin = MAX(x2 - x1, y2 - y1) * scale;
+    x1 = MAX(0, self->roi_x + x1 * scale - margin);
+    y1 = MAX(0, self->roi_y + y1 * scale - margin);
+    x2 = MIN(self->width, self->roi_x + x2 * scale + margin);
+    y2 = MIN(self->height, self->roi_y + y2 * scale + margin);
+
+    self->roi_x = x1;
+    self->roi_y = y1;
+    self->roi_width = x2 - x1;
+    self->roi_height = y2 - y1;
+}
+
+STATIC void qrdecoder_end(qrdecoder_qrdecoder_obj_t *self, bool found) {
+    self->quirc->w = self->width / self->scale;
+    self->quirc->h = self->height / self->scale;
+    // A tracked code that was lost may have moved anywhere.
+    if (!found) {
+        qrdecoder_reset_roi(self);
+    }
+}
+
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
+    int count = qrdecoder_find(self, bufinfo, policy);
+    bool found = false;
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
-        quirc_extract(self->quirc, i, &self->code);
-        if (quirc_decode(&self->code, &self->data) != QUIRC_SUCCESS) {
+        if (!qrdecoder_extract(self, i)) {
             continue;
         }
+        if (!found) {
+            found = true;
+            qrdecoder_track_code(self);
+        }
         mp_obj_t elems[2] = {
             mp_obj_new_bytes(self->data.payload, self->data.payload_len),
             data_type(self->data.data_type),
@@ -148,5 +237,28 @@ mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, co
         mp_obj_t code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrinfo_type_obj, 2, 0, elems);
         mp_obj_list_append(result, code_obj);
     }
+    qrdecoder_end(self, found);
     return result;
 }
+
+mp_obj_t shared_module_qrio_qrdecoder_decode_into(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const mp_buffer_info_t *payload) {
+    int count = qrdecoder_find(self, bufinfo, policy);
+    bool found = false;
+    for (int i = 0; i < count && !found; i++) {
+        found = qrdecoder_extract(self, i);
+    }
+    if (found) {
+        qrdecoder_track_code(self);
+    }
+    qrdecoder_end(self, found);
+    if (!found) {
+        return mp_const_none;
+    }
+
+    size_t len = self->data.payload_len;
+    if (len > payload->len) {
+        mp_raise_ValueError_varg(translate("Buffer too short by %d bytes"), (int)(len - payload->len));
+    }
+    memcpy(payload->buf, self->data.payload, len);
+    return MP_OBJ_NEW_SMALL_INT(len);
+}
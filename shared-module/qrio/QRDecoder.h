@@ -35,11 +35,17 @@ typedef struct qrio_qrdecoder_obj {
     struct quirc *quirc;
     struct quirc_code code;
     struct quirc_data data;
+    // Size of the source image; quirc works on an image `scale` times smaller.
+    int width, height, scale;
+    // Region of the source image searched by the next decode, when tracking.
+    int roi_x, roi_y, roi_width, roi_height;
+    bool track;
 } qrdecoder_qrdecoder_obj_t;
 
-void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height);
+void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height, int scale, bool track);
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *);
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *);
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *, int height);
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *, int width);
 mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
+mp_obj_t shared_module_qrio_qrdecoder_decode_into(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const mp_buffer_info_t *payload);
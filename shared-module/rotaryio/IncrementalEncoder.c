@@ -72,11 +72,16 @@ void shared_module_softencoder_state_update(rotaryio_incrementalencoder_obj_t *s
     }
 }
 
+MP_WEAK void shared_module_softencoder_update(rotaryio_incrementalencoder_obj_t *self) {
+}
+
 mp_int_t common_hal_rotaryio_incrementalencoder_get_position(rotaryio_incrementalencoder_obj_t *self) {
+    shared_module_softencoder_update(self);
     return self->position;
 }
 
 void common_hal_rotaryio_incrementalencoder_set_position(rotaryio_incrementalencoder_obj_t *self, mp_int_t position) {
+    shared_module_softencoder_update(self);
     self->position = position;
 }
 
@@ -129,6 +129,11 @@ STATIC int exit_cmd25(sdcardio_sdcard_obj_t *self) {
     if (self->in_cmd25) {
         DEBUG_PRINT("exit cmd25\n");
         self->in_cmd25 = false;
+        // The last block may still be programming.
+        int r = wait_for_ready(self);
+        if (r < 0) {
+            return r;
+        }
         return cmd_nodata(self, TOKEN_STOP_TRAN, 0);
     }
     return 0;
@@ -443,12 +448,9 @@ STATIC int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
         }
     }
 
-    // Wait for the write to finish
-    do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
-
-    // Success
+    // Don't wait for the card to program the block. The next command or
+    // block starts with wait_for_ready(), so the caller can prepare more
+    // data meanwhile.
     return 0;
 }
 
@@ -460,6 +462,14 @@ STATIC int writeblocks(sdcardio_sdcard_obj_t *self, uint32_t start_block, mp_buf
 
     if (!self->in_cmd25 || start_block != self->next_block) {
         DEBUG_PRINT("entering CMD25 at %d\n", (int)start_block);
+        if (nblocks > 1) {
+            // ACMD23 lets the card pre-erase the blocks about to be written.
+            // It is only a hint, and writing past the count is allowed, so
+            // any error is ignored.
+            if (cmd(self, 55, 0, NULL, 0, true, true) >= 0) {
+                cmd(self, 23, nblocks, NULL, 0, true, true);
+            }
+        }
         //  Use CMD25 to write multiple block
         int r = block_cmd(self, 25, start_block, NULL, 0, true, true);
         if (r < 0) {
@@ -488,6 +498,10 @@ int common_hal_sdcardio_sdcard_sync(sdcardio_sdcard_obj_t *self) {
     common_hal_sdcardio_check_for_deinit(self);
     lock_and_configure_bus(self);
     int r = exit_cmd25(self);
+    if (r >= 0) {
+        // Don't report the data as written until the card has programmed it.
+        r = wait_for_ready(self);
+    }
     extraclock_and_unlock_bus(self);
     return r;
 }
@@ -34,11 +34,15 @@
 #include "shared-module/sharpdisplay/SharpMemoryFramebuffer.h"
 
 #include "supervisor/memory.h"
+#include "supervisor/shared/tick.h"
 
 #define SHARPMEM_BIT_WRITECMD_LSB (0x80)
 #define JDI_BIT_WRITECMD_LSB      (0x90)
 #define SHARPMEM_BIT_VCOM_LSB (0x40)
 
+// When nothing is drawn, VCOM is still inverted this often to avoid a DC bias on the panel.
+#define SHARPMEM_VCOM_IDLE_PERIOD_MS (500)
+
 STATIC uint8_t bitrev(uint8_t n) {
     uint8_t r = 0;
     for (int i = 0; i < 8; i++) {r |= ((n >> i) & 1) << (7 - i);
@@ -177,16 +181,24 @@ STATIC void common_hal_sharpdisplay_framebuffer_swapbuffers(sharpdisplay_framebu
     // output the toggling signal
     uint8_t *data = self->bufinfo.buf;
     data[0] ^= SHARPMEM_BIT_VCOM_LSB;
+    self->last_vcom_toggle_ms = supervisor_ticks_ms32();
 
     common_hal_busio_spi_write(self->bus, data++, 1);
 
-    // output each changed row
+    // output each run of changed rows. Each row carries its own address and
+    // trailing byte, so consecutive rows go out in one write.
     size_t row_stride = common_hal_sharpdisplay_framebuffer_get_row_stride(self);
-    for (int y = 0; y < self->height; y++) {
-        if (self->full_refresh || (dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
-            common_hal_busio_spi_write(self->bus, data, row_stride);
+    int y = 0;
+    while (y < self->height) {
+        if (!self->full_refresh && !(dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
+            y++;
+            continue;
+        }
+        int first = y;
+        while (y < self->height && (self->full_refresh || (dirty_row_bitmask[y / 8] & (1 << (y & 7))))) {
+            y++;
         }
-        data += row_stride;
+        common_hal_busio_spi_write(self->bus, data + first * row_stride, (y - first) * row_stride);
     }
 
     // output a trailing zero
@@ -202,6 +214,29 @@ STATIC void common_hal_sharpdisplay_framebuffer_swapbuffers(sharpdisplay_framebu
     self->full_refresh = false;
 }
 
+STATIC void common_hal_sharpdisplay_framebuffer_idle(sharpdisplay_framebuffer_obj_t *self) {
+    if (supervisor_ticks_ms32() - self->last_vcom_toggle_ms < SHARPMEM_VCOM_IDLE_PERIOD_MS) {
+        return;
+    }
+    if (!common_hal_busio_spi_try_lock(self->bus)) {
+        return;
+    }
+    common_hal_busio_spi_configure(self->bus, self->baudrate, 0, 0, 8);
+
+    common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
+
+    // Send the display (no update) mode with the inverted VCOM bit.
+    uint8_t *data = self->bufinfo.buf;
+    data[0] ^= SHARPMEM_BIT_VCOM_LSB;
+    self->last_vcom_toggle_ms = supervisor_ticks_ms32();
+    uint8_t command[2] = {data[0] & SHARPMEM_BIT_VCOM_LSB, 0};
+    common_hal_busio_spi_write(self->bus, command, sizeof(command));
+
+    common_hal_digitalio_digitalinout_set_value(&self->chip_select, false);
+
+    common_hal_busio_spi_unlock(self->bus);
+}
+
 STATIC void sharpdisplay_framebuffer_deinit(mp_obj_t self_in) {
     sharpdisplay_framebuffer_obj_t *self = self_in;
     common_hal_sharpdisplay_framebuffer_deinit(self);
@@ -257,6 +292,11 @@ STATIC void sharpdisplay_framebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirt
     common_hal_sharpdisplay_framebuffer_swapbuffers(self, dirty_row_bitmask);
 }
 
+STATIC void sharpdisplay_framebuffer_idle(mp_obj_t self_in) {
+    sharpdisplay_framebuffer_obj_t *self = self_in;
+    common_hal_sharpdisplay_framebuffer_idle(self);
+}
+
 const framebuffer_p_t sharpdisplay_framebuffer_proto = {
     MP_PROTO_IMPLEMENT(MP_QSTR_protocol_framebuffer)
     .deinit = sharpdisplay_framebuffer_deinit,
@@ -266,6 +306,7 @@ const framebuffer_p_t sharpdisplay_framebuffer_proto = {
     .get_height = sharpdisplay_framebuffer_get_height,
     .get_width = sharpdisplay_framebuffer_get_width,
     .swapbuffers = sharpdisplay_framebuffer_swapbuffers,
+    .idle = sharpdisplay_framebuffer_idle,
 
     .get_first_pixel_offset = sharpdisplay_framebuffer_get_first_pixel_offset,
     .get_pixels_in_byte_share_row = sharpdisplay_framebuffer_get_pixels_in_byte_share_row,
@@ -40,6 +40,7 @@ typedef struct {
 
     uint16_t width, height;
     uint32_t baudrate;
+    uint32_t last_vcom_toggle_ms;
 
     bool full_refresh;
     bool jdi_display;
@@ -0,0 +1,129 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/socketpool/ConnectionPool.h"
+
+#include <string.h>
+
+#include "py/objlist.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+void common_hal_socketpool_connectionpool_construct(socketpool_connectionpool_obj_t *self, mp_uint_t max_idle) {
+    self->idle = MP_OBJ_TO_PTR(mp_obj_new_dict(0));
+    self->max_idle = max_idle;
+}
+
+STATIC mp_obj_t make_key(mp_obj_t host, mp_int_t port) {
+    mp_obj_t items[2] = { host, MP_OBJ_NEW_SMALL_INT(port) };
+    return mp_obj_new_tuple(2, items);
+}
+
+// An idle keep-alive connection has nothing to read: data, or the peer closing the
+// connection, means the server is done with it. This only polls, so it is cheap.
+STATIC bool socket_is_reusable(mp_obj_t sock) {
+    const mp_stream_p_t *stream = mp_get_stream(sock);
+    int errcode;
+    mp_uint_t ret = stream->ioctl(sock, MP_STREAM_POLL, MP_STREAM_POLL_RD | MP_STREAM_POLL_WR, &errcode);
+    return ret == MP_STREAM_POLL_WR;
+}
+
+STATIC void close_socket(mp_obj_t sock) {
+    mp_obj_t dest[2];
+    mp_load_method(sock, MP_QSTR_close, dest);
+    mp_call_method_n_kw(0, 0, dest);
+}
+
+void common_hal_socketpool_connectionpool_clear(socketpool_connectionpool_obj_t *self) {
+    mp_map_t *map = &self->idle->map;
+    for (size_t i = 0; i < map->alloc; i++) {
+        if (!mp_map_slot_is_filled(map, i)) {
+            continue;
+        }
+        mp_obj_list_t *list = MP_OBJ_TO_PTR(map->table[i].value);
+        for (size_t j = 0; j < list->len; j++) {
+            close_socket(list->items[j]);
+        }
+    }
+    self->idle = MP_OBJ_TO_PTR(mp_obj_new_dict(0));
+}
+
+mp_obj_t common_hal_socketpool_connectionpool_get(socketpool_connectionpool_obj_t *self, mp_obj_t host, mp_int_t port) {
+    mp_obj_t key = make_key(host, port);
+    mp_map_elem_t *elem = mp_map_lookup(&self->idle->map, key, MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        return MP_OBJ_NULL;
+    }
+    mp_obj_list_t *list = MP_OBJ_TO_PTR(elem->value);
+    mp_obj_t sock = MP_OBJ_NULL;
+    // The most recently returned socket is the least likely to have timed out on the server.
+    while (list->len > 0) {
+        mp_obj_t candidate = list->items[list->len - 1];
+        mp_obj_list_set_len(MP_OBJ_FROM_PTR(list), list->len - 1);
+        if (socket_is_reusable(candidate)) {
+            sock = candidate;
+            break;
+        }
+        close_socket(candidate);
+    }
+    if (list->len == 0) {
+        mp_map_lookup(&self->idle->map, key, MP_MAP_LOOKUP_REMOVE_IF_FOUND);
+    }
+    return sock;
+}
+
+void common_hal_socketpool_connectionpool_put(socketpool_connectionpool_obj_t *self, mp_obj_t sock, mp_obj_t host, mp_int_t port) {
+    if (!socket_is_reusable(sock)) {
+        close_socket(sock);
+        return;
+    }
+    mp_obj_t key = make_key(host, port);
+    mp_map_elem_t *elem = mp_map_lookup(&self->idle->map, key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
+    if (elem->value == MP_OBJ_NULL) {
+        elem->value = mp_obj_new_list(0, NULL);
+    }
+    mp_obj_list_t *list = MP_OBJ_TO_PTR(elem->value);
+    if (list->len >= self->max_idle) {
+        // Make room by dropping the socket that has been idle longest.
+        close_socket(list->items[0]);
+        memmove(list->items, list->items + 1, (list->len - 1) * sizeof(mp_obj_t));
+        mp_obj_list_set_len(MP_OBJ_FROM_PTR(list), list->len - 1);
+    }
+    mp_obj_list_append(MP_OBJ_FROM_PTR(list), sock);
+}
+
+mp_uint_t common_hal_socketpool_connectionpool_get_idle(socketpool_connectionpool_obj_t *self) {
+    mp_map_t *map = &self->idle->map;
+    mp_uint_t idle = 0;
+    for (size_t i = 0; i < map->alloc; i++) {
+        if (mp_map_slot_is_filled(map, i)) {
+            mp_obj_list_t *list = MP_OBJ_TO_PTR(map->table[i].value);
+            idle += list->len;
+        }
+    }
+    return idle;
+}
@@ -29,6 +29,7 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
 #include "py/obj.h"
@@ -280,3 +281,151 @@ void common_hal_storage_erase_filesystem(bool extended) {
     common_hal_mcu_reset();
     // We won't actually get here, since we're resetting.
 }
+
+#if CIRCUITPY_STORAGE_MMAP
+// The file's data when it is one run of clusters on memory-mapped flash,
+// otherwise NULL.
+STATIC const void *mapped_file_data(FIL *fp) {
+    // A single fragment fits { table length, cluster count, first cluster, 0 }.
+    DWORD linkmap[4] = {MP_ARRAY_SIZE(linkmap)};
+    fp->cltbl = linkmap;
+    FRESULT res = f_lseek(fp, CREATE_LINKMAP);
+    fp->cltbl = NULL;
+    if (res != FR_OK) {
+        return NULL;
+    }
+    FATFS *fatfs = fp->obj.fs;
+    DWORD sector = fatfs->database + fatfs->csize * (linkmap[2] - 2);
+    return supervisor_flash_map_block(sector);
+}
+
+STATIC FRESULT copy_contiguous(FATFS *fatfs, const char *from, const char *to, FSIZE_t size, uint8_t *buf) {
+    FIL src, dst;
+    FRESULT res = f_open(fatfs, &src, from, FA_READ);
+    if (res != FR_OK) {
+        return res;
+    }
+    res = f_open(fatfs, &dst, to, FA_WRITE | FA_CREATE_ALWAYS);
+    if (res == FR_OK) {
+        // Allocate the whole file as one run of clusters, or fail.
+        res = f_expand(&dst, size, 1);
+        while (res == FR_OK) {
+            UINT n, written;
+            res = f_read(&src, buf, FF_MIN_SS, &n);
+            if (res != FR_OK || n == 0) {
+                break;
+            }
+            res = f_write(&dst, buf, n, &written);
+            if (res == FR_OK && written != n) {
+                res = FR_DENIED;
+            }
+        }
+        FRESULT close_res = f_close(&dst);
+        if (res == FR_OK) {
+            res = close_res;
+        }
+        if (res != FR_OK) {
+            f_unlink(fatfs, to);
+        }
+    }
+    f_close(&src);
+    return res;
+}
+
+// Copy the file into space allocated in one piece, then replace the original.
+STATIC void defragment_file(fs_user_mount_t *vfs, const char *path, FSIZE_t size) {
+    if (!filesystem_is_writable_by_python(vfs)) {
+        mp_raise_OSError(MP_EROFS);
+    }
+    vstr_t temp_path;
+    vstr_init(&temp_path, strlen(path) + 2);
+    vstr_add_str(&temp_path, path);
+    vstr_add_char(&temp_path, '~');
+    const char *temp = vstr_null_terminated_str(&temp_path);
+    uint8_t *buf = m_new(uint8_t, FF_MIN_SS);
+
+    FRESULT res = copy_contiguous(&vfs->fatfs, path, temp, size, buf);
+    if (res == FR_OK) {
+        res = f_unlink(&vfs->fatfs, path);
+    }
+    if (res == FR_OK) {
+        res = f_rename(&vfs->fatfs, temp, path);
+    }
+
+    m_del(uint8_t, buf, FF_MIN_SS);
+    vstr_clear(&temp_path);
+    if (res == FR_DENIED) {
+        // No contiguous space for the copy, or the drive filled up.
+        mp_raise_OSError(MP_ENOSPC);
+    }
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+}
+
+mp_obj_t common_hal_storage_mmap(const char *path, bool defragment) {
+    const char *path_out;
+    mp_vfs_mount_t *mount = mp_vfs_lookup_path(path, &path_out);
+    if (mount == MP_VFS_NONE || mount == MP_VFS_ROOT) {
+        mp_raise_OSError(MP_ENOENT);
+    }
+    if (!mp_obj_is_type(mount->obj, &mp_fat_vfs_type) ||
+        &((fs_user_mount_t *)MP_OBJ_TO_PTR(mount->obj))->fatfs != filesystem_circuitpy()) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+    fs_user_mount_t *vfs = MP_OBJ_TO_PTR(mount->obj);
+
+    for (int attempt = 0;; attempt++) {
+        FIL fp;
+        FRESULT res = f_open(&vfs->fatfs, &fp, path_out, FA_READ);
+        if (res != FR_OK) {
+            mp_raise_OSError(fresult_to_errno_table[res]);
+        }
+        FSIZE_t size = f_size(&fp);
+        const void *data = size ? mapped_file_data(&fp) : NULL;
+        f_close(&fp);
+        if (data != NULL || size == 0) {
+            return mp_obj_new_memoryview('B', size, (void *)data);
+        }
+        if (!defragment || attempt > 0) {
+            mp_raise_OSError_msg(translate("File is fragmented"));
+        }
+        defragment_file(vfs, path_out, size);
+    }
+}
+#endif
+
+#if CIRCUITPY_STORAGE_STATS
+mp_obj_t common_hal_storage_stats(bool reset) {
+    static const qstr names[MP_IO_STATS_NUM_OPS] = {
+        [MP_IO_STATS_FS_READ] = MP_QSTR_fs_read,
+        [MP_IO_STATS_FS_WRITE] = MP_QSTR_fs_write,
+        [MP_IO_STATS_FS_SYNC] = MP_QSTR_fs_sync,
+        [MP_IO_STATS_FLASH_READ] = MP_QSTR_flash_read,
+        [MP_IO_STATS_FLASH_WRITE] = MP_QSTR_flash_write,
+        [MP_IO_STATS_FLASH_FLUSH] = MP_QSTR_flash_flush,
+    };
+    mp_obj_t result = mp_obj_new_dict(MP_IO_STATS_NUM_OPS);
+    for (size_t op = 0; op < MP_IO_STATS_NUM_OPS; op++) {
+        // Take a copy first: USB can add to the counts while the objects
+        // are allocated.
+        mp_io_stats_t stats = mp_io_stats[op];
+        if (reset) {
+            memset(&mp_io_stats[op], 0, sizeof(mp_io_stats[op]));
+        }
+        mp_obj_t histogram[MP_IO_STATS_BUCKETS];
+        for (size_t i = 0; i < MP_IO_STATS_BUCKETS; i++) {
+            histogram[i] = mp_obj_new_int_from_uint(stats.histogram[i]);
+        }
+        mp_obj_t items[] = {
+            mp_obj_new_int_from_uint(stats.count),
+            mp_obj_new_int_from_uint(stats.blocks),
+            mp_obj_new_int_from_ull(stats.total_us),
+            mp_obj_new_int_from_uint(stats.max_us),
+            mp_obj_new_tuple(MP_ARRAY_SIZE(histogram), histogram),
+        };
+        mp_obj_dict_store(result, MP_OBJ_NEW_QSTR(names[op]), mp_obj_new_tuple(MP_ARRAY_SIZE(items), items));
+    }
+    return result;
+}
+#endif
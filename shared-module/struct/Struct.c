@@ -0,0 +1,212 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/binary.h"
+#include "py/objarray.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+#include "shared-module/struct/__init__.h"
+#include "supervisor/shared/translate/translate.h"
+
+void common_hal_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t fmt_in) {
+    const char *fmt = mp_obj_str_get_str(fmt_in);
+    char fmt_type = get_fmt_type(&fmt);
+    if (fmt_type == '=') {
+        // Native byte order with standard sizes.
+        fmt_type = MP_ENDIANNESS_LITTLE ? '<' : '>';
+    }
+
+    // Each op uses at least one format character, so this is an upper bound.
+    size_t max_ops = strlen(fmt);
+    struct_op_t *ops = m_new(struct_op_t, max_ops);
+    size_t num_ops = 0;
+    mp_uint_t size = 0;
+    mp_uint_t num_items = 0;
+
+    while (*fmt) {
+        struct_validate_format(*fmt);
+
+        mp_uint_t cnt = 1;
+        if (unichar_isdigit(*fmt)) {
+            cnt = get_fmt_num(&fmt);
+            if (*fmt == '\0') {
+                mp_raise_ValueError(translate("bad typecode"));
+            }
+        }
+        char code = *fmt++;
+
+        if (code == 's') {
+            ops[num_ops++] = (struct_op_t) { .offset = size, .count = cnt, .code = code, .item_size = 1 };
+            size += cnt;
+            num_items++;
+            continue;
+        }
+
+        size_t align;
+        size_t sz = mp_binary_get_size(fmt_type, code, &align);
+        if (cnt == 0) {
+            continue;
+        }
+        size = (size + align - 1) & ~(align - 1);
+
+        // Merge runs of the same code such as "HH" or "2H3H" into one op.
+        struct_op_t *prev = num_ops ? &ops[num_ops - 1] : NULL;
+        if (prev && prev->code == code && prev->offset + prev->count * sz == size) {
+            prev->count += cnt;
+        } else {
+            ops[num_ops++] = (struct_op_t) { .offset = size, .count = cnt, .code = code, .item_size = sz };
+        }
+        size += cnt * sz;
+        if (code != 'x') {
+            num_items += cnt;
+        }
+    }
+
+    self->format = fmt_in;
+    self->ops = m_renew(struct_op_t, ops, max_ops, num_ops);
+    self->num_ops = num_ops;
+    self->size = size;
+    self->num_items = num_items;
+    self->fmt_type = fmt_type;
+}
+
+mp_obj_t common_hal_struct_struct_get_format(struct_struct_obj_t *self) {
+    return self->format;
+}
+
+mp_uint_t common_hal_struct_struct_get_size(struct_struct_obj_t *self) {
+    return self->size;
+}
+
+void common_hal_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args) {
+    (void)mp_arg_validate_length(n_args, self->num_items, MP_QSTR_values);
+
+    size_t i = 0;
+    for (size_t n = 0; n < self->num_ops; n++) {
+        const struct_op_t *op = &self->ops[n];
+        byte *q = p + op->offset;
+        if (op->code == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(args[i++], &bufinfo, MP_BUFFER_READ);
+            mp_uint_t to_copy = MIN(bufinfo.len, op->count);
+            memcpy(q, bufinfo.buf, to_copy);
+            memset(q + to_copy, 0, op->count - to_copy);
+        } else if (op->code == 'x') {
+            memset(q, 0, op->count);
+        } else {
+            for (mp_uint_t k = 0; k < op->count; k++) {
+                mp_binary_set_val(self->fmt_type, op->code, args[i++], p, &q);
+            }
+        }
+    }
+}
+
+void common_hal_struct_struct_unpack_into(struct_struct_obj_t *self, byte *p, mp_obj_t *items) {
+    size_t i = 0;
+    for (size_t n = 0; n < self->num_ops; n++) {
+        const struct_op_t *op = &self->ops[n];
+        byte *q = p + op->offset;
+        if (op->code == 's') {
+            items[i++] = mp_obj_new_bytes(q, op->count);
+        } else if (op->code != 'x') {
+            for (mp_uint_t k = 0; k < op->count; k++) {
+                items[i++] = mp_binary_get_val(self->fmt_type, op->code, p, &q);
+            }
+        }
+    }
+}
+
+mp_obj_t common_hal_struct_struct_unpack(struct_struct_obj_t *self, byte *p) {
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->num_items, NULL));
+    common_hal_struct_struct_unpack_into(self, p, res->items);
+    return MP_OBJ_FROM_PTR(res);
+}
+
+#if MICROPY_PY_ARRAY
+STATIC mp_obj_array_t *struct_new_column(char typecode, size_t len) {
+    mp_obj_array_t *o = m_new_obj(mp_obj_array_t);
+    o->base.type = &mp_type_array;
+    o->typecode = typecode;
+    o->free = 0;
+    o->len = len;
+    o->items = m_new(byte, mp_binary_get_size('@', typecode, NULL) * len);
+    return o;
+}
+
+// Copy one field out of every record into a native array. When the packed
+// size matches the native one the bytes are copied (and swapped if needed),
+// otherwise the integer is widened.
+STATIC void struct_fill_column(char fmt_type, mp_obj_array_t *col, const struct_op_t *op, const byte *src, mp_uint_t stride) {
+    size_t native_size = mp_binary_get_size('@', op->code, NULL);
+    size_t item_size = op->item_size;
+    byte *dest = col->items;
+    if (native_size == item_size) {
+        bool swap = fmt_type == (MP_ENDIANNESS_LITTLE ? '>' : '<');
+        for (size_t r = 0; r < col->len; r++, src += stride, dest += item_size) {
+            if (swap) {
+                for (size_t j = 0; j < item_size; j++) {
+                    dest[j] = src[item_size - 1 - j];
+                }
+            } else {
+                memcpy(dest, src, item_size);
+            }
+        }
+    } else {
+        bool is_signed = unichar_islower(op->code);
+        bool big_endian = fmt_type == '>';
+        for (size_t r = 0; r < col->len; r++, src += stride) {
+            long long val = mp_binary_get_int(item_size, is_signed, big_endian, src);
+            mp_binary_set_val_array_from_int(op->code, col->items, r, (mp_int_t)val);
+        }
+    }
+}
+
+mp_obj_t common_hal_struct_struct_unpack_from_array(struct_struct_obj_t *self, const byte *p, size_t count) {
+    for (size_t n = 0; n < self->num_ops; n++) {
+        if (self->ops[n].code == 's') {
+            mp_raise_ValueError(translate("bad typecode"));
+        }
+    }
+
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->num_items, NULL));
+    size_t i = 0;
+    for (size_t n = 0; n < self->num_ops; n++) {
+        const struct_op_t *op = &self->ops[n];
+        if (op->code == 'x') {
+            continue;
+        }
+        for (mp_uint_t k = 0; k < op->count; k++) {
+            mp_obj_array_t *col = struct_new_column(op->code, count);
+            struct_fill_column(self->fmt_type, col, op, p + op->offset + k * op->item_size, self->size);
+            res->items[i++] = MP_OBJ_FROM_PTR(col);
+        }
+    }
+    return MP_OBJ_FROM_PTR(res);
+}
+#endif
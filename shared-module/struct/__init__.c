@@ -33,8 +33,9 @@
 #include "py/parsenum.h"
 #include "supervisor/shared/translate/translate.h"
 #include "shared-bindings/struct/__init__.h"
+#include "shared-module/struct/__init__.h"
 
-STATIC void struct_validate_format(char fmt) {
+void struct_validate_format(char fmt) {
     #if MICROPY_NONSTANDARD_TYPECODES
     if (fmt == 'S' || fmt == 'O') {
         mp_raise_RuntimeError(translate("'S' and 'O' are not supported format types"));
@@ -42,7 +43,7 @@ STATIC void struct_validate_format(char fmt) {
     #endif
 }
 
-STATIC char get_fmt_type(const char **fmt) {
+char get_fmt_type(const char **fmt) {
     char t = **fmt;
     switch (t) {
         case '!':
@@ -61,7 +62,7 @@ STATIC char get_fmt_type(const char **fmt) {
     return t;
 }
 
-STATIC mp_uint_t get_fmt_num(const char **p) {
+mp_uint_t get_fmt_num(const char **p) {
     const char *num = *p;
     uint len = 1;
     while (unichar_isdigit(*++num)) {
@@ -72,7 +73,7 @@ STATIC mp_uint_t get_fmt_num(const char **p) {
     return val;
 }
 
-STATIC mp_uint_t calcsize_items(const char *fmt) {
+mp_uint_t calcsize_items(const char *fmt) {
     mp_uint_t cnt = 0;
     while (*fmt) {
         int num = 1;
@@ -0,0 +1,143 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "shared-bindings/synthio/Biquad.h"
+#include "shared-module/synthio/Biquad.h"
+
+synthio_filter_mode_t common_hal_synthio_biquad_get_mode(synthio_biquad_obj_t *self) {
+    return self->mode;
+}
+
+void common_hal_synthio_biquad_set_mode(synthio_biquad_obj_t *self, synthio_filter_mode_t arg) {
+    self->mode = arg;
+    self->valid = false;
+}
+
+mp_obj_t common_hal_synthio_biquad_get_frequency(synthio_biquad_obj_t *self) {
+    return self->frequency.obj;
+}
+
+void common_hal_synthio_biquad_set_frequency(synthio_biquad_obj_t *self, mp_obj_t arg) {
+    synthio_block_assign_slot(arg, &self->frequency, MP_QSTR_frequency);
+}
+
+mp_obj_t common_hal_synthio_biquad_get_Q(synthio_biquad_obj_t *self) {
+    return self->Q.obj;
+}
+
+void common_hal_synthio_biquad_set_Q(synthio_biquad_obj_t *self, mp_obj_t arg) {
+    synthio_block_assign_slot(arg, &self->Q, MP_QSTR_Q);
+}
+
+#define BIQUAD_ONE (1 << SYNTHIO_BIQUAD_SHIFT)
+// Every normalized coefficient is in the range (-2, 2)
+#define BIQUAD_COEFF_MAX (2 * BIQUAD_ONE - 1)
+
+STATIC int32_t biquad_scale_arg_float(mp_float_t arg) {
+    int32_t result = (int32_t)MICROPY_FLOAT_C_FUN(round)(arg * BIQUAD_ONE);
+    return MIN(BIQUAD_COEFF_MAX, MAX(-BIQUAD_COEFF_MAX, result));
+}
+
+// Coefficients from the "Audio EQ Cookbook" by Robert Bristow-Johnson
+// https://www.w3.org/TR/audio-eq-cookbook/
+void synthio_biquad_update(synthio_biquad_obj_t *self, int32_t sample_rate) {
+    mp_float_t nyquist = sample_rate / MICROPY_FLOAT_CONST(2.);
+    mp_float_t frequency = synthio_block_slot_get_limited(&self->frequency, MICROPY_FLOAT_CONST(1.), nyquist * MICROPY_FLOAT_CONST(0.98));
+    mp_float_t Q = synthio_block_slot_get_limited(&self->Q, MICROPY_FLOAT_CONST(0.05), MICROPY_FLOAT_CONST(40.));
+
+    if (self->valid && frequency == self->last_frequency && Q == self->last_Q && sample_rate == self->last_sample_rate) {
+        return;
+    }
+    self->last_frequency = frequency;
+    self->last_Q = Q;
+    self->last_sample_rate = sample_rate;
+    self->valid = true;
+
+    mp_float_t w0 = frequency / sample_rate * MICROPY_FLOAT_CONST(6.283185307179586);
+    mp_float_t s = MICROPY_FLOAT_C_FUN(sin)(w0);
+    mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(w0);
+    mp_float_t alpha = s / (2 * Q);
+    mp_float_t a0 = 1 + alpha;
+
+    mp_float_t b0, b1, b2;
+    switch (self->mode) {
+        default:
+        case SYNTHIO_LOW_PASS:
+            b1 = 1 - c;
+            b0 = b2 = b1 / 2;
+            break;
+        case SYNTHIO_HIGH_PASS:
+            b1 = -(1 + c);
+            b0 = b2 = -b1 / 2;
+            break;
+        case SYNTHIO_BAND_PASS:
+            // constant 0dB peak gain
+            b0 = alpha;
+            b1 = 0;
+            b2 = -alpha;
+            break;
+    }
+
+    self->b0 = biquad_scale_arg_float(b0 / a0);
+    self->b1 = biquad_scale_arg_float(b1 / a0);
+    self->b2 = biquad_scale_arg_float(b2 / a0);
+    self->a1 = biquad_scale_arg_float(-2 * c / a0);
+    self->a2 = biquad_scale_arg_float((1 - alpha) / a0);
+}
+
+void synthio_biquad_filter_state_reset(synthio_biquad_filter_state_t *st) {
+    memset(st, 0, sizeof(*st));
+}
+
+// Direct Form I. The sum of products is formed in unsigned arithmetic: a
+// partial sum may wrap, but as long as the filtered sample is within a few
+// times full scale the final sum is exact. The output saturates to 16 bits,
+// which also keeps a highly resonant filter from running away.
+void synthio_biquad_filter_samples(const synthio_biquad_obj_t *self, synthio_biquad_filter_state_t *st, int16_t *buffer, size_t n_samples) {
+    int32_t b0 = self->b0, b1 = self->b1, b2 = self->b2, a1 = self->a1, a2 = self->a2;
+    int32_t x1 = st->x[0], x2 = st->x[1], y1 = st->y[0], y2 = st->y[1];
+
+    for (size_t i = 0; i < n_samples; i++) {
+        int32_t x0 = buffer[i];
+        uint32_t acc = (uint32_t)(b0 * x0) + (uint32_t)(b1 * x1) + (uint32_t)(b2 * x2)
+            - (uint32_t)(a1 * y1) - (uint32_t)(a2 * y2) + (1 << (SYNTHIO_BIQUAD_SHIFT - 1));
+        int32_t y0 = (int32_t)acc >> SYNTHIO_BIQUAD_SHIFT;
+        y0 = MIN(32767, MAX(-32768, y0));
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = y0;
+        buffer[i] = y0;
+    }
+
+    st->x[0] = x1;
+    st->x[1] = x2;
+    st->y[0] = y1;
+    st->y[1] = y2;
+}
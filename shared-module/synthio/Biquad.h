@@ -0,0 +1,53 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-bindings/synthio/Biquad.h"
+#include "shared-module/synthio/block.h"
+
+#define SYNTHIO_BIQUAD_SHIFT (14)
+
+typedef struct synthio_biquad_obj {
+    mp_obj_base_t base;
+    synthio_filter_mode_t mode;
+    synthio_block_slot_t frequency, Q;
+    // the inputs the coefficients were last computed from
+    mp_float_t last_frequency, last_Q;
+    int32_t last_sample_rate;
+    bool valid;
+    // fixed point coefficients, normalized so that a0 is 1.0
+    int32_t b0, b1, b2, a1, a2;
+} synthio_biquad_obj_t;
+
+typedef struct {
+    int16_t x[2], y[2];
+} synthio_biquad_filter_state_t;
+
+// Recompute the coefficients if the frequency, Q, or sample rate changed. Call once per block.
+void synthio_biquad_update(synthio_biquad_obj_t *self, int32_t sample_rate);
+void synthio_biquad_filter_state_reset(synthio_biquad_filter_state_t *st);
+void synthio_biquad_filter_samples(const synthio_biquad_obj_t *self, synthio_biquad_filter_state_t *st, int16_t *buffer, size_t n_samples);
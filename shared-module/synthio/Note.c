@@ -40,12 +40,24 @@ void common_hal_synthio_note_set_frequency(synthio_note_obj_t *self, mp_float_t
     self->frequency_scaled = synthio_frequency_convert_float_to_scaled(val);
 }
 
-bool common_hal_synthio_note_get_filter(synthio_note_obj_t *self) {
-    return self->filter;
+mp_obj_t common_hal_synthio_note_get_filter(synthio_note_obj_t *self) {
+    if (self->biquad) {
+        return MP_OBJ_FROM_PTR(self->biquad);
+    }
+    return mp_obj_new_bool(self->filter);
 }
 
-void common_hal_synthio_note_set_filter(synthio_note_obj_t *self, bool value_in) {
-    self->filter = value_in;
+void common_hal_synthio_note_set_filter(synthio_note_obj_t *self, mp_obj_t value_in) {
+    if (mp_obj_is_type(value_in, &synthio_biquad_type)) {
+        if (self->biquad != MP_OBJ_TO_PTR(value_in)) {
+            synthio_biquad_filter_state_reset(&self->filter_state);
+        }
+        self->biquad = MP_OBJ_TO_PTR(value_in);
+        self->filter = false;
+    } else {
+        self->biquad = NULL;
+        self->filter = mp_obj_is_true(value_in);
+    }
 }
 
 mp_float_t common_hal_synthio_note_get_ring_frequency(synthio_note_obj_t *self) {
@@ -90,6 +102,38 @@ void common_hal_synthio_note_set_ring_bend(synthio_note_obj_t *self, mp_obj_t va
     synthio_block_assign_slot(value_in, &self->ring_bend, MP_QSTR_ring_bend);
 }
 
+mp_int_t common_hal_synthio_note_get_waveform_loop_start(synthio_note_obj_t *self) {
+    return self->waveform_loop_start;
+}
+
+void common_hal_synthio_note_set_waveform_loop_start(synthio_note_obj_t *self, mp_int_t value_in) {
+    self->waveform_loop_start = mp_arg_validate_int_range(value_in, 0, SYNTHIO_WAVEFORM_MAX_LENGTH - 1, MP_QSTR_waveform_loop_start);
+}
+
+mp_int_t common_hal_synthio_note_get_waveform_loop_end(synthio_note_obj_t *self) {
+    return self->waveform_loop_end;
+}
+
+void common_hal_synthio_note_set_waveform_loop_end(synthio_note_obj_t *self, mp_int_t value_in) {
+    self->waveform_loop_end = mp_arg_validate_int_range(value_in, 1, SYNTHIO_WAVEFORM_MAX_LENGTH, MP_QSTR_waveform_loop_end);
+}
+
+mp_int_t common_hal_synthio_note_get_waveform_frames(synthio_note_obj_t *self) {
+    return self->waveform_frames;
+}
+
+void common_hal_synthio_note_set_waveform_frames(synthio_note_obj_t *self, mp_int_t value_in) {
+    self->waveform_frames = mp_arg_validate_int_range(value_in, 1, 256, MP_QSTR_waveform_frames);
+}
+
+mp_obj_t common_hal_synthio_note_get_morph(synthio_note_obj_t *self) {
+    return self->morph.obj;
+}
+
+void common_hal_synthio_note_set_morph(synthio_note_obj_t *self, mp_obj_t value_in) {
+    synthio_block_assign_slot(value_in, &self->morph, MP_QSTR_morph);
+}
+
 mp_obj_t common_hal_synthio_note_get_envelope_obj(synthio_note_obj_t *self) {
     return self->envelope_obj;
 }
@@ -147,6 +191,7 @@ void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate) {
 
 void synthio_note_start(synthio_note_obj_t *self, int32_t sample_rate) {
     synthio_note_recalculate(self, sample_rate);
+    synthio_biquad_filter_state_reset(&self->filter_state);
 }
 
 // Perform a pitch bend operation
@@ -27,13 +27,14 @@
 #pragma once
 
 #include "shared-module/synthio/__init__.h"
+#include "shared-module/synthio/Biquad.h"
 #include "shared-module/synthio/LFO.h"
 #include "shared-bindings/synthio/__init__.h"
 
 typedef struct synthio_note_obj {
     mp_obj_base_t base;
 
-    synthio_block_slot_t panning, bend, amplitude, ring_bend;
+    synthio_block_slot_t panning, bend, amplitude, ring_bend, morph;
 
     mp_float_t frequency, ring_frequency;
     mp_obj_t waveform_obj, envelope_obj, ring_waveform_obj;
@@ -43,8 +44,11 @@ typedef struct synthio_note_obj {
     int32_t frequency_scaled;
     int32_t ring_frequency_scaled, ring_frequency_bent;
     bool filter;
+    synthio_biquad_obj_t *biquad;
+    synthio_biquad_filter_state_t filter_state;
 
     mp_buffer_info_t waveform_buf;
+    uint16_t waveform_loop_start, waveform_loop_end, waveform_frames;
     mp_buffer_info_t ring_waveform_buf;
     synthio_envelope_definition_t envelope_def;
 } synthio_note_obj_t;
@@ -171,6 +171,65 @@ int16_t mix_down_sample(int32_t sample) {
     return sample;
 }
 
+// Bring a phase accumulator that has run past `lim` back into the loop, which
+// is the last `loop` units before `lim`
+STATIC uint32_t synth_dds_wrap(uint64_t accum, uint32_t lim, uint32_t loop) {
+    if (accum >= lim) {
+        accum = lim - loop + (accum - lim) % loop;
+    }
+    return accum;
+}
+
+// Render `dur` samples of `waveform` into `block` by direct digital synthesis,
+// returning the updated phase accumulator. When the phase reaches `lim` it
+// goes back by `loop`: for a plain waveform the two are equal, while a sample
+// plays from its start once and then repeats between its loop points.
+//
+// The phase is advanced in runs that end just before it wraps, so the inner
+// loop has no range check and comes down to an add, a shift and a load per
+// sample.
+STATIC uint32_t synth_dds_fill(int16_t *block, const int16_t *waveform, uint32_t accum, uint32_t dds_rate, uint32_t lim, uint32_t loop, uint16_t dur) {
+    // can happen if note waveform or loop points get set mid-note, but the expensive modulo is usually avoided
+    accum = synth_dds_wrap(accum, lim, loop);
+
+    int16_t *end = block + dur;
+    while (block < end) {
+        uint32_t run = dds_rate ? (lim - 1 - accum) / dds_rate : UINT32_MAX;
+        int16_t *run_end = (uint32_t)(end - block) > run ? block + run : end;
+        while (block < run_end) {
+            accum += dds_rate;
+            *block++ = waveform[accum >> SYNTHIO_FREQUENCY_SHIFT];
+        }
+        if (block < end) {
+            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+            accum += dds_rate - loop;
+            *block++ = waveform[accum >> SYNTHIO_FREQUENCY_SHIFT];
+        }
+    }
+    return accum;
+}
+
+// Advance a phase accumulator by `dur` samples without rendering them
+STATIC uint32_t synth_dds_skip(uint32_t accum, uint32_t dds_rate, uint32_t lim, uint32_t loop, uint16_t dur) {
+    return synth_dds_wrap(accum + (uint64_t)dds_rate * dur, lim, loop);
+}
+
+// Scale a block of samples by the per-channel loudness and add it to the output
+STATIC void synth_block_accumulate(int32_t *out_buffer32, const int16_t *block, uint16_t dur, int synth_chan, const uint16_t loudness[2]) {
+    int32_t left = loudness[0];
+    if (synth_chan == 1) {
+        for (uint16_t i = 0; i < dur; i++) {
+            out_buffer32[i] += (block[i] * left) / 65536;
+        }
+    } else {
+        int32_t right = loudness[1];
+        for (uint16_t i = 0; i < dur; i++) {
+            *out_buffer32++ += (block[i] * left) / 65536;
+            *out_buffer32++ += (block[i] * right) / 65536;
+        }
+    }
+}
+
 static void synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
@@ -193,11 +252,18 @@ static void synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     uint32_t dds_rate;
     const int16_t *waveform = synth->waveform_bufinfo.buf;
     uint32_t waveform_length = synth->waveform_bufinfo.len;
+    uint32_t loop_start = 0, loop_end = waveform_length;
+
+    // when morphing, the block is interpolated towards the same point in this waveform
+    const int16_t *morph_waveform = NULL;
+    int32_t morph_frac = 0;
 
     uint32_t ring_dds_rate = 0;
     const int16_t *ring_waveform = NULL;
     uint32_t ring_waveform_length = 0;
 
+    synthio_note_obj_t *biquad_note = NULL;
+
     if (mp_obj_is_small_int(note_obj)) {
         uint8_t note = mp_obj_get_int(note_obj);
         uint8_t octave = note / 12;
@@ -215,7 +281,21 @@ static void synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
             waveform = note->waveform_buf.buf;
             waveform_length = note->waveform_buf.len;
         }
-        dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * waveform_length, sample_rate);
+        uint32_t frames = MIN(note->waveform_frames, waveform_length / 2);
+        if (frames > 1) {
+            // a wavetable of equal length waveforms, `morph` selects the position within it
+            waveform_length /= frames;
+            mp_float_t morph = synthio_block_slot_get_limited(&note->morph, MICROPY_FLOAT_CONST(0.), frames - 1);
+            uint32_t frame = (uint32_t)morph;
+            morph_frac = (int32_t)((morph - frame) * 32768);
+            waveform += frame * waveform_length;
+            if (morph_frac && frame + 1 < frames) {
+                morph_waveform = waveform + waveform_length;
+            }
+        }
+        loop_end = MAX(1, MIN(note->waveform_loop_end, waveform_length));
+        loop_start = MIN(note->waveform_loop_start, loop_end - 1);
+        dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (loop_end - loop_start), sample_rate);
         if (note->ring_frequency_scaled != 0 && note->ring_waveform_buf.buf) {
             ring_waveform = note->ring_waveform_buf.buf;
             ring_waveform_length = note->ring_waveform_buf.len;
@@ -225,106 +305,94 @@ static void synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
                 ring_dds_rate = 0; // can't ring at that frequency
             }
         }
+        if (note->biquad) {
+            biquad_note = note;
+        }
     }
 
-    int synth_chan = synth->channel_count;
-    if (ring_dds_rate) {
-        uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-        uint32_t accum = synth->accum[chan];
+    uint32_t lim = loop_end << SYNTHIO_FREQUENCY_SHIFT;
+    uint32_t loop = (loop_end - loop_start) << SYNTHIO_FREQUENCY_SHIFT;
+    if (dds_rate > loop / 2) {
+        // beyond nyquist, can't play note
+        return;
+    }
 
-        if (dds_rate > lim / 2) {
-            // beyond nyquist, can't play note
-            return;
+    int synth_chan = synth->channel_count;
+    if (loudness[0] == 0 && (synth_chan == 1 || loudness[1] == 0)) {
+        // silent (e.g., amplitude 0), so keep the phase moving without rendering anything
+        synth->accum[chan] = synth_dds_skip(synth->accum[chan], dds_rate, lim, loop, dur);
+        if (ring_dds_rate) {
+            uint32_t ring_lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+            synth->ring_accum[chan] = synth_dds_skip(synth->ring_accum[chan], ring_dds_rate, ring_lim, ring_lim, dur);
         }
+        return;
+    }
 
-        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-        if (accum > lim) {
-            accum %= lim;
-        }
+    int16_t block[dur];
+    uint32_t accum = synth->accum[chan];
+    synth->accum[chan] = synth_dds_fill(block, waveform, accum, dds_rate, lim, loop, dur);
 
-        int32_t ring_buffer[dur];
-        // first, fill with waveform
+    if (morph_waveform) {
+        int16_t morph_block[dur];
+        synth_dds_fill(morph_block, morph_waveform, accum, dds_rate, lim, loop, dur);
         for (uint16_t i = 0; i < dur; i++) {
-            accum += dds_rate;
-            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-            if (accum > lim) {
-                accum -= lim;
-            }
-            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            ring_buffer[i] = waveform[idx];
-        }
-        synth->accum[chan] = accum;
-
-        // now modulate by ring and accumulate
-        accum = synth->ring_accum[chan];
-        lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-
-        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-        if (accum > lim) {
-            accum %= lim;
-        }
-
-        for (uint16_t i = 0, j = 0; i < dur; i++) {
-            accum += ring_dds_rate;
-            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-            if (accum > lim) {
-                accum -= lim;
-            }
-            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = (ring_waveform[idx] * ring_buffer[i]) / 32768;
-            for (int c = 0; c < synth_chan; c++) {
-                out_buffer32[j] += (wi * loudness[c]) / 32768;
-                j++;
-            }
-        }
-        synth->ring_accum[chan] = accum;
-    } else {
-        uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-        uint32_t accum = synth->accum[chan];
-
-        if (dds_rate > lim / 2) {
-            // beyond nyquist, can't play note
-            return;
+            block[i] += ((morph_block[i] - block[i]) * morph_frac) >> 15;
         }
+    }
 
-        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-        if (accum > lim) {
-            accum %= lim;
+    if (ring_dds_rate) {
+        int16_t ring_block[dur];
+        uint32_t ring_lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+        synth->ring_accum[chan] = synth_dds_fill(ring_block, ring_waveform, synth->ring_accum[chan], ring_dds_rate, ring_lim, ring_lim, dur);
+        for (uint16_t i = 0; i < dur; i++) {
+            block[i] = (ring_block[i] * block[i]) / 32768;
         }
+        // ring modulated samples are scaled by 1/32768 rather than 1/65536
+        loudness[0] *= 2;
+        loudness[1] *= 2;
+    }
 
-        for (uint16_t i = 0, j = 0; i < dur; i++) {
-            accum += dds_rate;
-            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-            if (accum > lim) {
-                accum -= lim;
-            }
-            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = waveform[idx];
-            for (int c = 0; c < synth_chan; c++) {
-                out_buffer32[j] += (wi * loudness[c]) / 65536;
-                j++;
-            }
-        }
-        synth->accum[chan] = accum;
+    if (biquad_note) {
+        synthio_biquad_update(biquad_note->biquad, sample_rate);
+        synthio_biquad_filter_samples(biquad_note->biquad, &biquad_note->filter_state, block, dur);
     }
+
+    synth_block_accumulate(out_buffer32, block, dur, synth_chan, loudness);
 }
 
 STATIC void run_fir(synthio_synth_t *synth, int32_t *out_buffer32, uint16_t dur) {
-    int16_t *coeff = (int16_t *)synth->filter_bufinfo.buf;
     size_t fir_len = synth->filter_bufinfo.len;
     int32_t *in_buf = synth->filter_buffer;
 
+    // shift 5 here is good for up to 32 filtered voices, else might wrap
+    int16_t coeff[fir_len];
+    for (size_t j = 0; j < fir_len; j++) {
+        coeff[j] = ((int16_t *)synth->filter_bufinfo.buf)[j] >> 5;
+    }
 
     int synth_chan = synth->channel_count;
     // FIR and copy values to output buffer
-    for (int16_t i = 0; i < dur * synth_chan; i++) {
-        int32_t acc = 0;
-        for (size_t j = 0; j < fir_len; j++) {
-            // shift 5 here is good for up to 32 filtered voices, else might wrap
-            acc = acc + (in_buf[j * synth_chan] * (coeff[j] >> 5));
+    if (synth_chan == 1) {
+        for (uint16_t i = 0; i < dur; i++) {
+            int32_t acc = 0;
+            for (size_t j = 0; j < fir_len; j++) {
+                acc += in_buf[j] * coeff[j];
+            }
+            *out_buffer32++ = acc >> 10;
+            in_buf++;
+        }
+    } else {
+        // both channels share each coefficient load
+        for (uint16_t i = 0; i < dur; i++) {
+            int32_t acc_l = 0, acc_r = 0;
+            for (size_t j = 0; j < fir_len; j++) {
+                acc_l += in_buf[2 * j] * coeff[j];
+                acc_r += in_buf[2 * j + 1] * coeff[j];
+            }
+            *out_buffer32++ = acc_l >> 10;
+            *out_buffer32++ = acc_r >> 10;
+            in_buf += 2;
         }
-        *out_buffer32++ = acc >> 10;
-        in_buf++;
     }
 
     // Move values down so that they get filtered next time
@@ -480,7 +548,7 @@ STATIC void parse_common(mp_buffer_info_t *bufinfo, mp_obj_t o, int16_t what, mp
 
 void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t waveform_obj) {
     *bufinfo_waveform = ((mp_buffer_info_t) { .buf = (void *)square_wave, .len = 2 });
-    parse_common(bufinfo_waveform, waveform_obj, MP_QSTR_waveform, 16384);
+    parse_common(bufinfo_waveform, waveform_obj, MP_QSTR_waveform, SYNTHIO_WAVEFORM_MAX_LENGTH);
 }
 
 void synthio_synth_parse_filter(mp_buffer_info_t *bufinfo_filter, mp_obj_t filter_obj) {
@@ -33,6 +33,7 @@
 #define SYNTHIO_NOTE_IS_SIMPLE(note) (mp_obj_is_small_int(note))
 #define SYNTHIO_NOTE_IS_PLAYING(synth, i) ((synth)->envelope_state[(i)].state != SYNTHIO_ENVELOPE_STATE_RELEASE)
 #define SYNTHIO_FREQUENCY_SHIFT (16)
+#define SYNTHIO_WAVEFORM_MAX_LENGTH (16384)
 
 #include "shared-module/audiocore/__init__.h"
 
@@ -35,6 +35,37 @@
 #include "shared-bindings/supervisor/StatusBar.h"
 #endif
 
+// Printable characters are collected into a run and written to the scroll area
+// together, so a line of text marks a single dirty area instead of one per
+// character.
+#define TERMINAL_RUN_LENGTH (64)
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t length;
+    uint8_t tiles[TERMINAL_RUN_LENGTH];
+} terminal_run_t;
+
+STATIC void terminal_run_flush(terminalio_terminal_obj_t *self, terminal_run_t *run) {
+    if (run->length > 0) {
+        common_hal_displayio_tilegrid_set_tile_run(self->scroll_area, run->x, run->y, run->tiles, run->length);
+        run->length = 0;
+    }
+}
+
+STATIC void terminal_run_append(terminalio_terminal_obj_t *self, terminal_run_t *run, uint8_t tile_index) {
+    if (run->length == TERMINAL_RUN_LENGTH) {
+        terminal_run_flush(self, run);
+    }
+    if (run->length == 0) {
+        run->x = self->cursor_x;
+        run->y = self->cursor_y;
+    }
+    run->tiles[run->length++] = tile_index;
+    self->cursor_x++;
+}
+
 void terminalio_terminal_clear_status_bar(terminalio_terminal_obj_t *self) {
     if (self->status_bar) {
         common_hal_displayio_tilegrid_set_all_tiles(self->status_bar, 0);
@@ -68,9 +99,15 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
 
     const byte *i = data;
     uint16_t start_y = self->cursor_y;
+    terminal_run_t run;
+    run.length = 0;
     while (i < data + len) {
         unichar c = utf8_get_char(i);
         i = utf8_next_char(i);
+        bool printable = !self->in_osc_command && ((c >= 0x20 && c <= 0x7e) || c >= 128);
+        if (!printable) {
+            terminal_run_flush(self, &run);
+        }
         if (self->in_osc_command) {
             if (c == 0x1b && i[0] == '\\') {
                 self->in_osc_command = false;
@@ -101,8 +138,7 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
         if (c < 128) {
             if (c >= 0x20 && c <= 0x7e) {
                 uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
-                common_hal_displayio_tilegrid_set_tile(self->scroll_area, self->cursor_x, self->cursor_y, tile_index);
-                self->cursor_x++;
+                terminal_run_append(self, &run, tile_index);
             } else if (c == '\r') {
                 self->cursor_x = 0;
             } else if (c == '\n') {
@@ -127,9 +163,8 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 if (i[0] == '[') {
                     if (i[1] == 'K') {
                         // Clear the rest of the line.
-                        for (uint16_t k = self->cursor_x; k < self->scroll_area->width_in_tiles; k++) {
-                            common_hal_displayio_tilegrid_set_tile(self->scroll_area, k, self->cursor_y, 0);
-                        }
+                        common_hal_displayio_tilegrid_fill_tile_run(self->scroll_area, self->cursor_x, self->cursor_y, 0,
+                            self->scroll_area->width_in_tiles - self->cursor_x);
                         i += 2;
                     } else {
                         if (c == 'D') {
@@ -188,9 +223,7 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
         } else {
             uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
             if (tile_index != 0xff) {
-                common_hal_displayio_tilegrid_set_tile(self->scroll_area, self->cursor_x, self->cursor_y, tile_index);
-                self->cursor_x++;
-
+                terminal_run_append(self, &run, tile_index);
             }
         }
         if (self->cursor_x >= self->scroll_area->width_in_tiles) {
@@ -201,16 +234,17 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
             self->cursor_y %= self->scroll_area->height_in_tiles;
         }
         if (self->cursor_y != start_y) {
+            terminal_run_flush(self, &run);
             // clear the new row in case of scroll up
             if (self->cursor_y == self->scroll_area->top_left_y) {
-                for (uint16_t j = 0; j < self->scroll_area->width_in_tiles; j++) {
-                    common_hal_displayio_tilegrid_set_tile(self->scroll_area, j, self->cursor_y, 0);
-                }
+                common_hal_displayio_tilegrid_fill_tile_run(self->scroll_area, 0, self->cursor_y, 0,
+                    self->scroll_area->width_in_tiles);
                 common_hal_displayio_tilegrid_set_top_left(self->scroll_area, 0, (self->cursor_y + self->scroll_area->height_in_tiles + 1) % self->scroll_area->height_in_tiles);
             }
             start_y = self->cursor_y;
         }
     }
+    terminal_run_flush(self, &run);
     return i - data;
 }
 
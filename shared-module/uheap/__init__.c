@@ -33,17 +33,15 @@
 #include "py/objarray.h"
 #include "py/objfun.h"
 #include "py/objint.h"
+#include "py/objlist.h"
+#include "py/objmodule.h"
 #include "py/objstr.h"
+#include "py/objtuple.h"
 #include "py/objtype.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/uheap/__init__.h"
 
-#define VERIFY_PTR(ptr) ( \
-    (void *)ptr >= (void *)MP_STATE_MEM(gc_pool_start)         /* must be above start of pool */ \
-    && (void *)ptr < (void *)MP_STATE_MEM(gc_pool_end)            /* must be below end of pool */ \
-    )
-
 static void indent(uint8_t levels) {
     for (int i = 0; i < levels; i++) {
         mp_printf(&mp_plat_print, "  ");
@@ -56,7 +54,7 @@ static uint32_t int_size(uint8_t indent_level, mp_obj_t obj) {
     if (mp_obj_is_small_int(obj)) {
         return 0;
     }
-    if (!VERIFY_PTR(obj)) {
+    if (!HEAP_PTR((void *)obj)) {
         return 0;
     }
     #if MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_MPZ
@@ -71,7 +69,7 @@ static uint32_t string_size(uint8_t indent_level, mp_obj_t obj) {
     if (mp_obj_is_qstr(obj)) {
         qstr qs = MP_OBJ_QSTR_VALUE(obj);
         const char *s = qstr_str(qs);
-        if (!VERIFY_PTR(s)) {
+        if (!HEAP_PTR((void *)s)) {
             return 0;
         }
         indent(indent_level);
@@ -85,7 +83,7 @@ static uint32_t string_size(uint8_t indent_level, mp_obj_t obj) {
 
 static uint32_t map_size(uint8_t indent_level, const mp_map_t *map) {
     uint32_t total_size = gc_nbytes(map->table);
-    for (int i = 0; i < map->used; i++) {
+    for (size_t i = 0; i < map->used; i++) {
         uint32_t this_size = 0;
         indent(indent_level);
         if (map->table[i].key != NULL) {
@@ -135,7 +133,7 @@ static uint32_t function_size(uint8_t indent_level, mp_obj_t obj) {
         uint32_t total_size = gc_nbytes(fn) + gc_nbytes(fn->bytecode) + gc_nbytes(fn->const_table);
         #if MICROPY_DEBUG_PRINTERS
         mp_printf(&mp_plat_print, "BYTECODE START\n");
-        mp_bytecode_print(fn, fn->bytecode, gc_nbytes(fn->bytecode), fn->const_table);
+        mp_bytecode_print(&mp_plat_print, fn, fn->bytecode, gc_nbytes(fn->bytecode), fn->const_table);
         mp_printf(&mp_plat_print, "BYTECODE END\n");
         #endif
         return total_size;
@@ -143,14 +141,6 @@ static uint32_t function_size(uint8_t indent_level, mp_obj_t obj) {
     } else if (mp_obj_is_type(obj, &mp_type_fun_native)) {
         return 0;
     #endif
-    #if MICROPY_EMIT_NATIVE
-    } else if (mp_obj_is_type(obj, &mp_obj_fun_viper_t)) {
-        return 0;
-    #endif
-    #if MICROPY_EMIT_THUMB
-    } else if (mp_obj_is_type(obj, &mp_type_fun_asm)) {
-        return 0;
-    #endif
     }
     return 0;
 }
@@ -257,7 +247,7 @@ static uint32_t object_size(uint8_t indent_level, mp_obj_t obj) {
     } else if (mp_obj_is_fun(obj)) {
         return function_size(indent_level, MP_OBJ_TO_PTR(obj));
     }
-    if (!VERIFY_PTR(obj)) {
+    if (!HEAP_PTR((void *)obj)) {
         // indent(indent_level);
         // mp_printf(&mp_plat_print, "In ROM\n");
         return 0;
@@ -274,7 +264,7 @@ static uint32_t object_size(uint8_t indent_level, mp_obj_t obj) {
         return array_size(indent_level, MP_OBJ_TO_PTR(obj));
     } else if (type == &mp_type_memoryview) {
         return memoryview_size(indent_level, MP_OBJ_TO_PTR(obj));
-    } else if (mp_obj_is_obj(obj) && VERIFY_PTR(type)) {
+    } else if (mp_obj_is_obj(obj) && HEAP_PTR((void *)type)) {
         return instance_size(indent_level, MP_OBJ_TO_PTR(obj));
     }
 
@@ -284,9 +274,201 @@ static uint32_t object_size(uint8_t indent_level, mp_obj_t obj) {
 }
 
 uint32_t shared_module_uheap_info(mp_obj_t obj) {
-    if (!VERIFY_PTR(obj)) {
+    if (!HEAP_PTR((void *)obj)) {
         mp_printf(&mp_plat_print, "Object not on heap.\n");
         return 0;
     }
     return object_size(0, obj);
 }
+
+#if MICROPY_GC_CENSUS
+// Types that instances on the heap are counted against. Objects are only told apart from other
+// allocations by their first word matching one of these, so that nothing else is dereferenced.
+typedef struct {
+    const mp_obj_type_t **types;
+    size_t len;
+    size_t alloc;
+} census_types_t;
+
+static void census_add_type(census_types_t *types, const mp_obj_type_t *type) {
+    if (types->len == types->alloc) {
+        size_t alloc = types->alloc * 2;
+        types->types = m_renew(const mp_obj_type_t *, types->types, types->alloc, alloc);
+        types->alloc = alloc;
+    }
+    types->types[types->len++] = type;
+}
+
+static void census_add_module_types(census_types_t *types, mp_obj_t module) {
+    if (!mp_obj_is_type(module, &mp_type_module)) {
+        return;
+    }
+    mp_map_t *globals = &((mp_obj_module_t *)MP_OBJ_TO_PTR(module))->globals->map;
+    for (size_t i = 0; i < globals->alloc; i++) {
+        if (mp_map_slot_is_filled(globals, i) && mp_obj_is_type(globals->table[i].value, &mp_type_type)) {
+            census_add_type(types, MP_OBJ_TO_PTR(globals->table[i].value));
+        }
+    }
+}
+
+static void census_sort_types(census_types_t *types) {
+    const mp_obj_type_t **t = types->types;
+    for (size_t i = 1; i < types->len; i++) {
+        const mp_obj_type_t *type = t[i];
+        size_t j = i;
+        for (; j > 0 && t[j - 1] > type; j--) {
+            t[j] = t[j - 1];
+        }
+        t[j] = type;
+    }
+    size_t len = 0;
+    for (size_t i = 0; i < types->len; i++) {
+        if (len == 0 || t[len - 1] != t[i]) {
+            t[len++] = t[i];
+        }
+    }
+    types->len = len;
+}
+
+static size_t census_find_type(const census_types_t *types, const void *type) {
+    size_t lo = 0;
+    size_t hi = types->len;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if ((const void *)types->types[mid] < type) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < types->len && (const void *)types->types[lo] == type ? lo : types->len;
+}
+
+// The storage an object owns in a separate allocation, counted with the object instead of
+// as an unknown allocation.
+static size_t census_owned_bytes(const mp_obj_type_t *type, void *obj) {
+    if (type == &mp_type_str || type == &mp_type_bytes) {
+        return gc_nbytes(((mp_obj_str_t *)obj)->data);
+    } else if (type == &mp_type_list) {
+        return gc_nbytes(((mp_obj_list_t *)obj)->items);
+    } else if (type == &mp_type_dict) {
+        return gc_nbytes(((mp_obj_dict_t *)obj)->map.table);
+    } else if (type == &mp_type_bytearray || type == &mp_type_array) {
+        return gc_nbytes(((mp_obj_array_t *)obj)->items);
+    } else if (HEAP_PTR((void *)type) && type != &mp_type_type) {
+        // An instance of a class.
+        return gc_nbytes(((mp_obj_instance_t *)obj)->members.table);
+    }
+    return 0;
+}
+
+static const mp_obj_type_t *const census_core_types[] = {
+    &mp_type_type,
+    &mp_type_module,
+    &mp_type_fun_bc,
+    &mp_type_gen_instance,
+    &mp_type_traceback,
+    &mp_type_map,
+};
+
+mp_obj_t shared_module_uheap_census(void) {
+    gc_collect();
+
+    census_types_t types = { .types = m_new(const mp_obj_type_t *, 64), .len = 0, .alloc = 64 };
+    for (size_t i = 0; i < MP_ARRAY_SIZE(census_core_types); i++) {
+        census_add_type(&types, census_core_types[i]);
+    }
+    for (size_t i = 0; i < mp_builtin_module_map.alloc; i++) {
+        if (mp_map_slot_is_filled(&mp_builtin_module_map, i)) {
+            census_add_module_types(&types, mp_builtin_module_map.table[i].value);
+        }
+    }
+    mp_map_t *modules = &MP_STATE_VM(mp_loaded_modules_dict).map;
+    for (size_t i = 0; i < modules->alloc; i++) {
+        if (mp_map_slot_is_filled(modules, i)) {
+            census_add_module_types(&types, modules->table[i].value);
+        }
+    }
+    // Classes defined at runtime, including those that aren't module globals.
+    size_t n_bytes;
+    for (void *ptr = gc_census_next(NULL, &n_bytes); ptr != NULL; ptr = gc_census_next(ptr, &n_bytes)) {
+        if (*(void **)ptr == &mp_type_type) {
+            census_add_type(&types, ptr);
+        }
+    }
+    census_sort_types(&types);
+
+    // The last entry counts the allocations that aren't objects of a known type.
+    size_t *counts = m_new0(size_t, types.len + 1);
+    size_t *type_bytes = m_new0(size_t, types.len + 1);
+    // sys.modules, followed by the globals of __main__.
+    size_t max_roots = modules->used + 1;
+    void **roots = m_new(void *, max_roots);
+    mp_obj_t *root_names = m_new(mp_obj_t, max_roots);
+    size_t *retained = m_new(size_t, max_roots);
+
+    // Nothing may be allocated while the heap is walked.
+    gc_lock();
+    size_t owned_count = 0;
+    size_t owned_bytes_total = 0;
+    for (void *ptr = gc_census_next(NULL, &n_bytes); ptr != NULL; ptr = gc_census_next(ptr, &n_bytes)) {
+        // The census's own buffers aren't counted.
+        if (ptr == types.types || ptr == counts || ptr == type_bytes || ptr == roots ||
+            ptr == root_names || ptr == retained) {
+            continue;
+        }
+        const mp_obj_type_t *type = *(const mp_obj_type_t **)ptr;
+        size_t i = census_find_type(&types, type);
+        counts[i]++;
+        type_bytes[i] += n_bytes;
+        if (i < types.len) {
+            size_t owned_bytes = census_owned_bytes(type, ptr);
+            if (owned_bytes > 0) {
+                type_bytes[i] += owned_bytes;
+                owned_bytes_total += owned_bytes;
+                owned_count++;
+            }
+        }
+    }
+    size_t n_roots = 0;
+    for (size_t i = 0; i < modules->alloc; i++) {
+        if (mp_map_slot_is_filled(modules, i)) {
+            root_names[n_roots] = modules->table[i].key;
+            roots[n_roots++] = MP_OBJ_TO_PTR(modules->table[i].value);
+        }
+    }
+    root_names[n_roots] = MP_OBJ_NEW_QSTR(MP_QSTR___main__);
+    roots[n_roots++] = MP_STATE_VM(dict_main).map.table;
+    gc_census_retained(roots, n_roots, retained);
+    gc_unlock();
+
+    // The unknown allocations include the storage counted with its owner above.
+    size_t unknown = types.len;
+    counts[unknown] -= MIN(counts[unknown], owned_count);
+    type_bytes[unknown] -= MIN(type_bytes[unknown], owned_bytes_total);
+
+    mp_obj_t type_dict = mp_obj_new_dict(0);
+    for (size_t i = 0; i <= types.len; i++) {
+        if (counts[i] == 0) {
+            continue;
+        }
+        mp_obj_t key = i == unknown ? mp_const_none : MP_OBJ_FROM_PTR(types.types[i]);
+        mp_obj_t value[2] = { mp_obj_new_int_from_uint(counts[i]), mp_obj_new_int_from_uint(type_bytes[i]) };
+        mp_obj_dict_store(type_dict, key, mp_obj_new_tuple(2, value));
+    }
+    mp_obj_t module_dict = mp_obj_new_dict(n_roots);
+    for (size_t i = 0; i < n_roots; i++) {
+        mp_obj_dict_store(module_dict, root_names[i], mp_obj_new_int_from_uint(retained[i]));
+    }
+
+    m_del(const mp_obj_type_t *, types.types, types.alloc);
+    m_del(size_t, counts, types.len + 1);
+    m_del(size_t, type_bytes, types.len + 1);
+    m_del(void *, roots, max_roots);
+    m_del(mp_obj_t, root_names, max_roots);
+    m_del(size_t, retained, max_roots);
+
+    mp_obj_t result[2] = { type_dict, module_dict };
+    return mp_obj_new_tuple(2, result);
+}
+#endif
@@ -28,6 +28,7 @@
 #include "shared-bindings/usb_cdc/Serial.h"
 #include "shared-module/usb_cdc/Serial.h"
 #include "supervisor/shared/tick.h"
+#include "supervisor/usb.h"
 
 #include "tusb.h"
 
@@ -84,8 +85,10 @@ size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t
 
     // Write as many bytes as possible immediately.
     // The number of bytes written at once will not be larger than what can fit in the TinyUSB FIFO.
+    // TinyUSB sends each full packet as it is queued. A partial packet is left
+    // for usb_background() so that small writes close together share packets.
     uint32_t total_num_written = tud_cdc_n_write(self->idx, data, len);
-    tud_cdc_n_write_flush(self->idx);
+    usb_background_schedule();
 
     if (wait_forever || wait_for_timeout) {
         // Continue writing the rest of the buffer.
@@ -113,7 +116,6 @@ size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t
 
             // Try to write another batch of bytes.
             num_written = tud_cdc_n_write(self->idx, data, len);
-            tud_cdc_n_write_flush(self->idx);
             total_num_written += num_written;
         }
     }
@@ -165,6 +165,78 @@ const usb_hid_device_obj_t usb_hid_device_consumer_control_obj = {
     .out_report_lengths = { 0, },
 };
 
+// IN reports waiting for the host to poll. All the devices share one IN endpoint, so they
+// share this queue. send_report() adds to it, and tud_hid_report_complete_cb() sends the
+// next report as soon as the host has taken the previous one.
+typedef struct {
+    uint8_t report_id;
+    uint8_t len;
+    uint8_t report[CFG_TUD_HID_EP_BUFSIZE];
+} queued_report_t;
+
+static queued_report_t report_queue[CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH];
+// Free-running counts of reports queued and sent. Only send_report() advances
+// report_queue_head, and only send_queued_reports() advances report_queue_tail.
+static uint8_t report_queue_head;
+static uint8_t report_queue_tail;
+
+#define QUEUED_REPORT(n) (&report_queue[(uint8_t)(n) % CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH])
+
+#if CFG_TUSB_OS == OPT_OS_NONE
+// TinyUSB callbacks run as background tasks, never in the middle of send_report().
+#define REPORT_QUEUE_TRY_LOCK() (true)
+#define REPORT_QUEUE_UNLOCK()
+#else
+// TinyUSB runs in its own task, which may send from the queue at the same time as the VM.
+static bool report_queue_locked;
+#define REPORT_QUEUE_TRY_LOCK() (!__atomic_test_and_set(&report_queue_locked, __ATOMIC_ACQUIRE))
+#define REPORT_QUEUE_UNLOCK() __atomic_clear(&report_queue_locked, __ATOMIC_RELEASE)
+#endif
+
+STATIC uint8_t report_queue_length(void) {
+    return __atomic_load_n(&report_queue_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&report_queue_tail, __ATOMIC_ACQUIRE);
+}
+
+STATIC void send_queued_reports(void) {
+    // Whoever holds the lock sends. If the endpoint frees up while the other side holds it,
+    // that side sees it on its next time around.
+    while (report_queue_length() > 0 && tud_hid_ready()) {
+        if (!REPORT_QUEUE_TRY_LOCK()) {
+            return;
+        }
+        if (report_queue_length() > 0) {
+            queued_report_t *queued = QUEUED_REPORT(report_queue_tail);
+            // tud_hid_report() copies the report, so the entry can be reused right away.
+            if (tud_hid_report(queued->report_id, queued->report, queued->len)) {
+                __atomic_store_n(&report_queue_tail, report_queue_tail + 1, __ATOMIC_RELEASE);
+            }
+        }
+        REPORT_QUEUE_UNLOCK();
+    }
+}
+
+// Replace the most recently queued report with this report id, if it has not been sent yet.
+STATIC bool replace_queued_report(uint8_t report_id, const uint8_t *report) {
+    if (!REPORT_QUEUE_TRY_LOCK()) {
+        return false;
+    }
+    bool replaced = false;
+    for (uint8_t i = report_queue_head; i != report_queue_tail; i--) {
+        queued_report_t *queued = QUEUED_REPORT(i - 1);
+        if (queued->report_id == report_id) {
+            memcpy(queued->report, report, queued->len);
+            replaced = true;
+            break;
+        }
+    }
+    REPORT_QUEUE_UNLOCK();
+    return replaced;
+}
+
+void usb_hid_device_clear_report_queue(void) {
+    report_queue_tail = report_queue_head;
+}
+
 STATIC size_t get_report_id_idx(usb_hid_device_obj_t *self, size_t report_id) {
     for (size_t i = 0; i < self->num_report_ids; i++) {
         if (report_id == self->report_ids[i]) {
@@ -218,25 +290,47 @@ uint16_t common_hal_usb_hid_device_get_usage(usb_hid_device_obj_t *self) {
     return self->usage;
 }
 
-void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id) {
+void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id, bool coalesce) {
     // report_id and len have already been validated for this device.
     size_t id_idx = get_report_id_idx(self, report_id);
 
     mp_arg_validate_length(len, self->in_report_lengths[id_idx], MP_QSTR_report);
 
-    // Wait until interface is ready, timeout = 2 seconds
+    // The last report sent or queued, which is also what GET_REPORT returns.
+    uint8_t *last_report = self->in_report_buffers[id_idx];
+    if (coalesce && last_report) {
+        if (memcmp(last_report, report, len) == 0) {
+            return;
+        }
+        // The host only needs to see the newest state, so replace a report it hasn't taken yet.
+        if (replace_queued_report(report_id, report)) {
+            memcpy(last_report, report, len);
+            return;
+        }
+    }
+
+    // Wait until interface is ready and there's room in the queue, timeout = 2 seconds
     uint64_t end_ticks = supervisor_ticks_ms64() + 2000;
-    while ((supervisor_ticks_ms64() < end_ticks) && !tud_hid_ready()) {
+    while ((supervisor_ticks_ms64() < end_ticks) &&
+           (!tud_ready() || report_queue_length() == CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH)) {
         RUN_BACKGROUND_TASKS;
     }
 
-    if (!tud_hid_ready()) {
+    if (!tud_ready() || report_queue_length() == CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH) {
         mp_raise_msg(&mp_type_OSError, translate("USB busy"));
     }
 
-    if (!tud_hid_report(report_id, report, len)) {
-        mp_raise_msg(&mp_type_OSError, translate("USB error"));
+    queued_report_t *queued = QUEUED_REPORT(report_queue_head);
+    queued->report_id = report_id;
+    // TinyUSB sends at most this much of a report anyway.
+    queued->len = MIN(len, sizeof(queued->report));
+    memcpy(queued->report, report, queued->len);
+    __atomic_store_n(&report_queue_head, report_queue_head + 1, __ATOMIC_RELEASE);
+    if (last_report) {
+        memcpy(last_report, report, len);
     }
+
+    send_queued_reports();
 }
 
 mp_obj_t common_hal_usb_hid_device_get_last_received_report(usb_hid_device_obj_t *self, uint8_t report_id) {
@@ -251,8 +345,8 @@ mp_obj_t common_hal_usb_hid_device_get_last_received_report(usb_hid_device_obj_t
 
 void usb_hid_device_create_report_buffers(usb_hid_device_obj_t *self) {
     for (size_t i = 0; i < self->num_report_ids; i++) {
-        // The IN buffers are used only for tud_hid_get_report_cb(),
-        // which is an unusual case. Normally we can just pass the data directly with tud_hid_report().
+        // The IN buffers hold the last report sent, for tud_hid_get_report_cb()
+        // and for coalescing in send_report().
         self->in_report_buffers[i] =
             self->in_report_lengths[i] > 0
             ? gc_alloc(self->in_report_lengths[i], false, true /*long-lived*/)
@@ -267,6 +361,14 @@ void usb_hid_device_create_report_buffers(usb_hid_device_obj_t *self) {
 }
 
 
+// Callback invoked when the host has taken an IN report
+void tud_hid_report_complete_cb(uint8_t instance, uint8_t const *report, uint16_t len) {
+    (void)instance;
+    (void)report;
+    (void)len;
+    send_queued_reports();
+}
+
 // Callback invoked when we receive Get_Report request through control endpoint
 uint16_t tud_hid_get_report_cb(uint8_t itf, uint8_t report_id, hid_report_type_t report_type, uint8_t *buffer, uint16_t reqlen) {
     (void)itf;
@@ -53,5 +53,6 @@ extern const usb_hid_device_obj_t usb_hid_device_mouse_obj;
 extern const usb_hid_device_obj_t usb_hid_device_consumer_control_obj;
 
 void usb_hid_device_create_report_buffers(usb_hid_device_obj_t *self);
+void usb_hid_device_clear_report_queue(void);
 
 #endif /* SHARED_MODULE_USB_HID_DEVICE_H */
@@ -66,7 +66,8 @@ static const uint8_t usb_hid_descriptor_template[] = {
 #define HID_IN_ENDPOINT_INDEX (20)
     0x03,        // 21 bmAttributes (Interrupt)
     0x40, 0x00,  // 22,23  wMaxPacketSize 64
-    0x08,        // 24 bInterval 8 (unit depends on device speed)
+    0x08,        // 24 bInterval 8 (unit depends on device speed) [SET AT RUNTIME]
+#define HID_IN_ENDPOINT_INTERVAL_INDEX (24)
 
     0x07,        // 25 bLength
     0x05,        // 26 bDescriptorType (Endpoint)
@@ -74,7 +75,8 @@ static const uint8_t usb_hid_descriptor_template[] = {
 #define HID_OUT_ENDPOINT_INDEX (27)
     0x03,        // 28 bmAttributes (Interrupt)
     0x40, 0x00,  // 29,30 wMaxPacketSize 64
-    0x08,        // 31 bInterval 8 (unit depends on device speed)
+    0x08,        // 31 bInterval 8 (unit depends on device speed) [SET AT RUNTIME]
+#define HID_OUT_ENDPOINT_INTERVAL_INDEX (31)
 };
 
 #define MAX_HID_DEVICES 8
@@ -89,6 +91,9 @@ static mp_int_t num_hid_devices;
 // The value is remembered here from boot.py to code.py.
 static uint8_t hid_boot_device;
 
+// bInterval for the HID endpoints, also set by usb_hid.enable() and remembered from boot.py to code.py.
+static uint8_t hid_poll_interval = USB_HID_DEFAULT_POLL_INTERVAL;
+
 // Whether a boot device was requested by a SET_PROTOCOL request from the host.
 static bool hid_boot_device_requested;
 
@@ -156,7 +161,8 @@ void usb_hid_set_defaults(void) {
     hid_boot_device = 0;
     hid_boot_device_requested = false;
     common_hal_usb_hid_enable(
-        CIRCUITPY_USB_HID_ENABLED_DEFAULT ? &default_hid_devices_tuple : mp_const_empty_tuple, 0);
+        CIRCUITPY_USB_HID_ENABLED_DEFAULT ? &default_hid_devices_tuple : mp_const_empty_tuple, 0,
+        USB_HID_DEFAULT_POLL_INTERVAL);
 }
 
 // This is the interface descriptor, not the report descriptor.
@@ -190,6 +196,8 @@ size_t usb_hid_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *desc
     descriptor_counts->num_in_endpoints++;
     descriptor_buf[HID_OUT_ENDPOINT_INDEX] =
         USB_HID_EP_NUM_OUT ? USB_HID_EP_NUM_OUT : descriptor_counts->current_endpoint;
+    descriptor_buf[HID_IN_ENDPOINT_INTERVAL_INDEX] = hid_poll_interval;
+    descriptor_buf[HID_OUT_ENDPOINT_INTERVAL_INDEX] = hid_poll_interval;
     descriptor_counts->num_out_endpoints++;
     descriptor_counts->current_endpoint++;
 
@@ -210,10 +218,10 @@ static void usb_hid_set_devices_from_hid_devices(void) {
 }
 
 bool common_hal_usb_hid_disable(void) {
-    return common_hal_usb_hid_enable(mp_const_empty_tuple, 0);
+    return common_hal_usb_hid_enable(mp_const_empty_tuple, 0, USB_HID_DEFAULT_POLL_INTERVAL);
 }
 
-bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device) {
+bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device, uint8_t poll_interval) {
     // We can't change the devices once we're connected.
     if (tud_connected()) {
         return false;
@@ -225,6 +233,7 @@ bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device) {
     num_hid_devices = num_devices;
 
     hid_boot_device = boot_device;
+    hid_poll_interval = poll_interval;
 
     // Remember the devices in static storage so they live across VMs.
     for (mp_int_t i = 0; i < num_hid_devices; i++) {
@@ -254,6 +263,9 @@ void usb_hid_setup_devices(void) {
 
     usb_hid_set_devices_from_hid_devices();
 
+    // Don't send reports queued by a previous VM.
+    usb_hid_device_clear_report_queue();
+
     // Create report buffers on the heap.
     for (mp_int_t i = 0; i < num_hid_devices; i++) {
         usb_hid_device_create_report_buffers(&hid_devices[i]);
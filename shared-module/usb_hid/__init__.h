@@ -30,6 +30,9 @@
 #include "shared-module/usb_hid/Device.h"
 #include "supervisor/usb.h"
 
+// bInterval for the HID endpoints, in frames at full speed.
+#define USB_HID_DEFAULT_POLL_INTERVAL (8)
+
 extern usb_hid_device_obj_t usb_hid_devices[];
 
 bool usb_hid_enabled(void);
@@ -0,0 +1,142 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/usb_host/MassStorage.h"
+
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "tusb.h"
+
+// TinyUSB limits a single endpoint transfer to 64 kiB - 1, so split larger
+// reads and writes into as few READ(10)/WRITE(10) commands as allowed.
+#define MAX_BLOCKS_PER_COMMAND (UINT16_MAX / 512)
+
+void common_hal_usb_host_massstorage_construct(usb_host_massstorage_obj_t *self, uint8_t device_number, mp_int_t lun) {
+    if (!tuh_msc_mounted(device_number)) {
+        mp_raise_OSError(MP_ENODEV);
+    }
+    mp_arg_validate_int_range(lun, 0, tuh_msc_get_maxlun(device_number) - 1, MP_QSTR_lun);
+    // FAT on CircuitPython only supports 512 byte sectors.
+    mp_arg_validate_int(tuh_msc_get_block_size(device_number, lun), 512, MP_QSTR_block_size);
+
+    self->device_number = device_number;
+    self->lun = lun;
+    self->block_count = tuh_msc_get_block_count(device_number, lun);
+    self->busy = false;
+}
+
+void common_hal_usb_host_massstorage_deinit(usb_host_massstorage_obj_t *self) {
+    self->device_number = 0;
+}
+
+bool common_hal_usb_host_massstorage_deinited(usb_host_massstorage_obj_t *self) {
+    return self->device_number == 0;
+}
+
+uint32_t common_hal_usb_host_massstorage_get_blockcount(usb_host_massstorage_obj_t *self) {
+    return self->block_count;
+}
+
+STATIC bool _command_complete_cb(uint8_t dev_addr, tuh_msc_complete_data_t const *cb_data) {
+    usb_host_massstorage_obj_t *self = (usb_host_massstorage_obj_t *)cb_data->user_arg;
+    self->status = cb_data->csw->status;
+    self->busy = false;
+    return true;
+}
+
+STATIC int _wait_until_ready(usb_host_massstorage_obj_t *self) {
+    // Another MassStorage object may be using a different LUN of the same device.
+    while (!tuh_msc_ready(self->device_number)) {
+        if (!tuh_msc_mounted(self->device_number)) {
+            return -MP_ENODEV;
+        }
+        RUN_BACKGROUND_TASKS;
+    }
+    return 0;
+}
+
+STATIC int _wait_for_command(usb_host_massstorage_obj_t *self) {
+    // Don't stop for ctrl-C. TinyUSB owns the buffer until the command
+    // completes or the device goes away.
+    while (self->busy) {
+        if (!tuh_msc_mounted(self->device_number)) {
+            return -MP_ENODEV;
+        }
+        // The background tasks include TinyUSB which will call the function
+        // we provided above. In other words, the callback isn't in an interrupt.
+        RUN_BACKGROUND_TASKS;
+    }
+    return self->status == MSC_CSW_STATUS_PASSED ? 0 : -MP_EIO;
+}
+
+STATIC int _transfer_blocks(usb_host_massstorage_obj_t *self, uint32_t start_block, uint8_t *buf, size_t len, bool write) {
+    uint32_t blocks_left = len / 512;
+    if (start_block + blocks_left > self->block_count) {
+        return -MP_EIO;
+    }
+    while (blocks_left > 0) {
+        uint16_t block_count = MIN(blocks_left, MAX_BLOCKS_PER_COMMAND);
+        int result = _wait_until_ready(self);
+        if (result < 0) {
+            return result;
+        }
+        self->busy = true;
+        bool started;
+        if (write) {
+            started = tuh_msc_write10(self->device_number, self->lun, buf, start_block, block_count, _command_complete_cb, (uintptr_t)self);
+        } else {
+            started = tuh_msc_read10(self->device_number, self->lun, buf, start_block, block_count, _command_complete_cb, (uintptr_t)self);
+        }
+        if (!started) {
+            self->busy = false;
+            return -MP_EIO;
+        }
+        result = _wait_for_command(self);
+        if (result < 0) {
+            return result;
+        }
+        start_block += block_count;
+        buf += block_count * 512;
+        blocks_left -= block_count;
+    }
+    return 0;
+}
+
+int common_hal_usb_host_massstorage_readblocks(usb_host_massstorage_obj_t *self, uint32_t start_block, uint8_t *buf, size_t len) {
+    return _transfer_blocks(self, start_block, buf, len, false);
+}
+
+int common_hal_usb_host_massstorage_writeblocks(usb_host_massstorage_obj_t *self, uint32_t start_block, const uint8_t *buf, size_t len) {
+    return _transfer_blocks(self, start_block, (uint8_t *)buf, len, true);
+}
+
+int common_hal_usb_host_massstorage_sync(usb_host_massstorage_obj_t *self) {
+    // Every write waits for the device's status, so nothing is buffered here.
+    if (!tuh_msc_mounted(self->device_number)) {
+        return -MP_ENODEV;
+    }
+    return 0;
+}
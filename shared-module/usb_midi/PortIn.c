@@ -24,15 +24,168 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-bindings/usb_midi/PortIn.h"
 #include "shared-module/usb_midi/PortIn.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate/translate.h"
 #include "tusb.h"
 
+#if CIRCUITPY_SYNTHIO
+#include "shared-bindings/synthio/Synthesizer.h"
+#endif
+
+// USB-MIDI event packets are moved out of TinyUSB's FIFO as they arrive, so each one
+// is timestamped when it was received rather than when Python got around to reading it.
+typedef struct {
+    uint32_t timestamp;
+    uint8_t packet[4];
+} midi_event_t;
+
+static midi_event_t event_queue[CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH];
+// Free-running counts of events queued and consumed. Only fill_event_queue() advances
+// event_queue_head, and only the VM advances event_queue_tail.
+static uint16_t event_queue_head;
+static uint16_t event_queue_tail;
+// How many bytes of the oldest event read() has already returned.
+static uint8_t event_bytes_read;
+
+#define QUEUED_EVENT(n) (&event_queue[(uint16_t)(n) % CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH])
+
+#if CFG_TUSB_OS == OPT_OS_NONE
+// TinyUSB callbacks run as background tasks, never in the middle of a read.
+#define EVENT_QUEUE_TRY_LOCK() (true)
+#define EVENT_QUEUE_UNLOCK()
+#else
+// TinyUSB runs in its own task, which may fill the queue at the same time as the VM.
+static bool event_queue_locked;
+#define EVENT_QUEUE_TRY_LOCK() (!__atomic_test_and_set(&event_queue_locked, __ATOMIC_ACQUIRE))
+#define EVENT_QUEUE_UNLOCK() __atomic_clear(&event_queue_locked, __ATOMIC_RELEASE)
+#endif
+
+STATIC uint16_t event_queue_length(void) {
+    return __atomic_load_n(&event_queue_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&event_queue_tail, __ATOMIC_ACQUIRE);
+}
+
+// Packets that don't fit stay in TinyUSB's FIFO, and are moved over as the queue drains.
+STATIC void fill_event_queue(void) {
+    if (!EVENT_QUEUE_TRY_LOCK()) {
+        return;
+    }
+    uint32_t now = supervisor_ticks_ms32();
+    while (event_queue_length() < CIRCUITPY_USB_MIDI_EVENT_QUEUE_LENGTH) {
+        midi_event_t *event = QUEUED_EVENT(event_queue_head);
+        if (!tud_midi_packet_read(event->packet)) {
+            break;
+        }
+        event->timestamp = now;
+        __atomic_store_n(&event_queue_head, event_queue_head + 1, __ATOMIC_RELEASE);
+    }
+    EVENT_QUEUE_UNLOCK();
+}
+
+STATIC void pop_event(void) {
+    event_bytes_read = 0;
+    __atomic_store_n(&event_queue_tail, event_queue_tail + 1, __ATOMIC_RELEASE);
+}
+
+// Number of MIDI bytes in a packet, from its Code Index Number (USB MIDI 1.0, table 4-1).
+STATIC uint8_t packet_length(const uint8_t packet[4]) {
+    switch (packet[0] & 0x0f) {
+        case 0x0: // Reserved
+        case 0x1: // Reserved
+            return 0;
+        case 0x5: // Single-byte System Common, or SysEx ending with one byte
+        case 0xf: // Single byte
+            return 1;
+        case 0x2: // Two-byte System Common
+        case 0x6: // SysEx ending with two bytes
+        case 0xc: // Program Change
+        case 0xd: // Channel Pressure
+            return 2;
+        default:
+            return 3;
+    }
+}
+
+// Invoked when TinyUSB receives data on the MIDI OUT endpoint.
+void tud_midi_rx_cb(uint8_t itf) {
+    (void)itf;
+    fill_event_queue();
+}
+
 size_t common_hal_usb_midi_portin_read(usb_midi_portin_obj_t *self, uint8_t *data, size_t len, int *errcode) {
-    return tud_midi_stream_read(data, len);
+    fill_event_queue();
+    size_t count = 0;
+    while (count < len && event_queue_length() > 0) {
+        midi_event_t *event = QUEUED_EVENT(event_queue_tail);
+        uint8_t event_len = packet_length(event->packet);
+        size_t n = MIN((size_t)(event_len - event_bytes_read), len - count);
+        memcpy(data + count, event->packet + 1 + event_bytes_read, n);
+        count += n;
+        event_bytes_read += n;
+        if (event_bytes_read == event_len) {
+            pop_event();
+            fill_event_queue();
+        }
+    }
+    return count;
 }
 
 uint32_t common_hal_usb_midi_portin_bytes_available(usb_midi_portin_obj_t *self) {
-    return tud_midi_available();
+    fill_event_queue();
+    uint32_t count = 0;
+    for (uint16_t i = event_queue_tail; i != event_queue_head; i++) {
+        count += packet_length(QUEUED_EVENT(i)->packet);
+    }
+    return count - event_bytes_read + tud_midi_available();
+}
+
+size_t common_hal_usb_midi_portin_readinto_packets(usb_midi_portin_obj_t *self, uint8_t *packets, uint32_t *timestamps, size_t len) {
+    fill_event_queue();
+    // Drop what is left of an event that read() has started on.
+    if (event_bytes_read > 0 && event_queue_length() > 0) {
+        pop_event();
+    }
+    size_t count = 0;
+    while (count < len && event_queue_length() > 0) {
+        midi_event_t *event = QUEUED_EVENT(event_queue_tail);
+        memcpy(packets + 4 * count, event->packet, 4);
+        if (timestamps) {
+            memcpy(timestamps + count, &event->timestamp, sizeof(uint32_t));
+        }
+        count++;
+        pop_event();
+        fill_event_queue();
+    }
+    return count;
+}
+
+#if CIRCUITPY_SYNTHIO
+size_t common_hal_usb_midi_portin_play_notes(usb_midi_portin_obj_t *self, synthio_synthesizer_obj_t *synthesizer, mp_int_t channel) {
+    size_t count = 0;
+    uint8_t packet[4];
+    while (common_hal_usb_midi_portin_readinto_packets(self, packet, NULL, 1)) {
+        uint8_t status = packet[1];
+        if (channel >= 0 && (status & 0x0f) != channel) {
+            continue;
+        }
+        mp_obj_t note = MP_OBJ_NEW_SMALL_INT(packet[2] & 0x7f);
+        switch (status & 0xf0) {
+            case 0x90: // Note On. A velocity of 0 means Note Off.
+                if (packet[3] != 0) {
+                    common_hal_synthio_synthesizer_press(synthesizer, note);
+                    count++;
+                    break;
+                }
+                MP_FALLTHROUGH;
+            case 0x80: // Note Off
+                common_hal_synthio_synthesizer_release(synthesizer, note);
+                count++;
+                break;
+        }
+    }
+    return count;
 }
+#endif
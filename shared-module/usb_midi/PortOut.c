@@ -33,6 +33,14 @@ size_t common_hal_usb_midi_portout_write(usb_midi_portout_obj_t *self, const uin
     return tud_midi_stream_write(0, data, len);
 }
 
+size_t common_hal_usb_midi_portout_write_packets(usb_midi_portout_obj_t *self, const uint8_t *packets, size_t len) {
+    size_t count = 0;
+    while (count < len && tud_midi_packet_write(packets + 4 * count)) {
+        count++;
+    }
+    return count;
+}
+
 bool common_hal_usb_midi_portout_ready_to_tx(usb_midi_portout_obj_t *self) {
     return tud_midi_mounted();
 }
@@ -39,6 +39,77 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+// Largest root such that root * root <= n.
+static uint32_t isqrt(uint64_t n) {
+    uint64_t root = 0;
+    uint64_t bit = 1ull << 62;
+    while (bit > n) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+// Agrees with get_pixel: along a line at distance |across| from the center, the covered
+// pixels are those within the half chord of the center.
+uint32_t common_hal_vectorio_circle_get_span(void *obj, int16_t x, int16_t y, bool vertical, int32_t *out_start, int32_t *out_end) {
+    vectorio_circle_t *self = obj;
+    int32_t radius = self->radius;
+    int32_t along = vertical ? y : x;
+    int32_t across = abs(vertical ? x : y);
+    *out_start = SHRT_MIN;
+    *out_end = SHRT_MAX;
+    if (across > radius) {
+        return 0;
+    }
+    int32_t half_chord = isqrt((uint32_t)radius * (uint32_t)radius - (uint32_t)(across * across));
+    if (along < -half_chord) {
+        *out_end = -half_chord - 1;
+        return 0;
+    }
+    if (along > half_chord) {
+        *out_start = half_chord + 1;
+        return 0;
+    }
+    *out_start = -half_chord;
+    *out_end = half_chord;
+    return self->color_index;
+}
+
+
+// The edge of an anti-aliased circle is half a pixel beyond the centers of the pixels that
+// get_pixel covers, so both versions are about the same size.
+uint32_t common_hal_vectorio_circle_get_subpixel_span(void *obj, int32_t x, int32_t y, bool vertical, int32_t *out_start, int32_t *out_end) {
+    vectorio_circle_t *self = obj;
+    int64_t radius = self->radius * VECTORIO_SUBPIXEL_SCALE + VECTORIO_SUBPIXEL_SCALE / 2;
+    int64_t along = vertical ? y : x;
+    int64_t across = vertical ? x : y;
+    *out_start = SHRT_MIN * VECTORIO_SUBPIXEL_SCALE;
+    *out_end = (SHRT_MAX + 1) * VECTORIO_SUBPIXEL_SCALE - 1;
+    if (across < -radius || across > radius) {
+        return 0;
+    }
+    int32_t half_chord = isqrt(radius * radius - across * across);
+    if (along < -half_chord) {
+        *out_end = -half_chord - 1;
+        return 0;
+    }
+    if (along > half_chord) {
+        *out_start = half_chord + 1;
+        return 0;
+    }
+    *out_start = -half_chord;
+    *out_end = half_chord;
+    return self->color_index;
+}
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
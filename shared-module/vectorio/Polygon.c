@@ -138,28 +138,22 @@ void common_hal_vectorio_polygon_get_area(void *polygon, displayio_area_t *area)
 // <0 if the point is to the left of the line vector
 //  0 if the point is on the line
 // >0 if the point is to the right of the line vector
-__attribute__((always_inline)) static inline int line_side(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t px, int16_t py) {
-    return (px - x1) * (y2 - y1)
-           - (py - y1) * (x2 - x1);
+__attribute__((always_inline)) static inline int64_t line_side(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t px, int32_t py) {
+    return (int64_t)(px - x1) * (y2 - y1)
+           - (int64_t)(py - y1) * (x2 - x1);
 }
 
 
-uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y) {
-    VECTORIO_POLYGON_DEBUG("%p polygon get_pixel %d, %d\n", obj, x, y);
-    vectorio_polygon_t *self = obj;
-
-    if (self->len == 0) {
-        return 0;
-    }
-
+// Winding number of the point (x, y), where the polygon's points are multiplied by scale.
+static int16_t polygon_winding_number(vectorio_polygon_t *self, int32_t scale, int32_t x, int32_t y) {
     int16_t winding_number = 0;
-    int16_t x1 = self->points_list[0];
-    int16_t y1 = self->points_list[1];
+    int32_t x1 = self->points_list[0] * scale;
+    int32_t y1 = self->points_list[1] * scale;
     for (uint16_t i = 2; i <= self->len + 1; ++i) {
         VECTORIO_POLYGON_DEBUG("  {(%3d, %3d),", x1, y1);
-        int16_t x2 = self->points_list[i % self->len];
+        int32_t x2 = self->points_list[i % self->len] * scale;
         ++i;
-        int16_t y2 = self->points_list[i % self->len];
+        int32_t y2 = self->points_list[i % self->len] * scale;
         VECTORIO_POLYGON_DEBUG(" (%3d, %3d)}\n", x2, y2);
         if (y1 <= y) {
             if (y2 > y && line_side(x1, y1, x2, y2, x, y) < 0) {
@@ -176,6 +170,93 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
         x1 = x2;
         y1 = y2;
     }
+    return winding_number;
+}
+
+uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y) {
+    VECTORIO_POLYGON_DEBUG("%p polygon get_pixel %d, %d\n", obj, x, y);
+    vectorio_polygon_t *self = obj;
+
+    if (self->len == 0) {
+        return 0;
+    }
+    return polygon_winding_number(self, 1, x, y) == 0 ? 0 : self->color_index;
+}
+
+// Largest integer not greater than numerator / denominator.
+static int64_t floor_div(int64_t numerator, int64_t denominator) {
+    if (denominator < 0) {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+    int64_t quotient = numerator / denominator;
+    if (numerator % denominator != 0 && numerator < 0) {
+        quotient -= 1;
+    }
+    return quotient;
+}
+
+// The pixel may differ on either side of breakpoint, i.e. between breakpoint - 1 and
+// breakpoint. Shrink the span around along so that it doesn't cross it.
+static void split_span(int32_t along, int64_t breakpoint, int32_t *start, int32_t *end) {
+    if (breakpoint > along) {
+        if (breakpoint - 1 < *end) {
+            *end = breakpoint - 1;
+        }
+    } else if (breakpoint > *start) {
+        *start = breakpoint;
+    }
+}
+
+// The winding number only changes where one of the tests in polygon_winding_number changes
+// for some edge: where the line crosses the edge, and (for vertical lines) at the edge's y
+// extent. The crossing is rarely on a whole coordinate, so both coordinates around it are
+// breakpoints. Between breakpoints every test has the same result, so the winding number
+// is the same too.
+static int16_t polygon_span(vectorio_polygon_t *self, int32_t scale, int32_t x, int32_t y, bool vertical, int32_t *out_start, int32_t *out_end) {
+    *out_start = SHRT_MIN * scale;
+    *out_end = (SHRT_MAX + 1) * scale - 1;
+    if (self->len == 0) {
+        return 0;
+    }
+    int16_t winding_number = polygon_winding_number(self, scale, x, y);
+
+    int32_t along = vertical ? y : x;
+    for (uint16_t i = 0; i < self->len; i += 2) {
+        int32_t x1 = self->points_list[i] * scale;
+        int32_t y1 = self->points_list[i + 1] * scale;
+        int32_t x2 = self->points_list[(i + 2) % self->len] * scale;
+        int32_t y2 = self->points_list[(i + 3) % self->len] * scale;
+        int64_t crossing;
+        if (vertical) {
+            split_span(along, y1, out_start, out_end);
+            split_span(along, y2, out_start, out_end);
+            if (x1 == x2) {
+                continue;
+            }
+            crossing = y1 + floor_div((int64_t)(x - x1) * (y2 - y1), x2 - x1);
+        } else {
+            if ((y1 <= y) == (y2 <= y)) {
+                // polygon_winding_number never counts this edge on this line.
+                continue;
+            }
+            crossing = x1 + floor_div((int64_t)(y - y1) * (x2 - x1), y2 - y1);
+        }
+        split_span(along, crossing, out_start, out_end);
+        split_span(along, crossing + 1, out_start, out_end);
+    }
+    return winding_number;
+}
+
+uint32_t common_hal_vectorio_polygon_get_span(void *obj, int16_t x, int16_t y, bool vertical, int32_t *out_start, int32_t *out_end) {
+    vectorio_polygon_t *self = obj;
+    int16_t winding_number = polygon_span(self, 1, x, y, vertical, out_start, out_end);
+    return winding_number == 0 ? 0 : self->color_index;
+}
+
+uint32_t common_hal_vectorio_polygon_get_subpixel_span(void *obj, int32_t x, int32_t y, bool vertical, int32_t *out_start, int32_t *out_end) {
+    vectorio_polygon_t *self = obj;
+    int16_t winding_number = polygon_span(self, VECTORIO_SUBPIXEL_SCALE, x, y, vertical, out_start, out_end);
     return winding_number == 0 ? 0 : self->color_index;
 }
 
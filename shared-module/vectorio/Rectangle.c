@@ -27,6 +27,30 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+uint32_t common_hal_vectorio_rectangle_get_span(void *obj, int16_t x, int16_t y, bool vertical, int32_t *out_start, int32_t *out_end) {
+    vectorio_rectangle_t *self = obj;
+    int16_t along = vertical ? y : x;
+    int16_t across = vertical ? x : y;
+    int16_t length = vertical ? self->height : self->width;
+    int16_t breadth = vertical ? self->width : self->height;
+    *out_start = SHRT_MIN;
+    *out_end = SHRT_MAX;
+    if (across < 0 || across >= breadth) {
+        return 0;
+    }
+    if (along < 0) {
+        *out_end = -1;
+        return 0;
+    }
+    if (along >= length) {
+        *out_start = length;
+        return 0;
+    }
+    *out_start = 0;
+    *out_end = length - 1;
+    return self->color_index;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
@@ -83,6 +83,13 @@ static void _get_screen_area(vectorio_vector_shape_t *self, displayio_area_t *ou
         self->absolute_transform->width, self->absolute_transform->height, self->absolute_transform->mirror_x, self->absolute_transform->mirror_y, self->absolute_transform->transpose_xy
         );
     self->ishape.get_area(self->ishape.shape, out_area);
+    if (self->antialias) {
+        // Blended edges reach up to a pixel beyond the pixels get_pixel covers.
+        out_area->x1 -= 1;
+        out_area->y1 -= 1;
+        out_area->x2 += 1;
+        out_area->y2 += 1;
+    }
     VECTORIO_SHAPE_DEBUG(" in:{(%5d,%5d), (%5d,%5d)}", out_area->x1, out_area->y1, out_area->x2, out_area->y2);
 
     int16_t x;
@@ -215,6 +222,7 @@ void common_hal_vectorio_vector_shape_construct(vectorio_vector_shape_t *self,
     self->ephemeral_dirty_area.x1 = self->ephemeral_dirty_area.x2; // Cheat to set area to 0
     self->ephemeral_dirty_area.next = NULL;
     self->current_area_dirty = true;
+    self->antialias = false;
     _get_screen_area(self, &self->current_area);
 }
 
@@ -304,6 +312,15 @@ void common_hal_vectorio_vector_shape_set_hidden(vectorio_vector_shape_t *self,
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+bool common_hal_vectorio_vector_shape_get_antialias(vectorio_vector_shape_t *self) {
+    return self->antialias;
+}
+
+void common_hal_vectorio_vector_shape_set_antialias(vectorio_vector_shape_t *self, bool antialias) {
+    self->antialias = antialias;
+    common_hal_vectorio_vector_shape_set_dirty(self);
+}
+
 mp_obj_t common_hal_vectorio_vector_shape_get_pixel_shader(vectorio_vector_shape_t *self) {
     VECTORIO_SHAPE_DEBUG("%p get_pixel_shader\n", self);
     return self->pixel_shader;
@@ -315,6 +332,113 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// Converts a covered input pixel to its output color. Returns false if the result is transparent.
+static bool vector_shape_shade(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel) {
+    output_pixel->pixel = 0;
+    output_pixel->opaque = true;
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+    if (!output_pixel->opaque) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+        return false;
+    }
+    return true;
+}
+
+// For an anti-aliased shape, the span around the current pixel in each row of samples.
+typedef struct {
+    int32_t start[VECTORIO_SUBPIXEL_SAMPLES];
+    int32_t end[VECTORIO_SUBPIXEL_SAMPLES];
+    uint32_t pixel[VECTORIO_SUBPIXEL_SAMPLES];
+} vector_shape_subpixel_row_t;
+
+// Largest integer not greater than numerator / VECTORIO_SUBPIXEL_SCALE.
+static inline int32_t subpixel_floor(int32_t numerator) {
+    return numerator >= 0 ? numerator / VECTORIO_SUBPIXEL_SCALE : -((VECTORIO_SUBPIXEL_SCALE - 1 - numerator) / VECTORIO_SUBPIXEL_SCALE);
+}
+
+// Returns the pixel at shape coordinates (x, y) and sets out_count to how many pixels, going
+// in the direction of step, have the same pixel and coverage, which is out of
+// VECTORIO_FULL_COVERAGE. Without anti-aliasing the coverage is all or nothing.
+static uint32_t vector_shape_get_run(vectorio_vector_shape_t *self, vector_shape_subpixel_row_t *row, int16_t x, int16_t y, bool vertical, int8_t step, int32_t *out_count, uint8_t *out_coverage) {
+    int32_t along = vertical ? y : x;
+    if (!self->antialias) {
+        int32_t span_start;
+        int32_t span_end;
+        uint32_t pixel = self->ishape.get_span(self->ishape.shape, x, y, vertical, &span_start, &span_end);
+        *out_count = step > 0 ? span_end - along + 1 : along - span_start + 1;
+        *out_coverage = pixel == 0 ? 0 : VECTORIO_FULL_COVERAGE;
+        return pixel;
+    }
+
+    // The samples of a pixel are at these offsets from its center, in both directions.
+    const int32_t last_offset = VECTORIO_SUBPIXEL_SAMPLES - 1;
+    int32_t first = along * VECTORIO_SUBPIXEL_SCALE - last_offset;
+    int32_t last = along * VECTORIO_SUBPIXEL_SCALE + last_offset;
+    int32_t across = (vertical ? x : y) * VECTORIO_SUBPIXEL_SCALE - last_offset;
+    uint32_t pixel = 0;
+    uint8_t coverage = 0;
+    int32_t count = INT32_MAX;
+    for (size_t i = 0; i < VECTORIO_SUBPIXEL_SAMPLES; i++, across += 2) {
+        for (int32_t sample = first; sample <= last; sample += 2) {
+            if (sample < row->start[i] || sample > row->end[i]) {
+                row->pixel[i] = self->ishape.get_subpixel_span(self->ishape.shape,
+                    vertical ? across : sample, vertical ? sample : across, vertical, &row->start[i], &row->end[i]);
+            }
+            if (row->pixel[i] != 0) {
+                pixel = row->pixel[i];
+                coverage++;
+            }
+            if (sample == first && last <= row->end[i]) {
+                // All of this row's samples are in one span, and so are those of the pixels
+                // beyond it up to the end of the span.
+                if (row->pixel[i] != 0) {
+                    coverage += VECTORIO_SUBPIXEL_SAMPLES - 1;
+                }
+                int32_t pixels;
+                if (step > 0) {
+                    pixels = subpixel_floor(row->end[i] - last_offset) - along + 1;
+                } else {
+                    pixels = along + subpixel_floor(-row->start[i] - last_offset) + 1;
+                }
+                count = MIN(count, pixels);
+                break;
+            }
+            count = 1;
+        }
+    }
+    *out_count = count;
+    *out_coverage = coverage;
+    return pixel;
+}
+
+// Finds where the pixel at pixel_index is stored in the buffer.
+static void vector_shape_locate_pixel(const _displayio_colorspace_t *colorspace, uint32_t pixel_index, uint16_t linestride_px, uint8_t pixels_per_byte, uint32_t *out_index, uint8_t *out_shift) {
+    *out_index = pixel_index;
+    *out_shift = 0;
+    if (colorspace->depth >= 8) {
+        return;
+    }
+    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+    if (!colorspace->pixels_in_byte_share_row) {
+        uint32_t row = pixel_index / linestride_px;
+        uint16_t col = pixel_index % linestride_px;
+        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+    }
+    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+    if (colorspace->reverse_pixels_in_byte) {
+        // Reverse the shift by subtracting it from the leftmost shift.
+        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+    }
+    *out_index = pixel_index / pixels_per_byte;
+    *out_shift = shift;
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -351,7 +475,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
         );
 
     uint16_t linestride_px = displayio_area_width(area);
-    uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
+    uint32_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
     uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
     VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
         linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
@@ -359,88 +483,109 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
-    displayio_area_t shape_area;
-    self->ishape.get_area(self->ishape.shape, &shape_area);
+    // Each screen row is a line along one axis of the shape, walked forwards or backwards.
+    bool vertical = self->absolute_transform->transpose_xy;
+    int8_t shape_step = self->absolute_transform->dx < 1 ? -1 : 1;
+    // Dithering shaders give a different color for every pixel, so they can't be applied per span.
+    bool shade_per_pixel = false;
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        shade_per_pixel = common_hal_displayio_palette_get_dither(self->pixel_shader);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        shade_per_pixel = common_hal_displayio_colorconverter_get_dither(self->pixel_shader);
+    }
+
+    bool can_blend = self->antialias && vectorio_can_blend(colorspace);
+    vector_shape_subpixel_row_t subpixel_row;
 
-    uint16_t mask_start_px = line_dirty_offset_px;
+    uint32_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
-        for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
-            // Check the mask first to see if the pixel has already been set.
-            uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
-            uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
-            uint8_t mask_bit = pixel_index % 32;
-            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
-            if ((*mask_doubleword & (1u << mask_bit)) != 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
-                continue;
-            }
-            output_pixel.pixel = 0;
-
-            // Cast input screen coordinates to shape coordinates to pick the pixel to draw
+        // Forget the spans of the previous row.
+        for (size_t i = 0; i < VECTORIO_SUBPIXEL_SAMPLES; i++) {
+            subpixel_row.start[i] = 1;
+            subpixel_row.end[i] = 0;
+        }
+        input_pixel.x = overlap.x1;
+        while (input_pixel.x < overlap.x2) {
+            // Cast input screen coordinates to shape coordinates to find the run of the shape to draw
             int16_t pixel_to_get_x;
             int16_t pixel_to_get_y;
             screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
 
-            VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
             #ifdef VECTORIO_PERF
             uint64_t pre_pixel = common_hal_time_monotonic_ns();
             #endif
-            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
+            int32_t run_length;
+            uint8_t coverage;
+            input_pixel.pixel = vector_shape_get_run(self, &subpixel_row, pixel_to_get_x, pixel_to_get_y, vertical, shape_step, &run_length, &coverage);
             #ifdef VECTORIO_PERF
             uint64_t post_pixel = common_hal_time_monotonic_ns();
             pixel_time += post_pixel - pre_pixel;
             #endif
-            VECTORIO_SHAPE_PIXEL_DEBUG(" -> %d", input_pixel.pixel);
+            int16_t run_end = MIN((int32_t)overlap.x2, input_pixel.x + run_length);
+            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p get_run %p (%3d, %3d) -> ( %3d, %3d ) -> %d coverage %d until %d", self, self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y, input_pixel.pixel, coverage, run_end);
 
             // vectorio shapes use 0 to mean "area is not covered."
-            // We can skip all the rest of the work for this pixel if it's not currently covered by the shape.
-            if (input_pixel.pixel == 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
+            // We can skip all the rest of the work for this run if it's not currently covered by the shape.
+            if (coverage == 0) {
+                VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent run; input area is not fully covered)");
                 full_coverage = false;
-            } else {
-                // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
-                input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+                input_pixel.x = run_end;
+                continue;
+            }
+            if (coverage < VECTORIO_FULL_COVERAGE) {
+                full_coverage = false;
+            }
+            // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
+            input_pixel.pixel -= 1;
+            if (!shade_per_pixel) {
+                full_coverage &= vector_shape_shade(self, colorspace, &input_pixel, &output_pixel);
+            }
+
+            for (; input_pixel.x < run_end; ++input_pixel.x) {
+                // Check the mask first to see if the pixel has already been set.
+                uint32_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
+                uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+                uint8_t mask_bit = pixel_index % 32;
+                VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
+                if ((*mask_doubleword & (1u << mask_bit)) != 0) {
+                    VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
+                    continue;
+                }
+                if (shade_per_pixel) {
+                    full_coverage &= vector_shape_shade(self, colorspace, &input_pixel, &output_pixel);
                 }
 
-                // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
-                if (!output_pixel.opaque) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
-                    full_coverage = false;
+                uint32_t buffer_index;
+                uint8_t shift;
+                vector_shape_locate_pixel(colorspace, pixel_index, linestride_px, pixels_per_byte, &buffer_index, &shift);
+                if (coverage < VECTORIO_FULL_COVERAGE) {
+                    // Partly covered pixels are left unmasked so the layers below still draw them.
+                    if (!output_pixel.opaque) {
+                        continue;
+                    }
+                    if (can_blend && vectorio_defer_blend(buffer_index, shift, output_pixel.pixel, coverage)) {
+                        continue;
+                    }
+                    // Without a blend, draw the pixels that are mostly covered.
+                    if (coverage < VECTORIO_FULL_COVERAGE / 2) {
+                        continue;
+                    }
                 }
 
                 *mask_doubleword |= 1u << mask_bit;
                 if (colorspace->depth == 16) {
                     VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
+                    *(((uint16_t *)buffer) + buffer_index) = output_pixel.pixel;
                 } else if (colorspace->depth == 32) {
                     VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
+                    *(((uint32_t *)buffer) + buffer_index) = output_pixel.pixel;
                 } else if (colorspace->depth == 8) {
                     VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
+                    *(((uint8_t *)buffer) + buffer_index) = output_pixel.pixel;
                 } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
                     VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
+                    ((uint8_t *)buffer)[buffer_index] |= output_pixel.pixel << shift;
                 }
             }
         }
@@ -463,6 +608,56 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 }
 
 
+// Only a Rectangle is known to draw one color everywhere inside it. Rectangles are convex so the
+// area is covered when all four of its corners are.
+displayio_area_fill_t vectorio_vector_shape_get_area_fill(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *color) {
+    displayio_area_t overlap;
+    if (self->hidden || !displayio_area_compute_overlap(area, &self->current_area, &overlap)) {
+        return DISPLAYIO_AREA_FILL_EMPTY;
+    }
+    if (!mp_obj_is_type(self->ishape.shape, &vectorio_rectangle_type)) {
+        return DISPLAYIO_AREA_FILL_MIXED;
+    }
+    const int16_t corners[4][2] = {
+        {area->x1, area->y1}, {area->x2 - 1, area->y1}, {area->x1, area->y2 - 1}, {area->x2 - 1, area->y2 - 1}
+    };
+    displayio_input_pixel_t input_pixel;
+    for (size_t i = 0; i < MP_ARRAY_SIZE(corners); i++) {
+        int16_t shape_x;
+        int16_t shape_y;
+        screen_to_shape_coordinates(self, corners[i][0], corners[i][1], &shape_x, &shape_y);
+        input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, shape_x, shape_y);
+        if (input_pixel.pixel == 0) {
+            return DISPLAYIO_AREA_FILL_MIXED;
+        }
+    }
+    input_pixel.pixel -= 1;
+    input_pixel.x = area->x1;
+    input_pixel.y = area->y1;
+
+    displayio_output_pixel_t output_pixel;
+    output_pixel.opaque = true;
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel.pixel = input_pixel.pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        if (common_hal_displayio_palette_get_dither(self->pixel_shader)) {
+            return DISPLAYIO_AREA_FILL_MIXED;
+        }
+        displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        if (common_hal_displayio_colorconverter_get_dither(self->pixel_shader)) {
+            return DISPLAYIO_AREA_FILL_MIXED;
+        }
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+    }
+    if (!output_pixel.opaque) {
+        // Leave transparent colors to fill_area.
+        return DISPLAYIO_AREA_FILL_MIXED;
+    }
+    *color = output_pixel.pixel;
+    return DISPLAYIO_AREA_FILL_SOLID;
+}
+
 void vectorio_vector_shape_finish_refresh(vectorio_vector_shape_t *self) {
     if (displayio_area_empty(&self->ephemeral_dirty_area) && !self->current_area_dirty) {
         return;
@@ -11,6 +11,13 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Returns the same pixel as get_pixel_function and sets [out_start, out_end] to the
+//   inclusive range of x (or of y when vertical is true) around the given point over
+//   which the pixel does not change. The range is limited to int16_t coordinates.
+typedef uint32_t get_span_function(mp_obj_t shape, int16_t x, int16_t y, bool vertical, int32_t *out_start, int32_t *out_end);
+// Like get_span_function for the anti-aliased outline of the shape, in coordinates
+//   VECTORIO_SUBPIXEL_SCALE times finer than pixels.
+typedef uint32_t get_subpixel_span_function(mp_obj_t shape, int32_t x, int32_t y, bool vertical, int32_t *out_start, int32_t *out_end);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -22,6 +29,9 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_span_function *get_span;
+    // NULL if the shape can't be anti-aliased.
+    get_subpixel_span_function *get_subpixel_span;
 } vectorio_ishape_t;
 
 typedef struct {
@@ -38,6 +48,7 @@ typedef struct {
     displayio_area_t current_area;
     bool current_area_dirty;
     bool hidden;
+    bool antialias;
 } vectorio_vector_shape_t;
 
 displayio_area_t *vectorio_vector_shape_get_refresh_areas(vectorio_vector_shape_t *self, displayio_area_t *tail);
@@ -51,5 +62,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 // false if the vector shape wasn't rendered in the last frame.
 bool vectorio_vector_shape_get_previous_area(vectorio_vector_shape_t *self, displayio_area_t *out_area);
 void vectorio_vector_shape_finish_refresh(vectorio_vector_shape_t *self);
+displayio_area_fill_t vectorio_vector_shape_get_area_fill(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *color);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_VECTORIO_SHAPE_H
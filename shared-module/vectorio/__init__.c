@@ -1,2 +1,69 @@
+#include "shared-module/vectorio/__init__.h"
 
-// Don't need anything in here yet
+#include "py/misc.h"
+
+#define VECTORIO_BLEND_COUNT (64)
+
+typedef struct {
+    uint32_t index;
+    uint16_t color;
+    uint8_t shift;
+    uint8_t coverage;
+} vectorio_blend_t;
+
+static vectorio_blend_t blends[VECTORIO_BLEND_COUNT];
+static uint16_t blend_count;
+
+// 16 bit colors are blended per 565 channel. Grayscale at 8 bits or fewer is blended as one
+// channel. Other colorspaces don't have colors that can be mixed.
+bool vectorio_can_blend(const _displayio_colorspace_t *colorspace) {
+    if (colorspace->grayscale) {
+        return colorspace->depth <= 8;
+    }
+    return colorspace->depth == 16 && !colorspace->tricolor && !colorspace->sevencolor;
+}
+
+bool vectorio_defer_blend(uint32_t index, uint8_t shift, uint16_t color, uint8_t coverage) {
+    if (blend_count == VECTORIO_BLEND_COUNT) {
+        return false;
+    }
+    vectorio_blend_t *blend = &blends[blend_count++];
+    blend->index = index;
+    blend->color = color;
+    blend->shift = shift;
+    blend->coverage = coverage;
+    return true;
+}
+
+static inline uint32_t mix(uint32_t color, uint32_t below, uint32_t coverage) {
+    return (color * coverage + below * (VECTORIO_FULL_COVERAGE - coverage)) / VECTORIO_FULL_COVERAGE;
+}
+
+void vectorio_finish_fill_area(const _displayio_colorspace_t *colorspace, uint32_t *buffer) {
+    // Shapes are filled from the top down, so the last blend is for the lowest layer.
+    while (blend_count > 0) {
+        vectorio_blend_t *blend = &blends[--blend_count];
+        if (colorspace->depth == 16) {
+            uint16_t *pixel = ((uint16_t *)buffer) + blend->index;
+            uint16_t color = blend->color;
+            uint16_t below = *pixel;
+            if (colorspace->reverse_bytes_in_word) {
+                color = __builtin_bswap16(color);
+                below = __builtin_bswap16(below);
+            }
+            uint16_t mixed = mix(color >> 11, below >> 11, blend->coverage) << 11 |
+                mix((color >> 5) & 0x3f, (below >> 5) & 0x3f, blend->coverage) << 5 |
+                mix(color & 0x1f, below & 0x1f, blend->coverage);
+            if (colorspace->reverse_bytes_in_word) {
+                mixed = __builtin_bswap16(mixed);
+            }
+            *pixel = mixed;
+        } else {
+            uint8_t *cell = ((uint8_t *)buffer) + blend->index;
+            uint8_t value_mask = (1u << colorspace->depth) - 1;
+            uint8_t below = (*cell >> blend->shift) & value_mask;
+            uint8_t mixed = mix(blend->color, below, blend->coverage);
+            *cell = (*cell & ~(value_mask << blend->shift)) | (mixed << blend->shift);
+        }
+    }
+}
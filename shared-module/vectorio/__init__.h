@@ -2,6 +2,7 @@
 #define MICROPY_INCLUDED_SHARED_MODULE_VECTORIO_INIT_H
 
 #include "py/obj.h"
+#include "shared-module/displayio/Palette.h"
 
 typedef void event_function(mp_obj_t obj);
 
@@ -10,5 +11,19 @@ typedef struct {
     event_function *event;
 } vectorio_event_t;
 
+// Anti-aliased shapes are sampled on a grid this many times finer than pixels, at odd
+// coordinates of the grid so that no sample is on a pixel center. That leaves
+// VECTORIO_SUBPIXEL_SAMPLES samples across each pixel in each direction.
+#define VECTORIO_SUBPIXEL_SCALE (8)
+#define VECTORIO_SUBPIXEL_SAMPLES (VECTORIO_SUBPIXEL_SCALE / 2)
+#define VECTORIO_FULL_COVERAGE (VECTORIO_SUBPIXEL_SAMPLES * VECTORIO_SUBPIXEL_SAMPLES)
+
+// Anti-aliased shapes can't blend their edges while filling an area because the layers below
+// them haven't been drawn yet. They defer the blend until the whole area is filled instead.
+bool vectorio_can_blend(const _displayio_colorspace_t *colorspace);
+// Returns false if there is no room to defer another blend. coverage is out of VECTORIO_FULL_COVERAGE.
+bool vectorio_defer_blend(uint32_t index, uint8_t shift, uint16_t color, uint8_t coverage);
+// Blends the deferred pixels into buffer, lowest layer first.
+void vectorio_finish_fill_area(const _displayio_colorspace_t *colorspace, uint32_t *buffer);
 
 #endif
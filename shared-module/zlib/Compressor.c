@@ -0,0 +1,609 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// A small DEFLATE (RFC 1951) encoder: greedy LZ77 matching over a hash chain,
+// with each block written using whichever of the fixed or a dynamic Huffman
+// code is shorter.
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Compressor.h"
+#include "lib/uzlib/uzlib.h"
+
+#define MIN_MATCH (3)
+#define MAX_MATCH (258)
+#define NIL (0xffff)
+#define END_OF_BLOCK (256)
+#define CODELEN_CODES (19)
+#define MAX_CODE_BITS (15)
+#define MAX_CODELEN_BITS (7)
+// The fixed code defines two literal/length codes beyond those ever used,
+// which must be counted when assigning its codes.
+#define FIXED_LITLEN_CODES (288)
+
+STATIC const uint16_t length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+STATIC const uint8_t length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+STATIC const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+STATIC const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+STATIC const uint8_t codelen_order[CODELEN_CODES] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15,
+};
+// Maximum chain length searched for each compression level 0..9.
+STATIC const uint16_t level_chain[10] = {
+    0, 1, 2, 4, 8, 16, 32, 64, 128, 256,
+};
+
+STATIC int length_code(int len) {
+    int i = 28;
+    while (length_base[i] > len) {
+        i--;
+    }
+    return i;
+}
+
+STATIC int dist_code(int dist) {
+    int i = 29;
+    while (dist_base[i] > dist) {
+        i--;
+    }
+    return i;
+}
+
+STATIC void put_bits(zlib_compressor_obj_t *self, vstr_t *out, uint32_t bits, int n) {
+    self->bitbuf |= bits << self->bitcount;
+    self->bitcount += n;
+    while (self->bitcount >= 8) {
+        vstr_add_byte(out, self->bitbuf & 0xff);
+        self->bitbuf >>= 8;
+        self->bitcount -= 8;
+    }
+}
+
+// Moffat and Katajainen's in-place computation of minimum-redundancy code
+// lengths. On entry a[] holds n > 1 weights in ascending order; on exit it
+// holds the corresponding code lengths.
+STATIC void minimum_redundancy(uint16_t *a, int n) {
+    int root = 0, leaf = 2, next;
+    a[0] += a[1];
+    for (next = 1; next < n - 1; next++) {
+        if (leaf >= n || a[root] < a[leaf]) {
+            a[next] = a[root];
+            a[root++] = next;
+        } else {
+            a[next] = a[leaf++];
+        }
+        if (leaf >= n || (root < next && a[root] < a[leaf])) {
+            a[next] += a[root];
+            a[root++] = next;
+        } else {
+            a[next] += a[leaf++];
+        }
+    }
+    a[n - 2] = 0;
+    for (next = n - 3; next >= 0; next--) {
+        a[next] = a[a[next]] + 1;
+    }
+    int avail = 1, used = 0, depth = 0;
+    root = n - 2;
+    next = n - 1;
+    while (avail > 0) {
+        while (root >= 0 && a[root] == depth) {
+            used++;
+            root--;
+        }
+        while (avail > used) {
+            a[next--] = depth;
+            avail--;
+        }
+        avail = 2 * used;
+        depth++;
+        used = 0;
+    }
+}
+
+// Compute Huffman code lengths, limited to max_bits, for n symbols with the
+// given frequencies. At least two symbols always get a code, as some
+// decoders reject a tree with a single code.
+STATIC void build_lengths(const uint16_t *freq, int n, int max_bits, uint8_t *lengths) {
+    uint16_t weight[ZLIB_DEFLATE_LITLEN_CODES];
+    uint16_t symbol[ZLIB_DEFLATE_LITLEN_CODES];
+    int used = 0;
+
+    memset(lengths, 0, n);
+    for (int i = 0; i < n; i++) {
+        if (!freq[i]) {
+            continue;
+        }
+        // insertion sort by ascending frequency
+        int j = used++;
+        while (j > 0 && weight[j - 1] > freq[i]) {
+            weight[j] = weight[j - 1];
+            symbol[j] = symbol[j - 1];
+            j--;
+        }
+        weight[j] = freq[i];
+        symbol[j] = i;
+    }
+    if (used < 2) {
+        int s = used ? symbol[0] : 0;
+        lengths[s] = 1;
+        lengths[s ? 0 : 1] = 1;
+        return;
+    }
+
+    minimum_redundancy(weight, used);
+
+    // Fold over-long codes into max_bits, then lengthen shorter codes until
+    // the Kraft sum is exactly 1 again.
+    uint16_t count[MAX_CODE_BITS + 1] = { 0 };
+    for (int i = 0; i < used; i++) {
+        count[MIN(weight[i], max_bits)]++;
+    }
+    uint32_t total = 0;
+    for (int i = 1; i <= max_bits; i++) {
+        total += (uint32_t)count[i] << (max_bits - i);
+    }
+    while (total != (1u << max_bits)) {
+        count[max_bits]--;
+        for (int i = max_bits - 1; i > 0; i--) {
+            if (count[i]) {
+                count[i]--;
+                count[i + 1] += 2;
+                break;
+            }
+        }
+        total--;
+    }
+
+    // The least frequent symbols get the longest codes.
+    int k = 0;
+    for (int bits = max_bits; bits > 0; bits--) {
+        for (int i = count[bits]; i > 0; i--) {
+            lengths[symbol[k++]] = bits;
+        }
+    }
+}
+
+// Assign canonical codes for the given lengths, stored bit-reversed since
+// Huffman codes are sent most significant bit first.
+STATIC void build_codes(const uint8_t *lengths, int n, uint16_t *codes) {
+    uint16_t count[MAX_CODE_BITS + 1] = { 0 };
+    uint16_t next[MAX_CODE_BITS + 1];
+    for (int i = 0; i < n; i++) {
+        count[lengths[i]]++;
+    }
+    count[0] = 0;
+    uint16_t code = 0;
+    for (int bits = 1; bits <= MAX_CODE_BITS; bits++) {
+        code = (code + count[bits - 1]) << 1;
+        next[bits] = code;
+    }
+    for (int i = 0; i < n; i++) {
+        int len = lengths[i];
+        if (!len) {
+            continue;
+        }
+        uint16_t c = next[len]++, r = 0;
+        for (int b = 0; b < len; b++) {
+            r = (r << 1) | (c & 1);
+            c >>= 1;
+        }
+        codes[i] = r;
+    }
+}
+
+STATIC void fixed_lengths(uint8_t *litlen, uint8_t *dist) {
+    memset(litlen, 8, 144);
+    memset(litlen + 144, 9, 256 - 144);
+    memset(litlen + 256, 7, 280 - 256);
+    memset(litlen + 280, 8, FIXED_LITLEN_CODES - 280);
+    memset(dist, 5, ZLIB_DEFLATE_DIST_CODES);
+}
+
+// Size in bits of the block's symbols, excluding extra bits, which are the
+// same whatever code is used.
+STATIC uint32_t data_bits(zlib_compressor_obj_t *self, const uint8_t *litlen, const uint8_t *dist) {
+    uint32_t bits = 0;
+    for (int i = 0; i < ZLIB_DEFLATE_LITLEN_CODES; i++) {
+        bits += self->litlen_freq[i] * litlen[i];
+    }
+    for (int i = 0; i < ZLIB_DEFLATE_DIST_CODES; i++) {
+        bits += self->dist_freq[i] * dist[i];
+    }
+    return bits;
+}
+
+// Run-length encode the code lengths of a dynamic block's literal/length and
+// distance codes, using the code length alphabet's repeat codes 16, 17 and 18.
+// Each entry of rle is a code length symbol in the low byte and its repeat
+// count in the high byte. Returns the number of entries.
+STATIC int rle_lengths(const uint8_t *lengths, int n, uint16_t *rle, uint16_t *freq) {
+    int count = 0;
+    for (int i = 0; i < n;) {
+        int len = lengths[i];
+        int run = 1;
+        while (i + run < n && lengths[i + run] == len) {
+            run++;
+        }
+        i += run;
+        if (len == 0) {
+            while (run >= 11) {
+                int r = MIN(run, 138);
+                rle[count++] = 18 | (r - 11) << 8;
+                run -= r;
+            }
+            if (run >= 3) {
+                rle[count++] = 17 | (run - 3) << 8;
+                run = 0;
+            }
+        } else {
+            rle[count++] = len;
+            run--;
+            while (run >= 3) {
+                int r = MIN(run, 6);
+                rle[count++] = 16 | (r - 3) << 8;
+                run -= r;
+            }
+        }
+        while (run-- > 0) {
+            rle[count++] = len;
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        freq[rle[i] & 0xff]++;
+    }
+    return count;
+}
+
+STATIC void write_block(zlib_compressor_obj_t *self, vstr_t *out, bool last) {
+    uint8_t litlen_len[FIXED_LITLEN_CODES];
+    uint8_t dist_len[ZLIB_DEFLATE_DIST_CODES];
+    uint16_t litlen_code[FIXED_LITLEN_CODES];
+    uint16_t dist_code_[ZLIB_DEFLATE_DIST_CODES];
+    uint16_t rle[ZLIB_DEFLATE_LITLEN_CODES + ZLIB_DEFLATE_DIST_CODES];
+    uint16_t codelen_freq[CODELEN_CODES] = { 0 };
+    uint8_t codelen_len[CODELEN_CODES];
+    uint16_t codelen_code[CODELEN_CODES];
+
+    self->litlen_freq[END_OF_BLOCK] = 1;
+
+    // Cost of the block with a dynamic code, including the code description.
+    build_lengths(self->litlen_freq, ZLIB_DEFLATE_LITLEN_CODES, MAX_CODE_BITS, litlen_len);
+    litlen_len[286] = litlen_len[287] = 0;
+    build_lengths(self->dist_freq, ZLIB_DEFLATE_DIST_CODES, MAX_CODE_BITS, dist_len);
+    int hlit = ZLIB_DEFLATE_LITLEN_CODES;
+    while (hlit > 257 && !litlen_len[hlit - 1]) {
+        hlit--;
+    }
+    int hdist = ZLIB_DEFLATE_DIST_CODES;
+    while (hdist > 1 && !dist_len[hdist - 1]) {
+        hdist--;
+    }
+    // The two sets of lengths are encoded as one sequence.
+    uint8_t all_len[ZLIB_DEFLATE_LITLEN_CODES + ZLIB_DEFLATE_DIST_CODES];
+    memcpy(all_len, litlen_len, hlit);
+    memcpy(all_len + hlit, dist_len, hdist);
+    int rle_count = rle_lengths(all_len, hlit + hdist, rle, codelen_freq);
+    build_lengths(codelen_freq, CODELEN_CODES, MAX_CODELEN_BITS, codelen_len);
+    int hclen = CODELEN_CODES;
+    while (hclen > 4 && !codelen_len[codelen_order[hclen - 1]]) {
+        hclen--;
+    }
+    uint32_t dynamic_bits = 5 + 5 + 4 + 3 * hclen + data_bits(self, litlen_len, dist_len);
+    for (int i = 0; i < CODELEN_CODES; i++) {
+        static const uint8_t codelen_extra[3] = { 2, 3, 7 };
+        dynamic_bits += codelen_freq[i] * (codelen_len[i] + (i >= 16 ? codelen_extra[i - 16] : 0));
+    }
+
+    uint32_t fixed_bits = 0;
+    for (int i = 0; i < ZLIB_DEFLATE_LITLEN_CODES; i++) {
+        fixed_bits += self->litlen_freq[i] * (i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8);
+    }
+    for (int i = 0; i < ZLIB_DEFLATE_DIST_CODES; i++) {
+        fixed_bits += self->dist_freq[i] * 5;
+    }
+    bool dynamic = dynamic_bits < fixed_bits;
+
+    put_bits(self, out, last, 1);
+    if (dynamic) {
+        put_bits(self, out, 2, 2);
+        put_bits(self, out, hlit - 257, 5);
+        put_bits(self, out, hdist - 1, 5);
+        put_bits(self, out, hclen - 4, 4);
+        for (int i = 0; i < hclen; i++) {
+            put_bits(self, out, codelen_len[codelen_order[i]], 3);
+        }
+        build_codes(codelen_len, CODELEN_CODES, codelen_code);
+        for (int i = 0; i < rle_count; i++) {
+            int sym = rle[i] & 0xff, extra = rle[i] >> 8;
+            put_bits(self, out, codelen_code[sym], codelen_len[sym]);
+            if (sym == 16) {
+                put_bits(self, out, extra, 2);
+            } else if (sym == 17) {
+                put_bits(self, out, extra, 3);
+            } else if (sym == 18) {
+                put_bits(self, out, extra, 7);
+            }
+        }
+    } else {
+        put_bits(self, out, 1, 2);
+        fixed_lengths(litlen_len, dist_len);
+    }
+    build_codes(litlen_len, FIXED_LITLEN_CODES, litlen_code);
+    build_codes(dist_len, ZLIB_DEFLATE_DIST_CODES, dist_code_);
+
+    for (int i = 0; i < self->sym_count; i++) {
+        int dist = self->sym_dist[i];
+        if (!dist) {
+            int c = self->sym_len[i];
+            put_bits(self, out, litlen_code[c], litlen_len[c]);
+            continue;
+        }
+        int len = self->sym_len[i] + MIN_MATCH;
+        int lc = length_code(len);
+        put_bits(self, out, litlen_code[257 + lc], litlen_len[257 + lc]);
+        put_bits(self, out, len - length_base[lc], length_extra[lc]);
+        int dc = dist_code(dist);
+        put_bits(self, out, dist_code_[dc], dist_len[dc]);
+        put_bits(self, out, dist - dist_base[dc], dist_extra[dc]);
+    }
+    put_bits(self, out, litlen_code[END_OF_BLOCK], litlen_len[END_OF_BLOCK]);
+
+    self->sym_count = 0;
+    memset(self->litlen_freq, 0, sizeof(self->litlen_freq));
+    memset(self->dist_freq, 0, sizeof(self->dist_freq));
+}
+
+STATIC void add_symbol(zlib_compressor_obj_t *self, vstr_t *out, int len_or_literal, int dist) {
+    self->sym_len[self->sym_count] = len_or_literal;
+    self->sym_dist[self->sym_count] = dist;
+    if (dist) {
+        self->litlen_freq[257 + length_code(len_or_literal + MIN_MATCH)]++;
+        self->dist_freq[dist_code(dist)]++;
+    } else {
+        self->litlen_freq[len_or_literal]++;
+    }
+    if (++self->sym_count == ZLIB_COMPRESS_BLOCK_SYMBOLS) {
+        write_block(self, out, false);
+    }
+}
+
+STATIC uint32_t hash(const uint8_t *p) {
+    uint32_t v = p[0] | p[1] << 8 | p[2] << 16;
+    return (v * 2654435761u) >> (32 - ZLIB_COMPRESS_HASH_BITS);
+}
+
+STATIC void insert(zlib_compressor_obj_t *self, uint32_t pos) {
+    uint32_t h = hash(self->window + pos);
+    self->prev[pos & (self->window_size - 1)] = self->head[h];
+    self->head[h] = pos;
+}
+
+// Find the longest match for the data at pos among earlier occurrences of its
+// first three bytes, then record pos in the hash chain.
+STATIC int longest_match(zlib_compressor_obj_t *self, uint32_t *match_dist) {
+    uint32_t pos = self->pos;
+    const uint8_t *here = self->window + pos;
+    int max_len = MIN(MAX_MATCH, self->fill - pos);
+    int best_len = MIN_MATCH - 1;
+    uint32_t cand = self->head[hash(here)];
+
+    for (int chain = self->max_chain; chain > 0 && cand != NIL && cand < pos; chain--) {
+        uint32_t dist = pos - cand;
+        if (dist >= self->window_size) {
+            break;
+        }
+        const uint8_t *there = self->window + cand;
+        if (there[best_len] == here[best_len] && there[0] == here[0]) {
+            int len = 1;
+            while (len < max_len && there[len] == here[len]) {
+                len++;
+            }
+            if (len > best_len) {
+                best_len = len;
+                *match_dist = dist;
+                if (len == max_len) {
+                    break;
+                }
+            }
+        }
+        cand = self->prev[cand & (self->window_size - 1)];
+    }
+    insert(self, pos);
+    return best_len;
+}
+
+// Encode the buffered input. Unless flushing, stop while a full maximum
+// length match of lookahead remains unencoded.
+STATIC void deflate(zlib_compressor_obj_t *self, vstr_t *out, bool flush) {
+    while (self->pos < self->fill) {
+        uint32_t avail = self->fill - self->pos;
+        if (avail < MAX_MATCH && !flush) {
+            break;
+        }
+        int len = 0;
+        uint32_t dist = 0;
+        if (avail >= MIN_MATCH) {
+            len = longest_match(self, &dist);
+        }
+        if (len >= MIN_MATCH) {
+            add_symbol(self, out, len - MIN_MATCH, dist);
+            for (int i = 1; i < len; i++) {
+                if (self->pos + i + MIN_MATCH <= self->fill) {
+                    insert(self, self->pos + i);
+                }
+            }
+            self->pos += len;
+        } else {
+            add_symbol(self, out, self->window[self->pos], 0);
+            self->pos++;
+        }
+    }
+}
+
+// Discard the oldest window_size bytes of history to make room for input.
+STATIC void slide(zlib_compressor_obj_t *self) {
+    uint32_t w = self->window_size;
+    memmove(self->window, self->window + w, w);
+    self->pos -= w;
+    self->fill -= w;
+    for (size_t i = 0; i < MP_ARRAY_SIZE(self->head); i++) {
+        self->head[i] = self->head[i] != NIL && self->head[i] >= w ? self->head[i] - w : NIL;
+    }
+    for (uint32_t i = 0; i < w; i++) {
+        self->prev[i] = self->prev[i] != NIL && self->prev[i] >= w ? self->prev[i] - w : NIL;
+    }
+}
+
+STATIC void write_header(zlib_compressor_obj_t *self, vstr_t *out) {
+    if (self->header_written) {
+        return;
+    }
+    self->header_written = true;
+    if (self->format == ZLIB_FORMAT_ZLIB) {
+        uint8_t cmf = (self->window_bits - 8) << 4 | 8;
+        uint8_t flg = 2 << 6;
+        int check = (cmf << 8 | flg) % 31;
+        if (check) {
+            flg += 31 - check;
+        }
+        vstr_add_byte(out, cmf);
+        vstr_add_byte(out, flg);
+    } else if (self->format == ZLIB_FORMAT_GZIP) {
+        static const uint8_t gzip_header[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff };
+        vstr_add_strn(out, (const char *)gzip_header, sizeof(gzip_header));
+    }
+}
+
+void common_hal_zlib_compressor_construct(zlib_compressor_obj_t *self, mp_int_t level, mp_int_t wbits) {
+    mp_arg_validate_int_range(level, -1, 9, MP_QSTR_level);
+    mp_int_t bits;
+    if (wbits < 0) {
+        self->format = ZLIB_FORMAT_RAW;
+        bits = -wbits;
+    } else if (wbits > 15) {
+        self->format = ZLIB_FORMAT_GZIP;
+        bits = wbits - 16;
+    } else {
+        self->format = ZLIB_FORMAT_ZLIB;
+        bits = wbits;
+    }
+    bits = mp_arg_validate_int_range(bits, 9, 15, MP_QSTR_wbits);
+
+    // A smaller window than requested still makes a valid stream.
+    self->window_bits = MIN(bits, ZLIB_COMPRESS_WINDOW_BITS);
+    self->window_size = 1 << self->window_bits;
+    self->max_chain = level_chain[level < 0 ? 6 : level];
+    self->window = m_new(uint8_t, 2 * self->window_size);
+    self->prev = m_new(uint16_t, self->window_size);
+    memset(self->prev, 0xff, self->window_size * sizeof(uint16_t));
+    memset(self->head, 0xff, sizeof(self->head));
+    memset(self->litlen_freq, 0, sizeof(self->litlen_freq));
+    memset(self->dist_freq, 0, sizeof(self->dist_freq));
+    self->sym_count = 0;
+    self->pos = 0;
+    self->fill = 0;
+    self->checksum = self->format == ZLIB_FORMAT_GZIP ? ~0u : 1u;
+    self->total_in = 0;
+    self->bitbuf = 0;
+    self->bitcount = 0;
+    self->header_written = false;
+}
+
+bool common_hal_zlib_compressor_deinited(zlib_compressor_obj_t *self) {
+    return self->window == NULL;
+}
+
+void common_hal_zlib_compressor_deinit(zlib_compressor_obj_t *self) {
+    if (common_hal_zlib_compressor_deinited(self)) {
+        return;
+    }
+    m_del(uint8_t, self->window, 2 * self->window_size);
+    m_del(uint16_t, self->prev, self->window_size);
+    self->window = NULL;
+    self->prev = NULL;
+}
+
+void common_hal_zlib_compressor_compress(zlib_compressor_obj_t *self, const uint8_t *data, size_t len, vstr_t *out) {
+    write_header(self, out);
+    if (self->format == ZLIB_FORMAT_GZIP) {
+        self->checksum = uzlib_crc32(data, len, self->checksum);
+    } else {
+        self->checksum = uzlib_adler32(data, len, self->checksum);
+    }
+    self->total_in += len;
+
+    while (len) {
+        if (self->fill == 2u * self->window_size) {
+            slide(self);
+        }
+        size_t n = MIN(len, 2u * self->window_size - self->fill);
+        memcpy(self->window + self->fill, data, n);
+        self->fill += n;
+        data += n;
+        len -= n;
+        deflate(self, out, false);
+    }
+}
+
+void common_hal_zlib_compressor_flush(zlib_compressor_obj_t *self, vstr_t *out) {
+    write_header(self, out);
+    deflate(self, out, true);
+    write_block(self, out, true);
+    if (self->bitcount) {
+        put_bits(self, out, 0, 8 - self->bitcount);
+    }
+
+    uint32_t c = self->checksum;
+    if (self->format == ZLIB_FORMAT_ZLIB) {
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            vstr_add_byte(out, c >> shift);
+        }
+    } else if (self->format == ZLIB_FORMAT_GZIP) {
+        c = ~c;
+        for (int i = 0; i < 4; i++) {
+            vstr_add_byte(out, c >> (8 * i));
+        }
+        for (int i = 0; i < 4; i++) {
+            vstr_add_byte(out, self->total_in >> (8 * i));
+        }
+    }
+    common_hal_zlib_compressor_deinit(self);
+}
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+
+// log2 of the largest history window the compressor will use. A compressor
+// with a window of W bytes needs about 4*W bytes plus 3kB of working memory.
+// Streams requesting a larger window are compressed with this one instead,
+// and the zlib header advertises the smaller window to the decompressor.
+#ifndef ZLIB_COMPRESS_WINDOW_BITS
+#define ZLIB_COMPRESS_WINDOW_BITS (10)
+#endif
+
+#if ZLIB_COMPRESS_WINDOW_BITS < 9 || ZLIB_COMPRESS_WINDOW_BITS > 14
+#error "ZLIB_COMPRESS_WINDOW_BITS must be in the range 9 to 14"
+#endif
+
+#define ZLIB_COMPRESS_HASH_BITS (9)
+// Number of literals and matches collected before a block is written out.
+#define ZLIB_COMPRESS_BLOCK_SYMBOLS (512)
+
+#define ZLIB_DEFLATE_LITLEN_CODES (286)
+#define ZLIB_DEFLATE_DIST_CODES (30)
+
+typedef enum {
+    ZLIB_FORMAT_RAW,
+    ZLIB_FORMAT_ZLIB,
+    ZLIB_FORMAT_GZIP,
+} zlib_format_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    // window_size bytes of history followed by window_size bytes of lookahead.
+    uint8_t *window;
+    // Previous position with the same hash, indexed by position & (window_size - 1).
+    uint16_t *prev;
+    uint16_t head[1 << ZLIB_COMPRESS_HASH_BITS];
+    // Symbols of the block being collected: a literal byte, or match length - 3
+    // when the corresponding distance is nonzero.
+    uint8_t sym_len[ZLIB_COMPRESS_BLOCK_SYMBOLS];
+    uint16_t sym_dist[ZLIB_COMPRESS_BLOCK_SYMBOLS];
+    uint16_t litlen_freq[ZLIB_DEFLATE_LITLEN_CODES];
+    uint16_t dist_freq[ZLIB_DEFLATE_DIST_CODES];
+    uint16_t sym_count;
+    uint16_t window_size;
+    uint16_t max_chain;
+    uint32_t pos;
+    uint32_t fill;
+    uint32_t checksum;
+    uint32_t total_in;
+    uint32_t bitbuf;
+    uint8_t bitcount;
+    uint8_t window_bits;
+    uint8_t format;
+    bool header_written;
+} zlib_compressor_obj_t;
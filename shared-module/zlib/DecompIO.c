@@ -0,0 +1,105 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "py/mperrno.h"
+
+#include "shared-bindings/zlib/DecompIO.h"
+#include "supervisor/shared/translate/translate.h"
+
+#include "lib/uzlib/tinf.h"
+
+// Called by uzlib when the input buffer is used up. Refill it from the source
+// stream a chunk at a time rather than a byte at a time; as a consequence a
+// few bytes past the end of the compressed data may be consumed from the
+// source stream.
+STATIC int read_src_stream(TINF_DATA *data) {
+    zlib_decompio_obj_t *self = (zlib_decompio_obj_t *)((byte *)data - offsetof(zlib_decompio_obj_t, decomp));
+
+    const mp_stream_p_t *stream = mp_get_stream_raise(self->src_stream, MP_STREAM_OP_READ);
+    int err;
+    mp_uint_t out_sz = stream->read(self->src_stream, self->inbuf, sizeof(self->inbuf), &err);
+    if (out_sz == MP_STREAM_ERROR) {
+        mp_raise_OSError(err);
+    }
+    if (out_sz == 0) {
+        mp_raise_type(&mp_type_EOFError);
+    }
+    data->source = self->inbuf + 1;
+    data->source_limit = self->inbuf + out_sz;
+    return self->inbuf[0];
+}
+
+void common_hal_zlib_decompio_construct(zlib_decompio_obj_t *self, mp_obj_t src_stream, mp_int_t wbits) {
+    memset(&self->decomp, 0, sizeof(self->decomp));
+    self->decomp.readSource = read_src_stream;
+    self->src_stream = src_stream;
+    self->eof = false;
+
+    int dict_bits;
+    if (wbits >= 16) {
+        if (uzlib_gzip_parse_header(&self->decomp) != TINF_OK) {
+            mp_raise_ValueError(translate("compression header"));
+        }
+        dict_bits = wbits - 16;
+    } else if (wbits >= 0) {
+        // The header gives the window size as log2(size) - 8.
+        int cinfo = uzlib_zlib_parse_header(&self->decomp);
+        if (cinfo < 0) {
+            mp_raise_ValueError(translate("compression header"));
+        }
+        dict_bits = cinfo + 8;
+    } else {
+        dict_bits = -wbits;
+    }
+    // The window must cover the largest back-reference the compressor may
+    // have made; DEFLATE never refers back more than 32kB.
+    dict_bits = mp_arg_validate_int_range(dict_bits, 8, 15, MP_QSTR_wbits);
+
+    mp_uint_t dict_sz = 1 << dict_bits;
+    uzlib_uncompress_init(&self->decomp, m_new(byte, dict_sz), dict_sz);
+}
+
+mp_uint_t common_hal_zlib_decompio_readinto(zlib_decompio_obj_t *self, uint8_t *buf, mp_uint_t size, int *errcode) {
+    if (self->eof) {
+        return 0;
+    }
+
+    self->decomp.dest = buf;
+    self->decomp.dest_limit = buf + size;
+    int st = uzlib_uncompress_chksum(&self->decomp);
+    if (st == TINF_DONE) {
+        self->eof = true;
+    }
+    if (st < 0) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+    return self->decomp.dest - buf;
+}
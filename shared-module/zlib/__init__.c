@@ -38,6 +38,7 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/Compressor.h"
 
 #define UZLIB_CONF_PARANOID_CHECKS (1)
 #include "lib/uzlib/tinf.h"
@@ -48,7 +49,7 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
-mp_obj_t common_hal_zlib_decompress(mp_obj_t data, bool is_zlib) {
+mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits, mp_int_t bufsize) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
 
@@ -56,7 +57,9 @@ mp_obj_t common_hal_zlib_decompress(mp_obj_t data, bool is_zlib) {
     memset(decomp, 0, sizeof(*decomp));
     DEBUG_printf("sizeof(TINF_DATA)=" UINT_FMT "\n", sizeof(*decomp));
     uzlib_uncompress_init(decomp, NULL, 0);
-    mp_uint_t dest_buf_size = (bufinfo.len + 15) & ~15;
+    // Start from the caller's size hint if there is one, otherwise guess
+    // a modest compression ratio.
+    mp_uint_t dest_buf_size = bufsize > 0 ? (mp_uint_t)bufsize : (bufinfo.len * 2 + 15) & ~15;
     byte *dest_buf = m_new(byte, dest_buf_size);
 
     decomp->dest = dest_buf;
@@ -66,7 +69,12 @@ mp_obj_t common_hal_zlib_decompress(mp_obj_t data, bool is_zlib) {
     decomp->source_limit = (unsigned char *)bufinfo.buf + bufinfo.len;
     int st;
 
-    if (is_zlib) {
+    if (wbits >= 16) {
+        st = uzlib_gzip_parse_header(decomp);
+        if (st != TINF_OK) {
+            goto error;
+        }
+    } else if (wbits >= 0) {
         st = uzlib_zlib_parse_header(decomp);
         if (st < 0) {
             goto error;
@@ -81,11 +89,14 @@ mp_obj_t common_hal_zlib_decompress(mp_obj_t data, bool is_zlib) {
         if (st == TINF_DONE) {
             break;
         }
+        // Grow geometrically so that large outputs don't cost a reallocation
+        // (and copy) for every 256 bytes produced.
         size_t offset = decomp->dest - dest_buf;
-        dest_buf = m_renew(byte, dest_buf, dest_buf_size, dest_buf_size + 256);
-        dest_buf_size += 256;
+        mp_uint_t new_size = dest_buf_size + MAX(dest_buf_size / 2, 256);
+        dest_buf = m_renew(byte, dest_buf, dest_buf_size, new_size);
+        dest_buf_size = new_size;
         decomp->dest = dest_buf + offset;
-        decomp->dest_limit = dest_buf + offset + 256;
+        decomp->dest_limit = dest_buf + dest_buf_size;
     }
 
     mp_uint_t final_sz = decomp->dest - dest_buf;
@@ -98,3 +109,18 @@ mp_obj_t common_hal_zlib_decompress(mp_obj_t data, bool is_zlib) {
 error:
     mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
 }
+
+mp_obj_t common_hal_zlib_compress(mp_obj_t data, mp_int_t level, mp_int_t wbits) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+
+    zlib_compressor_obj_t *compressor = m_new_obj(zlib_compressor_obj_t);
+    common_hal_zlib_compressor_construct(compressor, level, wbits);
+
+    vstr_t vstr;
+    vstr_init(&vstr, bufinfo.len / 2 + 16);
+    common_hal_zlib_compressor_compress(compressor, bufinfo.buf, bufinfo.len, &vstr);
+    common_hal_zlib_compressor_flush(compressor, &vstr);
+    m_del_obj(zlib_compressor_obj_t, compressor);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
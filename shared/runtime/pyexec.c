@@ -114,10 +114,17 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
                 if (input_kind == MP_PARSE_FILE_INPUT) {
                     mp_store_global(MP_QSTR___file__, MP_OBJ_NEW_QSTR(source_name));
                 }
-                mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
-                module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
-                // Clear the parse tree because it has a heap pointer we don't need anymore.
-                *((uint32_t volatile *)&parse_tree.chunk) = 0;
+                #if MICROPY_COMP_INCREMENTAL
+                if (input_kind == MP_PARSE_FILE_INPUT && !(exec_flags & EXEC_FLAG_IS_REPL)) {
+                    module_fun = mp_compile_incremental(lex);
+                } else
+                #endif
+                {
+                    mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
+                    module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                    // Clear the parse tree because it has a heap pointer we don't need anymore.
+                    *((uint32_t volatile *)&parse_tree.chunk) = 0;
+                }
                 #else
                 mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("script compilation not supported"));
                 #endif
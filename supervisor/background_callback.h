@@ -28,6 +28,7 @@
 #define CIRCUITPY_INCLUDED_SUPERVISOR_BACKGROUND_CALLBACK_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /** Background callbacks are a linked list of tasks to call in the background.
  *
@@ -53,13 +54,34 @@
  * supervisor_enable_tick() and disabled with supervisor_disable_tick(). When
  * enabled, a timer will schedule a callback to supervisor_background_tick(),
  * which includes port_background_tick(), every millisecond.
+ *
+ * Each callback belongs to a priority class with its own queue. Realtime
+ * callbacks (such as audio buffer refills) run first, and again between each
+ * of the other callbacks, so a slow callback delays them by at most its own
+ * runtime. Normal callbacks all run each time. Bulk callbacks run only until
+ * CIRCUITPY_BACKGROUND_BULK_BUDGET_US has passed, and the rest wait for the
+ * next invocation, unless their deadline has passed. A zero-initialized
+ * callback is normal. Set the class with
+ * background_callback_add_priority(); it sticks for later adds.
  */
 typedef void (*background_callback_fun)(void *data);
+
+typedef enum {
+    BACKGROUND_CALLBACK_NORMAL,
+    BACKGROUND_CALLBACK_REALTIME,
+    BACKGROUND_CALLBACK_BULK,
+    BACKGROUND_CALLBACK_NUM_PRIORITIES,
+} background_callback_priority_t;
+
 typedef struct background_callback {
     background_callback_fun fun;
     void *data;
     struct background_callback *next;
     struct background_callback *prev;
+    // Absolute supervisor_ticks_ms32() after which a bulk callback runs
+    // regardless of the budget. 0 when there is no deadline.
+    uint32_t deadline;
+    uint8_t priority;
 } background_callback_t;
 
 /* Add a background callback for which 'fun' and 'data' were previously set */
@@ -74,6 +96,13 @@ void background_callback_add_core(background_callback_t *cb);
  */
 void background_callback_add(background_callback_t *cb, background_callback_fun fun, void *data);
 
+/* Like background_callback_add, but also set the priority class. A non-zero
+ * deadline_ms is how many milliseconds a bulk callback may wait behind the budget.
+ * If the callback is already queued, only an earlier deadline is taken.
+ */
+void background_callback_add_priority(background_callback_t *cb, background_callback_fun fun, void *data,
+    background_callback_priority_t priority, uint32_t deadline_ms);
+
 /* Run all background callbacks.  Normally, this is done by the supervisor
  * whenever the list is non-empty */
 void background_callback_run_all(void);
@@ -97,4 +126,12 @@ void background_callback_end_critical_section(void);
  */
 void background_callback_gc_collect(void);
 
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+#include "py/obj.h"
+
+/* The runtime of each callback function, as a tuple of
+ * (function_address, count, total_us, max_us) tuples. */
+mp_obj_t background_callback_stats(bool reset);
+#endif
+
 #endif
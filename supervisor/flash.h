@@ -50,6 +50,15 @@ void supervisor_flash_init_vfs(struct _fs_user_mount_t *vfs);
 void supervisor_flash_flush(void);
 void supervisor_flash_release_cache(void);
 
+// Where the given block can be read directly in the address space, or NULL if
+// the flash isn't memory-mapped. Block numbers are as for
+// supervisor_flash_read_blocks(). Ports with a linearly mapped drive provide
+// this; the default returns NULL.
+const void *supervisor_flash_get_block_address(uint32_t block_num);
+// The same for the CIRCUITPY block device, which starts with a fake MBR.
+// Anything cached is written out first, so the flash is current.
+const void *supervisor_flash_map_block(uint32_t block_num);
+
 void supervisor_flash_set_extended(bool extended);
 bool supervisor_flash_get_extended(void);
 void supervisor_flash_update_extended(void);
@@ -34,6 +34,12 @@
 #define PLACE_IN_DTCM_BSS(name) name __attribute__((section(".dtcm_bss." #name)))
 // Don't inline ITCM functions because that may pull them out of ITCM into other sections.
 #define PLACE_IN_ITCM(name) __attribute__((section(".itcm." #name),noinline,aligned(4))) name
+#elif defined(CIRCUITPY_ITCM_IN_IRAM) && CIRCUITPY_ITCM_IN_IRAM
+// Espressif chips have no ITCM, but code in IRAM runs without going through the flash cache.
+#include "esp_attr.h"
+#define PLACE_IN_DTCM_DATA(name) name
+#define PLACE_IN_DTCM_BSS(name) name
+#define PLACE_IN_ITCM(name) IRAM_ATTR __attribute__((noinline)) name
 #else
 #define PLACE_IN_DTCM_DATA(name) name
 #define PLACE_IN_DTCM_BSS(name) name
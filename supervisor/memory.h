@@ -56,8 +56,8 @@ supervisor_allocation *allocate_remaining_memory(void);
 // Allocate a piece of a given length in bytes. If high_address is true then it should be allocated
 // at a lower address from the top of the stack. Otherwise, addresses will increase starting after
 // statically allocated memory. If movable is false, memory will be taken from outside the GC heap
-// and will stay stationary until freed. While the VM is running, this will fail unless a previous
-// allocation of exactly matching length has recently been freed. If movable is true, memory will be
+// and will stay stationary until freed. While the VM is running, this will fail unless enough
+// memory freed by previous allocations is left over to fit it. If movable is true, memory will be
 // taken from either outside or inside the GC heap, and when the VM exits, will be moved outside.
 // The ptr of the returned supervisor_allocation will change at that point. If you need to be
 // notified of that, add your own callback function at the designated place near the end of
@@ -74,4 +74,9 @@ size_t get_allocation_length(supervisor_allocation *allocation);
 // supervisor heap and compacts the supervisor heap.
 void supervisor_move_memory(void);
 
+#if CIRCUITPY_SUPERVISOR_MEMORY_INFO
+// The free bytes outside the VM heap and the largest allocation that would currently fit.
+void supervisor_memory_info(size_t *free_bytes, size_t *largest_free);
+#endif
+
 #endif  // MICROPY_INCLUDED_SUPERVISOR_MEMORY_H
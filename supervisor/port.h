@@ -67,6 +67,11 @@ uint32_t *port_heap_get_bottom(void);
 // Get heap top address
 uint32_t *port_heap_get_top(void);
 
+// Return length bytes of RAM for the Python stack if the port has RAM for it that is faster than
+// the heap, such as internal SRAM when the heap is in PSRAM. The port keeps it for later VM runs.
+// Return NULL to put the Python stack in a supervisor allocation.
+uint32_t *port_fast_pystack(size_t length);
+
 // Save and retrieve a word from memory that is preserved over reset. Used for safe mode.
 void port_set_saved_word(uint32_t);
 uint32_t port_get_saved_word(void);
@@ -129,6 +134,11 @@ void port_post_boot_py(bool heap_valid);
 // A default weak implementation is provided that does nothing.
 void port_boot_info(void);
 
+// Called after each pass of background callbacks, before control goes back to
+// the VM. Ports that hand work from a callback to another core finish it here.
+// A default weak implementation is provided that does nothing.
+void port_background_callbacks_done(void);
+
 // Some ports want to mark additional pointers as gc roots.
 // A default weak implementation is provided that does nothing.
 void port_gc_collect(void);
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include "py/mpprint.h"
+
+// A sampling profiler for Python code, enabled with CIRCUITPY_PROFILE. While
+// it runs, each supervisor tick records the running bytecode functions, from
+// the innermost out to CIRCUITPY_PROFILE_DEPTH of them, and the line in the
+// innermost one. Identical stacks share a counter in a table on the heap.
+// Because the profiler follows the tick, it measures wall clock time; time
+// spent in sleep or in background tasks is charged to the calling line.
+
+#if CIRCUITPY_PROFILE
+// Start sampling into a new table of up to max_stacks distinct stacks,
+// discarding any previous results.
+void supervisor_profile_start(size_t max_stacks);
+// Stop sampling and write the results as folded stacks, one
+// "outer;...;inner count" line per stack, which flamegraph.pl and
+// speedscope can display.
+void supervisor_profile_stop(const mp_print_t *print);
+// Called from supervisor_tick().
+void supervisor_profile_sample(void);
+// Stop sampling and forget the table before the heap goes away.
+void supervisor_profile_reset(void);
+#endif
@@ -28,35 +28,121 @@
 
 #include "py/gc.h"
 #include "py/mpconfig.h"
+#include "py/mphal.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/linker.h"
 #include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
+#include "supervisor/trace.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
-STATIC volatile background_callback_t *volatile callback_head, *volatile callback_tail;
+typedef struct {
+    background_callback_t *head;
+    background_callback_t *tail;
+    // Number of callbacks queued, so that a run only takes the ones that were
+    // already there when it started.
+    size_t count;
+} callback_queue_t;
+
+STATIC volatile callback_queue_t callback_queue[BACKGROUND_CALLBACK_NUM_PRIORITIES];
 
 #define CALLBACK_CRITICAL_BEGIN (common_hal_mcu_disable_interrupts())
 #define CALLBACK_CRITICAL_END (common_hal_mcu_enable_interrupts())
 
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+typedef struct {
+    background_callback_fun fun;
+    uint32_t count;
+    uint32_t total_us;
+    uint32_t max_us;
+} callback_stats_t;
+
+STATIC callback_stats_t callback_stats[CIRCUITPY_BACKGROUND_CALLBACK_STATS_SLOTS];
+
+STATIC void record_callback_stats(background_callback_fun fun, uint32_t elapsed) {
+    // Slots are handed out in the order functions first run. Once they are all
+    // taken, the last one collects everything else.
+    callback_stats_t *stats = &callback_stats[0];
+    for (size_t i = 0; i < CIRCUITPY_BACKGROUND_CALLBACK_STATS_SLOTS - 1; i++, stats++) {
+        if (stats->fun == fun || stats->fun == NULL) {
+            break;
+        }
+    }
+    stats->fun = fun;
+    stats->count++;
+    stats->total_us += elapsed;
+    stats->max_us = MAX(stats->max_us, elapsed);
+}
+
+mp_obj_t background_callback_stats(bool reset) {
+    size_t n = 0;
+    while (n < CIRCUITPY_BACKGROUND_CALLBACK_STATS_SLOTS && callback_stats[n].fun != NULL) {
+        n++;
+    }
+    mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(n, NULL));
+    for (size_t i = 0; i < n; i++) {
+        callback_stats_t *stats = &callback_stats[i];
+        mp_obj_t items[] = {
+            mp_obj_new_int_from_uint((uintptr_t)stats->fun),
+            mp_obj_new_int_from_uint(stats->count),
+            mp_obj_new_int_from_uint(stats->total_us),
+            mp_obj_new_int_from_uint(stats->max_us),
+        };
+        result->items[i] = mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+    }
+    if (reset) {
+        memset(callback_stats, 0, sizeof(callback_stats));
+    }
+    return MP_OBJ_FROM_PTR(result);
+}
+#endif
+
 MP_WEAK void port_wake_main_task(void) {
 }
 
+STATIC inline bool is_queued(background_callback_t *cb) {
+    return cb->prev || callback_queue[cb->priority].head == cb;
+}
+
+// Call with interrupts disabled.
+STATIC void enqueue(background_callback_t *cb) {
+    volatile callback_queue_t *queue = &callback_queue[cb->priority];
+    cb->next = 0;
+    cb->prev = queue->tail;
+    if (queue->tail) {
+        queue->tail->next = cb;
+    }
+    if (!queue->head) {
+        queue->head = cb;
+    }
+    queue->tail = cb;
+    queue->count++;
+}
+
+// Call with interrupts disabled.
+STATIC void dequeue(background_callback_t *cb) {
+    volatile callback_queue_t *queue = &callback_queue[cb->priority];
+    if (cb->prev) {
+        cb->prev->next = cb->next;
+    } else {
+        queue->head = cb->next;
+    }
+    if (cb->next) {
+        cb->next->prev = cb->prev;
+    } else {
+        queue->tail = cb->prev;
+    }
+    cb->next = cb->prev = NULL;
+    queue->count--;
+}
+
 void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
     CALLBACK_CRITICAL_BEGIN;
-    if (cb->prev || callback_head == cb) {
+    if (is_queued(cb)) {
         CALLBACK_CRITICAL_END;
         return;
     }
-    cb->next = 0;
-    cb->prev = (background_callback_t *)callback_tail;
-    if (callback_tail) {
-        callback_tail->next = cb;
-    }
-    if (!callback_head) {
-        callback_head = cb;
-    }
-    callback_tail = cb;
+    enqueue(cb);
     CALLBACK_CRITICAL_END;
 
     port_wake_main_task();
@@ -68,13 +154,101 @@ void PLACE_IN_ITCM(background_callback_add)(background_callback_t * cb, backgrou
     background_callback_add_core(cb);
 }
 
+void PLACE_IN_ITCM(background_callback_add_priority)(background_callback_t * cb, background_callback_fun fun, void *data,
+    background_callback_priority_t priority, uint32_t deadline_ms) {
+    uint32_t deadline = 0;
+    if (deadline_ms) {
+        // 0 means no deadline, so step over it when the tick count wraps.
+        deadline = supervisor_ticks_ms32() + deadline_ms;
+        if (deadline == 0) {
+            deadline = 1;
+        }
+    }
+    CALLBACK_CRITICAL_BEGIN;
+    cb->fun = fun;
+    cb->data = data;
+    if (is_queued(cb)) {
+        if (deadline && (!cb->deadline || (int32_t)(deadline - cb->deadline) < 0)) {
+            cb->deadline = deadline;
+        }
+        CALLBACK_CRITICAL_END;
+        return;
+    }
+    cb->priority = priority;
+    cb->deadline = deadline;
+    enqueue(cb);
+    CALLBACK_CRITICAL_END;
+
+    port_wake_main_task();
+}
+
 bool inline background_callback_pending(void) {
-    return callback_head != NULL;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_NUM_PRIORITIES; i++) {
+        if (callback_queue[i].head != NULL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Call with interrupts disabled. Leaves them disabled, but enables them while
+// the callback runs.
+STATIC void run_callback(background_callback_t *cb) {
+    dequeue(cb);
+    cb->deadline = 0;
+    background_callback_fun fun = cb->fun;
+    void *data = cb->data;
+    CALLBACK_CRITICAL_END;
+    // Leave the critical section in order to run the callback function
+    if (fun) {
+        SUPERVISOR_TRACE_BEGIN(SUPERVISOR_TRACE_BACKGROUND_CALLBACK, (const void *)fun);
+        #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+        mp_uint_t start_us = mp_hal_ticks_us();
+        fun(data);
+        record_callback_stats(fun, mp_hal_ticks_us() - start_us);
+        #else
+        fun(data);
+        #endif
+        SUPERVISOR_TRACE_END(SUPERVISOR_TRACE_BACKGROUND_CALLBACK);
+    }
+    CALLBACK_CRITICAL_BEGIN;
+}
+
+// Call with interrupts disabled. Only callbacks that are queued on entry run, so
+// one that re-queues itself waits for the next pass.
+STATIC void run_realtime(void) {
+    volatile callback_queue_t *queue = &callback_queue[BACKGROUND_CALLBACK_REALTIME];
+    for (size_t n = queue->count; n > 0 && queue->head; n--) {
+        run_callback(queue->head);
+    }
+}
+
+// Call with interrupts disabled. Returns the first of the next n bulk callbacks
+// whose deadline has passed, or NULL.
+STATIC background_callback_t *overdue_bulk(size_t n) {
+    uint32_t now = supervisor_ticks_ms32();
+    for (background_callback_t *cb = callback_queue[BACKGROUND_CALLBACK_BULK].head; cb && n > 0; cb = cb->next, n--) {
+        if (cb->deadline && (int32_t)(now - cb->deadline) >= 0) {
+            return cb;
+        }
+    }
+    return NULL;
 }
 
 static bool in_background_callback;
 void PLACE_IN_ITCM(background_callback_run_all)() {
+    SUPERVISOR_TRACE_BACKGROUND_CHECK();
+    SUPERVISOR_TRACE_BEGIN(SUPERVISOR_TRACE_PORT_BACKGROUND_TASK, NULL);
     port_background_task();
+    SUPERVISOR_TRACE_END(SUPERVISOR_TRACE_PORT_BACKGROUND_TASK);
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Continue a sweep left by gc.collect(budget_us=...). Finalisers may use
+    // resources that the code running background tasks is in the middle of using,
+    // so garbage that has them waits for the next collection.
+    if (gc_sweep_pending() && !in_background_callback) {
+        gc_sweep_step(MICROPY_GC_SWEEP_STEP_US, false);
+    }
+    #endif
     if (!background_callback_pending()) {
         return;
     }
@@ -84,24 +258,33 @@ void PLACE_IN_ITCM(background_callback_run_all)() {
         return;
     }
     in_background_callback = true;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    callback_head = NULL;
-    callback_tail = NULL;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        cb->next = cb->prev = NULL;
-        background_callback_fun fun = cb->fun;
-        void *data = cb->data;
-        CALLBACK_CRITICAL_END;
-        // Leave the critical section in order to run the callback function
-        if (fun) {
-            fun(data);
+    volatile callback_queue_t *normal = &callback_queue[BACKGROUND_CALLBACK_NORMAL];
+    volatile callback_queue_t *bulk = &callback_queue[BACKGROUND_CALLBACK_BULK];
+    size_t normal_left = normal->count;
+    size_t bulk_left = bulk->count;
+
+    run_realtime();
+    while (normal_left > 0 && normal->head) {
+        run_callback(normal->head);
+        normal_left--;
+        run_realtime();
+    }
+    mp_uint_t bulk_start_us = mp_hal_ticks_us();
+    while (bulk_left > 0 && bulk->head) {
+        background_callback_t *cb = bulk->head;
+        if (mp_hal_ticks_us() - bulk_start_us >= CIRCUITPY_BACKGROUND_BULK_BUDGET_US) {
+            cb = overdue_bulk(bulk_left);
+            if (!cb) {
+                break;
+            }
         }
-        CALLBACK_CRITICAL_BEGIN;
-        cb = next;
+        run_callback(cb);
+        bulk_left--;
+        run_realtime();
     }
     in_background_callback = false;
     CALLBACK_CRITICAL_END;
+    port_background_callbacks_done();
 }
 
 void background_callback_begin_critical_section() {
@@ -115,25 +298,23 @@ void background_callback_end_critical_section() {
 
 // Filter out queued callbacks if they are allocated on the heap.
 void background_callback_reset() {
-    background_callback_t *new_head = NULL;
-    background_callback_t **previous_next = &new_head;
-    background_callback_t *new_tail = NULL;
     CALLBACK_CRITICAL_BEGIN;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        if (!HEAP_PTR((void *)cb)) {
-            *previous_next = cb;
-            previous_next = &cb->next;
-            cb->next = NULL;
-            new_tail = cb;
-        } else {
-            memset(cb, 0, sizeof(*cb));
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_NUM_PRIORITIES; i++) {
+        volatile callback_queue_t *queue = &callback_queue[i];
+        background_callback_t *cb = queue->head;
+        queue->head = queue->tail = NULL;
+        queue->count = 0;
+        while (cb) {
+            background_callback_t *next = cb->next;
+            cb->next = cb->prev = NULL;
+            if (!HEAP_PTR((void *)cb)) {
+                enqueue(cb);
+            } else {
+                memset(cb, 0, sizeof(*cb));
+            }
+            cb = next;
         }
-        cb = next;
     }
-    callback_head = new_head;
-    callback_tail = new_tail;
     in_background_callback = false;
     CALLBACK_CRITICAL_END;
 }
@@ -153,9 +334,11 @@ void background_callback_gc_collect(void) {
     // It's necessary to traverse the whole list here, as the callbacks
     // themselves can be in non-gc memory, and some of the cb->data
     // objects themselves might be in non-gc memory.
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        gc_collect_ptr(cb->data);
-        cb = cb->next;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_NUM_PRIORITIES; i++) {
+        background_callback_t *cb = callback_queue[i].head;
+        while (cb) {
+            gc_collect_ptr(cb->data);
+            cb = cb->next;
+        }
     }
 }
@@ -38,6 +38,10 @@
 #include "shared-bindings/_bleio/UUID.h"
 #include "shared-module/storage/__init__.h"
 
+#if CIRCUITPY_OS_GETENV
+#include "shared-module/os/__init__.h"
+#endif
+
 #include "bluetooth/ble_drv.h"
 
 #include "common-hal/_bleio/__init__.h"
@@ -65,12 +69,18 @@ const uint8_t file_transfer_base_uuid[16] = {0x72, 0x65, 0x66, 0x73, 0x6e, 0x61,
 
 STATIC mp_obj_list_t characteristic_list;
 STATIC mp_obj_t characteristic_list_items[2];
-// 2 * 10 ringbuf packets, 512 for a disk sector and 12 for the file transfer write header.
-#define PACKET_BUFFER_SIZE (2 * 10 + 512 + 12)
+// A windowed client may have this much write data in flight.
+#define WRITE_WINDOW (CIRCUITPY_BLE_FILE_TRANSFER_WRITE_WINDOW)
+// Each sector in flight is 512 bytes of data and a 12 byte write header, split
+// into packets of at least 20 bytes that each take a 2 byte ringbuf header.
+#define WRITE_DATA_PACKETS ((12 + 512 + 19) / 20)
+#define PACKET_BUFFER_SIZE ((WRITE_WINDOW / 512) * (12 + 512 + 2 * WRITE_DATA_PACKETS))
 // uint32_t so its aligned
 STATIC uint32_t _buffer[PACKET_BUFFER_SIZE / 4 + 1];
 STATIC uint32_t _outgoing1[BLE_GATTS_VAR_ATTR_LEN_MAX / 4];
 STATIC uint32_t _outgoing2[BLE_GATTS_VAR_ATTR_LEN_MAX / 4];
+// File data is read in pieces of up to this size to fill outgoing packets.
+STATIC uint8_t _read_buffer[256];
 STATIC ble_drv_evt_handler_entry_t static_handler_entry;
 STATIC bleio_packet_buffer_obj_t _transfer_packet_buffer;
 
@@ -102,7 +112,7 @@ void supervisor_start_bluetooth_file_transfer(void) {
         NULL,                                       // no initial value
         NULL); // no description
 
-    uint32_t version = 4;
+    uint32_t version = 5;
     mp_buffer_info_t bufinfo;
     bufinfo.buf = &version;
     bufinfo.len = sizeof(version);
@@ -151,11 +161,60 @@ STATIC uint64_t truncate_time(uint64_t input_time, DWORD *fattime) {
 
 // Used by read and write.
 STATIC FIL active_file;
+
+// Sends the READ_DATA header and then the chunk, in pieces that fill each
+// packet, and closes the file after its last chunk. Returns the next command.
+STATIC uint8_t _send_read_data(uint32_t chunk_offset, uint32_t chunk_size) {
+    struct read_data response;
+    response.command = READ_DATA;
+    response.status = STATUS_OK;
+    size_t response_size = sizeof(struct read_data);
+
+    uint32_t total_length = f_size(&active_file);
+    if (chunk_offset > total_length) {
+        chunk_offset = total_length;
+    }
+    chunk_size = MIN(chunk_size, total_length - chunk_offset);
+    response.chunk_offset = chunk_offset;
+    response.total_length = total_length;
+    response.data_size = chunk_size;
+    common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
+    f_lseek(&active_file, chunk_offset);
+
+    mp_int_t packet_size = common_hal_bleio_packet_buffer_get_outgoing_packet_length(&_transfer_packet_buffer);
+    if (packet_size < (mp_int_t)response_size + 1) {
+        packet_size = response_size + 1;
+    }
+    // The first piece shares a packet with the header.
+    size_t piece_size = packet_size - response_size;
+    size_t sent = 0;
+    while (sent < chunk_size) {
+        size_t quantity_read;
+        size_t read_size = MIN(MIN(chunk_size - sent, piece_size), sizeof(_read_buffer));
+        FRESULT result = f_read(&active_file, _read_buffer, read_size, &quantity_read);
+        if (quantity_read == 0 || result != FR_OK) {
+            // TODO: If we can't read everything, then the file must have been shortened. Maybe we
+            // should return 0s to pad it out.
+            break;
+        }
+        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, _read_buffer, quantity_read, NULL, 0);
+        sent += quantity_read;
+        piece_size -= quantity_read;
+        if (piece_size == 0) {
+            piece_size = packet_size;
+        }
+    }
+    if (chunk_offset + sent >= total_length) {
+        f_close(&active_file);
+        return ANY_COMMAND;
+    }
+    return READ_PACING;
+}
+
 STATIC uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
     struct read_command *command = (struct read_command *)raw_buf;
     size_t header_size = sizeof(struct read_command);
     size_t response_size = sizeof(struct read_data);
-    uint8_t data_buffer[response_size];
     struct read_data response;
     response.command = READ_DATA;
     response.status = STATUS_OK;
@@ -180,75 +239,19 @@ STATIC uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
         return ANY_COMMAND;
     }
-    uint32_t total_length = f_size(&active_file);
-    // Write out the response header.
-    uint32_t offset = command->chunk_offset;
-    uint32_t chunk_size = command->chunk_size;
-    chunk_size = MIN(chunk_size, total_length - offset);
-    response.chunk_offset = offset;
-    response.total_length = total_length;
-    response.data_size = chunk_size;
-    common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
-    f_lseek(&active_file, offset);
-    // Write out the chunk contents. We can do this in small pieces because PacketBuffer
-    // will assemble them into larger packets of its own.
-    size_t chunk_end = offset + chunk_size;
-    while (offset < chunk_end) {
-        size_t quantity_read;
-        size_t read_amount = MIN(response_size, chunk_end - offset);
-        f_read(&active_file, data_buffer, read_amount, &quantity_read);
-        offset += quantity_read;
-        // TODO: Do something if the read fails
-        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, data_buffer, quantity_read, NULL, 0);
-    }
-    if (offset >= total_length) {
-        f_close(&active_file);
-        return ANY_COMMAND;
-    }
-    return READ_PACING;
+    return _send_read_data(command->chunk_offset, command->chunk_size);
 }
 
 STATIC uint8_t _process_read_pacing(const uint8_t *raw_buf, size_t command_len) {
     struct read_pacing *command = (struct read_pacing *)raw_buf;
-    struct read_data response;
-    response.command = READ_DATA;
-    response.status = STATUS_OK;
-    size_t response_size = sizeof(struct read_data);
-
-    uint32_t total_length = f_size(&active_file);
-    // Write out the response header.
-    uint32_t chunk_size = MIN(command->chunk_size, total_length - command->chunk_offset);
-    response.chunk_offset = command->chunk_offset;
-    response.total_length = total_length;
-    response.data_size = chunk_size;
-    common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
-    f_lseek(&active_file, command->chunk_offset);
-    // Write out the chunk contents. We can do this in small pieces because PacketBuffer
-    // will assemble them into larger packets of its own.
-    size_t chunk_offset = 0;
-    uint8_t data[20];
-    while (chunk_offset < chunk_size) {
-        size_t quantity_read;
-        size_t read_size = MIN(chunk_size - chunk_offset, sizeof(data));
-        FRESULT result = f_read(&active_file, &data, read_size, &quantity_read);
-        if (quantity_read == 0 || result != FR_OK) {
-            // TODO: If we can't read everything, then the file must have been shortened. Maybe we
-            // should return 0s to pad it out.
-            break;
-        }
-        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&data, quantity_read, NULL, 0);
-        chunk_offset += quantity_read;
-    }
-    if ((chunk_offset + chunk_size) >= total_length) {
-        f_close(&active_file);
-        return ANY_COMMAND;
-    }
-    return READ_PACING;
+    return _send_read_data(command->chunk_offset, command->chunk_size);
 }
 
 // Used by write and write data to know when the write is complete.
 STATIC size_t total_write_length;
 STATIC uint64_t _truncated_time;
+// The client asked to send several WRITE_DATA commands per WRITE_PACING.
+STATIC bool _windowed;
 
 // Returns true if usb is active and replies with an error if so. If not, it grabs
 // the USB mass storage lock and returns false. Make sure to release the lock with
@@ -283,6 +286,7 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
         return THIS_COMMAND;
     }
     total_write_length = command->total_length;
+    _windowed = (command->flags & WRITE_FLAG_WINDOWED) != 0;
 
     char *path = (char *)command->path;
     path[command->path_length] = '\0';
@@ -308,7 +312,8 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
 
     // Align the next chunk to a sector boundary.
     uint32_t offset = command->offset;
-    size_t chunk_size = MIN(total_write_length - offset, 512 - (offset % 512));
+    size_t window = _windowed ? WRITE_WINDOW : 512;
+    size_t chunk_size = MIN(total_write_length - offset, window - (offset % 512));
     // Special case when truncating the file. (Deleting stuff off the end.)
     if (chunk_size == 0) {
         f_lseek(&active_file, offset);
@@ -318,6 +323,9 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
         #if CIRCUITPY_USB_MSC
         usb_msc_unlock();
         #endif
+        #if CIRCUITPY_OS_GETENV
+        os_getenv_cache_invalidate();
+        #endif
     }
     response.offset = offset;
     response.free_space = chunk_size;
@@ -367,8 +375,9 @@ STATIC uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
         return ANY_COMMAND;
     }
     offset += command->data_size;
-    // Align the next chunk to a sector boundary.
-    size_t chunk_size = MIN(total_write_length - offset, 512);
+    // Align the next chunk to a sector boundary. A windowed client has already
+    // sent some of this.
+    size_t chunk_size = MIN(total_write_length - offset, _windowed ? WRITE_WINDOW : 512);
     response.offset = offset;
     response.free_space = chunk_size;
     response.truncated_time = _truncated_time;
@@ -380,6 +389,9 @@ STATIC uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
         #if CIRCUITPY_USB_MSC
         usb_msc_unlock();
         #endif
+        #if CIRCUITPY_OS_GETENV
+        os_getenv_cache_invalidate();
+        #endif
         // Don't reload until everything is written out of the packet buffer.
         common_hal_bleio_packet_buffer_flush(&_transfer_packet_buffer);
         return ANY_COMMAND;
@@ -422,6 +434,9 @@ STATIC uint8_t _process_delete(const uint8_t *raw_buf, size_t command_len) {
     #if CIRCUITPY_USB_MSC
     usb_msc_unlock();
     #endif
+    #if CIRCUITPY_OS_GETENV
+    os_getenv_cache_invalidate();
+    #endif
     if (result != FR_OK) {
         response.status = STATUS_ERROR;
     }
@@ -621,6 +636,9 @@ STATIC uint8_t _process_move(const uint8_t *raw_buf, size_t command_len) {
     #if CIRCUITPY_USB_MSC
     usb_msc_unlock();
     #endif
+    #if CIRCUITPY_OS_GETENV
+    os_getenv_cache_invalidate();
+    #endif
     if (result != FR_OK) {
         response.status = STATUS_ERROR;
     }
@@ -720,5 +738,8 @@ void supervisor_bluetooth_file_transfer_disconnected(void) {
     next_command = ANY_COMMAND;
     current_offset = 0;
     f_close(&active_file);
+    #if CIRCUITPY_OS_GETENV
+    os_getenv_cache_invalidate();
+    #endif
     autoreload_resume(AUTORELOAD_SUSPEND_BLE);
 }
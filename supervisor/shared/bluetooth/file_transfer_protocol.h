@@ -71,7 +71,7 @@ struct read_pacing {
 #define WRITE 0x20
 struct write_command {
     uint8_t command;
-    uint8_t reserved;
+    uint8_t flags;
     uint16_t path_length;
     uint32_t offset;
     uint64_t modification_time;
@@ -79,6 +79,11 @@ struct write_command {
     uint8_t path[];
 } __attribute__((packed));
 
+// Added in version 5. The client may send several WRITE_DATA commands, each up
+// to a sector, before waiting for WRITE_PACING. Each WRITE_PACING's free_space
+// is then how much may be in flight past its offset.
+#define WRITE_FLAG_WINDOWED 0x01
+
 #define WRITE_PACING 0x21
 struct write_pacing {
     uint8_t command;
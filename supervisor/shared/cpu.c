@@ -28,6 +28,11 @@
 
 #include "supervisor/shared/cpu.h"
 
+#if CIRCUITPY_CPU_GOVERNOR
+#include "py/mphal.h"
+#include "supervisor/port.h"
+#endif
+
 bool cpu_interrupt_active(void) {
     #if defined(__ARM_ARCH) && (__ARM_ARCH >= 6) && defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
     // Check VECTACTIVE in ICSR. We don't need to disable interrupts because if
@@ -38,3 +43,79 @@ bool cpu_interrupt_active(void) {
     return false;
     #endif
 }
+
+#if CIRCUITPY_CPU_GOVERNOR
+static uint8_t busy_count[CPU_BUSY_COUNT];
+static bool waiting;
+static cpu_performance_t current_level = CPU_PERFORMANCE_HIGH;
+// Times are in subticks, 1/32768 s.
+static uint64_t level_start;
+static uint64_t residency[CPU_PERFORMANCE_COUNT];
+
+MP_WEAK void port_set_cpu_performance(cpu_performance_t level) {
+    (void)level;
+}
+
+static uint64_t governor_now(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    // There are 32 subticks per tick.
+    return ticks * 32 + subticks;
+}
+
+static void governor_update(void) {
+    cpu_performance_t level = CPU_PERFORMANCE_HIGH;
+    if (waiting) {
+        level = CPU_PERFORMANCE_LOW;
+        for (size_t i = 0; i < CPU_BUSY_COUNT; i++) {
+            if (busy_count[i] > 0) {
+                level = CPU_PERFORMANCE_HIGH;
+            }
+        }
+    }
+    if (level == current_level) {
+        return;
+    }
+    uint64_t now = governor_now();
+    residency[current_level] += now - level_start;
+    level_start = now;
+    current_level = level;
+    port_set_cpu_performance(level);
+}
+
+void cpu_governor_busy(cpu_busy_reason_t reason, bool busy) {
+    uint8_t *count = &busy_count[reason];
+    if (busy) {
+        *count += 1;
+    } else if (*count > 0) {
+        *count -= 1;
+    }
+    governor_update();
+}
+
+void cpu_governor_enter_wait(void) {
+    waiting = true;
+    governor_update();
+}
+
+void cpu_governor_exit_wait(void) {
+    waiting = false;
+    governor_update();
+}
+
+mp_obj_t cpu_governor_stats_get(bool reset) {
+    uint64_t now = governor_now();
+    uint64_t totals[CPU_PERFORMANCE_COUNT] = { residency[0], residency[1] };
+    totals[current_level] += now - level_start;
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_ull(totals[CPU_PERFORMANCE_LOW] * 1000 / 32768),
+        mp_obj_new_int_from_ull(totals[CPU_PERFORMANCE_HIGH] * 1000 / 32768),
+    };
+    if (reset) {
+        level_start = now;
+        residency[CPU_PERFORMANCE_LOW] = 0;
+        residency[CPU_PERFORMANCE_HIGH] = 0;
+    }
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+#endif
@@ -33,4 +33,39 @@
 // True when we're in an interrupt handler.
 bool cpu_interrupt_active(void);
 
+#if CIRCUITPY_CPU_GOVERNOR
+#include "py/obj.h"
+
+// Work that keeps the CPU at full speed even while the VM waits.
+typedef enum {
+    CPU_BUSY_DISPLAY,
+    CPU_BUSY_NETWORK,
+    CPU_BUSY_COUNT,
+} cpu_busy_reason_t;
+
+typedef enum {
+    CPU_PERFORMANCE_LOW,
+    CPU_PERFORMANCE_HIGH,
+    CPU_PERFORMANCE_COUNT,
+} cpu_performance_t;
+
+// Mark the start (busy = true) or end of work that needs full speed. Calls
+// nest per reason.
+void cpu_governor_busy(cpu_busy_reason_t reason, bool busy);
+
+// Called around supervisor_idle_until_interrupt() and
+// supervisor_sleep_until_interrupt(). The CPU runs slow while waiting and at
+// full speed otherwise, unless something is busy.
+void cpu_governor_enter_wait(void);
+void cpu_governor_exit_wait(void);
+
+// The time spent at each performance level as (low_ms, high_ms).
+mp_obj_t cpu_governor_stats_get(bool reset);
+
+// Switch the CPU clock. Only called when the level changes, so it should be
+// cheap and must leave every peripheral clock as it was. The default does
+// nothing.
+void port_set_cpu_performance(cpu_performance_t level);
+#endif
+
 #endif  // MICROPY_INCLUDED_SUPERVISOR_SHARED_CPU_H
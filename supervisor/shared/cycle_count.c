@@ -0,0 +1,61 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/mpconfig.h"
+#include "shared-bindings/microcontroller/Processor.h"
+#include "supervisor/cycle_count.h"
+#include "supervisor/port.h"
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define DWT_CTRL (*(volatile uint32_t *)0xE0001000)
+#define DWT_CYCCNT (*(volatile uint32_t *)0xE0001004)
+#define DEMCR (*(volatile uint32_t *)0xE000EDFC)
+#define DEMCR_TRCENA (1 << 24)
+#define DWT_CTRL_CYCCNTENA (1 << 0)
+
+MP_WEAK uint32_t port_get_cycle_count(void) {
+    if (!(DWT_CTRL & DWT_CTRL_CYCCNTENA)) {
+        DEMCR |= DEMCR_TRCENA;
+        DWT_CYCCNT = 0;
+        DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+    }
+    return DWT_CYCCNT;
+}
+
+MP_WEAK uint32_t port_get_cycle_frequency(void) {
+    return common_hal_mcu_processor_get_frequency();
+}
+#else
+MP_WEAK uint32_t port_get_cycle_count(void) {
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return (uint32_t)ticks * 32 + subticks;
+}
+
+MP_WEAK uint32_t port_get_cycle_frequency(void) {
+    return 32768;
+}
+#endif
@@ -35,12 +35,11 @@
 #include "shared-bindings/displayio/TileGrid.h"
 #include "supervisor/memory.h"
 
-#if CIRCUITPY_RGBMATRIX
+#if CIRCUITPY_DISPLAYIO
 #include "shared-module/displayio/__init__.h"
 #endif
 
 #if CIRCUITPY_SHARPDISPLAY
-#include "shared-module/displayio/__init__.h"
 #include "shared-bindings/sharpdisplay/SharpMemoryFramebuffer.h"
 #include "shared-module/sharpdisplay/SharpMemoryFramebuffer.h"
 #endif
@@ -188,6 +187,11 @@ void supervisor_display_move_memory(void) {
 
     #if CIRCUITPY_DISPLAYIO
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        mp_const_obj_t display_type = displays[i].display_base.type;
+        if (display_type != NULL && display_type != &mp_type_NoneType) {
+            // (offsetof core is equal in all display types)
+            displayio_display_core_move_refresh_buffer(&displays[i].display.core);
+        }
         #if CIRCUITPY_RGBMATRIX
         if (display_buses[i].rgbmatrix.base.type == &rgbmatrix_RGBMatrix_type) {
             rgbmatrix_rgbmatrix_obj_t *pm = &display_buses[i].rgbmatrix;
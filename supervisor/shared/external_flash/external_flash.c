@@ -39,23 +39,64 @@
 #include "lib/oofatfs/ff.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "supervisor/memory.h"
+#if CIRCUITPY_FLASH_FTL
+#include "supervisor/shared/flash_ftl.h"
+#endif
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
+#define BLOCKS_PER_SECTOR (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE)
+#define PAGES_PER_BLOCK (FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE)
+#define PAGES_PER_SECTOR (SPI_FLASH_ERASE_SIZE / SPI_FLASH_PAGE_SIZE)
+
+// Each way of the cache holds the blocks written to one erase sector. A
+// sector is only erased and rewritten when its way is needed for another
+// sector, or when the cache is flushed.
+typedef struct {
+    // The cached sector's address, or NO_SECTOR_LOADED.
+    uint32_t sector;
+    // Track which blocks (up to 32) in the sector currently live in the
+    // cache.
+    uint32_t dirty_mask;
+    // When the way was last written to, for least recently used eviction.
+    uint32_t last_used;
+} cache_way_t;
+
+static cache_way_t cache_ways[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+
+// The number of ways usable with the current cache. When the cache is the
+// scratch sector of the flash itself, there is only one.
+static uint8_t cache_way_count;
+static uint32_t cache_use_count;
 
 STATIC const external_flash_device possible_devices[] = {EXTERNAL_FLASH_DEVICES};
 #define EXTERNAL_FLASH_DEVICE_COUNT MP_ARRAY_SIZE(possible_devices)
 
 static const external_flash_device *flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
-// cache.
-static uint32_t dirty_mask;
-
 static supervisor_allocation *supervisor_cache = NULL;
 
+static uint8_t *ram_cache_page(uint8_t way, uint8_t block_index, uint8_t page) {
+    return MP_STATE_VM(flash_ram_cache)[way * PAGES_PER_SECTOR + block_index * PAGES_PER_BLOCK + page];
+}
+
+static void reset_cache_ways(void) {
+    for (uint8_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        cache_ways[i].sector = NO_SECTOR_LOADED;
+        cache_ways[i].dirty_mask = 0;
+    }
+}
+
+// Returns the way caching the given sector, or -1.
+static int find_cache_way(uint32_t sector) {
+    for (uint8_t i = 0; i < cache_way_count; i++) {
+        if (cache_ways[i].sector == sector) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 // Wait until both the write enable and write in progress bits have cleared.
 static bool wait_for_flash_ready(void) {
     if (flash_device == NULL) {
@@ -179,6 +220,39 @@ static bool erase_sector(uint32_t sector_address) {
     return true;
 }
 
+#if CIRCUITPY_FLASH_FTL
+// Programs any range that lies within erased flash, page by page.
+static bool program_flash(uint32_t address, const uint8_t *data, uint32_t data_length) {
+    while (data_length > 0) {
+        uint32_t length = SPI_FLASH_PAGE_SIZE - (address % SPI_FLASH_PAGE_SIZE);
+        if (length > data_length) {
+            length = data_length;
+        }
+        if (!wait_for_flash_ready() || !write_enable()) {
+            return false;
+        }
+        if (!spi_flash_write_data(address, (uint8_t *)data, length)) {
+            return false;
+        }
+        address += length;
+        data += length;
+        data_length -= length;
+    }
+    return true;
+}
+
+static flash_ftl_device_t ftl_flash = {
+    .read = read_flash,
+    .program = program_flash,
+    .erase = erase_sector,
+    .start = 0,
+    .sector_size = SPI_FLASH_ERASE_SIZE,
+};
+
+// Devices without an erase command are rewritten in place and not mapped.
+static bool use_ftl = false;
+#endif
+
 // Sector is really 24 bits.
 static bool copy_block(uint32_t src_address, uint32_t dest_address) {
     // Copy page by page to minimize RAM buffer.
@@ -292,9 +366,21 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
+    reset_cache_ways();
+    cache_way_count = 0;
     MP_STATE_VM(flash_ram_cache) = NULL;
+
+    #if CIRCUITPY_FLASH_FTL
+    use_ftl = !flash_device->no_erase_cmd;
+    if (use_ftl) {
+        ftl_flash.sector_count = flash_device->total_size / SPI_FLASH_ERASE_SIZE;
+        if (!flash_ftl_mount(&ftl_flash)) {
+            // Falling back to direct mapping would show the mapped blocks
+            // as garbage, so go without a filesystem instead.
+            flash_device = NULL;
+        }
+    }
+    #endif
 }
 
 // The size of each individual block.
@@ -307,14 +393,21 @@ uint32_t supervisor_flash_get_block_count(void) {
     if (flash_device == NULL) {
         return 0;
     }
+    #if CIRCUITPY_FLASH_FTL
+    if (use_ftl) {
+        return flash_ftl_get_block_count();
+    }
+    #endif
     // We subtract one erase sector size because we may use it as a staging area
     // for writes.
     return (flash_device->total_size - SPI_FLASH_ERASE_SIZE) / FILESYSTEM_BLOCK_SIZE;
 }
 
 // Flush the cache that was written to the scratch portion of flash. Only used
-// when ram is tight.
+// when ram is tight, and then there is only one way.
 static bool flush_scratch_flash(void) {
+    uint32_t current_sector = cache_ways[0].sector;
+    uint32_t dirty_mask = cache_ways[0].dirty_mask;
     if (current_sector == NO_SECTOR_LOADED) {
         return true;
     }
@@ -344,159 +437,180 @@ static bool flush_scratch_flash(void) {
     return true;
 }
 
-// Attempts to allocate a new set of page buffers for caching a full sector in
-// ram. Each page is allocated separately so that the GC doesn't need to provide
-// one huge block. We can free it as we write if we want to also.
+// Attempts to allocate a new set of page buffers for caching sectors in ram.
+// As many ways as fit are allocated outside the heap. Failing that, a single
+// way is allocated on the heap, where each page is allocated separately so
+// that the GC doesn't need to provide one huge block.
 static bool allocate_ram_cache(void) {
-    uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-
-    uint32_t table_size = blocks_per_sector * pages_per_block * sizeof(uint32_t);
-    // Attempt to allocate outside the heap first.
-    supervisor_cache = allocate_memory(table_size + SPI_FLASH_ERASE_SIZE, false, false);
-    if (supervisor_cache != NULL) {
-        MP_STATE_VM(flash_ram_cache) = (uint8_t **)supervisor_cache->ptr;
-        uint8_t *page_start = (uint8_t *)supervisor_cache->ptr + table_size;
-
-        for (uint8_t i = 0; i < blocks_per_sector; i++) {
-            for (uint8_t j = 0; j < pages_per_block; j++) {
-                uint32_t offset = i * pages_per_block + j;
-                MP_STATE_VM(flash_ram_cache)[offset] = page_start + offset * SPI_FLASH_PAGE_SIZE;
+    for (uint8_t ways = CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; ways > 0; ways--) {
+        uint32_t table_size = ways * PAGES_PER_SECTOR * sizeof(uint8_t *);
+        // Attempt to allocate outside the heap first.
+        supervisor_cache = allocate_memory(table_size + ways * SPI_FLASH_ERASE_SIZE, false, false);
+        if (supervisor_cache != NULL) {
+            MP_STATE_VM(flash_ram_cache) = (uint8_t **)supervisor_cache->ptr;
+            uint8_t *page_start = (uint8_t *)supervisor_cache->ptr + table_size;
+            for (uint32_t i = 0; i < ways * PAGES_PER_SECTOR; i++) {
+                MP_STATE_VM(flash_ram_cache)[i] = page_start + i * SPI_FLASH_PAGE_SIZE;
             }
+            cache_way_count = ways;
+            return true;
         }
-        return true;
     }
 
     if (MP_STATE_MEM(gc_pool_start) == 0) {
         return false;
     }
 
-    MP_STATE_VM(flash_ram_cache) = m_malloc_maybe(blocks_per_sector * pages_per_block * sizeof(uint32_t), false);
+    MP_STATE_VM(flash_ram_cache) = m_malloc_maybe(PAGES_PER_SECTOR * sizeof(uint8_t *), false);
     if (MP_STATE_VM(flash_ram_cache) == NULL) {
         return false;
     }
-    // Declare i and j outside the loops in case we fail to allocate everything
-    // we need. In that case we'll give it back.
-    uint8_t i = 0;
-    uint8_t j = 0;
-    bool success = true;
-    for (i = 0; i < blocks_per_sector; i++) {
-        for (j = 0; j < pages_per_block; j++) {
-            uint8_t *page_cache = m_malloc_maybe(SPI_FLASH_PAGE_SIZE, false);
-            if (page_cache == NULL) {
-                success = false;
-                break;
-            }
-            MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j] = page_cache;
-        }
-        if (!success) {
-            break;
-        }
-    }
-    // We couldn't allocate enough so give back what we got.
-    if (!success) {
-        // We add 1 so that we delete 0 when i is 1. Going to zero (i >= 0)
-        // would never stop because i is unsigned.
-        i++;
-        for (; i > 0; i--) {
-            for (; j > 0; j--) {
-                m_free(MP_STATE_VM(flash_ram_cache)[(i - 1) * pages_per_block + (j - 1)]);
+    for (uint8_t i = 0; i < PAGES_PER_SECTOR; i++) {
+        uint8_t *page_cache = m_malloc_maybe(SPI_FLASH_PAGE_SIZE, false);
+        if (page_cache == NULL) {
+            // We couldn't allocate enough so give back what we got.
+            for (; i > 0; i--) {
+                m_free(MP_STATE_VM(flash_ram_cache)[i - 1]);
             }
-            j = pages_per_block;
+            m_free(MP_STATE_VM(flash_ram_cache));
+            MP_STATE_VM(flash_ram_cache) = NULL;
+            return false;
         }
-        m_free(MP_STATE_VM(flash_ram_cache));
-        MP_STATE_VM(flash_ram_cache) = NULL;
+        MP_STATE_VM(flash_ram_cache)[i] = page_cache;
     }
-    return success;
+    cache_way_count = 1;
+    return true;
 }
 
 static void release_ram_cache(void) {
     if (supervisor_cache != NULL) {
         free_memory(supervisor_cache);
         supervisor_cache = NULL;
-    } else if (MP_STATE_MEM(gc_pool_start)) {
+    } else if (MP_STATE_MEM(gc_pool_start) && MP_STATE_VM(flash_ram_cache) != NULL) {
+        for (uint8_t i = 0; i < PAGES_PER_SECTOR; i++) {
+            m_free(MP_STATE_VM(flash_ram_cache)[i]);
+        }
         m_free(MP_STATE_VM(flash_ram_cache));
     }
     MP_STATE_VM(flash_ram_cache) = NULL;
+    cache_way_count = 0;
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
+// Flush one way of the ram cache onto the flash.
+static bool flush_ram_way(uint8_t way) {
+    uint32_t current_sector = cache_ways[way].sector;
+    uint32_t dirty_mask = cache_ways[way].dirty_mask;
     if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
-        }
         return true;
     }
     // First, copy out any blocks that we haven't touched from the sector
     // we've cached. If we don't do this we'll erase the data during the sector
     // erase below.
-    bool copy_to_ram_ok = true;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
         if ((dirty_mask & (1 << i)) == 0) {
-            for (uint8_t j = 0; j < pages_per_block; j++) {
-                copy_to_ram_ok = read_flash(
-                    current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                    MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j],
-                    SPI_FLASH_PAGE_SIZE);
-                if (!copy_to_ram_ok) {
-                    break;
+            for (uint8_t j = 0; j < PAGES_PER_BLOCK; j++) {
+                if (!read_flash(current_sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                    ram_cache_page(way, i, j), SPI_FLASH_PAGE_SIZE)) {
+                    return false;
                 }
             }
         }
-        if (!copy_to_ram_ok) {
-            break;
-        }
     }
 
-    if (!copy_to_ram_ok) {
-        return false;
-    }
     // Second, erase the current sector.
     erase_sector(current_sector);
     // Lastly, write all the data in ram that we've cached.
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        for (uint8_t j = 0; j < pages_per_block; j++) {
-            write_flash(current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j],
-                SPI_FLASH_PAGE_SIZE);
-            if (!keep_cache && supervisor_cache == NULL && MP_STATE_MEM(gc_pool_start)) {
-                m_free(MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j]);
-            }
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        for (uint8_t j = 0; j < PAGES_PER_BLOCK; j++) {
+            write_flash(current_sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                ram_cache_page(way, i, j), SPI_FLASH_PAGE_SIZE);
         }
     }
-    // We're done with the cache for now so give it back.
-    if (!keep_cache) {
-        release_ram_cache();
-    }
     return true;
 }
 
-// Delegates to the correct flash flush method depending on the existing cache.
-// TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
-static void spi_flash_flush_keep_cache(bool keep_cache) {
+// Flush one way from wherever it is cached.
+static void flush_way(uint8_t way) {
+    if (cache_ways[way].sector == NO_SECTOR_LOADED) {
+        return;
+    }
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
     #endif
-    // If we've cached to the flash itself flush from there.
     if (MP_STATE_VM(flash_ram_cache) == NULL) {
         flush_scratch_flash();
     } else {
-        flush_ram_cache(keep_cache);
+        flush_ram_way(way);
     }
-    current_sector = NO_SECTOR_LOADED;
+    cache_ways[way].sector = NO_SECTOR_LOADED;
+    cache_ways[way].dirty_mask = 0;
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
     #endif
 }
 
+// Writes back every cached sector. We'll free the cache unless keep_cache is
+// true. This is the deferred flush, run when the filesystem has been idle.
+static void spi_flash_flush_keep_cache(bool keep_cache) {
+    for (uint8_t i = 0; i < cache_way_count; i++) {
+        flush_way(i);
+    }
+    // We're done with the cache for now so give it back.
+    if (!keep_cache) {
+        if (MP_STATE_VM(flash_ram_cache) != NULL) {
+            release_ram_cache();
+        }
+        cache_way_count = 0;
+    }
+}
+
+// Finds or frees a way for the given sector, evicting the least recently used
+// way if they are all in use.
+static int claim_cache_way(uint32_t sector) {
+    if (MP_STATE_VM(flash_ram_cache) == NULL) {
+        // Caching to the scratch sector; make room for the new sector.
+        if (cache_way_count > 0) {
+            flush_way(0);
+        }
+        if (!allocate_ram_cache()) {
+            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+            wait_for_flash_ready();
+            cache_way_count = 1;
+        }
+    }
+    uint8_t victim = 0;
+    for (uint8_t i = 0; i < cache_way_count; i++) {
+        if (cache_ways[i].sector == NO_SECTOR_LOADED) {
+            victim = i;
+            break;
+        }
+        if (cache_ways[i].last_used < cache_ways[victim].last_used) {
+            victim = i;
+        }
+    }
+    flush_way(victim);
+    cache_ways[victim].sector = sector;
+    cache_ways[victim].dirty_mask = 0;
+    return victim;
+}
+
 void supervisor_external_flash_flush(void) {
+    #if CIRCUITPY_FLASH_FTL
+    if (use_ftl) {
+        // Nothing is cached, so use the idle time to get free sectors ready.
+        flash_ftl_collect();
+        return;
+    }
+    #endif
     spi_flash_flush_keep_cache(true);
 }
 
 void supervisor_flash_release_cache(void) {
+    #if CIRCUITPY_FLASH_FTL
+    if (use_ftl) {
+        return;
+    }
+    #endif
     spi_flash_flush_keep_cache(false);
 }
 
@@ -519,14 +633,14 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
+    uint32_t mask = 1 << (block_index);
+    int way = find_cache_way(this_sector);
+    // We're reading a block that lives in the cache.
+    if (way >= 0 && (mask & cache_ways[way].dirty_mask) > 0) {
         if (MP_STATE_VM(flash_ram_cache) != NULL) {
-            uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-            for (int i = 0; i < pages_per_block; i++) {
+            for (int i = 0; i < PAGES_PER_BLOCK; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                    MP_STATE_VM(flash_ram_cache)[block_index * pages_per_block + i],
+                    ram_cache_page(way, block_index, i),
                     SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -550,31 +664,29 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
+    uint32_t mask = 1 << (block_index);
+    int way = find_cache_way(this_sector);
+    bool ram_cache = MP_STATE_VM(flash_ram_cache) != NULL;
+    // A block written again while it is in ram is simply replaced. One in the
+    // scratch sector can't be rewritten without an erase, so flush it first.
+    if (way >= 0 && !ram_cache && (mask & cache_ways[way].dirty_mask) > 0) {
+        flush_way(way);
+        way = -1;
+    }
+    if (way < 0) {
         // Check to see if we'd write to an erased page. In that case we
         // can write directly.
         if (page_erased(address)) {
             return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
         }
-        if (current_sector != NO_SECTOR_LOADED) {
-            supervisor_flash_flush();
-        }
-        if (MP_STATE_VM(flash_ram_cache) == NULL && !allocate_ram_cache()) {
-            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
-            wait_for_flash_ready();
-        }
-        current_sector = this_sector;
-        dirty_mask = 0;
+        way = claim_cache_way(this_sector);
     }
-    dirty_mask |= mask;
+    cache_ways[way].dirty_mask |= mask;
+    cache_ways[way].last_used = ++cache_use_count;
     // Copy the block to the appropriate cache.
     if (MP_STATE_VM(flash_ram_cache) != NULL) {
-        uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-        for (int i = 0; i < pages_per_block; i++) {
-            memcpy(MP_STATE_VM(flash_ram_cache)[block_index * pages_per_block + i],
+        for (int i = 0; i < PAGES_PER_BLOCK; i++) {
+            memcpy(ram_cache_page(way, block_index, i),
                 data + i * SPI_FLASH_PAGE_SIZE,
                 SPI_FLASH_PAGE_SIZE);
         }
@@ -585,9 +697,49 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
 }
 
+// Returns true if the newest copy of the block is in the ram cache or scratch
+// sector rather than at its home address.
+static bool external_flash_block_is_cached(uint32_t block) {
+    uint32_t address = block * FILESYSTEM_BLOCK_SIZE;
+    int way = find_cache_way(address & (~(SPI_FLASH_ERASE_SIZE - 1)));
+    if (way < 0) {
+        return false;
+    }
+    return (cache_ways[way].dirty_mask & (1 << (block % BLOCKS_PER_SECTOR))) != 0;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+    #if CIRCUITPY_FLASH_FTL
+    if (use_ftl) {
+        return flash_ftl_read_blocks(dest, block_num, num_blocks) ? 0 : 1;
+    }
+    #endif
+    uint32_t block_count = supervisor_flash_get_block_count();
+    if (block_num >= block_count || num_blocks > block_count - block_num) {
+        return 1; // error
+    }
+    // Blocks that only live in flash are gathered into runs so that a
+    // contiguous range is a single long read instead of one read per block.
+    uint32_t run_start = 0;
+    uint32_t run_length = 0;
+    for (uint32_t i = 0; i <= num_blocks; i++) {
+        bool cached = i < num_blocks && external_flash_block_is_cached(block_num + i);
+        if (i < num_blocks && !cached) {
+            if (run_length == 0) {
+                run_start = i;
+            }
+            run_length++;
+            continue;
+        }
+        if (run_length > 0) {
+            if (!read_flash((block_num + run_start) * FILESYSTEM_BLOCK_SIZE,
+                dest + run_start * FILESYSTEM_BLOCK_SIZE,
+                run_length * FILESYSTEM_BLOCK_SIZE)) {
+                return 1; // error
+            }
+            run_length = 0;
+        }
+        if (cached && !external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
             return 1; // error
         }
     }
@@ -595,6 +747,11 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32
 }
 
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    #if CIRCUITPY_FLASH_FTL
+    if (use_ftl) {
+        return flash_ftl_write_blocks(src, block_num, num_blocks) ? 0 : 1;
+    }
+    #endif
     for (size_t i = 0; i < num_blocks; i++) {
         if (!external_flash_write_block(src + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
             return 1; // error
@@ -45,6 +45,13 @@
 #define SPI_FLASH_MAX_BAUDRATE 8000000
 #endif
 
+// The number of erase sectors cached in ram before writing them back. Each
+// takes SPI_FLASH_ERASE_SIZE bytes outside the heap while the filesystem is
+// being written. Fewer are used when that much isn't free.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (4)
+#endif
+
 void supervisor_external_flash_flush(void);
 
 // Configure anything that needs to get set up before the external flash
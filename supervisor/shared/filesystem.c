@@ -34,6 +34,7 @@
 
 #include "supervisor/flash.h"
 #include "supervisor/linker.h"
+#include "supervisor/usb.h"
 
 static mp_vfs_mount_t _mp_vfs;
 static fs_user_mount_t _internal_vfs;
@@ -169,6 +170,9 @@ bool filesystem_init(bool create_allowed, bool force_create) {
 void PLACE_IN_ITCM(filesystem_flush)(void) {
     // Reset interval before next flush.
     filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    #if CIRCUITPY_USB_MSC
+    usb_msc_flush();
+    #endif
     supervisor_flash_flush();
     // Don't keep caches because this is called when starting or stopping the VM.
     supervisor_flash_release_cache();
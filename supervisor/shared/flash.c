@@ -26,10 +26,12 @@
 #include "supervisor/flash.h"
 
 #include "extmod/vfs_fat.h"
+#include "py/mphal.h"
 #include "py/runtime.h"
 #include "lib/oofatfs/ff.h"
 #include "supervisor/flash.h"
 #include "supervisor/shared/tick.h"
+#include "supervisor/usb.h"
 
 #define VFS_INDEX 0
 
@@ -110,7 +112,18 @@ static mp_uint_t flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t n
             return 0; // Done and ok.
         }
     }
+    #if CIRCUITPY_USB_MSC
+    // the VFS must see blocks the host wrote that are still queued
+    usb_msc_flush();
+    #endif
+    #if MICROPY_FATFS_IO_STATS
+    mp_uint_t start_us = mp_hal_ticks_us();
+    mp_uint_t result = supervisor_flash_read_blocks(dest, block_num - PART1_START_BLOCK, num_blocks);
+    mp_io_stats_record(MP_IO_STATS_FLASH_READ, num_blocks, start_us);
+    return result;
+    #else
     return supervisor_flash_read_blocks(dest, block_num - PART1_START_BLOCK, num_blocks);
+    #endif
 }
 
 static volatile bool filesystem_dirty = false;
@@ -128,11 +141,23 @@ static mp_uint_t flash_write_blocks(const uint8_t *src, uint32_t block_num, uint
             supervisor_enable_tick();
             filesystem_dirty = true;
         }
+        #if MICROPY_FATFS_IO_STATS
+        mp_uint_t start_us = mp_hal_ticks_us();
+        mp_uint_t result = supervisor_flash_write_blocks(src, block_num - PART1_START_BLOCK, num_blocks);
+        mp_io_stats_record(MP_IO_STATS_FLASH_WRITE, num_blocks, start_us);
+        return result;
+        #else
         return supervisor_flash_write_blocks(src, block_num - PART1_START_BLOCK, num_blocks);
+        #endif
     }
 }
 
 void PLACE_IN_ITCM(supervisor_flash_flush)(void) {
+    #if MICROPY_FATFS_IO_STATS
+    // Flushes are frequent and mostly have nothing to do, so only time the
+    // ones that follow a write.
+    mp_uint_t start_us = mp_hal_ticks_us();
+    #endif
     #if INTERNAL_FLASH_FILESYSTEM
     port_internal_flash_flush();
     #else
@@ -141,10 +166,25 @@ void PLACE_IN_ITCM(supervisor_flash_flush)(void) {
     // Turn off ticks now that our filesystem has been flushed.
     if (filesystem_dirty) {
         supervisor_disable_tick();
+        #if MICROPY_FATFS_IO_STATS
+        mp_io_stats_record(MP_IO_STATS_FLASH_FLUSH, 0, start_us);
+        #endif
     }
     filesystem_dirty = false;
 }
 
+MP_WEAK const void *supervisor_flash_get_block_address(uint32_t block_num) {
+    return NULL;
+}
+
+const void *supervisor_flash_map_block(uint32_t block_num) {
+    if (block_num < PART1_START_BLOCK) {
+        return NULL;
+    }
+    supervisor_flash_flush();
+    return supervisor_flash_get_block_address(block_num - PART1_START_BLOCK);
+}
+
 STATIC mp_obj_t supervisor_flash_obj_readblocks(mp_obj_t self, mp_obj_t block_num, mp_obj_t buf) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_WRITE);
@@ -0,0 +1,443 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/flash_ftl.h"
+
+#include <string.h>
+
+#include "py/mpconfig.h"
+#include "py/misc.h"
+#include "supervisor/memory.h"
+
+// A sector in use starts with the magic number, then the order in which the
+// sector was started and that inverted. Each slot then has an 8 byte entry
+// holding the block it contains and that block number inverted. The inverted
+// copies mean that anything torn by a power loss is ignored rather than
+// misread.
+#define FTL_MAGIC (0x314c5446)
+#define FTL_HEADER_SIZE (16)
+#define FTL_ENTRY_SIZE (8)
+#define FTL_ENTRY_WORD(slot) ((FTL_HEADER_SIZE + (slot) * FTL_ENTRY_SIZE) / sizeof(uint32_t))
+
+#define FTL_UNMAPPED (0xffff)
+#define FTL_NO_SECTOR (0xffffffff)
+
+// sector_state holds the number of live blocks in a sector that is in use, or
+// one of these for free sectors.
+#define FTL_SECTOR_ERASED (0xff)
+#define FTL_SECTOR_DIRTY (0xfe)
+// Looked blank when mounted. An erase cut short by a reset can leave a blank
+// header in front of stale data, so these are checked before use.
+#define FTL_SECTOR_UNKNOWN (0xfd)
+
+static const flash_ftl_device_t *ftl_device = NULL;
+static supervisor_allocation *ftl_allocation = NULL;
+
+// Maps each filesystem block to sector * slots_per_sector + slot.
+static uint16_t *block_map;
+static uint8_t *sector_state;
+
+static uint32_t sector_count;
+static uint32_t slots_per_sector;
+static uint32_t spare_sectors;
+static uint32_t block_count;
+static uint32_t free_sectors;
+
+static uint32_t head_sector;
+static uint32_t head_slot;
+static uint32_t next_sequence;
+static uint32_t next_free_search;
+
+static uint32_t sector_address(uint32_t sector) {
+    return ftl_device->start + sector * ftl_device->sector_size;
+}
+
+static uint32_t slot_address(uint32_t sector, uint32_t slot) {
+    return sector_address(sector) + (slot + 1) * FILESYSTEM_BLOCK_SIZE;
+}
+
+static bool read_header(uint32_t sector, uint32_t *header) {
+    return ftl_device->read(sector_address(sector), (uint8_t *)header,
+        FTL_HEADER_SIZE + slots_per_sector * FTL_ENTRY_SIZE);
+}
+
+static bool header_valid(const uint32_t *header) {
+    return header[0] == FTL_MAGIC && header[2] == ~header[1];
+}
+
+static bool entry_valid(const uint32_t *header, uint32_t slot) {
+    uint32_t block = header[FTL_ENTRY_WORD(slot)];
+    return block < block_count && header[FTL_ENTRY_WORD(slot) + 1] == ~block;
+}
+
+static bool entry_blank(const uint32_t *header, uint32_t slot) {
+    return (header[FTL_ENTRY_WORD(slot)] & header[FTL_ENTRY_WORD(slot) + 1]) == 0xffffffff;
+}
+
+static uint32_t entry_block(const uint32_t *header, uint32_t slot) {
+    return header[FTL_ENTRY_WORD(slot)];
+}
+
+static bool range_blank(uint32_t address, uint32_t length) {
+    uint32_t data[FILESYSTEM_BLOCK_SIZE / sizeof(uint32_t)];
+    for (uint32_t offset = 0; offset < length; offset += sizeof(data)) {
+        if (!ftl_device->read(address + offset, (uint8_t *)data, sizeof(data))) {
+            return false;
+        }
+        for (size_t i = 0; i < MP_ARRAY_SIZE(data); i++) {
+            if (data[i] != 0xffffffff) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Returns true if slot of a sector started at sequence was written after the
+// copy of the block at location.
+static bool is_newer(uint32_t sector, uint32_t slot, uint32_t sequence, uint16_t location) {
+    uint32_t other_sector = location / slots_per_sector;
+    if (other_sector == sector) {
+        return slot > location % slots_per_sector;
+    }
+    uint32_t other_header[FTL_HEADER_SIZE / sizeof(uint32_t)];
+    if (!ftl_device->read(sector_address(other_sector), (uint8_t *)other_header, sizeof(other_header))) {
+        return false;
+    }
+    return (int32_t)(sequence - other_header[1]) > 0;
+}
+
+static void set_location(uint32_t block, uint32_t sector, uint32_t slot) {
+    uint16_t old = block_map[block];
+    if (old != FTL_UNMAPPED) {
+        sector_state[old / slots_per_sector]--;
+    }
+    block_map[block] = sector * slots_per_sector + slot;
+    sector_state[sector]++;
+}
+
+bool flash_ftl_mount(const flash_ftl_device_t *device) {
+    ftl_device = NULL;
+    uint32_t blocks_per_sector = device->sector_size / FILESYSTEM_BLOCK_SIZE;
+    // The header has to fit in the first block of the sector.
+    if (blocks_per_sector < 2 || FTL_HEADER_SIZE + blocks_per_sector * FTL_ENTRY_SIZE > FILESYSTEM_BLOCK_SIZE) {
+        return false;
+    }
+    slots_per_sector = blocks_per_sector - 1;
+    sector_count = device->sector_count;
+    // Locations must fit in the map, so very large devices only use part.
+    if (sector_count * slots_per_sector >= FTL_UNMAPPED) {
+        sector_count = (FTL_UNMAPPED - 1) / slots_per_sector;
+    }
+    spare_sectors = sector_count / CIRCUITPY_FLASH_FTL_SPARE_RATIO + 2;
+    if (sector_count <= spare_sectors) {
+        return false;
+    }
+    block_count = (sector_count - spare_sectors) * slots_per_sector;
+
+    uint32_t map_size = align32_size(block_count * sizeof(uint16_t));
+    uint32_t length = align32_size(map_size + sector_count);
+    if (ftl_allocation == NULL) {
+        ftl_allocation = allocate_memory(length, false, false);
+        if (ftl_allocation == NULL) {
+            return false;
+        }
+    }
+    block_map = (uint16_t *)ftl_allocation->ptr;
+    sector_state = (uint8_t *)ftl_allocation->ptr + map_size;
+    memset(block_map, 0xff, block_count * sizeof(uint16_t));
+    ftl_device = device;
+
+    uint32_t header[FILESYSTEM_BLOCK_SIZE / sizeof(uint32_t)];
+    uint32_t last_sequence = 0;
+    uint32_t last_sector = FTL_NO_SECTOR;
+    free_sectors = 0;
+    for (uint32_t sector = 0; sector < sector_count; sector++) {
+        if (!read_header(sector, header)) {
+            ftl_device = NULL;
+            return false;
+        }
+        if (!header_valid(header)) {
+            // Unused, or left over from another layout.
+            sector_state[sector] = header[0] == 0xffffffff ? FTL_SECTOR_UNKNOWN : FTL_SECTOR_DIRTY;
+            free_sectors++;
+            continue;
+        }
+        sector_state[sector] = 0;
+        uint32_t sequence = header[1];
+        if (last_sector == FTL_NO_SECTOR || (int32_t)(sequence - last_sequence) > 0) {
+            last_sequence = sequence;
+            last_sector = sector;
+        }
+        for (uint32_t slot = 0; slot < slots_per_sector; slot++) {
+            if (!entry_valid(header, slot)) {
+                continue;
+            }
+            uint32_t block = entry_block(header, slot);
+            if (block_map[block] == FTL_UNMAPPED || is_newer(sector, slot, sequence, block_map[block])) {
+                set_location(block, sector, slot);
+            }
+        }
+    }
+    next_sequence = last_sequence + 1;
+    head_sector = FTL_NO_SECTOR;
+    head_slot = 0;
+    next_free_search = 0;
+
+    // Carry on filling the newest sector. A reset may have cut short a
+    // collection that had already used the last free sector, and then its
+    // remaining slots are the only room left. Slots after the last one used
+    // must still be blank, and one torn write is skipped over.
+    if (last_sector != FTL_NO_SECTOR && read_header(last_sector, header)) {
+        uint32_t slot = slots_per_sector;
+        while (slot > 0 && entry_blank(header, slot - 1) &&
+               range_blank(slot_address(last_sector, slot - 1), FILESYSTEM_BLOCK_SIZE)) {
+            slot--;
+        }
+        if (slot < slots_per_sector) {
+            head_sector = last_sector;
+            head_slot = slot;
+            next_free_search = (last_sector + 1) % sector_count;
+        }
+    }
+    return true;
+}
+
+uint32_t flash_ftl_get_block_count(void) {
+    if (ftl_device == NULL) {
+        return 0;
+    }
+    return block_count;
+}
+
+// Gets a free sector ready to be written, erasing it if it isn't blank.
+static bool prepare_sector(uint32_t sector) {
+    if (sector_state[sector] == FTL_SECTOR_UNKNOWN) {
+        bool blank = range_blank(sector_address(sector), ftl_device->sector_size);
+        sector_state[sector] = blank ? FTL_SECTOR_ERASED : FTL_SECTOR_DIRTY;
+    }
+    if (sector_state[sector] == FTL_SECTOR_DIRTY) {
+        if (!ftl_device->erase(sector_address(sector))) {
+            return false;
+        }
+        sector_state[sector] = FTL_SECTOR_ERASED;
+    }
+    return true;
+}
+
+// Starts a new head sector, preferring one that is already erased. Free
+// sectors are taken in turn so that erases are spread over the whole device.
+static bool open_head_sector(void) {
+    uint32_t sector = FTL_NO_SECTOR;
+    for (uint32_t i = 0; i < sector_count; i++) {
+        uint32_t candidate = (next_free_search + i) % sector_count;
+        if (sector_state[candidate] == FTL_SECTOR_ERASED) {
+            sector = candidate;
+            break;
+        }
+        if (sector_state[candidate] >= FTL_SECTOR_UNKNOWN && sector == FTL_NO_SECTOR) {
+            sector = candidate;
+        }
+    }
+    if (sector == FTL_NO_SECTOR) {
+        return false;
+    }
+    if (!prepare_sector(sector)) {
+        return false;
+    }
+    uint32_t sequence = next_sequence++;
+    uint32_t header[FTL_HEADER_SIZE / sizeof(uint32_t)] = {FTL_MAGIC, sequence, ~sequence, 0xffffffff};
+    // The sector is consumed even if programming fails.
+    sector_state[sector] = 0;
+    free_sectors--;
+    head_sector = sector;
+    head_slot = 0;
+    next_free_search = (sector + 1) % sector_count;
+    return ftl_device->program(sector_address(sector), (uint8_t *)header, sizeof(header));
+}
+
+static bool append_block(const uint8_t *data, uint32_t block) {
+    if (head_sector == FTL_NO_SECTOR || head_slot == slots_per_sector) {
+        if (!open_head_sector()) {
+            return false;
+        }
+    }
+    uint32_t slot = head_slot++;
+    // The entry is only written once the data is in place.
+    if (!ftl_device->program(slot_address(head_sector, slot), data, FILESYSTEM_BLOCK_SIZE)) {
+        return false;
+    }
+    uint32_t entry[2] = {block, ~block};
+    if (!ftl_device->program(sector_address(head_sector) + FTL_HEADER_SIZE + slot * FTL_ENTRY_SIZE,
+        (uint8_t *)entry, sizeof(entry))) {
+        return false;
+    }
+    set_location(block, head_sector, slot);
+    return true;
+}
+
+static uint32_t head_slots_left(void) {
+    if (head_sector == FTL_NO_SECTOR) {
+        return 0;
+    }
+    return slots_per_sector - head_slot;
+}
+
+// Returns the in use sector with the fewest live blocks.
+static uint32_t find_victim(void) {
+    uint32_t victim = FTL_NO_SECTOR;
+    for (uint32_t sector = 0; sector < sector_count; sector++) {
+        if (sector == head_sector || sector_state[sector] >= FTL_SECTOR_UNKNOWN) {
+            continue;
+        }
+        if (victim == FTL_NO_SECTOR || sector_state[sector] < sector_state[victim]) {
+            victim = sector;
+        }
+    }
+    return victim;
+}
+
+// Moves the live blocks out of the sector and erases it.
+static bool collect_sector(uint32_t sector) {
+    uint32_t live = sector_state[sector];
+    if (live > head_slots_left() + free_sectors * slots_per_sector) {
+        return false;
+    }
+    if (live > 0) {
+        uint32_t header[FILESYSTEM_BLOCK_SIZE / sizeof(uint32_t)];
+        uint8_t data[FILESYSTEM_BLOCK_SIZE];
+        if (!read_header(sector, header)) {
+            return false;
+        }
+        for (uint32_t slot = 0; slot < slots_per_sector; slot++) {
+            if (!entry_valid(header, slot)) {
+                continue;
+            }
+            uint32_t block = entry_block(header, slot);
+            if (block_map[block] != sector * slots_per_sector + slot) {
+                continue;
+            }
+            if (!ftl_device->read(slot_address(sector, slot), data, FILESYSTEM_BLOCK_SIZE) ||
+                !append_block(data, block)) {
+                return false;
+            }
+        }
+    }
+    sector_state[sector] = FTL_SECTOR_DIRTY;
+    free_sectors++;
+    if (!ftl_device->erase(sector_address(sector))) {
+        return false;
+    }
+    sector_state[sector] = FTL_SECTOR_ERASED;
+    return true;
+}
+
+// Makes sure a block can be appended without using the last free sector,
+// which is kept for collection.
+static bool make_room(void) {
+    while (free_sectors == 0 || (head_slots_left() == 0 && free_sectors == 1)) {
+        uint32_t victim = find_victim();
+        if (victim == FTL_NO_SECTOR || sector_state[victim] == slots_per_sector ||
+            !collect_sector(victim)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool flash_ftl_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    if (ftl_device == NULL || block_num >= block_count || num_blocks > block_count - block_num) {
+        return false;
+    }
+    // Blocks written one after another usually sit next to each other, so
+    // read runs of them at once.
+    uint32_t run_address = 0;
+    uint8_t *run_dest = dest;
+    uint32_t run_length = 0;
+    for (uint32_t i = 0; i <= num_blocks; i++) {
+        uint32_t address = 0;
+        if (i < num_blocks) {
+            uint16_t location = block_map[block_num + i];
+            if (location != FTL_UNMAPPED) {
+                address = slot_address(location / slots_per_sector, location % slots_per_sector);
+                if (run_length > 0 && address == run_address + run_length * FILESYSTEM_BLOCK_SIZE) {
+                    run_length++;
+                    continue;
+                }
+            }
+        }
+        if (run_length > 0 && !ftl_device->read(run_address, run_dest, run_length * FILESYSTEM_BLOCK_SIZE)) {
+            return false;
+        }
+        run_length = 0;
+        if (i == num_blocks) {
+            break;
+        }
+        if (address == 0) {
+            // Never written, so it reads as erased flash.
+            memset(dest + i * FILESYSTEM_BLOCK_SIZE, 0xff, FILESYSTEM_BLOCK_SIZE);
+        } else {
+            run_address = address;
+            run_dest = dest + i * FILESYSTEM_BLOCK_SIZE;
+            run_length = 1;
+        }
+    }
+    return true;
+}
+
+bool flash_ftl_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    if (ftl_device == NULL || block_num >= block_count || num_blocks > block_count - block_num) {
+        return false;
+    }
+    for (uint32_t i = 0; i < num_blocks; i++) {
+        if (!make_room() || !append_block(src + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void flash_ftl_collect(void) {
+    if (ftl_device == NULL) {
+        return;
+    }
+    // Erasing is the slowest part of taking a new sector, so do it now.
+    for (uint32_t sector = 0; sector < sector_count; sector++) {
+        if (sector_state[sector] == FTL_SECTOR_DIRTY || sector_state[sector] == FTL_SECTOR_UNKNOWN) {
+            prepare_sector(sector);
+            return;
+        }
+    }
+    // Reclaim a mostly stale sector while free space is short of the spares.
+    // Sectors that are mostly live are left for when they're really needed.
+    if (free_sectors >= spare_sectors) {
+        return;
+    }
+    uint32_t victim = find_victim();
+    if (victim != FTL_NO_SECTOR && sector_state[victim] <= slots_per_sector / 2) {
+        collect_sector(victim);
+    }
+}
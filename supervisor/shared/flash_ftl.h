@@ -0,0 +1,78 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A log-structured translation layer between filesystem blocks and raw flash.
+// Blocks are never rewritten in place. Each write is appended to the sector
+// currently being filled, and a small header at the start of every sector
+// records which block each of its slots holds. Stale copies are reclaimed by
+// moving the live blocks out of the emptiest sector and erasing it, which is
+// done ahead of time from flash_ftl_collect() when the filesystem is idle.
+//
+// A sector of N filesystem blocks holds N - 1 of them; the first block's
+// worth of space is its header. A few sectors are kept spare so that there
+// is always somewhere to collect into. The layout isn't compatible with a
+// directly mapped filesystem, so the drive is reformatted when this is
+// first enabled.
+
+// One sector in this many is kept spare, on top of two for collection. Spare
+// sectors cost capacity but mean fewer live blocks have to be moved to
+// reclaim space, and so fewer erases per write.
+#ifndef CIRCUITPY_FLASH_FTL_SPARE_RATIO
+#define CIRCUITPY_FLASH_FTL_SPARE_RATIO (8)
+#endif
+
+typedef struct {
+    // Reads length bytes at address.
+    bool (*read)(uint32_t address, uint8_t *data, uint32_t length);
+    // Programs length bytes at address, which is in an erased sector. Ranges
+    // may be as small as 8 bytes and may cross pages.
+    bool (*program)(uint32_t address, const uint8_t *data, uint32_t length);
+    // Erases the sector starting at address.
+    bool (*erase)(uint32_t address);
+    // The byte address of the first sector managed by the layer.
+    uint32_t start;
+    uint32_t sector_size;
+    uint32_t sector_count;
+} flash_ftl_device_t;
+
+// Scans the sector headers and rebuilds the block map. Returns false if the
+// device doesn't suit the layer or the map couldn't be allocated.
+bool flash_ftl_mount(const flash_ftl_device_t *device);
+uint32_t flash_ftl_get_block_count(void);
+
+// These return true on success.
+bool flash_ftl_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks);
+bool flash_ftl_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks);
+
+// Erases or reclaims at most one sector when free space is running low.
+// Call it when the filesystem is idle so that writes rarely have to wait on
+// an erase.
+void flash_ftl_collect(void);
@@ -42,6 +42,10 @@ enum {
         + 1
         #endif
 
+        #if CIRCUITPY_FLASH_FTL
+        + 1 // flash translation layer block map
+        #endif
+
         #if CIRCUITPY_USB
         + 1 // device_descriptor_allocation
         + 1 // configuration_descriptor_allocation
@@ -69,11 +73,17 @@ enum {
         + 1
         // prev_traceback_allocation
         + 1
+        #if CIRCUITPY_WEB_WORKFLOW
+        // web workflow transfer buffer
+        + 1
+        #endif
         #if CIRCUITPY_DISPLAYIO
         #if CIRCUITPY_TERMINALIO
         + 1
         #endif
         + CIRCUITPY_DISPLAY_LIMIT * (
+            // Optional refresh buffer
+            1 +
             // Maximum needs of one display: max(4 if RGBMATRIX, 1 if SHARPDISPLAY, 0)
             #if CIRCUITPY_RGBMATRIX
             4
@@ -166,13 +176,45 @@ supervisor_allocation *allocate_remaining_memory(void) {
     return allocate_memory((uint32_t)-1, false, false);
 }
 
-static supervisor_allocation_node *find_hole(supervisor_allocation_node *node, size_t length) {
-    for (; node != NULL; node = node->next) {
-        if (node->length == (length | HOLE)) {
-            break;
+// Neighbouring nodes in a list are also neighbours in memory. The low list runs down from
+// low_head and the high list runs up from high_head. Take the first hole that fits, merging it
+// with any holes after it first, and leave what is left over as a smaller hole.
+static supervisor_allocation_node *find_hole(supervisor_allocation_node **nodep, size_t length, bool high) {
+    for (; *nodep != NULL; nodep = &((*nodep)->next)) {
+        supervisor_allocation_node *node = *nodep;
+        if (!(node->length & HOLE)) {
+            continue;
+        }
+        while (node->next != NULL && (node->next->length & HOLE)) {
+            supervisor_allocation_node *next = node->next;
+            size_t merged = (node->length & ~FLAGS) + sizeof(supervisor_allocation_node) + (next->length & ~FLAGS);
+            if (high) {
+                node->next = next->next;
+            } else {
+                // The next hole is below this one, so the merged hole starts there.
+                *nodep = next;
+                node = next;
+            }
+            node->length = merged | HOLE;
+        }
+        size_t hole_length = node->length & ~FLAGS;
+        if (hole_length == length) {
+            return node;
+        }
+        if (hole_length >= length + sizeof(supervisor_allocation_node) + 4) {
+            supervisor_allocation_node *rest = (supervisor_allocation_node *)(void *)((char *)node->data + length);
+            rest->length = (hole_length - length - sizeof(supervisor_allocation_node)) | HOLE;
+            if (high) {
+                rest->next = node->next;
+                node->next = rest;
+            } else {
+                rest->next = node;
+                *nodep = rest;
+            }
+            return node;
         }
     }
-    return node;
+    return NULL;
 }
 
 static supervisor_allocation_node *allocate_memory_node(uint32_t length, bool high, bool movable) {
@@ -192,7 +234,7 @@ static supervisor_allocation_node *allocate_memory_node(uint32_t length, bool hi
         return NULL;
     }
     // 1. Matching hole on the requested side?
-    supervisor_allocation_node *node = find_hole(high ? high_head : low_head, length);
+    supervisor_allocation_node *node = find_hole(high ? &high_head : &low_head, length, high);
     if (!node) {
         // 2. Enough free space in the middle?
         if ((high_address - low_address) * 4 >= (int32_t)(sizeof(supervisor_allocation_node) + length)) {
@@ -208,7 +250,7 @@ static supervisor_allocation_node *allocate_memory_node(uint32_t length, bool hi
             }
         } else {
             // 3. Matching hole on the other side?
-            node = find_hole(high ? low_head : high_head, length);
+            node = find_hole(high ? &low_head : &high_head, length, !high);
             if (!node) {
                 // 4. GC allocation?
                 if (movable && gc_alloc_possible()) {
@@ -252,6 +294,32 @@ size_t get_allocation_length(supervisor_allocation *allocation) {
     return ALLOCATION_NODE(allocation)->length & ~FLAGS;
 }
 
+#if CIRCUITPY_SUPERVISOR_MEMORY_INFO
+static void add_holes(supervisor_allocation_node *node, size_t *free_bytes, size_t *largest_free) {
+    // Count runs of neighbouring holes as one block, as find_hole() would merge them.
+    size_t run = 0;
+    for (; node != NULL; node = node->next) {
+        if (node->length & HOLE) {
+            run += (run ? sizeof(supervisor_allocation_node) : 0) + (node->length & ~FLAGS);
+            *free_bytes += sizeof(supervisor_allocation_node) + (node->length & ~FLAGS);
+            *largest_free = MAX(*largest_free, run);
+        } else {
+            run = 0;
+        }
+    }
+}
+
+void supervisor_memory_info(size_t *free_bytes, size_t *largest_free) {
+    uint32_t *low_address = low_head ? low_head->data + low_head->length / 4 : port_heap_get_bottom();
+    uint32_t *high_address = high_head ? (uint32_t *)high_head : port_heap_get_top();
+    size_t middle = (high_address - low_address) * 4;
+    *free_bytes = middle;
+    *largest_free = middle > sizeof(supervisor_allocation_node) ? middle - sizeof(supervisor_allocation_node) : 0;
+    add_holes(low_head, free_bytes, largest_free);
+    add_holes(high_head, free_bytes, largest_free);
+}
+#endif
+
 
 void supervisor_move_memory(void) {
     // This whole function is not needed when there are no movable allocations, let it be optimized
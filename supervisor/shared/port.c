@@ -37,3 +37,10 @@ MP_WEAK void port_yield(void) {
 
 MP_WEAK void port_boot_info(void) {
 }
+
+MP_WEAK void port_background_callbacks_done(void) {
+}
+
+MP_WEAK uint32_t *port_fast_pystack(size_t length) {
+    return NULL;
+}
@@ -0,0 +1,180 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/bc.h"
+#include "py/mpstate.h"
+#include "py/objfun.h"
+#include "py/runtime.h"
+#include "supervisor/profile.h"
+#include "supervisor/shared/tick.h"
+
+typedef struct {
+    uint32_t count;
+    // Offset of the innermost function's ip from the start of its bytecode.
+    uint32_t leaf_offset;
+    uint8_t depth;
+    // The stack was deeper than CIRCUITPY_PROFILE_DEPTH.
+    bool truncated;
+    // Innermost first.
+    const mp_obj_fun_bc_t *functions[CIRCUITPY_PROFILE_DEPTH];
+} profile_stack_t;
+
+// The table is kept in MP_STATE_VM(profile_table) so that the functions it
+// refers to stay alive until they are printed.
+typedef struct {
+    size_t size;
+    // Samples taken while no Python code was running.
+    uint32_t idle;
+    // Samples of new stacks that did not fit in the table.
+    uint32_t dropped;
+    profile_stack_t stacks[];
+} profile_table_t;
+
+STATIC volatile bool profile_running;
+
+void supervisor_profile_sample(void) {
+    if (!profile_running) {
+        return;
+    }
+    profile_table_t *table = MP_STATE_VM(profile_table);
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        table->idle++;
+        return;
+    }
+
+    profile_stack_t sample;
+    sample.leaf_offset = code_state->ip - code_state->fun_bc->bytecode;
+    sample.depth = 0;
+    uintptr_t hash = sample.leaf_offset;
+    while (code_state != NULL && sample.depth < CIRCUITPY_PROFILE_DEPTH) {
+        sample.functions[sample.depth++] = code_state->fun_bc;
+        hash = hash * 31 + ((uintptr_t)code_state->fun_bc >> 2);
+        code_state = code_state->prev_state;
+    }
+    sample.truncated = code_state != NULL;
+
+    // Open addressing with linear probing. Entries are only ever added, so
+    // the first empty slot ends the search.
+    size_t index = hash % table->size;
+    for (size_t i = 0; i < table->size; i++) {
+        profile_stack_t *entry = &table->stacks[index];
+        if (entry->count == 0) {
+            sample.count = 1;
+            *entry = sample;
+            return;
+        }
+        if (entry->leaf_offset == sample.leaf_offset &&
+            entry->depth == sample.depth &&
+            entry->truncated == sample.truncated &&
+            memcmp(entry->functions, sample.functions, sample.depth * sizeof(sample.functions[0])) == 0) {
+            entry->count++;
+            return;
+        }
+        index = (index + 1) % table->size;
+    }
+    table->dropped++;
+}
+
+void supervisor_profile_start(size_t max_stacks) {
+    supervisor_profile_reset();
+    profile_table_t *table = m_malloc(sizeof(profile_table_t) + max_stacks * sizeof(profile_stack_t), false);
+    memset(table, 0, sizeof(profile_table_t) + max_stacks * sizeof(profile_stack_t));
+    table->size = max_stacks;
+    MP_STATE_VM(profile_table) = table;
+    profile_running = true;
+    supervisor_enable_tick();
+}
+
+// Print "name (file)" for a function, adding the line for the innermost one.
+STATIC void print_function(const mp_print_t *print, const mp_obj_fun_bc_t *fun, const uint32_t *leaf_offset) {
+    const byte *ip = fun->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *bytecode_start = ip + n_info + n_cell;
+    #if !MICROPY_PERSISTENT_CODE
+    // so bytecode is aligned
+    bytecode_start = MP_ALIGN(bytecode_start, sizeof(mp_uint_t));
+    #endif
+    #if MICROPY_PERSISTENT_CODE
+    qstr block_name = ip[0] | (ip[1] << 8);
+    qstr source_file = ip[2] | (ip[3] << 8);
+    ip += 4;
+    #else
+    qstr block_name = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip);
+    qstr source_file = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip);
+    #endif
+    mp_printf(print, "%q (%q", block_name, source_file);
+    if (leaf_offset != NULL) {
+        size_t bc = fun->bytecode + *leaf_offset - bytecode_start;
+        mp_printf(print, ":%u", (unsigned)mp_bytecode_get_source_line(ip, bc));
+    }
+    mp_print_str(print, ")");
+}
+
+void supervisor_profile_stop(const mp_print_t *print) {
+    bool was_running = profile_running;
+    profile_running = false;
+    if (was_running) {
+        supervisor_disable_tick();
+    }
+    profile_table_t *table = MP_STATE_VM(profile_table);
+    if (table == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < table->size; i++) {
+        const profile_stack_t *entry = &table->stacks[i];
+        if (entry->count == 0) {
+            continue;
+        }
+        if (entry->truncated) {
+            mp_print_str(print, "...;");
+        }
+        for (size_t j = entry->depth; j-- > 0;) {
+            print_function(print, entry->functions[j], j == 0 ? &entry->leaf_offset : NULL);
+            mp_print_str(print, j == 0 ? " " : ";");
+        }
+        mp_printf(print, "%u\n", (unsigned)entry->count);
+    }
+    if (table->idle > 0) {
+        mp_printf(print, "[idle] %u\n", (unsigned)table->idle);
+    }
+    if (table->dropped > 0) {
+        mp_printf(print, "[dropped] %u\n", (unsigned)table->dropped);
+    }
+}
+
+void supervisor_profile_reset(void) {
+    if (profile_running) {
+        profile_running = false;
+        supervisor_disable_tick();
+    }
+    MP_STATE_VM(profile_table) = NULL;
+}
@@ -30,6 +30,7 @@
 #include "py/mpconfig.h"
 #include "py/mphal.h"
 
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/cpu.h"
 #include "supervisor/shared/display.h"
 #include "shared-bindings/terminalio/Terminal.h"
@@ -46,6 +47,10 @@
 #include "tusb.h"
 #endif
 
+#if CIRCUITPY_USB_KEYBOARD_WORKFLOW
+#include "supervisor/shared/usb/host_keyboard.h"
+#endif
+
 #if CIRCUITPY_WEB_WORKFLOW
 #include "supervisor/shared/web_workflow/websocket.h"
 #endif
@@ -238,6 +243,12 @@ char serial_read(void) {
     }
     #endif
 
+    #if CIRCUITPY_USB_KEYBOARD_WORKFLOW
+    if (usb_keyboard_chars_available()) {
+        return usb_keyboard_read_char();
+    }
+    #endif
+
     if (port_serial_bytes_available() > 0) {
         return port_serial_read();
     }
@@ -279,6 +290,12 @@ bool serial_bytes_available(void) {
     }
     #endif
 
+    #if CIRCUITPY_USB_KEYBOARD_WORKFLOW
+    if (usb_keyboard_chars_available()) {
+        return true;
+    }
+    #endif
+
     #if CIRCUITPY_USB_CDC
     if (usb_cdc_console_enabled() && tud_cdc_available() > 0) {
         return true;
@@ -296,15 +313,82 @@ bool serial_bytes_available(void) {
     return false;
 }
 
+#if CIRCUITPY_TERMINALIO || CIRCUITPY_WEB_WORKFLOW
+// Output to the display terminal and the web workflow websocket is collected
+// and written in a background callback, so that a run of prints redraws the
+// terminal and sends a frame once instead of once per print.
+typedef struct {
+    void (*write)(const char *text, uint32_t length);
+    uint32_t length;
+    char buf[CIRCUITPY_SERIAL_OUTPUT_BUFFER];
+} serial_output_t;
+
+#if CIRCUITPY_TERMINALIO
+STATIC void _terminal_write(const char *text, uint32_t length) {
+    int errcode;
+    common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)text, length, &errcode);
+}
+
+STATIC serial_output_t _terminal_output = { .write = _terminal_write };
+#endif
+
+#if CIRCUITPY_WEB_WORKFLOW
+STATIC void _websocket_write(const char *text, uint32_t length) {
+    websocket_write(text, length);
+}
+
+STATIC serial_output_t _websocket_output = { .write = _websocket_write };
+#endif
+
+STATIC background_callback_t _output_callback;
+
+STATIC void _output_flush(serial_output_t *output) {
+    // Text may be added from an interrupt while this writes, so only remove
+    // what was written.
+    uint32_t length = output->length;
+    if (length == 0) {
+        return;
+    }
+    output->write(output->buf, length);
+    output->length -= length;
+    memmove(output->buf, output->buf + length, output->length);
+}
+
+STATIC void _output_flush_all(void *unused) {
+    #if CIRCUITPY_TERMINALIO
+    _output_flush(&_terminal_output);
+    #endif
+    #if CIRCUITPY_WEB_WORKFLOW
+    _output_flush(&_websocket_output);
+    #endif
+}
+
+STATIC void _output_write(serial_output_t *output, const char *text, uint32_t length) {
+    uint32_t space = sizeof(output->buf) - output->length;
+    if (length > space && !cpu_interrupt_active()) {
+        _output_flush(output);
+        space = sizeof(output->buf);
+    }
+    if (length > space) {
+        // Too long to collect. An interrupt can't flush, so its text may pass
+        // what's waiting.
+        output->write(text, length);
+        return;
+    }
+    memcpy(output->buf + output->length, text, length);
+    output->length += length;
+    background_callback_add(&_output_callback, _output_flush_all, NULL);
+}
+#endif
+
 void serial_write_substring(const char *text, uint32_t length) {
     if (length == 0) {
         return;
     }
 
     #if CIRCUITPY_TERMINALIO
-    int errcode;
     if (!_serial_display_write_disabled) {
-        common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)text, length, &errcode);
+        _output_write(&_terminal_output, text, length);
     }
     #endif
 
@@ -332,7 +416,9 @@ void serial_write_substring(const char *text, uint32_t length) {
     #endif
 
     #if CIRCUITPY_WEB_WORKFLOW
-    websocket_write(text, length);
+    if (websocket_connected()) {
+        _output_write(&_websocket_output, text, length);
+    }
     #endif
 
     #if CIRCUITPY_USB_CDC
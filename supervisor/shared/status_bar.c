@@ -37,6 +37,11 @@
 #include "shared-module/terminalio/Terminal.h"
 #endif
 
+#if CIRCUITPY_STATUS_BAR_GC_STATS && MICROPY_GC_STATS
+#include "py/mpprint.h"
+#include "py/mpstate.h"
+#endif
+
 #if CIRCUITPY_WEB_WORKFLOW
 #include "supervisor/shared/web_workflow/web_workflow.h"
 #endif
@@ -107,6 +112,11 @@ void supervisor_status_bar_update(void) {
 
     supervisor_execution_status();
     serial_write(" | ");
+
+    #if CIRCUITPY_STATUS_BAR_GC_STATS && MICROPY_GC_STATS
+    mp_printf(&mp_plat_print, "gc %u max %uus", (uint)MP_STATE_MEM(gc_stats_collections), (uint)MP_STATE_MEM(gc_stats_max_pause_us));
+    serial_write(" | ");
+    #endif
     serial_write(MICROPY_GIT_TAG);
     // Send string terminator
     serial_write("\x1b" "\\");
@@ -34,6 +34,7 @@
 #include "supervisor/filesystem.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/port.h"
+#include "supervisor/shared/cpu.h"
 #include "supervisor/shared/stack.h"
 
 #if CIRCUITPY_BLEIO_HCI
@@ -48,6 +49,10 @@
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_PROFILE
+#include "supervisor/profile.h"
+#endif
+
 #include "shared-bindings/microcontroller/__init__.h"
 
 #if CIRCUITPY_WATCHDOG
@@ -103,6 +108,10 @@ void supervisor_tick(void) {
     keypad_tick();
     #endif
 
+    #if CIRCUITPY_PROFILE
+    supervisor_profile_sample();
+    #endif
+
     background_callback_add(&tick_callback, supervisor_background_tick, NULL);
 }
 
@@ -117,6 +126,76 @@ uint32_t supervisor_ticks_ms32() {
     return supervisor_ticks_ms64();
 }
 
+mp_uint_t mp_hal_ticks_us(void) {
+    uint8_t subticks = 0;
+    uint64_t result = port_get_raw_ticks(&subticks);
+    // There are 32 subticks per tick.
+    result = (result * 32 + subticks) * 1000000 / 32768;
+    return result;
+}
+
+#if CIRCUITPY_CPU_GOVERNOR
+static void governed_wait(void) {
+    cpu_governor_enter_wait();
+    port_idle_until_interrupt();
+    cpu_governor_exit_wait();
+}
+#else
+#define governed_wait port_idle_until_interrupt
+#endif
+
+#if CIRCUITPY_POWER_STATS
+// Times are in subticks, 1/32768 s.
+static uint64_t power_stats_start;
+static uint64_t power_stats_idle;
+static uint64_t power_stats_sleep;
+
+static uint64_t power_stats_now(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    // There are 32 subticks per tick.
+    return ticks * 32 + subticks;
+}
+
+static void power_stats_wait(uint64_t *total) {
+    uint64_t start = power_stats_now();
+    governed_wait();
+    *total += power_stats_now() - start;
+}
+
+mp_obj_t supervisor_power_stats_get(bool reset) {
+    uint64_t now = power_stats_now();
+    uint64_t active = now - power_stats_start - power_stats_idle - power_stats_sleep;
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_ull(active * 1000 / 32768),
+        mp_obj_new_int_from_ull(power_stats_idle * 1000 / 32768),
+        mp_obj_new_int_from_ull(power_stats_sleep * 1000 / 32768),
+    };
+    if (reset) {
+        power_stats_start = now;
+        power_stats_idle = 0;
+        power_stats_sleep = 0;
+    }
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+
+void supervisor_idle_until_interrupt(void) {
+    power_stats_wait(&power_stats_idle);
+}
+
+void supervisor_sleep_until_interrupt(void) {
+    power_stats_wait(&power_stats_sleep);
+}
+#else
+void supervisor_idle_until_interrupt(void) {
+    governed_wait();
+}
+
+void supervisor_sleep_until_interrupt(void) {
+    governed_wait();
+}
+#endif
+
 void mp_hal_delay_ms(mp_uint_t delay_ms) {
     uint64_t start_tick = port_get_raw_ticks(NULL);
     // Adjust the delay to ticks vs ms.
@@ -136,7 +215,7 @@ void mp_hal_delay_ms(mp_uint_t delay_ms) {
         }
         port_interrupt_after_ticks(remaining);
         // Idle until an interrupt happens.
-        port_idle_until_interrupt();
+        supervisor_idle_until_interrupt();
         remaining = end_tick - port_get_raw_ticks(NULL);
     }
 }
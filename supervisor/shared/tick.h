@@ -65,4 +65,25 @@ extern void supervisor_disable_tick(void);
  */
 extern bool supervisor_background_ticks_ok(void);
 
+/** @brief Wait in port_idle_until_interrupt() while the VM waits for time or I/O.
+ *
+ * Used by time.sleep() and select instead of calling the port directly so that
+ * the wait is counted as idle time by supervisor.power_stats().
+ */
+extern void supervisor_idle_until_interrupt(void);
+
+/** @brief Wait in port_idle_until_interrupt() while no code is running.
+ *
+ * Used after code.py finishes and while pretending to deep sleep. The wait is
+ * counted as sleep time by supervisor.power_stats().
+ */
+extern void supervisor_sleep_until_interrupt(void);
+
+#if CIRCUITPY_POWER_STATS
+#include "py/obj.h"
+
+/* The time since start up or the last reset as (active_ms, idle_ms, sleep_ms). */
+mp_obj_t supervisor_power_stats_get(bool reset);
+#endif
+
 #endif
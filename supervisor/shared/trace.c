@@ -0,0 +1,143 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/mpconfig.h"
+#include "py/mpprint.h"
+#include "supervisor/cycle_count.h"
+#include "supervisor/trace.h"
+
+typedef struct {
+    uint32_t time;
+    // For begin and end events, the argument. For gaps, the duration.
+    uint32_t arg;
+    uint8_t event;
+    char phase;
+} trace_entry_t;
+
+STATIC trace_entry_t trace_buffer[CIRCUITPY_TRACE_EVENTS];
+STATIC size_t trace_next;
+STATIC size_t trace_count;
+STATIC bool trace_paused;
+STATIC uint32_t last_background_check;
+// CIRCUITPY_TRACE_VM_GAP_US in cycles, computed on first use.
+STATIC uint32_t vm_gap_cycles;
+
+STATIC const char *const trace_event_names[SUPERVISOR_TRACE_NUM_EVENTS] = {
+    [SUPERVISOR_TRACE_BACKGROUND_CALLBACK] = "background_callback",
+    [SUPERVISOR_TRACE_PORT_BACKGROUND_TASK] = "port_background_task",
+    [SUPERVISOR_TRACE_USB_BACKGROUND] = "usb_background",
+    [SUPERVISOR_TRACE_WEB_WORKFLOW_BACKGROUND] = "web_workflow_background",
+    [SUPERVISOR_TRACE_VM_GAP] = "vm",
+};
+
+STATIC void record(uint32_t time, supervisor_trace_event_t event, char phase, uint32_t arg) {
+    if (trace_paused) {
+        return;
+    }
+    trace_entry_t *entry = &trace_buffer[trace_next];
+    entry->time = time;
+    entry->arg = arg;
+    entry->event = event;
+    entry->phase = phase;
+    trace_next = (trace_next + 1) % CIRCUITPY_TRACE_EVENTS;
+    if (trace_count < CIRCUITPY_TRACE_EVENTS) {
+        trace_count++;
+    }
+}
+
+void supervisor_trace_begin(supervisor_trace_event_t event, const void *arg) {
+    record(port_get_cycle_count(), event, 'B', (uintptr_t)arg);
+}
+
+void supervisor_trace_end(supervisor_trace_event_t event) {
+    record(port_get_cycle_count(), event, 'E', 0);
+}
+
+void supervisor_trace_background_check(void) {
+    uint32_t now = port_get_cycle_count();
+    if (vm_gap_cycles == 0) {
+        vm_gap_cycles = (uint64_t)port_get_cycle_frequency() * CIRCUITPY_TRACE_VM_GAP_US / 1000000;
+    }
+    uint32_t gap = now - last_background_check;
+    if (last_background_check != 0 && gap > vm_gap_cycles) {
+        record(now, SUPERVISOR_TRACE_VM_GAP, 'X', gap);
+    }
+    last_background_check = now;
+}
+
+// Print a cycle count as microseconds with three decimals.
+STATIC void print_us(const mp_print_t *print, const char *key, uint64_t cycles, uint32_t frequency) {
+    uint64_t ns = cycles / frequency * 1000000000 + (cycles % frequency) * 1000000000 / frequency;
+    mp_printf(print, ",\"%s\":%u.%03u", key, (unsigned)(ns / 1000), (unsigned)(ns % 1000));
+}
+
+void supervisor_trace_dump(const mp_print_t *print, bool reset) {
+    trace_paused = true;
+    uint32_t frequency = port_get_cycle_frequency();
+    size_t first = (trace_next + CIRCUITPY_TRACE_EVENTS - trace_count) % CIRCUITPY_TRACE_EVENTS;
+    // Timestamps are taken relative to the first event, adding up the
+    // differences so that the 32-bit counter may wrap between events.
+    uint64_t now = 0;
+    uint32_t previous = trace_buffer[first].time;
+
+    mp_print_str(print, "{\"traceEvents\":[\n");
+    size_t depth = 0;
+    bool comma = false;
+    for (size_t i = 0; i < trace_count; i++) {
+        trace_entry_t *entry = &trace_buffer[(first + i) % CIRCUITPY_TRACE_EVENTS];
+        now += entry->time - previous;
+        previous = entry->time;
+        if (entry->phase == 'E') {
+            // The begin event may have been overwritten.
+            if (depth == 0) {
+                continue;
+            }
+            depth--;
+        } else if (entry->phase == 'B') {
+            depth++;
+        }
+        mp_printf(print, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":1",
+            comma ? ",\n" : "", trace_event_names[entry->event], entry->phase);
+        if (entry->phase == 'X') {
+            // Gaps are recorded when they end.
+            print_us(print, "ts", now > entry->arg ? now - entry->arg : 0, frequency);
+            print_us(print, "dur", entry->arg, frequency);
+        } else {
+            print_us(print, "ts", now, frequency);
+            if (entry->phase == 'B' && entry->arg != 0) {
+                mp_printf(print, ",\"args\":{\"arg\":\"0x%08x\"}", (unsigned)entry->arg);
+            }
+        }
+        mp_print_str(print, "}");
+        comma = true;
+    }
+    mp_print_str(print, "\n]}\n");
+    if (reset) {
+        trace_next = 0;
+        trace_count = 0;
+    }
+    trace_paused = false;
+}
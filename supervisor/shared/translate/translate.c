@@ -38,6 +38,48 @@
 #include "py/mpprint.h"
 #include "supervisor/serial.h"
 
+// Recently decompressed strings are kept so that a message used repeatedly,
+// such as one raised by argument validation in a loop, is only decoded once.
+// Strings longer than CIRCUITPY_TRANSLATE_CACHE_MAX_LEN (including the NUL)
+// are not cached.
+#if CIRCUITPY_TRANSLATE_CACHE_ENTRIES
+typedef struct {
+    const compressed_string_t *compressed;
+    uint32_t last_used;
+    char text[CIRCUITPY_TRANSLATE_CACHE_MAX_LEN];
+} translate_cache_entry_t;
+
+STATIC translate_cache_entry_t translate_cache[CIRCUITPY_TRANSLATE_CACHE_ENTRIES];
+STATIC uint32_t translate_cache_clock;
+
+STATIC bool translate_cache_lookup(const compressed_string_t *compressed, char *decompressed, uint16_t length) {
+    for (size_t i = 0; i < CIRCUITPY_TRANSLATE_CACHE_ENTRIES; i++) {
+        translate_cache_entry_t *entry = &translate_cache[i];
+        if (entry->compressed == compressed) {
+            memcpy(decompressed, entry->text, length);
+            entry->last_used = ++translate_cache_clock;
+            return true;
+        }
+    }
+    return false;
+}
+
+STATIC void translate_cache_insert(const compressed_string_t *compressed, const char *decompressed, uint16_t length) {
+    // Replace the least recently used entry.
+    translate_cache_entry_t *victim = &translate_cache[0];
+    for (size_t i = 1; i < CIRCUITPY_TRANSLATE_CACHE_ENTRIES; i++) {
+        if (translate_cache[i].last_used < victim->last_used) {
+            victim = &translate_cache[i];
+        }
+    }
+    // Invalidate the entry while its text is rewritten.
+    victim->compressed = NULL;
+    memcpy(victim->text, decompressed, length);
+    victim->last_used = ++translate_cache_clock;
+    victim->compressed = compressed;
+}
+#endif
+
 void serial_write_compressed(const compressed_string_t *compressed) {
     mp_printf(MP_PYTHON_PRINTER, "%S", compressed);
 }
@@ -105,6 +147,12 @@ char *decompress(const compressed_string_t *compressed, char *decompressed) {
     uint8_t b = (&compressed->data)[this_byte] << (compress_max_length_bits % 8);
     uint16_t length = decompress_length(compressed);
 
+    #if CIRCUITPY_TRANSLATE_CACHE_ENTRIES
+    if (length <= CIRCUITPY_TRANSLATE_CACHE_MAX_LEN && translate_cache_lookup(compressed, decompressed, length)) {
+        return decompressed;
+    }
+    #endif
+
     // Stop one early because the last byte is always NULL.
     for (uint16_t i = 0; i < length - 1;) {
         uint32_t bits = 0;
@@ -135,6 +183,12 @@ char *decompress(const compressed_string_t *compressed, char *decompressed) {
     }
 
     decompressed[length - 1] = '\0';
+
+    #if CIRCUITPY_TRANSLATE_CACHE_ENTRIES
+    if (length <= CIRCUITPY_TRANSLATE_CACHE_MAX_LEN) {
+        translate_cache_insert(compressed, decompressed, length);
+    }
+    #endif
     return decompressed;
 }
 
@@ -0,0 +1,139 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/ringbuf.h"
+#include "py/runtime.h"
+#include "shared/runtime/interrupt_char.h"
+#include "supervisor/shared/usb/host_keyboard.h"
+#include "tusb.h"
+
+// Keyboards attached to the host port are parsed in their boot protocol
+// reports and typed into the serial console. Other HID devices are left alone.
+
+static uint8_t _buf[16];
+static ringbuf_t _incoming_ringbuf = {
+    .buf = _buf,
+    .size = sizeof(_buf),
+};
+
+static const uint8_t _keycode_to_ascii[128][2] = { HID_KEYCODE_TO_ASCII };
+
+// The keys held down in the previous report of each keyboard, so that only
+// new presses are typed.
+static uint8_t _previous_keys[CFG_TUH_HID][6];
+
+void tuh_hid_mount_cb(uint8_t dev_addr, uint8_t instance, uint8_t const *desc_report, uint16_t desc_len) {
+    if (instance >= CFG_TUH_HID ||
+        tuh_hid_interface_protocol(dev_addr, instance) != HID_ITF_PROTOCOL_KEYBOARD) {
+        return;
+    }
+    memset(_previous_keys[instance], 0, sizeof(_previous_keys[instance]));
+    tuh_hid_receive_report(dev_addr, instance);
+}
+
+void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance) {
+}
+
+static bool _key_held(const uint8_t keys[6], uint8_t keycode) {
+    return memchr(keys, keycode, 6) != NULL;
+}
+
+static void _type(const char *text) {
+    size_t len = strlen(text);
+    // Drop whole sequences rather than sending half of an escape code.
+    if (ringbuf_num_empty(&_incoming_ringbuf) >= len) {
+        ringbuf_put_n(&_incoming_ringbuf, (const uint8_t *)text, len);
+    }
+}
+
+static void _type_keycode(uint8_t modifier, uint8_t keycode) {
+    switch (keycode) {
+        case HID_KEY_ARROW_UP:
+            _type("\x1b[A");
+            return;
+        case HID_KEY_ARROW_DOWN:
+            _type("\x1b[B");
+            return;
+        case HID_KEY_ARROW_RIGHT:
+            _type("\x1b[C");
+            return;
+        case HID_KEY_ARROW_LEFT:
+            _type("\x1b[D");
+            return;
+        default:
+            break;
+    }
+    if (keycode >= MP_ARRAY_SIZE(_keycode_to_ascii)) {
+        return;
+    }
+    bool shift = modifier & (KEYBOARD_MODIFIER_LEFTSHIFT | KEYBOARD_MODIFIER_RIGHTSHIFT);
+    char c = _keycode_to_ascii[keycode][shift];
+    if (c == 0) {
+        return;
+    }
+    if (modifier & (KEYBOARD_MODIFIER_LEFTCTRL | KEYBOARD_MODIFIER_RIGHTCTRL)) {
+        // Map letters and @[\]^_ to their control characters.
+        if (c >= '@') {
+            c &= 0x1f;
+        } else {
+            return;
+        }
+    }
+    if (c == mp_interrupt_char) {
+        ringbuf_clear(&_incoming_ringbuf);
+        mp_sched_keyboard_interrupt();
+        return;
+    }
+    char text[2] = { c, '\0' };
+    _type(text);
+}
+
+void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t const *report, uint16_t len) {
+    if (instance < CFG_TUH_HID && len >= sizeof(hid_keyboard_report_t)) {
+        hid_keyboard_report_t const *keyboard = (hid_keyboard_report_t const *)report;
+        for (size_t i = 0; i < 6; i++) {
+            uint8_t keycode = keyboard->keycode[i];
+            // Keycodes below 4 mean no key or a rollover error.
+            if (keycode < HID_KEY_A || _key_held(_previous_keys[instance], keycode)) {
+                continue;
+            }
+            _type_keycode(keyboard->modifier, keycode);
+        }
+        memcpy(_previous_keys[instance], keyboard->keycode, 6);
+    }
+    // Ask for the next report.
+    tuh_hid_receive_report(dev_addr, instance);
+}
+
+bool usb_keyboard_chars_available(void) {
+    return ringbuf_num_filled(&_incoming_ringbuf) > 0;
+}
+
+char usb_keyboard_read_char(void) {
+    return ringbuf_get(&_incoming_ringbuf);
+}
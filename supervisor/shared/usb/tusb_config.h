@@ -91,6 +91,10 @@ extern "C" {
 #ifndef CFG_TUD_CDC
 #define CFG_TUD_CDC                 1
 #endif
+// Each CDC interface has one of each FIFO. A larger TX FIFO lets a write queue
+// several packets for the host to take without waiting on the VM.
+#define CFG_TUD_CDC_RX_BUFSIZE      CIRCUITPY_USB_CDC_RX_BUFSIZE
+#define CFG_TUD_CDC_TX_BUFSIZE      CIRCUITPY_USB_CDC_TX_BUFSIZE
 
 #define CFG_TUD_MSC                 CIRCUITPY_USB_MSC
 #define CFG_TUD_HID                 CIRCUITPY_USB_HID
@@ -149,9 +153,17 @@ extern "C" {
 
 #define CFG_TUH_HUB                 1
 #define CFG_TUH_CDC                 0
-#define CFG_TUH_MSC                 0
+#define CFG_TUH_MSC                 1
 #define CFG_TUH_VENDOR              0
 
+// Boot protocol keyboards feed the serial console. The HID host driver claims
+// every HID interface so it is only included when that is wanted.
+#if CIRCUITPY_USB_KEYBOARD_WORKFLOW
+#define CFG_TUH_HID                 2
+#else
+#define CFG_TUH_HID                 0
+#endif
+
 // max device support (excluding hub device)
 #define CFG_TUH_DEVICE_MAX          (CFG_TUH_HUB ? 4 : 1) // hub typically has 4 ports
 
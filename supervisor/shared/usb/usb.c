@@ -30,6 +30,7 @@
 #include "supervisor/background_callback.h"
 #include "supervisor/port.h"
 #include "supervisor/serial.h"
+#include "supervisor/trace.h"
 #include "supervisor/usb.h"
 #include "supervisor/shared/workflow.h"
 #include "shared/runtime/interrupt_char.h"
@@ -198,6 +199,7 @@ void usb_disconnect(void) {
 }
 
 void usb_background(void) {
+    SUPERVISOR_TRACE_BEGIN(SUPERVISOR_TRACE_USB_BACKGROUND, NULL);
     if (usb_enabled()) {
         #if CFG_TUSB_OS == OPT_OS_NONE
         tud_task();
@@ -205,14 +207,17 @@ void usb_background(void) {
         tuh_task();
         #endif
         #endif
-        // No need to flush if there's no REPL.
+        // Send what's left of console and usb_cdc.data writes. Full packets
+        // are sent as they are written.
         #if CIRCUITPY_USB_CDC
-        if (usb_cdc_console_enabled()) {
-            // Console will always be itf 0.
-            tud_cdc_write_flush();
+        // Enabled interfaces are numbered from 0.
+        uint8_t cdc_count = usb_cdc_console_enabled() + usb_cdc_data_enabled();
+        for (uint8_t itf = 0; itf < cdc_count; itf++) {
+            tud_cdc_n_write_flush(itf);
         }
         #endif
     }
+    SUPERVISOR_TRACE_END(SUPERVISOR_TRACE_USB_BACKGROUND);
 }
 
 static background_callback_t usb_callback;
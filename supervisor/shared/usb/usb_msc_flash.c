@@ -35,11 +35,19 @@
 #include "py/mpstate.h"
 
 #include "shared-module/storage/__init__.h"
+#if CIRCUITPY_OS_GETENV
+#include "shared-module/os/__init__.h"
+#endif
+#include "supervisor/background_callback.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/usb.h"
 
 #define MSC_FLASH_BLOCK_SIZE    512
 
+// Not one of the commands TinyUSB handles itself.
+#define SCSI_CMD_SYNCHRONIZE_CACHE_10 0x35
+
 static bool ejected[1] = {true};
 
 // Lock to track if something else is using the filesystem when USB is plugged in. If so, the drive
@@ -64,9 +72,6 @@ void usb_msc_mount(void) {
     _usb_connected_while_locked = false;
 }
 
-void usb_msc_umount(void) {
-}
-
 bool usb_msc_ejected(void) {
     bool all_ejected = true;
     for (uint8_t i = 0; i < sizeof(ejected); i++) {
@@ -111,6 +116,81 @@ static fs_user_mount_t *get_vfs(int lun) {
     return current_mount->obj;
 }
 
+#if CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS > 0
+// Blocks written by the host are acknowledged once they're copied here, and
+// committed to the disk from a background callback so that the next transfer
+// can come in while the flash is busy. They go to the disk in order, and
+// before anything else reads or syncs it.
+static uint32_t write_queue[CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS][MSC_FLASH_BLOCK_SIZE / sizeof(uint32_t)];
+static uint32_t write_queue_lba[CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS];
+static uint8_t write_queue_lun[CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS];
+static size_t write_queue_start;
+static size_t write_queue_count;
+static background_callback_t write_queue_callback;
+// Set when a write completed while blocks were still queued. Autoreload
+// stays suspended until they reach the disk.
+static bool autoreload_after_commit;
+
+void usb_msc_flush(void) {
+    while (write_queue_count > 0) {
+        // Runs of consecutive blocks go to the disk in one write.
+        size_t run = 1;
+        while (run < write_queue_count &&
+               write_queue_start + run < CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS &&
+               write_queue_lun[write_queue_start + run] == write_queue_lun[write_queue_start] &&
+               write_queue_lba[write_queue_start + run] == write_queue_lba[write_queue_start] + run) {
+            run++;
+        }
+        fs_user_mount_t *vfs = get_vfs(write_queue_lun[write_queue_start]);
+        if (vfs != NULL) {
+            disk_write(vfs, (uint8_t *)write_queue[write_queue_start], write_queue_lba[write_queue_start], run);
+        }
+        write_queue_start = (write_queue_start + run) % CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS;
+        write_queue_count -= run;
+    }
+}
+
+STATIC void write_queue_background(void *unused) {
+    (void)unused;
+    usb_msc_flush();
+    if (autoreload_after_commit) {
+        autoreload_after_commit = false;
+        autoreload_resume(AUTORELOAD_SUSPEND_USB);
+        autoreload_trigger();
+    }
+}
+
+// Returns false if the blocks can't be queued and must be written directly.
+STATIC bool queue_write(uint8_t lun, uint32_t lba, const uint8_t *buffer, uint32_t block_count) {
+    if (block_count > CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS) {
+        usb_msc_flush();
+        return false;
+    }
+    if (block_count > CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS - write_queue_count) {
+        usb_msc_flush();
+    }
+    for (uint32_t i = 0; i < block_count; i++) {
+        size_t index = (write_queue_start + write_queue_count) % CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS;
+        memcpy(write_queue[index], buffer + i * MSC_FLASH_BLOCK_SIZE, MSC_FLASH_BLOCK_SIZE);
+        write_queue_lba[index] = lba + i;
+        write_queue_lun[index] = lun;
+        write_queue_count++;
+    }
+    // Flash writes are slow. Let them yield to other background work, but not
+    // for so long that an unplug is likely to lose what the host thinks is written.
+    background_callback_add_priority(&write_queue_callback, write_queue_background, NULL,
+        BACKGROUND_CALLBACK_BULK, 100);
+    return true;
+}
+#else
+void usb_msc_flush(void) {
+}
+#endif
+
+void usb_msc_umount(void) {
+    usb_msc_flush();
+}
+
 // Callback invoked when received an SCSI command not in built-in list below
 // - READ_CAPACITY10, READ_FORMAT_CAPACITY, INQUIRY, TEST_UNIT_READY, START_STOP_UNIT, MODE_SENSE6, REQUEST_SENSE
 // - READ10 and WRITE10 have their own callbacks
@@ -124,6 +204,18 @@ int32_t tud_msc_scsi_cb(uint8_t lun, const uint8_t scsi_cmd[16], void *buffer, u
             resplen = 0;
             break;
 
+        case SCSI_CMD_SYNCHRONIZE_CACHE_10: {
+            usb_msc_flush();
+            fs_user_mount_t *vfs = get_vfs(lun);
+            if (vfs == NULL || disk_ioctl(vfs, CTRL_SYNC, NULL) != RES_OK) {
+                tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x0C, 0x00);
+                resplen = -1;
+            } else {
+                resplen = 0;
+            }
+            break;
+        }
+
         default:
             // Set Sense = Invalid Command Operation
             tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
@@ -174,6 +266,7 @@ int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buff
 
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
+    usb_msc_flush();
     fs_user_mount_t *vfs = get_vfs(lun);
     disk_read(vfs, buffer, lba, block_count);
 
@@ -190,7 +283,13 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
     fs_user_mount_t *vfs = get_vfs(lun);
+    #if CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS > 0
+    if (!queue_write(lun, lba, buffer, block_count)) {
+        disk_write(vfs, buffer, lba, block_count);
+    }
+    #else
     disk_write(vfs, buffer, lba, block_count);
+    #endif
     // Since by getting here we assume the mount is read-only to
     // MicroPython let's update the cached FatFs sector if it's the one
     // we just wrote.
@@ -207,6 +306,11 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
         }
     }
 
+    // The host may have rewritten settings.toml.
+    #if CIRCUITPY_OS_GETENV
+    os_getenv_cache_invalidate();
+    #endif
+
     return block_count * MSC_FLASH_BLOCK_SIZE;
 }
 
@@ -215,6 +319,14 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
 void tud_msc_write10_complete_cb(uint8_t lun) {
     (void)lun;
 
+    #if CIRCUITPY_USB_MSC_WRITE_QUEUE_BLOCKS > 0
+    if (write_queue_count > 0) {
+        // Reload once the queued blocks are on the disk.
+        autoreload_after_commit = true;
+        return;
+    }
+    #endif
+
     // This write is complete; initiate an autoreload.
     autoreload_resume(AUTORELOAD_SUSPEND_USB);
     autoreload_trigger();
@@ -261,6 +373,7 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     if (current_mount == NULL) {
         return false;
     }
+    usb_msc_flush();
     if (load_eject) {
         if (!start) {
             // Eject but first flush.
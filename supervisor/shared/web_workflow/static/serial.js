@@ -30,21 +30,72 @@ ws.onopen = function() {
 var setting_title = false;
 var encoder = new TextEncoder();
 var left_count = 0;
-ws.onmessage = function(e) {
-  if (e.data == "\x1b]0;") {
-    setting_title = true;
-    title.textContent = "";
-  } else if (e.data == "\x1b\\") {
-    setting_title = false;
-  } else if (setting_title) {
-    title.textContent += e.data;
-  } else if (e.data == "\b") {
-    left_count += 1;
-  } else if (e.data == "\x1b[K") { // Clear line
+// Output is batched, so escape sequences may be anywhere in a message or split
+// across two of them.
+var pending = "";
+var TITLE_START = "\x1b]0;";
+var TITLE_END = "\x1b\\";
+var CLEAR_LINE = "\x1b[K";
+
+function is_partial(text, sequence) {
+  return text.length < sequence.length && sequence.startsWith(text);
+}
+
+function clear_line() {
+  if (left_count > 0) {
     log.textContent = log.textContent.slice(0, -left_count);
-    left_count = 0;
-  } else {
-    log.textContent += e.data;
+  }
+  left_count = 0;
+}
+
+ws.onmessage = function(e) {
+  if (typeof e.data != "string") {
+    // Binary messages are data for code.py, not console output.
+    return;
+  }
+  var text = pending + e.data;
+  pending = "";
+  while (text.length > 0) {
+    if (setting_title) {
+      var end = text.indexOf(TITLE_END);
+      if (end >= 0) {
+        title.textContent += text.slice(0, end);
+        text = text.slice(end + TITLE_END.length);
+        setting_title = false;
+      } else if (text.endsWith("\x1b")) {
+        title.textContent += text.slice(0, -1);
+        pending = "\x1b";
+        text = "";
+      } else {
+        title.textContent += text;
+        text = "";
+      }
+      continue;
+    }
+    var i = text.search(/[\x1b\b]/);
+    if (i < 0) {
+      log.textContent += text;
+      break;
+    }
+    log.textContent += text.slice(0, i);
+    text = text.slice(i);
+    if (text[0] == "\b") {
+      left_count += 1;
+      text = text.slice(1);
+    } else if (text.startsWith(TITLE_START)) {
+      setting_title = true;
+      title.textContent = "";
+      text = text.slice(TITLE_START.length);
+    } else if (text.startsWith(CLEAR_LINE)) {
+      clear_line();
+      text = text.slice(CLEAR_LINE.length);
+    } else if (is_partial(text, TITLE_START) || is_partial(text, CLEAR_LINE)) {
+      pending = text;
+      break;
+    } else {
+      log.textContent += text[0];
+      text = text.slice(1);
+    }
   }
   document.querySelector("span").scrollIntoView();
 };
@@ -0,0 +1,334 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "supervisor/shared/web_workflow/tar.h"
+
+#include "py/misc.h"
+#include "py/mpconfig.h"
+#include "shared/timeutils/timeutils.h"
+#include "supervisor/fatfs.h"
+#include "supervisor/shared/workflow.h"
+
+// Offsets into a ustar header block.
+#define TAR_NAME (0)
+#define TAR_NAME_LEN (100)
+#define TAR_MODE (100)
+#define TAR_SIZE (124)
+#define TAR_MTIME (136)
+#define TAR_CHECKSUM (148)
+#define TAR_TYPEFLAG (156)
+#define TAR_MAGIC (257)
+#define TAR_PREFIX (345)
+#define TAR_PREFIX_LEN (155)
+
+// FAT timestamps start at 1980.
+#define FAT_EPOCH_SECONDS (315532800)
+
+STATIC uint32_t _parse_octal(const uint8_t *field, size_t len) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (field[i] == ' ' && value == 0) {
+            continue;
+        }
+        if (field[i] < '0' || field[i] > '7') {
+            break;
+        }
+        value = (value << 3) | (field[i] - '0');
+    }
+    return value;
+}
+
+// Writes len - 1 digits and a NUL.
+STATIC void _format_octal(uint8_t *field, size_t len, uint32_t value) {
+    field[len - 1] = '\0';
+    for (size_t i = len - 1; i > 0; i--) {
+        field[i - 1] = '0' + (value & 0x7);
+        value >>= 3;
+    }
+}
+
+// The checksum is the sum of the header bytes with the checksum field as spaces.
+STATIC uint32_t _checksum(const uint8_t header[TAR_BLOCK_SIZE]) {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < TAR_BLOCK_SIZE; i++) {
+        if (i >= TAR_CHECKSUM && i < TAR_CHECKSUM + 8) {
+            sum += ' ';
+        } else {
+            sum += header[i];
+        }
+    }
+    return sum;
+}
+
+STATIC void _set_fattime(uint32_t mtime) {
+    if (mtime < FAT_EPOCH_SECONDS) {
+        return;
+    }
+    timeutils_struct_time_t tm;
+    timeutils_seconds_since_epoch_to_struct_time(mtime, &tm);
+    override_fattime(((tm.tm_year - 1980) << 25) | (tm.tm_mon << 21) | (tm.tm_mday << 16) |
+        (tm.tm_hour << 11) | (tm.tm_min << 5) | (tm.tm_sec >> 1));
+}
+
+STATIC void _close_file(tar_extract_t *tar) {
+    if (!tar->file_open) {
+        return;
+    }
+    _set_fattime(tar->mtime);
+    f_close(&tar->file);
+    override_fattime(0);
+    tar->file_open = false;
+}
+
+// Joins the root and the entry's name into tar->path. Names that could leave
+// the root, or don't fit, are refused. An entry for the root itself leaves the
+// path ending in a slash.
+STATIC bool _entry_path(tar_extract_t *tar, const uint8_t *header) {
+    const char *prefix = (const char *)header + TAR_PREFIX;
+    const char *name = (const char *)header + TAR_NAME;
+    size_t prefix_len = strnlen(prefix, TAR_PREFIX_LEN);
+    size_t name_len = strnlen(name, TAR_NAME_LEN);
+    if (memcmp(header + TAR_MAGIC, "ustar", 5) != 0) {
+        prefix_len = 0;
+    }
+
+    size_t root_len = strlen(tar->root);
+    if (root_len == 1) {
+        // The root is "/".
+        root_len = 0;
+    }
+    if (root_len + 1 + prefix_len + 1 + name_len + 1 > sizeof(tar->path)) {
+        return false;
+    }
+    char *p = tar->path;
+    memcpy(p, tar->root, root_len);
+    p += root_len;
+    *p++ = '/';
+    if (prefix_len > 0) {
+        memcpy(p, prefix, prefix_len);
+        p += prefix_len;
+        *p++ = '/';
+    }
+    memcpy(p, name, name_len);
+    p[name_len] = '\0';
+
+    // Check each part of the name. Empty parts and "." are dropped so that
+    // "./name", "/name" and "dir/" stay inside the root.
+    char *start = tar->path + root_len + 1;
+    char *part = start;
+    char *out = start;
+    while (*part != '\0') {
+        char *end = strchr(part, '/');
+        size_t part_len = end == NULL ? strlen(part) : (size_t)(end - part);
+        if (part_len == 2 && part[0] == '.' && part[1] == '.') {
+            return false;
+        }
+        if (part_len > 0 && !(part_len == 1 && part[0] == '.')) {
+            if (out != start) {
+                *out++ = '/';
+            }
+            memmove(out, part, part_len);
+            out += part_len;
+        }
+        part += part_len;
+        if (*part == '/') {
+            part++;
+        }
+    }
+    *out = '\0';
+    return true;
+}
+
+// Makes the directories above tar->path.
+STATIC FRESULT _mkdir_parents(tar_extract_t *tar) {
+    char *slash = strrchr(tar->path, '/');
+    if (slash == NULL || slash == tar->path) {
+        return FR_OK;
+    }
+    *slash = '\0';
+    FRESULT result = supervisor_workflow_mkdir_parents(tar->fs, tar->path);
+    *slash = '/';
+    if (result == FR_EXIST) {
+        result = FR_OK;
+    }
+    return result;
+}
+
+STATIC bool _start_entry(tar_extract_t *tar, const uint8_t *header) {
+    bool empty = true;
+    for (size_t i = 0; i < TAR_BLOCK_SIZE; i++) {
+        if (header[i] != 0) {
+            empty = false;
+            break;
+        }
+    }
+    if (empty) {
+        // The archive ends with zero blocks.
+        tar->state = TAR_END;
+        return true;
+    }
+    if (_parse_octal(header + TAR_CHECKSUM, 8) != _checksum(header)) {
+        return false;
+    }
+
+    uint32_t size = _parse_octal(header + TAR_SIZE, 12);
+    tar->mtime = _parse_octal(header + TAR_MTIME, 12);
+    tar->padding = tar_padding(size);
+    tar->remaining = size;
+    tar->state = TAR_SKIP;
+
+    char type = header[TAR_TYPEFLAG];
+    if (type != '0' && type != '\0' && type != '5') {
+        // Links, long names and extended headers are skipped over.
+        tar->remaining += tar->padding;
+        tar->padding = 0;
+        return true;
+    }
+    if (!_entry_path(tar, header)) {
+        return false;
+    }
+    if (tar->path[strlen(tar->path) - 1] == '/') {
+        // The root already exists but can't be a file.
+        return type == '5';
+    }
+    if (_mkdir_parents(tar) != FR_OK) {
+        return false;
+    }
+
+    _set_fattime(tar->mtime);
+    FRESULT result;
+    if (type == '5') {
+        result = f_mkdir(tar->fs, tar->path);
+        if (result == FR_EXIST) {
+            result = FR_OK;
+        }
+    } else {
+        result = f_open(tar->fs, &tar->file, tar->path, FA_WRITE | FA_CREATE_ALWAYS);
+        if (result == FR_OK) {
+            tar->file_open = true;
+            tar->state = TAR_FILE_DATA;
+        }
+    }
+    override_fattime(0);
+    return result == FR_OK;
+}
+
+void tar_extract_init(tar_extract_t *tar, FATFS *fs, const char *root) {
+    tar->fs = fs;
+    tar->root = root;
+    tar->state = TAR_HEADER;
+    tar->file_open = false;
+    tar->remaining = 0;
+    tar->padding = 0;
+    tar->mtime = 0;
+}
+
+bool tar_extract_feed(tar_extract_t *tar, const uint8_t *data, size_t len, size_t *consumed) {
+    size_t offset = 0;
+    bool ok = true;
+    while (ok) {
+        size_t available = len - offset;
+        if (tar->state == TAR_HEADER) {
+            if (available < TAR_BLOCK_SIZE) {
+                break;
+            }
+            ok = _start_entry(tar, data + offset);
+            offset += TAR_BLOCK_SIZE;
+        } else if (tar->state == TAR_FILE_DATA) {
+            size_t write_len = MIN(available, tar->remaining);
+            // Write whole sectors until the last of the file.
+            if (write_len < tar->remaining) {
+                write_len -= write_len % FF_MIN_SS;
+            }
+            if (write_len == 0 && tar->remaining > 0) {
+                break;
+            }
+            UINT actual;
+            ok = f_write(&tar->file, data + offset, write_len, &actual) == FR_OK && actual == write_len;
+            offset += write_len;
+            tar->remaining -= write_len;
+            if (tar->remaining == 0) {
+                _close_file(tar);
+                tar->remaining = tar->padding;
+                tar->padding = 0;
+                tar->state = TAR_SKIP;
+            }
+        } else if (tar->state == TAR_SKIP) {
+            size_t skip_len = MIN(available, tar->remaining);
+            offset += skip_len;
+            tar->remaining -= skip_len;
+            if (tar->remaining > 0) {
+                break;
+            }
+            tar->state = TAR_HEADER;
+        } else {
+            // Ignore everything after the end, including the second zero block.
+            offset = len;
+            break;
+        }
+    }
+    *consumed = offset;
+    return ok;
+}
+
+bool tar_extract_finish(tar_extract_t *tar) {
+    bool clean = !tar->file_open && (tar->state == TAR_END || tar->state == TAR_HEADER);
+    _close_file(tar);
+    return clean;
+}
+
+bool tar_header(uint8_t header[TAR_BLOCK_SIZE], const char *name, uint32_t size, uint32_t mtime, bool directory) {
+    memset(header, 0, TAR_BLOCK_SIZE);
+    size_t name_len = strlen(name);
+    if (name_len > TAR_NAME_LEN) {
+        // Split the name at a slash into the prefix and name fields.
+        const char *split = name + name_len - TAR_NAME_LEN - 1;
+        while (*split != '\0' && *split != '/') {
+            split++;
+        }
+        size_t prefix_len = split - name;
+        if (*split == '\0' || prefix_len > TAR_PREFIX_LEN) {
+            return false;
+        }
+        memcpy(header + TAR_PREFIX, name, prefix_len);
+        name = split + 1;
+        name_len = strlen(name);
+    }
+    memcpy(header + TAR_NAME, name, name_len);
+    _format_octal(header + TAR_MODE, 8, directory ? 0755 : 0644);
+    // The owner and group are left as 0.
+    _format_octal(header + TAR_MODE + 8, 8, 0);
+    _format_octal(header + TAR_MODE + 16, 8, 0);
+    _format_octal(header + TAR_SIZE, 12, directory ? 0 : size);
+    _format_octal(header + TAR_MTIME, 12, mtime);
+    header[TAR_TYPEFLAG] = directory ? '5' : '0';
+    memcpy(header + TAR_MAGIC, "ustar\0" "00", 8);
+    _format_octal(header + TAR_CHECKSUM, 7, _checksum(header));
+    header[TAR_CHECKSUM + 7] = ' ';
+    return true;
+}
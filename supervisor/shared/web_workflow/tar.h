@@ -0,0 +1,80 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lib/oofatfs/ff.h"
+
+// Streaming reader and writer of ustar archives for bulk web workflow
+// transfers. Only regular files and directories are handled.
+
+#define TAR_BLOCK_SIZE (512)
+
+typedef enum {
+    TAR_HEADER,
+    TAR_FILE_DATA,
+    TAR_SKIP,
+    TAR_END,
+} tar_extract_state_t;
+
+typedef struct {
+    FATFS *fs;
+    // The directory the archive is extracted into, without a trailing slash.
+    const char *root;
+    tar_extract_state_t state;
+    FIL file;
+    bool file_open;
+    // What is left of the current entry's data, and then its padding.
+    uint32_t remaining;
+    uint32_t padding;
+    uint32_t mtime;
+    char path[256];
+} tar_extract_t;
+
+void tar_extract_init(tar_extract_t *tar, FATFS *fs, const char *root);
+
+// Extract from len bytes of the archive, setting consumed to how many were
+// used. The rest must be passed again with more data appended; less than a
+// block is left only when a header or a partial sector is incomplete.
+// Returns false on a malformed archive or a filesystem error.
+bool tar_extract_feed(tar_extract_t *tar, const uint8_t *data, size_t len, size_t *consumed);
+
+// Close any file left open. Returns true if the archive ended cleanly.
+bool tar_extract_finish(tar_extract_t *tar);
+
+// Fill in a header block for a file or directory. name is relative to the
+// archive root and directories should end with a slash. Returns false if the
+// name doesn't fit.
+bool tar_header(uint8_t header[TAR_BLOCK_SIZE], const char *name, uint32_t size, uint32_t mtime, bool directory);
+
+// The bytes of padding after size bytes of data.
+static inline uint32_t tar_padding(uint32_t size) {
+    return (TAR_BLOCK_SIZE - size % TAR_BLOCK_SIZE) % TAR_BLOCK_SIZE;
+}
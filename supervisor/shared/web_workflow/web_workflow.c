@@ -42,12 +42,16 @@
 #include "shared/timeutils/timeutils.h"
 #include "supervisor/fatfs.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/memory.h"
 #include "supervisor/port.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate/translate.h"
+#include "supervisor/shared/web_workflow/tar.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
 #include "supervisor/shared/web_workflow/websocket.h"
 #include "supervisor/shared/workflow.h"
+#include "supervisor/trace.h"
 #include "supervisor/usb.h"
 
 #include "shared-bindings/hashlib/__init__.h"
@@ -100,12 +104,30 @@ typedef struct {
     bool expect;
     bool json;
     bool websocket;
-    bool new_socket;
+    // A PUT body is being written to file, a little each background pass.
+    bool uploading;
+    bool new_file;
+    // The body is a tar archive to extract into the directory.
+    bool extract;
+    // Keep the connection open for another request once this one is done.
+    bool keep_alive;
     uint32_t websocket_version;
     // RFC6455 for websockets says this header should be 24 base64 characters long.
     char websocket_key[24 + 1];
+    char if_none_match[64];
+    FIL file;
+    size_t body_read;
+    // When the connection last finished a request, or was accepted.
+    uint32_t idle_since_ms;
 } _request;
 
+// Each connection has its own request state, so that a browser's parallel
+// requests and a long upload don't wait on each other.
+typedef struct {
+    socketpool_socket_obj_t socket;
+    _request request;
+} _connection;
+
 static wifi_radio_error_t _wifi_status = WIFI_RADIO_ERROR_NONE;
 
 #if CIRCUITPY_STATUS_BAR
@@ -123,9 +145,28 @@ static mp_int_t web_api_port = 80;
 
 static socketpool_socketpool_obj_t pool;
 static socketpool_socket_obj_t listening;
-static socketpool_socket_obj_t active;
-
-static _request active_request;
+static _connection connections[CIRCUITPY_WEB_WORKFLOW_CONNECTIONS];
+// Close persistent connections that have gone this long without a request.
+#define WEB_WORKFLOW_IDLE_TIMEOUT_MS (5000)
+
+// An accepted socket waiting for a connection to become free.
+static socketpool_socket_obj_t incoming;
+
+// A buffer for file transfers, large enough that FatFs reads and writes whole
+// sectors directly to and from it. It is movable, so always go through ->ptr.
+// An upload keeps part of a sector here between background passes, so while
+// one is running, downloads use a small buffer on the stack.
+static supervisor_allocation *transfer_allocation;
+static size_t upload_pending;
+// Only one upload runs at a time, so the extraction state is shared.
+static tar_extract_t extraction;
+// The connection to service first on the next background pass.
+static size_t next_connection;
+// Requests that have started but not finished. Autoreload waits for them all.
+static size_t requests_in_progress;
+
+static void _close_connection(socketpool_socket_obj_t *socket, _request *request);
+static bool _upload_in_progress(void);
 
 static char _api_password[64];
 static char web_instance_name[50];
@@ -137,59 +178,37 @@ static char _our_ip_encoded[4 * 4];
 // in_len is the number of bytes to encode. out_len is the number of bytes we
 // have to do it.
 static bool _base64_in_place(char *buf, size_t in_len, size_t out_len) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     size_t triples = (((in_len - 1) / 3) + 1);
     size_t encoded_len = triples * 4;
     if (encoded_len + 1 > out_len) {
         return false;
     }
 
-    // First pass, we convert input buffer to numeric base 64 values
-    char *in = buf + (triples - 1) * 3;
+    // Work backwards from the last triple so that no input is overwritten before it is read.
+    const uint8_t *in = (const uint8_t *)buf + (triples - 1) * 3;
     char *out = buf + (triples - 1) * 4;
     int r = in_len % 3;
-    int partial = 0;
     if (r != 0) {
-        out[3] = 64;
-        if (r == 2) {
-            out[2] = (in[1] & 0x0F) << 2;
-            out[1] = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-        } else {
-            out[2] = 64;
-            out[1] = (in[0] & 0x03) << 4;
-        }
-        out[0] = (in[0] & 0xFC) >> 2;
+        uint32_t word = in[0] << 16 | (r == 2 ? in[1] << 8 : 0);
+        out[3] = '=';
+        out[2] = r == 2 ? alphabet[(word >> 6) & 0x3f] : '=';
+        out[1] = alphabet[(word >> 12) & 0x3f];
+        out[0] = alphabet[word >> 18];
         in -= 3;
         out -= 4;
-        partial = 1;
+        triples--;
     }
     buf[encoded_len] = '\0';
-    for (size_t i = 0; i < triples - partial; i++) {
-        out[3] = in[2] & 0x3F;
-        out[2] = (in[1] & 0x0F) << 2 | (in[2] & 0xC0) >> 6;
-        out[1] = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-        out[0] = (in[0] & 0xFC) >> 2;
+    for (size_t i = 0; i < triples; i++) {
+        uint32_t word = in[0] << 16 | in[1] << 8 | in[2];
+        out[3] = alphabet[word & 0x3f];
+        out[2] = alphabet[(word >> 6) & 0x3f];
+        out[1] = alphabet[(word >> 12) & 0x3f];
+        out[0] = alphabet[word >> 18];
         in -= 3;
         out -= 4;
     }
-
-    // Second pass, we convert number base 64 values to actual base64 ascii encoding
-    out = buf;
-    for (mp_uint_t j = 0; j < encoded_len; j++) {
-        if (*out < 26) {
-            *out += 'A';
-        } else if (*out < 52) {
-            *out += 'a' - 26;
-        } else if (*out < 62) {
-            *out += '0' - 52;
-        } else if (*out == 62) {
-            *out = '+';
-        } else if (*out == 63) {
-            *out = '/';
-        } else {
-            *out = '=';
-        }
-        out++;
-    }
     return true;
 }
 
@@ -322,13 +341,26 @@ bool supervisor_start_web_workflow(void) {
         common_hal_socketpool_socketpool_construct(&pool, &common_hal_wifi_radio_obj);
 
         socketpool_socket_reset(&listening);
-        socketpool_socket_reset(&active);
+        socketpool_socket_reset(&incoming);
+        for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+            socketpool_socket_reset(&connections[i].socket);
+        }
 
         websocket_init();
     }
 
-    if (!common_hal_socketpool_socket_get_closed(&active)) {
-        common_hal_socketpool_socket_close(&active);
+    if (transfer_allocation == NULL) {
+        // Without it, transfers go through small buffers on the stack.
+        transfer_allocation = allocate_memory(align32_size(CIRCUITPY_WEB_WORKFLOW_TRANSFER_BUFFER), false, true);
+    }
+
+    if (!common_hal_socketpool_socket_get_closed(&incoming)) {
+        common_hal_socketpool_socket_close(&incoming);
+    }
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+        if (!common_hal_socketpool_socket_get_closed(&connections[i].socket)) {
+            _close_connection(&connections[i].socket, &connections[i].request);
+        }
     }
 
     #if CIRCUITPY_MDNS
@@ -358,7 +390,7 @@ bool supervisor_start_web_workflow(void) {
         common_hal_socketpool_socket_settimeout(&listening, 0);
         // Bind to any ip. (Not checking for failures)
         common_hal_socketpool_socket_bind(&listening, "", 0, web_api_port);
-        common_hal_socketpool_socket_listen(&listening, 1);
+        common_hal_socketpool_socket_listen(&listening, CIRCUITPY_WEB_WORKFLOW_CONNECTIONS);
     }
     // Wake polling thread (maybe)
     socketpool_socket_poll_resume();
@@ -704,6 +736,38 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
     _send_chunk(socket, "");
 }
 
+// Sends all of buf, giving up on an error other than the socket being busy.
+static bool _send_all(socketpool_socket_obj_t *socket, const uint8_t *buf, size_t len) {
+    size_t send_offset = 0;
+    while (send_offset < len) {
+        int sent = socketpool_socket_send(socket, buf + send_offset, len - send_offset);
+        if (sent < 0) {
+            if (sent != -MP_EAGAIN) {
+                return false;
+            }
+            sent = 0;
+        }
+        send_offset += sent;
+    }
+    return true;
+}
+
+// Sends length bytes of the file, read through buffer.
+static bool _send_file_data(socketpool_socket_obj_t *socket, FIL *file, uint8_t *buffer, size_t buffer_len, uint32_t length) {
+    uint32_t total_read = 0;
+    while (total_read < length) {
+        size_t quantity_read;
+        if (f_read(file, buffer, MIN(buffer_len, length - total_read), &quantity_read) != FR_OK || quantity_read == 0) {
+            return false;
+        }
+        total_read += quantity_read;
+        if (!_send_all(socket, buffer, quantity_read)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
     uint32_t total_length = f_size(active_file);
 
@@ -725,26 +789,147 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
     _cors_header(socket, request);
     _send_str(socket, "\r\n");
 
-    uint32_t total_read = 0;
-    while (total_read < total_length) {
-        uint8_t data_buffer[64];
-        size_t quantity_read;
-        f_read(active_file, data_buffer, 64, &quantity_read);
-        total_read += quantity_read;
-        uint32_t send_offset = 0;
-        while (send_offset < quantity_read) {
-            int sent = socketpool_socket_send(socket, data_buffer + send_offset, quantity_read - send_offset);
-            if (sent < 0) {
-                if (sent == -MP_EAGAIN) {
-                    sent = 0;
-                } else {
-                    break;
-                }
+    uint8_t small_buffer[256];
+    uint8_t *data_buffer = small_buffer;
+    size_t buffer_len = sizeof(small_buffer);
+    if (transfer_allocation != NULL && !_upload_in_progress()) {
+        data_buffer = (uint8_t *)transfer_allocation->ptr;
+        buffer_len = CIRCUITPY_WEB_WORKFLOW_TRANSFER_BUFFER;
+    }
+
+    if (!_send_file_data(socket, active_file, data_buffer, buffer_len, total_length)) {
+        socketpool_socket_close(socket);
+    }
+}
+
+// Works out the archive's size when socket is NULL, and sends it otherwise.
+// path is extended in place with each entry's name. Returns false on a
+// filesystem or send error.
+static bool _archive_directory(socketpool_socket_obj_t *socket, FATFS *fs, char *path, size_t path_size, size_t root_len, uint8_t *buffer, size_t buffer_len, uint32_t *total) {
+    // Check the stack since we recurse for each level.
+    if (mp_stack_usage() >= MP_STATE_THREAD(stack_limit)) {
+        return false;
+    }
+    FF_DIR dir;
+    if (f_opendir(fs, &dir, path) != FR_OK) {
+        return false;
+    }
+    size_t pathlen = strlen(path);
+    // Entries of "/" join on without another slash.
+    size_t base = pathlen == 1 ? 0 : pathlen;
+    FILINFO file_info;
+    bool ok = true;
+    while (ok) {
+        FRESULT res = f_readdir(&dir, &file_info);
+        if (res != FR_OK) {
+            ok = false;
+            break;
+        }
+        if (file_info.fname[0] == '\0') {
+            break;
+        }
+        size_t fnlen = strlen(file_info.fname);
+        if (base + 1 + fnlen + 2 > path_size) {
+            ok = false;
+            break;
+        }
+        path[base] = '/';
+        memcpy(path + base + 1, file_info.fname, fnlen + 1);
+        bool directory = (file_info.fattrib & AM_DIR) != 0;
+        uint32_t size = directory ? 0 : file_info.fsize;
+        *total += TAR_BLOCK_SIZE + size + tar_padding(size);
+
+        if (socket != NULL) {
+            uint32_t mtime = timeutils_mktime(1980 + (file_info.fdate >> 9),
+                (file_info.fdate >> 5) & 0xf,
+                file_info.fdate & 0x1f,
+                file_info.ftime >> 11,
+                (file_info.ftime >> 5) & 0x3f,
+                (file_info.ftime & 0x1f) * 2);
+            // Names are relative to the requested directory and directories
+            // end with a slash.
+            char *name = path + root_len + 1;
+            if (directory) {
+                strcat(name, "/");
             }
-            send_offset += sent;
+            ok = tar_header(buffer, name, size, mtime, directory) &&
+                _send_all(socket, buffer, TAR_BLOCK_SIZE);
+            path[base + 1 + fnlen] = '\0';
         }
+        if (ok && directory) {
+            ok = _archive_directory(socket, fs, path, path_size, root_len, buffer, buffer_len, total);
+        } else if (ok && socket != NULL) {
+            FIL active_file;
+            ok = f_open(fs, &active_file, path, FA_READ) == FR_OK;
+            if (ok) {
+                // A file that changes size since it was counted would throw off
+                // the Content-Length, so stop instead.
+                ok = f_size(&active_file) == size &&
+                    _send_file_data(socket, &active_file, buffer, buffer_len, size);
+                f_close(&active_file);
+            }
+            if (ok && tar_padding(size) > 0) {
+                memset(buffer, 0, tar_padding(size));
+                ok = _send_all(socket, buffer, tar_padding(size));
+            }
+        }
+        path[pathlen] = '\0';
+    }
+    f_closedir(&dir);
+    return ok;
+}
+
+// Sends the directory's contents as a tar archive. The directory is walked
+// twice, first to size the archive for the Content-Length.
+static void _reply_with_archive(socketpool_socket_obj_t *socket, _request *request, FATFS *fs, const char *path) {
+    if (_upload_in_progress()) {
+        // The upload could change the files between the two walks.
+        _reply_conflict(socket, request);
+        return;
+    }
+    if (transfer_allocation == NULL) {
+        _reply_server_error(socket, request);
+        return;
+    }
+    uint8_t *buffer = (uint8_t *)transfer_allocation->ptr;
+    size_t buffer_len = CIRCUITPY_WEB_WORKFLOW_TRANSFER_BUFFER;
+
+    char archive_path[256];
+    strcpy(archive_path, path);
+    size_t root_len = strlen(path);
+    if (root_len == 1) {
+        root_len = 0;
+    } else {
+        FILINFO file_info;
+        if (f_stat(fs, path, &file_info) != FR_OK || (file_info.fattrib & AM_DIR) == 0) {
+            _reply_missing(socket, request);
+            return;
+        }
+    }
+
+    // Two zero blocks end the archive.
+    uint32_t total_length = 2 * TAR_BLOCK_SIZE;
+    if (!_archive_directory(NULL, fs, archive_path, sizeof(archive_path), root_len, buffer, buffer_len, &total_length)) {
+        _reply_server_error(socket, request);
+        return;
+    }
+
+    _send_str(socket, "HTTP/1.1 200 OK\r\n");
+    mp_print_t _socket_print = {socket, _print_raw};
+    mp_printf(&_socket_print, "Content-Length: %d\r\n", total_length);
+    _send_strs(socket, "Content-Type:", "application/x-tar\r\n", NULL);
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+
+    uint32_t sent_length = 2 * TAR_BLOCK_SIZE;
+    bool ok = _archive_directory(socket, fs, archive_path, sizeof(archive_path), root_len, buffer, buffer_len, &sent_length);
+    if (ok && sent_length == total_length) {
+        memset(buffer, 0, 2 * TAR_BLOCK_SIZE);
+        ok = _send_all(socket, buffer, 2 * TAR_BLOCK_SIZE);
+    } else {
+        ok = false;
     }
-    if (total_read < total_length) {
+    if (!ok) {
         socketpool_socket_close(socket);
     }
 }
@@ -881,25 +1066,30 @@ STATIC void _discard_incoming(socketpool_socket_obj_t *socket, size_t amount) {
     }
 }
 
-static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *request, FATFS *fs, const TCHAR *path) {
-    FIL active_file;
+static void _set_fattime(_request *request) {
+    if (request->timestamp_ms > 0) {
+        DWORD fattime;
+        truncate_time(request->timestamp_ms * 1000000, &fattime);
+        override_fattime(fattime);
+    }
+}
+
+// Opens the file and leaves the body to _continue_upload(). Replies directly on failure.
+static void _start_upload(socketpool_socket_obj_t *socket, _request *request, FATFS *fs, const TCHAR *path) {
+    FIL *active_file = &request->file;
 
     if (_usb_active()) {
         _discard_incoming(socket, request->content_length);
         _reply_conflict(socket, request);
         return;
     }
-    if (request->timestamp_ms > 0) {
-        DWORD fattime;
-        truncate_time(request->timestamp_ms * 1000000, &fattime);
-        override_fattime(fattime);
-    }
+    _set_fattime(request);
 
-    FRESULT result = f_open(fs, &active_file, path, FA_WRITE);
+    FRESULT result = f_open(fs, active_file, path, FA_WRITE);
     bool new_file = false;
     if (result == FR_NO_FILE) {
         new_file = true;
-        result = f_open(fs, &active_file, path, FA_WRITE | FA_OPEN_ALWAYS);
+        result = f_open(fs, active_file, path, FA_WRITE | FA_OPEN_ALWAYS);
     }
 
     if (result == FR_NO_PATH) {
@@ -924,9 +1114,9 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     }
 
     // Change the file size to start.
-    f_lseek(&active_file, request->content_length);
-    if (f_tell(&active_file) < request->content_length) {
-        f_close(&active_file);
+    f_lseek(active_file, request->content_length);
+    if (f_tell(active_file) < request->content_length) {
+        f_close(active_file);
         override_fattime(0);
         #if CIRCUITPY_USB_MSC
         usb_msc_unlock();
@@ -941,48 +1131,152 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
 
         return;
     }
-    f_truncate(&active_file);
-    f_rewind(&active_file);
+    f_truncate(active_file);
+    f_rewind(active_file);
+    // Other requests may change the override before the upload is done, so it
+    // is set again for the close.
+    override_fattime(0);
 
-    size_t total_read = 0;
-    bool error = false;
-    while (total_read < request->content_length && !error) {
-        uint8_t bytes[64];
-        size_t read_len = MIN(sizeof(bytes), request->content_length - total_read);
-        int len = socketpool_socket_recv_into(socket, bytes, read_len);
-        if (len < 0) {
-            if (len == -MP_EAGAIN) {
-                continue;
-            }
-            error = true;
-            break;
+    request->body_read = 0;
+    request->new_file = new_file;
+    request->uploading = true;
+}
+
+// Extracts the body into the directory over the following background passes,
+// like a file upload. Replies directly on failure.
+static void _start_extract(socketpool_socket_obj_t *socket, _request *request, FATFS *fs, char *path) {
+    if (_usb_active()) {
+        _discard_incoming(socket, request->content_length);
+        _reply_conflict(socket, request);
+        return;
+    }
+    // Whole headers must fit in the buffer with what's kept from before.
+    FRESULT result = FR_INT_ERR;
+    if (transfer_allocation != NULL) {
+        result = FR_OK;
+        if (strlen(path) > 1) {
+            result = supervisor_workflow_mkdir_parents(fs, path);
         }
-        total_read += len;
-        UINT actual;
-        f_write(&active_file, bytes, len, &actual);
-        if (actual < (UINT)len) {
-            error = true;
-            break;
+    }
+    if (result != FR_OK && result != FR_EXIST) {
+        #if CIRCUITPY_USB_MSC
+        usb_msc_unlock();
+        #endif
+        _discard_incoming(socket, request->content_length);
+        if (result == FR_NO_PATH) {
+            _reply_missing(socket, request);
+        } else {
+            _reply_server_error(socket, request);
         }
+        return;
     }
+    if (request->expect) {
+        _reply_continue(socket, request);
+    }
+
+    tar_extract_init(&extraction, fs, path);
+    request->body_read = 0;
+    request->new_file = result == FR_OK && strlen(path) > 1;
+    request->extract = true;
+    request->uploading = true;
+}
 
-    f_close(&active_file);
+// Closes the upload's file and replies, or just closes it when reply is false.
+static void _finish_upload(socketpool_socket_obj_t *socket, _request *request, bool error, bool reply) {
+    if (request->extract) {
+        // Each extracted file has its own timestamp from the archive.
+        error = !tar_extract_finish(&extraction) || error;
+    } else {
+        _set_fattime(request);
+        f_close(&request->file);
+        override_fattime(0);
+    }
     #if CIRCUITPY_USB_MSC
     usb_msc_unlock();
     #endif
+    // The upload may have replaced settings.toml.
+    #if CIRCUITPY_OS_GETENV
+    os_getenv_cache_invalidate();
+    #endif
+    request->uploading = false;
+    request->extract = false;
+    upload_pending = 0;
 
-    override_fattime(0);
+    if (!reply) {
+        return;
+    }
     if (error) {
-        _discard_incoming(socket, request->content_length - total_read);
+        // The rest of the body may not all be discarded, so don't read another
+        // request after it.
+        request->keep_alive = false;
+        _discard_incoming(socket, request->content_length - request->body_read);
         _reply_server_error(socket, request);
-    } else if (new_file) {
+    } else if (request->new_file) {
         _reply_created(socket, request);
     } else {
         _reply_no_content(socket, request);
     }
 }
 
-#define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type;
+// Writes what has arrived of the body, up to a buffer full so that other
+// connections get a turn. Returns true once the upload is finished.
+static bool _continue_upload(socketpool_socket_obj_t *socket, _request *request) {
+    uint8_t small_buffer[256];
+    uint8_t *buffer = small_buffer;
+    size_t buffer_len = sizeof(small_buffer);
+    size_t used = 0;
+    if (transfer_allocation != NULL) {
+        buffer = (uint8_t *)transfer_allocation->ptr;
+        buffer_len = CIRCUITPY_WEB_WORKFLOW_TRANSFER_BUFFER;
+        used = upload_pending;
+    }
+
+    bool error = false;
+    while (used < buffer_len && request->body_read < request->content_length) {
+        size_t read_len = MIN(buffer_len - used, request->content_length - request->body_read);
+        int len = socketpool_socket_recv_into(socket, buffer + used, read_len);
+        if (len == -MP_EAGAIN) {
+            break;
+        }
+        if (len <= 0) {
+            error = true;
+            break;
+        }
+        request->body_read += len;
+        used += len;
+    }
+    bool complete = request->body_read == request->content_length;
+
+    // Write whole sectors, which FatFs programs straight from the buffer, and
+    // keep the rest for the next pass. The network stack keeps receiving
+    // meanwhile.
+    size_t write_len = used;
+    if (request->extract) {
+        // The extraction keeps back what it can't use yet, like a partial
+        // header.
+        error = error || !tar_extract_feed(&extraction, buffer, used, &write_len);
+        error = error || (complete && write_len < used);
+    } else if (!complete && buffer != small_buffer) {
+        write_len = used - used % FF_MIN_SS;
+    }
+    if (!request->extract && !error && write_len > 0) {
+        UINT actual;
+        f_write(&request->file, buffer, write_len, &actual);
+        error = actual < write_len;
+    }
+    if (buffer != small_buffer) {
+        memmove(buffer, buffer + write_len, used - write_len);
+        upload_pending = used - write_len;
+    }
+
+    if (!error && !complete) {
+        return false;
+    }
+    _finish_upload(socket, request, error, true);
+    return true;
+}
+
+#define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type; extern const char *filename##_etag;
 
 STATIC_FILE(code_html);
 STATIC_FILE(directory_html);
@@ -996,7 +1290,16 @@ STATIC_FILE(serial_html);
 STATIC_FILE(serial_js);
 STATIC_FILE(blinka_32x32_ico);
 
-static void _reply_static(socketpool_socket_obj_t *socket, _request *request, const uint8_t *response, size_t response_len, const char *content_type) {
+static void _reply_static(socketpool_socket_obj_t *socket, _request *request, const uint8_t *response, size_t response_len, const char *content_type, const char *etag) {
+    // The browser checks back each time, and gets a 304 until the firmware changes.
+    if (strstr(request->if_none_match, etag) != NULL) {
+        _send_strs(socket,
+            "HTTP/1.1 304 Not Modified\r\n",
+            "Cache-Control: no-cache\r\n",
+            "ETag: ", etag, "\r\n",
+            "\r\n", NULL);
+        return;
+    }
     uint32_t total_length = response_len;
     char encoded_len[10];
     snprintf(encoded_len, sizeof(encoded_len), "%" PRIu32, total_length);
@@ -1006,11 +1309,13 @@ static void _reply_static(socketpool_socket_obj_t *socket, _request *request, co
         "Content-Encoding: gzip\r\n",
         "Content-Length: ", encoded_len, "\r\n",
         "Content-Type: ", content_type, "\r\n",
+        "Cache-Control: no-cache\r\n",
+        "ETag: ", etag, "\r\n",
         "\r\n", NULL);
     web_workflow_send_raw(socket, response, response_len);
 }
 
-#define _REPLY_STATIC(socket, request, filename) _reply_static(socket, request, filename, filename##_length, filename##_content_type)
+#define _REPLY_STATIC(socket, request, filename) _reply_static(socket, request, filename, filename##_length, filename##_content_type, filename##_etag)
 
 static void _reply_websocket_upgrade(socketpool_socket_obj_t *socket, _request *request) {
     // Compute accept key
@@ -1067,6 +1372,22 @@ static void _decode_percents(char *str) {
     }
 }
 
+// True if the &-separated query has the given key=value.
+static bool _query_has(const char *query, const char *param) {
+    size_t param_len = strlen(param);
+    while (query != NULL) {
+        if (strncmp(query, param, param_len) == 0 &&
+            (query[param_len] == '\0' || query[param_len] == '&')) {
+            return true;
+        }
+        query = strchr(query, '&');
+        if (query != NULL) {
+            query++;
+        }
+    }
+    return false;
+}
+
 static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
     if (request->redirect) {
         #if CIRCUITPY_MDNS
@@ -1091,6 +1412,13 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                 _reply_forbidden(socket, request);
             }
         } else {
+            // Split off the query before decoding so that an encoded ? stays
+            // part of the path.
+            char *query = strchr(request->path, '?');
+            if (query != NULL) {
+                *query = '\0';
+                query++;
+            }
             // Decode any percent encoded bytes so that we're left with UTF-8.
             // We only do this on /fs/ paths and after redirect so that any
             // path echoing we do stays encoded.
@@ -1130,6 +1458,9 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                 #if CIRCUITPY_USB_MSC
                 usb_msc_unlock();
                 #endif
+                #if CIRCUITPY_OS_GETENV
+                os_getenv_cache_invalidate();
+                #endif
                 if (result == FR_NO_PATH || result == FR_NO_FILE) {
                     _reply_missing(socket, request);
                 } else if (result != FR_OK) {
@@ -1155,6 +1486,9 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                 #if CIRCUITPY_USB_MSC
                 usb_msc_unlock();
                 #endif
+                #if CIRCUITPY_OS_GETENV
+                os_getenv_cache_invalidate();
+                #endif
                 if (result == FR_EXIST) { // File exists and won't be overwritten.
                     _reply_precondition_failed(socket, request);
                 } else if (result == FR_NO_PATH || result == FR_NO_FILE) { // Missing higher directories or target file.
@@ -1166,7 +1500,9 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                     return true;
                 }
             } else if (directory) {
-                if (strcasecmp(request->method, "GET") == 0) {
+                if (strcasecmp(request->method, "GET") == 0 && _query_has(query, "archive=tar")) {
+                    _reply_with_archive(socket, request, fs, path);
+                } else if (strcasecmp(request->method, "GET") == 0) {
                     FF_DIR dir;
                     FRESULT res = f_opendir(fs, &dir, path);
                     // Put the / back for replies.
@@ -1186,6 +1522,9 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                     }
 
                     f_closedir(&dir);
+                } else if (strcasecmp(request->method, "PUT") == 0 && _query_has(query, "extract=tar")) {
+                    _start_extract(socket, request, fs, path);
+                    return true;
                 } else if (strcasecmp(request->method, "PUT") == 0) {
                     if (_usb_active()) {
                         _reply_conflict(socket, request);
@@ -1226,7 +1565,7 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
 
                     f_close(&active_file);
                 } else if (strcasecmp(request->method, "PUT") == 0) {
-                    _write_file_and_reply(socket, request, fs, path);
+                    _start_upload(socket, request, fs, path);
                     return true;
                 }
             }
@@ -1309,15 +1648,79 @@ static void _reset_request(_request *request) {
     request->redirect = false;
     request->done = false;
     request->in_progress = false;
-    request->new_socket = false;
     request->authenticated = false;
     request->expect = false;
     request->json = false;
     request->websocket = false;
+    request->uploading = false;
+    request->extract = false;
+    // HTTP/1.1 connections are persistent unless the client says otherwise.
+    request->keep_alive = true;
+    request->if_none_match[0] = '\0';
+    request->body_read = 0;
+}
+
+static void _end_request(_request *request) {
+    if (request->in_progress) {
+        requests_in_progress--;
+        if (requests_in_progress == 0) {
+            autoreload_resume(AUTORELOAD_SUSPEND_WEB);
+        }
+    }
+    _reset_request(request);
+}
+
+// Drop the connection, abandoning any request on it.
+static void _close_connection(socketpool_socket_obj_t *socket, _request *request) {
+    if (request->uploading) {
+        _finish_upload(socket, request, true, false);
+    }
+    _end_request(request);
+    common_hal_socketpool_socket_close(socket);
+}
+
+static bool _upload_in_progress(void) {
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+        if (connections[i].request.uploading) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Requests that may change the filesystem wait for an upload to finish, since
+// it holds the filesystem away from USB until then.
+static bool _must_wait(_request *request) {
+    return strcasecmp(request->method, "GET") != 0 &&
+           strcasecmp(request->method, "OPTIONS") != 0 &&
+           _upload_in_progress();
+}
+
+// After replying, wait for another request on the connection if the reply's end
+// is also the end of what the client sent. Otherwise close it.
+static void _finish_request(socketpool_socket_obj_t *socket, _request *request, bool reload) {
+    bool keep_alive = request->keep_alive && !request->redirect && !request->websocket &&
+        request->body_read == request->content_length;
+    _end_request(request);
+    if (keep_alive) {
+        request->idle_since_ms = supervisor_ticks_ms32();
+    } else {
+        common_hal_socketpool_socket_close(socket);
+    }
+    if (reload) {
+        autoreload_trigger();
+    }
 }
 
 static void _process_request(socketpool_socket_obj_t *socket, _request *request) {
-    bool more = true;
+    if (request->uploading) {
+        if (_continue_upload(socket, request)) {
+            // Uploads always reload, like other writes.
+            _finish_request(socket, request, true);
+        }
+        return;
+    }
+    bool more = !request->done;
     bool error = false;
     uint8_t c;
     // This code assumes header lines are terminated with \r\n
@@ -1328,15 +1731,16 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
             more = false;
             if (len == 0 || len == -MP_ENOTCONN) {
                 // Disconnect - clear 'in-progress'
-                _reset_request(request);
-                common_hal_socketpool_socket_close(socket);
+                _close_connection(socket, request);
             }
             break;
         }
         if (!request->in_progress) {
-            autoreload_suspend(AUTORELOAD_SUSPEND_WEB);
+            if (requests_in_progress == 0) {
+                autoreload_suspend(AUTORELOAD_SUSPEND_WEB);
+            }
+            requests_in_progress++;
             request->in_progress = true;
-            request->new_socket = false;
         }
         switch (request->state) {
             case STATE_METHOD: {
@@ -1433,6 +1837,11 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                         strcpy(request->websocket_key, request->header_value);
                     } else if (strcasecmp(request->header_key, "X-Destination") == 0) {
                         strcpy(request->destination, request->header_value);
+                    } else if (strcasecmp(request->header_key, "If-None-Match") == 0) {
+                        strncpy(request->if_none_match, request->header_value, sizeof(request->if_none_match) - 1);
+                        request->if_none_match[sizeof(request->if_none_match) - 1] = '\0';
+                    } else if (strcasecmp(request->header_key, "Connection") == 0) {
+                        request->keep_alive = strcasecmp(request->header_value, "close") != 0;
                     }
                 } else if (request->offset > sizeof(request->header_value) - 1) {
                     // Skip methods that are too long.
@@ -1455,64 +1864,89 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
         common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
         socketpool_socket_send(socket, (const uint8_t *)error_response, strlen(error_response));
     }
-    if (!request->done) {
+    if (!request->done || _must_wait(request)) {
         return;
     }
     bool reload = _reply(socket, request);
-    _reset_request(request);
-    common_hal_socketpool_socket_close(socket);
-    autoreload_resume(AUTORELOAD_SUSPEND_WEB);
-    if (reload) {
-        autoreload_trigger();
+    if (request->uploading) {
+        // The body is written over the following background passes.
+        return;
+    }
+    _finish_request(socket, request, reload);
+}
+
+// A connection that can take a newly accepted socket, or NULL. When all are
+// open, the one that has been idle longest is closed to make room.
+static _connection *_free_connection(void) {
+    _connection *idle = NULL;
+    uint32_t now = supervisor_ticks_ms32();
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+        _connection *connection = &connections[i];
+        if (common_hal_socketpool_socket_get_closed(&connection->socket)) {
+            return connection;
+        }
+        if (!connection->request.in_progress &&
+            (idle == NULL || now - connection->request.idle_since_ms > now - idle->request.idle_since_ms)) {
+            idle = connection;
+        }
+    }
+    if (idle != NULL) {
+        _close_connection(&idle->socket, &idle->request);
     }
+    return idle;
 }
 
 
 void supervisor_web_workflow_background(void *data) {
-    while (true) {
-        // If we have a request in progress, continue working on it. Do this first
-        // so that we can accept another socket after finishing this request.
-        if (common_hal_socketpool_socket_get_connected(&active)) {
-            _process_request(&active, &active_request);
-            if (active_request.in_progress) {
-                break;
-            }
-        } else {
-            // Close the active socket if necessary
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
+    SUPERVISOR_TRACE_BEGIN(SUPERVISOR_TRACE_WEB_WORKFLOW_BACKGROUND, NULL);
+    // Work on each connection in turn, starting from a different one each time
+    // so that none is always last.
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+        _connection *connection = &connections[(next_connection + i) % CIRCUITPY_WEB_WORKFLOW_CONNECTIONS];
+        if (common_hal_socketpool_socket_get_connected(&connection->socket)) {
+            if (!connection->request.in_progress &&
+                supervisor_ticks_ms32() - connection->request.idle_since_ms > WEB_WORKFLOW_IDLE_TIMEOUT_MS) {
+                _close_connection(&connection->socket, &connection->request);
+            } else {
+                _process_request(&connection->socket, &connection->request);
             }
+        } else if (!common_hal_socketpool_socket_get_closed(&connection->socket)) {
+            // Close the socket if necessary
+            _close_connection(&connection->socket, &connection->request);
         }
-        // Otherwise, see if we have another socket to accept.
-        if ((!common_hal_socketpool_socket_get_connected(&active) ||
-             (!active_request.in_progress && !active_request.new_socket)) &&
-            !common_hal_socketpool_socket_get_closed(&listening)) {
+    }
+    next_connection = (next_connection + 1) % CIRCUITPY_WEB_WORKFLOW_CONNECTIONS;
+
+    // See if we have other sockets to accept.
+    while (!common_hal_socketpool_socket_get_closed(&listening)) {
+        if (common_hal_socketpool_socket_get_closed(&incoming)) {
             uint32_t ip;
             uint32_t port;
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
-            }
-            int newsoc = socketpool_socket_accept(&listening, (uint8_t *)&ip, &port, &active);
+            int newsoc = socketpool_socket_accept(&listening, (uint8_t *)&ip, &port, &incoming);
             if (newsoc == -EBADF) {
                 common_hal_socketpool_socket_close(&listening);
                 break;
             }
-            if (newsoc > 0) {
-                common_hal_socketpool_socket_settimeout(&active, 0);
-                _reset_request(&active_request);
-                // Mark new sockets, otherwise we may accept another before the first
-                // could start its request.
-                active_request.new_socket = true;
-                continue;
+            if (newsoc <= 0) {
+                break;
             }
+            common_hal_socketpool_socket_settimeout(&incoming, 0);
+        }
+        // Leave the socket in incoming until a connection is free.
+        _connection *connection = _free_connection();
+        if (connection == NULL) {
             break;
         }
-        websocket_background();
-        break;
+        socketpool_socket_move(&incoming, &connection->socket);
+        _reset_request(&connection->request);
+        connection->request.idle_since_ms = supervisor_ticks_ms32();
+        _process_request(&connection->socket, &connection->request);
     }
+    websocket_background();
     // Resume polling
     socketpool_socket_poll_resume();
 
+    SUPERVISOR_TRACE_END(SUPERVISOR_TRACE_WEB_WORKFLOW_BACKGROUND);
     return;
 }
 
@@ -39,6 +39,8 @@
 typedef struct {
     socketpool_socket_obj_t socket;
     uint8_t opcode;
+    // The opcode of the message that continuation frames belong to.
+    uint8_t message_opcode;
     uint8_t frame_len;
     uint8_t payload_len_size;
     bool masked;
@@ -47,10 +49,20 @@ typedef struct {
     size_t payload_remaining;
 } _websocket;
 
+#define OPCODE_CONTINUATION 0x0
+#define OPCODE_TEXT 0x1
+#define OPCODE_BINARY 0x2
+#define OPCODE_CLOSE 0x8
+#define OPCODE_PING 0x9
+#define OPCODE_PONG 0xA
+
 // Buffer the incoming serial data in the background so that we can look for the
 // interrupt character.
 STATIC ringbuf_t _incoming_ringbuf;
 STATIC uint8_t _buf[16];
+// Binary frames carry data for code.py rather than the console.
+STATIC ringbuf_t _data_ringbuf;
+STATIC uint8_t _data_buf[CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_DATA_BUFFER];
 // make sure background is not called recursively
 STATIC bool in_web_background = false;
 
@@ -60,6 +72,7 @@ void websocket_init(void) {
     socketpool_socket_reset(&cp_serial.socket);
 
     ringbuf_init(&_incoming_ringbuf, _buf, sizeof(_buf) - 1);
+    ringbuf_init(&_data_ringbuf, _data_buf, sizeof(_data_buf));
 }
 
 void websocket_handoff(socketpool_socket_obj_t *socket) {
@@ -69,8 +82,10 @@ void websocket_handoff(socketpool_socket_obj_t *socket) {
 
     socketpool_socket_move(socket, &cp_serial.socket);
     cp_serial.opcode = 0;
+    cp_serial.message_opcode = 0;
     cp_serial.frame_index = 0;
     cp_serial.frame_len = 2;
+    ringbuf_clear(&_data_ringbuf);
 
     #if CIRCUITPY_STATUS_BAR
     // Send the title bar for the new client.
@@ -92,11 +107,57 @@ static bool _read_byte(uint8_t *c) {
     return true;
 }
 
+// Unmasks payload bytes that start offset bytes into the payload. The middle is
+// done a word at a time.
+static void _unmask(uint8_t *buf, size_t len, size_t offset) {
+    if (!cp_serial.masked) {
+        return;
+    }
+    size_t i = 0;
+    while (i < len && (offset + i) % 4 != 0) {
+        buf[i] ^= cp_serial.mask[(offset + i) % 4];
+        i++;
+    }
+    uint32_t mask;
+    memcpy(&mask, cp_serial.mask, sizeof(mask));
+    for (; i + 4 <= len; i += 4) {
+        uint32_t word;
+        memcpy(&word, buf + i, sizeof(word));
+        word ^= mask;
+        memcpy(buf + i, &word, sizeof(word));
+    }
+    for (; i < len; i++) {
+        buf[i] ^= cp_serial.mask[(offset + i) % 4];
+    }
+}
+
+// Reads up to len bytes of the current frame's payload.
+static size_t _read_payload(uint8_t *buf, size_t len) {
+    len = MIN(len, cp_serial.payload_remaining);
+    if (len == 0) {
+        return 0;
+    }
+    int read = socketpool_socket_recv_into(&cp_serial.socket, buf, len);
+    if (read < 1) {
+        return 0;
+    }
+    _unmask(buf, read, cp_serial.frame_index - cp_serial.frame_len);
+    cp_serial.frame_index += read;
+    cp_serial.payload_remaining -= read;
+    if (cp_serial.payload_remaining == 0) {
+        cp_serial.frame_index = 0;
+    }
+    return read;
+}
+
 static void _read_next_frame_header(void) {
     uint8_t h;
     if (cp_serial.frame_index == 0 && _read_byte(&h)) {
         cp_serial.frame_index++;
         cp_serial.opcode = h & 0xf;
+        if (cp_serial.opcode == OPCODE_TEXT || cp_serial.opcode == OPCODE_BINARY) {
+            cp_serial.message_opcode = cp_serial.opcode;
+        }
     }
     if (cp_serial.frame_index == 1 && _read_byte(&h)) {
         cp_serial.frame_index++;
@@ -106,8 +167,10 @@ static void _read_next_frame_header(void) {
             cp_serial.payload_remaining = len;
             cp_serial.payload_len_size = 0;
         } else if (len == 126) { // 16 bit length
+            cp_serial.payload_remaining = 0;
             cp_serial.payload_len_size = 2;
         } else if (len == 127) { // 64 bit length
+            cp_serial.payload_remaining = 0;
             cp_serial.payload_len_size = 8;
         }
         cp_serial.frame_len = 2 + cp_serial.payload_len_size;
@@ -129,15 +192,18 @@ static void _read_next_frame_header(void) {
         cp_serial.mask[mask_offset] = h;
         cp_serial.frame_index++;
     }
+    if (cp_serial.frame_index < cp_serial.frame_len) {
+        return;
+    }
     // Reply to PINGs and CLOSE.
-    while ((cp_serial.opcode == 0x8 ||
-            cp_serial.opcode == 0x9) &&
+    while ((cp_serial.opcode == OPCODE_CLOSE ||
+            cp_serial.opcode == OPCODE_PING) &&
            cp_serial.frame_index >= cp_serial.frame_len) {
 
         if (cp_serial.frame_index == cp_serial.frame_len) {
-            uint8_t opcode = 0x8; // CLOSE
-            if (cp_serial.opcode == 0x9) {
-                opcode = 0xA; // PONG
+            uint8_t opcode = OPCODE_CLOSE;
+            if (cp_serial.opcode == OPCODE_PING) {
+                opcode = OPCODE_PONG;
             } else {
                 // Set the TCP socket to send immediately so that we send the payload back before
                 // closing the connection.
@@ -150,39 +216,42 @@ static void _read_next_frame_header(void) {
             web_workflow_send_raw(&cp_serial.socket, (const uint8_t *)frame_header, 2);
         }
 
-        if (cp_serial.payload_remaining > 0 && _read_byte(&h)) {
+        bool close = cp_serial.opcode == OPCODE_CLOSE;
+        if (cp_serial.payload_remaining > 0) {
             // Send the payload back to the client.
-            cp_serial.frame_index++;
-            cp_serial.payload_remaining--;
-            web_workflow_send_raw(&cp_serial.socket, &h, 1);
+            uint8_t payload[16];
+            size_t len = _read_payload(payload, sizeof(payload));
+            if (len == 0) {
+                break;
+            }
+            web_workflow_send_raw(&cp_serial.socket, payload, len);
+        } else {
+            cp_serial.frame_index = 0;
         }
 
-        if (cp_serial.payload_remaining == 0) {
-            cp_serial.frame_index = 0;
-            if (cp_serial.opcode == 0x8) {
-                common_hal_socketpool_socket_close(&cp_serial.socket);
-            }
+        if (cp_serial.frame_index == 0 && close) {
+            common_hal_socketpool_socket_close(&cp_serial.socket);
         }
     }
+    if (cp_serial.frame_index >= cp_serial.frame_len && cp_serial.payload_remaining == 0) {
+        // An empty frame.
+        cp_serial.frame_index = 0;
+    }
 }
 
-static bool _read_next_payload_byte(uint8_t *c) {
-    _read_next_frame_header();
-    if (cp_serial.opcode == 0x1 &&
-        cp_serial.frame_index >= cp_serial.frame_len &&
-        cp_serial.payload_remaining > 0) {
-        if (_read_byte(c)) {
-            uint8_t mask_offset = (cp_serial.frame_index - cp_serial.frame_len) % 4;
-            *c ^= cp_serial.mask[mask_offset];
-            cp_serial.frame_index++;
-            cp_serial.payload_remaining--;
-            if (cp_serial.payload_remaining == 0) {
-                cp_serial.frame_index = 0;
-            }
-            return true;
-        }
+// The ring buffer the current frame's payload goes to, or NULL if it is to be
+// dropped.
+static ringbuf_t *_payload_destination(void) {
+    uint8_t opcode = cp_serial.opcode;
+    if (opcode == OPCODE_CONTINUATION) {
+        opcode = cp_serial.message_opcode;
     }
-    return false;
+    if (opcode == OPCODE_TEXT) {
+        return &_incoming_ringbuf;
+    } else if (opcode == OPCODE_BINARY) {
+        return &_data_ringbuf;
+    }
+    return NULL;
 }
 
 bool websocket_available(void) {
@@ -201,11 +270,26 @@ char websocket_read_char(void) {
     return -1;
 }
 
-static void _websocket_send(_websocket *ws, const char *text, size_t len) {
+size_t websocket_data_available(void) {
+    if (websocket_connected()) {
+        websocket_background();
+    }
+    return ringbuf_num_filled(&_data_ringbuf);
+}
+
+size_t websocket_data_read(uint8_t *buf, size_t len) {
+    websocket_background();
+    return ringbuf_get_n(&_data_ringbuf, buf, len);
+}
+
+void websocket_data_clear(void) {
+    ringbuf_clear(&_data_ringbuf);
+}
+
+static void _websocket_send(_websocket *ws, uint8_t opcode, const uint8_t *data, size_t len) {
     if (!websocket_connected()) {
         return;
     }
-    uint32_t opcode = 1;
     uint8_t frame_header[2];
     frame_header[0] = 1 << 7 | opcode;
     uint8_t payload_len;
@@ -233,11 +317,15 @@ static void _websocket_send(_websocket *ws, const char *text, size_t len) {
         extended_len[3] = len & 0xff;
         web_workflow_send_raw(&ws->socket, extended_len, 4);
     }
-    web_workflow_send_raw(&ws->socket, (const uint8_t *)text, len);
+    web_workflow_send_raw(&ws->socket, data, len);
+}
+
+void websocket_data_write(const uint8_t *data, size_t len) {
+    _websocket_send(&cp_serial, OPCODE_BINARY, data, len);
 }
 
 void websocket_write(const char *text, size_t len) {
-    _websocket_send(&cp_serial, text, len);
+    _websocket_send(&cp_serial, OPCODE_TEXT, (const uint8_t *)text, len);
 }
 
 void websocket_background(void) {
@@ -248,14 +336,40 @@ void websocket_background(void) {
         return;
     }
     in_web_background = true;
-    uint8_t c;
-    while (ringbuf_num_empty(&_incoming_ringbuf) > 0 &&
-           _read_next_payload_byte(&c)) {
-        if (c == mp_interrupt_char) {
-            mp_sched_keyboard_interrupt();
-            continue;
+    while (true) {
+        bool control = cp_serial.opcode == OPCODE_PING || cp_serial.opcode == OPCODE_CLOSE;
+        if (cp_serial.frame_index < cp_serial.frame_len || control) {
+            // Control frames are answered while reading their header.
+            _read_next_frame_header();
+            control = cp_serial.opcode == OPCODE_PING || cp_serial.opcode == OPCODE_CLOSE;
+            if (cp_serial.frame_index < cp_serial.frame_len || control) {
+                break;
+            }
+        }
+        ringbuf_t *destination = _payload_destination();
+        uint8_t chunk[32];
+        size_t len = sizeof(chunk);
+        if (destination != NULL) {
+            len = MIN(len, ringbuf_num_empty(destination));
+            if (len == 0) {
+                break;
+            }
+        }
+        len = _read_payload(chunk, len);
+        if (len == 0) {
+            break;
+        }
+        if (destination == &_incoming_ringbuf) {
+            for (size_t i = 0; i < len; i++) {
+                if (chunk[i] == mp_interrupt_char) {
+                    mp_sched_keyboard_interrupt();
+                    continue;
+                }
+                ringbuf_put(destination, chunk[i]);
+            }
+        } else if (destination != NULL) {
+            ringbuf_put_n(destination, chunk, len);
         }
-        ringbuf_put(&_incoming_ringbuf, c);
     }
     in_web_background = false;
 }
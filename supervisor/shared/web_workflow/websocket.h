@@ -27,6 +27,8 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "shared-bindings/socketpool/Socket.h"
 
@@ -37,3 +39,9 @@ bool websocket_available(void);
 char websocket_read_char(void);
 void websocket_background(void);
 void websocket_write(const char *text, size_t len);
+
+// Binary frames are a data channel separate from the console.
+size_t websocket_data_available(void);
+size_t websocket_data_read(uint8_t *buf, size_t len);
+void websocket_data_write(const uint8_t *data, size_t len);
+void websocket_data_clear(void);
@@ -48,9 +48,51 @@
 static background_callback_t workflow_background_cb = {NULL, NULL};
 #endif
 
+#if CIRCUITPY_OS_GETENV
+#include "shared-module/os/__init__.h"
+#endif
+
+#include "shared-bindings/microcontroller/Processor.h"
+
+#if CIRCUITPY_BLEIO || CIRCUITPY_WEB_WORKFLOW
+// Set when a fast wake skipped starting the BLE and web workflows. They start
+// once code.py finishes without going into deep sleep.
+static bool workflows_deferred = false;
+#endif
+
+#if CIRCUITPY_WEB_WORKFLOW
+STATIC bool start_web_workflow(void) {
+    if (!supervisor_start_web_workflow()) {
+        return false;
+    }
+    // Enable background callbacks if web_workflow startup successful
+    memset(&workflow_background_cb, 0, sizeof(workflow_background_cb));
+    workflow_background_cb.fun = supervisor_web_workflow_background;
+    return true;
+}
+#endif
+
+// CIRCUITPY_FAST_WAKE in settings.toml forces fast wakes on (1) or off (0).
+// Otherwise they are used when waking from a deep sleep alarm.
+bool supervisor_workflow_fast_wake(void) {
+    #if CIRCUITPY_OS_GETENV
+    mp_int_t fast_wake;
+    if (common_hal_os_getenv_int("CIRCUITPY_FAST_WAKE", &fast_wake) == GETENV_OK) {
+        return fast_wake != 0;
+    }
+    #endif
+    return common_hal_mcu_processor_get_reset_reason() == RESET_REASON_DEEP_SLEEP_ALARM;
+}
+
 
 // Called during a VM reset. Doesn't actually reset things.
 void supervisor_workflow_reset(void) {
+    #if CIRCUITPY_BLEIO || CIRCUITPY_WEB_WORKFLOW
+    if (workflows_deferred) {
+        return;
+    }
+    #endif
+
     #if CIRCUITPY_BLEIO
     supervisor_start_bluetooth();
     #endif
@@ -64,6 +106,25 @@ void supervisor_workflow_reset(void) {
     #endif
 }
 
+void supervisor_workflow_start_deferred(void) {
+    #if CIRCUITPY_BLEIO || CIRCUITPY_WEB_WORKFLOW
+    if (!workflows_deferred) {
+        return;
+    }
+    workflows_deferred = false;
+
+    #if CIRCUITPY_BLEIO
+    supervisor_start_bluetooth();
+    #endif
+
+    #if CIRCUITPY_WEB_WORKFLOW
+    if (start_web_workflow()) {
+        supervisor_workflow_request_background();
+    }
+    #endif
+    #endif
+}
+
 void supervisor_workflow_request_background(void) {
     #if CIRCUITPY_WEB_WORKFLOW
     if (workflow_background_cb.fun) {
@@ -98,20 +159,25 @@ void supervisor_workflow_start(void) {
     // Set up any other serial connection.
     serial_init();
 
+    #if CIRCUITPY_BLEIO || CIRCUITPY_WEB_WORKFLOW
+    // Connecting Wi-Fi and starting BLE advertising can take seconds, which a
+    // device that wakes briefly from deep sleep pays on every wake.
+    workflows_deferred = supervisor_workflow_fast_wake();
+    #endif
+
     #if CIRCUITPY_BLEIO
     bleio_reset();
     supervisor_bluetooth_enable_workflow();
-    supervisor_start_bluetooth();
+    if (!workflows_deferred) {
+        supervisor_start_bluetooth();
+    }
     #endif
 
     #if CIRCUITPY_WEB_WORKFLOW
-    if (supervisor_start_web_workflow()) {
-        // Enable background callbacks if web_workflow startup successful
-        memset(&workflow_background_cb, 0, sizeof(workflow_background_cb));
-        workflow_background_cb.fun = supervisor_web_workflow_background;
+    if (!workflows_deferred) {
+        (void)start_web_workflow();
     }
     #endif
-
 }
 
 FRESULT supervisor_workflow_mkdir_parents(FATFS *fs, char *path) {
@@ -30,6 +30,10 @@
 
 extern bool supervisor_workflow_connecting(void);
 
+// True when startup should skip slow work, such as starting the BLE and web
+// workflows before code.py runs.
+extern bool supervisor_workflow_fast_wake(void);
+
 // File system helpers for workflow code.
 FRESULT supervisor_workflow_mkdir_parents(FATFS *fs, char *path);
 FRESULT supervisor_workflow_delete_directory_contents(FATFS *fs, const TCHAR *path);
@@ -56,6 +56,11 @@ CFLAGS += -DQSPI_FLASH_FILESYSTEM=$(QSPI_FLASH_FILESYSTEM)
 SPI_FLASH_FILESYSTEM ?= 0
 CFLAGS += -DSPI_FLASH_FILESYSTEM=$(SPI_FLASH_FILESYSTEM)
 
+# Map filesystem blocks on external flash through a wear leveling, log
+# structured translation layer. Changing this reformats CIRCUITPY.
+CIRCUITPY_FLASH_FTL ?= 0
+CFLAGS += -DCIRCUITPY_FLASH_FTL=$(CIRCUITPY_FLASH_FTL)
+
 DISABLE_FILESYSTEM ?= 0
 CFLAGS += -DDISABLE_FILESYSTEM=$(DISABLE_FILESYSTEM)
 
@@ -78,6 +83,9 @@ else
   CFLAGS += -DEXTERNAL_FLASH_DEVICES=$(EXTERNAL_FLASH_DEVICES) \
 
   SRC_SUPERVISOR += supervisor/shared/external_flash/external_flash.c
+  ifeq ($(CIRCUITPY_FLASH_FTL),1)
+    SRC_SUPERVISOR += supervisor/shared/flash_ftl.c
+  endif
   ifeq ($(SPI_FLASH_FILESYSTEM),1)
     SRC_SUPERVISOR += supervisor/shared/external_flash/spi_flash.c
   endif
@@ -104,6 +112,24 @@ ifeq ($(CIRCUITPY_STATUS_BAR),1)
 
 endif
 
+ifeq ($(CIRCUITPY_PROFILE),1)
+  SRC_SUPERVISOR += \
+    supervisor/shared/profile.c \
+
+endif
+
+ifeq ($(CIRCUITPY_TRACE),1)
+  SRC_SUPERVISOR += \
+    supervisor/shared/trace.c \
+
+endif
+
+ifneq ($(filter 1,$(CIRCUITPY_TRACE) $(CIRCUITPY_BENCHMARK)),)
+  SRC_SUPERVISOR += \
+    supervisor/shared/cycle_count.c \
+
+endif
+
 ifeq ($(CIRCUITPY_USB),1)
   SRC_SUPERVISOR += \
     lib/tinyusb/src/class/cdc/cdc_device.c \
@@ -161,10 +187,18 @@ ifeq ($(CIRCUITPY_USB),1)
 
   ifeq ($(CIRCUITPY_USB_HOST), 1)
     SRC_SUPERVISOR += \
+      lib/tinyusb/src/class/msc/msc_host.c \
       lib/tinyusb/src/host/hub.c \
       lib/tinyusb/src/host/usbh.c \
 
   endif
+
+  ifeq ($(CIRCUITPY_USB_KEYBOARD_WORKFLOW), 1)
+    SRC_SUPERVISOR += \
+      lib/tinyusb/src/class/hid/hid_host.c \
+      supervisor/shared/usb/host_keyboard.c \
+
+  endif
 endif
 
 STATIC_RESOURCES = $(wildcard $(TOP)/supervisor/shared/web_workflow/static/*)
@@ -176,7 +210,8 @@ $(BUILD)/autogen_web_workflow_static.c: ../../tools/gen_web_workflow_static.py $
 		$(STATIC_RESOURCES)
 
 ifeq ($(CIRCUITPY_WEB_WORKFLOW),1)
-  SRC_SUPERVISOR += supervisor/shared/web_workflow/web_workflow.c \
+  SRC_SUPERVISOR += supervisor/shared/web_workflow/tar.c \
+                    supervisor/shared/web_workflow/web_workflow.c \
                     supervisor/shared/web_workflow/websocket.c
   SRC_SUPERVISOR += $(BUILD)/autogen_web_workflow_static.c
 endif
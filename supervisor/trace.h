@@ -0,0 +1,66 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/mpprint.h"
+#include "supervisor/cycle_count.h"
+
+// A ring buffer of timestamped begin and end events for the supervisor's
+// background work, enabled with CIRCUITPY_TRACE. Timestamps come from the
+// port's cycle counter. supervisor_trace_dump() writes the buffer in Chrome
+// trace event format, which chrome://tracing and Perfetto can display.
+
+typedef enum {
+    SUPERVISOR_TRACE_BACKGROUND_CALLBACK, // arg is the callback function
+    SUPERVISOR_TRACE_PORT_BACKGROUND_TASK,
+    SUPERVISOR_TRACE_USB_BACKGROUND,
+    SUPERVISOR_TRACE_WEB_WORKFLOW_BACKGROUND,
+    // Time between two checks for background tasks, recorded only when it is
+    // longer than CIRCUITPY_TRACE_VM_GAP_US.
+    SUPERVISOR_TRACE_VM_GAP,
+    SUPERVISOR_TRACE_NUM_EVENTS,
+} supervisor_trace_event_t;
+
+#if CIRCUITPY_TRACE
+void supervisor_trace_begin(supervisor_trace_event_t event, const void *arg);
+void supervisor_trace_end(supervisor_trace_event_t event);
+// Call each time the VM checks for background tasks.
+void supervisor_trace_background_check(void);
+// Write the buffered events as JSON. Recording pauses while this runs.
+void supervisor_trace_dump(const mp_print_t *print, bool reset);
+
+#define SUPERVISOR_TRACE_BEGIN(event, arg) supervisor_trace_begin(event, arg)
+#define SUPERVISOR_TRACE_END(event) supervisor_trace_end(event)
+#define SUPERVISOR_TRACE_BACKGROUND_CHECK() supervisor_trace_background_check()
+#else
+#define SUPERVISOR_TRACE_BEGIN(event, arg) ((void)0)
+#define SUPERVISOR_TRACE_END(event) ((void)0)
+#define SUPERVISOR_TRACE_BACKGROUND_CHECK() ((void)0)
+#endif
@@ -89,6 +89,8 @@ void usb_setup_with_vm(void);
 void usb_msc_mount(void);
 void usb_msc_umount(void);
 bool usb_msc_ejected(void);
+// Write any blocks the host has written that are still queued to the disk.
+void usb_msc_flush(void);
 
 // Locking MSC prevents presenting the drive on plug-in when in use by something
 // else (likely BLE.)
@@ -27,6 +27,8 @@
 #pragma once
 
 void supervisor_workflow_reset(void);
+// Start workflows that a fast wake left off.
+void supervisor_workflow_start_deferred(void);
 
 // True when the user could be actively iterating on their code.
 bool supervisor_workflow_active(void);
@@ -0,0 +1,37 @@
+# test exec of top-level function and class definitions, which a compiler
+# may compile while the rest of the source is still being parsed
+
+try:
+    exec
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+exec("""
+x = 1
+def deco(f):
+    return f
+@deco
+def f(a, b=2, *c, d=4, **e):
+    global x
+    x = a + b + d
+    return (a, b, c, d, e)
+class C:
+    y = [i for i in range(3)]
+    def m(self):
+        return self.y
+    class D:
+        def g(self):
+            return lambda: x
+def gen():
+    yield from range(3)
+print(f(1), f(1, 3, 5, d=6, z=7), x)
+print(C().m(), C.D().g()(), list(gen()))
+""")
+
+# errors in a later definition are reported once the earlier ones are compiled
+for src in ("def ok():\n pass\ndef bad():\n break\n", "def ok():\n pass\ndef bad(:\n pass\n"):
+    try:
+        exec(src)
+    except SyntaxError:
+        print("SyntaxError")
@@ -0,0 +1,50 @@
+# test slicing of bytes objects long enough to share their parent's data
+
+import gc
+
+b = bytes(range(256)) * 2
+
+# slices behave like copies
+s = b[10:200]
+print(len(s), s[0], s[-1], s == bytes(range(10, 200)))
+print(s[5:100] == bytes(range(15, 110)))
+print(hash(s) == hash(bytes(range(10, 200))))
+print({s: 1}[bytes(range(10, 200))])
+print(s + b"!" == bytes(range(10, 200)) + b"!")
+print(b"\x20" in s, b"\x00" in s)
+
+# a slice outlives its parent
+del b
+gc.collect()
+print(s[1:3])
+
+# a slice of a slice
+t = s[20:150]
+del s
+gc.collect()
+print(len(t), t[0], t[-1])
+
+# conversion to str
+u = (b"abcd" * 40)[2:120]
+print(str(u, "utf-8") == "cdab" * 29 + "cd")
+
+# functions that need a null-terminated string see just the slice
+fmt = (b"B" * 200)[10:90]
+print(fmt.count(b"B"))
+try:
+    import struct
+except ImportError:
+    struct = None
+if struct:
+    print(struct.calcsize(fmt))
+else:
+    print(80)
+
+# bytearray is still copied on slicing and grows as it's extended
+a = bytearray(b"x" * 100)
+c = a[10:90]
+a[20] = 0
+print(c[10])
+for i in range(50):
+    a.extend(b"yz")
+print(len(a), a[-4:])
@@ -0,0 +1,76 @@
+# test that repeated attribute and method loads see changes to classes and instances
+
+
+class A:
+    x = 1
+
+    def f(self):
+        return "A.f"
+
+
+class B(A):
+    pass
+
+
+def load(objs):
+    # the same bytecode loads from each object in turn
+    return [(o.x, o.f()) for o in objs]
+
+
+a = A()
+b = B()
+for i in range(3):
+    print(load([a, b]))
+
+# replace a method and an attribute on the base class
+A.f = lambda self: "new A.f"
+A.x = 2
+print(load([a, b]))
+
+# override in the subclass
+B.f = lambda self: "B.f"
+print(load([a, b]))
+
+# an instance attribute hides the class one
+b.x = 3
+b.f = lambda: "instance f"
+print(load([a, b]))
+del b.x
+del b.f
+print(load([a, b]))
+
+# delete the override again
+del B.f
+print(load([a, b]))
+
+
+# bound method identity and staticmethod/classmethod
+class C:
+    @staticmethod
+    def s():
+        return "static"
+
+    @classmethod
+    def c(cls):
+        return cls.__name__
+
+
+class D(C):
+    pass
+
+
+for o in (C(), D(), C(), D()):
+    print(o.s(), o.c())
+
+# native types share the call site with instances of classes
+for o in ([1], "ab", [2, 3], "cd"):
+    print(o.count(o[0]))
+
+
+class L(list):
+    pass
+
+
+for o in ([1], L([1, 1])):
+    o.append(1)
+    print(o, o.count(1))
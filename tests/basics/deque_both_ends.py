@@ -0,0 +1,48 @@
+# appendleft, pop and indexing of a deque
+try:
+    try:
+        from ucollections import deque
+    except ImportError:
+        from collections import deque
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+d = deque((), 3)
+try:
+    d.pop()
+except IndexError:
+    print("IndexError")
+
+d.append(1)
+d.append(2)
+d.appendleft(0)
+print(len(d), d[0], d[1], d[2], d[-1])
+
+# a full deque drops the opposite end
+d.appendleft(-1)
+print(len(d), d[0], d[-1])
+d.append(3)
+print(len(d), d[0], d[-1])
+
+d[1] = 10
+d[-1] = 30
+print(d[0], d[1], d[2])
+
+try:
+    d[3]
+except IndexError:
+    print("IndexError")
+try:
+    d[-4] = 0
+except IndexError:
+    print("IndexError")
+
+print(d.pop(), d.pop(), d.popleft())
+print(len(d))
+
+# wrap around the end of the storage in both directions
+for i in range(10):
+    d.appendleft(i)
+    d.append(-i)
+print(d.pop(), d.popleft(), d.pop())
@@ -0,0 +1,53 @@
+# test that for-loops over range use a redefined range
+
+
+def myrange(*args):
+    print("myrange", args)
+    return [10, 20]
+
+
+def f1(range):
+    for i in range(3):
+        print("f1", i)
+
+
+f1(myrange)
+
+
+def outer(range):
+    def inner():
+        for i in range(3):
+            print("inner", i)
+
+    inner()
+
+
+outer(myrange)
+
+
+def f2():
+    range = myrange
+    for i in range(3):
+        print("f2", i)
+
+
+f2()
+
+
+# a loop before the module-level assignment, run after it
+def f3():
+    for i in range(2):
+        print("f3", i)
+
+
+range = myrange
+for i in range(3):
+    print("module", i)
+f3()
+del range
+
+# builtin range again, with a negative step and an else clause
+for i in range(3, 0, -1):
+    print("builtin", i)
+else:
+    print("else", i)
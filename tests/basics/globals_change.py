@@ -0,0 +1,65 @@
+# test that repeated global and name loads see changes to globals and builtins
+
+
+def load():
+    # the same bytecode loads each name in turn
+    return [x, len("abc")]
+
+
+x = 1
+for i in range(3):
+    print(load())
+
+# rebind an existing global
+x = 2
+print(load())
+
+# a global hides a builtin, then goes away again
+len = lambda s: "global len"
+print(load())
+del len
+print(load())
+
+# delete and recreate a global
+del x
+try:
+    load()
+except NameError:
+    print("NameError")
+x = 3
+print(load())
+
+# add many globals so that the dict is rehashed
+for i in range(50):
+    globals()["g%d" % i] = i
+x = 4
+print(load(), g49)
+
+# changes made through the globals dict
+globals()["x"] = 5
+print(load())
+globals().pop("x")
+try:
+    load()
+except NameError:
+    print("NameError")
+globals()["x"] = 6
+print(load())
+
+# code run with another globals dict
+d = {"x": 7}
+for i in range(3):
+    exec("print(x)", d)
+d["x"] = 8
+exec("print(x)", d)
+del d["x"]
+try:
+    exec("print(x)", d)
+except NameError:
+    print("NameError")
+
+# module level loops
+y = 0
+for i in range(5):
+    y = y + i
+print(y)
@@ -0,0 +1,41 @@
+# test binary operations on small ints, including ones that overflow or raise
+
+# values around the small int and machine word limits
+vals = [0, 1, -1, 2, -3, 7, 100, -100, 0x3FFF, -0x4000, 0x3FFFFFFF, -0x40000000]
+
+for a in vals:
+    print(a, a + 1, a - 1, a * 3, a * a, a // 7, a % 7, a**2, a & 0xFF, a | 1, a ^ -1)
+    print(a < 1, a > 1, a <= -1, a >= 0, a == 100, a != 100)
+    print(a << 1, a << 30, a >> 1, a >> 100, a // -3, a % -3)
+
+# in-place versions
+x = 5
+x += 10
+x -= 3
+x *= 1000000
+x //= 7
+x %= 100000
+x **= 2
+x <<= 20
+x >>= 3
+x &= 0xFFFFFF
+x |= 1
+x ^= 0x55
+print(x)
+
+# results that must fall back to the general case
+print(0x3FFFFFFF + 0x3FFFFFFF, -0x40000000 - 0x40000000, 0x40000 * 0x40000)
+print(2**62, (-2) ** 63, 3**40, 1 << 62, 1 << 100)
+print(7 / 2, divmod(-7, 2), 2**-1)
+
+for op in (
+    lambda: 1 // 0,
+    lambda: 1 % 0,
+    lambda: 1 / 0,
+    lambda: 1 << -1,
+    lambda: 1 >> -1,
+):
+    try:
+        op()
+    except (ZeroDivisionError, ValueError) as e:
+        print(type(e).__name__)
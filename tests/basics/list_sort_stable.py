@@ -0,0 +1,77 @@
+# test that list.sort() and sorted() are stable, and handle runs and keys
+
+# pseudo-random numbers, so the test does not need the random module
+def lcg(n, seed=1):
+    out = []
+    for i in range(n):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        out.append(seed >> 8)
+    return out
+
+# equal keys keep their order, also with reverse=True
+l = [(x % 7, i) for i, x in enumerate(lcg(500))]
+s = sorted(l, key=lambda t: t[0])
+print(all(s[i] <= s[i + 1] for i in range(len(s) - 1)))
+s = sorted(l, key=lambda t: t[0], reverse=True)
+print(all(s[i][0] > s[i + 1][0] or s[i][1] < s[i + 1][1] for i in range(len(s) - 1)))
+
+# ascending, descending and sawtooth data, and runs of equal elements
+for l in (
+    list(range(300)),
+    list(range(300, 0, -1)),
+    [i % 37 for i in range(300)],
+    [i // 50 for i in range(300)],
+    [3] * 100,
+    lcg(1000),
+    lcg(300) + list(range(300)) + list(range(300, 0, -1)),
+):
+    ref = l[:]
+    # a simple stable sort to check against
+    for i in range(1, len(ref)):
+        v = ref[i]
+        j = i
+        while j > 0 and v < ref[j - 1]:
+            ref[j] = ref[j - 1]
+            j -= 1
+        ref[j] = v
+    print(sorted(l) == ref, sorted(l, reverse=True) == ref[::-1])
+
+# floats, and mixed ints and floats
+l = [x / 7 for x in lcg(200)]
+print(sorted(l) == sorted(l, key=lambda x: x))
+l = [x if x % 2 else x + 0.5 for x in lcg(200, 5)]
+s = sorted(l)
+print(all(s[i] <= s[i + 1] for i in range(len(s) - 1)))
+
+# the key function is called once per element
+calls = [0]
+
+
+def key(x):
+    calls[0] += 1
+    return -x
+
+
+l = lcg(300, 3)
+l.sort(key=key)
+print(calls[0], all(l[i] >= l[i + 1] for i in range(len(l) - 1)))
+
+# an exception while sorting keeps all the items in the list
+class Bad:
+    def __init__(self, x):
+        self.x = x
+
+    def __lt__(self, other):
+        if self.x == 250 or other.x == 250:
+            raise ValueError
+        return self.x < other.x
+
+
+l = [Bad(x) for x in lcg(300, 7)]
+l[123] = Bad(250)
+before = sorted(b.x for b in l)
+try:
+    l.sort()
+except ValueError:
+    print("ValueError")
+print(sorted(b.x for b in l) == before)
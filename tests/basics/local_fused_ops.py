@@ -0,0 +1,87 @@
+# test sequences of local variable operations that the compiler may combine
+
+
+class A:
+    def __init__(self, x):
+        self.x = x
+
+    def get(self):
+        return self.x
+
+    def add(self, y):
+        return self.get() + y
+
+
+a = A(1)
+print(a.x, a.get(), a.add(2))
+
+
+def loads(a, b):
+    return a, b, b, a
+
+
+print(loads(1, 2))
+
+
+# incrementing a local
+def incr(x):
+    x += 1
+    x = x + 7
+    return x
+
+
+print(incr(1))
+print(incr(-8))
+print(incr(1.5))
+print(incr(2**30 - 4))
+try:
+    incr("a")
+except TypeError:
+    print("TypeError")
+
+
+# in-place and plain addition stay distinct
+class N:
+    def __init__(self, n):
+        self.n = n
+
+    def __add__(self, other):
+        return N(self.n + other + 100)
+
+    def __iadd__(self, other):
+        self.n += other
+        return self
+
+
+def add_n(n):
+    m = n
+    m += 2
+    n = n + 3
+    return m, n
+
+
+m, n = add_n(N(0))
+print(m.n, n.n)
+
+
+# locals that aren't bound
+def unbound_attr(self=1):
+    del self
+    self.x
+
+
+def unbound_incr():
+    x += 1
+
+
+def unbound_pair():
+    a = 1
+    return a, b
+    b = 2
+
+
+for f in (unbound_attr, unbound_incr, unbound_pair):
+    try:
+        f()
+    except NameError:
+        print("NameError")
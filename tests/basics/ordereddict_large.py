@@ -0,0 +1,67 @@
+# test OrderedDict with enough entries for lookups to use a hash index
+
+try:
+    from collections import OrderedDict
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+d = OrderedDict()
+for i in range(20):
+    d["k%d" % i] = i
+print(len(d), list(d.keys())[:5], d["k0"], d["k19"], "k20" in d)
+
+# lookups with strings that may not be interned
+print(d["".join(["k", "1", "7"])], d.get("k" + str(3)), ("k" * 2) in d)
+
+# other types of key are never found
+print(17 in d, (1,) in d, d.get(None))
+
+# removing entries keeps the order and the other entries
+del d["k0"]
+del d["k10"]
+print(d.pop("k5"), list(d.keys())[:5], len(d))
+print(d["k1"], d["k11"], d["k19"], "k10" in d)
+d["k10"] = 100
+print(list(d.keys())[-3:], d["k10"])
+
+# popitem followed by adding keys again
+print(d.popitem(), d.popitem())
+d["a"] = 1
+d["k19"] = 19
+print(list(d.keys())[-3:], d["a"], d["k19"], "k10" in d)
+print(d.popitem(), "k19" in d)
+d["b"] = 2
+print(list(d.keys())[-3:], "k19" in d, d["b"])
+
+# a large dict
+d = OrderedDict()
+for i in range(300):
+    d["x%d" % i] = i
+print(len(d), d["x0"], d["x254"], d["x255"], d["x299"], list(d)[250:253])
+for i in range(0, 300, 3):
+    del d["x%d" % i]
+print(len(d), d["x1"], d["x299"], "x3" in d, list(d)[:4])
+print(sum(d["x%d" % i] for i in range(300) if i % 3))
+
+# a key that isn't a string disables the index
+d[1] = "one"
+d["y"] = "y"
+print(d[1], d["y"], d["x298"], list(d)[-3:])
+del d["x1"]
+print(d[1], "x1" in d, d["x2"])
+del d[1]
+for i in range(8):
+    d["w%d" % i] = i
+print(d["w7"], d["x2"], d["y"], 1 in d, len(d))
+
+# copies and updates
+d = OrderedDict(("z%d" % i, i) for i in range(12))
+e = d.copy()
+e["new"] = 1
+print(list(e)[-2:], e["z11"], e["new"], "new" in d)
+d.update({"z0": 99})
+print(d["z0"], list(d)[0])
+d.clear()
+d["q"] = 0
+print(list(d.items()), "z1" in d)
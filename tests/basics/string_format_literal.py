@@ -0,0 +1,15 @@
+# str.format with long literal runs between fields, and fields without a
+# format spec which are printed directly into the result
+
+print("plain text only".format())
+print("{{}} braces {{ around }} text".format())
+print("start {} middle {} end".format("a", 1))
+print("{}{}{}".format(1, "two", 3.5))
+print("{!r} and {!s} and {}".format("q", "q", "q"))
+print("{} {}".format([1, "x"], (None, True)))
+print("x{0}y{0}z{1}".format("-", "+"))
+print("{name} is {age} years".format(name="Bob", age=7))
+print("{!r:>6}|{:<4}|".format("a", "b"))
+s = "long literal text " * 20
+print(("{}" + s + "{}").format("<", ">"))
+print(len(("{}" * 50).format(*range(50))))
@@ -0,0 +1,22 @@
+# test interning enough new strings for lookups to go through a hash index
+
+
+class A:
+    pass
+
+
+a = A()
+for i in range(300):
+    setattr(a, "attr%d" % i, i)
+
+# the names are found again when they are interned from other strings
+print(getattr(a, "attr0"), getattr(a, "attr" + "255"), getattr(a, "".join(["attr", "299"])))
+print(sum(getattr(a, "attr%d" % i) for i in range(300)))
+print(hasattr(a, "attr300"), hasattr(a, "attr"), hasattr(a, "attr2999"))
+
+# names from compiled code match the interned ones
+exec("print(a.attr17, a.attr128, a.attr256)")
+print(sorted(n for n in dir(a) if n.startswith("attr"))[:4])
+
+# names that are already in ROM still work
+print(getattr(a, "__class__") is A, hasattr(a, "append"))
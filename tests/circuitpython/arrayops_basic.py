@@ -0,0 +1,96 @@
+try:
+    import arrayops
+    from array import array
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# add a scalar, saturating to the typecode range
+a = array("b", [-100, 0, 100])
+arrayops.add(a, 50)
+print(a)
+arrayops.add(a, -1000)
+print(a)
+a = array("H", [1, 2, 65000])
+arrayops.add(a, 1000)
+print(a)
+a = array("h", [1, 2, 3])
+arrayops.add(a, 0.6)
+print(a)
+f = array("f", [1.5, -2.5])
+arrayops.add(f, 1)
+print(f)
+
+# elementwise add of two arrays, possibly of different typecodes
+a = array("h", [30000, -30000, 5])
+arrayops.add(a, array("h", [10000, -10000, 5]))
+print(a)
+a = array("B", [1, 2, 3])
+arrayops.add(a, array("f", [0.5, -10, 1.4]))
+print(a)
+b = bytearray(b"\x01\x02\xff")
+arrayops.add(b, b"\x01\x01\x01")
+print(b)
+try:
+    arrayops.add(array("h", [1, 2]), array("h", [1]))
+except ValueError:
+    print("ValueError")
+
+# multiply by a scalar
+a = array("h", [100, -200, 20000])
+arrayops.mul(a, 2)
+print(a)
+arrayops.mul(a, -0.5)
+print(a)
+a = array("I", [1, 2, 3])
+arrayops.mul(a, -1)
+print(a)
+a = array("i", [1, -1])
+arrayops.mul(a, 1 << 40)
+print(a)
+d = array("d", [1.0, 2.0])
+arrayops.mul(d, 0.25)
+print(d)
+
+# memoryviews work on a slice of the data
+a = array("h", [1, 2, 3, 4])
+arrayops.add(memoryview(a)[1:3], 10)
+print(a)
+
+# sum, min and max
+print(arrayops.sum(array("h", [1, -2, 3])))
+print(arrayops.sum(array("I", [4000000000, 4000000000])))
+print(arrayops.sum(array("f", [0.5, 0.25])))
+print(arrayops.sum(array("h")))
+print(arrayops.min(array("h", [5, -3, 7, -3])), arrayops.max(array("h", [5, -3, 7, -3])))
+print(arrayops.min(array("f", [2.5, 1.5])), arrayops.max(b"\x05\x09\x02"))
+try:
+    arrayops.max(array("h"))
+except ValueError:
+    print("ValueError")
+
+# typecode conversion with rounding and saturation
+src = array("f", [-40000.0, -1.5, -0.4, 0.5, 2.49, 40000.0])
+dest = array("h", [0] * len(src))
+arrayops.convert(src, dest)
+print(dest)
+dest = array("b", [0] * 3)
+arrayops.convert(array("H", [1, 200, 65535]), dest)
+print(dest)
+out = array("f", [0] * 3)
+arrayops.convert(array("h", [-32768, 0, 32767]), out)
+print(out)
+try:
+    arrayops.convert(array("h", [1, 2]), array("h", [0]))
+except ValueError:
+    print("ValueError")
+
+# unsupported buffers
+try:
+    arrayops.add(b"abc", 1)
+except TypeError:
+    print("TypeError")
+try:
+    arrayops.sum(array("q", [1]))
+except ValueError:
+    print("ValueError")
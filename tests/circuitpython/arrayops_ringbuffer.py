@@ -0,0 +1,74 @@
+import arrayops
+import array
+
+r = arrayops.RingBuffer("h", 4)
+print(len(r), bool(r), r.capacity)
+try:
+    r.pop()
+except IndexError:
+    print("IndexError")
+
+r.extend([1, 2, 3])
+r.appendleft(0)
+print(len(r), [r[i] for i in range(len(r))])
+
+# a full buffer discards from the opposite end
+r.append(4)
+print([r[i] for i in range(len(r))])
+r.appendleft(-1)
+print([r[i] for i in range(len(r))])
+
+r[0] = 32767
+r[-1] = -32768
+print(r[0], r[-1])
+try:
+    r[1] = 100000
+except OverflowError:
+    print("OverflowError")
+try:
+    r[4]
+except IndexError:
+    print("IndexError")
+
+print(r.pop(), r.popleft(), len(r))
+
+# the buffer is contiguous from the left end, even after wrapping
+r.clear()
+for i in range(7):
+    r.append(i)
+print(list(memoryview(r)), arrayops.sum(r), arrayops.max(r))
+print(r.popleft(), r.pop(), [r[i] for i in range(len(r))])
+
+# floats
+f = arrayops.RingBuffer("f", 2)
+f.append(1.5)
+f.append(2.5)
+f.append(3.5)
+print(f.popleft(), f.popleft())
+
+# no overwrite
+n = arrayops.RingBuffer("B", 2, overwrite=False)
+n.append(1)
+n.append(2)
+try:
+    n.append(3)
+except IndexError:
+    print("IndexError")
+try:
+    n.appendleft(3)
+except IndexError:
+    print("IndexError")
+print(n[0], n[1])
+
+z = arrayops.RingBuffer("i", 0)
+z.append(1)
+print(len(z))
+
+try:
+    arrayops.RingBuffer("x", 2)
+except ValueError:
+    print("ValueError")
+try:
+    arrayops.RingBuffer("h", -1)
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,68 @@
+import array
+import math
+import audiocore
+import audiofx
+
+
+def samples(effect, limit=40):
+    # all output until the effect is done
+    result = []
+    audiocore.reset_buffer(effect)
+    for i in range(limit):
+        r, b = audiocore.get_buffer(effect)
+        result.extend(b)
+        if r == 0:
+            break
+    return result
+
+
+impulse = array.array("h", [0] * 256)
+impulse[0] = 16000
+source = audiocore.RawSample(impulse, sample_rate=8000)
+
+# echoes every 10ms, each half as loud as the last
+d = audiofx.Delay(source, delay=0.01, feedback=0.5, mix=0.5)
+print(d.delay, d.max_delay, d.feedback, d.mix, d.source is source)
+out = samples(d)
+print([(i, v) for i, v in enumerate(out) if v][:6], len(out))
+try:
+    d.delay = 0.02
+except ValueError as e:
+    print("ValueError")
+d = audiofx.Delay(source, delay=0.01, max_delay=0.02)
+d.delay = 0.02
+print([i for i, v in enumerate(samples(d)) if v][:3])
+
+sine = array.array("h", [int(30000 * math.sin(2 * math.pi * i / 32)) for i in range(1024)])
+source = audiocore.RawSample(sine, sample_rate=8000)
+
+# at unity gain the bands add up to exactly the source
+e = audiofx.EQ(source)
+print(samples(e)[:1024] == list(sine))
+for bands in ((0, 1, 1), (1, 0, 1), (1, 1, 0)):
+    e = audiofx.EQ(source, low=bands[0], mid=bands[1], high=bands[2])
+    print(bands, max(samples(e)[512:1024]))
+
+c = audiofx.Compressor(source, threshold=0.25, ratio=10, attack=0, release=0.05)
+out = samples(c)
+print(max(out[512:1024]), len(out))
+c.gain = 2
+print(c.threshold, c.ratio, c.attack, c.release, c.gain)
+
+# a stereo source keeps both channels
+stereo = audiocore.RawSample(sine, sample_rate=8000, channel_count=2)
+r = audiofx.Reverb(stereo, room_size=0.9, mix=0.5)
+print(r.room_size, r.damping, r.mix, audiocore.get_structure(r))
+out = samples(r, 100)
+# the reverberation continues past the end of the source
+print(len(out) > len(sine), max(out[len(sine):len(sine) + 512]) > 0)
+
+# effects chain
+chain = audiofx.EQ(audiofx.Delay(source, delay=0.05), high=2)
+print(len(samples(chain)))
+
+for bad in ({"feedback": 2}, {"delay": -1}, {"mix": "x"}):
+    try:
+        audiofx.Delay(source, **bad)
+    except (ValueError, TypeError) as e:
+        print(type(e).__name__, e)
@@ -0,0 +1,51 @@
+# test audiomixer converting samples that don't match the mixer's format
+
+import array
+import audiocore
+import audiomixer
+
+
+def dump(mixer):
+    print(list(audiocore.get_buffer(mixer)[1][:16]))
+
+
+# a matching sample is mixed as is
+m = audiomixer.Mixer(voice_count=1, buffer_size=64, channel_count=1, sample_rate=8000)
+m.voice[0].play(audiocore.RawSample(array.array("h", [1000, -1000] * 16), sample_rate=8000))
+dump(m)
+
+# doubled sample rate with linear interpolation
+m.voice[0].play(audiocore.RawSample(array.array("h", [0, 1000, 2000, 0] * 8), sample_rate=4000))
+dump(m)
+
+# halved sample rate
+m.voice[0].play(audiocore.RawSample(array.array("h", range(0, 6400, 100)), sample_rate=16000))
+dump(m)
+
+# 8 bit unsigned mono to 16 bit signed stereo
+m = audiomixer.Mixer(voice_count=2, buffer_size=64, channel_count=2, sample_rate=8000)
+m.voice[0].play(audiocore.RawSample(array.array("B", [128, 192, 64, 255] * 8), sample_rate=8000))
+dump(m)
+
+# stereo to mono averages the channels, and a second voice mixes with the first
+m = audiomixer.Mixer(voice_count=2, buffer_size=64, channel_count=1, sample_rate=8000)
+m.voice[0].play(
+    audiocore.RawSample(array.array("h", [1000, 3000] * 16), channel_count=2, sample_rate=8000)
+)
+m.voice[1].play(audiocore.RawSample(array.array("h", [100] * 32), sample_rate=8000))
+dump(m)
+
+# 16 bit signed to 8 bit unsigned
+m = audiomixer.Mixer(
+    voice_count=1, buffer_size=64, bits_per_sample=8, samples_signed=False, sample_rate=8000
+)
+m.voice[0].play(audiocore.RawSample(array.array("h", [0, 16384, -16384, 32767] * 8)))
+dump(m)
+
+# a sample that ends stops playing, and a looped one keeps going
+m = audiomixer.Mixer(voice_count=2, buffer_size=32, channel_count=1, sample_rate=8000)
+m.voice[0].play(audiocore.RawSample(array.array("h", [500] * 3), sample_rate=4000))
+m.voice[1].play(audiocore.RawSample(array.array("h", [7, 9]), sample_rate=4000), loop=True)
+dump(m)
+dump(m)
+print(m.voice[0].playing, m.voice[1].playing)
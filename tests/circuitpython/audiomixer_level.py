@@ -0,0 +1,33 @@
+# test audiomixer mixing voices at different levels and in each format
+
+import array
+import audiocore
+import audiomixer
+
+
+def dump(mixer):
+    print(list(audiocore.get_buffer(mixer)[1][:8]))
+
+
+for bits, signed, typecode, values in (
+    (16, True, "h", [1000, -1000, 32767, -32768, 20000, -20000, 7, 0]),
+    (16, False, "H", [33768, 31768, 65535, 0, 52768, 12768, 32775, 32768]),
+    (8, True, "b", [10, -10, 127, -128, 80, -80, 7, 0]),
+    (8, False, "B", [138, 118, 255, 0, 208, 48, 135, 128]),
+):
+    m = audiomixer.Mixer(
+        voice_count=2,
+        buffer_size=64,
+        channel_count=1,
+        bits_per_sample=bits,
+        samples_signed=signed,
+    )
+    sample = audiocore.RawSample(array.array(typecode, values * 4))
+    m.voice[0].play(sample, loop=True)
+    dump(m)
+    m.voice[0].level = 0.5
+    dump(m)
+    m.voice[1].play(sample, loop=True)
+    dump(m)
+    m.voice[0].level = 1
+    dump(m)
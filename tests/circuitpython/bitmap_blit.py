@@ -0,0 +1,80 @@
+import bitmaptools
+import displayio
+
+
+def fill(bitmap, depth, seed):
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            bitmap[x, y] = (x * 7 + y * 3 + seed) & ((1 << depth) - 1)
+
+
+def snapshot(bitmap):
+    return [bitmap[x, y] for y in range(bitmap.height) for x in range(bitmap.width)]
+
+
+def reference(dest, source, x, y, x1, y1, x2, y2, skip_source=(), skip_dest=None):
+    pixels = snapshot(dest)
+    source_pixels = snapshot(source)
+    for j in range(y2 - y1):
+        for i in range(x2 - x1):
+            dx, dy = x + i, y + j
+            if dx >= dest.width or dy >= dest.height:
+                continue
+            value = source_pixels[(y1 + j) * source.width + x1 + i]
+            if value in skip_source:
+                continue
+            if skip_dest is not None and pixels[dy * dest.width + dx] == skip_dest:
+                continue
+            pixels[dy * dest.width + dx] = value
+    return pixels
+
+
+# whole rows, packed words with matching offsets, and pixel by pixel
+ok = True
+for dest_depth, source_depth in ((1, 1), (2, 2), (4, 4), (8, 8), (16, 16), (8, 4), (16, 1)):
+    for x, x1 in ((0, 0), (3, 3), (5, 1), (33, 1), (40, 8)):
+        source = displayio.Bitmap(45, 5, min(1 << source_depth, 65535))
+        dest = displayio.Bitmap(70, 6, min(1 << dest_depth, 65535))
+        fill(source, source_depth, 1)
+        fill(dest, source_depth, 2)
+        expected = reference(dest, source, x, 1, x1, 0, 44, 5)
+        dest.blit(x, 1, source, x1=x1, y1=0, x2=44, y2=5)
+        if snapshot(dest) != expected:
+            print("mismatch", dest_depth, source_depth, x, x1)
+            ok = False
+print("blit", ok)
+
+# overlapping copies within one bitmap
+ok = True
+for depth in (1, 4, 8, 16):
+    for x, y, x1, y1 in ((2, 0, 0, 0), (0, 0, 2, 0), (1, 2, 0, 0), (0, 0, 3, 2), (33, 0, 1, 0)):
+        bitmap = displayio.Bitmap(70, 6, min(1 << depth, 65535))
+        fill(bitmap, depth, 3)
+        expected = reference(bitmap, bitmap, x, y, x1, y1, 36, 4)
+        bitmap.blit(x, y, bitmap, x1=x1, y1=y1, x2=36, y2=4)
+        if snapshot(bitmap) != expected:
+            print("overlap mismatch", depth, x, y, x1, y1)
+            ok = False
+print("overlap", ok)
+
+# skipped indices and palette transparency
+source = displayio.Bitmap(6, 3, 4)
+dest = displayio.Bitmap(8, 4, 4)
+fill(source, 2, 0)
+fill(dest, 2, 1)
+expected = reference(dest, source, 2, 1, 0, 0, 6, 3, skip_source=(1,), skip_dest=2)
+bitmaptools.blit(dest, source, 2, 1, skip_source_index=1, skip_dest_index=2)
+print("skip", snapshot(dest) == expected)
+
+palette = displayio.Palette(4)
+palette.make_transparent(0)
+palette.make_transparent(3)
+fill(dest, 2, 1)
+expected = reference(dest, source, 0, 0, 1, 0, 6, 3, skip_source=(0, 3))
+bitmaptools.blit(dest, source, 0, 0, x1=1, source_palette=palette)
+print("palette", snapshot(dest) == expected)
+
+try:
+    bitmaptools.blit(dest, displayio.Bitmap(2, 2, 256), 0, 0)
+except ValueError as e:
+    print(e)
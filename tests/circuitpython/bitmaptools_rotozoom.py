@@ -0,0 +1,80 @@
+import math
+
+import bitmaptools
+import displayio
+
+
+def pattern(width, height, depth):
+    bitmap = displayio.Bitmap(width, height, 1 << depth)
+    for y in range(height):
+        for x in range(width):
+            bitmap[x, y] = (x + y * width) & ((1 << depth) - 1)
+    return bitmap
+
+
+def rows(bitmap):
+    return [[bitmap[x, y] for x in range(bitmap.width)] for y in range(bitmap.height)]
+
+
+source = pattern(4, 3, 4)
+
+# no rotation or scaling is a plain copy
+dest = displayio.Bitmap(6, 5, 16)
+bitmaptools.rotozoom(dest, source, ox=1, oy=1, px=0, py=0)
+expected = [[0] * 6 for _ in range(5)]
+for y in range(3):
+    for x in range(4):
+        expected[y + 1][x + 1] = source[x, y]
+print("identity", rows(dest) == expected)
+
+# a quarter turn clockwise
+dest = displayio.Bitmap(3, 4, 16)
+bitmaptools.rotozoom(dest, source, ox=2, oy=0, px=0, py=0, angle=math.pi / 2)
+for row in rows(dest):
+    print(row)
+
+# doubling makes 2x2 blocks
+dest = displayio.Bitmap(8, 6, 16)
+bitmaptools.rotozoom(dest, source, ox=0, oy=0, px=0, py=0, scale=2.0)
+print(
+    "zoom",
+    all(dest[x, y] == source[x // 2, y // 2] for y in range(6) for x in range(8)),
+)
+
+# clip windows and skip_index
+dest = displayio.Bitmap(6, 5, 16)
+bitmaptools.fill_region(dest, 0, 0, 6, 5, 15)
+bitmaptools.rotozoom(
+    dest,
+    source,
+    ox=0,
+    oy=0,
+    px=0,
+    py=0,
+    dest_clip0=(1, 1),
+    dest_clip1=(5, 3),
+    source_clip0=(1, 0),
+    source_clip1=(4, 3),
+    skip_index=6,
+)
+for row in rows(dest):
+    print(row)
+
+# rotating about the centre stays inside the destination
+dest = displayio.Bitmap(8, 8, 16)
+for step in range(16):
+    bitmaptools.rotozoom(dest, pattern(5, 5, 4), angle=step * math.pi / 8, scale=1.25)
+print("spin", max(max(row) for row in rows(dest)) < 16)
+
+# bilinear filtering of RGB565
+red, blue = 0xF800, 0x001F
+source = displayio.Bitmap(2, 1, 65535)
+source[0, 0] = red
+source[1, 0] = blue
+dest = displayio.Bitmap(8, 1, 65535)
+bitmaptools.rotozoom(dest, source, ox=0, oy=0, px=0, py=0, scale=4.0)
+print([hex(c) for c in rows(dest)[0]])
+bitmaptools.rotozoom(dest, source, ox=0, oy=0, px=0, py=0, scale=4.0, bilinear=True)
+print([hex(c) for c in rows(dest)[0]])
+bitmaptools.rotozoom(dest, source, ox=0, oy=0, px=0, py=0, scale=4.0, bilinear=True, skip_index=blue)
+print([hex(c) for c in rows(dest)[0]])
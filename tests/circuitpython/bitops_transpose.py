@@ -0,0 +1,67 @@
+import bitops
+
+
+def reference(inp, width):
+    stride = len(inp) // width
+    unit = (width + 7) // 8
+    out = bytearray(8 * stride * unit)
+    for i in range(stride):
+        for k in range(8):
+            value = 0
+            for lane in range(width):
+                if inp[lane * stride + i] & (0x80 >> k):
+                    value |= 1 << lane
+            pos = (i * 8 + k) * unit
+            out[pos : pos + unit] = value.to_bytes(unit, "little")
+    return out
+
+
+state = 1
+
+
+def data(n):
+    global state
+    b = bytearray(n)
+    for i in range(n):
+        state = (state * 1103515245 + 12345) & 0x7FFFFFFF
+        b[i] = (state >> 16) & 0xFF
+    return b
+
+
+for width in (2, 5, 8, 16, 32):
+    for columns in (1, 3):
+        inp = data(width * columns)
+        out = bitops.bit_transpose(inp, bytearray(len(reference(inp, width))), width)
+        print(width, columns, out == reference(inp, width))
+
+# One lane at a time lands in its own bit.
+for lane in (0, 7, 8, 15):
+    inp = bytearray(16)
+    inp[lane] = 0x80
+    print(lane, bytes(bitops.bit_transpose(inp, bytearray(16), 16))[:2])
+
+# Unaligned output slices.
+inp = data(32 * 2)
+buf = bytearray(len(inp) + 3)
+bitops.bit_transpose(inp, memoryview(buf)[3:], 32)
+print(buf[3:] == reference(inp, 32))
+inp = data(16 * 2)
+buf = bytearray(len(inp) + 1)
+bitops.bit_transpose(inp, memoryview(buf)[1:], 16)
+print(buf[1:] == reference(inp, 16))
+
+for width in (1, 9, 12, 64):
+    try:
+        bitops.bit_transpose(bytearray(64), bytearray(512), width)
+    except ValueError:
+        print(width, "ValueError")
+
+try:
+    bitops.bit_transpose(bytearray(17), bytearray(64), 16)
+except ValueError:
+    print("ValueError")
+
+try:
+    bitops.bit_transpose(bytearray(32), bytearray(31), 16)
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,47 @@
+import displayio
+import vectorio
+
+display = displayio.HeadlessDisplay(64, 48)
+pixels = memoryview(display)
+print(display.width, display.height, display.root_group, len(pixels))
+
+# With no group the first refresh clears the whole display.
+print(display.refresh(), display.pixels_refreshed)
+
+palette = displayio.Palette(2)
+palette[0] = 0x0000FF
+palette[1] = 0xFF0000
+background = displayio.Bitmap(64, 48, 2)
+square = displayio.Bitmap(8, 8, 2)
+square.fill(1)
+sprite = displayio.TileGrid(square, pixel_shader=palette, x=4, y=4)
+
+circle_palette = displayio.Palette(1)
+circle_palette[0] = 0x00FF00
+circle = vectorio.Circle(pixel_shader=circle_palette, radius=5, x=40, y=24)
+
+group = displayio.Group()
+group.append(displayio.TileGrid(background, pixel_shader=palette))
+group.append(sprite)
+group.append(circle)
+display.root_group = group
+print(display.root_group is group)
+print(display.refresh(), display.pixels_refreshed)
+print(hex(pixels[0]), hex(pixels[5 * 64 + 5]), hex(pixels[24 * 64 + 40]))
+
+# Nothing changed, so nothing is redrawn.
+print(display.refresh(), display.pixels_refreshed)
+
+# Moving the sprite redraws where it was and where it is.
+sprite.x = 20
+print(display.refresh(), display.pixels_refreshed)
+print(hex(pixels[5 * 64 + 5]), hex(pixels[5 * 64 + 21]))
+
+try:
+    displayio.HeadlessDisplay(4, 4).root_group = group
+except ValueError as e:
+    print("ValueError:", e)
+
+display.root_group = None
+print(display.refresh(), display.pixels_refreshed, hex(pixels[5 * 64 + 21]))
+print(display.last_refresh_us >= 0)
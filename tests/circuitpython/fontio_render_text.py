@@ -0,0 +1,62 @@
+import displayio
+import fontio
+
+
+class Font:
+    # Glyphs are 3x4 tiles in one strip bitmap; "A" uses tile 1, "B" tile 2, " " has no pixels.
+    def __init__(self):
+        self.bitmap = displayio.Bitmap(9, 4, 2)
+        for y in range(4):
+            self.bitmap[3, y] = 1
+            self.bitmap[5, y] = 1
+            self.bitmap[6 + (y % 3), y] = 1
+        self.lookups = []
+
+    def get_bounding_box(self):
+        return (3, 4)
+
+    def get_glyph(self, codepoint):
+        self.lookups.append(chr(codepoint))
+        tile = {"A": 1, "B": 2, " ": 0}.get(chr(codepoint))
+        if tile is None:
+            return None
+        return fontio.Glyph(self.bitmap, tile, 3, 4, 0, 0, 4, 0)
+
+
+def show(bitmap):
+    for y in range(bitmap.height):
+        print("".join(str(bitmap[x, y]) for x in range(bitmap.width)))
+
+
+font = Font()
+bitmap = displayio.Bitmap(16, 6, 4)
+print(fontio.render_text(font, "AB?A B", bitmap, 1, 5, 3))
+show(bitmap)
+print(font.lookups)
+
+# Glyphs are clipped at the edges and only set pixels overwrite the bitmap.
+bitmap = displayio.Bitmap(5, 3, 4)
+bitmap.fill(2)
+print(fontio.render_text(font, "AB", bitmap, -1, 2, palette_index=1))
+show(bitmap)
+
+
+# dx/dy move the glyph relative to the cursor and baseline.
+class ShiftedFont(Font):
+    def get_glyph(self, codepoint):
+        return fontio.Glyph(self.bitmap, 1, 3, 4, 1, -1, 5, 0)
+
+
+bitmap = displayio.Bitmap(12, 6, 2)
+print(fontio.render_text(ShiftedFont(), "AA", bitmap, 0, 4))
+show(bitmap)
+
+for args in (
+    (font, "A", bitmap, 0, 0, 2),
+    (font, "A", bitmap, 0, 0, -1),
+    (font, "A", None, 0, 0),
+):
+    try:
+        fontio.render_text(*args)
+    except (TypeError, ValueError) as e:
+        print(type(e).__name__)
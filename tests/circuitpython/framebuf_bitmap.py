@@ -0,0 +1,24 @@
+import displayio
+import framebuf
+
+# An 8-bit Bitmap is a GS8 FrameBuffer sharing the same pixels.
+bitmap = displayio.Bitmap(10, 3, 256)
+fb = framebuf.FrameBuffer(bitmap)
+fb.fill_rect(1, 1, 3, 1, 7)
+fb.pixel(9, 2, 200)
+print([bitmap[x, 1] for x in range(10)], bitmap[9, 2])
+bitmap[0, 0] = 5
+print(fb.pixel(0, 0))
+
+# A 16-bit Bitmap is an RGB565 FrameBuffer.
+bitmap = displayio.Bitmap(3, 2, 65535)
+fb = framebuf.FrameBuffer(bitmap)
+fb.fill(0x1234)
+fb.hline(0, 1, 2, 0xABCD)
+print([hex(bitmap[x, y]) for y in range(2) for x in range(3)])
+
+# Bitmaps packing several values per byte have no matching format.
+try:
+    framebuf.FrameBuffer(displayio.Bitmap(8, 8, 2))
+except ValueError as e:
+    print("ValueError", e)
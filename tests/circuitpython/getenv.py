@@ -87,3 +87,12 @@ run_test(f"noeol", b"noeol=3")
 
 for content in content_bad:
     run_test("key", content)
+
+# Test the first of repeated keys is used
+run_test("dup", b'dup = "first"\ndup = "second"\n')
+
+# Test more keys than are indexed, and a rewrite of the same size
+content_many = b"".join(b"many%d = %d\n" % (i, i) for i in range(40))
+for key in ("many0", "many39", "many40"):
+    run_test(key, content_many)
+run_test("many39", content_many.replace(b"= 39", b"= 93"))
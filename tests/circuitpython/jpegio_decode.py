@@ -0,0 +1,116 @@
+# The images were made with an independent encoder from the pattern below:
+# a 19x13 4:2:0 color image with a restart marker after every MCU, and a
+# 10x7 grayscale image.
+from binascii import unhexlify
+
+import displayio
+import jpegio
+import uio as io
+
+COLOR = unhexlify(
+    "ffd8ffe000104a46494600010100000100010000ffdb00840001010101010101010101010101010101010101"
+    "0101010101010101010101010101010101010101010101010101010101010101010101010101010101010101"
+    "0101010101010101010101010101010101010101010101010101010101010101010101010101010101010101"
+    "01010101010101010101010101010101010101010101ffc0001108000d001303012200021101031101ffc400"
+    "1f0000010501010101010100000000000000000102030405060708090a0bffc400b510000201030302040305"
+    "0504040000017d01020300041105122131410613516107227114328191a1082342b1c11552d1f02433627282"
+    "090a161718191a25262728292a3435363738393a434445464748494a535455565758595a636465666768696a"
+    "737475767778797a838485868788898a92939495969798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2"
+    "c3c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae1e2e3e4e5e6e7e8e9eaf1f2f3f4f5f6f7f8f9faffc4001f010003"
+    "0101010101010101010000000000000102030405060708090a0bffc400b51100020102040403040705040400"
+    "010277000102031104052131061241510761711322328108144291a1b1c109233352f0156272d10a162434e1"
+    "25f11718191a262728292a35363738393a434445464748494a535455565758595a636465666768696a737475"
+    "767778797a82838485868788898a92939495969798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4"
+    "c5c6c7c8c9cad2d3d4d5d6d7d8d9dae2e3e4e5e6e7e8e9eaf2f3f4f5f6f7f8f9faffdd00040001ffda000c03"
+    "010002110311003f00fc25f853fb09f36dff00127feeff00cbbfd3dabf4bbe14fec27ff1efff00127fee7fcb"
+    "bfff005abf70fe14fece3e06cdb7c9fddff9758fdbfe9a57e96fc29fd9c7c0dfe8df27f73fe5d63ffe395f2b"
+    "8afa50663afef715f74ffc8fe5bfa04fed2ce20ff845ff0069ccbfe5c74adda3e47fffd0ef34cfd84ffd02d7"
+    "fe24ff00f2c87fcbbfb9f6abdff0c29ff508ff00c97ffeb57f5c5a67ece3e06fb05afc9ff2c87fcbac7ea7fe"
+    "9a55ff00f8671f037f73ff002563ff00e395f9fbfa4fe6377fbdc57dd33fd89c07ed2ce20fa8e0ff00da732f"
+    "f75c3f4adff3e61e47ffd9"
+)
+
+GRAY = unhexlify(
+    "ffd8ffe000104a46494600010100000100010000ffdb00430001010101010101010101010101010101010101"
+    "0101010101010101010101010101010101010101010101010101010101010101010101010101010101010101"
+    "01ffc0000b080007000a01011100ffc4001f0000010501010101010100000000000000000102030405060708"
+    "090a0bffc400b5100002010303020403050504040000017d0102030004110512213141061351610722711432"
+    "8191a1082342b1c11552d1f02433627282090a161718191a25262728292a3435363738393a43444546474849"
+    "4a535455565758595a636465666768696a737475767778797a838485868788898a92939495969798999aa2a3"
+    "a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae1e2e3e4e5e6e7e8e9ea"
+    "f1f2f3f4f5f6f7f8f9faffda0008010100003f008ff653ff008225f87bfe25bff12cd17fe597fcb6b1f6ff00"
+    "a695fb2f65ff00044af0f7d8ad3fe259a2ff00c7adbffcb6b1ff009e49ff004d6bffd9"
+)
+
+
+def pattern(w, h, gray):
+    for y in range(h):
+        for x in range(w):
+            r = (x * 255) // (w - 1)
+            g = (y * 255) // (h - 1)
+            b = ((x + y) * 127) // (w + h - 2) + 64
+            if gray:
+                r = g = b = round(0.299 * r + 0.587 * g + 0.114 * b)
+            yield x, y, (r, g, b)
+
+
+def max_error(bitmap, w, h, gray, scale, x0=0, y0=0):
+    n = 1 << scale
+    sums = {}
+    for x, y, rgb in pattern(w, h, gray):
+        key = (x // n, y // n)
+        acc = sums.setdefault(key, [0, 0, 0, 0])
+        for k in range(3):
+            acc[k] += rgb[k]
+        acc[3] += 1
+    worst = 0
+    for (x, y), acc in sums.items():
+        if not (0 <= x + x0 < bitmap.width and 0 <= y + y0 < bitmap.height):
+            continue
+        c = bitmap[x + x0, y + y0]
+        got = ((c >> 11) << 3, ((c >> 5) & 63) << 2, (c & 31) << 3)
+        for k in range(3):
+            worst = max(worst, abs(acc[k] / acc[3] - got[k]))
+    return worst
+
+
+decoder = jpegio.JpegDecoder()
+for name, data, gray in (("color", COLOR, False), ("gray", GRAY, True)):
+    for scale in range(4):
+        w, h = decoder.open(data)
+        n = 1 << scale
+        bitmap = displayio.Bitmap((w + n - 1) // n, (h + n - 1) // n, 65535)
+        decoder.decode(bitmap, scale)
+        print(name, scale, (w, h), max_error(bitmap, w, h, gray, scale) < 24)
+
+# from a stream, placed partly outside the bitmap
+print(decoder.open(io.BytesIO(COLOR)))
+bitmap = displayio.Bitmap(12, 12, 65535)
+decoder.decode(bitmap, x=-4, y=3)
+print(max_error(bitmap, 19, 13, False, 0, -4, 3) < 24, bitmap[0, 0], bitmap[11, 2])
+
+# an opened image can only be decoded once
+try:
+    decoder.decode(bitmap)
+except RuntimeError as e:
+    print("RuntimeError", e)
+
+decoder.open(GRAY)
+try:
+    decoder.decode(displayio.Bitmap(10, 7, 256))
+except ValueError as e:
+    print("ValueError", e)
+
+# progressive images aren't supported
+sof = COLOR.index(b"\xff\xc0")
+for data in (COLOR[:sof + 1] + b"\xc2" + COLOR[sof + 2 :], b"GIF89a", COLOR[:sof]):
+    try:
+        decoder.open(data)
+    except (ValueError, EOFError) as e:
+        print(type(e).__name__, *e.args)
+
+decoder.open(COLOR[:-100])
+try:
+    decoder.decode(displayio.Bitmap(19, 13, 65535))
+except EOFError:
+    print("EOFError")
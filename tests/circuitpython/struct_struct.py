@@ -0,0 +1,75 @@
+try:
+    import struct
+    import array
+
+    struct.Struct
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+s = struct.Struct("<hHbx3s2i")
+print(s.format, s.size)
+data = s.pack(-2, 65535, 7, b"ab", 1, -1)
+print(data)
+print(s.unpack(data))
+print(s.unpack(data) == struct.unpack("<hHbx3s2i", data))
+
+buf = bytearray(s.size + 4)
+s.pack_into(buf, 2, 1, 2, 3, b"xyz", 4, 5)
+print(buf)
+print(s.unpack_from(buf, 2))
+print(s.unpack_from(buf, -s.size - 2))
+
+# native alignment is the same as the module functions
+for fmt in ("@bi", "@bhq", "@3Bd", "b2x", ">Q", ""):
+    n = struct.Struct(fmt)
+    print(fmt, n.size == struct.calcsize(fmt))
+print(struct.Struct("=hI").size)
+
+try:
+    s.pack(1, 2)
+except ValueError:
+    print("ValueError")
+try:
+    s.unpack(data[:-1])
+except RuntimeError:
+    print("RuntimeError")
+try:
+    s.unpack_from(buf, 6)
+except RuntimeError:
+    print("RuntimeError")
+try:
+    struct.Struct("<2")
+except ValueError:
+    print("ValueError")
+
+# iter_unpack
+records = struct.pack(">hbhbhb", 1, 2, 3, 4, 5, 6)
+print(list(struct.iter_unpack(">hb", records)))
+print(list(struct.Struct(">hb").iter_unpack(records)))
+try:
+    struct.iter_unpack(">hb", records[:-1])
+except RuntimeError:
+    print("RuntimeError")
+
+# unpack_from_array: one array per field
+stereo = struct.Struct("<hh")
+samples = b"".join(stereo.pack(i, -i) for i in range(5))
+left, right = stereo.unpack_from_array(samples)
+print(left, right)
+print(stereo.unpack_from_array(samples, 4, 2))
+print(stereo.unpack_from_array(samples, count=0))
+
+mixed = struct.Struct(">BxHfl")
+packed = mixed.pack(1, 513, 0.5, -70000) + mixed.pack(255, 65535, -2.0, 3)
+for col in mixed.unpack_from_array(packed):
+    print(col)
+print(struct.Struct("@2ih").unpack_from_array(struct.pack("@2ih", 10, 20, 30)))
+try:
+    struct.Struct("2s").unpack_from_array(b"ab")
+except ValueError:
+    print("ValueError")
+try:
+    stereo.unpack_from_array(samples, 0, 6)
+except RuntimeError:
+    print("RuntimeError")
@@ -0,0 +1,35 @@
+import array
+import math
+import audiocore
+import synthio
+
+sine = array.array("h", [int(32767 * math.sin(2 * math.pi * i / 64)) for i in range(64)])
+
+
+def peak(note, blocks=8):
+    s = synthio.Synthesizer(sample_rate=8000, channel_count=1)
+    s.press(note)
+    result = 0
+    for i in range(blocks):
+        r, b = audiocore.get_buffer(s)
+        # skip the attack
+        if i >= blocks // 2:
+            result = max(result, max(abs(v) for v in b))
+    return result
+
+
+unfiltered = peak(synthio.Note(1000, waveform=sine))
+for mode in (synthio.FilterMode.LOW_PASS, synthio.FilterMode.HIGH_PASS, synthio.FilterMode.BAND_PASS):
+    for cutoff in (250, 1000, 3500):
+        f = synthio.Biquad(mode, cutoff)
+        # relative level of a 1kHz tone, in tenths
+        print(mode, cutoff, round(10 * peak(synthio.Note(1000, waveform=sine, filter=f)) / unfiltered))
+
+f = synthio.Biquad(synthio.FilterMode.LOW_PASS, frequency=synthio.LFO(rate=1, scale=100, offset=500), Q=2)
+print(f)
+n = synthio.Note(1000, filter=f)
+print(n.filter is f)
+n.filter = False
+print(n.filter)
+f.mode = synthio.FilterMode.HIGH_PASS
+print(f.mode, f.Q)
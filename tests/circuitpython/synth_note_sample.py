@@ -0,0 +1,43 @@
+import array
+import audiocore
+import synthio
+
+SAMPLE_RATE = 8000
+
+
+def render(note, n):
+    s = synthio.Synthesizer(sample_rate=SAMPLE_RATE, channel_count=1)
+    s.press(note)
+    result = []
+    while len(result) < n:
+        r, b = audiocore.get_buffer(s)
+        result.extend(b)
+    return result[:n]
+
+
+# A "recording" whose sample values are their own index, so the output shows
+# the order in which the sample is played
+ramp = array.array("h", [i * 256 for i in range(16)])
+n = synthio.Note(
+    SAMPLE_RATE / 12, waveform=ramp, waveform_loop_start=4, waveform_loop_end=16
+)
+print([round(v / 128) for v in render(n, 40)])
+
+# loop end past the end of the waveform means the end of the waveform
+n = synthio.Note(SAMPLE_RATE / 16, waveform=ramp, waveform_loop_end=1000)
+print([round(v / 128) for v in render(n, 20)])
+
+# a wavetable with two (constant) frames
+table = array.array("h", [8192] * 8 + [-8192] * 8)
+for morph in (0, 0.25, 0.5, 1, 3):
+    n = synthio.Note(SAMPLE_RATE / 8, waveform=table, waveform_frames=2, morph=morph)
+    print(morph, render(n, 300)[-1])
+
+n = synthio.Note(440)
+n.waveform_loop_start = 3
+n.waveform_frames = 4
+print(n.waveform_loop_start, n.waveform_loop_end, n.waveform_frames, n.morph)
+try:
+    n.waveform_frames = 0
+except ValueError as e:
+    print("ValueError")
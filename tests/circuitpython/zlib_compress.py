@@ -0,0 +1,55 @@
+try:
+    import zlib
+
+    zlib.compress
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+try:
+    import uio as io
+except ImportError:
+    import io
+
+log = b"".join(b"t=%d temp=%d hum=%d\n" % (i, 20 + i % 7, 40 + i % 13) for i in range(400))
+DATA = [
+    b"",
+    b"a",
+    b"hello world " * 50,
+    bytes(range(256)) * 4,
+    log,
+    b"\x00" * 5000,
+]
+
+for data in DATA:
+    for wbits in (15, 9, -15, 31):
+        for level in (-1, 0, 1, 9):
+            packed = zlib.compress(data, level, wbits)
+            assert zlib.decompress(packed, wbits) == data, (len(data), wbits, level)
+    packed = zlib.compress(data)
+    print(len(data), len(packed) <= len(data) + 16, packed[:2])
+
+# the zlib header advertises the window actually used
+print(zlib.compress(b"abc", wbits=9)[:2])
+
+# a streaming compressor produces the same kind of stream in pieces
+compressor = zlib.Compressor(wbits=31)
+parts = []
+for i in range(0, len(log), 100):
+    parts.append(compressor.compress(log[i : i + 100]))
+parts.append(compressor.flush())
+packed = b"".join(parts)
+print(zlib.decompress(packed, 31) == log)
+print(zlib.DecompIO(io.BytesIO(packed), 31).read() == log)
+print(len(packed) < len(log) // 3)
+
+try:
+    compressor.compress(b"more")
+except ValueError:
+    print("ValueError")
+
+for level, wbits in ((10, 15), (-2, 15), (6, 8), (6, 16), (6, -16)):
+    try:
+        zlib.Compressor(level, wbits)
+    except ValueError:
+        print("ValueError")
@@ -0,0 +1,63 @@
+try:
+    import zlib
+    import uio as io
+
+    zlib.DecompIO
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+# zlib stream, window size taken from the header
+buf = io.BytesIO(b"x\x9c30\xa0=\x00\x00\xb3q\x12\xc1")
+inp = zlib.DecompIO(buf)
+print(inp.read(10))
+print(inp.read())
+print(inp.read())
+
+# raw DEFLATE stream with a small window, read in pieces
+buf = io.BytesIO(b"\xcbH\xcd\xc9\xc9\x07\x00")
+inp = zlib.DecompIO(buf, -8)
+out = bytearray(2)
+while True:
+    n = inp.readinto(out)
+    if not n:
+        break
+    print(out[:n])
+
+# gzip stream
+buf = io.BytesIO(
+    b"\x1f\x8b\x08\x08\x99\x0c\xe5W\x00\x03hello\x00\xcbH\xcd\xc9\xc9\x07\x00\x86\xa6\x106\x05\x00\x00\x00"
+)
+inp = zlib.DecompIO(buf, 16 + 8)
+print(inp.read())
+
+# lines
+buf = io.BytesIO(b'x\xda\xcb\xc9\xccKU\xc8\xcfK\xe5\xca\x011J\xca\xf3!\x0c\x02"\x00\x0bM\x12\xc1')
+inp = zlib.DecompIO(buf)
+print(inp.readline())
+print(inp.readline())
+
+# window too large
+try:
+    zlib.DecompIO(io.BytesIO(b""), -16)
+except ValueError:
+    print("ValueError")
+
+# bad header
+try:
+    zlib.DecompIO(io.BytesIO(b"\x00\x00"))
+except ValueError:
+    print("ValueError")
+
+# truncated input
+inp = zlib.DecompIO(io.BytesIO(b"x\x9c30\xa0=\x00"))
+try:
+    inp.read()
+except EOFError:
+    print("EOFError")
+
+# bufsize hint for the one-shot decompressor
+print(len(zlib.decompress(b"x\x9c30\xa0=\x00\x00\xb3q\x12\xc1", 15, 100)))
+print(len(zlib.decompress(b"x\x9c30\xa0=\x00\x00\xb3q\x12\xc1", 15, 1)))
+print(zlib.decompress(b"\x1f\x8b\x08\x08\x99\x0c\xe5W\x00\x03hello\x00\xcbH\xcd\xc9\xc9\x07\x00\x86\xa6\x106\x05\x00\x00\x00", 31))
@@ -0,0 +1,69 @@
+# Appended to each device_bench script by run-devicebench.py. Each script's
+# bm_setup() returns a list of (name, run) pairs, or an empty list when the
+# board lacks what it needs, and may define bm_teardown() to clean up. Every
+# run is timed `repeat` times and the fastest is printed as one line of JSON.
+
+
+def bm_timer():
+    try:
+        import benchmark
+
+        timer = benchmark.Timer()
+
+        def measure(run):
+            timer.start()
+            run()
+            return timer.stop(), timer.seconds
+
+    except ImportError:
+        try:
+            from time import ticks_us, ticks_diff
+        except ImportError:
+            import time
+
+            ticks_us = lambda: int(time.monotonic_ns() // 1000)
+            ticks_diff = lambda a, b: a - b
+
+        def measure(run):
+            t0 = ticks_us()
+            run()
+            return None, ticks_diff(ticks_us(), t0) / 1e6
+
+    return measure
+
+
+def bm_main(repeat):
+    import gc
+    import json
+    import sys
+
+    try:
+        import board
+
+        board_id = board.board_id
+    except (ImportError, AttributeError):
+        board_id = sys.platform
+    version = sys.version
+
+    measure = bm_timer()
+    for name, run in bm_setup():
+        best = None
+        for _ in range(repeat):
+            gc.collect()
+            result = measure(run)
+            if best is None or result[1] < best[1]:
+                best = result
+        print(
+            json.dumps(
+                {
+                    "bench": name,
+                    "cycles": best[0],
+                    "seconds": best[1],
+                    "repeat": repeat,
+                    "board": board_id,
+                    "version": version,
+                }
+            )
+        )
+    if "bm_teardown" in globals():
+        bm_teardown()
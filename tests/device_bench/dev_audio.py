@@ -0,0 +1,31 @@
+# Render time per buffer for synthio and for audiomixer mixing it, measured
+# through audiocore.get_buffer, which builds with CIRCUITPY_AUDIOCORE_DEBUG.
+
+
+def bm_setup():
+    try:
+        import audiocore
+        import synthio
+
+        audiocore.get_buffer
+    except (ImportError, AttributeError):
+        return []
+
+    synth = synthio.Synthesizer(sample_rate=22050)
+    synth.press((60, 64, 67, 72))
+    benches = [("synthio_4_notes", lambda: audiocore.get_buffer(synth))]
+
+    try:
+        import audiomixer
+
+        mixer = audiomixer.Mixer(
+            voice_count=2, sample_rate=22050, channel_count=1, bits_per_sample=16
+        )
+        other = synthio.Synthesizer(sample_rate=22050)
+        other.press((48, 55))
+        mixer.voice[0].play(synth, loop=True)
+        mixer.voice[1].play(other, loop=True)
+        benches.append(("audiomixer_2_voices", lambda: audiocore.get_buffer(mixer)))
+    except ImportError:
+        pass
+    return benches
@@ -0,0 +1,103 @@
+# displayio refresh of three standard scenes on board.DISPLAY: a full screen
+# colour change, a screen of text and a few moving sprites. Each run changes
+# the scene so the refresh has dirty areas to redraw. On the unix port the
+# scenes are drawn to a 320x240 displayio.HeadlessDisplay instead, so the
+# compositor can be profiled on the host.
+
+
+def bm_display():
+    try:
+        import board
+
+        display = board.DISPLAY
+        display.auto_refresh = False
+        return display
+    except (ImportError, AttributeError):
+        pass
+    try:
+        import displayio
+
+        return displayio.HeadlessDisplay(320, 240)
+    except (ImportError, AttributeError):
+        return None
+
+
+def bm_setup():
+    display = bm_display()
+    if display is None:
+        return []
+    import displayio
+
+    width = display.width
+    height = display.height
+
+    palette = displayio.Palette(2)
+    palette[0] = 0x000000
+    palette[1] = 0xFFFFFF
+    background = displayio.TileGrid(displayio.Bitmap(width, height, 2), pixel_shader=palette)
+
+    try:
+        import terminalio
+
+        font = terminalio.FONT
+        glyph_w, glyph_h = font.get_bounding_box()
+        text = displayio.TileGrid(
+            font.bitmap,
+            pixel_shader=palette,
+            width=width // glyph_w,
+            height=height // glyph_h,
+            tile_width=glyph_w,
+            tile_height=glyph_h,
+        )
+        glyph_count = text.width * text.height
+    except ImportError:
+        text = None
+
+    sprite_bitmap = displayio.Bitmap(16, 16, 2)
+    sprite_bitmap.fill(1)
+    sprites = [displayio.TileGrid(sprite_bitmap, pixel_shader=palette) for _ in range(8)]
+
+    scene = displayio.Group()
+    display.root_group = scene
+
+    def show(*tiles):
+        while len(scene):
+            scene.pop()
+        for tile in tiles:
+            scene.append(tile)
+        display.refresh()
+
+    state = [0]
+
+    def fill():
+        state[0] ^= 1
+        palette[0] = 0xFF0000 if state[0] else 0x0000FF
+        display.refresh()
+
+    def glyphs():
+        state[0] += 1
+        for i in range(glyph_count):
+            text[i] = (i + state[0]) % 95
+        display.refresh()
+
+    def move():
+        state[0] += 4
+        for i, sprite in enumerate(sprites):
+            sprite.x = (state[0] + i * 24) % (width - 16)
+            sprite.y = (i * 20) % (height - 16)
+        display.refresh()
+
+    def run_scene(tiles, run):
+        def bench():
+            if scene[len(scene) - 1] is not tiles[-1]:
+                show(*tiles)
+            run()
+
+        return bench
+
+    show(background)
+    benches = [("display_fill", run_scene([background], fill))]
+    if text is not None:
+        benches.append(("display_text", run_scene([background, text], glyphs)))
+    benches.append(("display_sprites", run_scene([background] + sprites, move)))
+    return benches
@@ -0,0 +1,50 @@
+# Filesystem throughput: write then read back 32KiB in 512 byte blocks. The
+# filesystem must be writable from code, for instance by remounting it in
+# boot.py or by having an SD card mounted at /sd.
+
+BM_SIZE = 32 * 1024
+BM_BLOCK = 512
+
+
+def bm_path():
+    for path in ("bench.tmp", "/sd/bench.tmp"):
+        try:
+            with open(path, "wb"):
+                pass
+            return path
+        except OSError:
+            pass
+    return None
+
+
+bm_paths = []
+
+
+def bm_setup():
+    path = bm_path()
+    if path is None:
+        return []
+    bm_paths.append(path)
+    block = bytearray(BM_BLOCK)
+    for i in range(BM_BLOCK):
+        block[i] = i & 0xFF
+
+    def write():
+        with open(path, "wb") as f:
+            for _ in range(BM_SIZE // BM_BLOCK):
+                f.write(block)
+
+    def read():
+        with open(path, "rb") as f:
+            while f.readinto(block):
+                pass
+
+    write()
+    return [("fs_write_32k", write), ("fs_read_32k", read)]
+
+
+def bm_teardown():
+    import os
+
+    for path in bm_paths:
+        os.remove(path)
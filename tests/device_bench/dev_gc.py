@@ -0,0 +1,24 @@
+# The pause for a full collection with a heap of small live objects, and with
+# mostly garbage.
+
+
+def bm_setup():
+    import gc
+
+    keep = []
+
+    def live():
+        gc.collect()
+
+    def fill():
+        del keep[:]
+        for i in range(200):
+            keep.append([i, str(i), (i, i)])
+
+    def garbage():
+        for i in range(200):
+            [i, str(i), (i, i)]
+        gc.collect()
+
+    fill()
+    return [("gc_collect_live", live), ("gc_collect_garbage", garbage)]
@@ -0,0 +1,30 @@
+# Decoding a typical sensor/config document with json, and with msgpack where
+# the board has it.
+
+
+def bm_document():
+    return {
+        "name": "sensor-%d" % 7,
+        "enabled": True,
+        "readings": [{"t": i, "value": i * 0.25, "ok": i % 3 != 0} for i in range(40)],
+        "tags": ["temperature", "humidity", "pressure"],
+        "location": {"lat": 40.7128, "lon": -74.006},
+    }
+
+
+def bm_setup():
+    import json
+
+    text = json.dumps(bm_document())
+    benches = [("json_loads", lambda: json.loads(text))]
+    try:
+        import io
+        import msgpack
+
+        stream = io.BytesIO()
+        msgpack.pack(bm_document(), stream)
+        packed = stream.getvalue()
+        benches.append(("msgpack_unpack", lambda: msgpack.unpack(io.BytesIO(packed))))
+    except ImportError:
+        pass
+    return benches
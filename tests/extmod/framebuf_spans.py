@@ -0,0 +1,73 @@
+# Check span fills, straight lines and same-format blits against pixel-by-pixel drawing.
+try:
+    import framebuf
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+W, H = 21, 13
+
+FORMATS = (
+    ("MONO_VLSB", framebuf.MONO_VLSB, 1, 1),
+    ("MONO_HLSB", framebuf.MONO_HLSB, 1, 8),
+    ("MONO_HMSB", framebuf.MONO_HMSB, 1, 8),
+    ("GS2_HMSB", framebuf.GS2_HMSB, 2, 4),
+    ("GS4_HMSB", framebuf.GS4_HMSB, 4, 2),
+    ("GS8", framebuf.GS8, 8, 1),
+    ("RGB565", framebuf.RGB565, 16, 1),
+)
+
+
+def make(fmt, bpp, align, w, h, seed):
+    stride = (w + 3 + align - 1) // align * align
+    if fmt == framebuf.MONO_VLSB:
+        size = (h + 7) // 8 * stride
+    else:
+        size = stride * h * bpp // 8
+    buf = bytearray((i * 37 + seed) & 0xFF for i in range(size))
+    return framebuf.FrameBuffer(buf, w, h, fmt, stride)
+
+
+def pixels(fb, w, h):
+    return [fb.pixel(x, y) for y in range(h) for x in range(w)]
+
+
+def set_ref(ref, x, y, col):
+    if 0 <= x < W and 0 <= y < H:
+        ref[y * W + x] = col
+
+
+for name, fmt, bpp, align in FORMATS:
+    mask = (1 << bpp) - 1
+    fb = make(fmt, bpp, align, W, H, 1)
+    ref = pixels(fb, W, H)
+    ok = True
+
+    for i, (x, y, w, h) in enumerate(
+        ((0, 0, W, H), (1, 2, 3, 4), (-2, 5, 11, 2), (7, -1, 9, 9), (3, 3, 1, 1), (15, 4, 20, 20))
+    ):
+        col = (i * 0x5A5B + 3) & mask
+        fb.fill_rect(x, y, w, h, col)
+        for yy in range(y, y + h):
+            for xx in range(x, x + w):
+                set_ref(ref, xx, yy, col)
+    ok = ok and pixels(fb, W, H) == ref
+
+    for i, (x1, y1, x2, y2) in enumerate(((2, 1, 18, 1), (19, 12, 4, 12), (5, -3, 5, 20), (-4, 8, 30, 8))):
+        col = (i * 0x3C3D + 1) & mask
+        fb.line(x1, y1, x2, y2, col)
+        for yy in range(min(y1, y2), max(y1, y2) + 1):
+            for xx in range(min(x1, x2), max(x1, x2) + 1):
+                set_ref(ref, xx, yy, col)
+    ok = ok and pixels(fb, W, H) == ref
+
+    src = make(fmt, bpp, align, 17, 11, 2)
+    src_pixels = pixels(src, 17, 11)
+    for x, y in ((0, 0), (8, 8), (3, 5), (-8, -8), (-3, 2)):
+        fb.blit(src, x, y)
+        for yy in range(11):
+            for xx in range(17):
+                set_ref(ref, x + xx, y + yy, src_pixels[yy * 17 + xx])
+    ok = ok and pixels(fb, W, H) == ref
+
+    print(name, ok)
@@ -11,3 +11,7 @@ with open(f"{loc}/data/qr.pgm", "rb") as f:
 decoder = qrio.QRDecoder(320, 240)
 for r in decoder.decode(content):
     print(r)
+
+payload = bytearray(64)
+n = decoder.decode_into(content, payload)
+print(n, payload[:n])
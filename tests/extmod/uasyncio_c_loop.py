@@ -0,0 +1,116 @@
+# Test the C run_until_complete and SingletonGenerator from _uasyncio, driven
+# by the uasyncio package in extmod (boards run the Adafruit asyncio library,
+# which doesn't use them).
+
+import sys
+
+try:
+    import _uasyncio
+
+    _uasyncio.run_until_complete
+    _uasyncio.SingletonGenerator
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+sys.path.insert(0, __file__.rsplit("/", 1)[0] + "/../../extmod")
+try:
+    import uasyncio as asyncio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+print(asyncio.core.run_until_complete is _uasyncio.run_until_complete)
+print(asyncio.core.SingletonGenerator is _uasyncio.SingletonGenerator)
+
+order = []
+
+
+async def sleeper(name, n, ms):
+    for i in range(n):
+        order.append((name, i))
+        await asyncio.sleep_ms(ms)
+    return name
+
+
+async def fail(ms):
+    await asyncio.sleep_ms(ms)
+    raise ValueError("fail")
+
+
+# Tasks are interleaved in the order they are woken, and the main task's
+# return value comes back from run()
+async def main():
+    tasks = [asyncio.create_task(sleeper(name, 3, 0)) for name in "abc"]
+    for t in tasks:
+        print(await t)
+    return "main done"
+
+
+print(asyncio.run(main()))
+print(order)
+
+# Sleeping tasks wake in order of their deadlines
+order = []
+
+
+async def main():
+    await asyncio.gather(sleeper("slow", 2, 60), sleeper("fast", 3, 20))
+
+
+asyncio.run(main())
+print(order)
+
+
+# An exception in an awaited task reaches the awaiting task
+async def main():
+    try:
+        await asyncio.create_task(fail(0))
+    except ValueError as er:
+        print("caught", er)
+
+
+asyncio.run(main())
+
+
+# An exception in a task nobody awaits goes to the exception handler
+def handler(loop, context):
+    print("handler", type(context["exception"]).__name__, context["exception"])
+
+
+async def main():
+    asyncio.get_event_loop().set_exception_handler(handler)
+    asyncio.create_task(fail(0))
+    await asyncio.sleep_ms(10)
+    asyncio.get_event_loop().set_exception_handler(None)
+
+
+asyncio.run(main())
+
+
+# A cancelled task sees CancelledError and the awaiting task does too
+async def main():
+    t = asyncio.create_task(sleeper("cancel", 10, 40))
+    await asyncio.sleep_ms(60)
+    t.cancel()
+    try:
+        await t
+    except asyncio.CancelledError:
+        print("cancelled")
+
+
+order = []
+asyncio.run(main())
+print(order)
+
+
+# An exception in the main task comes out of run()
+async def main():
+    await asyncio.sleep_ms(0)
+    raise KeyError("main")
+
+
+try:
+    asyncio.run(main())
+except KeyError as er:
+    print("KeyError", er)
@@ -0,0 +1,45 @@
+try:
+    try:
+        import ubinascii as binascii
+    except ImportError:
+        import binascii
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# binascii.b2a_base64_into and binascii.a2b_base64_into are CircuitPython-only.
+data = bytes(range(256)) * 3
+for n in (0, 1, 2, 3, 4, 5, 31, 32, 33, 768):
+    out = bytearray(1030)
+    encoded_len = binascii.b2a_base64_into(data[:n], out)
+    encoded = bytes(out[:encoded_len])
+    print(n, encoded_len, encoded + b"\n" == binascii.b2a_base64(data[:n]))
+    back = bytearray(n)
+    print(binascii.a2b_base64_into(encoded, back), back == data[:n])
+
+# Encoding a stream a chunk at a time, with chunk sizes a multiple of 3.
+chunk = bytearray(48)
+out = bytearray(64)
+stream = b""
+for i in range(0, len(data), len(chunk)):
+    chunk[:] = data[i : i + len(chunk)]
+    stream += out[: binascii.b2a_base64_into(chunk, out)]
+print(binascii.a2b_base64(stream) == data)
+
+# Characters outside the alphabet are ignored, as by a2b_base64.
+buf = bytearray(6)
+print(binascii.a2b_base64_into(b"Zm9v\nYmFy\n", buf), buf)
+print(binascii.a2b_base64_into(memoryview(b"Zm9vYg=="), buf), buf)
+
+try:
+    binascii.b2a_base64_into(b"abcd", bytearray(7))
+except ValueError:
+    print("ValueError")
+try:
+    binascii.a2b_base64_into(b"Zm9vYmFy", bytearray(5))
+except ValueError:
+    print("ValueError")
+try:
+    binascii.a2b_base64_into(b"Zm9vY", bytearray(5))
+except ValueError:
+    print("ValueError")
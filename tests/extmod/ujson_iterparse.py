@@ -0,0 +1,46 @@
+try:
+    import json
+    import uio as io
+
+    json.iterparse
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def my_print(s):
+    for event in json.iterparse(io.StringIO(s)):
+        print(event)
+
+
+my_print("1")
+my_print('"abc"')
+my_print("[]")
+my_print("{}")
+my_print('{"a": 1, "b": [true, false, null], "c": {"d": -1.5e2}}')
+my_print('[{"x": [1, [2, {}]]}, "y"]')
+
+# trailing data after the document is left in the stream
+s = io.StringIO("[1] 2")
+print(list(json.iterparse(s)))
+print(s.read())
+
+# a readinto-only object works as a source too
+class Source:
+    def __init__(self, data):
+        self.data = data
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self.data))
+        buf[:n] = self.data[:n]
+        self.data = self.data[n:]
+        return n
+
+
+print(list(json.iterparse(Source(b'{"k": [1, 2]}'))))
+
+for bad in ("", "[1", '{"a"}', "{1: 2}", '{[]: 1}', "]", "nul"):
+    try:
+        list(json.iterparse(io.StringIO(bad)))
+    except ValueError:
+        print("ValueError", repr(bad))
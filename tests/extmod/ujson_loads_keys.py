@@ -0,0 +1,26 @@
+# Test that repeated object keys decode correctly and share one str object
+try:
+    import ujson as json
+except ImportError:
+    try:
+        import json
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+records = json.loads(
+    '[{"sensor_id": 1, "reading": 2.5}, {"sensor_id": 2, "reading": 3.5}, {"reading": 4.5, "sensor_id": 3}]'
+)
+print([sorted(r.items()) for r in records])
+keys = [sorted(r.keys()) for r in records]
+print(keys)
+print(keys[0][1] is keys[1][1], keys[1][1] is keys[2][1])
+
+# keys that collide in the cache, and long keys, still decode correctly
+doc = "{" + ", ".join('"k%d": %d' % (i, i) for i in range(100)) + ', "%s": 1}' % ("x" * 40)
+d = json.loads(doc)
+print(len(d), d["k0"], d["k99"], d["x" * 40])
+
+# a string value equal to a key is still decoded as a value
+d = json.loads('{"a": "a", "b": ["a", {"a": "b"}]}')
+print(d["a"], d["b"])
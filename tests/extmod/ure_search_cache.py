@@ -0,0 +1,50 @@
+# test module-level functions reusing compiled patterns, and searches which
+# skip ahead to a leading literal
+
+try:
+    import ure as re
+except ImportError:
+    try:
+        import re
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+lines = [
+    "INFO boot ok",
+    "WARN temp=71",
+    "ERROR code=12 at x",
+    "INFO temp=65",
+    "",
+]
+
+# more distinct patterns than the cache holds, used repeatedly
+patterns = ["temp=(\\d+)", "code=(\\d+)", "^INFO", "ok$", "x", "(WARN|ERROR)", "[0-9]+"]
+for _ in range(3):
+    for p in patterns:
+        for l in lines:
+            m = re.search(p, l)
+            print(p, repr(l), m and m.group(0))
+
+# leading literal, with and without a match, at the start and end
+for s in ["", "a", "ba", "bbb", "ab", "xxab", "xxa"]:
+    m = re.search("ab", s)
+    print(repr(s), m and m.span())
+    m = re.search("a", s)
+    print(repr(s), m and m.span())
+
+# leading literal inside a group, and a group which may be empty
+print(re.search("(a)(b*)", "xxabbb").groups())
+print(re.search("(e)", "abcde").span(1))
+print(re.search("b*", "aaa").span())
+print(re.search("$", "abc").span())
+
+# same pattern as str and bytes
+print(re.search("b", "abc").group(0))
+print(re.search(b"b", b"abc").group(0))
+print(re.search("b", "abc").group(0))
+
+print(re.sub("o", "0", "foo boo"))
+print(re.sub("o", "0", "foo boo"))
+print(re.match("o", "foo"))
+print(re.match("f", "foo").group(0))
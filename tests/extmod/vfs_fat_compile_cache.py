@@ -0,0 +1,138 @@
+# Test the import compile cache using VfsFat on a RAM device
+
+try:
+    import micropython, sys, uos
+
+    micropython.compile_cache
+    uos.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf):
+        addr = block * self.ERASE_BLOCK_SIZE
+        for i in range(len(buf)):
+            buf[i] = self.data[addr + i]
+
+    def writeblocks(self, block, buf):
+        addr = block * self.ERASE_BLOCK_SIZE
+        for i in range(len(buf)):
+            self.data[addr + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+
+
+# Mount a fresh filesystem at the root, where the cache directory lives
+bdev = RAMBlockDevice(80)
+uos.VfsFat.mkfs(bdev)
+try:
+    uos.umount("/")
+except OSError:
+    pass
+for path in uos.listdir("/"):
+    uos.umount("/" + path)
+uos.mount(uos.VfsFat(bdev), "/")
+uos.chdir("/")
+sys.path.clear()
+sys.path.append("")
+
+
+def write(name, source):
+    with open(name, "w") as f:
+        f.write(source)
+
+
+def load(name="mod"):
+    sys.modules.pop(name, None)
+    mod = __import__(name)
+    print(mod.__file__, mod.f(), micropython.compile_cache_stats())
+    return mod
+
+
+def cache_files():
+    return len([f for f in uos.listdir("/.pycache") if f.endswith(".mpy")])
+
+
+print(micropython.compile_cache())
+micropython.compile_cache(True)
+print(micropython.compile_cache())
+
+# The first import compiles and stores the module, the second loads it
+write("mod.py", "x = 1.5\ndef f():\n    return (x, 'a', b'b', 2**70)\n")
+load()
+print(cache_files())
+load()
+
+# A changed source is compiled again
+write("mod.py", "def f():\n    return 'changed'\n")
+load()
+load()
+print(cache_files())
+
+# A change that keeps the size, within the 2 second resolution of FAT times, is still seen
+write("mod.py", "def f():\n    return 'CHANGED'\n")
+load()
+load()
+
+# A cache file with an incompatible .mpy header is replaced
+cache_file = "/.pycache/" + uos.listdir("/.pycache")[0]
+with open(cache_file, "r+b") as f:
+    data = f.read()
+    f.seek(data.index(b"mod.py") + 6)
+    f.write(b"X")
+load()
+load()
+
+# Modules in packages and with nested functions
+uos.mkdir("pkg")
+write("pkg/__init__.py", "")
+write("pkg/mod.py", "def g(a, *, b=2):\n    return lambda: a + b\ndef f():\n    return g(1)()\n")
+import pkg.mod
+
+print(pkg.mod.f())
+sys.modules.pop("pkg.mod")
+import pkg.mod
+
+print(pkg.mod.f(), micropython.compile_cache_stats())
+print(cache_files())
+
+# Errors still come from the source
+write("bad.py", "def f(:\n")
+for i in range(2):
+    sys.modules.pop("bad", None)
+    try:
+        import bad
+    except SyntaxError:
+        print("SyntaxError", micropython.compile_cache_stats())
+
+# Nothing is stored while the filesystem is read-only
+write("mod2.py", "def f():\n    return 'mod2'\n")
+uos.umount("/")
+uos.mount(uos.VfsFat(bdev), "/", readonly=True)
+load("mod2")
+load("mod2")
+print(cache_files())
+
+# A different optimisation level needs a separate compile
+micropython.opt_level(1)
+load()
+micropython.opt_level(0)
+load()
+
+# With the cache off, modules are compiled and the counts don't change
+micropython.compile_cache(False)
+load()
+print(micropython.compile_cache())
+
+uos.umount("/")
@@ -0,0 +1,84 @@
+# Test seeking in large and fragmented files, which use a cluster link map
+
+try:
+    import uos
+
+    uos.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        buf[:] = self.data[start : start + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(200)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, "/ramdisk")
+uos.chdir("/ramdisk")
+
+
+def chunk(name, i):
+    return bytes((i * 7 + ord(name) + j) & 0xFF for j in range(512))
+
+
+# Appending to two files in turn interleaves their clusters, so each ends up
+# in many fragments.
+for i in range(12):
+    for name in "ab":
+        with open(name, "ab") as f:
+            f.write(chunk(name, i))
+
+with open("c", "wb") as f:
+    for i in range(12):
+        f.write(chunk("c", i))
+
+for name in "abc":
+    with open(name, "rb") as f:
+        ok = True
+        for i in (11, 3, 7, 0, 10, 5, 5, 1):
+            f.seek(i * 512 + 100)
+            ok = ok and f.read(8) == chunk(name, i)[100:108]
+        f.seek(-4, 2)
+        ok = ok and f.read() == chunk(name, 11)[-4:]
+        f.seek(512 * 4 + 500)
+        ok = ok and f.read(24) == chunk(name, 4)[500:] + chunk(name, 5)[:12]
+        print(name, ok, f.tell())
+
+# Files that are written can still seek.
+with open("a", "r+b") as f:
+    f.seek(512 * 9 + 1)
+    f.write(b"xyz")
+    f.seek(512 * 2)
+    print(f.read(4) == chunk("a", 2)[:4])
+with open("a", "rb") as f:
+    f.seek(512 * 9)
+    print(f.read(5) == chunk("a", 9)[:1] + b"xyz" + chunk("a", 9)[4:5])
+
+uos.umount("/ramdisk")
@@ -0,0 +1,61 @@
+# Test for VfsLfs2 using a RAM device, cachesize argument
+
+try:
+    import uos
+
+    uos.VfsLfs2
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 1024
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+        self.reads = 0
+
+    def readblocks(self, block, buf, off):
+        self.reads += 1
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        for i in range(len(buf)):
+            buf[i] = self.data[addr + i]
+
+    def writeblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        for i in range(len(buf)):
+            self.data[addr + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+def read_count(cachesize):
+    bdev = RAMBlockDevice(30)
+    uos.VfsLfs2.mkfs(bdev, cachesize=cachesize)
+    fs = uos.VfsLfs2(bdev, cachesize=cachesize)
+    with fs.open("test", "w") as f:
+        f.write("x" * 2000)
+    bdev.reads = 0
+    with fs.open("test", "r") as f:
+        data = f.read()
+    print(len(data), data == "x" * 2000)
+    return bdev.reads
+
+
+# A larger cache needs fewer reads of the block device.
+print(read_count(1024) < read_count(128))
+print(read_count(0) == read_count(128))
+
+# The cache must be a multiple of readsize and progsize, and divide the block size.
+for cachesize in (48, 96, 3 * 1024):
+    try:
+        uos.VfsLfs2(RAMBlockDevice(30), cachesize=cachesize)
+    except ValueError:
+        print("ValueError", cachesize)
@@ -0,0 +1,4 @@
+# test that for-loops over range in an imported module use a range assigned later in it
+import import_range_shadow2
+
+import_range_shadow2.f4()
@@ -0,0 +1,27 @@
+# a top-level function with a range loop, followed by a module-level assignment to range
+
+
+def myrange(*args):
+    print("myrange", args)
+    return [10, 20]
+
+
+def f3():
+    for i in range(2):
+        print("f3", i)
+
+
+class C:
+    def f(self):
+        for i in range(2):
+            print("C.f", i)
+
+
+def f4():
+    for i in range(2):
+        print("f4", i)
+
+
+range = myrange
+f3()
+C().f()
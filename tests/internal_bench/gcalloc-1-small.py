@@ -0,0 +1,9 @@
+import bench
+
+
+def test(num):
+    for i in range(num // 1000):
+        x = bytearray(16)
+
+
+bench.run(test)
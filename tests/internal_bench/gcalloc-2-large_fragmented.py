@@ -0,0 +1,17 @@
+import bench
+
+
+# Keep every other small object alive so that the heap is fragmented and large
+# allocations have to search past many short free runs.
+keep = []
+for i in range(2000):
+    keep.append(bytearray(32))
+    bytearray(32)
+
+
+def test(num):
+    for i in range(num // 1000):
+        x = bytearray(1024)
+
+
+bench.run(test)
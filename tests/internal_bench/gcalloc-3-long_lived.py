@@ -0,0 +1,15 @@
+import bench
+
+
+# Module attributes are moved to the long lived area. Fill it with objects so that
+# a full collection has a lot more to trace and sweep than the short lived garbage.
+for i in range(3000):
+    setattr(bench, "a%d" % i, (i, i + 1, i + 2, i + 3, i + 4, i + 5))
+
+
+def test(num):
+    for i in range(num // 100):
+        x = [i, i + 1]
+
+
+bench.run(test)
@@ -0,0 +1,20 @@
+import bench
+
+
+# Free one object in every three so that most of the heap is short free runs
+# between live objects, as it is after a sweep in a long running program.
+keep = []
+for i in range(3000):
+    keep.append(bytearray(20))
+for i in range(0, 3000, 3):
+    keep[i] = None
+
+
+def test(num):
+    x = 1.5
+    for i in range(num // 100):
+        x = x * 1.0000001 + 0.5
+        y = (x, i)
+
+
+bench.run(test)
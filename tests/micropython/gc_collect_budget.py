@@ -0,0 +1,43 @@
+# test gc.collect with a sweep budget
+
+import gc
+
+try:
+    gc.collect(budget_us=0)
+except TypeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class A:
+    def __init__(self, n):
+        self.n = n
+
+    def __del__(self):
+        pass
+
+
+def make_garbage():
+    for i in range(200):
+        A(i)
+        bytearray(i)
+
+
+# live objects must survive a sweep that is left pending
+keep = [bytearray([i]) * (i + 1) for i in range(100)]
+make_garbage()
+gc.collect(budget_us=0)
+
+# allocating while the sweep is pending mustn't lose the new objects either
+more = [A(i) for i in range(100)]
+make_garbage()
+gc.collect(budget_us=0)
+gc.collect()
+
+print(all(keep[i] == bytearray([i]) * (i + 1) for i in range(100)))
+print(sum(a.n for a in more))
+
+try:
+    gc.collect(budget_us=-1)
+except ValueError:
+    print("ValueError")
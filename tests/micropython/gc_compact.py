@@ -0,0 +1,40 @@
+# test gc.compact moving buffers without breaking references to them
+
+import gc
+
+try:
+    gc.compact
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+import array
+
+# interleave buffers that are kept with ones that are dropped
+gaps = []
+keep = []
+for i in range(40):
+    gaps.append(bytearray(200))
+    keep.append(bytearray([i]) * (100 + i))
+    gaps.append(bytearray(200))
+    keep.append(array.array("i", range(i, i + 30)))
+    gaps.append(bytearray(200))
+    keep.append([i] * (20 + i))
+pinned = keep[-3]
+view = memoryview(pinned)
+gaps = None
+
+print(gc.compact() > 0)
+
+# reuse freed memory so that anything left pointing at it would see new data
+junk = [bytearray(b"\xff" * 200) for i in range(100)]
+
+ok = True
+for i in range(40):
+    ok = ok and keep[3 * i] == bytearray([i]) * (100 + i)
+    ok = ok and list(keep[3 * i + 1]) == list(range(i, i + 30))
+    ok = ok and keep[3 * i + 2] == [i] * (20 + i)
+print(ok)
+print(view[0] == 39, bytes(view) == bytes(pinned))
+keep[-3][0] = 7
+print(view[0])
@@ -0,0 +1,27 @@
+# test gc.stats counting collections and the work they do
+
+import gc
+
+try:
+    gc.stats
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+stats = gc.stats()
+print(len(stats))
+collections, total_pause_us, max_pause_us, marked_blocks, overflows, swept_bytes = stats
+
+# create some garbage to sweep and some live data to mark
+keep = [bytearray(100) for i in range(20)]
+junk = [bytearray(100) for i in range(20)]
+junk = None
+gc.collect()
+gc.collect()
+
+after = gc.stats()
+print(after[0] - collections >= 2)
+print(after[1] >= total_pause_us, after[2] >= max_pause_us, after[1] >= after[2])
+print(after[3] - marked_blocks >= 2 * 20)
+print(after[4] >= overflows)
+print(after[5] - swept_bytes >= 20 * 100)
@@ -0,0 +1,160 @@
+# test lazy loading of functions in .mpy files imported from a filesystem
+
+try:
+    import micropython, sys, uos
+
+    micropython.heap_lock
+    uos.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf):
+        addr = block * self.ERASE_BLOCK_SIZE
+        for i in range(len(buf)):
+            buf[i] = self.data[addr + i]
+
+    def writeblocks(self, block, buf):
+        addr = block * self.ERASE_BLOCK_SIZE
+        for i in range(len(buf)):
+            self.data[addr + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+
+
+# these are the bytes of mod.mpy, compiled from:
+# def probe():
+#     return 1
+#
+#
+# def f(a, b=2, *, c=3):
+#     return a + b + c
+#
+#
+# def gen(n):
+#     for i in range(n):
+#         yield i * i
+#
+#
+# def outer(x):
+#     def inner(y):
+#         return x + y
+#
+#     return inner
+#
+#
+# class C:
+#     def __init__(self, v):
+#         self.v = v
+#
+#     def get(self):
+#         return [self.v + i for i in range(2)]
+#
+#
+# def err():
+#     raise ValueError("err")
+#
+#
+# def late():
+#     return "late"
+#
+#
+# def changed():
+#     return "abc"
+mod_mpy = (
+    b"C\x05\x02\x1f \x82<\x18&\x00\x07\x0cmod.pye o e@\x85\x07\x8b\x08e e \x002\x00\x16\nprobe\x82*\x01,\x00\x83"
+    b"\x10\x02cb3\x01\x16\x02f2\x02\x16\x06gen2\x03\x16\nouterT2\x04\x10\x02C4\x02\x16\x012\x05\x16\x06err2\x06\x16\x08la"
+    b"te2\x07\x16\x0echangedQc\x00\x08(\x00\x0c\x11\x13 \x00\x81c\x00\x00L\xa2\x89\x80\x80@\x0e\x11\x03`@\x00\xb0\xb1\xf2\xb2\xf2c\x00\x00"
+    b"\x02a\x02b\x17\x81\x0c\xa9@\x10\x17\t\x80\t'\x00\xb0\x80B\t\x80W\xc1\xb1\xb1\xf4gY\x81\xe5XZ\xd7C\xf1\x7fYYQc\x00\x00\x02nH\x11\x11\x19"
+    b"\x05\x80\x0ee\x00\x00\xb0 \x01\x01\xc1\xb1c\x00\x01\x02x8\x1a\x0e\ninner\x05\x80\x0f\x00%\x00\xb1\xf2c\x00\x00\x00\x05\x02y\x81\x08\x00\x10\x1f\x05\x8c"
+    b"\x15e\x00\x11\x00\x17\x16\x00\x16\x10\x03\x16\x00\x1a2\x00\x16\x00\x112\x01\x16\x00VQc\x00\x02@\x1a\x0e\x00\x11\x03\x80\x16\x00\xb1\xb0\x18\x02vQc\x00\x00\x00\x89"
+    b"\x01\\\x19\x0f\x00V\x03\x80\x19\x00\x00\xb0 \x01\x01\x12\x00|\x824\x014\x01c\x00\x01\x00\x89xJ\x0e\x14<listcomp>\x03\x80\x19\x00+\x00"
+    b"\xb1_K\r\x00\xc2%\x00\x13\x05\xb2\xf2/\x14B\xf0\x7fc\x00\x00\x00\x05\x00\x05P\x08\x0e#\x05\x80\x1d\x00\x12\x007\x10\x034\x01eQc\x00\x004\x00\x0e#"
+    b"\x05\x80!\x00\x10\x03c\x00\x004\x00\x0e#\x05\x80%\x00\x10\x06abcc\x00\x00"
+)
+
+bdev = RAMBlockDevice(50)
+uos.VfsFat.mkfs(bdev)
+try:
+    uos.umount("/")
+except OSError:
+    pass
+for path in uos.listdir("/"):
+    uos.umount("/" + path)
+uos.mount(uos.VfsFat(bdev), "/")
+uos.chdir("/")
+uos.mkdir("sub")
+sys.path.clear()
+sys.path.append("")
+
+
+def write(data):
+    with open("/mod.mpy", "wb") as f:
+        f.write(data)
+
+
+write(mod_mpy)
+import mod
+
+# a function that is still in the file needs the heap for its first call
+lazy = True
+micropython.heap_lock()
+try:
+    mod.probe()
+    lazy = False
+except MemoryError:
+    pass
+micropython.heap_unlock()
+if not lazy:
+    print("SKIP")
+    raise SystemExit
+print(mod.probe())
+
+# functions, generators, closures and methods
+print(mod.f.__name__, mod.f(1), mod.f(1, c=10), mod.f(b=0, a=1))
+print(list(mod.gen(4)), list(mod.gen(2)))
+print(mod.outer(1)(2), mod.outer(3)(4))
+print(mod.C(5).get())
+try:
+    mod.err()
+except ValueError as er:
+    print(repr(er))
+
+# the file is found again after the current directory changes
+uos.chdir("/sub")
+print(mod.late())
+uos.chdir("/")
+
+# functions that are loaded keep working when the file is gone, other ones
+# can't be loaded until it is back
+uos.rename("/mod.mpy", "/mod2.mpy")
+print(mod.f(2), mod.outer(5)(6))
+try:
+    mod.changed()
+except OSError:
+    print("OSError")
+uos.rename("/mod2.mpy", "/mod.mpy")
+
+# a function can't be loaded from a file that has changed
+data = bytearray(mod_mpy)
+data[data.index(b"abc") + 2] = ord("d")
+write(data)
+try:
+    mod.changed()
+except RuntimeError as er:
+    print(repr(er))
+write(mod_mpy)
+print(mod.changed())
+
+uos.umount("/")
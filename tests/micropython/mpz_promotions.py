@@ -0,0 +1,28 @@
+# test micropython.mpz_promotions
+
+import micropython
+
+try:
+    micropython.mpz_promotions
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+micropython.mpz_promotions(0)
+print(micropython.mpz_promotions())
+
+# small int arithmetic doesn't make an mpz
+x = 0
+for i in range(100):
+    x += i * 3
+print(x, micropython.mpz_promotions())
+
+# overflowing does
+a = 1
+b = 1 << 40
+x = a << 70
+y = b * b
+print(x, y, micropython.mpz_promotions() >= 2)
+
+micropython.mpz_promotions(0)
+print(micropython.mpz_promotions())
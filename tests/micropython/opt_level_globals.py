@@ -0,0 +1,97 @@
+# test the module-level optimisations done at opt_level 2
+import micropython
+
+micropython.opt_level(2)
+
+
+def run(code):
+    ns = {}
+    exec(code, ns)
+    return sorted(k for k in ns if k != "__builtins__")
+
+
+# constants are propagated into functions, dead branches are dropped and a
+# private constant is not stored
+print(
+    run(
+        """
+DEBUG = False
+LIMIT = 3
+NAME = "abc"
+_PRIVATE = 7
+
+def f(x):
+    if DEBUG:
+        print("debug")
+    elif not DEBUG:
+        print("not debug")
+    while DEBUG:
+        pass
+    return x + LIMIT + _PRIVATE, NAME
+
+print(f(1))
+"""
+    )
+)
+
+# a constant that is reassigned is not propagated
+run(
+    """
+MODE = 1
+def g():
+    return MODE
+MODE = 2
+print(g())
+"""
+)
+
+# a parameter shadows a constant
+run(
+    """
+VAL = 10
+def h(VAL):
+    return VAL
+print(h(5))
+"""
+)
+
+# a constant used at the top level before it is assigned still raises
+run(
+    """
+try:
+    print(EARLY)
+except NameError:
+    print("NameError")
+EARLY = 1
+print(EARLY)
+"""
+)
+
+# an unused private function is left out, a used one is kept
+print(
+    run(
+        """
+def _unused():
+    pass
+def _used():
+    return 1
+def public():
+    return _used()
+print(public())
+"""
+    )
+)
+
+# globals() disables the optimisations
+print(
+    run(
+        """
+_K = 4
+def _unused():
+    pass
+print(_K * 2, "_K" in globals())
+"""
+    )
+)
+
+micropython.opt_level(0)
@@ -0,0 +1,41 @@
+# Random read latency: read 512-byte blocks at pseudo-random offsets.
+
+import os
+
+FILENAME = "io_bench.tmp"
+BLOCK = 512
+
+
+def bm_setup(params):
+    nblocks, nreads = params
+    buf = bytearray(BLOCK)
+    with open(FILENAME, "wb") as f:
+        for i in range(nblocks):
+            buf[0] = i & 0xFF
+            f.write(buf)
+    check = [0]
+
+    def run():
+        seed = 1
+        total = 0
+        with open(FILENAME, "rb") as f:
+            for _ in range(nreads):
+                # Small LCG, so the arithmetic stays in small ints on boards.
+                seed = (seed * 75 + 74) % 65537
+                f.seek(seed % nblocks * BLOCK)
+                f.readinto(buf)
+                total += buf[0]
+        check[0] = total
+
+    def result():
+        os.remove(FILENAME)
+        return nreads, check[0]
+
+    return run, result
+
+
+bm_params = {
+    (50, 10): (32, 64),
+    (100, 100): (128, 256),
+    (1000, 1000): (2048, 4096),
+}
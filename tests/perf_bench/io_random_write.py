@@ -0,0 +1,37 @@
+# Random write latency: overwrite 512-byte blocks at pseudo-random offsets.
+
+import os
+
+FILENAME = "io_bench.tmp"
+BLOCK = 512
+
+
+def bm_setup(params):
+    nblocks, nwrites = params
+    buf = bytearray(BLOCK)
+    with open(FILENAME, "wb") as f:
+        for _ in range(nblocks):
+            f.write(buf)
+
+    def run():
+        seed = 1
+        with open(FILENAME, "r+b") as f:
+            for i in range(nwrites):
+                seed = (seed * 75 + 74) % 65537
+                f.seek(seed % nblocks * BLOCK)
+                buf[0] = i & 0xFF
+                f.write(buf)
+
+    def result():
+        size = os.stat(FILENAME)[6]
+        os.remove(FILENAME)
+        return nwrites, size
+
+    return run, result
+
+
+bm_params = {
+    (50, 10): (32, 64),
+    (100, 100): (128, 256),
+    (1000, 1000): (2048, 4096),
+}
@@ -0,0 +1,38 @@
+# Sequential read throughput: read a file back in fixed-size chunks.
+
+import os
+
+FILENAME = "io_bench.tmp"
+
+
+def bm_setup(params):
+    size, chunk = params
+    buf = bytearray(i & 0xFF for i in range(chunk))
+    with open(FILENAME, "wb") as f:
+        for _ in range(size // chunk):
+            f.write(buf)
+
+    total = [0]
+
+    def run():
+        n_read = 0
+        with open(FILENAME, "rb") as f:
+            while True:
+                n = f.readinto(buf)
+                if not n:
+                    break
+                n_read += n
+        total[0] = n_read
+
+    def result():
+        os.remove(FILENAME)
+        return size, (total[0], buf[chunk - 1])
+
+    return run, result
+
+
+bm_params = {
+    (50, 10): (16384, 512),
+    (100, 100): (65536, 512),
+    (1000, 1000): (1048576, 4096),
+}
@@ -0,0 +1,30 @@
+# Sequential write throughput: write a file in fixed-size chunks and close it.
+# Run from a writable directory; on a board CIRCUITPY must be writable by Python.
+
+import os
+
+FILENAME = "io_bench.tmp"
+
+
+def bm_setup(params):
+    size, chunk = params
+    buf = bytes(i & 0xFF for i in range(chunk))
+
+    def run():
+        with open(FILENAME, "wb") as f:
+            for _ in range(size // chunk):
+                f.write(buf)
+
+    def result():
+        written = os.stat(FILENAME)[6]
+        os.remove(FILENAME)
+        return size, written
+
+    return run, result
+
+
+bm_params = {
+    (50, 10): (16384, 512),
+    (100, 100): (65536, 512),
+    (1000, 1000): (1048576, 4096),
+}
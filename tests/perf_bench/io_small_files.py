@@ -0,0 +1,31 @@
+# Metadata cost: create a batch of small files, then delete them.
+
+import os
+
+PREFIX = "io_bench_"
+
+
+def bm_setup(params):
+    nfiles, size = params
+    data = bytes(size)
+    names = ["%s%d.tmp" % (PREFIX, i) for i in range(nfiles)]
+
+    def run():
+        for name in names:
+            with open(name, "wb") as f:
+                f.write(data)
+        for name in names:
+            os.remove(name)
+
+    def result():
+        left = sum(1 for name in os.listdir() if name.startswith(PREFIX))
+        return nfiles, left
+
+    return run, result
+
+
+bm_params = {
+    (50, 10): (8, 64),
+    (100, 100): (32, 64),
+    (1000, 1000): (256, 64),
+}
@@ -0,0 +1,51 @@
+# Coroutine churn: run many short-lived coroutines to completion, keeping the
+# finished ones referenced the way a list of uasyncio Tasks would.
+
+
+async def leaf(x):
+    return x + 1
+
+
+async def worker(n, size):
+    buf = [None] * size
+    total = 0
+    for i in range(n):
+        total += await leaf(i)
+    buf[0] = total
+    return buf[0]
+
+
+def run_to_completion(coro):
+    try:
+        while True:
+            coro.send(None)
+    except StopIteration as er:
+        return er.value
+
+
+def bm_setup(params):
+    ntasks, nawait, size = params
+    state = [None, None]
+
+    def run():
+        done = []
+        total = 0
+        for i in range(ntasks):
+            coro = worker(nawait, size)
+            total += run_to_completion(coro)
+            done.append(coro)
+        state[0] = total
+        state[1] = len(done)
+
+    def result():
+        return ntasks * nawait, (state[0], state[1])
+
+    return run, result
+
+
+bm_params = {
+    (50, 10): (20, 10, 16),
+    (100, 100): (100, 20, 32),
+    (1000, 1000): (500, 40, 64),
+    (5000, 1000): (1000, 40, 128),
+}
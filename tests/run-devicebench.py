@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+
+# This file is part of the MicroPython project, http://micropython.org/
+# The MIT License (MIT)
+# Copyright (c) 2026 Adafruit Industries
+
+# Runs the device_bench scripts on a board and collects their JSON lines, so
+# results can be kept per release and compared later.
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+sys.path.append("../tools")
+import pyboard
+
+MICROPYTHON = os.getenv("MICROPY_MICROPYTHON", "../ports/unix/micropython")
+
+BENCH_SCRIPT_DIR = "device_bench/"
+
+
+def run_script(target, script):
+    if isinstance(target, pyboard.Pyboard):
+        target.enter_raw_repl()
+        try:
+            return target.exec_(script)
+        finally:
+            target.exit_raw_repl()
+    p = subprocess.run(target, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, input=script)
+    return p.stdout
+
+
+def run_benchmarks(target, tests, repeat):
+    with open(BENCH_SCRIPT_DIR + "benchrun.py", "rb") as f:
+        benchrun = f.read()
+    results = []
+    for test_file in tests:
+        with open(test_file, "rb") as f:
+            script = f.read()
+        script += b"\n" + benchrun + b"\nbm_main(%d)\n" % repeat
+        try:
+            output = run_script(target, script)
+        except pyboard.PyboardError as er:
+            print("{}: CRASH {}".format(test_file, er), file=sys.stderr)
+            continue
+        for line in output.decode("utf-8", "replace").splitlines():
+            try:
+                result = json.loads(line)
+            except ValueError:
+                print("{}: {}".format(test_file, line), file=sys.stderr)
+                continue
+            print(line)
+            results.append(result)
+        if not output.strip():
+            print("{}: skipped".format(test_file), file=sys.stderr)
+    return results
+
+
+def load(path):
+    with open(path) as f:
+        return {r["bench"]: r for r in (json.loads(line) for line in f if line.strip())}
+
+
+def compare(old_path, new_path):
+    old = load(old_path)
+    new = load(new_path)
+    print("{:24} {:>12} {:>12} {:>8}".format("bench", "old s", "new s", "change"))
+    for name in sorted(set(old) | set(new)):
+        if name not in old or name not in new:
+            print("{:24} {}".format(name, "missing from " + (old_path if name in new else new_path)))
+            continue
+        a = old[name]["seconds"]
+        b = new[name]["seconds"]
+        change = 100 * (b - a) / a if a else 0
+        print("{:24} {:12.6f} {:12.6f} {:+7.1f}%".format(name, a, b, change))
+
+
+def main():
+    cmd_parser = argparse.ArgumentParser(description="Run on-device benchmarks")
+    cmd_parser.add_argument(
+        "-p", "--pyboard", action="store_true", help="run tests via pyboard.py"
+    )
+    cmd_parser.add_argument(
+        "-d", "--device", default="/dev/ttyACM0", help="the device for pyboard.py"
+    )
+    cmd_parser.add_argument("-r", "--repeat", default="5", help="runs per bench, fastest kept")
+    cmd_parser.add_argument("-o", "--output", help="also write the JSON lines to this file")
+    cmd_parser.add_argument(
+        "-c", "--compare", nargs=2, metavar=("OLD", "NEW"), help="compare two saved runs"
+    )
+    cmd_parser.add_argument("files", nargs="*", help="input test files")
+    args = cmd_parser.parse_args()
+
+    if args.compare:
+        compare(*args.compare)
+        sys.exit(0)
+
+    if args.pyboard:
+        target = pyboard.Pyboard(args.device)
+    else:
+        target = [MICROPYTHON, "-X", "emit=bytecode"]
+
+    if len(args.files) == 0:
+        tests = sorted(
+            BENCH_SCRIPT_DIR + test_file
+            for test_file in os.listdir(BENCH_SCRIPT_DIR)
+            if test_file.endswith(".py") and test_file != "benchrun.py"
+        )
+    else:
+        tests = sorted(args.files)
+
+    results = run_benchmarks(target, tests, int(args.repeat))
+
+    if args.output:
+        with open(args.output, "w") as f:
+            for result in results:
+                f.write(json.dumps(result) + "\n")
+
+    if args.pyboard:
+        target.close()
+
+
+if __name__ == "__main__":
+    main()
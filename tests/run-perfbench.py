@@ -5,6 +5,7 @@
 # Copyright (c) 2019 Damien P. George
 
 import os
+import re
 import subprocess
 import sys
 import time
@@ -88,6 +89,25 @@ def run_feature_test(target, test):
         return "CRASH: %r" % err
 
 
+def apply_emitter(script, emit):
+    # Targets reached via pyboard.py have no way to set the default emitter, so
+    # decorate every function that doesn't already choose one.
+    lines = script.split(b"\n")
+    out = []
+    for i, line in enumerate(lines):
+        m = re.match(rb"(\s*)def ", line)
+        if m and not (i and lines[i - 1].lstrip().startswith(b"@")):
+            out.append(m.group(1) + b"@micropython." + emit.encode())
+        out.append(line)
+    return b"\n".join(out)
+
+
+def make_target(args, emit):
+    if args.pyboard:
+        return args.pyboard_target
+    return [MICROPYTHON, "-X", "emit=" + emit]
+
+
 def run_benchmark_on_target(target, script, run_command=None):
     output, err, runtime_us = run_script_on_target(target, script, run_command)
     if err is None:
@@ -100,15 +120,48 @@ def run_benchmark_on_target(target, script, run_command=None):
         return -1, -1, "CRASH: %r" % err, runtime_us
 
 
-def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
+def run_benchmark(target, test_script, bm_run, n_average):
+    # Run MicroPython a given number of times
+    times = []
+    runtimes = []
+    scores = []
+    result_out = None
+    for _ in range(n_average):
+        self_time, norm, result, runtime_us = run_benchmark_on_target(target, test_script, bm_run)
+        if self_time < 0 or norm < 0:
+            return None, result
+        if result_out is None:
+            result_out = result
+        elif result != result_out:
+            return None, "FAIL self"
+        times.append(self_time)
+        runtimes.append(runtime_us)
+        scores.append(1e6 * norm / self_time)
+
+    # Check result against truth if needed
+    if result_out != "None":
+        _, _, result_exp, _ = run_benchmark_on_target(PYTHON_TRUTH, test_script, bm_run)
+        if result_out != result_exp:
+            return None, "FAIL truth"
+
+    return (compute_stats(times), compute_stats(scores), compute_stats(runtimes)), None
+
+
+def run_benchmarks(console, args, param_n, param_m, n_average, test_list):
+    emitters = args.emit.split(",")
+    target = make_target(args, emitters[0])
     skip_complex = run_feature_test(target, "complex") != "complex"
     skip_native = run_feature_test(target, "native_check") != "native"
 
     table = Table(show_header=True)
     table.add_column("Test")
-    table.add_column("Time", justify="right")
-    table.add_column("Score", justify="right")
-    table.add_column("Ref Time", justify="right")
+    for emit in emitters:
+        suffix = "" if len(emitters) == 1 else " " + emit
+        table.add_column("Time" + suffix, justify="right")
+        table.add_column("Score" + suffix, justify="right")
+        table.add_column("Ref Time" + suffix, justify="right")
+        if emit != emitters[0]:
+            table.add_column("Speedup " + emit, justify="right")
 
     live = Live(table, console=console)
     live.start()
@@ -125,74 +178,60 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
         )
         if skip:
             print("skip")
-            table.add_row(test_file, *(["skip"] * 6))
+            table.add_row(test_file, *(["skip"] * (len(table.columns) - 1)))
             continue
 
         # Create test script
         with open(test_file, "rb") as f:
             test_script = f.read()
         with open(BENCH_SCRIPT_DIR + "benchrun.py", "rb") as f:
-            test_script += f.read()
+            bench_script = f.read()
         bm_run = b"bm_run(%u, %u)\n" % (param_n, param_m)
 
         # Write full test script if needed
         if 0:
             with open("%s.full" % test_file, "wb") as f:
-                f.write(test_script)
-
-        # Run MicroPython a given number of times
-        times = []
-        runtimes = []
-        scores = []
-        error = None
-        result_out = None
-        for _ in range(n_average):
-            self_time, norm, result, runtime_us = run_benchmark_on_target(
-                target, test_script, bm_run
+                f.write(test_script + bench_script)
+
+        row = [test_file]
+        base_time = None
+        for emit in emitters:
+            cells = 4 if emit != emitters[0] else 3
+            if emit != "bytecode" and skip_native:
+                row += ["skip"] * cells
+                continue
+            script = test_script
+            if args.pyboard and emit != "bytecode":
+                script = apply_emitter(script, emit)
+            stats, error = run_benchmark(
+                make_target(args, emit), script + bench_script, bm_run, n_average
             )
-            if self_time < 0 or norm < 0:
-                error = result
-                break
-            if result_out is None:
-                result_out = result
-            elif result != result_out:
-                error = "FAIL self"
-                break
-            times.append(self_time)
-            runtimes.append(runtime_us)
-            scores.append(1e6 * norm / self_time)
-
-        # Check result against truth if needed
-        if error is None and result_out != "None":
-            _, _, result_exp, _ = run_benchmark_on_target(PYTHON_TRUTH, test_script, bm_run)
-            if result_out != result_exp:
-                error = "FAIL truth"
-
-        if error is not None:
-            print(test_file, error)
-            if error == "no matching params":
-                table.add_row(test_file, *([None] * 3))
-            else:
-                table.add_row(test_file, *(["error"] * 3))
-        else:
-            t_avg, t_sd = compute_stats(times)
-            r_avg, r_sd = compute_stats(runtimes)
-            s_avg, s_sd = compute_stats(scores)
+
+            if error is not None:
+                print(test_file, emit, error)
+                if error == "no matching params":
+                    row += [None] * cells
+                else:
+                    row += ["error"] * cells
+                continue
+
+            (t_avg, t_sd), (s_avg, s_sd), (r_avg, r_sd) = stats
             # print(
             #     "{:.2f} {:.4f} {:.2f} {:.4f} {:.2f} {:.4f}".format(
             #         t_avg, 100 * t_sd / t_avg, s_avg, 100 * s_sd / s_avg, r_avg, 100 * r_sd / r_avg
             #     )
             # )
-            table.add_row(
-                test_file,
+            row += [
                 f"{t_avg:.2f}±{100 * t_sd / t_avg:.1f}%",
                 f"{s_avg:.2f}±{100 * s_sd / s_avg:.1f}%",
                 f"{r_avg:.2f}±{100 * r_sd / r_avg:.1f}%",
-            )
-            if 0:
-                print("  times: ", times)
-                print("  scores:", scores)
+            ]
+            if emit == emitters[0]:
+                base_time = t_avg
+            else:
+                row.append(f"{base_time / t_avg:.2f}x" if base_time else None)
 
+        table.add_row(*row)
         live.update(table, refresh=True)
     live.stop()
 
@@ -274,7 +313,9 @@ def main():
     )
     cmd_parser.add_argument("-a", "--average", default="8", help="averaging number")
     cmd_parser.add_argument(
-        "--emit", default="bytecode", help="MicroPython emitter to use (bytecode or native)"
+        "--emit",
+        default="bytecode",
+        help="comma separated MicroPython emitters to compare (bytecode, native or viper)",
     )
     cmd_parser.add_argument("N", nargs=1, help="N parameter (approximate target CPU frequency)")
     cmd_parser.add_argument("M", nargs=1, help="M parameter (approximate target heap in kbytes)")
@@ -293,10 +334,8 @@ def main():
     n_average = int(args.average)
 
     if args.pyboard:
-        target = pyboard.Pyboard(args.device)
-        target.enter_raw_repl()
-    else:
-        target = [MICROPYTHON, "-X", "emit=" + args.emit]
+        args.pyboard_target = pyboard.Pyboard(args.device)
+        args.pyboard_target.enter_raw_repl()
 
     if len(args.files) == 0:
         tests_skip = ("benchrun.py",)
@@ -314,11 +353,11 @@ def main():
     console = Console()
     print("N={} M={} n_average={}".format(N, M, n_average))
 
-    run_benchmarks(console, target, N, M, n_average, tests)
+    run_benchmarks(console, args, N, M, n_average, tests)
 
-    if isinstance(target, pyboard.Pyboard):
-        target.exit_raw_repl()
-        target.close()
+    if args.pyboard:
+        args.pyboard_target.exit_raw_repl()
+        args.pyboard_target.close()
 
 
 if __name__ == "__main__":
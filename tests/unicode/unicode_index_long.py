@@ -0,0 +1,31 @@
+# test indexing and slicing long str, which use an ASCII flag or a character
+# offset index instead of walking the UTF-8 data
+
+ascii = "".join(chr(ord("a") + i % 26) for i in range(300))
+mixed = "".join(chr(ord("a") + i % 26) if i % 3 else chr(0x3B1 + i % 20) for i in range(300))
+wide = "".join(chr(0x1F600 + i % 40) for i in range(300))
+
+for s in (ascii, mixed, wide):
+    print(len(s))
+    print([ord(s[i]) for i in (0, 1, 31, 32, 33, 63, 64, 150, 298, 299)])
+    print([ord(s[i]) for i in (-1, -2, -32, -33, -150, -299, -300)])
+    print(s[30:35] == "".join(s[i] for i in range(30, 35)))
+    print(len(s[-40:]), len(s[100:]), len(s[250:400]), len(s[-400:5]))
+    print(s.find(s[200:205], 100), s.startswith(s[64:70], 64))
+    for i in (300, -301, 1000):
+        try:
+            s[i]
+        except IndexError:
+            print("IndexError", i)
+
+# every character of a non-ASCII str, in order and in reverse
+r = "".join(mixed[i] for i in range(len(mixed)))
+print(r == mixed)
+r = [mixed[i] for i in range(-1, -len(mixed) - 1, -1)]
+r.reverse()
+print("".join(r) == mixed)
+
+# str made from bytes, which is indexed without an ASCII flag
+for s in (ascii, mixed):
+    d = str(bytes(s, "utf-8"), "utf-8")
+    print(d[299] == s[299], d[-300] == s[-300], d[100:110] == s[100:110])
@@ -71,7 +71,7 @@ def include(manifest, **kwargs):
             os.chdir(prev_cwd)
 
 
-def freeze(path, script=None, opt=0):
+def freeze(path, script=None, opt=0, native=False, viper=False):
     """Freeze the input, automatically determining its type.  A .py script
     will be compiled to a .mpy first then frozen, and a .mpy file will be
     frozen directly.
@@ -97,9 +97,15 @@ def freeze(path, script=None, opt=0):
 
     `opt` is the optimisation level to pass to mpy-cross when compiling .py
     to .mpy.
+
+    If `native` or `viper` is true then .py scripts are compiled to machine
+    code for the port's architecture with that emitter, instead of to
+    bytecode.  Freezing the same script again replaces the earlier entry, so
+    a directory can be frozen as bytecode and then some of its modules frozen
+    again as native code.
     """
 
-    freeze_internal(KIND_AUTO, path, script, opt)
+    freeze_internal(KIND_AUTO, path, script, opt, emit_option(native, viper))
 
 
 def freeze_as_str(path):
@@ -107,15 +113,15 @@ def freeze_as_str(path):
     which will be compiled upon import.
     """
 
-    freeze_internal(KIND_AS_STR, path, None, 0)
+    freeze_internal(KIND_AS_STR, path, None, 0, None)
 
 
-def freeze_as_mpy(path, script=None, opt=0):
+def freeze_as_mpy(path, script=None, opt=0, native=False, viper=False):
     """Freeze the input (see above) by first compiling the .py scripts to
     .mpy files, then freezing the resulting .mpy files.
     """
 
-    freeze_internal(KIND_AS_MPY, path, script, opt)
+    freeze_internal(KIND_AS_MPY, path, script, opt, emit_option(native, viper))
 
 
 def freeze_mpy(path, script=None, opt=0):
@@ -123,7 +129,7 @@ def freeze_mpy(path, script=None, opt=0):
     frozen directly.
     """
 
-    freeze_internal(KIND_MPY, path, script, opt)
+    freeze_internal(KIND_MPY, path, script, opt, None)
 
 
 ###########################################################################
@@ -155,6 +161,16 @@ class FreezeError(Exception):
     pass
 
 
+def emit_option(native, viper):
+    if native and viper:
+        raise FreezeError("native and viper can't both be used")
+    if native:
+        return "native"
+    if viper:
+        return "viper"
+    return None
+
+
 def system(cmd):
     try:
         output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
@@ -196,12 +212,12 @@ def mkdir(filename):
         os.makedirs(path)
 
 
-def freeze_internal(kind, path, script, opt):
+def freeze_internal(kind, path, script, opt, emit):
     path = convert_path(path)
     if not os.path.isdir(path):
         raise FreezeError("freeze path must be a directory: {}".format(path))
     if script is None and kind == KIND_AS_STR:
-        manifest_list.append((KIND_AS_STR, path, script, opt))
+        manifest_list.append((KIND_AS_STR, path, script, opt, emit))
     elif script is None or isinstance(script, str) and script.find(".") == -1:
         # Recursively search `path` for files to freeze, optionally restricted
         # to a subdirectory specified by `script`
@@ -211,11 +227,11 @@ def freeze_internal(kind, path, script, opt):
             subdir = "/" + script
         for dirpath, dirnames, filenames in os.walk(path + subdir, followlinks=True):
             for f in filenames:
-                freeze_internal(kind, path, (dirpath + "/" + f)[len(path) + 1 :], opt)
+                freeze_internal(kind, path, (dirpath + "/" + f)[len(path) + 1 :], opt, emit)
     elif not isinstance(script, str):
         # `script` is an iterable of items to freeze
         for s in script:
-            freeze_internal(kind, path, s, opt)
+            freeze_internal(kind, path, s, opt, emit)
     else:
         # `script` should specify an individual file to be frozen
         extension_kind = {KIND_AS_MPY: ".py", KIND_MPY: ".mpy"}
@@ -230,7 +246,11 @@ def freeze_internal(kind, path, script, opt):
         wanted_extension = extension_kind[kind]
         if not script.endswith(wanted_extension):
             raise FreezeError("expecting a {} file, got {}".format(wanted_extension, script))
-        manifest_list.append((kind, path, script, opt))
+        if emit is not None and kind != KIND_AS_MPY:
+            raise FreezeError("{} only applies to .py files, got {}".format(emit, script))
+        # A later freeze of the same file replaces the earlier one.
+        manifest_list[:] = [e for e in manifest_list if e[1:3] != (path, script)]
+        manifest_list.append((kind, path, script, opt, emit))
 
 
 # Formerly make-frozen.py.
@@ -312,6 +332,9 @@ def main():
     cmd_parser.add_argument(
         "-f", "--mpy-cross-flags", default="", help="flags to pass to mpy-cross"
     )
+    cmd_parser.add_argument(
+        "--native-arch", default="", help="mpy-cross -march value for native and viper modules"
+    )
     cmd_parser.add_argument("-v", "--var", action="append", help="variables to substitute")
     cmd_parser.add_argument("--mpy-tool-flags", default="", help="flags to pass to mpy-tool")
     cmd_parser.add_argument("files", nargs="+", help="input manifest list")
@@ -355,21 +378,30 @@ def main():
     str_paths = []
     mpy_files = []
     ts_newest = 0
-    for kind, path, script, opt in manifest_list:
+    for kind, path, script, opt, emit in manifest_list:
         if kind == KIND_AS_STR:
             str_paths.append(path)
             ts_outfile = get_timestamp_newest(path)
         elif kind == KIND_AS_MPY:
             infile = "{}/{}".format(path, script)
-            outfile = "{}/frozen_mpy/{}.mpy".format(args.build_dir, script[:-3])
+            emit_flags = []
+            if emit is None:
+                outfile = "{}/frozen_mpy/{}.mpy".format(args.build_dir, script[:-3])
+            else:
+                if not args.native_arch:
+                    print("error compiling {}: no native architecture for {}".format(infile, emit))
+                    raise SystemExit(1)
+                outfile = "{}/frozen_mpy/{}.{}.mpy".format(args.build_dir, script[:-3], emit)
+                emit_flags = ["-march=" + args.native_arch, "-X", "emit=" + emit]
             ts_infile = get_timestamp(infile)
             ts_outfile = get_timestamp(outfile, 0)
             if ts_infile >= ts_outfile:
-                print("MPY", script)
+                print("MPY", script + (" ({})".format(emit) if emit else ""))
                 mkdir(outfile)
                 res, out = system(
                     [MPY_CROSS]
                     + args.mpy_cross_flags.split()
+                    + emit_flags
                     + ["-o", outfile, "-s", script, "-O{}".format(opt), infile]
                 )
                 if res != 0:
@@ -45,6 +45,8 @@ class Config:
     MICROPY_LONGINT_IMPL_NONE = 0
     MICROPY_LONGINT_IMPL_LONGLONG = 1
     MICROPY_LONGINT_IMPL_MPZ = 2
+    # set if any of the .mpy files read may use superinstructions
+    MICROPY_OPT_SUPERINSTRUCTIONS = False
 
 
 config = Config()
@@ -93,6 +95,7 @@ MP_NATIVE_ARCH_ARMV7EMSP = 7
 MP_NATIVE_ARCH_ARMV7EMDP = 8
 MP_NATIVE_ARCH_XTENSA = 9
 MP_NATIVE_ARCH_XTENSAWIN = 10
+MP_NATIVE_ARCH_RV32IMC = 11
 
 MP_BC_MASK_EXTRA_BYTE = 0x9E
 
@@ -465,6 +468,7 @@ class RawCodeNative(RawCode):
             MP_NATIVE_ARCH_X64,
             MP_NATIVE_ARCH_XTENSA,
             MP_NATIVE_ARCH_XTENSAWIN,
+            MP_NATIVE_ARCH_RV32IMC,
         ):
             self.fun_data_attributes = '__attribute__((section(".text,\\"ax\\",@progbits # ")))'
         else:
@@ -473,12 +477,14 @@ class RawCodeNative(RawCode):
         # Allow single-byte alignment by default for x86/x64.
         # ARM needs word alignment, ARM Thumb needs halfword, due to instruction size.
         # Xtensa needs word alignment due to the 32-bit constant table embedded in the code.
+        # RV32 needs word alignment for the data words at the start of generators.
         if config.native_arch in (
             MP_NATIVE_ARCH_ARMV6,
             MP_NATIVE_ARCH_XTENSA,
             MP_NATIVE_ARCH_XTENSAWIN,
+            MP_NATIVE_ARCH_RV32IMC,
         ):
-            # ARMV6 or Xtensa -- four byte align.
+            # ARMV6, Xtensa or RV32 -- four byte align.
             self.fun_data_attributes += " __attribute__ ((aligned (4)))"
         elif MP_NATIVE_ARCH_ARMV6M <= config.native_arch <= MP_NATIVE_ARCH_ARMV7EMDP:
             # ARMVxxM -- two byte align.
@@ -490,6 +496,14 @@ class RawCodeNative(RawCode):
         print(" (%s & 0xff)," % (val,), end="")
         print(" (%u & 0x07) | (%s >> 4 & 0x70)," % (self.bytecode[pc + 3], val))
 
+    def _asm_rv32_rewrite_lui_addi(self, pc, val):
+        hi = "((%s + 0x800) >> 12)" % val
+        code = self.bytecode
+        print("    %u, (%u & 0x0f) | (%s << 4 & 0xf0)," % (code[pc], code[pc + 1], hi), end="")
+        print(" (%s >> 4) & 0xff, (%s >> 12) & 0xff," % (hi, hi), end="")
+        print(" %u, %u," % (code[pc + 4], code[pc + 5]), end="")
+        print(" (%u & 0x0f) | (%s << 4 & 0xf0), (%s >> 4) & 0xff," % (code[pc + 6], val, val))
+
     def _link_qstr(self, pc, kind, qst):
         if kind == 0:
             # Generic 16-bit link
@@ -522,6 +536,10 @@ class RawCodeNative(RawCode):
                     # qstr number, movw instruction
                     self._asm_thumb_rewrite_mov(pc, qst)
                     return 4
+            elif config.native_arch == MP_NATIVE_ARCH_RV32IMC:
+                # qstr number or object, lui and addi instructions
+                self._asm_rv32_rewrite_lui_addi(pc, qst)
+                return 8
             else:
                 assert 0
 
@@ -770,6 +788,8 @@ def read_mpy(filename):
         feature_byte = header[2]
         qw_size = read_uint(f)
         config.MICROPY_PY_BUILTINS_STR_UNICODE = (feature_byte & 2) != 0
+        if feature_byte & 1:
+            config.MICROPY_OPT_SUPERINSTRUCTIONS = True
         mpy_native_arch = feature_byte >> 2
         if mpy_native_arch != MP_NATIVE_ARCH_NONE:
             if config.native_arch == MP_NATIVE_ARCH_NONE:
@@ -818,6 +838,12 @@ def freeze_mpy(base_qstrs, raw_codes):
         print("#endif")
         print()
 
+    if config.MICROPY_OPT_SUPERINSTRUCTIONS:
+        print("#if !MICROPY_OPT_SUPERINSTRUCTIONS")
+        print('#error "frozen code uses superinstructions"')
+        print("#endif")
+        print()
+
     print("#if MICROPY_PY_BUILTINS_FLOAT")
     print("typedef struct _mp_obj_float_t {")
     print("    mp_obj_base_t base;")
@@ -918,7 +944,11 @@ def merge_mpy(raw_codes, output_file):
         header = bytearray(5)
         header[0] = ord("C")
         header[1] = config.MPY_VERSION
-        header[2] = config.native_arch << 2 | config.MICROPY_PY_BUILTINS_STR_UNICODE << 1
+        header[2] = (
+            config.native_arch << 2
+            | config.MICROPY_PY_BUILTINS_STR_UNICODE << 1
+            | config.MICROPY_OPT_SUPERINSTRUCTIONS
+        )
         header[3] = config.mp_small_int_bits
         header[4] = 32  # qstr_win_size
         merged_mpy.extend(header)
@@ -303,6 +303,9 @@ class LiteralEntry:
 
 class LinkEnv:
     def __init__(self, arch):
+        if arch not in ARCH_DATA:
+            # rv32imc .mpy files can come from mpy-cross but RISC-V relocations aren't handled here.
+            raise LinkError("unsupported arch %s" % arch)
         self.arch = ARCH_DATA[arch]
         self.sections = []  # list of sections in order of output
         self.literal_sections = []  # list of literal sections (xtensa only)
@@ -1046,8 +1049,8 @@ def do_link(args):
                         native_qstr_objs.append(m.group(1))
     log(LOG_LEVEL_2, "qstr vals: " + ", ".join(native_qstr_vals))
     log(LOG_LEVEL_2, "qstr objs: " + ", ".join(native_qstr_objs))
-    env = LinkEnv(args.arch)
     try:
+        env = LinkEnv(args.arch)
         for file in args.files:
             load_object_file(env, file)
         link_objects(env, len(native_qstr_vals), len(native_qstr_objs))